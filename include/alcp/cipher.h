@@ -81,6 +81,9 @@ typedef enum _alc_cipher_mode
     ALC_AES_MODE_GCM,
     ALC_AES_MODE_CCM,
     ALC_AES_MODE_SIV,
+    ALC_CHACHA20_POLY1305, /* RFC 8439 AEAD, ALC_CIPHER_TYPE_CHACHA20 */
+    ALC_AES_MODE_CBC_HMAC_SHA1,   /* TLS MAC-then-encrypt, AEAD API */
+    ALC_AES_MODE_CBC_HMAC_SHA256, /* TLS MAC-then-encrypt, AEAD API */
 
     ALC_AES_MODE_MAX,
 
@@ -69,13 +69,27 @@ typedef struct _alc_cipher_aead_mode_siv_info
     const alc_key_info_t* xi_ctr_key;
 } alc_cipher_aead_mode_siv_info_t, alc_cipher_aead_mode_siv_info_p;
 
+/**
+ * @brief  Stores special info needed for the CBC-HMAC-SHA modes.
+ *
+ * @param hi_mac_key   HMAC key, len in bits. An absent key is HMAC with the
+ *                     empty key
+ *
+ * @struct alc_cipher_aead_mode_cbc_hmac_info_t
+ */
+typedef struct _alc_cipher_aead_mode_cbc_hmac_info
+{
+    const alc_key_info_t* hi_mac_key;
+} alc_cipher_aead_mode_cbc_hmac_info_t,
+    *alc_cipher_aead_mode_cbc_hmac_info_p;
+
 /**
  *
  * @brief  Stores algorithm specific info for cipher.
  * @param ai_mode Specific which Mode of AES to be used @ref alcp_cipher_mode_t
  * @param ai_iv Initialization Vector
- * @param ai_gcm, ai_siv, optional param for Some Specific Mode of AES only one
- * param can be present at a time
+ * @param ai_gcm, ai_siv, ai_cbc_hmac, optional param for Some Specific Mode of
+ * AES only one param can be present at a time
  * @param alc_cipher_aead_algo_info_t AEAD algo info
  */
 typedef struct _alc_cipher_aead_algo_info
@@ -84,8 +98,9 @@ typedef struct _alc_cipher_aead_algo_info
     const Uint8*      ai_iv;   /* Initialization Vector */
     union
     {
-        alc_cipher_aead_mode_gcm_info_t ai_gcm;
-        alc_cipher_aead_mode_siv_info_t ai_siv;
+        alc_cipher_aead_mode_gcm_info_t      ai_gcm;
+        alc_cipher_aead_mode_siv_info_t      ai_siv;
+        alc_cipher_aead_mode_cbc_hmac_info_t ai_cbc_hmac;
     };
 } alc_cipher_aead_algo_info_t, *alc_cpher_aead_algo_info_p;
 
@@ -130,6 +145,36 @@ typedef struct _alc_cipher_aead_handle
     alc_cipher_context_p ch_context;
 } alc_cipher_aead_handle_t, *alc_cipher_aead_handle_p;
 
+/**
+ * @brief  One independent AEAD record of a batch, each with its own nonce,
+ * additional data and tag, all under the key of the handle.
+ *
+ * @param ar_iv        IV/Nonce of the record
+ * @param ar_iv_len    Length in bytes of the IV/Nonce
+ * @param ar_aad       Additional Data of the record, can be NULL if
+ *                     ar_aad_len is 0
+ * @param ar_aad_len   Length in bytes of the Additional Data
+ * @param ar_in        Input text of the record
+ * @param ar_out       Output text of the record, can be the same as ar_in
+ * @param ar_len       Length in bytes of input and output text
+ * @param ar_tag       Memory to write the tag of the record into
+ * @param ar_tag_len   Length in bytes of the tag
+ *
+ * @struct alc_cipher_aead_record_t
+ */
+typedef struct _alc_cipher_aead_record
+{
+    const Uint8* ar_iv;
+    Uint64       ar_iv_len;
+    const Uint8* ar_aad;
+    Uint64       ar_aad_len;
+    const Uint8* ar_in;
+    Uint8*       ar_out;
+    Uint64       ar_len;
+    Uint8*       ar_tag;
+    Uint64       ar_tag_len;
+} alc_cipher_aead_record_t, *alc_cipher_aead_record_p;
+
 /**
  *
  * @brief  Check if a given algorithm is supported.
@@ -309,6 +354,51 @@ alcp_cipher_aead_decrypt(const alc_cipher_handle_p pCipherHandle,
                          Uint64                    len,
                          const Uint8*              pIv);
 
+/**
+ * @brief    AEAD encryption of a batch of independent records with provided
+ * handle.
+ * @parblock <br> &nbsp;
+ * <b>This AEAD API can be called after @ref alcp_cipher_aead_request is
+ * called. Every record is a complete set_iv, set_aad, encrypt_update and
+ * get_tag sequence of its own, the key schedule and the hash subkey are shared
+ * across the batch. Only GCM mode supports it.</b>
+ * @endparblock
+ * @note    The IV/Nonce state of the handle is undefined after the call,
+ *          @ref alcp_cipher_aead_set_iv has to be called before a following
+ *          @ref alcp_cipher_aead_encrypt_update
+ * @param [in]   pCipherHandle Session handle for encrypt/decrypt operation
+ * @param[in]    pRecords  Records to encrypt, tags are written into them
+ * @param[in]    count     Number of records
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then @ref alcp_cipher_aead_error or @ref alcp_error_str
+ * needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_aead_encrypt_records(const alc_cipher_handle_p       pCipherHandle,
+                                 const alc_cipher_aead_record_t* pRecords,
+                                 Uint64                          count);
+
+/**
+ * @brief    AEAD decryption of a batch of independent records with provided
+ * handle.
+ * @parblock <br> &nbsp;
+ * <b>This AEAD API can be called after @ref alcp_cipher_aead_request is
+ * called. It is the counterpart of @ref alcp_cipher_aead_encrypt_records, the
+ * tag computed over each cipher text is written into ar_tag and has to be
+ * compared with the expected one by the caller.</b>
+ * @endparblock
+ * @param [in]   pCipherHandle Session handle for encrypt/decrypt operation
+ * @param[in]    pRecords  Records to decrypt, tags are written into them
+ * @param[in]    count     Number of records
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then @ref alcp_cipher_aead_error or @ref alcp_error_str
+ * needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_cipher_aead_decrypt_records(const alc_cipher_handle_p       pCipherHandle,
+                                 const alc_cipher_aead_record_t* pRecords,
+                                 Uint64                          count);
+
 /**
  * @brief AEAD set the IV/Nonce.
  * @parblock <br> &nbsp;
@@ -335,7 +425,9 @@ alcp_cipher_aead_set_iv(const alc_cipher_handle_p pCipherHandle,
  * SIV there should only be one call to this AEAD API and for others like GCM
  * and CCM mode, this has to be called after @ref alcp_cipher_aead_set_iv. For
  * SIV, this has to be called immediately after @ref alcp_cipher_aead_request,
- * also IV of SIV needs to be passed into this AEAD API as the last call.</b>
+ * also IV of SIV needs to be passed into this AEAD API as the last call. For
+ * the CBC-HMAC-SHA modes it takes the 13 byte TLS AAD of the one record that
+ * the next encrypt or decrypt update protects.</b>
  * @endparblock
  * @param[in] pCipherHandle Session handle for encrypt/decrypt operation
  * @param[in] pInput    Additional Data in Bytes
@@ -236,6 +236,32 @@ ALCP_API_EXPORT alc_error_t
 alcp_digest_request(const alc_digest_info_p p_digest_info,
                     alc_digest_handle_p     p_digest_handle);
 
+/**
+ * @brief       Duplicates a digest session, the message hashed so far
+ *              included
+ *
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_digest_request on the source
+ * handle. Both handles need their own @ref alcp_digest_finish at the end</b>
+ * @endparblock
+ *
+ * @note       The destination context memory must be at least
+ *             alcp_digest_context_size() bytes for the same digest info, it
+ *             must not hold a live session. Useful to hash several messages
+ *             sharing a common prefix.
+ *
+ * @param [in]      p_src_handle   Handle of the session to copy
+ *
+ * @param [out]     p_dest_handle  Handle whose context receives the copy
+ *
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then @ref alcp_error_str needs to be called to know
+ * about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_digest_context_copy(const alc_digest_handle_p p_src_handle,
+                         alc_digest_handle_p       p_dest_handle);
+
 /**
  * @brief       Computes digest for the buffer pointed by buf for size as
  *              as mentioned by size in bytes.
@@ -262,6 +288,36 @@ alcp_digest_update(const alc_digest_handle_p p_digest_handle,
                    const Uint8*              buf,
                    Uint64                    size);
 
+/**
+ * @brief       Updates several independent digest sessions at once, each
+ *              with its own message.
+ *
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_digest_request and at the end of
+ * session call @ref alcp_digest_finish</b>
+ * @endparblock
+ *
+ * @note       Same result as calling @ref alcp_digest_update for every
+ *             handle. Consecutive SHA2 or SHA3 handles are hashed side by
+ *             side in SIMD lanes, which pays off for many small messages. A
+ *             handle must not appear twice in one call.
+ *
+ * @param [in] p_digest_handles Handles returned by alcp_digest_request()
+ * @param [in] p_msg_bufs       Message for each handle, may be NULL where
+ *                              the size is 0
+ * @param [in] sizes            Message size in bytes for each handle
+ * @param [in] num              Number of handles
+ *
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then @ref alcp_error_str needs to be called to know
+ * about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_digest_update_multi(const alc_digest_handle_p p_digest_handles[],
+                         const Uint8* const        p_msg_bufs[],
+                         const Uint64              sizes[],
+                         Uint64                    num);
+
 /**
  * @brief       Digest is kept as part of p_digest_handle, this API allows
  *              it to be copied to specified buffer
@@ -315,6 +371,30 @@ alcp_digest_finalize(const alc_digest_handle_p p_digest_handle,
                      const Uint8*              p_msg_buf,
                      Uint64                    size);
 
+/**
+ * @brief       Finalizes several independent digest sessions at once.
+ *
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_digest_request and at the end of
+ * session call @ref alcp_digest_finish</b>
+ * @endparblock
+ *
+ * @note       Same result as calling @ref alcp_digest_finalize with no
+ *             message for every handle. Consecutive SHA3/SHAKE handles have
+ *             their last block and output squeeze batched across Keccak
+ *             states. A handle must not appear twice in one call.
+ *
+ * @param [in] p_digest_handles Handles returned by alcp_digest_request()
+ * @param [in] num              Number of handles
+ *
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then @ref alcp_error_str needs to be called to know
+ * about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_digest_finalize_multi(const alc_digest_handle_p p_digest_handles[],
+                           Uint64                    num);
+
 /**
  *
  * FIXME: Need to fix return type of API
@@ -53,6 +53,9 @@ typedef enum
 {
     ALCP_EC_CURVE25519 = 0,
     ALCP_EC_SECP256R1,
+    ALCP_EC_SECP384R1,
+    ALCP_EC_SECP521R1,
+    ALCP_EC_ED25519, /* signatures only, RFC 8032 */
     ALCP_EC_MAX,
 } alc_ec_curve_id;
 
@@ -65,6 +68,7 @@ typedef enum
 {
     ALCP_EC_CURVE_TYPE_SHORT_WEIERSTRASS = 0,
     ALCP_EC_CURVE_TYPE_MONTGOMERY,
+    ALCP_EC_CURVE_TYPE_TWISTED_EDWARDS,
     ALCP_EC_CURVE_TYPE_MAX
 } alc_ec_curve_type;
 
@@ -93,6 +93,107 @@ alcp_ec_get_secretkey(const alc_ec_handle_p pEcHandle,
                       const Uint8*          pPublicKey,
                       Uint64*               pKeyLength);
 
+/**
+ * @brief Function computes count secret keys at once, secret key i from
+ * privateKey i and the publicKey i of a remote peer. Meant for servers
+ * running many key exchanges, on AVX-512 IFMA hosts eight of them are
+ * computed side by side. Only supported for X25519.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_ec_request and at the
+ * end of session call @ref alcp_ec_finish</b>
+ * @endparblock
+ * @param [in] pEcHandle - Handler of the Context for the session
+ * @param [out] pSecretKeys - pointer to output secretKeys, count * 32 bytes
+ * @param [in] pPrivKeys - pointer to Input privateKeys, count * 32 bytes
+ * @param [in] pPublicKeys - pointer to Input publicKeys of the remote peers,
+ * count * 32 bytes
+ * @param [in] count - number of secret keys to compute
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_ec_get_secretkey_batch(const alc_ec_handle_p pEcHandle,
+                            Uint8*                pSecretKeys,
+                            const Uint8*          pPrivKeys,
+                            const Uint8*          pPublicKeys,
+                            Uint64                count);
+
+/**
+ * @brief Function signs a message digest with the privateKey set by
+ * @ref alcp_ec_set_privatekey, ECDSA with a deterministic (RFC 6979) nonce.
+ * For ALCP_EC_ED25519 pDigest is the message itself, signed as in RFC 8032
+ * with a 64 byte signature R || S. Curve25519 does not support signing.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_ec_set_privatekey and at the
+ * end of session call @ref alcp_ec_finish</b>
+ * @endparblock
+ * @param [in] pEcHandle - Handler of the Context for the session
+ * @param [in] pDigest - pointer to the message digest
+ * @param [in] digestSize - size of the digest in bytes
+ * @param [out] pSignature - pointer to output signature r || s, twice the
+ * key size
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_ec_sign(const alc_ec_handle_p pEcHandle,
+             const Uint8*          pDigest,
+             Uint64                digestSize,
+             Uint8*                pSignature);
+
+/**
+ * @brief Function verifies an ECDSA signature of a message digest against
+ * the signer publicKey. For ALCP_EC_ED25519 pDigest is the message and
+ * pPublicKey the 32 byte encoded key.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_ec_request and at the
+ * end of session call @ref alcp_ec_finish</b>
+ * @endparblock
+ * @param [in] pEcHandle - Handler of the Context for the session
+ * @param [in] pDigest - pointer to the message digest
+ * @param [in] digestSize - size of the digest in bytes
+ * @param [in] pSignature - pointer to signature r || s
+ * @param [in] pPublicKey - pointer to signer publicKey, as returned by
+ * @ref alcp_ec_get_publickey
+ * @return Error Code for the API called . ALC_ERROR_NONE only if the
+ * signature is valid
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_ec_verify(const alc_ec_handle_p pEcHandle,
+               const Uint8*          pDigest,
+               Uint64                digestSize,
+               const Uint8*          pSignature,
+               const Uint8*          pPublicKey);
+
+/**
+ * @brief Function verifies count Ed25519 signatures at once, signature i of
+ * message i under publicKey i. One multi scalar multiplication checks a
+ * random combination of all of them, much cheaper than @ref alcp_ec_verify
+ * for each. Only supported for ALCP_EC_ED25519.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_ec_request and at the
+ * end of session call @ref alcp_ec_finish</b>
+ * @endparblock
+ * @param [in] pEcHandle - Handler of the Context for the session
+ * @param [in] pMessages - pointers to the messages
+ * @param [in] pMessageSizes - size of each message in bytes
+ * @param [in] pSignatures - pointers to the 64 byte signatures R || S
+ * @param [in] pPublicKeys - pointers to the 32 byte signer publicKeys
+ * @param [in] count - number of signatures
+ * @param [out] pValid - optional, NULL or count flags set to the result of
+ * each signature
+ * @return Error Code for the API called . ALC_ERROR_NONE only if every
+ * signature is valid
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_ec_verify_batch(const alc_ec_handle_p pEcHandle,
+                     const Uint8* const    pMessages[],
+                     const Uint64          pMessageSizes[],
+                     const Uint8* const    pSignatures[],
+                     const Uint8* const    pPublicKeys[],
+                     Uint64                count,
+                     bool                  pValid[]);
+
 /**
  * @brief       Performs any cleanup actions
  *
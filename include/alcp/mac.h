@@ -192,6 +192,30 @@ alcp_mac_context_size(const alc_mac_info_p pMacInfo);
 ALCP_API_EXPORT alc_error_t
 alcp_mac_request(alc_mac_handle_p pMacHandle, const alc_mac_info_p pMacInfo);
 
+/**
+ * @brief    Duplicates a MAC session, key and message processed so far
+ *           included
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_mac_request on the source handle.
+ * Both handles need their own @ref alcp_mac_finish at the end</b>
+ * @endparblock
+ * @note     The destination context memory must be at least
+ *           alcp_mac_context_size() bytes for the same MAC info and must not
+ *           hold a live session. For HMAC the digest states after the
+ *           K0^ipad and K0^opad blocks are copied as well, so a copy taken
+ *           right after alcp_mac_request() authenticates a new message
+ *           without any key processing. Supported for HMAC and Poly1305.
+ * @param [in]   pSrcMacHandle   Session handle to copy
+ * @param [out]  pDestMacHandle  Session handle whose context receives the
+ *                               copy
+ * @return   &nbsp; Error Code for the API called. If alc_error_t
+ * is not ALC_ERROR_NONE then @ref alcp_mac_error or @ref alcp_error_str needs
+ * to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_mac_context_copy(const alc_mac_handle_p pSrcMacHandle,
+                      alc_mac_handle_p       pDestMacHandle);
+
 /**
  * @brief    Allows caller to update MAC with chunk of data to be authenticated
  * @parblock <br> &nbsp;
@@ -63,6 +63,8 @@ typedef enum
 {
     KEY_SIZE_1024 = 1024,
     KEY_SIZE_2048 = 2048,
+    KEY_SIZE_3072 = 3072,
+    KEY_SIZE_4096 = 4096,
     KEY_SIZE_UNSUPPORTED
 } alc_rsa_key_size;
 
@@ -85,6 +87,15 @@ typedef struct _alc_rsa_handle
     alc_rsa_context_p context;
 } alc_rsa_handle_t, *alc_rsa_handle_p;
 
+/**
+ * @brief Reference counted RSA key with its precomputed Montgomery contexts.
+ * It is never modified once created, so it can be set on any number of
+ * handles from any thread.
+ *
+ * @struct alc_rsa_key_t
+ */
+typedef struct _alc_rsa_key alc_rsa_key_t, *alc_rsa_key_p;
+
 /**
  * @brief       Returns the context size of the interaction
  *
@@ -105,7 +116,7 @@ alcp_rsa_context_size(const alc_rsa_key_size keySize);
  * @brief       Request a handle for rsa for a configuration
  *              as pointed by p_ec_info_p
  *
- * @note        Only 1024 and 2048 key size supported
+ * @note        1024, 2048, 3072 and 4096 key sizes are supported
  *
  * @param [in]  keySize         - Supported key size
  * @param [out] pRsaHandle      - Library populated session handle for future
@@ -146,6 +157,32 @@ alcp_rsa_publickey_encrypt(const alc_rsa_handle_p pRsaHandle,
                            Uint64                 textSize,
                            Uint8*                 pEncText);
 
+/**
+ * @brief Function encrypts a batch of texts, each with the public key of its
+ * own handle. The handles may hold different keys or all be the same one
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request</b>
+ * @endparblock
+ *
+ * @note  On CPUs with AVX512 IFMA up to 8 texts are encrypted side by side.
+ *        Every handle has to be requested for the same key size. Same
+ *        limitations as @ref alcp_rsa_publickey_encrypt with no padding
+ *
+ * @param [in]  pRsaHandle - array of handlers, one per text
+ * @param [in]  pText      - array of pointers to raw bytes
+ * @param [in]  textSize   - size of every text
+ * @param [out] pEncText   - array of pointers to encrypted bytes
+ * @param [in]  num        - number of texts
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_publickey_encrypt_batch(const alc_rsa_handle_p pRsaHandle[],
+                                 const Uint8* const     pText[],
+                                 Uint64                 textSize,
+                                 Uint8* const           pEncText[],
+                                 Uint64                 num);
+
 /**
  * @brief Function encrypts text using using public key and oaep padding
  * @parblock <br> &nbsp;
@@ -205,6 +242,42 @@ ALCP_API_EXPORT alc_error_t
 alcp_rsa_add_mgf_oaep(const alc_rsa_handle_p  pRsaHandle,
                       const alc_digest_info_p digestInfo);
 
+/**
+ * @brief Function adds the digest algorithm used to hash the message by
+ * oaep padding and by the sign/verify calls
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request</b>
+ * @endparblock
+ *
+ * @note  PKCS#1 v1.5 signatures support the SHA2 digests
+ *
+ * @param [in]  pRsaHandle         - Handler of the Context for the session
+ * @param [in]  digestInfo         - Description of the digest
+
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_add_digest(const alc_rsa_handle_p  pRsaHandle,
+                    const alc_digest_info_p digestInfo);
+
+/**
+ * @brief Function adds the digest algorithm for mask generation in oaep and
+ * pss padding
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request</b>
+ * @endparblock
+ *
+ * @param [in]  pRsaHandle         - Handler of the Context for the session
+ * @param [in]  digestInfo         - Description of the digest
+
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_add_mgf(const alc_rsa_handle_p  pRsaHandle,
+                 const alc_digest_info_p digestInfo);
+
 /**
  * @brief Function decrypts encrypted text using private key.
  * @parblock <br> &nbsp;
@@ -259,6 +332,237 @@ alcp_rsa_privatekey_decrypt_oaep(const alc_rsa_handle_p pRsaHandle,
                                  Uint8*                 pText,
                                  Uint64*                textSize);
 
+/**
+ * @brief Function signs the text using private key and PKCS#1 v1.5 padding
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request and the
+ * before the session call @ref alcp_rsa_finish</b>
+ * @endparblock
+ *
+ * @note  SHA2-256 is used when no digest was added
+ *
+ * @param [in]  pRsaHandle - Handler of the Context for the session
+ * @param [in]  check      - verify the signature with the public key
+ *                           before returning it
+ * @param [in]  pText      - pointer to message
+ * @param [in]  textSize   - size of message
+ * @param [out] pSignText  - pointer to signature of key size
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_privatekey_sign_pkcs1v15(const alc_rsa_handle_p pRsaHandle,
+                                  bool                   check,
+                                  const Uint8*           pText,
+                                  Uint64                 textSize,
+                                  Uint8*                 pSignText);
+
+/**
+ * @brief Function decrypts a batch of encrypted texts using private key.
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request and the
+ * before the session call @ref alcp_rsa_finish</b>
+ * @endparblock
+ *
+ * @note  On CPUs with AVX512 IFMA up to 8 texts are decrypted side by side,
+ *        trading the latency of one operation for throughput. Same
+ *        limitations as @ref alcp_rsa_privatekey_decrypt with no padding
+ *
+ * @param [in]  pRsaHandle - Handler of the Context for the session
+ * @param [in]  pEncText   - array of pointers to encrypted bytes
+ * @param [in]  encSize    - size of every encrypted text
+ * @param [out] pText      - array of pointers to decrypted bytes
+ * @param [in]  num        - number of texts
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_privatekey_decrypt_batch(const alc_rsa_handle_p pRsaHandle,
+                                  const Uint8* const     pEncText[],
+                                  Uint64                 encSize,
+                                  Uint8* const           pText[],
+                                  Uint64                 num);
+
+/**
+ * @brief Function signs a batch of texts using private key and PKCS#1 v1.5
+ * padding
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request and the
+ * before the session call @ref alcp_rsa_finish</b>
+ * @endparblock
+ *
+ * @param [in]  pRsaHandle - Handler of the Context for the session
+ * @param [in]  check      - verify the signatures with the public key
+ *                           before returning them
+ * @param [in]  pText      - array of pointers to messages
+ * @param [in]  textSize   - array of message sizes
+ * @param [out] pSignText  - array of pointers to signatures of key size
+ * @param [in]  num        - number of messages
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_privatekey_sign_pkcs1v15_batch(const alc_rsa_handle_p pRsaHandle,
+                                        bool                   check,
+                                        const Uint8* const     pText[],
+                                        const Uint64           textSize[],
+                                        Uint8* const           pSignText[],
+                                        Uint64                 num);
+
+/**
+ * @brief Function verifies the PKCS#1 v1.5 signature using public key
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request and the
+ * before the session call @ref alcp_rsa_finish</b>
+ * @endparblock
+ *
+ * @param [in]  pRsaHandle - Handler of the Context for the session
+ * @param [in]  pText      - pointer to message
+ * @param [in]  textSize   - size of message
+ * @param [in]  pSignText  - pointer to signature of key size
+ * @return ALC_ERROR_NONE when the signature matches the message
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_publickey_verify_pkcs1v15(const alc_rsa_handle_p pRsaHandle,
+                                   const Uint8*           pText,
+                                   Uint64                 textSize,
+                                   const Uint8*           pSignText);
+
+/**
+ * @brief Function verifies a batch of PKCS#1 v1.5 signatures, each with the
+ * public key and digest of its own handle
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request and the
+ * before the session call @ref alcp_rsa_finish</b>
+ * @endparblock
+ *
+ * @note  The public key operations run through
+ *        @ref alcp_rsa_publickey_encrypt_batch, so every handle has to be
+ *        requested for the same key size
+ *
+ * @param [in]  pRsaHandle - array of handlers, one per signature
+ * @param [in]  pText      - array of pointers to messages
+ * @param [in]  textSize   - array of message sizes
+ * @param [in]  pSignText  - array of pointers to signatures of key size
+ * @param [out] pValid     - set for every signature matching its message
+ * @param [in]  num        - number of signatures
+ * @return ALC_ERROR_NONE when all the signatures were checked, a signature
+ * that does not match is only reported through pValid
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_publickey_verify_pkcs1v15_batch(const alc_rsa_handle_p pRsaHandle[],
+                                         const Uint8* const     pText[],
+                                         const Uint64           textSize[],
+                                         const Uint8* const     pSignText[],
+                                         bool                   pValid[],
+                                         Uint64                 num);
+
+/**
+ * @brief Function signs the text using private key and PSS padding
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request and the
+ * before the session call @ref alcp_rsa_finish</b>
+ * @endparblock
+ *
+ * @note  SHA2-256 is used for digest and mgf when none was added
+ *
+ * @param [in]  pRsaHandle - Handler of the Context for the session
+ * @param [in]  check      - verify the signature with the public key
+ *                           before returning it
+ * @param [in]  pText      - pointer to message
+ * @param [in]  textSize   - size of message
+ * @param [in]  salt       - pointer to random salt
+ * @param [in]  saltSize   - size of salt
+ * @param [out] pSignText  - pointer to signature of key size
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_privatekey_sign_pss(const alc_rsa_handle_p pRsaHandle,
+                             bool                   check,
+                             const Uint8*           pText,
+                             Uint64                 textSize,
+                             const Uint8*           salt,
+                             Uint64                 saltSize,
+                             Uint8*                 pSignText);
+
+/**
+ * @brief Function signs a batch of texts using private key and PSS padding
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request and the
+ * before the session call @ref alcp_rsa_finish</b>
+ * @endparblock
+ *
+ * @param [in]  pRsaHandle - Handler of the Context for the session
+ * @param [in]  check      - verify the signatures with the public key
+ *                           before returning them
+ * @param [in]  pText      - array of pointers to messages
+ * @param [in]  textSize   - array of message sizes
+ * @param [in]  salt       - array of pointers to random salts
+ * @param [in]  saltSize   - size of every salt
+ * @param [out] pSignText  - array of pointers to signatures of key size
+ * @param [in]  num        - number of messages
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_privatekey_sign_pss_batch(const alc_rsa_handle_p pRsaHandle,
+                                   bool                   check,
+                                   const Uint8* const     pText[],
+                                   const Uint64           textSize[],
+                                   const Uint8* const     salt[],
+                                   Uint64                 saltSize,
+                                   Uint8* const           pSignText[],
+                                   Uint64                 num);
+
+/**
+ * @brief Function verifies the PSS signature using public key
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request and the
+ * before the session call @ref alcp_rsa_finish</b>
+ * @endparblock
+ *
+ * @param [in]  pRsaHandle - Handler of the Context for the session
+ * @param [in]  pText      - pointer to message
+ * @param [in]  textSize   - size of message
+ * @param [in]  pSignText  - pointer to signature of key size
+ * @return ALC_ERROR_NONE when the signature matches the message
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_publickey_verify_pss(const alc_rsa_handle_p pRsaHandle,
+                              const Uint8*           pText,
+                              Uint64                 textSize,
+                              const Uint8*           pSignText);
+
+/**
+ * @brief Function verifies a batch of PSS signatures, each with the public
+ * key, digest and mgf of its own handle
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request and the
+ * before the session call @ref alcp_rsa_finish</b>
+ * @endparblock
+ *
+ * @note  The public key operations run through
+ *        @ref alcp_rsa_publickey_encrypt_batch, so every handle has to be
+ *        requested for the same key size
+ *
+ * @param [in]  pRsaHandle - array of handlers, one per signature
+ * @param [in]  pText      - array of pointers to messages
+ * @param [in]  textSize   - array of message sizes
+ * @param [in]  pSignText  - array of pointers to signatures of key size
+ * @param [out] pValid     - set for every signature matching its message
+ * @param [in]  num        - number of signatures
+ * @return ALC_ERROR_NONE when all the signatures were checked, a signature
+ * that does not match is only reported through pValid
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_publickey_verify_pss_batch(const alc_rsa_handle_p pRsaHandle[],
+                                    const Uint8* const     pText[],
+                                    const Uint64           textSize[],
+                                    const Uint8* const     pSignText[],
+                                    bool                   pValid[],
+                                    Uint64                 num);
+
 /**
  * @brief Function fetches public key from handle
  * @parblock <br> &nbsp;
@@ -326,6 +630,141 @@ alcp_rsa_set_privatekey(const alc_rsa_handle_p pRsaHandle,
                         const Uint8*           mod,
                         Uint64                 size);
 
+/**
+ * @brief Function creates a key holding a public key
+ * @parblock <br> &nbsp;
+ * <b>The key has to be released with @ref alcp_rsa_key_free</b>
+ * @endparblock
+ * @param [in]   keySize    - key size the key is used for
+ * @param [in]   exponent   - public exponent
+ * @param [in]   pModulus   - pointer to the modulus
+ * @param [in]   size       - size of modulus
+ * @param [out]  ppKey      - the created key, with one reference
+ *
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_key_create_public(const alc_rsa_key_size keySize,
+                           Uint64                 exponent,
+                           const Uint8*           pModulus,
+                           Uint64                 size,
+                           alc_rsa_key_p*         ppKey);
+
+/**
+ * @brief Function creates a key holding both the public and the private key
+ * @parblock <br> &nbsp;
+ * <b>The key has to be released with @ref alcp_rsa_key_free</b>
+ * @endparblock
+ * @param [in]   keySize    - key size the key is used for
+ * @param [in]   exponent   - public exponent
+ * @param [in]   dp         - pointer to first exponent
+ * @param [in]   dq         - pointer to second exponent
+ * @param [in]   p          - pointer to first modulus
+ * @param [in]   q          - pointer to second modulus
+ * @param [in]   qinv       - pointer to inverse of second modulus
+ * @param [in]   mod        - pointer to mult of first and second modulus
+ * @param [in]   size       - size of first modulus, as in
+ *                            @ref alcp_rsa_set_privatekey
+ * @param [out]  ppKey      - the created key, with one reference
+ *
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_key_create_private(const alc_rsa_key_size keySize,
+                            Uint64                 exponent,
+                            const Uint8*           dp,
+                            const Uint8*           dq,
+                            const Uint8*           p,
+                            const Uint8*           q,
+                            const Uint8*           qinv,
+                            const Uint8*           mod,
+                            Uint64                 size,
+                            alc_rsa_key_p*         ppKey);
+
+/**
+ * @brief Function generates a new key pair of keySize bits, 2048 bits or more
+ * @parblock <br> &nbsp;
+ * <b>The key has to be released with @ref alcp_rsa_key_free</b>
+ * @endparblock
+ * @param [in]   keySize    - key size to generate
+ * @param [in]   exponent   - odd public exponent, at least 3
+ * @param [out]  ppKey      - the generated key, with one reference
+ *
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_key_generate(const alc_rsa_key_size keySize,
+                      Uint64                 exponent,
+                      alc_rsa_key_p*         ppKey);
+
+/**
+ * @brief Function exports the components of a key holding a private key, in
+ * the big endian form taken by @ref alcp_rsa_key_create_private
+ * @param [in]   pKey       - key holding a private key
+ * @param [out]  pExponent  - public exponent
+ * @param [out]  dp         - first exponent, size bytes
+ * @param [out]  dq         - second exponent, size bytes
+ * @param [out]  p          - first modulus, size bytes
+ * @param [out]  q          - second modulus, size bytes
+ * @param [out]  qinv       - inverse of second modulus, size bytes
+ * @param [out]  mod        - mult of first and second modulus, 2 * size bytes
+ * @param [in]   size       - size of first modulus
+ *
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_key_get_privatekey(const alc_rsa_key_p pKey,
+                            Uint64*             pExponent,
+                            Uint8*              dp,
+                            Uint8*              dq,
+                            Uint8*              p,
+                            Uint8*              q,
+                            Uint8*              qinv,
+                            Uint8*              mod,
+                            Uint64              size);
+
+/**
+ * @brief Function takes one more reference to the key
+ *
+ * @param [in]   pKey       - key created by alcp_rsa_key_create_*
+ *
+ * @return Error Code for the API called
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_key_up_ref(alc_rsa_key_p pKey);
+
+/**
+ * @brief Function drops one reference to the key, the key is destroyed
+ * when the last one is dropped. Handles set to the key keep using it
+ * until they are finished or set to another key.
+ *
+ * @param [in]   pKey       - key created by alcp_rsa_key_create_*
+ *
+ * @return None
+ */
+ALCP_API_EXPORT void
+alcp_rsa_key_free(alc_rsa_key_p pKey);
+
+/**
+ * @brief Function sets a shared key inside the handle, replacing both the
+ * public and the private key. The Montgomery contexts of the key are used as
+ * they are, nothing is recomputed
+ * @parblock <br> &nbsp;
+ * <b>This API can be called after @ref alcp_rsa_request</b>
+ * @endparblock
+ * @param [in]   pRsaHandle - handler of the Context for the session
+ * @param [in]   pKey       - key of the key size the handle was requested for
+ *
+ * @return Error Code for the API called . if alc_error_t is not zero then
+ * alcp_error_str needs to be called to know about error occurred
+ */
+ALCP_API_EXPORT alc_error_t
+alcp_rsa_set_key(const alc_rsa_handle_p pRsaHandle, const alc_rsa_key_p pKey);
+
 /**
  * @brief       Fetches key size
  * @parblock <br> &nbsp;
@@ -30,14 +30,8 @@
 #define _ALCP_TYPES_H_ 2
 
 #ifndef __cplusplus
-#ifndef bool
-typedef enum
-{
-    false,
-    true
-} bool;
-#endif
-
+// the one byte bool of C++, which the library returns and takes in arrays
+#include <stdbool.h>
 #include <stdint.h>
 #else
 #include <cstdint>
@@ -32,15 +32,15 @@
 #define ALCP_CONFIG_LITTLE_ENDIAN
 
 // CPU Identification
-#define ALCP_ENABLE_AOCL_CPUID
+/* #undef ALCP_ENABLE_AOCL_UTILS */
 
 // ALCP Release Version
-#define AOCL_RELEASE_VERSION "4.1.0"
-#define ALCP_RELEASE_VERSION_STRING "AOCL-Crypto 4.1.0 Build 20230807"
+#define AOCL_RELEASE_VERSION "4.2"
+#define ALCP_RELEASE_VERSION_STRING "AOCL-Crypto 4.2 Build 20261017"
 
 // ALCP lib path
 #define ALCP_LIB_OUTPUT_FILE_NAME_STRING                                  \
-    "/projects/crypto/1/pjayaraj/OpenSourceCrypto/aocl-crypto/build/libalcp.so"
+    "/root/repo/_gate_build/libalcp.so"
 
 // Compiler Detection
 /* #undef COMPILER_IS_CLANG */
@@ -56,5 +56,19 @@
 
 // CPU Identification
 #define ALCP_DISABLE_ASSEMBLY 0
+/* #undef ALCP_CPUID_FORCE */
+/* #undef ALCP_CPUID_DISABLE_AVX512 */
+/* #undef ALCP_CPUID_DISABLE_AVX2 */
+/* #undef ALCP_CPUID_DISABLE_AESNI */
+/* #undef ALCP_CPUID_DISABLE_VAES */
+/* #undef ALCP_CPUID_DISABLE_SHANI */
+/* #undef ALCP_CPUID_DISABLE_RAND */
+/* #undef ALCP_CPUID_DISABLE_AVX */
+/* #undef ALCP_CPUID_DISABLE_BMI2 */
+/* #undef ALCP_CPUID_DISABLE_ADX */
+/* #undef ALCP_CPUID_FORCE_ZEN */
+/* #undef ALCP_CPUID_FORCE_ZEN2 */
+/* #undef ALCP_CPUID_FORCE_ZEN3 */
+/* #undef ALCP_CPUID_FORCE_ZEN4 */
 
 #endif /* _INCLUDE_CONFIG_H */
@@ -0,0 +1,448 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes_cbc_hmac_sha.hh"
+#include "alcp/cipher/aesni.hh"
+
+#include <immintrin.h>
+#include <utility> // for integer_sequence
+
+/*
+ * Stitched AES-CBC and SHA kernels for the TLS MAC-then-encrypt ciphers.
+ *
+ * CBC encryption is a serial chain, every AES round waits for the one
+ * before it, while the SHA-NI rounds of a hash block form a second chain
+ * that does not depend on it. Each iteration hashes one 64 byte block and
+ * runs the AES of one 64 byte chunk, with the AES rounds spread between the
+ * hash rounds so that both chains are in flight together. Decryption is
+ * parallel already, its four blocks go round by round beside the hash.
+ *
+ * The hash input of an iteration is loaded before the chunk is written, so
+ * pHashSrc may trail into the chunk being encrypted in place as long as it
+ * does not start before it.
+ */
+
+namespace alcp::cipher { namespace aesni {
+
+    namespace {
+
+        /* Serial CBC encryption of a chunk, one AES round per step */
+        class CbcEncChunk
+        {
+          public:
+            CbcEncChunk(const Uint8* pKey, int nRounds, const Uint8* pIv)
+                : m_key{ reinterpret_cast<const __m128i*>(pKey) }
+                , m_nrounds{ nRounds }
+                , m_iv{ _mm_loadu_si128((const __m128i*)pIv) }
+            {}
+
+            inline void start(const Uint8* pSrc, Uint8* pDest)
+            {
+                m_src   = reinterpret_cast<const __m128i*>(pSrc);
+                m_dest  = reinterpret_cast<__m128i*>(pDest);
+                m_blk   = 0;
+                m_round = 0;
+            }
+
+            inline void step()
+            {
+                if (m_blk == 4) {
+                    return;
+                }
+                if (m_round == 0) {
+                    m_state = _mm_xor_si128(_mm_loadu_si128(m_src + m_blk),
+                                            _mm_xor_si128(m_iv, m_key[0]));
+                    m_round = 1;
+                } else if (m_round < m_nrounds) {
+                    m_state = _mm_aesenc_si128(m_state, m_key[m_round]);
+                    m_round++;
+                } else {
+                    m_iv = _mm_aesenclast_si128(m_state, m_key[m_nrounds]);
+                    _mm_storeu_si128(m_dest + m_blk, m_iv);
+                    m_blk++;
+                    m_round = 0;
+                }
+            }
+
+            inline void finish()
+            {
+                while (m_blk < 4) {
+                    step();
+                }
+            }
+
+            inline void storeIv(Uint8* pIv) const
+            {
+                _mm_storeu_si128((__m128i*)pIv, m_iv);
+            }
+
+          private:
+            const __m128i* m_key;
+            int            m_nrounds;
+            __m128i        m_iv;
+            __m128i        m_state;
+            const __m128i* m_src  = nullptr;
+            __m128i*       m_dest = nullptr;
+            int            m_blk  = 0;
+            int            m_round = 0;
+        };
+
+        /* CBC decryption of a chunk, one AES round of all four blocks per
+         * step */
+        class CbcDecChunk
+        {
+          public:
+            CbcDecChunk(const Uint8* pKey, int nRounds, const Uint8* pIv)
+                : m_key{ reinterpret_cast<const __m128i*>(pKey) }
+                , m_nrounds{ nRounds }
+                , m_iv{ _mm_loadu_si128((const __m128i*)pIv) }
+            {}
+
+            inline void start(const Uint8* pSrc, Uint8* pDest)
+            {
+                auto p_src = reinterpret_cast<const __m128i*>(pSrc);
+
+                m_dest = reinterpret_cast<__m128i*>(pDest);
+                for (int i = 0; i < 4; i++) {
+                    m_in[i]    = _mm_loadu_si128(p_src + i);
+                    m_state[i] = _mm_xor_si128(m_in[i], m_key[0]);
+                }
+                m_round = 1;
+            }
+
+            inline void step()
+            {
+                if (m_round < m_nrounds) {
+                    for (int i = 0; i < 4; i++) {
+                        m_state[i] =
+                            _mm_aesdec_si128(m_state[i], m_key[m_round]);
+                    }
+                    m_round++;
+                } else if (m_round == m_nrounds) {
+                    for (int i = 0; i < 4; i++) {
+                        m_state[i] =
+                            _mm_aesdeclast_si128(m_state[i], m_key[m_round]);
+                    }
+                    _mm_storeu_si128(m_dest, _mm_xor_si128(m_state[0], m_iv));
+                    for (int i = 1; i < 4; i++) {
+                        _mm_storeu_si128(
+                            m_dest + i, _mm_xor_si128(m_state[i], m_in[i - 1]));
+                    }
+                    m_iv = m_in[3];
+                    m_round++;
+                }
+            }
+
+            inline void finish()
+            {
+                while (m_round <= m_nrounds) {
+                    step();
+                }
+            }
+
+            inline void storeIv(Uint8* pIv) const
+            {
+                _mm_storeu_si128((__m128i*)pIv, m_iv);
+            }
+
+          private:
+            const __m128i* m_key;
+            int            m_nrounds;
+            __m128i        m_iv;
+            __m128i        m_in[4];
+            __m128i        m_state[4];
+            __m128i*       m_dest  = nullptr;
+            int            m_round = 0;
+        };
+
+        inline void loadBlock(__m128i w[4], const Uint8* pSrc, __m128i mask)
+        {
+            for (int i = 0; i < 4; i++) {
+                w[i] = _mm_loadu_si128((const __m128i*)(pSrc + 16 * i));
+                w[i] = _mm_shuffle_epi8(w[i], mask);
+            }
+        }
+
+        /* Four SHA-1 rounds, see digest::shani::ShaUpdate1() */
+        template<int I, int STEPS, typename CHUNK>
+        inline void sha1Quad(__m128i  w[4],
+                             __m128i& abcd,
+                             __m128i& e,
+                             __m128i& abcd_prev,
+                             CHUNK&   aes)
+        {
+            if constexpr (I >= 4) {
+                w[I & 3] = _mm_sha1msg2_epu32(
+                    _mm_xor_si128(_mm_sha1msg1_epu32(w[I & 3], w[(I + 1) & 3]),
+                                  w[(I + 2) & 3]),
+                    w[(I + 3) & 3]);
+            }
+            if constexpr (I == 0) {
+                e = _mm_add_epi32(e, w[0]);
+            } else {
+                e = _mm_sha1nexte_epu32(abcd_prev, w[I & 3]);
+            }
+            abcd_prev = abcd;
+            abcd      = _mm_sha1rnds4_epu32(abcd, e, I / 5);
+            for (int i = 0; i < STEPS; i++) {
+                aes.step();
+            }
+        }
+
+        template<int STEPS, typename CHUNK, int... I>
+        inline void sha1Rounds(__m128i  w[4],
+                               __m128i& abcd,
+                               __m128i& e,
+                               __m128i& abcd_prev,
+                               CHUNK&   aes,
+                               std::integer_sequence<int, I...>)
+        {
+            (sha1Quad<I, STEPS>(w, abcd, e, abcd_prev, aes), ...);
+        }
+
+        template<typename CHUNK, int STEPS>
+        inline void CbcSha1(const Uint8* pSrc,
+                            Uint8*       pDest,
+                            Uint64       chunks,
+                            const Uint8* pKey,
+                            int          nRounds,
+                            Uint8*       pIv,
+                            Uint32*      pHash,
+                            const Uint8* pHashSrc)
+        {
+            const __m128i mask =
+                _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+            CHUNK   aes(pKey, nRounds, pIv);
+            __m128i w[4];
+            __m128i abcd, e, abcd_prev, abcd_save, e_save;
+
+            abcd = _mm_loadu_si128((const __m128i*)pHash);
+            abcd = _mm_shuffle_epi32(abcd, 0x1B);
+            e    = _mm_set_epi32(pHash[4], 0, 0, 0);
+
+            for (; chunks > 0; chunks--) {
+                loadBlock(w, pHashSrc, mask);
+                aes.start(pSrc, pDest);
+                abcd_save = abcd;
+                e_save    = e;
+                abcd_prev = abcd;
+
+                sha1Rounds<STEPS>(w,
+                                  abcd,
+                                  e,
+                                  abcd_prev,
+                                  aes,
+                                  std::make_integer_sequence<int, 20>{});
+                aes.finish();
+
+                e    = _mm_sha1nexte_epu32(abcd_prev, e_save);
+                abcd = _mm_add_epi32(abcd, abcd_save);
+
+                pSrc += 64;
+                pDest += 64;
+                pHashSrc += 64;
+            }
+
+            abcd = _mm_shuffle_epi32(abcd, 0x1B);
+            _mm_storeu_si128((__m128i*)pHash, abcd);
+            pHash[4] = _mm_extract_epi32(e, 3);
+            aes.storeIv(pIv);
+        }
+
+        /* Four SHA-256 rounds, see digest::shani::ShaUpdate256() */
+        template<int I, int STEPS, typename CHUNK>
+        inline void sha256Quad(__m128i       w[4],
+                               __m128i&      state0,
+                               __m128i&      state1,
+                               const Uint32* pK,
+                               CHUNK&        aes)
+        {
+            __m128i msg;
+
+            if constexpr (I >= 4) {
+                msg = _mm_sha256msg1_epu32(w[I & 3], w[(I + 1) & 3]);
+                msg = _mm_add_epi32(
+                    msg, _mm_alignr_epi8(w[(I + 3) & 3], w[(I + 2) & 3], 4));
+                w[I & 3] = _mm_sha256msg2_epu32(msg, w[(I + 3) & 3]);
+            }
+            msg    = _mm_add_epi32(w[I & 3],
+                                _mm_loadu_si128((const __m128i*)(pK + 4 * I)));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            msg    = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+            for (int i = 0; i < STEPS; i++) {
+                aes.step();
+            }
+        }
+
+        template<int STEPS, typename CHUNK, int... I>
+        inline void sha256Rounds(__m128i       w[4],
+                                 __m128i&      state0,
+                                 __m128i&      state1,
+                                 const Uint32* pK,
+                                 CHUNK&        aes,
+                                 std::integer_sequence<int, I...>)
+        {
+            (sha256Quad<I, STEPS>(w, state0, state1, pK, aes), ...);
+        }
+
+        template<typename CHUNK, int STEPS>
+        inline void CbcSha256(const Uint8*  pSrc,
+                              Uint8*        pDest,
+                              Uint64        chunks,
+                              const Uint8*  pKey,
+                              int           nRounds,
+                              Uint8*        pIv,
+                              Uint32*       pHash,
+                              const Uint8*  pHashSrc,
+                              const Uint32* pHashConstants)
+        {
+            const __m128i mask =
+                _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+            CHUNK   aes(pKey, nRounds, pIv);
+            __m128i w[4];
+            __m128i state0, state1, tmp, abef_save, cdgh_save;
+
+            // ABCD/EFGH to the ABEF/CDGH order of sha256rnds2
+            tmp    = _mm_loadu_si128((const __m128i*)&pHash[0]);
+            state1 = _mm_loadu_si128((const __m128i*)&pHash[4]);
+            tmp    = _mm_shuffle_epi32(tmp, 0xB1);
+            state1 = _mm_shuffle_epi32(state1, 0x1B);
+            state0 = _mm_alignr_epi8(tmp, state1, 8);
+            state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+            for (; chunks > 0; chunks--) {
+                loadBlock(w, pHashSrc, mask);
+                aes.start(pSrc, pDest);
+                abef_save = state0;
+                cdgh_save = state1;
+
+                sha256Rounds<STEPS>(w,
+                                    state0,
+                                    state1,
+                                    pHashConstants,
+                                    aes,
+                                    std::make_integer_sequence<int, 16>{});
+                aes.finish();
+
+                state0 = _mm_add_epi32(state0, abef_save);
+                state1 = _mm_add_epi32(state1, cdgh_save);
+
+                pSrc += 64;
+                pDest += 64;
+                pHashSrc += 64;
+            }
+
+            tmp    = _mm_shuffle_epi32(state0, 0x1B);
+            state1 = _mm_shuffle_epi32(state1, 0xB1);
+            state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+            state1 = _mm_alignr_epi8(state1, tmp, 8);
+            _mm_storeu_si128((__m128i*)&pHash[0], state0);
+            _mm_storeu_si128((__m128i*)&pHash[4], state1);
+            aes.storeIv(pIv);
+        }
+
+    } // namespace
+
+    /*
+     * Enough AES steps per group of four hash rounds to finish the chunk:
+     * 4 * (14 + 1) for AES-256 encryption, 14 for AES-256 decryption.
+     */
+    alc_error_t EncryptCbcSha1(const Uint8* pSrc,
+                               Uint8*       pDest,
+                               Uint64       chunks,
+                               const Uint8* pKey,
+                               int          nRounds,
+                               Uint8*       pIv,
+                               Uint32*      pHash,
+                               const Uint8* pHashSrc)
+    {
+        CbcSha1<CbcEncChunk, 3>(
+            pSrc, pDest, chunks, pKey, nRounds, pIv, pHash, pHashSrc);
+        return ALC_ERROR_NONE;
+    }
+
+    alc_error_t DecryptCbcSha1(const Uint8* pSrc,
+                               Uint8*       pDest,
+                               Uint64       chunks,
+                               const Uint8* pKey,
+                               int          nRounds,
+                               Uint8*       pIv,
+                               Uint32*      pHash,
+                               const Uint8* pHashSrc)
+    {
+        CbcSha1<CbcDecChunk, 1>(
+            pSrc, pDest, chunks, pKey, nRounds, pIv, pHash, pHashSrc);
+        return ALC_ERROR_NONE;
+    }
+
+    alc_error_t EncryptCbcSha256(const Uint8*  pSrc,
+                                 Uint8*        pDest,
+                                 Uint64        chunks,
+                                 const Uint8*  pKey,
+                                 int           nRounds,
+                                 Uint8*        pIv,
+                                 Uint32*       pHash,
+                                 const Uint8*  pHashSrc,
+                                 const Uint32* pHashConstants)
+    {
+        CbcSha256<CbcEncChunk, 4>(pSrc,
+                                  pDest,
+                                  chunks,
+                                  pKey,
+                                  nRounds,
+                                  pIv,
+                                  pHash,
+                                  pHashSrc,
+                                  pHashConstants);
+        return ALC_ERROR_NONE;
+    }
+
+    alc_error_t DecryptCbcSha256(const Uint8*  pSrc,
+                                 Uint8*        pDest,
+                                 Uint64        chunks,
+                                 const Uint8*  pKey,
+                                 int           nRounds,
+                                 Uint8*        pIv,
+                                 Uint32*       pHash,
+                                 const Uint8*  pHashSrc,
+                                 const Uint32* pHashConstants)
+    {
+        CbcSha256<CbcDecChunk, 1>(pSrc,
+                                  pDest,
+                                  chunks,
+                                  pKey,
+                                  nRounds,
+                                  pIv,
+                                  pHash,
+                                  pHashSrc,
+                                  pHashConstants);
+        return ALC_ERROR_NONE;
+    }
+
+}} // namespace alcp::cipher::aesni
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/cipher/chacha20.hh"
+#include <cstring>
+#include <immintrin.h>
+
+/*
+ * 8-way ChaCha20, state is kept transposed: register i holds word i of eight
+ * consecutive blocks, so the double round needs no lane shuffles and 512
+ * bytes of keystream are produced per iteration.
+ */
+namespace alcp::cipher::chacha20::avx2 {
+
+static inline __m256i
+Rotl16(__m256i x)
+{
+    const __m256i cShuf = _mm256_setr_epi8(2,  3,  0,  1,  6,  7,  4,  5,
+                                           10, 11, 8,  9,  14, 15, 12, 13,
+                                           2,  3,  0,  1,  6,  7,  4,  5,
+                                           10, 11, 8,  9,  14, 15, 12, 13);
+    return _mm256_shuffle_epi8(x, cShuf);
+}
+
+static inline __m256i
+Rotl8(__m256i x)
+{
+    const __m256i cShuf = _mm256_setr_epi8(3,  0,  1,  2,  7,  4,  5,  6,
+                                           11, 8,  9,  10, 15, 12, 13, 14,
+                                           3,  0,  1,  2,  7,  4,  5,  6,
+                                           11, 8,  9,  10, 15, 12, 13, 14);
+    return _mm256_shuffle_epi8(x, cShuf);
+}
+
+template<int bits>
+static inline __m256i
+Rotl(__m256i x)
+{
+    return _mm256_or_si256(_mm256_slli_epi32(x, bits),
+                           _mm256_srli_epi32(x, 32 - bits));
+}
+
+static inline void
+QuarterRound(__m256i& a, __m256i& b, __m256i& c, __m256i& d)
+{
+    a = _mm256_add_epi32(a, b);
+    d = Rotl16(_mm256_xor_si256(d, a));
+    c = _mm256_add_epi32(c, d);
+    b = Rotl<12>(_mm256_xor_si256(b, c));
+    a = _mm256_add_epi32(a, b);
+    d = Rotl8(_mm256_xor_si256(d, a));
+    c = _mm256_add_epi32(c, d);
+    b = Rotl<7>(_mm256_xor_si256(b, c));
+}
+
+/*
+ * Transposes 8 registers of word-sliced state (x[0..7] or x[8..15]) into 32
+ * byte halves of the 8 blocks, XORs them with the input and stores.
+ */
+static inline void
+XorStoreHalf(const __m256i x[8],
+             const Uint8   plaintext[],
+             Uint8         ciphertext[])
+{
+    __m256i t0 = _mm256_unpacklo_epi32(x[0], x[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(x[0], x[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(x[2], x[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(x[2], x[3]);
+    __m256i t4 = _mm256_unpacklo_epi32(x[4], x[5]);
+    __m256i t5 = _mm256_unpackhi_epi32(x[4], x[5]);
+    __m256i t6 = _mm256_unpacklo_epi32(x[6], x[7]);
+    __m256i t7 = _mm256_unpackhi_epi32(x[6], x[7]);
+
+    // u[k] holds words 0..3 (u[k + 4] words 4..7) of blocks k and k + 4
+    __m256i u[8];
+    u[0] = _mm256_unpacklo_epi64(t0, t2);
+    u[1] = _mm256_unpackhi_epi64(t0, t2);
+    u[2] = _mm256_unpacklo_epi64(t1, t3);
+    u[3] = _mm256_unpackhi_epi64(t1, t3);
+    u[4] = _mm256_unpacklo_epi64(t4, t6);
+    u[5] = _mm256_unpackhi_epi64(t4, t6);
+    u[6] = _mm256_unpacklo_epi64(t5, t7);
+    u[7] = _mm256_unpackhi_epi64(t5, t7);
+
+    for (int k = 0; k < 4; k++) {
+        __m256i lo = _mm256_permute2x128_si256(u[k], u[k + 4], 0x20);
+        __m256i hi = _mm256_permute2x128_si256(u[k], u[k + 4], 0x31);
+
+        const __m256i* p_in_lo =
+            reinterpret_cast<const __m256i*>(plaintext + k * 64);
+        const __m256i* p_in_hi =
+            reinterpret_cast<const __m256i*>(plaintext + (k + 4) * 64);
+
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(ciphertext + k * 64),
+            _mm256_xor_si256(lo, _mm256_loadu_si256(p_in_lo)));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(ciphertext + (k + 4) * 64),
+            _mm256_xor_si256(hi, _mm256_loadu_si256(p_in_hi)));
+    }
+}
+
+static void
+processParallelBlocks(const Uint8 key[],
+                      const Uint8 iv[],
+                      const Uint8 plaintext[],
+                      Uint8       ciphertext[],
+                      Uint64      chacha20_parallel_blocks)
+{
+    __m256i state[16];
+    for (int i = 0; i < 4; i++) {
+        state[i] = _mm256_set1_epi32(Chacha20Constants[i]);
+    }
+    for (int i = 0; i < 8; i++) {
+        Uint32 word;
+        memcpy(&word, key + 4 * i, sizeof(word));
+        state[4 + i] = _mm256_set1_epi32(word);
+    }
+    for (int i = 0; i < 4; i++) {
+        Uint32 word;
+        memcpy(&word, iv + 4 * i, sizeof(word));
+        state[12 + i] = _mm256_set1_epi32(word);
+    }
+    state[12] =
+        _mm256_add_epi32(state[12], _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    const __m256i cInc = _mm256_set1_epi32(8);
+
+    for (Uint64 k = 0; k < chacha20_parallel_blocks; k++) {
+        __m256i x[16];
+        for (int i = 0; i < 16; i++) {
+            x[i] = state[i];
+        }
+
+        for (int i = 0; i < 10; i++) {
+            // Column Round
+            QuarterRound(x[0], x[4], x[8], x[12]);
+            QuarterRound(x[1], x[5], x[9], x[13]);
+            QuarterRound(x[2], x[6], x[10], x[14]);
+            QuarterRound(x[3], x[7], x[11], x[15]);
+            // Diagonal Round
+            QuarterRound(x[0], x[5], x[10], x[15]);
+            QuarterRound(x[1], x[6], x[11], x[12]);
+            QuarterRound(x[2], x[7], x[8], x[13]);
+            QuarterRound(x[3], x[4], x[9], x[14]);
+        }
+
+        for (int i = 0; i < 16; i++) {
+            x[i] = _mm256_add_epi32(x[i], state[i]);
+        }
+
+        XorStoreHalf(x, plaintext, ciphertext);
+        XorStoreHalf(x + 8, plaintext + 32, ciphertext + 32);
+
+        plaintext += 512;
+        ciphertext += 512;
+        state[12] = _mm256_add_epi32(state[12], cInc);
+    }
+}
+
+alc_error_t
+ProcessInput(const Uint8 key[],
+             Uint64      keylen,
+             const Uint8 iv[],
+             Uint64      ivlen,
+             const Uint8 plaintext[],
+             Uint64      plaintextLength,
+             Uint8       ciphertext[])
+{
+    Uint64 chacha20_parallel_blocks = plaintextLength / 512;
+    Uint64 chacha20_non_parallel_bytes =
+        plaintextLength - (chacha20_parallel_blocks * 512);
+    if (chacha20_parallel_blocks > 0) {
+        processParallelBlocks(
+            key, iv, plaintext, ciphertext, chacha20_parallel_blocks);
+        plaintext += chacha20_parallel_blocks * 512;
+        ciphertext += chacha20_parallel_blocks * 512;
+    }
+
+    if (chacha20_non_parallel_bytes > 0) {
+        alignas(32) Uint8 chacha20_key_stream[512] = {};
+        Uint8             iv_copy[16];
+        Uint32            counter;
+        memcpy(iv_copy, iv, 16);
+        memcpy(&counter, iv_copy, sizeof(counter));
+        counter += 8 * chacha20_parallel_blocks;
+        memcpy(iv_copy, &counter, sizeof(counter));
+        processParallelBlocks(
+            key, iv_copy, chacha20_key_stream, chacha20_key_stream, 1);
+        for (Uint64 i = 0; i < chacha20_non_parallel_bytes; i++) {
+            *(ciphertext) = chacha20_key_stream[i] ^ *(plaintext);
+            plaintext++;
+            ciphertext++;
+        }
+        memset(chacha20_key_stream, 0, sizeof(chacha20_key_stream));
+    }
+    return ALC_ERROR_NONE;
+}
+
+} // namespace alcp::cipher::chacha20::avx2
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/mac/poly1305_arch.hh"
+
+#include <immintrin.h>
+
+namespace alcp::mac::poly1305::avx2 {
+
+// Number of 16 byte blocks absorbed in parallel
+static constexpr Uint64 cLanes = 4;
+
+/**
+ * @brief Loads 4 consecutive blocks, one block per 64 bit lane, as radix
+ * 2^26 limbs with the 2^128 pad bit set.
+ */
+static inline void
+LoadBlocks(const Uint8* pMsg, __m256i m[5])
+{
+    const __m256i mask26 = _mm256_set1_epi64x(cMask26);
+    const __m256i hibit  = _mm256_set1_epi64x(1 << 24);
+
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pMsg));
+    __m256i b =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pMsg + 32));
+
+    // [B0, B2, B1, B3] -> [B0, B1, B2, B3]
+    __m256i lo = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), 0xd8);
+    __m256i hi = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), 0xd8);
+
+    m[0] = _mm256_and_si256(lo, mask26);
+    m[1] = _mm256_and_si256(_mm256_srli_epi64(lo, 26), mask26);
+    m[2] = _mm256_and_si256(
+        _mm256_or_si256(_mm256_srli_epi64(lo, 52), _mm256_slli_epi64(hi, 12)),
+        mask26);
+    m[3] = _mm256_and_si256(_mm256_srli_epi64(hi, 14), mask26);
+    m[4] = _mm256_or_si256(_mm256_srli_epi64(hi, 40), hibit);
+}
+
+/**
+ * @brief h = h * r mod 2^130-5, lazily reduced, s[i] = 5 * r[i]
+ */
+static inline void
+MulReduce(__m256i h[5], const __m256i r[5], const __m256i s[5])
+{
+    const __m256i mask26 = _mm256_set1_epi64x(cMask26);
+    __m256i       d[5], c;
+
+    // clang-format off
+    d[0] = _mm256_mul_epu32(h[0], r[0]);
+    d[0] = _mm256_add_epi64(d[0], _mm256_mul_epu32(h[1], s[4]));
+    d[0] = _mm256_add_epi64(d[0], _mm256_mul_epu32(h[2], s[3]));
+    d[0] = _mm256_add_epi64(d[0], _mm256_mul_epu32(h[3], s[2]));
+    d[0] = _mm256_add_epi64(d[0], _mm256_mul_epu32(h[4], s[1]));
+
+    d[1] = _mm256_mul_epu32(h[0], r[1]);
+    d[1] = _mm256_add_epi64(d[1], _mm256_mul_epu32(h[1], r[0]));
+    d[1] = _mm256_add_epi64(d[1], _mm256_mul_epu32(h[2], s[4]));
+    d[1] = _mm256_add_epi64(d[1], _mm256_mul_epu32(h[3], s[3]));
+    d[1] = _mm256_add_epi64(d[1], _mm256_mul_epu32(h[4], s[2]));
+
+    d[2] = _mm256_mul_epu32(h[0], r[2]);
+    d[2] = _mm256_add_epi64(d[2], _mm256_mul_epu32(h[1], r[1]));
+    d[2] = _mm256_add_epi64(d[2], _mm256_mul_epu32(h[2], r[0]));
+    d[2] = _mm256_add_epi64(d[2], _mm256_mul_epu32(h[3], s[4]));
+    d[2] = _mm256_add_epi64(d[2], _mm256_mul_epu32(h[4], s[3]));
+
+    d[3] = _mm256_mul_epu32(h[0], r[3]);
+    d[3] = _mm256_add_epi64(d[3], _mm256_mul_epu32(h[1], r[2]));
+    d[3] = _mm256_add_epi64(d[3], _mm256_mul_epu32(h[2], r[1]));
+    d[3] = _mm256_add_epi64(d[3], _mm256_mul_epu32(h[3], r[0]));
+    d[3] = _mm256_add_epi64(d[3], _mm256_mul_epu32(h[4], s[4]));
+
+    d[4] = _mm256_mul_epu32(h[0], r[4]);
+    d[4] = _mm256_add_epi64(d[4], _mm256_mul_epu32(h[1], r[3]));
+    d[4] = _mm256_add_epi64(d[4], _mm256_mul_epu32(h[2], r[2]));
+    d[4] = _mm256_add_epi64(d[4], _mm256_mul_epu32(h[3], r[1]));
+    d[4] = _mm256_add_epi64(d[4], _mm256_mul_epu32(h[4], r[0]));
+    // clang-format on
+
+    c    = _mm256_srli_epi64(d[0], 26);
+    h[0] = _mm256_and_si256(d[0], mask26);
+    d[1] = _mm256_add_epi64(d[1], c);
+    c    = _mm256_srli_epi64(d[1], 26);
+    h[1] = _mm256_and_si256(d[1], mask26);
+    d[2] = _mm256_add_epi64(d[2], c);
+    c    = _mm256_srli_epi64(d[2], 26);
+    h[2] = _mm256_and_si256(d[2], mask26);
+    d[3] = _mm256_add_epi64(d[3], c);
+    c    = _mm256_srli_epi64(d[3], 26);
+    h[3] = _mm256_and_si256(d[3], mask26);
+    d[4] = _mm256_add_epi64(d[4], c);
+    c    = _mm256_srli_epi64(d[4], 26);
+    h[4] = _mm256_and_si256(d[4], mask26);
+    // c * 5 = c + (c << 2)
+    h[0] = _mm256_add_epi64(
+        h[0], _mm256_add_epi64(c, _mm256_slli_epi64(c, 2)));
+    c    = _mm256_srli_epi64(h[0], 26);
+    h[0] = _mm256_and_si256(h[0], mask26);
+    h[1] = _mm256_add_epi64(h[1], c);
+}
+
+Uint64
+Poly1305Blocks(Poly1305State& state, const Uint8 pMsg[], Uint64 msgLen)
+{
+    constexpr Uint64 cStride = cLanes * 16;
+
+    Uint64 blocks = msgLen / cStride;
+    if (blocks == 0) {
+        return 0;
+    }
+
+    __m256i h[5], m[5], r[5], s[5];
+    Uint64  acc[5];
+
+    Radix44Carry(state.m_acc);
+    Radix44ToRadix26(state.m_acc, acc);
+
+    // r^4 in every lane
+    for (int i = 0; i < 5; i++) {
+        r[i] = _mm256_set1_epi64x(state.m_r_pow26[cLanes - 1][i]);
+        s[i] = _mm256_set1_epi64x(state.m_r_pow26[cLanes - 1][i] * 5);
+    }
+
+    // Lane j starts with block j, the accumulator is folded into lane 0
+    LoadBlocks(pMsg, h);
+    for (int i = 0; i < 5; i++) {
+        h[i] = _mm256_add_epi64(h[i], _mm256_setr_epi64x(acc[i], 0, 0, 0));
+    }
+    pMsg += cStride;
+
+    for (Uint64 k = 1; k < blocks; k++) {
+        MulReduce(h, r, s);
+        LoadBlocks(pMsg, m);
+        for (int i = 0; i < 5; i++) {
+            h[i] = _mm256_add_epi64(h[i], m[i]);
+        }
+        pMsg += cStride;
+    }
+
+    // Lane j is multiplied by r^(4-j), then all lanes are summed
+    const auto& pw = state.m_r_pow26;
+    for (int i = 0; i < 5; i++) {
+        r[i] = _mm256_setr_epi64x(pw[3][i], pw[2][i], pw[1][i], pw[0][i]);
+        s[i] = _mm256_setr_epi64x(
+            pw[3][i] * 5, pw[2][i] * 5, pw[1][i] * 5, pw[0][i] * 5);
+    }
+    MulReduce(h, r, s);
+
+    alignas(32) Uint64 lanes[cLanes];
+    for (int i = 0; i < 5; i++) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), h[i]);
+        acc[i] = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+    Radix26ToRadix44(acc, state.m_acc);
+
+    return blocks * cStride;
+}
+
+} // namespace alcp::mac::poly1305::avx2
@@ -0,0 +1,338 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/digest/sha2_512.hh"
+#include "alcp/digest/sha_mb.hh"
+
+#include <immintrin.h>
+
+/*
+ * Multi-buffer SHA-256 (8 lanes) and SHA-512 (4 lanes) with AVX2, each
+ * 32/64-bit element of a ymm register belongs to a different message.
+ */
+namespace alcp::digest { namespace avx2 {
+
+    template<int N>
+    static inline __m256i Ror32(__m256i x)
+    {
+        return _mm256_or_si256(_mm256_srli_epi32(x, N),
+                               _mm256_slli_epi32(x, 32 - N));
+    }
+
+    template<int N>
+    static inline __m256i Ror64(__m256i x)
+    {
+        return _mm256_or_si256(_mm256_srli_epi64(x, N),
+                               _mm256_slli_epi64(x, 64 - N));
+    }
+
+    static inline __m256i Xor3(__m256i a, __m256i b, __m256i c)
+    {
+        return _mm256_xor_si256(_mm256_xor_si256(a, b), c);
+    }
+
+    static inline __m256i Ch(__m256i e, __m256i f, __m256i g)
+    {
+        return _mm256_xor_si256(_mm256_and_si256(e, f),
+                                _mm256_andnot_si256(e, g));
+    }
+
+    static inline __m256i Maj(__m256i a, __m256i b, __m256i c)
+    {
+        return _mm256_or_si256(_mm256_and_si256(a, b),
+                               _mm256_and_si256(c, _mm256_or_si256(a, b)));
+    }
+
+    /* Transposes the state words of the lanes into/out of the registers */
+    template<typename WORD, int LANES>
+    static inline void LoadHash(WORD* pHash[], __m256i s[8])
+    {
+        alignas(32) WORD tmp[8][LANES];
+        for (int l = 0; l < LANES; l++) {
+            for (int j = 0; j < 8; j++) {
+                tmp[j][l] = pHash[l][j];
+            }
+        }
+        for (int j = 0; j < 8; j++) {
+            s[j] = _mm256_load_si256(reinterpret_cast<const __m256i*>(tmp[j]));
+        }
+    }
+
+    template<typename WORD, int LANES>
+    static inline void StoreHash(WORD* pHash[], const __m256i s[8])
+    {
+        alignas(32) WORD tmp[8][LANES];
+        for (int j = 0; j < 8; j++) {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(tmp[j]), s[j]);
+        }
+        for (int l = 0; l < LANES; l++) {
+            for (int j = 0; j < 8; j++) {
+                pHash[l][j] = tmp[j][l];
+            }
+        }
+    }
+
+    /*
+     * SHA-256
+     */
+    static inline void Round256(__m256i  a,
+                                __m256i  b,
+                                __m256i  c,
+                                __m256i& d,
+                                __m256i  e,
+                                __m256i  f,
+                                __m256i  g,
+                                __m256i& h,
+                                __m256i  kw)
+    {
+        __m256i s1 = Xor3(Ror32<6>(e), Ror32<11>(e), Ror32<25>(e));
+        __m256i s0 = Xor3(Ror32<2>(a), Ror32<13>(a), Ror32<22>(a));
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, s1),
+                                      _mm256_add_epi32(Ch(e, f, g), kw));
+        d          = _mm256_add_epi32(d, t1);
+        h = _mm256_add_epi32(t1, _mm256_add_epi32(s0, Maj(a, b, c)));
+    }
+
+    static inline __m256i Schedule256(const __m256i w[16], int t)
+    {
+        __m256i w15 = w[(t + 1) & 15];
+        __m256i w2  = w[(t + 14) & 15];
+        __m256i s0 =
+            Xor3(Ror32<7>(w15), Ror32<18>(w15), _mm256_srli_epi32(w15, 3));
+        __m256i s1 =
+            Xor3(Ror32<17>(w2), Ror32<19>(w2), _mm256_srli_epi32(w2, 10));
+        return _mm256_add_epi32(_mm256_add_epi32(w[t & 15], s0),
+                                _mm256_add_epi32(w[(t + 9) & 15], s1));
+    }
+
+    /* Words 8h..8h+7 of the current block of all 8 lanes */
+    static inline void LoadMsg256(const Uint8* pSrc[8], int half, __m256i w[])
+    {
+        const __m256i cBswap = _mm256_setr_epi8(
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        __m256i r[8], t[8], u[8];
+        for (int l = 0; l < 8; l++) {
+            r[l] = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(pSrc[l] + 32 * half));
+        }
+        for (int g = 0; g < 2; g++) {
+            t[4 * g]     = _mm256_unpacklo_epi32(r[4 * g], r[4 * g + 1]);
+            t[4 * g + 1] = _mm256_unpackhi_epi32(r[4 * g], r[4 * g + 1]);
+            t[4 * g + 2] = _mm256_unpacklo_epi32(r[4 * g + 2], r[4 * g + 3]);
+            t[4 * g + 3] = _mm256_unpackhi_epi32(r[4 * g + 2], r[4 * g + 3]);
+            u[4 * g]     = _mm256_unpacklo_epi64(t[4 * g], t[4 * g + 2]);
+            u[4 * g + 1] = _mm256_unpackhi_epi64(t[4 * g], t[4 * g + 2]);
+            u[4 * g + 2] = _mm256_unpacklo_epi64(t[4 * g + 1], t[4 * g + 3]);
+            u[4 * g + 3] = _mm256_unpackhi_epi64(t[4 * g + 1], t[4 * g + 3]);
+        }
+        for (int k = 0; k < 4; k++) {
+            w[k]     = _mm256_permute2x128_si256(u[k], u[4 + k], 0x20);
+            w[4 + k] = _mm256_permute2x128_si256(u[k], u[4 + k], 0x31);
+        }
+        for (int k = 0; k < 8; k++) {
+            w[k] = _mm256_shuffle_epi8(w[k], cBswap);
+        }
+    }
+
+    void ShaUpdate256x8(Uint32*       pHash[8],
+                        const Uint8*  pSrc[8],
+                        Uint64        numBlocks,
+                        const Uint32* pHashConstants)
+    {
+        __m256i      s[8], w[16];
+        const Uint8* p_src[8];
+
+        for (int l = 0; l < 8; l++) {
+            p_src[l] = pSrc[l];
+        }
+        LoadHash<Uint32, 8>(pHash, s);
+
+        while (numBlocks--) {
+            __m256i a = s[0], b = s[1], c = s[2], d = s[3];
+            __m256i e = s[4], f = s[5], g = s[6], h = s[7];
+
+            LoadMsg256(p_src, 0, &w[0]);
+            LoadMsg256(p_src, 1, &w[8]);
+
+            for (int t = 0; t < 64; t += 8) {
+                if (t >= 16) {
+                    for (int i = 0; i < 8; i++) {
+                        w[(t + i) & 15] = Schedule256(w, t + i);
+                    }
+                }
+                __m256i kw[8];
+                for (int i = 0; i < 8; i++) {
+                    kw[i] = _mm256_add_epi32(
+                        w[(t + i) & 15],
+                        _mm256_set1_epi32(pHashConstants[t + i]));
+                }
+                Round256(a, b, c, d, e, f, g, h, kw[0]);
+                Round256(h, a, b, c, d, e, f, g, kw[1]);
+                Round256(g, h, a, b, c, d, e, f, kw[2]);
+                Round256(f, g, h, a, b, c, d, e, kw[3]);
+                Round256(e, f, g, h, a, b, c, d, kw[4]);
+                Round256(d, e, f, g, h, a, b, c, kw[5]);
+                Round256(c, d, e, f, g, h, a, b, kw[6]);
+                Round256(b, c, d, e, f, g, h, a, kw[7]);
+            }
+
+            s[0] = _mm256_add_epi32(s[0], a);
+            s[1] = _mm256_add_epi32(s[1], b);
+            s[2] = _mm256_add_epi32(s[2], c);
+            s[3] = _mm256_add_epi32(s[3], d);
+            s[4] = _mm256_add_epi32(s[4], e);
+            s[5] = _mm256_add_epi32(s[5], f);
+            s[6] = _mm256_add_epi32(s[6], g);
+            s[7] = _mm256_add_epi32(s[7], h);
+
+            for (int l = 0; l < 8; l++) {
+                p_src[l] += 64;
+            }
+        }
+
+        StoreHash<Uint32, 8>(pHash, s);
+    }
+
+    /*
+     * SHA-512
+     */
+    static inline void Round512(__m256i  a,
+                                __m256i  b,
+                                __m256i  c,
+                                __m256i& d,
+                                __m256i  e,
+                                __m256i  f,
+                                __m256i  g,
+                                __m256i& h,
+                                __m256i  kw)
+    {
+        __m256i s1 = Xor3(Ror64<14>(e), Ror64<18>(e), Ror64<41>(e));
+        __m256i s0 = Xor3(Ror64<28>(a), Ror64<34>(a), Ror64<39>(a));
+        __m256i t1 = _mm256_add_epi64(_mm256_add_epi64(h, s1),
+                                      _mm256_add_epi64(Ch(e, f, g), kw));
+        d          = _mm256_add_epi64(d, t1);
+        h = _mm256_add_epi64(t1, _mm256_add_epi64(s0, Maj(a, b, c)));
+    }
+
+    static inline __m256i Schedule512(const __m256i w[16], int t)
+    {
+        __m256i w15 = w[(t + 1) & 15];
+        __m256i w2  = w[(t + 14) & 15];
+        __m256i s0 =
+            Xor3(Ror64<1>(w15), Ror64<8>(w15), _mm256_srli_epi64(w15, 7));
+        __m256i s1 =
+            Xor3(Ror64<19>(w2), Ror64<61>(w2), _mm256_srli_epi64(w2, 6));
+        return _mm256_add_epi64(_mm256_add_epi64(w[t & 15], s0),
+                                _mm256_add_epi64(w[(t + 9) & 15], s1));
+    }
+
+    /* Words 4q..4q+3 of the current block of all 4 lanes */
+    static inline void LoadMsg512(const Uint8* pSrc[4], int q, __m256i w[])
+    {
+        const __m256i cBswap = _mm256_setr_epi8(
+            7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+            7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+        __m256i r[4];
+        for (int l = 0; l < 4; l++) {
+            r[l] = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(pSrc[l] + 32 * q));
+        }
+        __m256i t0 = _mm256_unpacklo_epi64(r[0], r[1]);
+        __m256i t1 = _mm256_unpackhi_epi64(r[0], r[1]);
+        __m256i t2 = _mm256_unpacklo_epi64(r[2], r[3]);
+        __m256i t3 = _mm256_unpackhi_epi64(r[2], r[3]);
+
+        w[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+        w[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+        w[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+        w[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+        for (int k = 0; k < 4; k++) {
+            w[k] = _mm256_shuffle_epi8(w[k], cBswap);
+        }
+    }
+
+    void ShaUpdate512x4(Uint64*      pHash[4],
+                        const Uint8* pSrc[4],
+                        Uint64       numBlocks)
+    {
+        __m256i      s[8], w[16];
+        const Uint8* p_src[4];
+
+        for (int l = 0; l < 4; l++) {
+            p_src[l] = pSrc[l];
+        }
+        LoadHash<Uint64, 4>(pHash, s);
+
+        while (numBlocks--) {
+            __m256i a = s[0], b = s[1], c = s[2], d = s[3];
+            __m256i e = s[4], f = s[5], g = s[6], h = s[7];
+
+            for (int q = 0; q < 4; q++) {
+                LoadMsg512(p_src, q, &w[4 * q]);
+            }
+
+            for (int t = 0; t < 80; t += 8) {
+                if (t >= 16) {
+                    for (int i = 0; i < 8; i++) {
+                        w[(t + i) & 15] = Schedule512(w, t + i);
+                    }
+                }
+                __m256i kw[8];
+                for (int i = 0; i < 8; i++) {
+                    kw[i] = _mm256_add_epi64(
+                        w[(t + i) & 15],
+                        _mm256_set1_epi64x(cRoundConstants[t + i]));
+                }
+                Round512(a, b, c, d, e, f, g, h, kw[0]);
+                Round512(h, a, b, c, d, e, f, g, kw[1]);
+                Round512(g, h, a, b, c, d, e, f, kw[2]);
+                Round512(f, g, h, a, b, c, d, e, kw[3]);
+                Round512(e, f, g, h, a, b, c, d, kw[4]);
+                Round512(d, e, f, g, h, a, b, c, kw[5]);
+                Round512(c, d, e, f, g, h, a, b, kw[6]);
+                Round512(b, c, d, e, f, g, h, a, kw[7]);
+            }
+
+            s[0] = _mm256_add_epi64(s[0], a);
+            s[1] = _mm256_add_epi64(s[1], b);
+            s[2] = _mm256_add_epi64(s[2], c);
+            s[3] = _mm256_add_epi64(s[3], d);
+            s[4] = _mm256_add_epi64(s[4], e);
+            s[5] = _mm256_add_epi64(s[5], f);
+            s[6] = _mm256_add_epi64(s[6], g);
+            s[7] = _mm256_add_epi64(s[7], h);
+
+            for (int l = 0; l < 4; l++) {
+                p_src[l] += 128;
+            }
+        }
+
+        StoreHash<Uint64, 4>(pHash, s);
+    }
+
+}} // namespace alcp::digest::avx2
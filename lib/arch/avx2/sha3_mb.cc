@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/digest/sha3.hh"
+
+#include <cstring>
+#include <immintrin.h>
+
+#if defined(COMPILER_IS_GCC)
+#define UNROLL_5 _Pragma("GCC unroll 5")
+#else
+#define UNROLL_5
+#endif
+
+/*
+ * Keccak-f[1600] on 4 independent states with AVX2. Register i holds lane i
+ * of the state (i = x + 5y) for all 4 states, so every step of the
+ * permutation is the plain scalar algorithm on vectors.
+ */
+namespace alcp::digest { namespace avx2 {
+
+    static inline __m256i Rotl(__m256i x, __m256i n, __m256i n_inv)
+    {
+        return _mm256_or_si256(_mm256_sllv_epi64(x, n),
+                               _mm256_srlv_epi64(x, n_inv));
+    }
+
+    static inline __m256i Xor5(
+        __m256i a, __m256i b, __m256i c, __m256i d, __m256i e)
+    {
+        return _mm256_xor_si256(
+            _mm256_xor_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(c, d)),
+            e);
+    }
+
+    static inline void KeccakF1600x4(__m256i a[cDim * cDim])
+    {
+        __m256i rho[cDim * cDim], rho_inv[cDim * cDim];
+        UNROLL_5
+        for (int y = 0; y < cDim; y++) {
+            UNROLL_5
+            for (int x = 0; x < cDim; x++) {
+                rho[x + cDim * y] =
+                    _mm256_set1_epi64x(cRotationConstants[y][x]);
+                rho_inv[x + cDim * y] =
+                    _mm256_set1_epi64x(64 - cRotationConstants[y][x]);
+            }
+        }
+
+        for (int round = 0; round < 24; round++) {
+            __m256i c[cDim], d[cDim], b[cDim * cDim];
+
+            // Theta
+            UNROLL_5
+            for (int x = 0; x < cDim; x++) {
+                c[x] = Xor5(a[x], a[x + 5], a[x + 10], a[x + 15], a[x + 20]);
+            }
+            UNROLL_5
+            for (int x = 0; x < cDim; x++) {
+                __m256i next = c[(x + 1) % cDim];
+                d[x]         = _mm256_xor_si256(
+                    c[(x + 4) % cDim],
+                    _mm256_or_si256(_mm256_slli_epi64(next, 1),
+                                    _mm256_srli_epi64(next, 63)));
+            }
+
+            // Rho and Pi, (x, y) moves to (y, 2x + 3y)
+            UNROLL_5
+            for (int y = 0; y < cDim; y++) {
+                UNROLL_5
+                for (int x = 0; x < cDim; x++) {
+                    int i = x + cDim * y;
+                    b[y + cDim * ((2 * x + 3 * y) % cDim)] =
+                        Rotl(_mm256_xor_si256(a[i], d[x]), rho[i], rho_inv[i]);
+                }
+            }
+
+            // Chi
+            UNROLL_5
+            for (int y = 0; y < cDim; y++) {
+                UNROLL_5
+                for (int x = 0; x < cDim; x++) {
+                    a[x + cDim * y] = _mm256_xor_si256(
+                        b[x + cDim * y],
+                        _mm256_andnot_si256(b[(x + 1) % cDim + cDim * y],
+                                            b[(x + 2) % cDim + cDim * y]));
+                }
+            }
+
+            // Iota
+            a[0] = _mm256_xor_si256(
+                a[0], _mm256_set1_epi64x(cKeccakRoundConstants[round]));
+        }
+    }
+
+    static inline Uint64 LoadWord(const Uint8* p)
+    {
+        Uint64 word;
+        memcpy(&word, p, sizeof(word));
+        return word;
+    }
+
+    void Sha3UpdateX4(Uint64*      pState[4],
+                      const Uint8* pSrc[4],
+                      Uint64       numBlocks,
+                      Uint64       chunkSize)
+    {
+        const Uint64 cWords = chunkSize / 8;
+        const Uint8* p_src[4];
+        __m256i      a[cDim * cDim];
+
+        alignas(32) Uint64 tmp[cDim * cDim][4];
+        for (int l = 0; l < 4; l++) {
+            p_src[l] = pSrc[l];
+            for (int i = 0; i < cDim * cDim; i++) {
+                tmp[i][l] = pState[l][i];
+            }
+        }
+        for (int i = 0; i < cDim * cDim; i++) {
+            a[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(tmp[i]));
+        }
+
+        while (numBlocks--) {
+            Uint64 i = 0;
+            // Four words of every state at a time, 4x4 transposed
+            for (; i + 4 <= cWords; i += 4) {
+                __m256i r[4];
+                for (int l = 0; l < 4; l++) {
+                    r[l] = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(p_src[l] + 8 * i));
+                }
+                __m256i t0 = _mm256_unpacklo_epi64(r[0], r[1]);
+                __m256i t1 = _mm256_unpackhi_epi64(r[0], r[1]);
+                __m256i t2 = _mm256_unpacklo_epi64(r[2], r[3]);
+                __m256i t3 = _mm256_unpackhi_epi64(r[2], r[3]);
+
+                a[i]     = _mm256_xor_si256(
+                    a[i], _mm256_permute2x128_si256(t0, t2, 0x20));
+                a[i + 1] = _mm256_xor_si256(
+                    a[i + 1], _mm256_permute2x128_si256(t1, t3, 0x20));
+                a[i + 2] = _mm256_xor_si256(
+                    a[i + 2], _mm256_permute2x128_si256(t0, t2, 0x31));
+                a[i + 3] = _mm256_xor_si256(
+                    a[i + 3], _mm256_permute2x128_si256(t1, t3, 0x31));
+            }
+            for (; i < cWords; i++) {
+                a[i] = _mm256_xor_si256(
+                    a[i],
+                    _mm256_setr_epi64x(LoadWord(p_src[0] + 8 * i),
+                                       LoadWord(p_src[1] + 8 * i),
+                                       LoadWord(p_src[2] + 8 * i),
+                                       LoadWord(p_src[3] + 8 * i)));
+            }
+
+            KeccakF1600x4(a);
+
+            for (int l = 0; l < 4; l++) {
+                p_src[l] += chunkSize;
+            }
+        }
+
+        for (int i = 0; i < cDim * cDim; i++) {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(tmp[i]), a[i]);
+        }
+        for (int l = 0; l < 4; l++) {
+            for (int i = 0; i < cDim * cDim; i++) {
+                pState[l][i] = tmp[i][l];
+            }
+        }
+    }
+
+}} // namespace alcp::digest::avx2
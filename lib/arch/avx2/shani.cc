@@ -30,6 +30,8 @@
 #include "config.h"
 #include <x86intrin.h>
 
+#include <utility> // for integer_sequence
+
 // number of vectors needed to accomodate an input chunk
 #define SHA256_CHUNK_NUM_VECT 4
 
@@ -141,4 +143,78 @@ namespace alcp::digest { namespace shani {
         return ALC_ERROR_NONE;
     }
 
+    /*
+     * SHA-1 rounds are done four at a time by sha1rnds4, whose function
+     * selector changes every 20 rounds. The message schedule
+     * W[i] = msg2(msg1(W[i-4], W[i-3]) ^ W[i-2], W[i-1]) only needs the last
+     * four vectors, so it is kept in a ring of four.
+     */
+    template<int I>
+    inline static void sha1_quad(__m128i  w[4],
+                                 __m128i& abcd,
+                                 __m128i& e,
+                                 __m128i& abcd_prev)
+    {
+        if constexpr (I >= 4) {
+            w[I & 3] = _mm_sha1msg2_epu32(
+                _mm_xor_si128(_mm_sha1msg1_epu32(w[I & 3], w[(I + 1) & 3]),
+                              w[(I + 2) & 3]),
+                w[(I + 3) & 3]);
+        }
+        if constexpr (I == 0) {
+            e = _mm_add_epi32(e, w[0]);
+        } else {
+            e = _mm_sha1nexte_epu32(abcd_prev, w[I & 3]);
+        }
+        abcd_prev = abcd;
+        abcd      = _mm_sha1rnds4_epu32(abcd, e, I / 5);
+    }
+
+    template<int... I>
+    inline static void sha1_rounds(__m128i  w[4],
+                                   __m128i& abcd,
+                                   __m128i& e,
+                                   __m128i& abcd_prev,
+                                   std::integer_sequence<int, I...>)
+    {
+        (sha1_quad<I>(w, abcd, e, abcd_prev), ...);
+    }
+
+    alc_error_t ShaUpdate1(Uint32* pHash, const Uint8* pSrc, Uint64 src_len)
+    {
+        const __m128i shuf_mask =
+            _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+        __m128i w[4];
+        __m128i abcd, e, abcd_prev, abcd_save, e_save;
+
+        abcd = _mm_loadu_si128((const __m128i*)pHash);
+        abcd = _mm_shuffle_epi32(abcd, 0x1B);
+        e    = _mm_set_epi32(pHash[4], 0, 0, 0);
+
+        while (src_len >= 64) {
+            UNROLL_4 for (size_t i = 0; i < 4; i++)
+            {
+                w[i] = _mm_loadu_si128((const __m128i*)(pSrc + 16 * i));
+                w[i] = _mm_shuffle_epi8(w[i], shuf_mask);
+            }
+            abcd_save = abcd;
+            e_save    = e;
+            abcd_prev = abcd;
+
+            sha1_rounds(w, abcd, e, abcd_prev,
+                        std::make_integer_sequence<int, 20>{});
+
+            e    = _mm_sha1nexte_epu32(abcd_prev, e_save);
+            abcd = _mm_add_epi32(abcd, abcd_save);
+
+            pSrc += 64;
+            src_len -= 64;
+        }
+
+        abcd = _mm_shuffle_epi32(abcd, 0x1B);
+        _mm_storeu_si128((__m128i*)pHash, abcd);
+        pHash[4] = _mm_extract_epi32(e, 3);
+        return ALC_ERROR_NONE;
+    }
+
 }} // namespace alcp::digest::shani
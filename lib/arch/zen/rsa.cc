@@ -40,6 +40,14 @@ namespace alcp::rsa { namespace zen {
                                                    const Uint64* pTextBignum,
                                                    RsaPublicKeyBignum& pubKey,
                                                    MontContextBignum&  context);
+    template void archEncryptPublic<KEY_SIZE_3072>(Uint8*        pEncText,
+                                                   const Uint64* pTextBignum,
+                                                   RsaPublicKeyBignum& pubKey,
+                                                   MontContextBignum&  context);
+    template void archEncryptPublic<KEY_SIZE_4096>(Uint8*        pEncText,
+                                                   const Uint64* pTextBignum,
+                                                   RsaPublicKeyBignum& pubKey,
+                                                   MontContextBignum&  context);
 
     template void archDecryptPrivate<KEY_SIZE_1024>(
         Uint8*               pText,
@@ -55,6 +63,20 @@ namespace alcp::rsa { namespace zen {
         MontContextBignum&   contextP,
         MontContextBignum&   contextQ);
 
+    template void archDecryptPrivate<KEY_SIZE_3072>(
+        Uint8*               pText,
+        const Uint64*        pEncTextBigNum,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ);
+
+    template void archDecryptPrivate<KEY_SIZE_4096>(
+        Uint8*               pText,
+        const Uint64*        pEncTextBigNum,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ);
+
     template void archCreateContext<KEY_SIZE_1024>(MontContextBignum& context,
                                                    Uint64*            mod,
                                                    Uint64             size);
@@ -62,4 +84,56 @@ namespace alcp::rsa { namespace zen {
     template void archCreateContext<KEY_SIZE_2048>(MontContextBignum& context,
                                                    Uint64*            mod,
                                                    Uint64             size);
+
+    template void archCreateContext<KEY_SIZE_3072>(MontContextBignum& context,
+                                                   Uint64*            mod,
+                                                   Uint64             size);
+
+    template void archCreateContext<KEY_SIZE_4096>(MontContextBignum& context,
+                                                   Uint64*            mod,
+                                                   Uint64             size);
+
+    template bool archMillerRabin<KEY_SIZE_1024>(Uint64*            pCandidate,
+                                                 MontContextBignum& context,
+                                                 const Uint64*      pBases,
+                                                 Uint64             rounds);
+
+    template bool archMillerRabin<KEY_SIZE_2048>(Uint64*            pCandidate,
+                                                 MontContextBignum& context,
+                                                 const Uint64*      pBases,
+                                                 Uint64             rounds);
+
+    template bool archMillerRabin<KEY_SIZE_3072>(Uint64*            pCandidate,
+                                                 MontContextBignum& context,
+                                                 const Uint64*      pBases,
+                                                 Uint64             rounds);
+
+    template bool archMillerRabin<KEY_SIZE_4096>(Uint64*            pCandidate,
+                                                 MontContextBignum& context,
+                                                 const Uint64*      pBases,
+                                                 Uint64             rounds);
+
+    template void archModExpHalf<KEY_SIZE_1024>(Uint64*            pRes,
+                                                const Uint64*      pBase,
+                                                Uint64*            pExp,
+                                                Uint64*            pMod,
+                                                MontContextBignum& context);
+
+    template void archModExpHalf<KEY_SIZE_2048>(Uint64*            pRes,
+                                                const Uint64*      pBase,
+                                                Uint64*            pExp,
+                                                Uint64*            pMod,
+                                                MontContextBignum& context);
+
+    template void archModExpHalf<KEY_SIZE_3072>(Uint64*            pRes,
+                                                const Uint64*      pBase,
+                                                Uint64*            pExp,
+                                                Uint64*            pMod,
+                                                MontContextBignum& context);
+
+    template void archModExpHalf<KEY_SIZE_4096>(Uint64*            pRes,
+                                                const Uint64*      pBase,
+                                                Uint64*            pExp,
+                                                Uint64*            pMod,
+                                                MontContextBignum& context);
 }} // namespace alcp::rsa::zen
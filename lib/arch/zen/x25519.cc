@@ -28,6 +28,7 @@
 
 #include "alcp/ec.hh"
 #include "alcp/ec/ecdh.hh"
+#include "alcp/ec/weierstrass.hh"
 
 namespace alcp::ec { namespace zen {
 #include "../../ec/x25519.cc.inc"
@@ -158,4 +159,5 @@ namespace alcp::ec { namespace zen {
         utils::CopyQWord(resultz, b, 32);
     }
 
+#include "../../ec/ed25519.cc.inc"
 }} // namespace alcp::ec::zen
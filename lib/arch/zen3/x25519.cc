@@ -28,6 +28,7 @@
 
 #include "alcp/ec.hh"
 #include "alcp/ec/ecdh.hh"
+#include "alcp/ec/weierstrass.hh"
 #include <immintrin.h>
 
 namespace alcp::ec { namespace zen3 {
@@ -169,4 +170,5 @@ namespace alcp::ec { namespace zen3 {
         _mm256_storeu_si256(reinterpret_cast<__m256i*>(resultz), b);
     }
 
+#include "../../ec/ed25519.cc.inc"
 }} // namespace alcp::ec::zen3
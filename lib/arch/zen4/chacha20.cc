@@ -273,6 +273,110 @@ processParallelBlocks(const Uint8 key[],
     }
 }
 
+/*
+ * 16-way transposed ChaCha20: register i holds word i of sixteen consecutive
+ * blocks, 1024 bytes of keystream per iteration. The double round needs no
+ * lane shuffles, the transpose back to block order is only done on output.
+ */
+static inline void
+XorStoreTransposed(const __m512i x[16],
+                   const Uint8   plaintext[],
+                   Uint8         ciphertext[])
+{
+    // u[4 * g + k], lane L holds words 4g..4g+3 of block 4L + k
+    __m512i u[16];
+    for (int g = 0; g < 4; g++) {
+        __m512i t0 = _mm512_unpacklo_epi32(x[4 * g], x[4 * g + 1]);
+        __m512i t1 = _mm512_unpackhi_epi32(x[4 * g], x[4 * g + 1]);
+        __m512i t2 = _mm512_unpacklo_epi32(x[4 * g + 2], x[4 * g + 3]);
+        __m512i t3 = _mm512_unpackhi_epi32(x[4 * g + 2], x[4 * g + 3]);
+
+        u[4 * g]     = _mm512_unpacklo_epi64(t0, t2);
+        u[4 * g + 1] = _mm512_unpackhi_epi64(t0, t2);
+        u[4 * g + 2] = _mm512_unpacklo_epi64(t1, t3);
+        u[4 * g + 3] = _mm512_unpackhi_epi64(t1, t3);
+    }
+
+    for (int k = 0; k < 4; k++) {
+        // 4x4 transpose of 128 bit lanes
+        __m512i a = _mm512_shuffle_i32x4(u[k], u[4 + k], 0x44);
+        __m512i b = _mm512_shuffle_i32x4(u[k], u[4 + k], 0xee);
+        __m512i c = _mm512_shuffle_i32x4(u[8 + k], u[12 + k], 0x44);
+        __m512i d = _mm512_shuffle_i32x4(u[8 + k], u[12 + k], 0xee);
+
+        __m512i blk[4] = { _mm512_shuffle_i32x4(a, c, 0x88),
+                           _mm512_shuffle_i32x4(a, c, 0xdd),
+                           _mm512_shuffle_i32x4(b, d, 0x88),
+                           _mm512_shuffle_i32x4(b, d, 0xdd) };
+
+        for (int l = 0; l < 4; l++) {
+            Uint64  offset = (4 * l + k) * 64;
+            __m512i msg    = _mm512_loadu_si512(plaintext + offset);
+            _mm512_storeu_si512(ciphertext + offset,
+                                _mm512_xor_si512(msg, blk[l]));
+        }
+    }
+}
+
+static void
+processWideParallelBlocks(const Uint8 key[],
+                          const Uint8 iv[],
+                          const Uint8 plaintext[],
+                          Uint8       ciphertext[],
+                          Uint64      chacha20_wide_blocks)
+{
+    __m512i state[16];
+    for (int i = 0; i < 4; i++) {
+        state[i] = _mm512_set1_epi32(chacha20::Chacha20Constants[i]);
+    }
+    for (int i = 0; i < 8; i++) {
+        Uint32 word;
+        memcpy(&word, key + 4 * i, sizeof(word));
+        state[4 + i] = _mm512_set1_epi32(word);
+    }
+    for (int i = 0; i < 4; i++) {
+        Uint32 word;
+        memcpy(&word, iv + 4 * i, sizeof(word));
+        state[12 + i] = _mm512_set1_epi32(word);
+    }
+    // clang-format off
+    state[12] = _mm512_add_epi32(state[12],
+                                 _mm512_setr_epi32(0, 1, 2,  3,  4,  5,  6,  7,
+                                                   8, 9, 10, 11, 12, 13, 14, 15));
+    // clang-format on
+    const __m512i cInc = _mm512_set1_epi32(16);
+
+    for (Uint64 k = 0; k < chacha20_wide_blocks; k++) {
+        __m512i x[16];
+        for (int i = 0; i < 16; i++) {
+            x[i] = state[i];
+        }
+
+        for (int i = 0; i < 10; i++) {
+            // Column Round
+            RoundFunction(x[0], x[4], x[8], x[12]);
+            RoundFunction(x[1], x[5], x[9], x[13]);
+            RoundFunction(x[2], x[6], x[10], x[14]);
+            RoundFunction(x[3], x[7], x[11], x[15]);
+            // Diagonal Round
+            RoundFunction(x[0], x[5], x[10], x[15]);
+            RoundFunction(x[1], x[6], x[11], x[12]);
+            RoundFunction(x[2], x[7], x[8], x[13]);
+            RoundFunction(x[3], x[4], x[9], x[14]);
+        }
+
+        for (int i = 0; i < 16; i++) {
+            x[i] = _mm512_add_epi32(x[i], state[i]);
+        }
+
+        XorStoreTransposed(x, plaintext, ciphertext);
+
+        plaintext += 1024;
+        ciphertext += 1024;
+        state[12] = _mm512_add_epi32(state[12], cInc);
+    }
+}
+
 alc_error_t
 ProcessInput(const Uint8 key[],
              Uint64      keylen,
@@ -282,6 +386,24 @@ ProcessInput(const Uint8 key[],
              Uint64      plaintextLength,
              Uint8       ciphertext[])
 {
+    // Bulk goes through the 16-way kernel, the rest 4 blocks at a time
+    Uint8  iv_wide[16];
+    Uint64 chacha20_wide_blocks = plaintextLength / 1024;
+    if (chacha20_wide_blocks > 0) {
+        processWideParallelBlocks(
+            key, iv, plaintext, ciphertext, chacha20_wide_blocks);
+        plaintext += chacha20_wide_blocks * 1024;
+        ciphertext += chacha20_wide_blocks * 1024;
+        plaintextLength -= chacha20_wide_blocks * 1024;
+
+        Uint32 counter;
+        memcpy(iv_wide, iv, 16);
+        memcpy(&counter, iv_wide, sizeof(counter));
+        counter += 16 * chacha20_wide_blocks;
+        memcpy(iv_wide, &counter, sizeof(counter));
+        iv = iv_wide;
+    }
+
     Uint64 chacha20_parallel_blocks = plaintextLength / 256;
     Uint64 chacha20_non_parallel_bytes =
         plaintextLength - (chacha20_parallel_blocks * 256);
@@ -303,8 +425,10 @@ ProcessInput(const Uint8 key[],
         Uint8 iv_copy[16];
         memcpy(iv_copy, iv, 16);
         if (chacha20_parallel_blocks > 0) {
-            (*(reinterpret_cast<Uint32*>(iv_copy))) +=
-                4 * chacha20_parallel_blocks;
+            Uint32 counter;
+            memcpy(&counter, iv_copy, sizeof(counter));
+            counter += 4 * chacha20_parallel_blocks;
+            memcpy(iv_copy, &counter, sizeof(counter));
         }
         processParallelBlocks(key,
                               keylen,
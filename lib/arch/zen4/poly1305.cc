@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/mac/poly1305_arch.hh"
+
+#include <immintrin.h>
+
+namespace alcp::mac::poly1305::zen4 {
+
+// Number of 16 byte blocks absorbed in parallel
+static constexpr Uint64 cLanes = 8;
+
+/**
+ * @brief Loads 8 consecutive blocks, one block per 64 bit lane, as radix
+ * 2^26 limbs with the 2^128 pad bit set.
+ */
+static inline void
+LoadBlocks(const Uint8* pMsg, __m512i m[5])
+{
+    const __m512i mask26 = _mm512_set1_epi64(cMask26);
+    const __m512i hibit  = _mm512_set1_epi64(1 << 24);
+    const __m512i idx_lo = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m512i idx_hi = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+
+    __m512i a = _mm512_loadu_si512(pMsg);
+    __m512i b = _mm512_loadu_si512(pMsg + 64);
+
+    __m512i lo = _mm512_permutex2var_epi64(a, idx_lo, b);
+    __m512i hi = _mm512_permutex2var_epi64(a, idx_hi, b);
+
+    m[0] = _mm512_and_si512(lo, mask26);
+    m[1] = _mm512_and_si512(_mm512_srli_epi64(lo, 26), mask26);
+    m[2] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(lo, 52), _mm512_slli_epi64(hi, 12)),
+        mask26);
+    m[3] = _mm512_and_si512(_mm512_srli_epi64(hi, 14), mask26);
+    m[4] = _mm512_or_si512(_mm512_srli_epi64(hi, 40), hibit);
+}
+
+/**
+ * @brief h = h * r mod 2^130-5, lazily reduced, s[i] = 5 * r[i]
+ */
+static inline void
+MulReduce(__m512i h[5], const __m512i r[5], const __m512i s[5])
+{
+    const __m512i mask26 = _mm512_set1_epi64(cMask26);
+    __m512i       d[5], c;
+
+    // clang-format off
+    d[0] = _mm512_mul_epu32(h[0], r[0]);
+    d[0] = _mm512_add_epi64(d[0], _mm512_mul_epu32(h[1], s[4]));
+    d[0] = _mm512_add_epi64(d[0], _mm512_mul_epu32(h[2], s[3]));
+    d[0] = _mm512_add_epi64(d[0], _mm512_mul_epu32(h[3], s[2]));
+    d[0] = _mm512_add_epi64(d[0], _mm512_mul_epu32(h[4], s[1]));
+
+    d[1] = _mm512_mul_epu32(h[0], r[1]);
+    d[1] = _mm512_add_epi64(d[1], _mm512_mul_epu32(h[1], r[0]));
+    d[1] = _mm512_add_epi64(d[1], _mm512_mul_epu32(h[2], s[4]));
+    d[1] = _mm512_add_epi64(d[1], _mm512_mul_epu32(h[3], s[3]));
+    d[1] = _mm512_add_epi64(d[1], _mm512_mul_epu32(h[4], s[2]));
+
+    d[2] = _mm512_mul_epu32(h[0], r[2]);
+    d[2] = _mm512_add_epi64(d[2], _mm512_mul_epu32(h[1], r[1]));
+    d[2] = _mm512_add_epi64(d[2], _mm512_mul_epu32(h[2], r[0]));
+    d[2] = _mm512_add_epi64(d[2], _mm512_mul_epu32(h[3], s[4]));
+    d[2] = _mm512_add_epi64(d[2], _mm512_mul_epu32(h[4], s[3]));
+
+    d[3] = _mm512_mul_epu32(h[0], r[3]);
+    d[3] = _mm512_add_epi64(d[3], _mm512_mul_epu32(h[1], r[2]));
+    d[3] = _mm512_add_epi64(d[3], _mm512_mul_epu32(h[2], r[1]));
+    d[3] = _mm512_add_epi64(d[3], _mm512_mul_epu32(h[3], r[0]));
+    d[3] = _mm512_add_epi64(d[3], _mm512_mul_epu32(h[4], s[4]));
+
+    d[4] = _mm512_mul_epu32(h[0], r[4]);
+    d[4] = _mm512_add_epi64(d[4], _mm512_mul_epu32(h[1], r[3]));
+    d[4] = _mm512_add_epi64(d[4], _mm512_mul_epu32(h[2], r[2]));
+    d[4] = _mm512_add_epi64(d[4], _mm512_mul_epu32(h[3], r[1]));
+    d[4] = _mm512_add_epi64(d[4], _mm512_mul_epu32(h[4], r[0]));
+    // clang-format on
+
+    c    = _mm512_srli_epi64(d[0], 26);
+    h[0] = _mm512_and_si512(d[0], mask26);
+    d[1] = _mm512_add_epi64(d[1], c);
+    c    = _mm512_srli_epi64(d[1], 26);
+    h[1] = _mm512_and_si512(d[1], mask26);
+    d[2] = _mm512_add_epi64(d[2], c);
+    c    = _mm512_srli_epi64(d[2], 26);
+    h[2] = _mm512_and_si512(d[2], mask26);
+    d[3] = _mm512_add_epi64(d[3], c);
+    c    = _mm512_srli_epi64(d[3], 26);
+    h[3] = _mm512_and_si512(d[3], mask26);
+    d[4] = _mm512_add_epi64(d[4], c);
+    c    = _mm512_srli_epi64(d[4], 26);
+    h[4] = _mm512_and_si512(d[4], mask26);
+    // c * 5 = c + (c << 2)
+    h[0] = _mm512_add_epi64(
+        h[0], _mm512_add_epi64(c, _mm512_slli_epi64(c, 2)));
+    c    = _mm512_srli_epi64(h[0], 26);
+    h[0] = _mm512_and_si512(h[0], mask26);
+    h[1] = _mm512_add_epi64(h[1], c);
+}
+
+Uint64
+Poly1305Blocks(Poly1305State& state, const Uint8 pMsg[], Uint64 msgLen)
+{
+    constexpr Uint64 cStride = cLanes * 16;
+
+    Uint64 blocks = msgLen / cStride;
+    if (blocks == 0) {
+        return 0;
+    }
+
+    __m512i h[5], m[5], r[5], s[5];
+    Uint64  acc[5];
+
+    Radix44Carry(state.m_acc);
+    Radix44ToRadix26(state.m_acc, acc);
+
+    // r^8 in every lane
+    for (int i = 0; i < 5; i++) {
+        r[i] = _mm512_set1_epi64(state.m_r_pow26[cLanes - 1][i]);
+        s[i] = _mm512_set1_epi64(state.m_r_pow26[cLanes - 1][i] * 5);
+    }
+
+    // Lane j starts with block j, the accumulator is folded into lane 0
+    LoadBlocks(pMsg, h);
+    for (int i = 0; i < 5; i++) {
+        h[i] = _mm512_mask_add_epi64(
+            h[i], 0x01, h[i], _mm512_set1_epi64(acc[i]));
+    }
+    pMsg += cStride;
+
+    for (Uint64 k = 1; k < blocks; k++) {
+        MulReduce(h, r, s);
+        LoadBlocks(pMsg, m);
+        for (int i = 0; i < 5; i++) {
+            h[i] = _mm512_add_epi64(h[i], m[i]);
+        }
+        pMsg += cStride;
+    }
+
+    // Lane j is multiplied by r^(8-j), then all lanes are summed
+    const auto& pw = state.m_r_pow26;
+    for (int i = 0; i < 5; i++) {
+        r[i] = _mm512_setr_epi64(pw[7][i],
+                                 pw[6][i],
+                                 pw[5][i],
+                                 pw[4][i],
+                                 pw[3][i],
+                                 pw[2][i],
+                                 pw[1][i],
+                                 pw[0][i]);
+        s[i] = _mm512_add_epi64(r[i], _mm512_slli_epi64(r[i], 2));
+    }
+    MulReduce(h, r, s);
+
+    for (int i = 0; i < 5; i++) {
+        acc[i] = _mm512_reduce_add_epi64(h[i]);
+    }
+    Radix26ToRadix44(acc, state.m_acc);
+
+    return blocks * cStride;
+}
+
+} // namespace alcp::mac::poly1305::zen4
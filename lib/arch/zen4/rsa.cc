@@ -28,6 +28,8 @@
 #include "alcp/rsa.h"
 #include "alcp/rsa/rsa_internal.hh"
 #include "alcp/utils/copy.hh"
+#include "config.h"
+#include <algorithm>
 #include <immintrin.h>
 
 /*
@@ -1593,6 +1595,911 @@ namespace alcp::rsa { namespace zen4 {
         }
     }
 
+    /*
+     * Radix 52 kernels for the 3072 and 4096 bit keys and their 1536 and 2048
+     * bit CRT halves. A number is held in Regs zmm registers of 8 digits each
+     * and is zero padded above its top digit, so the Montgomery radix is
+     * 2^(52 * 8 * Regs).
+     */
+    template<Uint64 Regs>
+    static inline void LoadRegRadix52(__m512i out[Regs], const Uint64* inp)
+    {
+        for (Uint64 i = 0; i < Regs; i++) {
+            out[i] = _mm512_loadu_si512(inp + i * 8);
+        }
+    }
+
+    template<Uint64 Regs>
+    static inline void StoreRegRadix52(Uint64* out, const __m512i inp[Regs])
+    {
+        for (Uint64 i = 0; i < Regs; i++) {
+            _mm512_storeu_si512(out + i * 8, inp[i]);
+        }
+    }
+
+    template<Uint64 Regs>
+    static inline void FusedMultiplyAddLowRadix52(__m512i       res[Regs],
+                                                  const __m512i mod[Regs],
+                                                  const __m512i y)
+    {
+        for (Uint64 i = 0; i < Regs; i++) {
+            res[i] = _mm512_madd52lo_epu64(res[i], mod[i], y);
+        }
+    }
+
+    template<Uint64 Regs>
+    static inline void FusedMultiplyAddHighRadix52(__m512i       res[Regs],
+                                                   const __m512i mod[Regs],
+                                                   const __m512i y)
+    {
+        for (Uint64 i = 0; i < Regs; i++) {
+            res[i] = _mm512_madd52hi_epu64(res[i], mod[i], y);
+        }
+    }
+
+    template<Uint64 Regs>
+    static inline void ShiftAndAddCarryRadix52(__m512i res[Regs])
+    {
+        const __m512i zero{};
+        __m512i       carry = _mm512_maskz_srli_epi64(1, res[0], 52);
+        for (Uint64 i = 0; i < Regs - 1; i++) {
+            res[i] = _mm512_alignr_epi64(res[i + 1], res[i], 1);
+        }
+        res[Regs - 1] = _mm512_alignr_epi64(zero, res[Regs - 1], 1);
+        res[0]        = _mm512_add_epi64(res[0], carry);
+    }
+
+    // convert from redundant radix 2^52 to radix 2^52
+    static inline void NormalizeRadix52(Uint64* res, Uint64 digits)
+    {
+        Uint64 carry = 0;
+        for (Uint64 i = 0; i < digits; i++) {
+            Uint64 sum = res[i] + carry;
+            carry      = sum >> 52;
+            res[i]     = sum & 0xfffffffffffff;
+        }
+    }
+
+    // Converts a radix 64 number of the given bit length to radix 52
+    static inline void Radix64BitToRadix52Bit(Uint64*       out,
+                                              const Uint64* in,
+                                              Uint64        bits,
+                                              Uint64        digits)
+    {
+        const Uint64 words = bits / 64;
+        for (Uint64 i = 0; i < digits; i++) {
+            Uint64 word  = (i * 52) / 64;
+            Uint64 shift = (i * 52) % 64;
+            Uint64 val   = 0;
+            if (word < words) {
+                val = in[word] >> shift;
+                if (shift > 12 && word + 1 < words) {
+                    val |= in[word + 1] << (64 - shift);
+                }
+            }
+            out[i] = GetRadix52Bit(val);
+        }
+    }
+
+    // Converts back a normalized radix 52 number to radix 64
+    static inline void Radix52BitToRadix64Bit(Uint64*       out,
+                                              const Uint64* in,
+                                              Uint64        bits)
+    {
+        const Uint64 words  = bits / 64;
+        const Uint64 digits = (bits + 51) / 52;
+        alcp::utils::PadBlock<Uint64>(out, 0LL, words * 8);
+        for (Uint64 i = 0; i < digits; i++) {
+            Uint64 word  = (i * 52) / 64;
+            Uint64 shift = (i * 52) % 64;
+            out[word] |= in[i] << shift;
+            if (shift > 12 && word + 1 < words) {
+                out[word + 1] |= in[i] >> (64 - shift);
+            }
+        }
+    }
+
+    template<Uint64 Regs>
+    static inline void AmmRadix52(Uint64*       res,
+                                  const Uint64* first,
+                                  const Uint64* second,
+                                  const __m512i mod_reg[Regs],
+                                  const __m512i k_reg)
+    {
+        __m512i first_reg[Regs];
+
+        __m512i res_reg[Regs]{};
+
+        LoadRegRadix52<Regs>(first_reg, first);
+
+        const __m512i zero{};
+        for (Uint64 j = 0; j < Regs * 8; j++) {
+            __m512i second_reg = _mm512_set1_epi64(second[j]);
+
+            FusedMultiplyAddLowRadix52<Regs>(res_reg, first_reg, second_reg);
+
+            __m512i y_reg = _mm512_madd52lo_epu64(zero, k_reg, res_reg[0]);
+            y_reg         = _mm512_permutexvar_epi64(zero, y_reg);
+
+            FusedMultiplyAddLowRadix52<Regs>(res_reg, mod_reg, y_reg);
+
+            ShiftAndAddCarryRadix52<Regs>(res_reg);
+
+            FusedMultiplyAddHighRadix52<Regs>(res_reg, first_reg, second_reg);
+
+            FusedMultiplyAddHighRadix52<Regs>(res_reg, mod_reg, y_reg);
+        }
+
+        StoreRegRadix52<Regs>(res, res_reg);
+
+        NormalizeRadix52(res, Regs * 8);
+    }
+
+    template<Uint64 Regs>
+    static inline void AmsRadix52(Uint64*       res,
+                                  const Uint64* first,
+                                  const __m512i mod_reg[Regs],
+                                  const __m512i k_reg)
+    {
+        AmmRadix52<Regs>(res, first, first, mod_reg, k_reg);
+    }
+
+    // Montgomery reduction, takes a number out of the Montgomery domain
+    template<Uint64 Regs>
+    static inline void AmmReduceRadix52(Uint64*       res,
+                                        const Uint64* first,
+                                        const __m512i mod_reg[Regs],
+                                        const __m512i k_reg)
+    {
+        __m512i res_reg[Regs];
+
+        LoadRegRadix52<Regs>(res_reg, first);
+
+        const __m512i zero{};
+
+        for (Uint64 i = 0; i < Regs * 8; i++) {
+
+            __m512i y_reg = _mm512_madd52lo_epu64(zero, k_reg, res_reg[0]);
+            y_reg         = _mm512_permutexvar_epi64(zero, y_reg);
+
+            FusedMultiplyAddLowRadix52<Regs>(res_reg, mod_reg, y_reg);
+
+            ShiftAndAddCarryRadix52<Regs>(res_reg);
+
+            FusedMultiplyAddHighRadix52<Regs>(res_reg, mod_reg, y_reg);
+        }
+        StoreRegRadix52<Regs>(res, res_reg);
+
+        NormalizeRadix52(res, Regs * 8);
+    }
+
+    // Reads entry index of a 16 entry table touching every entry, so the
+    // memory access pattern does not depend on the secret index
+    template<Uint64 Regs>
+    static inline void SelectFromTableRadix52(Uint64*       out,
+                                              const Uint64* t,
+                                              Uint64        index)
+    {
+        const __m512i index_reg = _mm512_set1_epi64(index);
+
+        __m512i out_reg[Regs]{};
+        for (Uint64 e = 0; e < 16; e++) {
+            __mmask8 mask =
+                _mm512_cmpeq_epi64_mask(_mm512_set1_epi64(e), index_reg);
+            for (Uint64 i = 0; i < Regs; i++) {
+                __m512i entry =
+                    _mm512_loadu_si512(t + (e * Regs + i) * 8);
+                out_reg[i] = _mm512_mask_mov_epi64(out_reg[i], mask, entry);
+            }
+        }
+        StoreRegRadix52<Regs>(out, out_reg);
+    }
+
+    // Sets up the radix 52 modulus and 2^(2 * 52 * k) mod M for k digits
+    template<Uint64 Regs>
+    static inline void CreateContextRadix52(MontContextBignum& context,
+                                            const Uint64*      mod,
+                                            Uint64             bits)
+    {
+        constexpr Uint64 Digits = Regs * 8;
+
+        Uint64* r2_radix_52_bit  = new Uint64[Digits]{};
+        Uint64* mod_radix_52_bit = new Uint64[Digits]{};
+
+        context.m_r2_radix_52_bit.reset(r2_radix_52_bit);
+        context.m_mod_radix_52_bit.reset(mod_radix_52_bit);
+
+        Radix64BitToRadix52Bit(mod_radix_52_bit, mod, bits, Digits);
+        Radix64BitToRadix52Bit(
+            r2_radix_52_bit, context.m_r2.get(), bits, Digits);
+
+        __m512i mod_reg[Regs];
+        LoadRegRadix52<Regs>(mod_reg, mod_radix_52_bit);
+
+        __m512i k_reg = _mm512_set1_epi64(context.m_k0);
+
+        //(congruent to 2^(4n-k×m) mod M)
+        AmmRadix52<Regs>(
+            r2_radix_52_bit, r2_radix_52_bit, r2_radix_52_bit, mod_reg, k_reg);
+
+        // 2^(4km - 4n) in radix 52
+        alignas(64) Uint64 mult[Digits] = {};
+        Uint64             shift        = 4 * (52 * Digits - bits);
+        mult[shift / 52]                = 1ULL << (shift % 52);
+
+        //(congruent to 2^2k×m mod M)
+        AmmRadix52<Regs>(
+            r2_radix_52_bit, r2_radix_52_bit, mult, mod_reg, k_reg);
+    }
+
+    template<Uint64 Regs>
+    static inline void MontgomeryExpRadix52(Uint64*       res,
+                                            const Uint64* input,
+                                            Uint64*       exp,
+                                            Uint64        expSize,
+                                            Uint64*       modRadix52Bit,
+                                            Uint64*       r2Radix52Bit,
+                                            Uint64        k0,
+                                            Uint64        bits)
+    {
+        constexpr Uint64 Digits = Regs * 8;
+
+        alignas(64) Uint64 input_radix_52_bit[Digits];
+        alignas(64) Uint64 res_radix_52_bit[Digits];
+        Radix64BitToRadix52Bit(input_radix_52_bit, input, bits, Digits);
+
+        __m512i mod_reg[Regs];
+        LoadRegRadix52<Regs>(mod_reg, modRadix52Bit);
+
+        __m512i k_reg = _mm512_set1_epi64(k0);
+
+        // conversion to mont domain by
+        // multiplying with mont converter
+        AmmRadix52<Regs>(input_radix_52_bit,
+                         input_radix_52_bit,
+                         r2Radix52Bit,
+                         mod_reg,
+                         k_reg);
+
+        Uint64 val = exp[expSize - 1];
+
+        Uint64 num_leading_zero = _lzcnt_u64(val);
+
+        Uint64 index = num_leading_zero + 1;
+
+        val = val << index;
+
+        alcp::utils::CopyChunk(
+            res_radix_52_bit, input_radix_52_bit, Digits * 8);
+
+        while (index++ < 64) {
+            AmsRadix52<Regs>(
+                res_radix_52_bit, res_radix_52_bit, mod_reg, k_reg);
+            if (val & mont::one_msb) {
+                AmmRadix52<Regs>(res_radix_52_bit,
+                                 res_radix_52_bit,
+                                 input_radix_52_bit,
+                                 mod_reg,
+                                 k_reg);
+            }
+            val <<= 1;
+        }
+
+        for (Int64 i = expSize - 2; i >= 0; i--) {
+            val = exp[i];
+            for (Uint64 j = 0; j < 64; j++) {
+                AmsRadix52<Regs>(
+                    res_radix_52_bit, res_radix_52_bit, mod_reg, k_reg);
+                if (val & mont::one_msb) {
+                    AmmRadix52<Regs>(res_radix_52_bit,
+                                     res_radix_52_bit,
+                                     input_radix_52_bit,
+                                     mod_reg,
+                                     k_reg);
+                }
+                val <<= 1;
+            }
+        }
+
+        AmmReduceRadix52<Regs>(
+            input_radix_52_bit, res_radix_52_bit, mod_reg, k_reg);
+
+        Radix52BitToRadix64Bit(res, input_radix_52_bit, bits);
+    }
+
+    // Brings a normalised radix 52 number below 2 * M under M. The branches
+    // are fine as this only runs on public data
+    static inline void ReduceOnceRadix52(Uint64*       res,
+                                         const Uint64* mod,
+                                         Uint64        digits)
+    {
+        Int64 i = digits - 1;
+        while (i > 0 && res[i] == mod[i]) {
+            i--;
+        }
+        if (res[i] < mod[i]) {
+            return;
+        }
+
+        Uint64 borrow = 0;
+        for (Uint64 j = 0; j < digits; j++) {
+            Uint64 diff = res[j] - mod[j] - borrow;
+            borrow      = diff >> 63;
+            res[j]      = diff & 0xfffffffffffff;
+        }
+    }
+
+    // res = input ^ (2^squarings + 1) mod M, the last multiply is by the
+    // plain input, so it also leaves the Montgomery domain
+    template<Uint64 Regs>
+    static inline void MontgomeryExpShortRadix52(Uint64*       res,
+                                                 const Uint64* input,
+                                                 Uint64        squarings,
+                                                 Uint64*       modRadix52Bit,
+                                                 Uint64*       r2Radix52Bit,
+                                                 Uint64        k0,
+                                                 Uint64        bits)
+    {
+        constexpr Uint64 Digits = Regs * 8;
+
+        alignas(64) Uint64 input_radix_52_bit[Digits];
+        alignas(64) Uint64 res_radix_52_bit[Digits];
+        Radix64BitToRadix52Bit(input_radix_52_bit, input, bits, Digits);
+
+        __m512i mod_reg[Regs];
+        LoadRegRadix52<Regs>(mod_reg, modRadix52Bit);
+
+        __m512i k_reg = _mm512_set1_epi64(k0);
+
+        AmmRadix52<Regs>(res_radix_52_bit,
+                         input_radix_52_bit,
+                         r2Radix52Bit,
+                         mod_reg,
+                         k_reg);
+
+        for (Uint64 i = 0; i < squarings; i++) {
+            AmsRadix52<Regs>(
+                res_radix_52_bit, res_radix_52_bit, mod_reg, k_reg);
+        }
+
+        AmmRadix52<Regs>(res_radix_52_bit,
+                         res_radix_52_bit,
+                         input_radix_52_bit,
+                         mod_reg,
+                         k_reg);
+
+        ReduceOnceRadix52(res_radix_52_bit, modRadix52Bit, Digits);
+
+        Radix52BitToRadix64Bit(res, res_radix_52_bit, bits);
+    }
+
+    // Fixed window (4 bit) exponentiation for the CRT halves, the exponent
+    // has the same number of bits as the modulus
+    template<Uint64 Regs>
+    static inline void MontgomeryExpConstantTimeRadix52(
+        Uint64*       res,
+        const Uint64* input,
+        const Uint64* exp,
+        const Uint64* modRadix52Bit,
+        const Uint64* r2Radix52Bit,
+        Uint64        k0,
+        Uint64        bits)
+    {
+        constexpr Uint64 Digits = Regs * 8;
+
+        alignas(64) Uint64 t[16 * Digits];
+        alignas(64) Uint64 input_radix_52_bit[Digits];
+        alignas(64) Uint64 res_radix_52_bit[Digits];
+        alignas(64) Uint64 mult_radix_52_bit[Digits];
+
+        __m512i mod_reg[Regs];
+        LoadRegRadix52<Regs>(mod_reg, modRadix52Bit);
+
+        __m512i k_reg = _mm512_set1_epi64(k0);
+
+        // putting one and the input in mont form
+        AmmReduceRadix52<Regs>(t, r2Radix52Bit, mod_reg, k_reg);
+
+        Radix64BitToRadix52Bit(input_radix_52_bit, input, bits, Digits);
+        AmmRadix52<Regs>(
+            t + Digits, input_radix_52_bit, r2Radix52Bit, mod_reg, k_reg);
+
+        for (Uint64 i = 2; i < 16; i++) {
+            AmmRadix52<Regs>(t + i * Digits,
+                             t + (i - 1) * Digits,
+                             t + Digits,
+                             mod_reg,
+                             k_reg);
+        }
+
+        Uint64 windows = bits / 4;
+        auto   nibble  = [exp](Uint64 w) {
+            return (exp[w / 16] >> ((w % 16) * 4)) & 0xf;
+        };
+
+        SelectFromTableRadix52<Regs>(res_radix_52_bit, t, nibble(windows - 1));
+
+        for (Int64 w = windows - 2; w >= 0; w--) {
+            for (Uint64 i = 0; i < 4; i++) {
+                AmsRadix52<Regs>(
+                    res_radix_52_bit, res_radix_52_bit, mod_reg, k_reg);
+            }
+            SelectFromTableRadix52<Regs>(mult_radix_52_bit, t, nibble(w));
+            AmmRadix52<Regs>(res_radix_52_bit,
+                             res_radix_52_bit,
+                             mult_radix_52_bit,
+                             mod_reg,
+                             k_reg);
+        }
+
+        // convert from mont domain to residue domain
+        AmmReduceRadix52<Regs>(
+            res_radix_52_bit, res_radix_52_bit, mod_reg, k_reg);
+
+        Radix52BitToRadix64Bit(res, res_radix_52_bit, bits);
+    }
+
+    // ap = inp * r mod p and aq = inp * r mod q, the CRT exponent bases
+    template<alc_rsa_key_size T>
+    static inline void ReduceCRTBases(Uint64*              ap,
+                                      Uint64*              aq,
+                                      const Uint64*        inp,
+                                      RsaPrivateKeyBignum& privKey,
+                                      MontContextBignum&   contextP,
+                                      MontContextBignum&   contextQ)
+    {
+        using Mont = mont::MontCompute<T>;
+
+        alignas(64) Uint64 buff_p[T / 64];
+
+        auto p_mod = privKey.m_p.get();
+        auto q_mod = privKey.m_q.get();
+        auto p_k0  = contextP.m_k0;
+        auto q_k0  = contextQ.m_k0;
+
+        // P reduction - ap
+        alcp::utils::CopyChunk(buff_p, inp, T / 8);
+        Mont::MontReduceHalf(ap, buff_p, p_mod, p_k0);
+        Mont::MontMultHalf(ap, ap, contextP.m_r2.get(), p_mod, p_k0);
+
+        // Q reduction - aq
+        alcp::utils::CopyChunk(buff_p, inp, T / 8);
+        Mont::MontReduceHalf(aq, buff_p, q_mod, q_k0);
+        Mont::MontMultHalf(aq, aq, contextQ.m_r2.get(), q_mod, q_k0);
+    }
+
+    // res = aq + ((ap - aq) * qInv mod p) * q, clobbers ap
+    template<alc_rsa_key_size T>
+    static inline void CombineCRT(Uint64*              res,
+                                  Uint64*              ap,
+                                  Uint64*              aq,
+                                  RsaPrivateKeyBignum& privKey,
+                                  MontContextBignum&   contextP)
+    {
+        using Mont = mont::MontCompute<T>;
+
+        auto size = contextP.m_size;
+
+        alignas(64) Uint64 buff_p[T / 64];
+
+        auto p_mod = privKey.m_p.get();
+        auto q_mod = privKey.m_q.get();
+        auto r2_p  = contextP.m_r2.get();
+        auto qinv  = privKey.m_qinv.get();
+        auto p_k0  = contextP.m_k0;
+
+        // convert aq to aq mod p
+        Mont::MontSub(buff_p, aq, p_mod, p_mod, size);
+
+        // ap = (ap - aq) mod p
+        Mont::MontSub(ap, ap, buff_p, p_mod, size);
+
+        // convert qInv to qInv * r mod P
+        Mont::MontMultHalf(res, qinv, r2_p, p_mod, p_k0);
+
+        // qInv * r * ap * r^-1 mod P -> qInv * ap mod P
+        Mont::MontMultHalf(ap, ap, res, p_mod, p_k0);
+
+        alcp::utils::PadBlock<Uint64>(buff_p, 0LL, size * 8 * 2);
+
+        // h * Q
+        Mont::mul(buff_p, ap, size, q_mod, size);
+
+        // res = aq + h*Q
+        Mont::AddBigNum(res, size * 2, buff_p, aq, size);
+    }
+
+    template<alc_rsa_key_size T, Uint64 Regs>
+    static inline void DecryptUsingCRTRadix52(Uint64*              res,
+                                              const Uint64*        inp,
+                                              RsaPrivateKeyBignum& privKey,
+                                              MontContextBignum&   contextP,
+                                              MontContextBignum&   contextQ)
+    {
+        alignas(64) Uint64 buff_0_p[T / 128];
+        alignas(64) Uint64 buff_1_p[T / 128];
+
+        ReduceCRTBases<T>(buff_0_p, buff_1_p, inp, privKey, contextP, contextQ);
+
+        // ap = ap ^ dp mod p
+        MontgomeryExpConstantTimeRadix52<Regs>(
+            buff_0_p,
+            buff_0_p,
+            privKey.m_dp.get(),
+            contextP.m_mod_radix_52_bit.get(),
+            contextP.m_r2_radix_52_bit.get(),
+            contextP.m_k0,
+            T / 2);
+
+        // aq = aq ^ dq mod q
+        MontgomeryExpConstantTimeRadix52<Regs>(
+            buff_1_p,
+            buff_1_p,
+            privKey.m_dq.get(),
+            contextQ.m_mod_radix_52_bit.get(),
+            contextQ.m_r2_radix_52_bit.get(),
+            contextQ.m_k0,
+            T / 2);
+
+        CombineCRT<T>(res, buff_0_p, buff_1_p, privKey, contextP);
+    }
+
+    /*
+     * Lane parallel kernels for batches of private key operations. Digit
+     * vector i holds digit i of up to 8 independent operands, one per lane,
+     * so every IFMA instruction advances all the operations of the batch.
+     * Private key batches share the key and broadcast the modulus digits,
+     * public key batches load a modulus per lane.
+     */
+    template<Uint64 Digits>
+    static inline void AmmBatch(__m512i*       res,
+                                const __m512i* first,
+                                const __m512i* second,
+                                const __m512i* mod,
+                                const __m512i  k_reg)
+    {
+        const __m512i zero{};
+        const __m512i mask = _mm512_set1_epi64(0xfffffffffffff);
+
+        // fully unrolled so the accumulators stay in registers
+        __m512i acc[Digits];
+        UNROLL_64
+        for (Uint64 i = 0; i < Digits; i++) {
+            acc[i] = zero;
+        }
+
+        for (Uint64 j = 0; j < Digits; j++) {
+            const __m512i b = second[j];
+
+            __m512i a0 = _mm512_madd52lo_epu64(acc[0], first[0], b);
+            __m512i y  = _mm512_madd52lo_epu64(zero, k_reg, a0);
+            a0         = _mm512_madd52lo_epu64(a0, mod[0], y);
+
+            /*
+             * Low and high halves are folded into one pass that also shifts
+             * out the zero digit, so each accumulator is read and written
+             * once per digit of second; this keeps the large key sizes,
+             * whose accumulators no longer fit in registers, from being
+             * bound on loads and stores
+             */
+            __m512i carry = _mm512_srli_epi64(a0, 52);
+            UNROLL_64
+            for (Uint64 i = 0; i < Digits - 1; i++) {
+                __m512i t = _mm512_madd52lo_epu64(acc[i + 1], first[i + 1], b);
+                t         = _mm512_madd52lo_epu64(t, mod[i + 1], y);
+                t         = _mm512_madd52hi_epu64(t, first[i], b);
+                acc[i]    = _mm512_madd52hi_epu64(t, mod[i], y);
+            }
+            acc[Digits - 1] = _mm512_madd52hi_epu64(zero, first[Digits - 1], b);
+            acc[Digits - 1] =
+                _mm512_madd52hi_epu64(acc[Digits - 1], mod[Digits - 1], y);
+            acc[0] = _mm512_add_epi64(acc[0], carry);
+        }
+
+        // convert from redundant radix 2^52 to radix 2^52
+        __m512i carry = zero;
+        UNROLL_64
+        for (Uint64 i = 0; i < Digits; i++) {
+            __m512i sum = _mm512_add_epi64(acc[i], carry);
+            carry       = _mm512_srli_epi64(sum, 52);
+            res[i]      = _mm512_and_si512(sum, mask);
+        }
+    }
+
+    // index is the same in every lane, the whole table is still read
+    template<Uint64 Digits>
+    static inline void SelectFromTableBatch(__m512i*       out,
+                                            const __m512i* t,
+                                            Uint64         index)
+    {
+        const __m512i index_reg = _mm512_set1_epi64(index);
+
+        for (Uint64 i = 0; i < Digits; i++) {
+            out[i] = _mm512_setzero_si512();
+        }
+        for (Uint64 e = 0; e < 16; e++) {
+            __mmask8 mask =
+                _mm512_cmpeq_epi64_mask(_mm512_set1_epi64(e), index_reg);
+            for (Uint64 i = 0; i < Digits; i++) {
+                out[i] = _mm512_mask_mov_epi64(out[i], mask, t[e * Digits + i]);
+            }
+        }
+    }
+
+    // Turns 2^(2n) mod M into 2^(2 * 52 * Digits) mod M in every lane
+    template<Uint64 Digits>
+    static inline void AdjustBatchR2(__m512i*       r2_reg,
+                                     const __m512i* mod_reg,
+                                     const __m512i  k_reg,
+                                     Uint64         bits)
+    {
+        __m512i mult[Digits];
+        for (Uint64 i = 0; i < Digits; i++) {
+            mult[i] = _mm512_setzero_si512();
+        }
+
+        //(congruent to 2^(4n-52d) mod M)
+        AmmBatch<Digits>(r2_reg, r2_reg, r2_reg, mod_reg, k_reg);
+
+        Uint64 shift     = 4 * (52 * Digits - bits);
+        mult[shift / 52] = _mm512_set1_epi64(1ULL << (shift % 52));
+
+        //(congruent to 2^(2 * 52d) mod M)
+        AmmBatch<Digits>(r2_reg, r2_reg, mult, mod_reg, k_reg);
+    }
+
+    // Broadcast modulus and 2^(2 * 52 * Digits) mod M
+    template<Uint64 Digits>
+    static inline void CreateBatchConstants(__m512i*                 mod_reg,
+                                            __m512i*                 r2_reg,
+                                            const Uint64*            mod,
+                                            const MontContextBignum& context,
+                                            Uint64                   bits)
+    {
+        alignas(64) Uint64 mod_radix_52_bit[Digits];
+        alignas(64) Uint64 r2_radix_52_bit[Digits];
+
+        Radix64BitToRadix52Bit(mod_radix_52_bit, mod, bits, Digits);
+        Radix64BitToRadix52Bit(
+            r2_radix_52_bit, context.m_r2.get(), bits, Digits);
+
+        for (Uint64 i = 0; i < Digits; i++) {
+            mod_reg[i] = _mm512_set1_epi64(mod_radix_52_bit[i]);
+            r2_reg[i]  = _mm512_set1_epi64(r2_radix_52_bit[i]);
+        }
+
+        __m512i k_reg = _mm512_set1_epi64(context.m_k0);
+
+        AdjustBatchR2<Digits>(r2_reg, mod_reg, k_reg, bits);
+    }
+
+    // Transposes the radix 64 operands into lane per operand digit vectors
+    template<Uint64 Digits>
+    static inline void LoadBatch(__m512i*            out,
+                                 const Uint64* const in[],
+                                 Uint64              num,
+                                 Uint64              bits)
+    {
+        alignas(64) Uint64 lanes[Digits * RsaBatchSize]{};
+        alignas(64) Uint64 digits[Digits];
+
+        for (Uint64 l = 0; l < num; l++) {
+            Radix64BitToRadix52Bit(digits, in[l], bits, Digits);
+            for (Uint64 i = 0; i < Digits; i++) {
+                lanes[i * RsaBatchSize + l] = digits[i];
+            }
+        }
+        for (Uint64 i = 0; i < Digits; i++) {
+            out[i] = _mm512_load_si512(lanes + i * RsaBatchSize);
+        }
+    }
+
+    template<Uint64 Digits>
+    static inline void StoreBatch(Uint64* const  out[],
+                                  const __m512i* in,
+                                  Uint64         num,
+                                  Uint64         bits)
+    {
+        alignas(64) Uint64 lanes[Digits * RsaBatchSize];
+        alignas(64) Uint64 digits[Digits];
+
+        for (Uint64 i = 0; i < Digits; i++) {
+            _mm512_store_si512(lanes + i * RsaBatchSize, in[i]);
+        }
+        for (Uint64 l = 0; l < num; l++) {
+            for (Uint64 i = 0; i < Digits; i++) {
+                digits[i] = lanes[i * RsaBatchSize + l];
+            }
+            Radix52BitToRadix64Bit(out[l], digits, bits);
+        }
+    }
+
+    // res = base ^ exp mod M in every lane, fixed 4 bit window
+    template<Uint64 Digits>
+    static inline void MontgomeryExpConstantTimeBatch(__m512i*       res,
+                                                      const __m512i* base,
+                                                      const Uint64*  exp,
+                                                      Uint64         bits,
+                                                      const __m512i* mod_reg,
+                                                      const __m512i* r2_reg,
+                                                      const __m512i  k_reg)
+    {
+        auto    table = std::make_unique<__m512i[]>(16 * Digits);
+        auto    t     = table.get();
+        __m512i one[Digits];
+        __m512i mult[Digits];
+        for (Uint64 i = 0; i < Digits; i++) {
+            one[i] = _mm512_setzero_si512();
+        }
+        one[0] = _mm512_set1_epi64(1);
+
+        // putting one and the base in mont form
+        AmmBatch<Digits>(t, r2_reg, one, mod_reg, k_reg);
+        AmmBatch<Digits>(t + Digits, base, r2_reg, mod_reg, k_reg);
+        for (Uint64 e = 2; e < 16; e++) {
+            AmmBatch<Digits>(t + e * Digits,
+                             t + (e - 1) * Digits,
+                             t + Digits,
+                             mod_reg,
+                             k_reg);
+        }
+
+        Uint64 windows = bits / 4;
+        auto   nibble  = [exp](Uint64 w) {
+            return (exp[w / 16] >> ((w % 16) * 4)) & 0xf;
+        };
+
+        SelectFromTableBatch<Digits>(res, t, nibble(windows - 1));
+
+        for (Int64 w = windows - 2; w >= 0; w--) {
+            for (Uint64 i = 0; i < 4; i++) {
+                AmmBatch<Digits>(res, res, res, mod_reg, k_reg);
+            }
+            SelectFromTableBatch<Digits>(mult, t, nibble(w));
+            AmmBatch<Digits>(res, res, mult, mod_reg, k_reg);
+        }
+
+        // convert from mont domain to residue domain
+        AmmBatch<Digits>(res, res, one, mod_reg, k_reg);
+
+        alcp::utils::PadBlock<Uint64>(t, 0LL, 16 * Digits * sizeof(__m512i));
+    }
+
+    /*
+     * Public key operations of a batch, every lane carries its own modulus,
+     * k0 and exponent so the keys may differ. The exponent is public, lanes
+     * whose bit is clear keep their value through a masked move.
+     */
+    template<alc_rsa_key_size T>
+    static inline void EncryptPublicBatch(Uint64* const             res[],
+                                          const Uint64* const       inp[],
+                                          Uint64                    num,
+                                          RsaPublicKeyBignum* const pubKey[],
+                                          MontContextBignum* const  context[])
+    {
+        // smallest digit count with R > 4 * M
+        constexpr Uint64 Digits = (T + 51) / 52;
+
+        const Uint64*      mod[RsaBatchSize];
+        const Uint64*      r2[RsaBatchSize];
+        alignas(64) Uint64 k0[RsaBatchSize]{};
+        alignas(64) Uint64 exp[RsaBatchSize]{};
+        Uint64             exp_bits = 1;
+
+        for (Uint64 l = 0; l < num; l++) {
+            mod[l]   = pubKey[l]->m_mod.get();
+            r2[l]    = context[l]->m_r2.get();
+            k0[l]    = context[l]->m_k0;
+            exp[l]   = pubKey[l]->m_public_exponent;
+            exp_bits = std::max<Uint64>(exp_bits, 64 - _lzcnt_u64(exp[l]));
+        }
+
+        __m512i mod_reg[Digits];
+        __m512i r2_reg[Digits];
+        __m512i base[Digits];
+        __m512i one[Digits];
+        __m512i mult[Digits];
+        __m512i res_reg[Digits];
+
+        LoadBatch<Digits>(mod_reg, mod, num, T);
+        LoadBatch<Digits>(r2_reg, r2, num, T);
+        LoadBatch<Digits>(base, inp, num, T);
+
+        __m512i k_reg   = _mm512_load_si512(k0);
+        __m512i exp_reg = _mm512_load_si512(exp);
+
+        AdjustBatchR2<Digits>(r2_reg, mod_reg, k_reg, T);
+
+        for (Uint64 i = 0; i < Digits; i++) {
+            one[i] = _mm512_setzero_si512();
+        }
+        one[0] = _mm512_set1_epi64(1);
+
+        // base and one in mont form, lanes with the top bit set start at base
+        AmmBatch<Digits>(base, base, r2_reg, mod_reg, k_reg);
+        AmmBatch<Digits>(res_reg, r2_reg, one, mod_reg, k_reg);
+
+        auto bit_mask = [exp_reg](Uint64 bit) {
+            return _mm512_test_epi64_mask(exp_reg,
+                                          _mm512_set1_epi64(1ULL << bit));
+        };
+
+        __mmask8 mask = bit_mask(exp_bits - 1);
+        for (Uint64 i = 0; i < Digits; i++) {
+            res_reg[i] = _mm512_mask_mov_epi64(res_reg[i], mask, base[i]);
+        }
+
+        for (Int64 b = exp_bits - 2; b >= 0; b--) {
+            AmmBatch<Digits>(res_reg, res_reg, res_reg, mod_reg, k_reg);
+
+            mask = bit_mask(b);
+            if (mask) {
+                AmmBatch<Digits>(mult, res_reg, base, mod_reg, k_reg);
+                for (Uint64 i = 0; i < Digits; i++) {
+                    res_reg[i] =
+                        _mm512_mask_mov_epi64(res_reg[i], mask, mult[i]);
+                }
+            }
+        }
+
+        // convert from mont domain to residue domain
+        AmmBatch<Digits>(res_reg, res_reg, one, mod_reg, k_reg);
+
+        StoreBatch<Digits>(res, res_reg, num, T);
+    }
+
+    template<alc_rsa_key_size T>
+    static inline void DecryptUsingCRTBatch(Uint64* const        res[],
+                                            const Uint64* const  inp[],
+                                            Uint64               num,
+                                            RsaPrivateKeyBignum& privKey,
+                                            MontContextBignum&   contextP,
+                                            MontContextBignum&   contextQ)
+    {
+        // smallest digit count with R > 4 * M
+        constexpr Uint64 Bits   = T / 2;
+        constexpr Uint64 Digits = (Bits + 51) / 52;
+
+        alignas(64) Uint64 ap[RsaBatchSize][T / 128];
+        alignas(64) Uint64 aq[RsaBatchSize][T / 128];
+        Uint64*            p_ap[RsaBatchSize];
+        Uint64*            p_aq[RsaBatchSize];
+
+        for (Uint64 l = 0; l < num; l++) {
+            p_ap[l] = ap[l];
+            p_aq[l] = aq[l];
+            ReduceCRTBases<T>(
+                ap[l], aq[l], inp[l], privKey, contextP, contextQ);
+        }
+
+        __m512i mod_reg[Digits];
+        __m512i r2_reg[Digits];
+        __m512i base[Digits];
+        __m512i k_reg;
+
+        // ap = ap ^ dp mod p
+        CreateBatchConstants<Digits>(
+            mod_reg, r2_reg, privKey.m_p.get(), contextP, Bits);
+        LoadBatch<Digits>(base, p_ap, num, Bits);
+        k_reg = _mm512_set1_epi64(contextP.m_k0);
+        MontgomeryExpConstantTimeBatch<Digits>(
+            base, base, privKey.m_dp.get(), Bits, mod_reg, r2_reg, k_reg);
+        StoreBatch<Digits>(p_ap, base, num, Bits);
+
+        // aq = aq ^ dq mod q
+        CreateBatchConstants<Digits>(
+            mod_reg, r2_reg, privKey.m_q.get(), contextQ, Bits);
+        LoadBatch<Digits>(base, p_aq, num, Bits);
+        k_reg = _mm512_set1_epi64(contextQ.m_k0);
+        MontgomeryExpConstantTimeBatch<Digits>(
+            base, base, privKey.m_dq.get(), Bits, mod_reg, r2_reg, k_reg);
+        StoreBatch<Digits>(p_aq, base, num, Bits);
+
+        for (Uint64 l = 0; l < num; l++) {
+            CombineCRT<T>(res[l], ap[l], aq[l], privKey, contextP);
+        }
+    }
+
     template<>
     inline void mont::MontCompute<KEY_SIZE_2048>::CreateContext(
         MontContextBignum& context, Uint64* mod, Uint64 size)
@@ -1839,6 +2746,80 @@ namespace alcp::rsa { namespace zen4 {
         Rsa1024Radix52BitToRadix64(res, input_radix_52_bit);
     }
 
+    static inline void MontgomeryExpShort2048(Uint64*       res,
+                                              const Uint64* input,
+                                              Uint64        squarings,
+                                              Uint64*       mod_radix_52_bit,
+                                              Uint64*       r2_radix_52_bit,
+                                              Uint64        k0)
+    {
+        alignas(64) Uint64 input_radix_52_bit[40];
+        alignas(64) Uint64 res_radix_52_bit[40];
+        Rsa2048Radix64BitToRadix52Bit(input_radix_52_bit, input);
+
+        __m512i mod_reg[5];
+        LoadReg512(mod_reg, mod_radix_52_bit);
+
+        __m512i k_reg = _mm512_set1_epi64(k0);
+
+        AMM2048(res_radix_52_bit,
+                input_radix_52_bit,
+                r2_radix_52_bit,
+                mod_reg,
+                k_reg);
+
+        for (Uint64 i = 0; i < squarings; i++) {
+            AMS2048(res_radix_52_bit, res_radix_52_bit, mod_reg, k_reg);
+        }
+
+        AMM2048(res_radix_52_bit,
+                res_radix_52_bit,
+                input_radix_52_bit,
+                mod_reg,
+                k_reg);
+
+        ReduceOnceRadix52(res_radix_52_bit, mod_radix_52_bit, 40);
+
+        Rsa2048Radix52BitToRadix64Bit(res, res_radix_52_bit);
+    }
+
+    static inline void MontgomeryExpShort1024(Uint64*       res,
+                                              const Uint64* input,
+                                              Uint64        squarings,
+                                              Uint64*       mod_radix_52_bit,
+                                              Uint64*       r2_radix_52_bit,
+                                              Uint64        k0)
+    {
+        alignas(64) Uint64 input_radix_52_bit[20]{};
+        alignas(64) Uint64 res_radix_52_bit[20]{};
+        Rsa1024Radix64BitToRadix52Bit(input_radix_52_bit, input);
+
+        __m256i mod_reg[5];
+        LoadReg256(mod_reg, mod_radix_52_bit);
+
+        __m256i k_reg = _mm256_set1_epi64x(k0);
+
+        AMM1024(res_radix_52_bit,
+                input_radix_52_bit,
+                r2_radix_52_bit,
+                mod_reg,
+                k_reg);
+
+        for (Uint64 i = 0; i < squarings; i++) {
+            AMS1024(res_radix_52_bit, res_radix_52_bit, mod_reg, k_reg);
+        }
+
+        AMM1024(res_radix_52_bit,
+                res_radix_52_bit,
+                input_radix_52_bit,
+                mod_reg,
+                k_reg);
+
+        ReduceOnceRadix52(res_radix_52_bit, mod_radix_52_bit, 20);
+
+        Rsa1024Radix52BitToRadix64(res, res_radix_52_bit);
+    }
+
     template<>
     void archEncryptPublic<KEY_SIZE_1024>(Uint8*              pEncText,
                                           const Uint64*       pTextBignum,
@@ -1851,8 +2832,14 @@ namespace alcp::rsa { namespace zen4 {
         auto exp = &pubKey.m_public_exponent;
 
         alignas(64) Uint64 res_buffer_bignum[1024 / 64 * 3]{};
-        mont::MontCompute<KEY_SIZE_1024>::MontgomeryExp(
-            res_buffer_bignum, pTextBignum, exp, 1, mod, r2, k0);
+        Uint64 squarings = mont::ShortExponentSquarings(*exp);
+        if (squarings) {
+            MontgomeryExpShort1024(
+                res_buffer_bignum, pTextBignum, squarings, mod, r2, k0);
+        } else {
+            mont::MontCompute<KEY_SIZE_1024>::MontgomeryExp(
+                res_buffer_bignum, pTextBignum, exp, 1, mod, r2, k0);
+        }
 
         Uint8* enc_text = reinterpret_cast<Uint8*>(res_buffer_bignum);
         for (Int64 i = 1024 / 8 - 1, j = 0; i >= 0; --i, ++j) {
@@ -1872,8 +2859,14 @@ namespace alcp::rsa { namespace zen4 {
         auto exp = &pubKey.m_public_exponent;
 
         alignas(64) Uint64 res_buffer_bignum[2048 / 64 * 3]{};
-        mont::MontCompute<KEY_SIZE_2048>::MontgomeryExp(
-            res_buffer_bignum, pTextBignum, exp, 1, mod, r2, k0);
+        Uint64 squarings = mont::ShortExponentSquarings(*exp);
+        if (squarings) {
+            MontgomeryExpShort2048(
+                res_buffer_bignum, pTextBignum, squarings, mod, r2, k0);
+        } else {
+            mont::MontCompute<KEY_SIZE_2048>::MontgomeryExp(
+                res_buffer_bignum, pTextBignum, exp, 1, mod, r2, k0);
+        }
 
         Uint8* enc_text = reinterpret_cast<Uint8*>(res_buffer_bignum);
         for (Int64 i = 2048 / 8 - 1, j = 0; i >= 0; --i, ++j) {
@@ -2173,6 +3166,208 @@ namespace alcp::rsa { namespace zen4 {
         return;
     }
 
+    template<>
+    inline void mont::MontCompute<KEY_SIZE_3072>::CreateContext(
+        MontContextBignum& context, Uint64* mod, Uint64 size)
+    {
+        CreateContextRadix64(context, mod, size);
+
+        if (size == 3072 / 64) {
+            CreateContextRadix52<8>(context, mod, 3072);
+        } else {
+            CreateContextRadix52<4>(context, mod, 1536);
+        }
+    }
+
+    template<>
+    inline void mont::MontCompute<KEY_SIZE_4096>::CreateContext(
+        MontContextBignum& context, Uint64* mod, Uint64 size)
+    {
+        CreateContextRadix64(context, mod, size);
+
+        if (size == 4096 / 64) {
+            CreateContextRadix52<10>(context, mod, 4096);
+        } else {
+            CreateContextRadix52<5>(context, mod, 2048);
+        }
+    }
+
+    template<>
+    inline void mont::MontCompute<KEY_SIZE_3072>::MontgomeryExp(
+        Uint64*       res,
+        const Uint64* input,
+        Uint64*       exp,
+        Uint64        expSize,
+        Uint64*       mod_radix_52_bit,
+        Uint64*       r2_radix_52_bit,
+        Uint64        k0)
+    {
+        MontgomeryExpRadix52<8>(res,
+                                input,
+                                exp,
+                                expSize,
+                                mod_radix_52_bit,
+                                r2_radix_52_bit,
+                                k0,
+                                3072);
+    }
+
+    template<>
+    inline void mont::MontCompute<KEY_SIZE_4096>::MontgomeryExp(
+        Uint64*       res,
+        const Uint64* input,
+        Uint64*       exp,
+        Uint64        expSize,
+        Uint64*       mod_radix_52_bit,
+        Uint64*       r2_radix_52_bit,
+        Uint64        k0)
+    {
+        MontgomeryExpRadix52<10>(res,
+                                 input,
+                                 exp,
+                                 expSize,
+                                 mod_radix_52_bit,
+                                 r2_radix_52_bit,
+                                 k0,
+                                 4096);
+    }
+
+    template<>
+    inline void mont::MontCompute<KEY_SIZE_3072>::decryptUsingCRT(
+        Uint64*              res,
+        const Uint64*        inp,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ)
+    {
+        DecryptUsingCRTRadix52<KEY_SIZE_3072, 4>(
+            res, inp, privKey, contextP, contextQ);
+    }
+
+    template<>
+    inline void mont::MontCompute<KEY_SIZE_4096>::decryptUsingCRT(
+        Uint64*              res,
+        const Uint64*        inp,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ)
+    {
+        DecryptUsingCRTRadix52<KEY_SIZE_4096, 5>(
+            res, inp, privKey, contextP, contextQ);
+    }
+
+    template<>
+    void archEncryptPublic<KEY_SIZE_3072>(Uint8*              pEncText,
+                                          const Uint64*       pTextBignum,
+                                          RsaPublicKeyBignum& pubKey,
+                                          MontContextBignum&  context)
+    {
+        auto mod = context.m_mod_radix_52_bit.get();
+        auto r2  = context.m_r2_radix_52_bit.get();
+        auto k0  = context.m_k0;
+        auto exp = &pubKey.m_public_exponent;
+
+        alignas(64) Uint64 res_buffer_bignum[3072 / 64]{};
+        Uint64 squarings = mont::ShortExponentSquarings(*exp);
+        if (squarings) {
+            MontgomeryExpShortRadix52<8>(res_buffer_bignum,
+                                         pTextBignum,
+                                         squarings,
+                                         mod,
+                                         r2,
+                                         k0,
+                                         3072);
+        } else {
+            mont::MontCompute<KEY_SIZE_3072>::MontgomeryExp(
+                res_buffer_bignum, pTextBignum, exp, 1, mod, r2, k0);
+        }
+
+        Uint8* enc_text = reinterpret_cast<Uint8*>(res_buffer_bignum);
+        for (Int64 i = 3072 / 8 - 1, j = 0; i >= 0; --i, ++j) {
+            pEncText[j] = enc_text[i];
+        }
+    }
+
+    template<>
+    void archEncryptPublic<KEY_SIZE_4096>(Uint8*              pEncText,
+                                          const Uint64*       pTextBignum,
+                                          RsaPublicKeyBignum& pubKey,
+                                          MontContextBignum&  context)
+    {
+        auto mod = context.m_mod_radix_52_bit.get();
+        auto r2  = context.m_r2_radix_52_bit.get();
+        auto k0  = context.m_k0;
+        auto exp = &pubKey.m_public_exponent;
+
+        alignas(64) Uint64 res_buffer_bignum[4096 / 64]{};
+        Uint64 squarings = mont::ShortExponentSquarings(*exp);
+        if (squarings) {
+            MontgomeryExpShortRadix52<10>(res_buffer_bignum,
+                                          pTextBignum,
+                                          squarings,
+                                          mod,
+                                          r2,
+                                          k0,
+                                          4096);
+        } else {
+            mont::MontCompute<KEY_SIZE_4096>::MontgomeryExp(
+                res_buffer_bignum, pTextBignum, exp, 1, mod, r2, k0);
+        }
+
+        Uint8* enc_text = reinterpret_cast<Uint8*>(res_buffer_bignum);
+        for (Int64 i = 4096 / 8 - 1, j = 0; i >= 0; --i, ++j) {
+            pEncText[j] = enc_text[i];
+        }
+    }
+
+    template<alc_rsa_key_size T>
+    void archEncryptPublicBatch(Uint8* const              pEncText[],
+                                const Uint64* const       pTextBignum[],
+                                Uint64                    num,
+                                RsaPublicKeyBignum* const pubKey[],
+                                MontContextBignum* const  context[])
+    {
+        alignas(64) Uint64 res_buffer_bignum[RsaBatchSize][T / 64];
+        Uint64*            res[RsaBatchSize];
+        for (Uint64 l = 0; l < num; l++) {
+            res[l] = res_buffer_bignum[l];
+        }
+
+        EncryptPublicBatch<T>(res, pTextBignum, num, pubKey, context);
+
+        for (Uint64 l = 0; l < num; l++) {
+            Uint8* enc_text = reinterpret_cast<Uint8*>(res_buffer_bignum[l]);
+            for (Int64 i = T / 8 - 1, j = 0; i >= 0; --i, ++j) {
+                pEncText[l][j] = enc_text[i];
+            }
+        }
+    }
+
+    template<alc_rsa_key_size T>
+    void archDecryptPrivateBatch(Uint8* const         pText[],
+                                 const Uint64* const  pEncTextBigNum[],
+                                 Uint64               num,
+                                 RsaPrivateKeyBignum& privKey,
+                                 MontContextBignum&   contextP,
+                                 MontContextBignum&   contextQ)
+    {
+        alignas(64) Uint64 res_buffer_bignum[RsaBatchSize][T / 64];
+        Uint64*            res[RsaBatchSize];
+        for (Uint64 l = 0; l < num; l++) {
+            res[l] = res_buffer_bignum[l];
+        }
+
+        DecryptUsingCRTBatch<T>(
+            res, pEncTextBigNum, num, privKey, contextP, contextQ);
+
+        for (Uint64 l = 0; l < num; l++) {
+            Uint8* dec_text = reinterpret_cast<Uint8*>(res_buffer_bignum[l]);
+            for (Int64 i = T / 8 - 1, j = 0; i >= 0; --i, ++j) {
+                pText[l][j] = dec_text[i];
+            }
+        }
+    }
+
     template void archDecryptPrivate<KEY_SIZE_1024>(
         Uint8*               pText,
         const Uint64*        pEncTextBigNum,
@@ -2187,6 +3382,80 @@ namespace alcp::rsa { namespace zen4 {
         MontContextBignum&   contextP,
         MontContextBignum&   contextQ);
 
+    template void archDecryptPrivate<KEY_SIZE_3072>(
+        Uint8*               pText,
+        const Uint64*        pEncTextBigNum,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ);
+
+    template void archDecryptPrivate<KEY_SIZE_4096>(
+        Uint8*               pText,
+        const Uint64*        pEncTextBigNum,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ);
+
+    template void archEncryptPublicBatch<KEY_SIZE_1024>(
+        Uint8* const              pEncText[],
+        const Uint64* const       pTextBigNum[],
+        Uint64                    num,
+        RsaPublicKeyBignum* const pubKey[],
+        MontContextBignum* const  context[]);
+
+    template void archEncryptPublicBatch<KEY_SIZE_2048>(
+        Uint8* const              pEncText[],
+        const Uint64* const       pTextBigNum[],
+        Uint64                    num,
+        RsaPublicKeyBignum* const pubKey[],
+        MontContextBignum* const  context[]);
+
+    template void archEncryptPublicBatch<KEY_SIZE_3072>(
+        Uint8* const              pEncText[],
+        const Uint64* const       pTextBigNum[],
+        Uint64                    num,
+        RsaPublicKeyBignum* const pubKey[],
+        MontContextBignum* const  context[]);
+
+    template void archEncryptPublicBatch<KEY_SIZE_4096>(
+        Uint8* const              pEncText[],
+        const Uint64* const       pTextBigNum[],
+        Uint64                    num,
+        RsaPublicKeyBignum* const pubKey[],
+        MontContextBignum* const  context[]);
+
+    template void archDecryptPrivateBatch<KEY_SIZE_1024>(
+        Uint8* const         pText[],
+        const Uint64* const  pEncTextBigNum[],
+        Uint64               num,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ);
+
+    template void archDecryptPrivateBatch<KEY_SIZE_2048>(
+        Uint8* const         pText[],
+        const Uint64* const  pEncTextBigNum[],
+        Uint64               num,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ);
+
+    template void archDecryptPrivateBatch<KEY_SIZE_3072>(
+        Uint8* const         pText[],
+        const Uint64* const  pEncTextBigNum[],
+        Uint64               num,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ);
+
+    template void archDecryptPrivateBatch<KEY_SIZE_4096>(
+        Uint8* const         pText[],
+        const Uint64* const  pEncTextBigNum[],
+        Uint64               num,
+        RsaPrivateKeyBignum& privKey,
+        MontContextBignum&   contextP,
+        MontContextBignum&   contextQ);
+
     template void archCreateContext<KEY_SIZE_1024>(MontContextBignum& context,
                                                    Uint64*            mod,
                                                    Uint64             size);
@@ -2194,4 +3463,56 @@ namespace alcp::rsa { namespace zen4 {
     template void archCreateContext<KEY_SIZE_2048>(MontContextBignum& context,
                                                    Uint64*            mod,
                                                    Uint64             size);
+
+    template void archCreateContext<KEY_SIZE_3072>(MontContextBignum& context,
+                                                   Uint64*            mod,
+                                                   Uint64             size);
+
+    template void archCreateContext<KEY_SIZE_4096>(MontContextBignum& context,
+                                                   Uint64*            mod,
+                                                   Uint64             size);
+
+    template bool archMillerRabin<KEY_SIZE_1024>(Uint64*            pCandidate,
+                                                 MontContextBignum& context,
+                                                 const Uint64*      pBases,
+                                                 Uint64             rounds);
+
+    template bool archMillerRabin<KEY_SIZE_2048>(Uint64*            pCandidate,
+                                                 MontContextBignum& context,
+                                                 const Uint64*      pBases,
+                                                 Uint64             rounds);
+
+    template bool archMillerRabin<KEY_SIZE_3072>(Uint64*            pCandidate,
+                                                 MontContextBignum& context,
+                                                 const Uint64*      pBases,
+                                                 Uint64             rounds);
+
+    template bool archMillerRabin<KEY_SIZE_4096>(Uint64*            pCandidate,
+                                                 MontContextBignum& context,
+                                                 const Uint64*      pBases,
+                                                 Uint64             rounds);
+
+    template void archModExpHalf<KEY_SIZE_1024>(Uint64*            pRes,
+                                                const Uint64*      pBase,
+                                                Uint64*            pExp,
+                                                Uint64*            pMod,
+                                                MontContextBignum& context);
+
+    template void archModExpHalf<KEY_SIZE_2048>(Uint64*            pRes,
+                                                const Uint64*      pBase,
+                                                Uint64*            pExp,
+                                                Uint64*            pMod,
+                                                MontContextBignum& context);
+
+    template void archModExpHalf<KEY_SIZE_3072>(Uint64*            pRes,
+                                                const Uint64*      pBase,
+                                                Uint64*            pExp,
+                                                Uint64*            pMod,
+                                                MontContextBignum& context);
+
+    template void archModExpHalf<KEY_SIZE_4096>(Uint64*            pRes,
+                                                const Uint64*      pBase,
+                                                Uint64*            pExp,
+                                                Uint64*            pMod,
+                                                MontContextBignum& context);
 }} // namespace alcp::rsa::zen4
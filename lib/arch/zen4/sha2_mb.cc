@@ -0,0 +1,353 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/digest/sha2_512.hh"
+#include "alcp/digest/sha_mb.hh"
+
+#include <immintrin.h>
+
+/*
+ * Multi-buffer SHA-256 (16 lanes) and SHA-512 (8 lanes) with AVX-512, each
+ * 32/64-bit element of a zmm register belongs to a different message.
+ */
+namespace alcp::digest { namespace zen4 {
+
+    /* Transposes the state words of the lanes into/out of the registers */
+    template<typename WORD, int LANES>
+    static inline void LoadHash(WORD* pHash[], __m512i s[8])
+    {
+        alignas(64) WORD tmp[8][LANES];
+        for (int l = 0; l < LANES; l++) {
+            for (int j = 0; j < 8; j++) {
+                tmp[j][l] = pHash[l][j];
+            }
+        }
+        for (int j = 0; j < 8; j++) {
+            s[j] = _mm512_load_si512(tmp[j]);
+        }
+    }
+
+    template<typename WORD, int LANES>
+    static inline void StoreHash(WORD* pHash[], const __m512i s[8])
+    {
+        alignas(64) WORD tmp[8][LANES];
+        for (int j = 0; j < 8; j++) {
+            _mm512_store_si512(tmp[j], s[j]);
+        }
+        for (int l = 0; l < LANES; l++) {
+            for (int j = 0; j < 8; j++) {
+                pHash[l][j] = tmp[j][l];
+            }
+        }
+    }
+
+    /* 4x4 transpose of the 128-bit lanes of a, b, c, d */
+    static inline void Transpose128(__m512i  a,
+                                    __m512i  b,
+                                    __m512i  c,
+                                    __m512i  d,
+                                    __m512i& o0,
+                                    __m512i& o1,
+                                    __m512i& o2,
+                                    __m512i& o3)
+    {
+        __m512i ab_lo = _mm512_shuffle_i32x4(a, b, 0x44);
+        __m512i ab_hi = _mm512_shuffle_i32x4(a, b, 0xee);
+        __m512i cd_lo = _mm512_shuffle_i32x4(c, d, 0x44);
+        __m512i cd_hi = _mm512_shuffle_i32x4(c, d, 0xee);
+
+        o0 = _mm512_shuffle_i32x4(ab_lo, cd_lo, 0x88);
+        o1 = _mm512_shuffle_i32x4(ab_lo, cd_lo, 0xdd);
+        o2 = _mm512_shuffle_i32x4(ab_hi, cd_hi, 0x88);
+        o3 = _mm512_shuffle_i32x4(ab_hi, cd_hi, 0xdd);
+    }
+
+    /*
+     * SHA-256
+     */
+    static inline void Round256(__m512i  a,
+                                __m512i  b,
+                                __m512i  c,
+                                __m512i& d,
+                                __m512i  e,
+                                __m512i  f,
+                                __m512i  g,
+                                __m512i& h,
+                                __m512i  kw)
+    {
+        __m512i s1 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(e, 6),
+                                               _mm512_ror_epi32(e, 11),
+                                               _mm512_ror_epi32(e, 25),
+                                               0x96);
+        __m512i s0 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(a, 2),
+                                               _mm512_ror_epi32(a, 13),
+                                               _mm512_ror_epi32(a, 22),
+                                               0x96);
+        __m512i ch  = _mm512_ternarylogic_epi32(e, f, g, 0xca);
+        __m512i maj = _mm512_ternarylogic_epi32(a, b, c, 0xe8);
+        __m512i t1  = _mm512_add_epi32(_mm512_add_epi32(h, s1),
+                                      _mm512_add_epi32(ch, kw));
+        d           = _mm512_add_epi32(d, t1);
+        h           = _mm512_add_epi32(t1, _mm512_add_epi32(s0, maj));
+    }
+
+    static inline __m512i Schedule256(const __m512i w[16], int t)
+    {
+        __m512i w15 = w[(t + 1) & 15];
+        __m512i w2  = w[(t + 14) & 15];
+        __m512i s0  = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w15, 7),
+                                               _mm512_ror_epi32(w15, 18),
+                                               _mm512_srli_epi32(w15, 3),
+                                               0x96);
+        __m512i s1  = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w2, 17),
+                                               _mm512_ror_epi32(w2, 19),
+                                               _mm512_srli_epi32(w2, 10),
+                                               0x96);
+        return _mm512_add_epi32(_mm512_add_epi32(w[t & 15], s0),
+                                _mm512_add_epi32(w[(t + 9) & 15], s1));
+    }
+
+    /* All 16 words of the current block of the 16 lanes */
+    static inline void LoadMsg256(const Uint8* pSrc[16], __m512i w[16])
+    {
+        const __m512i cBswap = _mm512_set4_epi32(
+            0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+        __m512i u[16];
+        for (int g = 0; g < 4; g++) {
+            __m512i r0 = _mm512_loadu_si512(pSrc[4 * g]);
+            __m512i r1 = _mm512_loadu_si512(pSrc[4 * g + 1]);
+            __m512i r2 = _mm512_loadu_si512(pSrc[4 * g + 2]);
+            __m512i r3 = _mm512_loadu_si512(pSrc[4 * g + 3]);
+
+            __m512i t0 = _mm512_unpacklo_epi32(r0, r1);
+            __m512i t1 = _mm512_unpackhi_epi32(r0, r1);
+            __m512i t2 = _mm512_unpacklo_epi32(r2, r3);
+            __m512i t3 = _mm512_unpackhi_epi32(r2, r3);
+
+            u[4 * g]     = _mm512_unpacklo_epi64(t0, t2);
+            u[4 * g + 1] = _mm512_unpackhi_epi64(t0, t2);
+            u[4 * g + 2] = _mm512_unpacklo_epi64(t1, t3);
+            u[4 * g + 3] = _mm512_unpackhi_epi64(t1, t3);
+        }
+        // u[4g + k], 128-bit lane m holds word 4m + k of lanes 4g..4g+3
+        for (int k = 0; k < 4; k++) {
+            Transpose128(u[k],
+                         u[4 + k],
+                         u[8 + k],
+                         u[12 + k],
+                         w[k],
+                         w[4 + k],
+                         w[8 + k],
+                         w[12 + k]);
+        }
+        for (int k = 0; k < 16; k++) {
+            w[k] = _mm512_shuffle_epi8(w[k], cBswap);
+        }
+    }
+
+    void ShaUpdate256x16(Uint32*       pHash[16],
+                         const Uint8*  pSrc[16],
+                         Uint64        numBlocks,
+                         const Uint32* pHashConstants)
+    {
+        __m512i      s[8], w[16];
+        const Uint8* p_src[16];
+
+        for (int l = 0; l < 16; l++) {
+            p_src[l] = pSrc[l];
+        }
+        LoadHash<Uint32, 16>(pHash, s);
+
+        while (numBlocks--) {
+            __m512i a = s[0], b = s[1], c = s[2], d = s[3];
+            __m512i e = s[4], f = s[5], g = s[6], h = s[7];
+
+            LoadMsg256(p_src, w);
+
+            for (int t = 0; t < 64; t += 8) {
+                if (t >= 16) {
+                    for (int i = 0; i < 8; i++) {
+                        w[(t + i) & 15] = Schedule256(w, t + i);
+                    }
+                }
+                __m512i kw[8];
+                for (int i = 0; i < 8; i++) {
+                    kw[i] = _mm512_add_epi32(
+                        w[(t + i) & 15],
+                        _mm512_set1_epi32(pHashConstants[t + i]));
+                }
+                Round256(a, b, c, d, e, f, g, h, kw[0]);
+                Round256(h, a, b, c, d, e, f, g, kw[1]);
+                Round256(g, h, a, b, c, d, e, f, kw[2]);
+                Round256(f, g, h, a, b, c, d, e, kw[3]);
+                Round256(e, f, g, h, a, b, c, d, kw[4]);
+                Round256(d, e, f, g, h, a, b, c, kw[5]);
+                Round256(c, d, e, f, g, h, a, b, kw[6]);
+                Round256(b, c, d, e, f, g, h, a, kw[7]);
+            }
+
+            s[0] = _mm512_add_epi32(s[0], a);
+            s[1] = _mm512_add_epi32(s[1], b);
+            s[2] = _mm512_add_epi32(s[2], c);
+            s[3] = _mm512_add_epi32(s[3], d);
+            s[4] = _mm512_add_epi32(s[4], e);
+            s[5] = _mm512_add_epi32(s[5], f);
+            s[6] = _mm512_add_epi32(s[6], g);
+            s[7] = _mm512_add_epi32(s[7], h);
+
+            for (int l = 0; l < 16; l++) {
+                p_src[l] += 64;
+            }
+        }
+
+        StoreHash<Uint32, 16>(pHash, s);
+    }
+
+    /*
+     * SHA-512
+     */
+    static inline void Round512(__m512i  a,
+                                __m512i  b,
+                                __m512i  c,
+                                __m512i& d,
+                                __m512i  e,
+                                __m512i  f,
+                                __m512i  g,
+                                __m512i& h,
+                                __m512i  kw)
+    {
+        __m512i s1 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(e, 14),
+                                               _mm512_ror_epi64(e, 18),
+                                               _mm512_ror_epi64(e, 41),
+                                               0x96);
+        __m512i s0 = _mm512_ternarylogic_epi64(_mm512_ror_epi64(a, 28),
+                                               _mm512_ror_epi64(a, 34),
+                                               _mm512_ror_epi64(a, 39),
+                                               0x96);
+        __m512i ch  = _mm512_ternarylogic_epi64(e, f, g, 0xca);
+        __m512i maj = _mm512_ternarylogic_epi64(a, b, c, 0xe8);
+        __m512i t1  = _mm512_add_epi64(_mm512_add_epi64(h, s1),
+                                      _mm512_add_epi64(ch, kw));
+        d           = _mm512_add_epi64(d, t1);
+        h           = _mm512_add_epi64(t1, _mm512_add_epi64(s0, maj));
+    }
+
+    static inline __m512i Schedule512(const __m512i w[16], int t)
+    {
+        __m512i w15 = w[(t + 1) & 15];
+        __m512i w2  = w[(t + 14) & 15];
+        __m512i s0  = _mm512_ternarylogic_epi64(_mm512_ror_epi64(w15, 1),
+                                               _mm512_ror_epi64(w15, 8),
+                                               _mm512_srli_epi64(w15, 7),
+                                               0x96);
+        __m512i s1  = _mm512_ternarylogic_epi64(_mm512_ror_epi64(w2, 19),
+                                               _mm512_ror_epi64(w2, 61),
+                                               _mm512_srli_epi64(w2, 6),
+                                               0x96);
+        return _mm512_add_epi64(_mm512_add_epi64(w[t & 15], s0),
+                                _mm512_add_epi64(w[(t + 9) & 15], s1));
+    }
+
+    /* Words 8h..8h+7 of the current block of all 8 lanes */
+    static inline void LoadMsg512(const Uint8* pSrc[8], int half, __m512i w[])
+    {
+        const __m512i cBswap = _mm512_set4_epi32(
+            0x08090a0b, 0x0c0d0e0f, 0x00010203, 0x04050607);
+        __m512i t[8];
+        for (int g = 0; g < 4; g++) {
+            __m512i r0 = _mm512_loadu_si512(pSrc[2 * g] + 64 * half);
+            __m512i r1 = _mm512_loadu_si512(pSrc[2 * g + 1] + 64 * half);
+            t[g]       = _mm512_unpacklo_epi64(r0, r1);
+            t[4 + g]   = _mm512_unpackhi_epi64(r0, r1);
+        }
+        // t[g], 128-bit lane m holds word 2m of lanes 2g, 2g+1; t[4 + g] 2m+1
+        Transpose128(t[0], t[1], t[2], t[3], w[0], w[2], w[4], w[6]);
+        Transpose128(t[4], t[5], t[6], t[7], w[1], w[3], w[5], w[7]);
+        for (int k = 0; k < 8; k++) {
+            w[k] = _mm512_shuffle_epi8(w[k], cBswap);
+        }
+    }
+
+    void ShaUpdate512x8(Uint64*      pHash[8],
+                        const Uint8* pSrc[8],
+                        Uint64       numBlocks)
+    {
+        __m512i      s[8], w[16];
+        const Uint8* p_src[8];
+
+        for (int l = 0; l < 8; l++) {
+            p_src[l] = pSrc[l];
+        }
+        LoadHash<Uint64, 8>(pHash, s);
+
+        while (numBlocks--) {
+            __m512i a = s[0], b = s[1], c = s[2], d = s[3];
+            __m512i e = s[4], f = s[5], g = s[6], h = s[7];
+
+            LoadMsg512(p_src, 0, &w[0]);
+            LoadMsg512(p_src, 1, &w[8]);
+
+            for (int t = 0; t < 80; t += 8) {
+                if (t >= 16) {
+                    for (int i = 0; i < 8; i++) {
+                        w[(t + i) & 15] = Schedule512(w, t + i);
+                    }
+                }
+                __m512i kw[8];
+                for (int i = 0; i < 8; i++) {
+                    kw[i] = _mm512_add_epi64(
+                        w[(t + i) & 15],
+                        _mm512_set1_epi64(cRoundConstants[t + i]));
+                }
+                Round512(a, b, c, d, e, f, g, h, kw[0]);
+                Round512(h, a, b, c, d, e, f, g, kw[1]);
+                Round512(g, h, a, b, c, d, e, f, kw[2]);
+                Round512(f, g, h, a, b, c, d, e, kw[3]);
+                Round512(e, f, g, h, a, b, c, d, kw[4]);
+                Round512(d, e, f, g, h, a, b, c, kw[5]);
+                Round512(c, d, e, f, g, h, a, b, kw[6]);
+                Round512(b, c, d, e, f, g, h, a, kw[7]);
+            }
+
+            s[0] = _mm512_add_epi64(s[0], a);
+            s[1] = _mm512_add_epi64(s[1], b);
+            s[2] = _mm512_add_epi64(s[2], c);
+            s[3] = _mm512_add_epi64(s[3], d);
+            s[4] = _mm512_add_epi64(s[4], e);
+            s[5] = _mm512_add_epi64(s[5], f);
+            s[6] = _mm512_add_epi64(s[6], g);
+            s[7] = _mm512_add_epi64(s[7], h);
+
+            for (int l = 0; l < 8; l++) {
+                p_src[l] += 128;
+            }
+        }
+
+        StoreHash<Uint64, 8>(pHash, s);
+    }
+
+}} // namespace alcp::digest::zen4
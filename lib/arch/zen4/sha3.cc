@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/digest/sha3.hh"
+#include "alcp/utils/copy.hh"
+
+#include <immintrin.h>
+
+/*
+ * Keccak-f[1600] with AVX-512.
+ *
+ * Plane y of the state (lanes x = 0..4) lives in the low five qwords of one
+ * zmm register. Theta needs two lane permutes, rho is a single vprolvq per
+ * plane. Pi is split into an in-register permute (pi1) followed by a 5x5
+ * transpose (pi2); between the two the planes are transposed, so chi becomes a
+ * register wide vpternlog across the five registers with no extra shuffles.
+ * Qwords 5..7 of every register carry junk that never reaches qwords 0..4.
+ */
+namespace alcp::digest { namespace zen4 {
+
+    static constexpr __mmask8 cPlaneMask = 0x1f;
+
+    // a ^ b ^ c
+    static constexpr int cXor3 = 0x96;
+    // a ^ (~b & c)
+    static constexpr int cChi = 0xd2;
+
+    static inline __m512i LoadPlane(const Uint64* p)
+    {
+        return _mm512_maskz_loadu_epi64(cPlaneMask, p);
+    }
+
+    static inline void StorePlane(Uint64* p, __m512i plane)
+    {
+        _mm512_mask_storeu_epi64(p, cPlaneMask, plane);
+    }
+
+    static inline void KeccakF1600(__m512i a[cDim])
+    {
+        const __m512i cThetaPrev = _mm512_setr_epi64(4, 0, 1, 2, 3, 5, 6, 7);
+        const __m512i cThetaNext = _mm512_setr_epi64(1, 2, 3, 4, 0, 5, 6, 7);
+
+        __m512i rho[cDim], pi1[cDim];
+        for (int i = 0; i < cDim; i++) {
+            rho[i] = _mm512_setr_epi64(cRotationConstants[i][0],
+                                       cRotationConstants[i][1],
+                                       cRotationConstants[i][2],
+                                       cRotationConstants[i][3],
+                                       cRotationConstants[i][4],
+                                       0,
+                                       0,
+                                       0);
+            // Lane y of register x takes lane (x + 3y) of plane x
+            pi1[i] = _mm512_setr_epi64(i % cDim,
+                                       (i + 3) % cDim,
+                                       (i + 6) % cDim,
+                                       (i + 9) % cDim,
+                                       (i + 12) % cDim,
+                                       5,
+                                       6,
+                                       7);
+        }
+        const __m512i cPi2Lo  = _mm512_setr_epi64(0, 1, 8, 9, 4, 5, 6, 7);
+        const __m512i cPi2Mid = _mm512_setr_epi64(2, 3, 10, 11, 4, 5, 6, 7);
+        const __m512i cPi2Hi  = _mm512_setr_epi64(4, 5, 12, 13, 4, 5, 6, 7);
+
+        for (int round = 0; round < 24; round++) {
+            // Theta
+            __m512i c = _mm512_ternarylogic_epi64(a[0], a[1], a[2], cXor3);
+            c         = _mm512_ternarylogic_epi64(c, a[3], a[4], cXor3);
+            __m512i d = _mm512_xor_si512(
+                _mm512_permutexvar_epi64(cThetaPrev, c),
+                _mm512_rol_epi64(_mm512_permutexvar_epi64(cThetaNext, c), 1));
+
+            // Rho and Pi1
+            __m512i b[cDim];
+            for (int i = 0; i < cDim; i++) {
+                b[i] = _mm512_rolv_epi64(_mm512_xor_si512(a[i], d), rho[i]);
+                b[i] = _mm512_permutexvar_epi64(pi1[i], b[i]);
+            }
+
+            // Chi, on the transposed planes
+            for (int i = 0; i < cDim; i++) {
+                a[i] = _mm512_ternarylogic_epi64(
+                    b[i], b[(i + 1) % cDim], b[(i + 2) % cDim], cChi);
+            }
+
+            // Iota
+            a[0] = _mm512_mask_xor_epi64(
+                a[0],
+                0x01,
+                a[0],
+                _mm512_set1_epi64(cKeccakRoundConstants[round]));
+
+            // Pi2, transpose back to planes
+            __m512i t0 = _mm512_unpacklo_epi64(a[0], a[1]);
+            __m512i t1 = _mm512_unpackhi_epi64(a[0], a[1]);
+            __m512i t2 = _mm512_unpacklo_epi64(a[2], a[3]);
+            __m512i t3 = _mm512_unpackhi_epi64(a[2], a[3]);
+            __m512i t4 = a[4];
+
+            a[0] = _mm512_permutex2var_epi64(t0, cPi2Lo, t2);
+            a[1] = _mm512_permutex2var_epi64(t1, cPi2Lo, t3);
+            a[2] = _mm512_permutex2var_epi64(t0, cPi2Mid, t2);
+            a[3] = _mm512_permutex2var_epi64(t1, cPi2Mid, t3);
+            a[4] = _mm512_permutex2var_epi64(t0, cPi2Hi, t2);
+            for (int i = 0; i < cDim; i++) {
+                a[i] = _mm512_mask_permutexvar_epi64(
+                    a[i], 0x10, _mm512_set1_epi64(i), t4);
+            }
+        }
+    }
+
+    alc_error_t Sha3Update(Uint64* state,
+                           Uint64* pSrc,
+                           Uint64  msg_size,
+                           Uint64  chunk_size)
+    {
+        Uint64   chunk_size_u64 = chunk_size / 8;
+        Uint64   num_chunks     = msg_size / chunk_size;
+        __mmask8 msg_mask[cDim];
+        __m512i  a[cDim];
+
+        // How much of each plane a message block covers
+        for (int i = 0; i < cDim; i++) {
+            Uint64 words = 0;
+            if (chunk_size_u64 > Uint64(i * cDim)) {
+                words = std::min<Uint64>(cDim, chunk_size_u64 - i * cDim);
+            }
+            msg_mask[i] = static_cast<__mmask8>((1 << words) - 1);
+            a[i]        = LoadPlane(state + i * cDim);
+        }
+
+        for (Uint64 n = 0; n < num_chunks; n++) {
+            for (int i = 0; i < cDim; i++) {
+                __m512i msg =
+                    _mm512_maskz_loadu_epi64(msg_mask[i], pSrc + i * cDim);
+                a[i] = _mm512_xor_si512(a[i], msg);
+            }
+            KeccakF1600(a);
+            pSrc += chunk_size_u64;
+        }
+
+        for (int i = 0; i < cDim; i++) {
+            StorePlane(state + i * cDim, a[i]);
+        }
+        return ALC_ERROR_NONE;
+    }
+
+    void Sha3Finalize(Uint8* state,
+                      Uint8* hash,
+                      Uint64 hash_size,
+                      Uint64 chunk_size)
+    {
+        Uint64* p_state64   = reinterpret_cast<Uint64*>(state);
+        Uint64  hash_copied = 0;
+
+        while (hash_copied < hash_size) {
+            Uint64 to_copy = std::min(chunk_size, hash_size - hash_copied);
+            utils::CopyBlock(&hash[hash_copied], state, to_copy);
+            hash_copied += to_copy;
+
+            if (hash_copied < hash_size) {
+                __m512i a[cDim];
+                for (int i = 0; i < cDim; i++) {
+                    a[i] = LoadPlane(p_state64 + i * cDim);
+                }
+                KeccakF1600(a);
+                for (int i = 0; i < cDim; i++) {
+                    StorePlane(p_state64 + i * cDim, a[i]);
+                }
+            }
+        }
+    }
+
+}} // namespace alcp::digest::zen4
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/digest/sha3.hh"
+
+#include <cstring>
+#include <immintrin.h>
+
+#if defined(COMPILER_IS_GCC)
+#define UNROLL_5 _Pragma("GCC unroll 5")
+#else
+#define UNROLL_5
+#endif
+
+/*
+ * Keccak-f[1600] on 8 independent states with AVX-512. Register i holds lane
+ * i of the state (i = x + 5y) for all 8 states; the 25 state registers and
+ * the round temporaries fit the 32 zmm registers.
+ */
+namespace alcp::digest { namespace zen4 {
+
+    // a ^ b ^ c
+    static constexpr int cXor3 = 0x96;
+    // a ^ (~b & c)
+    static constexpr int cChi = 0xd2;
+
+    static inline void KeccakF1600x8(__m512i a[cDim * cDim])
+    {
+        __m512i rho[cDim * cDim];
+        UNROLL_5
+        for (int y = 0; y < cDim; y++) {
+            UNROLL_5
+            for (int x = 0; x < cDim; x++) {
+                rho[x + cDim * y] = _mm512_set1_epi64(cRotationConstants[y][x]);
+            }
+        }
+
+        for (int round = 0; round < 24; round++) {
+            __m512i c[cDim], d[cDim], b[cDim * cDim];
+
+            // Theta
+            UNROLL_5
+            for (int x = 0; x < cDim; x++) {
+                c[x] = _mm512_ternarylogic_epi64(
+                    a[x], a[x + 5], a[x + 10], cXor3);
+                c[x] = _mm512_ternarylogic_epi64(
+                    c[x], a[x + 15], a[x + 20], cXor3);
+            }
+            UNROLL_5
+            for (int x = 0; x < cDim; x++) {
+                d[x] = _mm512_xor_si512(c[(x + 4) % cDim],
+                                        _mm512_rol_epi64(c[(x + 1) % cDim], 1));
+            }
+
+            // Rho and Pi, (x, y) moves to (y, 2x + 3y)
+            UNROLL_5
+            for (int y = 0; y < cDim; y++) {
+                UNROLL_5
+                for (int x = 0; x < cDim; x++) {
+                    int i = x + cDim * y;
+                    b[y + cDim * ((2 * x + 3 * y) % cDim)] =
+                        _mm512_rolv_epi64(_mm512_xor_si512(a[i], d[x]), rho[i]);
+                }
+            }
+
+            // Chi
+            UNROLL_5
+            for (int y = 0; y < cDim; y++) {
+                UNROLL_5
+                for (int x = 0; x < cDim; x++) {
+                    a[x + cDim * y] =
+                        _mm512_ternarylogic_epi64(b[x + cDim * y],
+                                                  b[(x + 1) % cDim + cDim * y],
+                                                  b[(x + 2) % cDim + cDim * y],
+                                                  cChi);
+                }
+            }
+
+            // Iota
+            a[0] = _mm512_xor_si512(
+                a[0], _mm512_set1_epi64(cKeccakRoundConstants[round]));
+        }
+    }
+
+    /* 4x4 transpose of the 128-bit lanes of a, b, c, d */
+    static inline void Transpose128(__m512i  a,
+                                    __m512i  b,
+                                    __m512i  c,
+                                    __m512i  d,
+                                    __m512i& o0,
+                                    __m512i& o1,
+                                    __m512i& o2,
+                                    __m512i& o3)
+    {
+        __m512i ab_lo = _mm512_shuffle_i32x4(a, b, 0x44);
+        __m512i ab_hi = _mm512_shuffle_i32x4(a, b, 0xee);
+        __m512i cd_lo = _mm512_shuffle_i32x4(c, d, 0x44);
+        __m512i cd_hi = _mm512_shuffle_i32x4(c, d, 0xee);
+
+        o0 = _mm512_shuffle_i32x4(ab_lo, cd_lo, 0x88);
+        o1 = _mm512_shuffle_i32x4(ab_lo, cd_lo, 0xdd);
+        o2 = _mm512_shuffle_i32x4(ab_hi, cd_hi, 0x88);
+        o3 = _mm512_shuffle_i32x4(ab_hi, cd_hi, 0xdd);
+    }
+
+    static inline Uint64 LoadWord(const Uint8* p)
+    {
+        Uint64 word;
+        memcpy(&word, p, sizeof(word));
+        return word;
+    }
+
+    void Sha3UpdateX8(Uint64*      pState[8],
+                      const Uint8* pSrc[8],
+                      Uint64       numBlocks,
+                      Uint64       chunkSize)
+    {
+        const Uint64 cWords = chunkSize / 8;
+        const Uint8* p_src[8];
+        __m512i      a[cDim * cDim];
+
+        alignas(64) Uint64 tmp[cDim * cDim][8];
+        for (int l = 0; l < 8; l++) {
+            p_src[l] = pSrc[l];
+            for (int i = 0; i < cDim * cDim; i++) {
+                tmp[i][l] = pState[l][i];
+            }
+        }
+        for (int i = 0; i < cDim * cDim; i++) {
+            a[i] = _mm512_load_si512(tmp[i]);
+        }
+
+        while (numBlocks--) {
+            Uint64 i = 0;
+            // Eight words of every state at a time, 8x8 transposed
+            for (; i + 8 <= cWords; i += 8) {
+                __m512i t[8], w[8];
+                for (int g = 0; g < 4; g++) {
+                    __m512i r0 = _mm512_loadu_si512(p_src[2 * g] + 8 * i);
+                    __m512i r1 = _mm512_loadu_si512(p_src[2 * g + 1] + 8 * i);
+                    t[g]       = _mm512_unpacklo_epi64(r0, r1);
+                    t[4 + g]   = _mm512_unpackhi_epi64(r0, r1);
+                }
+                Transpose128(t[0], t[1], t[2], t[3], w[0], w[2], w[4], w[6]);
+                Transpose128(t[4], t[5], t[6], t[7], w[1], w[3], w[5], w[7]);
+                for (int k = 0; k < 8; k++) {
+                    a[i + k] = _mm512_xor_si512(a[i + k], w[k]);
+                }
+            }
+            for (; i < cWords; i++) {
+                a[i] = _mm512_xor_si512(
+                    a[i],
+                    _mm512_setr_epi64(LoadWord(p_src[0] + 8 * i),
+                                      LoadWord(p_src[1] + 8 * i),
+                                      LoadWord(p_src[2] + 8 * i),
+                                      LoadWord(p_src[3] + 8 * i),
+                                      LoadWord(p_src[4] + 8 * i),
+                                      LoadWord(p_src[5] + 8 * i),
+                                      LoadWord(p_src[6] + 8 * i),
+                                      LoadWord(p_src[7] + 8 * i)));
+            }
+
+            KeccakF1600x8(a);
+
+            for (int l = 0; l < 8; l++) {
+                p_src[l] += chunkSize;
+            }
+        }
+
+        for (int i = 0; i < cDim * cDim; i++) {
+            _mm512_store_si512(tmp[i], a[i]);
+        }
+        for (int l = 0; l < 8; l++) {
+            for (int i = 0; i < cDim * cDim; i++) {
+                pState[l][i] = tmp[i][l];
+            }
+        }
+    }
+
+}} // namespace alcp::digest::zen4
@@ -223,4 +223,203 @@ void inline getPrecomputedTable(bool     isFirstUpdate,
     }
 }
 
-} // namespace alcp::cipher::vaes512
\ No newline at end of file
+/*
+ * Multi-record GCM, for the many small and independent records (TLS records
+ * of one flush) under a single key.
+ *
+ * The single-stream kernel encrypts E(J0) for the tag, the blocks after the
+ * last multiple of 4 and the partial block one at a time with aesni. For a
+ * small record these serial blocks are most of the AES work, so here they are
+ * gathered across up to cRecordsPerBatch records and encrypted 16 blocks per
+ * AesEncNoLoad_4x512 call. The bulk of each record still goes through the
+ * gcmBlk kernel, the hash subkey table is computed only once per call.
+ */
+template<void AesEncNoLoad_4x512(
+             __m512i& a, __m512i& b, __m512i& c, __m512i& d, const sKeys& keys),
+         void alcp_load_key_zmm(const __m128i pkey128[], sKeys& keys),
+         void alcp_clear_keys_zmm(sKeys& keys),
+         bool encrypt,
+         typename BULK>
+alc_error_t inline gcmRecords_512(
+    const alc_cipher_aead_record_t* pRecords,
+    Uint64                          count,
+    const Uint8*                    pKey,
+    int                             nRounds,
+    alcp::cipher::GcmAuthData*      gcm,
+    __m128i                         reverse_mask_128,
+    BULK                            bulk)
+{
+    // J0, up to 3 trailing blocks and the partial block
+    constexpr Uint64 cMaxTailBlks     = 5;
+    constexpr Uint64 cRecordsPerBatch = 16;
+    constexpr Uint64 cBlksIn4x512     = 16;
+
+    alc_error_t err = ALC_ERROR_NONE;
+
+    const __m128i const_factor_128 = _mm_set_epi64x(0xC200000000000000, 0x1);
+    const __m128i one_lo_128       = _mm_set_epi32(1, 0, 0, 0);
+
+    // counter 4 bytes are arranged in reverse order for counter increment
+    const __m128i swap_ctr_128 =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 15, 14, 13, 12);
+
+    auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+    // key stream of the gathered counter blocks
+    __m128i ks[cRecordsPerBatch * cMaxTailBlks];
+    __m128i ctr[cRecordsPerBatch];
+    Uint64  ks_idx[cRecordsPerBatch];
+
+    for (Uint64 i = 0; i < count; i++) {
+        if (pRecords[i].ar_tag_len > 16) {
+            return ALC_ERROR_INVALID_SIZE;
+        }
+    }
+
+    bool isHashSubKeyReady = false;
+    bool isFirstUpdate     = true;
+
+    for (Uint64 batch = 0; batch < count; batch += cRecordsPerBatch) {
+        Uint64 n = count - batch;
+        if (n > cRecordsPerBatch) {
+            n = cRecordsPerBatch;
+        }
+        const alc_cipher_aead_record_t* p_rec = pRecords + batch;
+
+        // gather the counter blocks of J0 and of all record tails
+        Uint64 num_ks = 0;
+        for (Uint64 r = 0; r < n; r++) {
+            if (p_rec[r].ar_iv_len == 12 && isHashSubKeyReady) {
+                ctr[r] = _mm_setzero_si128();
+                utils::CopyBytes((Uint8*)&ctr[r], p_rec[r].ar_iv, 12);
+                ctr[r] = _mm_insert_epi32(ctr[r], 0x2000000, 3);
+                ctr[r] = _mm_shuffle_epi8(ctr[r], swap_ctr_128);
+            } else {
+                // the first record also derives the hash subkey
+                __m128i h_128 = _mm_setzero_si128(), tag_128;
+                InitGcm(pKey,
+                        nRounds,
+                        p_rec[r].ar_iv,
+                        p_rec[r].ar_iv_len,
+                        h_128,
+                        tag_128,
+                        ctr[r],
+                        reverse_mask_128);
+                gcm->m_hash_subKey_128 = h_128;
+                isHashSubKeyReady      = true;
+            }
+
+            Uint64 blocks = p_rec[r].ar_len / Rijndael::cBlockSize;
+            Uint64 tail   = blocks % 4;
+            if (p_rec[r].ar_len % Rijndael::cBlockSize) {
+                tail++;
+            }
+
+            ks_idx[r]    = num_ks;
+            ks[num_ks++] = _mm_shuffle_epi8(
+                _mm_sub_epi32(ctr[r], one_lo_128), swap_ctr_128);
+
+            __m128i c_128 = _mm_add_epi32(
+                ctr[r], _mm_set_epi32((int)(blocks & ~3ULL), 0, 0, 0));
+            for (Uint64 t = 0; t < tail; t++) {
+                ks[num_ks++] = _mm_shuffle_epi8(c_128, swap_ctr_128);
+                c_128        = _mm_add_epi32(c_128, one_lo_128);
+            }
+        }
+        for (Uint64 i = num_ks; i % cBlksIn4x512; i++) {
+            ks[i] = _mm_setzero_si128();
+        }
+
+        sKeys keys{};
+        alcp_load_key_zmm(pkey128, keys);
+        for (Uint64 i = 0; i < num_ks; i += cBlksIn4x512) {
+            __m512i* p_ks = reinterpret_cast<__m512i*>(ks + i);
+            __m512i  b1, b2, b3, b4;
+            alcp_loadu_4values(p_ks, b1, b2, b3, b4);
+            AesEncNoLoad_4x512(b1, b2, b3, b4, keys);
+            alcp_storeu_4values(p_ks, b1, b2, b3, b4);
+        }
+        alcp_clear_keys_zmm(keys);
+
+        for (Uint64 r = 0; r < n; r++) {
+            const alc_cipher_aead_record_t& rec = p_rec[r];
+
+            Uint64 blocks    = rec.ar_len / Rijndael::cBlockSize;
+            Uint64 bulk_blks = blocks & ~3ULL;
+            int    remBytes  = rec.ar_len % Rijndael::cBlockSize;
+
+            gcm->m_gHash_128 = _mm_setzero_si128();
+            processAdditionalDataGcm(rec.ar_aad,
+                                     rec.ar_aad_len,
+                                     gcm->m_gHash_128,
+                                     gcm->m_hash_subKey_128,
+                                     reverse_mask_128);
+
+            if (bulk_blks) {
+                gcm->m_iv_128 = ctr[r];
+                bulk(reinterpret_cast<const __m512i*>(rec.ar_in),
+                     reinterpret_cast<__m512i*>(rec.ar_out),
+                     bulk_blks,
+                     isFirstUpdate);
+                isFirstUpdate = false;
+            }
+
+            Uint64         offset = bulk_blks * Rijndael::cBlockSize;
+            const Uint8*   p_in   = rec.ar_in + offset;
+            Uint8*         p_out  = rec.ar_out + offset;
+            const __m128i* p_ks   = ks + ks_idx[r] + 1;
+
+            for (Uint64 t = bulk_blks; t < blocks; t++) {
+                __m128i a1 = _mm_loadu_si128((const __m128i*)p_in);
+                __m128i b1 = _mm_xor_si128(a1, *p_ks++);
+                _mm_storeu_si128((__m128i*)p_out, b1);
+
+                gMulR(encrypt ? b1 : a1,
+                      gcm->m_hash_subKey_128,
+                      reverse_mask_128,
+                      gcm->m_gHash_128,
+                      const_factor_128);
+
+                p_in += Rijndael::cBlockSize;
+                p_out += Rijndael::cBlockSize;
+            }
+
+            if (remBytes) {
+                __m128i a1 = _mm_setzero_si128();
+                utils::CopyBytes((Uint8*)&a1, p_in, remBytes);
+
+                __m128i b1      = _mm_xor_si128(a1, *p_ks);
+                Uint8*  p_store = reinterpret_cast<Uint8*>(&b1);
+                for (int i = remBytes; i < 16; i++) {
+                    p_store[i] = 0;
+                }
+                utils::CopyBytes(p_out, p_store, remBytes);
+
+                gMulR(encrypt ? b1 : a1,
+                      gcm->m_hash_subKey_128,
+                      reverse_mask_128,
+                      gcm->m_gHash_128,
+                      const_factor_128);
+            }
+
+            // E(J0)
+            __m128i tag_128 = ks[ks_idx[r]];
+
+            err = GetTagGcm(rec.ar_tag_len,
+                            rec.ar_len,
+                            rec.ar_aad_len,
+                            gcm->m_gHash_128,
+                            tag_128,
+                            gcm->m_hash_subKey_128,
+                            reverse_mask_128,
+                            rec.ar_tag);
+            if (alcp_is_error(err)) {
+                return err;
+            }
+        }
+    }
+
+    return err;
+}
+
+} // namespace alcp::cipher::vaes512
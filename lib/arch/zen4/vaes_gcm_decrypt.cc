@@ -753,4 +753,130 @@ decryptGcm256(const Uint8* pInputText,  // ptr to inputText
     return err;
 }
 
+alc_error_t
+decryptGcmRecords128(const alc_cipher_aead_record_t* pRecords,
+                     Uint64                          count,
+                     const Uint8*                    pKey,
+                     int                             nRounds,
+                     alcp::cipher::GcmAuthData*      gcm,
+                     __m128i                         reverse_mask_128,
+                     Uint64*                         pHashSubkeyTable)
+{
+    constexpr Uint8 numBlksIn512bit = 4;
+
+    auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+    auto bulk = [&](const __m512i* p_in_512,
+                    __m512i*       p_out_512,
+                    Uint64         blocks,
+                    bool           isFirstUpdate) {
+        gcmBlk_512_dec<AesEncryptNoLoad_4x512Rounds10,
+                       AesEncryptNoLoad_2x512Rounds10,
+                       AesEncryptNoLoad_1x512Rounds10,
+                       alcp_load_key_zmm_10rounds,
+                       alcp_clear_keys_zmm_10rounds>(p_in_512,
+                                                     p_out_512,
+                                                     blocks,
+                                                     isFirstUpdate,
+                                                     pkey128,
+                                                     nullptr,
+                                                     nRounds,
+                                                     numBlksIn512bit,
+                                                     gcm,
+                                                     reverse_mask_128,
+                                                     0,
+                                                     pHashSubkeyTable);
+    };
+
+    return gcmRecords_512<AesEncryptNoLoad_4x512Rounds10,
+                          alcp_load_key_zmm_10rounds,
+                          alcp_clear_keys_zmm_10rounds,
+                          false>(
+        pRecords, count, pKey, nRounds, gcm, reverse_mask_128, bulk);
+}
+
+alc_error_t
+decryptGcmRecords192(const alc_cipher_aead_record_t* pRecords,
+                     Uint64                          count,
+                     const Uint8*                    pKey,
+                     int                             nRounds,
+                     alcp::cipher::GcmAuthData*      gcm,
+                     __m128i                         reverse_mask_128,
+                     Uint64*                         pHashSubkeyTable)
+{
+    constexpr Uint8 numBlksIn512bit = 4;
+
+    auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+    auto bulk = [&](const __m512i* p_in_512,
+                    __m512i*       p_out_512,
+                    Uint64         blocks,
+                    bool           isFirstUpdate) {
+        gcmBlk_512_dec<AesEncryptNoLoad_4x512Rounds12,
+                       AesEncryptNoLoad_2x512Rounds12,
+                       AesEncryptNoLoad_1x512Rounds12,
+                       alcp_load_key_zmm_12rounds,
+                       alcp_clear_keys_zmm_12rounds>(p_in_512,
+                                                     p_out_512,
+                                                     blocks,
+                                                     isFirstUpdate,
+                                                     pkey128,
+                                                     nullptr,
+                                                     nRounds,
+                                                     numBlksIn512bit,
+                                                     gcm,
+                                                     reverse_mask_128,
+                                                     0,
+                                                     pHashSubkeyTable);
+    };
+
+    return gcmRecords_512<AesEncryptNoLoad_4x512Rounds12,
+                          alcp_load_key_zmm_12rounds,
+                          alcp_clear_keys_zmm_12rounds,
+                          false>(
+        pRecords, count, pKey, nRounds, gcm, reverse_mask_128, bulk);
+}
+
+alc_error_t
+decryptGcmRecords256(const alc_cipher_aead_record_t* pRecords,
+                     Uint64                          count,
+                     const Uint8*                    pKey,
+                     int                             nRounds,
+                     alcp::cipher::GcmAuthData*      gcm,
+                     __m128i                         reverse_mask_128,
+                     Uint64*                         pHashSubkeyTable)
+{
+    constexpr Uint8 numBlksIn512bit = 4;
+
+    auto pkey128 = reinterpret_cast<const __m128i*>(pKey);
+
+    auto bulk = [&](const __m512i* p_in_512,
+                    __m512i*       p_out_512,
+                    Uint64         blocks,
+                    bool           isFirstUpdate) {
+        gcmBlk_512_dec<AesEncryptNoLoad_4x512Rounds14,
+                       AesEncryptNoLoad_2x512Rounds14,
+                       AesEncryptNoLoad_1x512Rounds14,
+                       alcp_load_key_zmm_14rounds,
+                       alcp_clear_keys_zmm_14rounds>(p_in_512,
+                                                     p_out_512,
+                                                     blocks,
+                                                     isFirstUpdate,
+                                                     pkey128,
+                                                     nullptr,
+                                                     nRounds,
+                                                     numBlksIn512bit,
+                                                     gcm,
+                                                     reverse_mask_128,
+                                                     0,
+                                                     pHashSubkeyTable);
+    };
+
+    return gcmRecords_512<AesEncryptNoLoad_4x512Rounds14,
+                          alcp_load_key_zmm_14rounds,
+                          alcp_clear_keys_zmm_14rounds,
+                          false>(
+        pRecords, count, pKey, nRounds, gcm, reverse_mask_128, bulk);
+}
+
 } // namespace alcp::cipher::vaes512
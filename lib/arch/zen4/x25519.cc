@@ -227,6 +227,300 @@ namespace alcp::ec { namespace zen4 {
         alcp::utils::CopyBytes(secret, (const void*)&out_512, 32);
     }
 
+    /*
+     * Eight independent ladders, one per 64 bit lane. A field element is
+     * five vectors, the i-th holding limb i of all eight lanes, in radix
+     * 2^51 with every limb below 2^52 so it can feed the IFMA multipliers.
+     */
+    namespace batch {
+        struct Fe8
+        {
+            __m512i l[5];
+        };
+
+        static inline void Carry(Fe8& r)
+        {
+            const __m512i mask = _mm512_set1_epi64(MaskRadix51bit);
+            __m512i       c[5];
+
+            for (int i = 0; i < 5; i++) {
+                c[i]   = _mm512_srli_epi64(r.l[i], 51);
+                r.l[i] = _mm512_and_si512(r.l[i], mask);
+            }
+            for (int i = 1; i < 5; i++) {
+                r.l[i] = _mm512_add_epi64(r.l[i], c[i - 1]);
+            }
+            c[4]   = _mm512_mullo_epi64(c[4], _mm512_set1_epi64(19));
+            r.l[0] = _mm512_add_epi64(r.l[0], c[4]);
+        }
+
+        static inline void Add(Fe8& r, const Fe8& a, const Fe8& b)
+        {
+            for (int i = 0; i < 5; i++) {
+                r.l[i] = _mm512_add_epi64(a.l[i], b.l[i]);
+            }
+            Carry(r);
+        }
+
+        // a - b + 2p, limbs of b stay below those of 2p
+        static inline void Sub(Fe8& r, const Fe8& a, const Fe8& b)
+        {
+            const __m512i p2_0 = _mm512_set1_epi64(0xfffffffffffda);
+            const __m512i p2_i = _mm512_set1_epi64(0xffffffffffffe);
+
+            for (int i = 0; i < 5; i++) {
+                r.l[i] = _mm512_add_epi64(a.l[i], i ? p2_i : p2_0);
+                r.l[i] = _mm512_sub_epi64(r.l[i], b.l[i]);
+            }
+            Carry(r);
+        }
+
+        /*
+         * Column k of a product is lo[k] + 2 * hi[k - 1], the high halves
+         * are taken at bit 52. Columns from 5 fold back times 19.
+         */
+        static inline void Reduce(Fe8&          r,
+                                  const __m512i lo[9],
+                                  const __m512i hi[9])
+        {
+            const __m512i mask = _mm512_set1_epi64(MaskRadix51bit);
+            const __m512i c19  = _mm512_set1_epi64(19);
+            __m512i       col[10];
+
+            col[0] = lo[0];
+            for (int k = 1; k < 9; k++) {
+                col[k] =
+                    _mm512_add_epi64(lo[k], _mm512_slli_epi64(hi[k - 1], 1));
+            }
+            col[9] = _mm512_slli_epi64(hi[8], 1);
+
+            for (int k = 0; k < 5; k++) {
+                r.l[k] = _mm512_add_epi64(
+                    col[k], _mm512_mullo_epi64(col[k + 5], c19));
+            }
+            for (int k = 0; k < 4; k++) {
+                r.l[k + 1] =
+                    _mm512_add_epi64(r.l[k + 1], _mm512_srli_epi64(r.l[k], 51));
+                r.l[k] = _mm512_and_si512(r.l[k], mask);
+            }
+            __m512i c = _mm512_srli_epi64(r.l[4], 51);
+            r.l[4]    = _mm512_and_si512(r.l[4], mask);
+            r.l[0]    = _mm512_add_epi64(r.l[0], _mm512_mullo_epi64(c, c19));
+            r.l[1] = _mm512_add_epi64(r.l[1], _mm512_srli_epi64(r.l[0], 51));
+            r.l[0] = _mm512_and_si512(r.l[0], mask);
+        }
+
+        static inline void Mul(Fe8& r, const Fe8& a, const Fe8& b)
+        {
+            __m512i lo[9], hi[9];
+
+            for (int k = 0; k < 9; k++) {
+                lo[k] = hi[k] = _mm512_setzero_si512();
+            }
+            for (int i = 0; i < 5; i++) {
+                for (int j = 0; j < 5; j++) {
+                    lo[i + j] =
+                        _mm512_madd52lo_epu64(lo[i + j], a.l[i], b.l[j]);
+                    hi[i + j] =
+                        _mm512_madd52hi_epu64(hi[i + j], a.l[i], b.l[j]);
+                }
+            }
+            Reduce(r, lo, hi);
+        }
+
+        static inline void Sqr(Fe8& r, const Fe8& a)
+        {
+            __m512i lo[9], hi[9];
+
+            for (int k = 0; k < 9; k++) {
+                lo[k] = hi[k] = _mm512_setzero_si512();
+            }
+            for (int i = 0; i < 5; i++) {
+                for (int j = i + 1; j < 5; j++) {
+                    lo[i + j] =
+                        _mm512_madd52lo_epu64(lo[i + j], a.l[i], a.l[j]);
+                    hi[i + j] =
+                        _mm512_madd52hi_epu64(hi[i + j], a.l[i], a.l[j]);
+                }
+            }
+            for (int k = 0; k < 9; k++) {
+                lo[k] = _mm512_add_epi64(lo[k], lo[k]);
+                hi[k] = _mm512_add_epi64(hi[k], hi[k]);
+            }
+            for (int i = 0; i < 5; i++) {
+                lo[2 * i] = _mm512_madd52lo_epu64(lo[2 * i], a.l[i], a.l[i]);
+                hi[2 * i] = _mm512_madd52hi_epu64(hi[2 * i], a.l[i], a.l[i]);
+            }
+            Reduce(r, lo, hi);
+        }
+
+        static inline void SqrN(Fe8& r, const Fe8& a, int count)
+        {
+            Sqr(r, a);
+            for (int i = 1; i < count; i++) {
+                Sqr(r, r);
+            }
+        }
+
+        // times (A - 2) / 4, limbs are left above 2^52 for an Add to carry
+        static inline void MulA24(Fe8& r, const Fe8& a)
+        {
+            const __m512i a24  = _mm512_set1_epi64(121665);
+            const __m512i zero = _mm512_setzero_si512();
+            __m512i       lo[5], hi[5];
+
+            for (int i = 0; i < 5; i++) {
+                lo[i] = _mm512_madd52lo_epu64(zero, a.l[i], a24);
+                hi[i] = _mm512_madd52hi_epu64(zero, a.l[i], a24);
+            }
+            r.l[0] = _mm512_add_epi64(
+                lo[0], _mm512_mullo_epi64(hi[4], _mm512_set1_epi64(38)));
+            for (int i = 1; i < 5; i++) {
+                r.l[i] =
+                    _mm512_add_epi64(lo[i], _mm512_slli_epi64(hi[i - 1], 1));
+            }
+        }
+
+        static inline void CSwap(Fe8& a, Fe8& b, __mmask8 swap)
+        {
+            for (int i = 0; i < 5; i++) {
+                __m512i t = _mm512_maskz_xor_epi64(swap, a.l[i], b.l[i]);
+                a.l[i]    = _mm512_xor_si512(a.l[i], t);
+                b.l[i]    = _mm512_xor_si512(b.l[i], t);
+            }
+        }
+
+        // z ^ (2^255 - 21), same chain as InverseX25519
+        static inline void Inverse(Fe8& r, const Fe8& z)
+        {
+            Fe8 a, b, c, d;
+
+            SqrN(a, z, 1);
+            SqrN(d, a, 2);
+            Mul(b, d, z);
+            Mul(a, b, a);
+            SqrN(d, a, 1);
+            Mul(b, d, b);
+            SqrN(d, b, 5);
+            Mul(b, d, b);
+            SqrN(d, b, 10);
+            Mul(c, d, b);
+            SqrN(d, c, 20);
+            Mul(d, d, c);
+            SqrN(d, d, 10);
+            Mul(b, d, b);
+            SqrN(d, b, 50);
+            Mul(c, d, b);
+            SqrN(d, c, 100);
+            Mul(d, d, c);
+            SqrN(d, d, 50);
+            Mul(d, d, b);
+            SqrN(d, d, 5);
+            Mul(r, d, a);
+        }
+
+        static inline Uint64 Load64(const Uint8* p)
+        {
+            Uint64 v;
+            alcp::utils::CopyBytes(&v, p, 8);
+            return v;
+        }
+
+        // bit 255 of the u-coordinate is masked, RFC 7748 5
+        static inline void Load(Fe8& r, const Uint8* pPoints)
+        {
+            alignas(64) Uint64 limbs[5][8];
+
+            for (int lane = 0; lane < 8; lane++) {
+                const Uint8* p = pPoints + 32 * lane;
+
+                limbs[0][lane] = Load64(p) & MaskRadix51bit;
+                limbs[1][lane] = (Load64(p + 6) >> 3) & MaskRadix51bit;
+                limbs[2][lane] = (Load64(p + 12) >> 6) & MaskRadix51bit;
+                limbs[3][lane] = (Load64(p + 19) >> 1) & MaskRadix51bit;
+                limbs[4][lane] = (Load64(p + 24) >> 12) & MaskRadix51bit;
+            }
+            for (int i = 0; i < 5; i++) {
+                r.l[i] = _mm512_load_si512(limbs[i]);
+            }
+        }
+
+        static inline void Store(Uint8* pOut, const Fe8& a)
+        {
+            alignas(64) Uint64 limbs[5][8];
+            Uint64             lane_limbs[5], out[4];
+
+            for (int i = 0; i < 5; i++) {
+                _mm512_store_si512(limbs[i], a.l[i]);
+            }
+            for (int lane = 0; lane < 8; lane++) {
+                for (int i = 0; i < 5; i++) {
+                    lane_limbs[i] = limbs[i][lane];
+                }
+                RadixToBytes(reinterpret_cast<Uint8*>(out), lane_limbs);
+                alcp::utils::CopyBytes(pOut + 32 * lane, out, 32);
+            }
+        }
+    } // namespace batch
+
+    void alcpScalarMulX25519Radix51BitX8(Uint8*       pSecrets,
+                                         const Uint8* pScalars,
+                                         const Uint8* pPoints)
+    {
+        using namespace batch;
+
+        Fe8 x1, x2, z2, x3, z3;
+        Fe8 a, b, c, d, aa, bb, da, cb, e, t;
+
+        Load(x1, pPoints);
+        x3 = x1;
+        for (int i = 0; i < 5; i++) {
+            x2.l[i] = z3.l[i] = z2.l[i] = _mm512_setzero_si512();
+        }
+        x2.l[0] = z3.l[0] = _mm512_set1_epi64(1);
+
+        // bit 255 of a clamped scalar is clear
+        __mmask8 swap = 0;
+        for (int pos = 254; pos >= 0; pos--) {
+            __mmask8 bits = 0;
+            for (int lane = 0; lane < 8; lane++) {
+                Uint8 byte = pScalars[32 * lane + pos / 8];
+                bits |= ((byte >> (pos % 8)) & 1) << lane;
+            }
+            swap ^= bits;
+            CSwap(x2, x3, swap);
+            CSwap(z2, z3, swap);
+            swap = bits;
+
+            Add(a, x2, z2);
+            Sub(b, x2, z2);
+            Add(c, x3, z3);
+            Sub(d, x3, z3);
+            Sqr(aa, a);
+            Sqr(bb, b);
+            Mul(da, d, a);
+            Mul(cb, c, b);
+
+            Add(t, da, cb);
+            Sqr(x3, t);
+            Sub(t, da, cb);
+            Sqr(t, t);
+            Mul(z3, x1, t);
+
+            Mul(x2, aa, bb);
+            Sub(e, aa, bb);
+            MulA24(t, e);
+            Add(t, t, aa);
+            Mul(z2, e, t);
+        }
+        CSwap(x2, x3, swap);
+        CSwap(z2, z3, swap);
+
+        Inverse(t, z2);
+        Mul(x2, x2, t);
+        Store(pSecrets, x2);
+    }
+
 #if 0
     namespace experimentalParallel {
         static void MontCore(__m512i*      x2,
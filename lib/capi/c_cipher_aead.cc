@@ -36,6 +36,30 @@
 
 using namespace alcp;
 
+static alc_error_t
+__aead_records_check(const alc_cipher_aead_record_t* pRecords, Uint64 count)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    for (Uint64 i = 0; i < count; i++) {
+        const alc_cipher_aead_record_t& rec = pRecords[i];
+
+        ALCP_BAD_PTR_ERR_RET(rec.ar_iv, err);
+        ALCP_ZERO_LEN_ERR_RET(rec.ar_iv_len, err);
+        ALCP_BAD_PTR_ERR_RET(rec.ar_tag, err);
+        ALCP_ZERO_LEN_ERR_RET(rec.ar_tag_len, err);
+        if (rec.ar_aad_len != 0) {
+            ALCP_BAD_PTR_ERR_RET(rec.ar_aad, err);
+        }
+        if (rec.ar_len != 0) {
+            ALCP_BAD_PTR_ERR_RET(rec.ar_in, err);
+            ALCP_BAD_PTR_ERR_RET(rec.ar_out, err);
+        }
+    }
+
+    return err;
+}
+
 EXTERN_C_BEGIN
 
 alc_error_t
@@ -182,6 +206,60 @@ alcp_cipher_aead_decrypt_update(const alc_cipher_handle_p pCipherHandle,
     return err;
 }
 
+alc_error_t
+alcp_cipher_aead_encrypt_records(const alc_cipher_handle_p       pCipherHandle,
+                                 const alc_cipher_aead_record_t* pRecords,
+                                 Uint64                          count)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+    ALCP_BAD_PTR_ERR_RET(pRecords, err);
+
+    auto ctx = static_cast<cipher::Context*>(pCipherHandle->ch_context);
+
+    if (ctx->encryptRecords == nullptr) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    err = __aead_records_check(pRecords, count);
+    if (alcp_is_error(err)) {
+        return err;
+    }
+
+    err = ctx->encryptRecords(ctx->m_cipher, pRecords, count);
+
+    return err;
+}
+
+alc_error_t
+alcp_cipher_aead_decrypt_records(const alc_cipher_handle_p       pCipherHandle,
+                                 const alc_cipher_aead_record_t* pRecords,
+                                 Uint64                          count)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pCipherHandle->ch_context, err);
+    ALCP_BAD_PTR_ERR_RET(pRecords, err);
+
+    auto ctx = static_cast<cipher::Context*>(pCipherHandle->ch_context);
+
+    if (ctx->decryptRecords == nullptr) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    err = __aead_records_check(pRecords, count);
+    if (alcp_is_error(err)) {
+        return err;
+    }
+
+    err = ctx->decryptRecords(ctx->m_cipher, pRecords, count);
+
+    return err;
+}
+
 alc_error_t
 alcp_cipher_aead_set_iv(const alc_cipher_handle_p pCipherHandle,
                         Uint64                    len,
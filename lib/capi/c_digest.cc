@@ -31,6 +31,7 @@
 #include "alcp/alcp.hh"
 #include "alcp/capi/digest/builder.hh"
 #include "alcp/capi/digest/ctx.hh"
+#include "alcp/digest/sha_mb.hh"
 
 using namespace alcp;
 
@@ -73,6 +74,27 @@ alcp_digest_request(const alc_digest_info_p pDigestInfo,
     return err;
 }
 
+alc_error_t
+alcp_digest_context_copy(const alc_digest_handle_p pSrcHandle,
+                         alc_digest_handle_p       pDestHandle)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pSrcHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pSrcHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pDestHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pDestHandle->context, err);
+
+    auto src_ctx = static_cast<digest::Context*>(pSrcHandle->context);
+    auto ctx     = static_cast<digest::Context*>(pDestHandle->context);
+
+    new (ctx) digest::Context(*src_ctx);
+
+    err = src_ctx->duplicate(*src_ctx, *ctx);
+
+    return err;
+}
+
 alc_error_t
 alcp_digest_update(const alc_digest_handle_p pDigestHandle,
                    const Uint8*              pMsgBuf,
@@ -91,6 +113,105 @@ alcp_digest_update(const alc_digest_handle_p pDigestHandle,
     return err;
 }
 
+alc_error_t
+alcp_digest_update_multi(const alc_digest_handle_p pDigestHandles[],
+                         const Uint8* const        pMsgBufs[],
+                         const Uint64              sizes[],
+                         Uint64                    num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pDigestHandles, err);
+    ALCP_BAD_PTR_ERR_RET(pMsgBufs, err);
+    ALCP_BAD_PTR_ERR_RET(sizes, err);
+
+    // An empty message may come without a buffer
+    for (Uint64 i = 0; i < num; i++) {
+        ALCP_BAD_PTR_ERR_RET(pDigestHandles[i], err);
+        ALCP_BAD_PTR_ERR_RET(pDigestHandles[i]->context, err);
+        if (sizes[i] != 0) {
+            ALCP_BAD_PTR_ERR_RET(pMsgBufs[i], err);
+        }
+    }
+
+    static const Uint8 cEmpty[1] = {};
+    void*              digests[digest::cMultiBufferBatch];
+    const Uint8*       bufs[digest::cMultiBufferBatch];
+
+    /*
+     * Runs of handles sharing a multi-buffer path are passed down together,
+     * anything else is updated one at a time
+     */
+    Uint64 i = 0;
+    while (i < num && !err) {
+        auto ctx = static_cast<digest::Context*>(pDigestHandles[i]->context);
+
+        if (ctx->updateMulti == nullptr) {
+            err = ctx->update(
+                ctx->m_digest, pMsgBufs[i] ? pMsgBufs[i] : cEmpty, sizes[i]);
+            i++;
+            continue;
+        }
+
+        Uint64 count = 0;
+        while (i + count < num && count < digest::cMultiBufferBatch) {
+            auto next_ctx = static_cast<digest::Context*>(
+                pDigestHandles[i + count]->context);
+            if (next_ctx->updateMulti != ctx->updateMulti) {
+                break;
+            }
+            digests[count] = next_ctx->m_digest;
+            bufs[count]    = pMsgBufs[i + count] ? pMsgBufs[i + count] : cEmpty;
+            count++;
+        }
+
+        err = ctx->updateMulti(digests, bufs, sizes + i, count);
+        i += count;
+    }
+
+    return err;
+}
+
+alc_error_t
+alcp_digest_finalize_multi(const alc_digest_handle_p pDigestHandles[],
+                           Uint64                    num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pDigestHandles, err);
+
+    for (Uint64 i = 0; i < num; i++) {
+        ALCP_BAD_PTR_ERR_RET(pDigestHandles[i], err);
+        ALCP_BAD_PTR_ERR_RET(pDigestHandles[i]->context, err);
+    }
+
+    void* digests[digest::cMultiBufferBatch];
+
+    Uint64 i = 0;
+    while (i < num && !err) {
+        auto ctx = static_cast<digest::Context*>(pDigestHandles[i]->context);
+
+        if (ctx->finalizeMulti == nullptr) {
+            err = ctx->finalize(ctx->m_digest, nullptr, 0);
+            i++;
+            continue;
+        }
+
+        Uint64 count = 0;
+        while (i + count < num && count < digest::cMultiBufferBatch) {
+            auto next_ctx = static_cast<digest::Context*>(
+                pDigestHandles[i + count]->context);
+            if (next_ctx->finalizeMulti != ctx->finalizeMulti) {
+                break;
+            }
+            digests[count++] = next_ctx->m_digest;
+        }
+
+        err = ctx->finalizeMulti(digests, count);
+        i += count;
+    }
+
+    return err;
+}
+
 alc_error_t
 alcp_digest_finalize(const alc_digest_handle_p pDigestHandle,
                      const Uint8*              pMsgBuf,
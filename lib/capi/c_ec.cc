@@ -50,12 +50,28 @@ alcp_ec_supported(const alc_ec_info_p pEcInfo)
 {
     alc_error_t err = ALC_ERROR_NONE;
 
-    if (pEcInfo->ecCurveId != ALCP_EC_CURVE25519) {
-        return ALC_ERROR_NOT_SUPPORTED;
-    }
-
-    if (pEcInfo->ecCurveType != ALCP_EC_CURVE_TYPE_MONTGOMERY) {
-        return ALC_ERROR_NOT_SUPPORTED;
+    switch (pEcInfo->ecCurveId) {
+        case ALCP_EC_CURVE25519:
+            if (pEcInfo->ecCurveType != ALCP_EC_CURVE_TYPE_MONTGOMERY) {
+                return ALC_ERROR_NOT_SUPPORTED;
+            }
+            break;
+        case ALCP_EC_SECP256R1:
+        case ALCP_EC_SECP384R1:
+        case ALCP_EC_SECP521R1:
+            if (pEcInfo->ecCurveType != ALCP_EC_CURVE_TYPE_SHORT_WEIERSTRASS) {
+                return ALC_ERROR_NOT_SUPPORTED;
+            }
+            break;
+        case ALCP_EC_ED25519:
+            // the 32 byte RFC 8032 encoding, y and the sign of x
+            if (pEcInfo->ecCurveType != ALCP_EC_CURVE_TYPE_TWISTED_EDWARDS
+                || pEcInfo->ecPointFormat != ALCP_EC_POINT_FORMAT_COMPRESSED) {
+                return ALC_ERROR_NOT_SUPPORTED;
+            }
+            return err;
+        default:
+            return ALC_ERROR_NOT_SUPPORTED;
     }
 
     if (pEcInfo->ecPointFormat != ALCP_EC_POINT_FORMAT_UNCOMPRESSED) {
@@ -135,12 +151,127 @@ alcp_ec_get_secretkey(const alc_ec_handle_p pEcHandle,
 
     auto ctx = static_cast<ec::Context*>(pEcHandle->context);
 
+    // Ed25519 has no key agreement
+    if (ctx->getSecretKey == nullptr) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
     ctx->status =
         ctx->getSecretKey(ctx->m_ec, pSecretKey, pPublicKey, pKeyLength);
 
     return ctx->status.ok() ? err : ALC_ERROR_GENERIC;
 }
 
+alc_error_t
+alcp_ec_get_secretkey_batch(const alc_ec_handle_p pEcHandle,
+                            Uint8*                pSecretKeys,
+                            const Uint8*          pPrivKeys,
+                            const Uint8*          pPublicKeys,
+                            Uint64                count)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pEcHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pEcHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pSecretKeys, err);
+    ALCP_BAD_PTR_ERR_RET(pPrivKeys, err);
+    ALCP_BAD_PTR_ERR_RET(pPublicKeys, err);
+
+    auto ctx = static_cast<ec::Context*>(pEcHandle->context);
+
+    if (ctx->getSecretKeyBatch == nullptr) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    ctx->status = ctx->getSecretKeyBatch(
+        ctx->m_ec, pSecretKeys, pPrivKeys, pPublicKeys, count);
+
+    return ctx->status.ok() ? err : ALC_ERROR_GENERIC;
+}
+
+alc_error_t
+alcp_ec_sign(const alc_ec_handle_p pEcHandle,
+             const Uint8*          pDigest,
+             Uint64                digestSize,
+             Uint8*                pSignature)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pEcHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pEcHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pDigest, err);
+    ALCP_BAD_PTR_ERR_RET(pSignature, err);
+
+    auto ctx = static_cast<ec::Context*>(pEcHandle->context);
+
+    // Montgomery curves have no signature scheme
+    if (ctx->sign == nullptr) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    ctx->status = ctx->sign(ctx->m_ec, pDigest, digestSize, pSignature);
+
+    return ctx->status.ok() ? err : ALC_ERROR_GENERIC;
+}
+
+alc_error_t
+alcp_ec_verify(const alc_ec_handle_p pEcHandle,
+               const Uint8*          pDigest,
+               Uint64                digestSize,
+               const Uint8*          pSignature,
+               const Uint8*          pPublicKey)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pEcHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pEcHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pDigest, err);
+    ALCP_BAD_PTR_ERR_RET(pSignature, err);
+    ALCP_BAD_PTR_ERR_RET(pPublicKey, err);
+
+    auto ctx = static_cast<ec::Context*>(pEcHandle->context);
+
+    if (ctx->verify == nullptr) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    ctx->status = ctx->verify(
+        ctx->m_ec, pDigest, digestSize, pSignature, pPublicKey);
+
+    return ctx->status.ok() ? err : ALC_ERROR_GENERIC;
+}
+
+alc_error_t
+alcp_ec_verify_batch(const alc_ec_handle_p pEcHandle,
+                     const Uint8* const    pMessages[],
+                     const Uint64          pMessageSizes[],
+                     const Uint8* const    pSignatures[],
+                     const Uint8* const    pPublicKeys[],
+                     Uint64                count,
+                     bool                  pValid[])
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pEcHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pEcHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pMessages, err);
+    ALCP_BAD_PTR_ERR_RET(pMessageSizes, err);
+    ALCP_BAD_PTR_ERR_RET(pSignatures, err);
+    ALCP_BAD_PTR_ERR_RET(pPublicKeys, err);
+
+    auto ctx = static_cast<ec::Context*>(pEcHandle->context);
+
+    if (ctx->verifyBatch == nullptr) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    ctx->status = ctx->verifyBatch(ctx->m_ec,
+                                   pMessages,
+                                   pMessageSizes,
+                                   pSignatures,
+                                   pPublicKeys,
+                                   count,
+                                   pValid);
+
+    return ctx->status.ok() ? err : ALC_ERROR_GENERIC;
+}
+
 void
 alcp_ec_finish(const alc_ec_handle_p pEcHandle)
 {
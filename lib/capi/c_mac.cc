@@ -86,6 +86,35 @@ alcp_mac_request(alc_mac_handle_p pMacHandle, const alc_mac_info_p pcMacInfo)
     return err;
 }
 
+alc_error_t
+alcp_mac_context_copy(const alc_mac_handle_p pSrcMacHandle,
+                      alc_mac_handle_p       pDestMacHandle)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    ALCP_BAD_PTR_ERR_RET(pSrcMacHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pSrcMacHandle->ch_context, err);
+    ALCP_BAD_PTR_ERR_RET(pDestMacHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pDestMacHandle->ch_context, err);
+
+    auto p_src_ctx = static_cast<mac::Context*>(pSrcMacHandle->ch_context);
+    if (p_src_ctx->duplicate == nullptr) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+
+    auto p_ctx = static_cast<mac::Context*>(pDestMacHandle->ch_context);
+    new (p_ctx) mac::Context(*p_src_ctx);
+    p_ctx->status = p_src_ctx->duplicate(*p_src_ctx, *p_ctx);
+
+    // TODO: Convert status to proper alc_error_t code and return
+    if (!p_ctx->status.ok()) {
+        err = ALC_ERROR_EXISTS;
+    } else {
+        err = ALC_ERROR_NONE;
+    }
+    return err;
+}
+
 alc_error_t
 alcp_mac_update(alc_mac_handle_p pMacHandle, const Uint8* buff, Uint64 size)
 {
@@ -38,8 +38,22 @@
 #include "alcp/rsa.h"
 #include "alcp/rsa/rsaerror.hh"
 
+#include <atomic>
+#include <vector>
+
 using namespace alcp;
 
+/*
+ * Handles set to a key take their own reference to its data, the count here
+ * only tracks the owners of the alc_rsa_key_t itself
+ */
+struct _alc_rsa_key
+{
+    std::shared_ptr<rsa::RsaPublicKeyData>  m_pub;
+    std::shared_ptr<rsa::RsaPrivateKeyData> m_priv;
+    std::atomic<Uint64>                     m_refs{ 1 };
+};
+
 EXTERN_C_BEGIN
 
 Uint64
@@ -57,7 +71,8 @@ alcp_rsa_request(const alc_rsa_key_size keySize, alc_rsa_handle_p pRsaHandle)
     ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
     ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
 
-    if (keySize != KEY_SIZE_1024 && keySize != KEY_SIZE_2048) {
+    if (keySize != KEY_SIZE_1024 && keySize != KEY_SIZE_2048
+        && keySize != KEY_SIZE_3072 && keySize != KEY_SIZE_4096) {
         return ALC_ERROR_NOT_SUPPORTED;
     }
 
@@ -178,13 +193,102 @@ fetch_digest(const alc_digest_info_t& digestInfo)
     return digest;
 }
 
+// SHA2-256 is used for the digests the application did not add
+static void
+set_default_digests(rsa::Context* ctx)
+{
+    if (!ctx->m_digest) {
+        ctx->m_digest = new alcp::digest::Sha256;
+        ctx->setDigest(ctx->m_rsa,
+                       static_cast<digest::IDigest*>(ctx->m_digest));
+    }
+
+    if (!ctx->m_mgf) {
+        ctx->m_mgf = new alcp::digest::Sha256;
+        ctx->setMgf(ctx->m_rsa, static_cast<digest::IDigest*>(ctx->m_mgf));
+    }
+}
+
+static alc_error_t
+to_alc_error(const Status& status)
+{
+    if (status.ok()) {
+        return ALC_ERROR_NONE;
+    }
+    // fetching the module error
+    Uint16 module_error = (status.code() >> 16) & 0xff;
+    return (alcp::rsa::ErrorCode::eNotPermitted == module_error)
+               ? ALC_ERROR_NOT_PERMITTED
+               : ALC_ERROR_GENERIC;
+}
+
+// Collects the objects behind a batch of handles, all of one key size
+static alc_error_t
+batch_objects(const alc_rsa_handle_p pRsaHandle[],
+              Uint64                 num,
+              bool                   digests,
+              std::vector<void*>&    objects)
+{
+    alc_error_t err      = ALC_ERROR_NONE;
+    Uint64      key_size = 0;
+
+    objects.resize(num);
+    for (Uint64 i = 0; i < num; i++) {
+        ALCP_BAD_PTR_ERR_RET(pRsaHandle[i], err);
+        ALCP_BAD_PTR_ERR_RET(pRsaHandle[i]->context, err);
+
+        auto ctx = static_cast<rsa::Context*>(pRsaHandle[i]->context);
+        if (i == 0) {
+            key_size = ctx->getKeySize(ctx->m_rsa);
+        } else if (ctx->getKeySize(ctx->m_rsa) != key_size) {
+            return ALC_ERROR_NOT_PERMITTED;
+        }
+        if (digests) {
+            set_default_digests(ctx);
+        }
+        objects[i] = ctx->m_rsa;
+    }
+    return err;
+}
+
 alc_error_t
-alcp_rsa_add_digest_oaep(const alc_rsa_handle_p  pRsaHandle,
-                         const alc_digest_info_p digestInfo)
+alcp_rsa_publickey_encrypt_batch(const alc_rsa_handle_p pRsaHandle[],
+                                 const Uint8* const     pText[],
+                                 Uint64                 textSize,
+                                 Uint8* const           pEncText[],
+                                 Uint64                 num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pText, err);
+    ALCP_BAD_PTR_ERR_RET(pEncText, err);
+
+    if (num == 0) {
+        return err;
+    }
+
+    std::vector<void*> objects;
+    err = batch_objects(pRsaHandle, num, false, objects);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle[0]->context);
+
+    ctx->status = ctx->encryptPublicBatchFn(
+        objects.data(), pText, textSize, pEncText, num);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
+alc_error_t
+alcp_rsa_add_digest(const alc_rsa_handle_p  pRsaHandle,
+                    const alc_digest_info_p digestInfo)
 {
     alc_error_t err = ALC_ERROR_NONE;
     ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
     ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(digestInfo, err);
 
     auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
 
@@ -194,15 +298,32 @@ alcp_rsa_add_digest_oaep(const alc_rsa_handle_p  pRsaHandle,
     }
 
     ctx->m_digest = fetch_digest(*digestInfo);
+    if (ctx->m_digest == nullptr) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
 
     ctx->setDigest(ctx->m_rsa, static_cast<digest::IDigest*>(ctx->m_digest));
 
     return err;
 }
 
+alc_error_t
+alcp_rsa_add_digest_oaep(const alc_rsa_handle_p  pRsaHandle,
+                         const alc_digest_info_p digestInfo)
+{
+    return alcp_rsa_add_digest(pRsaHandle, digestInfo);
+}
+
 alc_error_t
 alcp_rsa_add_mgf_oaep(const alc_rsa_handle_p  pRsaHandle,
                       const alc_digest_info_p digestInfo)
+{
+    return alcp_rsa_add_mgf(pRsaHandle, digestInfo);
+}
+
+alc_error_t
+alcp_rsa_add_mgf(const alc_rsa_handle_p  pRsaHandle,
+                 const alc_digest_info_p digestInfo)
 {
     using alcp::digest::IDigest;
     alc_error_t err = ALC_ERROR_NONE;
@@ -248,16 +369,7 @@ alcp_rsa_publickey_encrypt_oaep(const alc_rsa_handle_p pRsaHandle,
 
     auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
 
-    if (!ctx->m_digest) {
-        ctx->m_digest = new alcp::digest::Sha256;
-        ctx->setDigest(ctx->m_rsa,
-                       static_cast<digest::IDigest*>(ctx->m_digest));
-    }
-
-    if (!ctx->m_mgf) {
-        ctx->m_mgf = new alcp::digest::Sha256;
-        ctx->setMgf(ctx->m_rsa, static_cast<digest::IDigest*>(ctx->m_mgf));
-    }
+    set_default_digests(ctx);
 
     ctx->status = ctx->encryptPublicOaepFn(
         ctx->m_rsa, pText, textSize, label, labelSize, pSeed, pEncText);
@@ -309,6 +421,235 @@ alcp_rsa_privatekey_decrypt_oaep(const alc_rsa_handle_p pRsaHandle,
     }
 }
 
+alc_error_t
+alcp_rsa_privatekey_sign_pkcs1v15(const alc_rsa_handle_p pRsaHandle,
+                                  bool                   check,
+                                  const Uint8*           pText,
+                                  Uint64                 textSize,
+                                  Uint8*                 pSignText)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pSignText, err);
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
+
+    set_default_digests(ctx);
+
+    ctx->status =
+        ctx->signPkcs1v15Fn(ctx->m_rsa, check, pText, textSize, pSignText);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
+alc_error_t
+alcp_rsa_privatekey_decrypt_batch(const alc_rsa_handle_p pRsaHandle,
+                                  const Uint8* const     pEncText[],
+                                  Uint64                 encSize,
+                                  Uint8* const           pText[],
+                                  Uint64                 num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pEncText, err);
+    ALCP_BAD_PTR_ERR_RET(pText, err);
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
+
+    ctx->status =
+        ctx->decryptPrivateBatchFn(ctx->m_rsa, pEncText, encSize, pText, num);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
+alc_error_t
+alcp_rsa_privatekey_sign_pkcs1v15_batch(const alc_rsa_handle_p pRsaHandle,
+                                        bool                   check,
+                                        const Uint8* const     pText[],
+                                        const Uint64           textSize[],
+                                        Uint8* const           pSignText[],
+                                        Uint64                 num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pText, err);
+    ALCP_BAD_PTR_ERR_RET(textSize, err);
+    ALCP_BAD_PTR_ERR_RET(pSignText, err);
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
+
+    set_default_digests(ctx);
+
+    ctx->status = ctx->signPkcs1v15BatchFn(
+        ctx->m_rsa, check, pText, textSize, pSignText, num);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
+alc_error_t
+alcp_rsa_publickey_verify_pkcs1v15(const alc_rsa_handle_p pRsaHandle,
+                                   const Uint8*           pText,
+                                   Uint64                 textSize,
+                                   const Uint8*           pSignText)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pSignText, err);
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
+
+    set_default_digests(ctx);
+
+    ctx->status = ctx->verifyPkcs1v15Fn(ctx->m_rsa, pText, textSize, pSignText);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
+alc_error_t
+alcp_rsa_publickey_verify_pkcs1v15_batch(const alc_rsa_handle_p pRsaHandle[],
+                                         const Uint8* const     pText[],
+                                         const Uint64           textSize[],
+                                         const Uint8* const     pSignText[],
+                                         bool                   pValid[],
+                                         Uint64                 num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pSignText, err);
+    ALCP_BAD_PTR_ERR_RET(pValid, err);
+
+    if (num == 0) {
+        return err;
+    }
+
+    std::vector<void*> objects;
+    err = batch_objects(pRsaHandle, num, true, objects);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle[0]->context);
+
+    ctx->status = ctx->verifyPkcs1v15BatchFn(
+        objects.data(), pText, textSize, pSignText, pValid, num);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
+alc_error_t
+alcp_rsa_privatekey_sign_pss(const alc_rsa_handle_p pRsaHandle,
+                             bool                   check,
+                             const Uint8*           pText,
+                             Uint64                 textSize,
+                             const Uint8*           salt,
+                             Uint64                 saltSize,
+                             Uint8*                 pSignText)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pSignText, err);
+
+    if (salt == nullptr && saltSize > 0) {
+        return ALC_ERROR_NOT_PERMITTED;
+    }
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
+
+    set_default_digests(ctx);
+
+    ctx->status = ctx->signPssFn(
+        ctx->m_rsa, check, pText, textSize, salt, saltSize, pSignText);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
+alc_error_t
+alcp_rsa_privatekey_sign_pss_batch(const alc_rsa_handle_p pRsaHandle,
+                                   bool                   check,
+                                   const Uint8* const     pText[],
+                                   const Uint64           textSize[],
+                                   const Uint8* const     salt[],
+                                   Uint64                 saltSize,
+                                   Uint8* const           pSignText[],
+                                   Uint64                 num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pText, err);
+    ALCP_BAD_PTR_ERR_RET(textSize, err);
+    ALCP_BAD_PTR_ERR_RET(pSignText, err);
+
+    if (salt == nullptr && saltSize > 0) {
+        return ALC_ERROR_NOT_PERMITTED;
+    }
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
+
+    set_default_digests(ctx);
+
+    ctx->status = ctx->signPssBatchFn(
+        ctx->m_rsa, check, pText, textSize, salt, saltSize, pSignText, num);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
+alc_error_t
+alcp_rsa_publickey_verify_pss(const alc_rsa_handle_p pRsaHandle,
+                              const Uint8*           pText,
+                              Uint64                 textSize,
+                              const Uint8*           pSignText)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pSignText, err);
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
+
+    set_default_digests(ctx);
+
+    ctx->status = ctx->verifyPssFn(ctx->m_rsa, pText, textSize, pSignText);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
+alc_error_t
+alcp_rsa_publickey_verify_pss_batch(const alc_rsa_handle_p pRsaHandle[],
+                                    const Uint8* const     pText[],
+                                    const Uint64           textSize[],
+                                    const Uint8* const     pSignText[],
+                                    bool                   pValid[],
+                                    Uint64                 num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pSignText, err);
+    ALCP_BAD_PTR_ERR_RET(pValid, err);
+
+    if (num == 0) {
+        return err;
+    }
+
+    std::vector<void*> objects;
+    err = batch_objects(pRsaHandle, num, true, objects);
+    if (err != ALC_ERROR_NONE) {
+        return err;
+    }
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle[0]->context);
+
+    ctx->status = ctx->verifyPssBatchFn(
+        objects.data(), pText, textSize, pSignText, pValid, num);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
 Uint64
 alcp_rsa_get_key_size(const alc_rsa_handle_p pRsaHandle)
 {
@@ -390,6 +731,176 @@ alcp_rsa_set_privatekey(const alc_rsa_handle_p pRsaHandle,
     return ctx->status.ok() ? err : ALC_ERROR_GENERIC;
 }
 
+alc_error_t
+alcp_rsa_key_create_public(const alc_rsa_key_size keySize,
+                           Uint64                 exponent,
+                           const Uint8*           pModulus,
+                           Uint64                 size,
+                           alc_rsa_key_p*         ppKey)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pModulus, err);
+    ALCP_BAD_PTR_ERR_RET(ppKey, err);
+
+    std::shared_ptr<rsa::RsaPublicKeyData> pub;
+
+    Status status =
+        rsa::RsaBuilder::BuildPublicKey(keySize, exponent, pModulus, size, pub);
+    if (!status.ok()) {
+        return to_alc_error(status);
+    }
+
+    auto key   = new alc_rsa_key_t;
+    key->m_pub = std::move(pub);
+    *ppKey     = key;
+
+    return err;
+}
+
+alc_error_t
+alcp_rsa_key_create_private(const alc_rsa_key_size keySize,
+                            Uint64                 exponent,
+                            const Uint8*           dp,
+                            const Uint8*           dq,
+                            const Uint8*           p,
+                            const Uint8*           q,
+                            const Uint8*           qinv,
+                            const Uint8*           mod,
+                            Uint64                 size,
+                            alc_rsa_key_p*         ppKey)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(dp, err);
+    ALCP_BAD_PTR_ERR_RET(dq, err);
+    ALCP_BAD_PTR_ERR_RET(p, err);
+    ALCP_BAD_PTR_ERR_RET(q, err);
+    ALCP_BAD_PTR_ERR_RET(qinv, err);
+    ALCP_BAD_PTR_ERR_RET(mod, err);
+    ALCP_BAD_PTR_ERR_RET(ppKey, err);
+    ALCP_ZERO_LEN_ERR_RET(size, err);
+
+    std::shared_ptr<rsa::RsaPublicKeyData>  pub;
+    std::shared_ptr<rsa::RsaPrivateKeyData> priv;
+
+    // the modulus is twice the size of p
+    Status status =
+        rsa::RsaBuilder::BuildPublicKey(keySize, exponent, mod, size * 2, pub);
+    if (!status.ok()) {
+        return to_alc_error(status);
+    }
+
+    status = rsa::RsaBuilder::BuildPrivateKey(
+        keySize, dp, dq, p, q, qinv, mod, size, priv);
+    if (!status.ok()) {
+        return to_alc_error(status);
+    }
+
+    auto key    = new alc_rsa_key_t;
+    key->m_pub  = std::move(pub);
+    key->m_priv = std::move(priv);
+    *ppKey      = key;
+
+    return err;
+}
+
+alc_error_t
+alcp_rsa_key_generate(const alc_rsa_key_size keySize,
+                      Uint64                 exponent,
+                      alc_rsa_key_p*         ppKey)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(ppKey, err);
+
+    std::shared_ptr<rsa::RsaPublicKeyData>  pub;
+    std::shared_ptr<rsa::RsaPrivateKeyData> priv;
+
+    Status status =
+        rsa::RsaBuilder::GenerateKey(keySize, exponent, pub, priv);
+    if (!status.ok()) {
+        return to_alc_error(status);
+    }
+
+    auto key    = new alc_rsa_key_t;
+    key->m_pub  = std::move(pub);
+    key->m_priv = std::move(priv);
+    *ppKey      = key;
+
+    return err;
+}
+
+alc_error_t
+alcp_rsa_key_get_privatekey(const alc_rsa_key_p pKey,
+                            Uint64*             pExponent,
+                            Uint8*              dp,
+                            Uint8*              dq,
+                            Uint8*              p,
+                            Uint8*              q,
+                            Uint8*              qinv,
+                            Uint8*              mod,
+                            Uint64              size)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pKey, err);
+    ALCP_BAD_PTR_ERR_RET(pKey->m_pub, err);
+    ALCP_BAD_PTR_ERR_RET(pKey->m_priv, err);
+    ALCP_BAD_PTR_ERR_RET(pExponent, err);
+    ALCP_BAD_PTR_ERR_RET(dp, err);
+    ALCP_BAD_PTR_ERR_RET(dq, err);
+    ALCP_BAD_PTR_ERR_RET(p, err);
+    ALCP_BAD_PTR_ERR_RET(q, err);
+    ALCP_BAD_PTR_ERR_RET(qinv, err);
+    ALCP_BAD_PTR_ERR_RET(mod, err);
+
+    auto& priv = pKey->m_priv->m_key;
+    if (size != priv.m_size * 8) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+
+    *pExponent = pKey->m_pub->m_key.m_public_exponent;
+    rsa::BigNumToBytes(dp, priv.m_dp.get(), size);
+    rsa::BigNumToBytes(dq, priv.m_dq.get(), size);
+    rsa::BigNumToBytes(p, priv.m_p.get(), size);
+    rsa::BigNumToBytes(q, priv.m_q.get(), size);
+    rsa::BigNumToBytes(qinv, priv.m_qinv.get(), size);
+    rsa::BigNumToBytes(mod, priv.m_mod.get(), size * 2);
+
+    return err;
+}
+
+alc_error_t
+alcp_rsa_key_up_ref(alc_rsa_key_p pKey)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pKey, err);
+
+    pKey->m_refs.fetch_add(1, std::memory_order_relaxed);
+
+    return err;
+}
+
+void
+alcp_rsa_key_free(alc_rsa_key_p pKey)
+{
+    if (pKey && pKey->m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        delete pKey;
+    }
+}
+
+alc_error_t
+alcp_rsa_set_key(const alc_rsa_handle_p pRsaHandle, const alc_rsa_key_p pKey)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle, err);
+    ALCP_BAD_PTR_ERR_RET(pRsaHandle->context, err);
+    ALCP_BAD_PTR_ERR_RET(pKey, err);
+
+    auto ctx = static_cast<rsa::Context*>(pRsaHandle->context);
+
+    ctx->status = ctx->setKey(ctx->m_rsa, pKey->m_pub, pKey->m_priv);
+
+    return ctx->status.ok() ? err : to_alc_error(ctx->status);
+}
+
 void
 alcp_rsa_finish(const alc_rsa_handle_p pRsaHandle)
 {
@@ -0,0 +1,721 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes_cbc_hmac_sha.hh"
+#include "alcp/cipher/cipher_wrapper.hh"
+#include "alcp/digest/sha2.hh"
+#include "alcp/digest/shani.hh"
+#include "alcp/utils/bits.hh"
+#include "alcp/utils/cpuid.hh"
+
+#include <algorithm>
+#include <cstring>
+
+using alcp::utils::CpuId;
+
+namespace alcp::cipher {
+
+namespace {
+
+    constexpr Uint32 cSha1Iv[] = {
+        0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0,
+    };
+
+    constexpr Uint32 cSha256Iv[] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+
+    alignas(16) constexpr Uint32 cSha256RoundConstants[] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+        0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+        0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+        0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+        0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+        0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+    };
+
+    inline Uint32 LoadBigEndian32(const Uint8* p)
+    {
+        return (Uint32)p[0] << 24 | (Uint32)p[1] << 16 | (Uint32)p[2] << 8
+               | (Uint32)p[3];
+    }
+
+    void Sha1Compress(Uint32* pHash, const Uint8* pSrc, Uint64 blocks)
+    {
+        using utils::RotateLeft;
+        Uint32 w[80];
+
+        for (; blocks > 0; blocks--, pSrc += 64) {
+            for (int i = 0; i < 16; i++) {
+                w[i] = LoadBigEndian32(pSrc + 4 * i);
+            }
+            for (int i = 16; i < 80; i++) {
+                w[i] = RotateLeft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16],
+                                  (Uint32)1);
+            }
+            Uint32 a = pHash[0], b = pHash[1], c = pHash[2], d = pHash[3],
+                   e = pHash[4];
+            for (int i = 0; i < 80; i++) {
+                Uint32 f, k;
+                if (i < 20) {
+                    f = (b & c) | (~b & d);
+                    k = 0x5a827999;
+                } else if (i < 40) {
+                    f = b ^ c ^ d;
+                    k = 0x6ed9eba1;
+                } else if (i < 60) {
+                    f = (b & c) | (b & d) | (c & d);
+                    k = 0x8f1bbcdc;
+                } else {
+                    f = b ^ c ^ d;
+                    k = 0xca62c1d6;
+                }
+                Uint32 t = RotateLeft(a, (Uint32)5) + f + e + k + w[i];
+                e        = d;
+                d        = c;
+                c        = RotateLeft(b, (Uint32)30);
+                b        = a;
+                a        = t;
+            }
+            pHash[0] += a;
+            pHash[1] += b;
+            pHash[2] += c;
+            pHash[3] += d;
+            pHash[4] += e;
+        }
+    }
+
+    void Sha256Compress(Uint32* pHash, const Uint8* pSrc, Uint64 blocks)
+    {
+        using utils::RotateRight;
+        Uint32 w[64];
+
+        for (; blocks > 0; blocks--, pSrc += 64) {
+            for (int i = 0; i < 16; i++) {
+                w[i] = LoadBigEndian32(pSrc + 4 * i);
+            }
+            for (int i = 16; i < 64; i++) {
+                Uint32 s0 = RotateRight(w[i - 15], (Uint32)7)
+                            ^ RotateRight(w[i - 15], (Uint32)18)
+                            ^ (w[i - 15] >> 3);
+                Uint32 s1 = RotateRight(w[i - 2], (Uint32)17)
+                            ^ RotateRight(w[i - 2], (Uint32)19)
+                            ^ (w[i - 2] >> 10);
+                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+            digest::CompressMsg(w, pHash, cSha256RoundConstants);
+        }
+    }
+
+    /*
+     * Constant time helpers, all ones when the condition holds and zero
+     * otherwise.
+     */
+    inline Uint64 CtMsb(Uint64 a)
+    {
+        return 0 - (a >> 63);
+    }
+
+    inline Uint64 CtLt(Uint64 a, Uint64 b)
+    {
+        return CtMsb(a ^ ((a ^ b) | ((a - b) ^ b)));
+    }
+
+    inline Uint64 CtGe(Uint64 a, Uint64 b)
+    {
+        return ~CtLt(a, b);
+    }
+
+    inline Uint64 CtEq(Uint64 a, Uint64 b)
+    {
+        Uint64 x = a ^ b;
+        return CtMsb(~x & (x - 1));
+    }
+
+    inline Uint64 CtSelect(Uint64 mask, Uint64 a, Uint64 b)
+    {
+        return (mask & a) | (~mask & b);
+    }
+
+} // namespace
+
+template<bool cSha256>
+CbcHmacSha<cSha256>::CbcHmacSha(const Uint8* pKey, const Uint32 keyLen)
+    : Aes(pKey, keyLen)
+{
+    m_stitched = CpuId::cpuHasShani() && CpuId::cpuHasAesni();
+    // an unkeyed MAC is HMAC with the empty key
+    setMacKey(nullptr, 0);
+}
+
+template<bool cSha256>
+CbcHmacSha<cSha256>::~CbcHmacSha()
+{
+    memset(m_head, 0, sizeof(m_head));
+    memset(m_tail, 0, sizeof(m_tail));
+    memset(m_md, 0, sizeof(m_md));
+    memset(m_buf, 0, sizeof(m_buf));
+}
+
+template<bool cSha256>
+void
+CbcHmacSha<cSha256>::compress(Uint32*      pHash,
+                              const Uint8* pSrc,
+                              Uint64       blocks) const
+{
+    if constexpr (cSha256) {
+        if (m_stitched) {
+            digest::shani::ShaUpdate256(
+                pHash, pSrc, blocks * cHashBlockLen, cSha256RoundConstants);
+        } else {
+            Sha256Compress(pHash, pSrc, blocks);
+        }
+    } else {
+        if (m_stitched) {
+            digest::shani::ShaUpdate1(pHash, pSrc, blocks * cHashBlockLen);
+        } else {
+            Sha1Compress(pHash, pSrc, blocks);
+        }
+    }
+}
+
+template<bool cSha256>
+void
+CbcHmacSha<cSha256>::hashReset()
+{
+    memcpy(m_md, m_head, sizeof(m_md));
+    m_num   = 0;
+    m_total = cHashBlockLen;
+}
+
+template<bool cSha256>
+void
+CbcHmacSha<cSha256>::hashUpdate(const Uint8* pSrc, Uint64 len)
+{
+    m_total += len;
+    if (m_num != 0) {
+        Uint64 n = std::min(cHashBlockLen - m_num, len);
+        memcpy(m_buf + m_num, pSrc, n);
+        m_num += n;
+        pSrc += n;
+        len -= n;
+        if (m_num < cHashBlockLen) {
+            return;
+        }
+        compress(m_md, m_buf, 1);
+        m_num = 0;
+    }
+    if (len >= cHashBlockLen) {
+        compress(m_md, pSrc, len / cHashBlockLen);
+        pSrc += len & ~(cHashBlockLen - 1);
+        len &= cHashBlockLen - 1;
+    }
+    memcpy(m_buf, pSrc, len);
+    m_num = len;
+}
+
+/* Pads what is left in m_buf and writes the digest of m_md */
+template<bool cSha256>
+void
+CbcHmacSha<cSha256>::hashFinal(Uint8* pDigest)
+{
+    Uint8  block[2 * cHashBlockLen] = {};
+    Uint64 blocks                   = (m_num + 9 > cHashBlockLen) ? 2 : 1;
+    Uint64 bits                     = m_total * 8;
+
+    memcpy(block, m_buf, m_num);
+    block[m_num] = 0x80;
+    for (int i = 0; i < 8; i++) {
+        block[blocks * cHashBlockLen - 1 - i] = (Uint8)(bits >> (8 * i));
+    }
+    compress(m_md, block, blocks);
+    for (Uint64 i = 0; i < cDigestLen; i++) {
+        pDigest[i] = (Uint8)(m_md[i / 4] >> (24 - 8 * (i % 4)));
+    }
+}
+
+/* Finishes the inner hash and runs the outer one, leaves m_md reset */
+template<bool cSha256>
+void
+CbcHmacSha<cSha256>::hmacFinal(Uint8* pMac)
+{
+    Uint8 inner[cDigestLen];
+
+    hashFinal(inner);
+    memcpy(m_md, m_tail, sizeof(m_md));
+    memcpy(m_buf, inner, cDigestLen);
+    m_num   = cDigestLen;
+    m_total = cHashBlockLen + cDigestLen;
+    hashFinal(pMac);
+    hashReset();
+}
+
+template<bool cSha256>
+alc_error_t
+CbcHmacSha<cSha256>::setMacKey(const Uint8* pKey, Uint64 len)
+{
+    Uint8 key[cHashBlockLen] = {};
+    Uint8 pad[cHashBlockLen];
+
+    if (len > cHashBlockLen) {
+        // K' = H(K), from the plain initial state of the hash
+        if constexpr (cSha256) {
+            memcpy(m_md, cSha256Iv, sizeof(cSha256Iv));
+        } else {
+            memcpy(m_md, cSha1Iv, sizeof(cSha1Iv));
+        }
+        m_num   = 0;
+        m_total = 0;
+        hashUpdate(pKey, len);
+        hashFinal(key);
+    } else if (len != 0) {
+        memcpy(key, pKey, len);
+    }
+
+    for (Uint64 i = 0; i < cHashBlockLen; i++) {
+        pad[i] = key[i] ^ 0x36;
+    }
+    if constexpr (cSha256) {
+        memcpy(m_head, cSha256Iv, sizeof(cSha256Iv));
+    } else {
+        memcpy(m_head, cSha1Iv, sizeof(cSha1Iv));
+    }
+    compress(m_head, pad, 1);
+
+    for (Uint64 i = 0; i < cHashBlockLen; i++) {
+        pad[i] = key[i] ^ 0x5c;
+    }
+    if constexpr (cSha256) {
+        memcpy(m_tail, cSha256Iv, sizeof(cSha256Iv));
+    } else {
+        memcpy(m_tail, cSha1Iv, sizeof(cSha1Iv));
+    }
+    compress(m_tail, pad, 1);
+
+    memset(key, 0, sizeof(key));
+    memset(pad, 0, sizeof(pad));
+    hashReset();
+    return ALC_ERROR_NONE;
+}
+
+template<bool cSha256>
+alc_error_t
+CbcHmacSha<cSha256>::setIv(Uint64 len, const Uint8* pIv)
+{
+    if (len != sizeof(m_iv)) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    memcpy(m_iv, pIv, sizeof(m_iv));
+    return ALC_ERROR_NONE;
+}
+
+template<bool cSha256>
+alc_error_t
+CbcHmacSha<cSha256>::setAad(const Uint8* pInput, Uint64 len)
+{
+    if (len != cTlsAadLen) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    memcpy(m_aad, pInput, cTlsAadLen);
+    m_tls = true;
+    return ALC_ERROR_NONE;
+}
+
+template<bool cSha256>
+alc_error_t
+CbcHmacSha<cSha256>::getTag(Uint8* pOutput, Uint64 len)
+{
+    Uint8 mac[cDigestLen];
+
+    if (len == 0 || len > cDigestLen) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    hmacFinal(mac);
+    memcpy(pOutput, mac, len);
+    return ALC_ERROR_NONE;
+}
+
+/* CBC that leaves the last ciphertext block in m_iv, in place or not */
+template<bool cSha256>
+void
+CbcHmacSha<cSha256>::cbcEncrypt(const Uint8* pSrc, Uint8* pDest, Uint64 len)
+{
+    if (len == 0) {
+        return;
+    }
+    aesni::EncryptCbc128(pSrc, pDest, len, getEncryptKeys(), getRounds(), m_iv);
+    memcpy(m_iv, pDest + len - sizeof(m_iv), sizeof(m_iv));
+}
+
+template<bool cSha256>
+void
+CbcHmacSha<cSha256>::cbcDecrypt(const Uint8* pSrc, Uint8* pDest, Uint64 len)
+{
+    Uint8 next_iv[sizeof(m_iv)];
+
+    if (len == 0) {
+        return;
+    }
+    memcpy(next_iv, pSrc + len - sizeof(m_iv), sizeof(m_iv));
+    aesni::DecryptCbc128(pSrc, pDest, len, getDecryptKeys(), getRounds(), m_iv);
+    memcpy(m_iv, next_iv, sizeof(m_iv));
+}
+
+template<bool cSha256>
+alc_error_t
+CbcHmacSha<cSha256>::tlsEncrypt(const Uint8* pSrc, Uint8* pDest, Uint64 len)
+{
+    const Uint16 version     = (Uint16)(m_aad[9] << 8 | m_aad[10]);
+    const Uint64 explicit_iv = version >= 0x0302 ? sizeof(m_iv) : 0;
+    const Uint64 total       = tlsRecordLen(len);
+    // payload bytes that complete the hash block holding the AAD
+    Uint64 sha_off = cHashBlockLen - cTlsAadLen;
+    Uint64 aes_off = 0;
+    Uint64 plen;
+
+    if (len < explicit_iv) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    plen      = len - explicit_iv;
+    m_aad[11] = (Uint8)(plen >> 8);
+    m_aad[12] = (Uint8)plen;
+
+    const Uint8* p_payload = pSrc + explicit_iv;
+
+    hashReset();
+    hashUpdate(m_aad, cTlsAadLen);
+    if (m_stitched && plen >= sha_off + cHashBlockLen) {
+        Uint64 chunks = (plen - sha_off) / cHashBlockLen;
+
+        hashUpdate(p_payload, sha_off);
+        // the hash runs sha_off + explicit bytes ahead of the CBC
+        if constexpr (cSha256) {
+            aesni::EncryptCbcSha256(pSrc,
+                                    pDest,
+                                    chunks,
+                                    getEncryptKeys(),
+                                    getRounds(),
+                                    m_iv,
+                                    m_md,
+                                    p_payload + sha_off,
+                                    cSha256RoundConstants);
+        } else {
+            aesni::EncryptCbcSha1(pSrc,
+                                  pDest,
+                                  chunks,
+                                  getEncryptKeys(),
+                                  getRounds(),
+                                  m_iv,
+                                  m_md,
+                                  p_payload + sha_off);
+        }
+        aes_off = chunks * cHashBlockLen;
+        sha_off += aes_off;
+        m_total += aes_off;
+        hashUpdate(p_payload + sha_off, plen - sha_off);
+    } else {
+        hashUpdate(p_payload, plen);
+    }
+
+    if (pDest != pSrc) {
+        memcpy(pDest + aes_off, pSrc + aes_off, len - aes_off);
+    }
+    hmacFinal(pDest + len);
+    // every byte of the padding, its length byte too, holds the length
+    memset(pDest + len + cDigestLen,
+           (int)(total - len - cDigestLen - 1),
+           total - len - cDigestLen);
+    cbcEncrypt(pDest + aes_off, pDest + aes_off, total - aes_off);
+    return ALC_ERROR_NONE;
+}
+
+/*
+ * Lucky Thirteen safe record check. Only the part of the record that is
+ * payload whatever the padding says is hashed as it is decrypted, the
+ * last blocks are hashed for every possible padding and the right state
+ * picked with masks. The MAC is gathered from its secret position by
+ * rotating, after the same scan of the last 256 + MAC bytes as any other.
+ */
+template<bool cSha256>
+alc_error_t
+CbcHmacSha<cSha256>::tlsDecrypt(const Uint8* pSrc, Uint8* pDest, Uint64 len)
+{
+    const Uint16 version     = (Uint16)(m_aad[9] << 8 | m_aad[10]);
+    const Uint64 explicit_iv = version >= 0x0302 ? sizeof(m_iv) : 0;
+
+    if (len % Rijndael::cBlockSize != 0
+        || len < explicit_iv + tlsRecordLen(0)) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    if (explicit_iv != 0) {
+        // the explicit IV is the chaining value of the record
+        memcpy(m_iv, pSrc, sizeof(m_iv));
+        pSrc += explicit_iv;
+        pDest += explicit_iv;
+        len -= explicit_iv;
+    }
+
+    /*
+     * The last block goes first, its padding length decides what the MAC
+     * covers. A padding that is too long is replaced by the longest one
+     * possible and the record fails later.
+     */
+    Uint8 tail_iv[Rijndael::cBlockSize];
+    Uint8 tail[Rijndael::cBlockSize];
+    memcpy(tail_iv, pSrc + len - 2 * sizeof(tail), sizeof(tail));
+    aesni::DecryptCbc128(pSrc + len - sizeof(tail),
+                         tail,
+                         sizeof(tail),
+                         getDecryptKeys(),
+                         getRounds(),
+                         tail_iv);
+
+    const Uint64 max_pad = std::min<Uint64>(255, len - cDigestLen - 1);
+    Uint64       pad     = tail[sizeof(tail) - 1];
+    Uint64       good    = CtGe(max_pad, pad);
+    pad                  = CtSelect(good, pad, max_pad);
+
+    const Uint64 inp_len = len - cDigestLen - pad - 1;
+    const Uint64 msg_len = cTlsAadLen + inp_len;
+    Uint8        aad[cTlsAadLen];
+    Uint8        bits[8];
+
+    memcpy(aad, m_aad, cTlsAadLen);
+    aad[11] = (Uint8)(inp_len >> 8);
+    aad[12] = (Uint8)inp_len;
+    for (int i = 0; i < 8; i++) {
+        bits[i] = (Uint8)(((cHashBlockLen + msg_len) * 8) >> (56 - 8 * i));
+    }
+
+    // hash blocks of AAD and payload that no padding can reach into
+    const Uint64 max_tail = cDigestLen + 256;
+    const Uint64 blocks =
+        len > max_tail ? (cTlsAadLen + len - max_tail) / cHashBlockLen : 0;
+    Uint64 aes_off = 0;
+    Uint64 hashed  = 0;
+
+    hashReset();
+    if (m_stitched && blocks >= 2) {
+        // the hash trails the decryption by a chunk and the AAD
+        Uint64 chunks =
+            std::min(blocks - 1, (len - 2 * cHashBlockLen) / cHashBlockLen);
+
+        cbcDecrypt(pSrc, pDest, 2 * cHashBlockLen);
+        hashUpdate(aad, cTlsAadLen);
+        hashUpdate(pDest, cHashBlockLen - cTlsAadLen);
+        if constexpr (cSha256) {
+            aesni::DecryptCbcSha256(pSrc + 2 * cHashBlockLen,
+                                    pDest + 2 * cHashBlockLen,
+                                    chunks,
+                                    getDecryptKeys(),
+                                    getRounds(),
+                                    m_iv,
+                                    m_md,
+                                    pDest + cHashBlockLen - cTlsAadLen,
+                                    cSha256RoundConstants);
+        } else {
+            aesni::DecryptCbcSha1(pSrc + 2 * cHashBlockLen,
+                                  pDest + 2 * cHashBlockLen,
+                                  chunks,
+                                  getDecryptKeys(),
+                                  getRounds(),
+                                  m_iv,
+                                  m_md,
+                                  pDest + cHashBlockLen - cTlsAadLen);
+        }
+        aes_off = (2 + chunks) * cHashBlockLen;
+        hashed  = (1 + chunks) * cHashBlockLen;
+    }
+    cbcDecrypt(pSrc + aes_off, pDest + aes_off, len - aes_off);
+    if (hashed == 0 && blocks != 0) {
+        hashUpdate(aad, cTlsAadLen);
+        hashUpdate(pDest, cHashBlockLen - cTlsAadLen);
+        hashed = cHashBlockLen;
+    }
+    if (hashed < blocks * cHashBlockLen) {
+        compress(m_md,
+                 pDest + hashed - cTlsAadLen,
+                 blocks - hashed / cHashBlockLen);
+        hashed = blocks * cHashBlockLen;
+    }
+
+    for (Uint64 i = 1; i < std::min<Uint64>(256, len); i++) {
+        Uint64 in_pad = CtLt(i, pad + 1);
+        good &= ~in_pad | CtEq(pDest[len - 1 - i], pad);
+    }
+
+    // the tail is hashed for every padding, the real last block is kept
+    const Uint64 last = (msg_len + 8) / cHashBlockLen - blocks;
+    const Uint64 max_last =
+        (cTlsAadLen + len - cDigestLen - 1 + 8) / cHashBlockLen - blocks;
+
+    alignas(16) Uint32 inner[8] = {};
+    Uint8              block[cHashBlockLen];
+    for (Uint64 b = 0; b <= max_last; b++) {
+        Uint64 is_last = CtEq(b, last);
+        for (Uint64 i = 0; i < cHashBlockLen; i++) {
+            Uint64 pos = hashed + b * cHashBlockLen + i;
+            Uint64 byte;
+            if (pos < cTlsAadLen) {
+                byte = aad[pos];
+            } else if (pos - cTlsAadLen < len) {
+                byte = pDest[pos - cTlsAadLen];
+            } else {
+                byte = 0;
+            }
+            byte &= CtLt(pos, msg_len);
+            byte |= 0x80 & CtEq(pos, msg_len);
+            if (i >= cHashBlockLen - 8) {
+                byte |= bits[i - (cHashBlockLen - 8)] & is_last;
+            }
+            block[i] = (Uint8)byte;
+        }
+        compress(m_md, block, 1);
+        for (int i = 0; i < 8; i++) {
+            inner[i] |= m_md[i] & (Uint32)is_last;
+        }
+    }
+
+    // outer hash of the inner digest
+    Uint8 mac[cDigestLen];
+    for (Uint64 i = 0; i < cDigestLen; i++) {
+        m_buf[i] = (Uint8)(inner[i / 4] >> (24 - 8 * (i % 4)));
+    }
+    memcpy(m_md, m_tail, sizeof(m_md));
+    m_num   = cDigestLen;
+    m_total = cHashBlockLen + cDigestLen;
+    hashFinal(mac);
+    hashReset();
+
+    // the MAC in the record, from its secret offset
+    const Uint64 scan_start = len > max_tail ? len - max_tail : 0;
+    const Uint64 mac_end    = inp_len + cDigestLen;
+    Uint8        rotated[cDigestLen] = {};
+    Uint64       in_mac              = 0;
+    Uint64       rotate_offset       = 0;
+    for (Uint64 i = scan_start, j = 0; i < len; i++, j++) {
+        if (j == cDigestLen) {
+            j = 0;
+        }
+        Uint64 mac_started = CtEq(i, inp_len);
+        in_mac |= mac_started;
+        in_mac &= CtLt(i, mac_end);
+        rotate_offset |= j & mac_started;
+        rotated[j] |= pDest[i] & (Uint8)in_mac;
+    }
+    Uint64 diff = 0;
+    for (Uint64 i = 0; i < cDigestLen; i++) {
+        Uint64 idx = rotate_offset + i;
+        idx -= cDigestLen & CtGe(idx, cDigestLen);
+        Uint64 byte = 0;
+        for (Uint64 k = 0; k < cDigestLen; k++) {
+            byte |= rotated[k] & CtEq(k, idx);
+        }
+        diff |= byte ^ mac[i];
+    }
+    good &= CtEq(diff, 0);
+
+    return good ? ALC_ERROR_NONE : ALC_ERROR_INVALID_DATA;
+}
+
+template<bool cSha256>
+alc_error_t
+CbcHmacSha<cSha256>::encryptUpdate(const Uint8* pInput,
+                                   Uint8*       pOutput,
+                                   Uint64       len,
+                                   const Uint8* pIv)
+{
+    if (m_tls) {
+        m_tls = false;
+        return tlsEncrypt(pInput, pOutput, len);
+    }
+    if (len % Rijndael::cBlockSize != 0) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+
+    Uint64 aes_off = 0;
+    if (m_stitched && m_num == 0 && len >= cHashBlockLen) {
+        Uint64 chunks = len / cHashBlockLen;
+        if constexpr (cSha256) {
+            aesni::EncryptCbcSha256(pInput,
+                                    pOutput,
+                                    chunks,
+                                    getEncryptKeys(),
+                                    getRounds(),
+                                    m_iv,
+                                    m_md,
+                                    pInput,
+                                    cSha256RoundConstants);
+        } else {
+            aesni::EncryptCbcSha1(pInput,
+                                  pOutput,
+                                  chunks,
+                                  getEncryptKeys(),
+                                  getRounds(),
+                                  m_iv,
+                                  m_md,
+                                  pInput);
+        }
+        aes_off = chunks * cHashBlockLen;
+        m_total += aes_off;
+    }
+    // hashed before it is encrypted, the output may be the input
+    hashUpdate(pInput + aes_off, len - aes_off);
+    cbcEncrypt(pInput + aes_off, pOutput + aes_off, len - aes_off);
+    return ALC_ERROR_NONE;
+}
+
+template<bool cSha256>
+alc_error_t
+CbcHmacSha<cSha256>::decryptUpdate(const Uint8* pCipherText,
+                                   Uint8*       pPlainText,
+                                   Uint64       len,
+                                   const Uint8* pIv)
+{
+    if (m_tls) {
+        m_tls = false;
+        return tlsDecrypt(pCipherText, pPlainText, len);
+    }
+    if (len % Rijndael::cBlockSize != 0) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    cbcDecrypt(pCipherText, pPlainText, len);
+    hashUpdate(pPlainText, len);
+    return ALC_ERROR_NONE;
+}
+
+template class CbcHmacSha<false>;
+template class CbcHmacSha<true>;
+
+} // namespace alcp::cipher
@@ -39,6 +39,42 @@ using alcp::utils::CpuId;
 
 namespace alcp::cipher {
 
+/*
+ * Records one after another through the single stream interface, for the
+ * paths without a multi-record kernel.
+ */
+template<bool encrypt, typename GCM>
+static alc_error_t
+gcmRecordsSerial(GCM*                            pGcm,
+                 const alc_cipher_aead_record_t* pRecords,
+                 Uint64                          count)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    for (Uint64 i = 0; i < count && !alcp_is_error(err); i++) {
+        const alc_cipher_aead_record_t& rec = pRecords[i];
+
+        err = pGcm->setIv(rec.ar_iv_len, rec.ar_iv);
+        if (!alcp_is_error(err) && rec.ar_aad_len != 0) {
+            err = pGcm->setAad(rec.ar_aad, rec.ar_aad_len);
+        }
+        if (!alcp_is_error(err) && rec.ar_len != 0) {
+            if constexpr (encrypt)
+                err = pGcm->encryptUpdate(
+                    rec.ar_in, rec.ar_out, rec.ar_len, rec.ar_iv);
+            else
+                err = pGcm->decryptUpdate(
+                    rec.ar_in, rec.ar_out, rec.ar_len, rec.ar_iv);
+        }
+        if (!alcp_is_error(err)) {
+            err = pGcm->getTag(rec.ar_tag, rec.ar_tag_len);
+        }
+    }
+    pGcm->m_iv = nullptr;
+
+    return err;
+}
+
 namespace vaes512 {
 
     alc_error_t GcmAEAD128::decryptUpdate(const Uint8* pInput,
@@ -161,6 +197,96 @@ namespace vaes512 {
         return err;
     }
 
+    alc_error_t GcmAEAD128::encryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        alc_error_t err = encryptGcmRecords128(pRecords,
+                                               count,
+                                               m_enc_key,
+                                               m_nrounds,
+                                               this,
+                                               m_reverse_mask_128,
+                                               m_hashSubkeyTable);
+        m_iv = nullptr;
+
+        return err;
+    }
+
+    alc_error_t GcmAEAD128::decryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        alc_error_t err = decryptGcmRecords128(pRecords,
+                                               count,
+                                               m_enc_key,
+                                               m_nrounds,
+                                               this,
+                                               m_reverse_mask_128,
+                                               m_hashSubkeyTable);
+        m_iv = nullptr;
+
+        return err;
+    }
+
+    alc_error_t GcmAEAD192::encryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        alc_error_t err = encryptGcmRecords192(pRecords,
+                                               count,
+                                               m_enc_key,
+                                               m_nrounds,
+                                               this,
+                                               m_reverse_mask_128,
+                                               m_hashSubkeyTable);
+        m_iv = nullptr;
+
+        return err;
+    }
+
+    alc_error_t GcmAEAD192::decryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        alc_error_t err = decryptGcmRecords192(pRecords,
+                                               count,
+                                               m_enc_key,
+                                               m_nrounds,
+                                               this,
+                                               m_reverse_mask_128,
+                                               m_hashSubkeyTable);
+        m_iv = nullptr;
+
+        return err;
+    }
+
+    alc_error_t GcmAEAD256::encryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        alc_error_t err = encryptGcmRecords256(pRecords,
+                                               count,
+                                               m_enc_key,
+                                               m_nrounds,
+                                               this,
+                                               m_reverse_mask_128,
+                                               m_hashSubkeyTable);
+        m_iv = nullptr;
+
+        return err;
+    }
+
+    alc_error_t GcmAEAD256::decryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        alc_error_t err = decryptGcmRecords256(pRecords,
+                                               count,
+                                               m_enc_key,
+                                               m_nrounds,
+                                               this,
+                                               m_reverse_mask_128,
+                                               m_hashSubkeyTable);
+        m_iv = nullptr;
+
+        return err;
+    }
+
     alc_error_t GcmGhash::setIv(Uint64 len, const Uint8* pIv)
     {
         alc_error_t err = ALC_ERROR_NONE;
@@ -372,6 +498,42 @@ namespace aesni {
         return err;
     }
 
+    alc_error_t GcmAEAD128::encryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        return gcmRecordsSerial<true>(this, pRecords, count);
+    }
+
+    alc_error_t GcmAEAD128::decryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        return gcmRecordsSerial<false>(this, pRecords, count);
+    }
+
+    alc_error_t GcmAEAD192::encryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        return gcmRecordsSerial<true>(this, pRecords, count);
+    }
+
+    alc_error_t GcmAEAD192::decryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        return gcmRecordsSerial<false>(this, pRecords, count);
+    }
+
+    alc_error_t GcmAEAD256::encryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        return gcmRecordsSerial<true>(this, pRecords, count);
+    }
+
+    alc_error_t GcmAEAD256::decryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count)
+    {
+        return gcmRecordsSerial<false>(this, pRecords, count);
+    }
+
     alc_error_t GcmGhash::setIv(Uint64 len, const Uint8* pIv)
     {
         alc_error_t err = ALC_ERROR_NONE;
@@ -29,6 +29,7 @@
 #include "alcp/cipher/aes.hh"
 #include "alcp/cipher/aes_build.hh"
 #include "alcp/cipher/aes_cbc.hh"
+#include "alcp/cipher/aes_cbc_hmac_sha.hh"
 #include "alcp/cipher/aes_ccm.hh"
 #include "alcp/cipher/aes_cfb.hh"
 #include "alcp/cipher/aes_cmac_siv.hh"
@@ -41,6 +42,7 @@
 using alcp::utils::CpuCipherFeatures;
 using alcp::utils::CpuId;
 
+#include <memory>      /* for std::align */
 #include <type_traits> /* for is_same_v<> */
 
 namespace alcp::cipher {
@@ -108,6 +110,24 @@ __aes_wrapperUpdate(void*        rCipher,
     return e;
 }
 
+template<typename CIPHERMODE, bool encrypt = true>
+static alc_error_t
+__aes_wrapperRecords(void*                           rCipher,
+                     const alc_cipher_aead_record_t* pRecords,
+                     Uint64                          count)
+{
+    alc_error_t e = ALC_ERROR_NONE;
+
+    auto ap = static_cast<CIPHERMODE*>(rCipher);
+
+    if constexpr (encrypt)
+        e = ap->encryptRecords(pRecords, count);
+    else
+        e = ap->decryptRecords(pRecords, count);
+
+    return e;
+}
+
 template<typename CIPHERMODE>
 static alc_error_t
 __aes_wrapperSetIv(void* rCipher, Uint64 len, const Uint8* pIv)
@@ -173,13 +193,43 @@ __aes_wrapperSetAad(void* rCipher, const Uint8* pAad, Uint64 len)
     return e;
 }
 
+/**
+ * @brief True when CIPHERMODE can be built in Context::m_inplace at any
+ * alignment of the context itself.
+ */
+template<typename CIPHERMODE>
+static constexpr bool cFitsInplace =
+    sizeof(CIPHERMODE) + alignof(CIPHERMODE) - 1 <= Context::cInplaceSize;
+
+/**
+ * @brief Construct the mode object for a context, inside the context when it
+ * fits and on the heap otherwise. Released by __aes_dtor<CIPHERMODE>.
+ */
+template<typename CIPHERMODE, typename... ARGS>
+static CIPHERMODE*
+__new_mode(Context& ctx, ARGS&&... args)
+{
+    if constexpr (cFitsInplace<CIPHERMODE>) {
+        void*       p     = ctx.m_inplace;
+        std::size_t space = sizeof(ctx.m_inplace);
+        p = std::align(alignof(CIPHERMODE), sizeof(CIPHERMODE), p, space);
+        return new (p) CIPHERMODE(std::forward<ARGS>(args)...);
+    } else {
+        return new CIPHERMODE(std::forward<ARGS>(args)...);
+    }
+}
+
 template<typename CIPHERMODE>
 static alc_error_t
 __aes_dtor(const void* rCipher)
 {
     alc_error_t e  = ALC_ERROR_NONE;
     auto        ap = static_cast<const CIPHERMODE*>(rCipher);
-    delete ap;
+    if constexpr (cFitsInplace<CIPHERMODE>) {
+        ap->~CIPHERMODE();
+    } else {
+        delete ap;
+    }
     return e;
 }
 
@@ -220,7 +270,7 @@ template<typename CIPHERMODE>
 void
 _build_aes_cipher(const Uint8* pKey, const Uint32 keyLen, Context& ctx)
 {
-    CIPHERMODE* algo = new CIPHERMODE(pKey, keyLen);
+    CIPHERMODE* algo = __new_mode<CIPHERMODE>(ctx, pKey, keyLen);
 
     ctx.m_cipher = static_cast<void*>(algo);
 
@@ -278,7 +328,7 @@ __build_aes(const Uint8* pKey, const Uint32 keyLen, Context& ctx)
 {
     Status sts = StatusOk();
 
-    auto algo    = new CIPHERMODE(pKey, keyLen);
+    auto algo    = __new_mode<CIPHERMODE>(ctx, pKey, keyLen);
     ctx.m_cipher = static_cast<void*>(algo);
     ctx.decrypt  = __aes_wrapper<CIPHERMODE, false>;
     ctx.encrypt  = __aes_wrapper<CIPHERMODE, true>;
@@ -308,12 +358,17 @@ __build_aes(const Uint8* pKey, const Uint32 keyLen, Context& ctx)
  * @param pKey      Key for initializing cipher class
  * @param keyLen    Length of the key
  * @param ctx       Context for the AEAD Cipher
+ * @return Status
  */
 template<typename AEADMODE>
-void
+Status
 _build_aead(const Uint8* pKey, const Uint32 keyLen, Context& ctx)
 {
-    auto algo = new AEADMODE(pKey, keyLen);
+    auto algo = __new_mode<AEADMODE>(ctx, pKey, keyLen);
+    if (algo == nullptr) {
+        return alcp::base::status::InternalError(
+            "Unable to Allocate Memory for AEAD");
+    }
 
     ctx.m_cipher      = static_cast<void*>(algo);
     ctx.decryptUpdate = __aes_wrapperUpdate<AEADMODE, false>;
@@ -327,7 +382,14 @@ _build_aead(const Uint8* pKey, const Uint32 keyLen, Context& ctx)
         ctx.setTagLength = __aes_wrapperSetTagLength<AEADMODE>;
     }
 
+    if constexpr (std::is_base_of_v<GcmAuth, AEADMODE>) {
+        ctx.encryptRecords = __aes_wrapperRecords<AEADMODE, true>;
+        ctx.decryptRecords = __aes_wrapperRecords<AEADMODE, false>;
+    }
+
     ctx.finish = __aes_dtor<AEADMODE>;
+
+    return StatusOk();
 }
 
 /**
@@ -350,20 +412,52 @@ __build_GcmAead(const Uint8* pKey, const Uint32 keyLen, Context& ctx)
         /* FIXME: cipher request should fail invalid key length. At this
          * level only valid key length is passed.*/
         if (keyLen == ALC_KEY_LEN_128) {
-            _build_aead<vaes512::GcmAEAD128>(pKey, keyLen, ctx);
+            sts = _build_aead<vaes512::GcmAEAD128>(pKey, keyLen, ctx);
         } else if (keyLen == ALC_KEY_LEN_192) {
-            _build_aead<vaes512::GcmAEAD192>(pKey, keyLen, ctx);
+            sts = _build_aead<vaes512::GcmAEAD192>(pKey, keyLen, ctx);
         } else if (keyLen == ALC_KEY_LEN_256) {
-            _build_aead<vaes512::GcmAEAD256>(pKey, keyLen, ctx);
+            sts = _build_aead<vaes512::GcmAEAD256>(pKey, keyLen, ctx);
         }
     } else {
 
         if (keyLen == ALC_KEY_LEN_128) {
-            _build_aead<aesni::GcmAEAD128>(pKey, keyLen, ctx);
+            sts = _build_aead<aesni::GcmAEAD128>(pKey, keyLen, ctx);
         } else if (keyLen == ALC_KEY_LEN_192) {
-            _build_aead<aesni::GcmAEAD192>(pKey, keyLen, ctx);
+            sts = _build_aead<aesni::GcmAEAD192>(pKey, keyLen, ctx);
         } else if (keyLen == ALC_KEY_LEN_256) {
-            _build_aead<aesni::GcmAEAD256>(pKey, keyLen, ctx);
+            sts = _build_aead<aesni::GcmAEAD256>(pKey, keyLen, ctx);
+        }
+    }
+
+    return sts;
+}
+
+/**
+ * @brief Builder specific to the CBC-HMAC-SHA AEAD Modes
+ *
+ * The stitched kernels are picked inside the mode, the builder only adds
+ * the MAC key to the AES key
+ * @param algoInfo  AEAD information structure carrying the MAC key
+ * @param keyInfo   AES key
+ * @param ctx       Context for the AEAD Cipher
+ * @return Status
+ */
+template<typename AEADMODE>
+static Status
+__build_aesCbcHmac(const alc_cipher_aead_algo_info_t& algoInfo,
+                   const alc_key_info_t&              keyInfo,
+                   Context&                           ctx)
+{
+    Status                sts       = StatusOk();
+    const alc_key_info_t* p_mac_key = algoInfo.ai_cbc_hmac.hi_mac_key;
+
+    sts = _build_aead<AEADMODE>(keyInfo.key, keyInfo.len, ctx);
+    if (sts.ok() && p_mac_key != nullptr) {
+        auto        ap  = static_cast<AEADMODE*>(ctx.m_cipher);
+        alc_error_t err = ap->setMacKey(p_mac_key->key, p_mac_key->len / 8);
+        if (alcp_is_error(err)) {
+            sts = alcp::base::status::InternalError(
+                "CBC-HMAC: Unable to set MAC Key");
         }
     }
 
@@ -519,7 +613,7 @@ __build_aead_siv(const alc_key_info_t& encKey,
                  const alc_key_info_t& authKey,
                  Context&              ctx)
 {
-    auto algo    = new AEADMODE(encKey, authKey);
+    auto algo    = __new_mode<AEADMODE>(ctx, encKey, authKey);
     ctx.m_cipher = static_cast<void*>(algo);
     ctx.decrypt  = __aes_wrapper<AEADMODE, false>;
     ctx.encrypt  = __aes_wrapper<AEADMODE, true>;
@@ -609,23 +703,26 @@ __chacha20_processInputWrapper(const void*  rCipher,
 }
 template<CpuCipherFeatures cpu_cipher_feature>
 static alc_error_t
-__chacha20_FinishWrapper(const void* rCipher)
+__chacha20_setIvWrapper(void* rCipher, Uint64 len, const Uint8* pIv)
 {
-    alc_error_t e = ALC_ERROR_NONE;
+    auto ap = static_cast<chacha20::ChaCha20<cpu_cipher_feature>*>(rCipher);
 
-    auto ap =
-        static_cast<const chacha20::ChaCha20<cpu_cipher_feature>*>(rCipher);
-    delete ap;
-
-    return e;
+    return ap->setIv(pIv, len);
 }
 template<CpuCipherFeatures cpu_cipher_feature>
 alc_error_t
 __build_chacha20(const alc_cipher_info_t& cCipherAlgoInfo, Context& ctx)
 {
-    chacha20::ChaCha20<cpu_cipher_feature>* chacha =
-        new chacha20::ChaCha20<cpu_cipher_feature>();
+    using CIPHERMODE = chacha20::ChaCha20<cpu_cipher_feature>;
+
+    CIPHERMODE* chacha = __new_mode<CIPHERMODE>(ctx);
     ctx.m_cipher = chacha;
+    // finish is set first so a failed request can still be released
+    ctx.encrypt = __chacha20_processInputWrapper<cpu_cipher_feature>;
+    ctx.decrypt = __chacha20_processInputWrapper<cpu_cipher_feature>;
+    ctx.setIv   = __chacha20_setIvWrapper<cpu_cipher_feature>;
+    ctx.finish  = __aes_dtor<CIPHERMODE>;
+
     if (chacha->setKey(cCipherAlgoInfo.ci_key_info.key,
                        cCipherAlgoInfo.ci_key_info.len / 8)) {
         return ALC_ERROR_INVALID_ARG;
@@ -635,22 +732,84 @@ __build_chacha20(const alc_cipher_info_t& cCipherAlgoInfo, Context& ctx)
                       cCipherAlgoInfo.ci_algo_info.iv_length / 8)) {
         return ALC_ERROR_INVALID_ARG;
     }
-    ctx.encrypt = __chacha20_processInputWrapper<cpu_cipher_feature>;
-    ctx.decrypt = __chacha20_processInputWrapper<cpu_cipher_feature>;
-    ctx.finish  = __chacha20_FinishWrapper<cpu_cipher_feature>;
 
     return ALC_ERROR_NONE;
 }
+/**
+ * @brief ChaCha20 uses no AES instructions, so its kernel is chosen on vector
+ * width alone (Zen2 has no VAES but does have AVX2).
+ */
+static CpuCipherFeatures
+getChacha20Cpufeature()
+{
+    if (CpuId::cpuHasAvx512(utils::AVX512_F)
+        && CpuId::cpuHasAvx512(utils::AVX512_DQ)
+        && CpuId::cpuHasAvx512(utils::AVX512_BW)) {
+        return CpuCipherFeatures::eVaes512;
+    } else if (CpuId::cpuHasAvx2()) {
+        return CpuCipherFeatures::eVaes256;
+    }
+    return CpuCipherFeatures::eReference;
+}
+
 alc_error_t
 chacha20::Chacha20Builder::Build(const alc_cipher_info_t& cCipherAlgoInfo,
                                  Context&                 ctx)
 {
 
-    CpuCipherFeatures cpu_cipher_feature = getCpuCipherfeature();
+    CpuCipherFeatures cpu_cipher_feature = getChacha20Cpufeature();
     if (cpu_cipher_feature == CpuCipherFeatures::eVaes512) {
-        __build_chacha20<CpuCipherFeatures::eVaes512>(cCipherAlgoInfo, ctx);
+        return __build_chacha20<CpuCipherFeatures::eVaes512>(cCipherAlgoInfo,
+                                                             ctx);
+    } else if (cpu_cipher_feature == CpuCipherFeatures::eVaes256) {
+        return __build_chacha20<CpuCipherFeatures::eVaes256>(cCipherAlgoInfo,
+                                                             ctx);
+    }
+    return __build_chacha20<CpuCipherFeatures::eReference>(cCipherAlgoInfo,
+                                                           ctx);
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+static void
+__build_chacha20_poly1305(const alc_key_info_t& keyInfo, Context& ctx)
+{
+    using AEADMODE = chacha20::ChaCha20Poly1305<cpu_cipher_feature>;
+
+    auto algo = __new_mode<AEADMODE>(ctx, keyInfo.key, keyInfo.len);
+
+    ctx.m_cipher      = static_cast<void*>(algo);
+    ctx.decryptUpdate = __aes_wrapperUpdate<AEADMODE, false>;
+    ctx.encryptUpdate = __aes_wrapperUpdate<AEADMODE, true>;
+
+    ctx.setAad = __aes_wrapperSetAad<AEADMODE>;
+    ctx.setIv  = __aes_wrapperSetIv<AEADMODE>;
+    ctx.getTag = __aes_wrapperGetTag<AEADMODE>;
+
+    ctx.finish = __aes_dtor<AEADMODE>;
+}
+
+alc_error_t
+chacha20::Chacha20Poly1305Builder::Build(
+    const alc_cipher_aead_info_t& cCipherAlgoInfo, Context& ctx)
+{
+    const alc_key_info_t& key_info = cCipherAlgoInfo.ci_key_info;
+
+    if (cCipherAlgoInfo.ci_algo_info.ai_mode != ALC_CHACHA20_POLY1305) {
+        return ALC_ERROR_NOT_SUPPORTED;
+    }
+    if (key_info.key == nullptr
+        || !chacha20::ChaCha20Poly1305<>::isSupported(key_info.len)) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    CpuCipherFeatures cpu_cipher_feature = getChacha20Cpufeature();
+    if (cpu_cipher_feature == CpuCipherFeatures::eVaes512) {
+        __build_chacha20_poly1305<CpuCipherFeatures::eVaes512>(key_info, ctx);
+    } else if (cpu_cipher_feature == CpuCipherFeatures::eVaes256) {
+        __build_chacha20_poly1305<CpuCipherFeatures::eVaes256>(key_info, ctx);
     } else {
-        __build_chacha20<CpuCipherFeatures::eReference>(cCipherAlgoInfo, ctx);
+        __build_chacha20_poly1305<CpuCipherFeatures::eReference>(key_info,
+                                                                 ctx);
     }
 
     return ALC_ERROR_NONE;
@@ -717,11 +876,17 @@ CipherAeadBuilder::Build(const alc_cipher_aead_info_t& cipherInfo,
 {
     alc_error_t err = ALC_ERROR_NONE;
 
+    ctx.encryptRecords = nullptr;
+    ctx.decryptRecords = nullptr;
+
     switch (cipherInfo.ci_type) {
         case ALC_CIPHER_TYPE_AES:
             err = AesAeadBuilder::Build(
                 cipherInfo.ci_algo_info, cipherInfo.ci_key_info, ctx);
             break;
+        case ALC_CIPHER_TYPE_CHACHA20:
+            err = chacha20::Chacha20Poly1305Builder::Build(cipherInfo, ctx);
+            break;
 
         default:
             err = ALC_ERROR_NOT_SUPPORTED;
@@ -752,8 +917,17 @@ AesAeadBuilder::Build(const alc_cipher_aead_algo_info_t& cCipherAlgoInfo,
         case ALC_AES_MODE_CCM:
             // FIXME: Rewrite below
             if (Ccm::isSupported(keyInfo.len))
-                _build_aead<Ccm>(keyInfo.key, keyInfo.len, ctx);
-            sts = StatusOk();
+                sts = _build_aead<Ccm>(keyInfo.key, keyInfo.len, ctx);
+            break;
+        case ALC_AES_MODE_CBC_HMAC_SHA1:
+            if (CbcHmacSha1::isSupported(keyInfo.len))
+                sts = __build_aesCbcHmac<CbcHmacSha1>(
+                    cCipherAlgoInfo, keyInfo, ctx);
+            break;
+        case ALC_AES_MODE_CBC_HMAC_SHA256:
+            if (CbcHmacSha256::isSupported(keyInfo.len))
+                sts = __build_aesCbcHmac<CbcHmacSha256>(
+                    cCipherAlgoInfo, keyInfo, ctx);
             break;
 #if 0
         case ALC_AES_MODE_CCM:
@@ -84,6 +84,15 @@ ChaCha20<cpu_cipher_feature>::processInput(const Uint8 plaintext[],
                                   plaintext,
                                   plaintextLength,
                                   ciphertext);
+    } else if constexpr (cpu_cipher_feature == CpuCipherFeatures::eVaes256) {
+
+        return avx2::ProcessInput(m_key,
+                                  cMKeylen,
+                                  m_iv,
+                                  cMIvlen,
+                                  plaintext,
+                                  plaintextLength,
+                                  ciphertext);
     } else if constexpr (cpu_cipher_feature == CpuCipherFeatures::eReference) {
 
         return ProcessInput(m_key,
@@ -94,9 +103,10 @@ ChaCha20<cpu_cipher_feature>::processInput(const Uint8 plaintext[],
                             plaintextLength,
                             ciphertext);
     } else if constexpr (cpu_cipher_feature == CpuCipherFeatures::eDynamic) {
-        bool is_avx512 = CpuId::cpuHasAvx512(utils::AVX512_F)
-                         && CpuId::cpuHasAvx512(utils::AVX512_DQ)
-                         && CpuId::cpuHasAvx512(utils::AVX512_BW);
+        static bool is_avx512 = CpuId::cpuHasAvx512(utils::AVX512_F)
+                                && CpuId::cpuHasAvx512(utils::AVX512_DQ)
+                                && CpuId::cpuHasAvx512(utils::AVX512_BW);
+        static bool is_avx2   = CpuId::cpuHasAvx2();
 
         if (is_avx512) {
             return zen4::ProcessInput(m_key,
@@ -106,6 +116,14 @@ ChaCha20<cpu_cipher_feature>::processInput(const Uint8 plaintext[],
                                       plaintext,
                                       plaintextLength,
                                       ciphertext);
+        } else if (is_avx2) {
+            return avx2::ProcessInput(m_key,
+                                      cMKeylen,
+                                      m_iv,
+                                      cMIvlen,
+                                      plaintext,
+                                      plaintextLength,
+                                      ciphertext);
         } else {
 
             return ProcessInput(m_key,
@@ -120,6 +138,7 @@ ChaCha20<cpu_cipher_feature>::processInput(const Uint8 plaintext[],
 }
 
 template class ChaCha20<CpuCipherFeatures::eVaes512>;
+template class ChaCha20<CpuCipherFeatures::eVaes256>;
 template class ChaCha20<CpuCipherFeatures::eReference>;
 template class ChaCha20<CpuCipherFeatures::eDynamic>;
 
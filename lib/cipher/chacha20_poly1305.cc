@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/cipher/chacha20_poly1305.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace alcp::cipher::chacha20 {
+
+template<CpuCipherFeatures cpu_cipher_feature>
+ChaCha20Poly1305<cpu_cipher_feature>::ChaCha20Poly1305(const Uint8* pKey,
+                                                       const Uint32 keyLen)
+{
+    // Unkeyed on a bad key, setIv then refuses to start a message
+    if (pKey == nullptr || !isSupported(keyLen)) {
+        return;
+    }
+    memcpy(m_key, pKey, cMKeylen);
+    m_key_set = !alcp_is_error(m_chacha20.setKey(m_key, cMKeylen));
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+ChaCha20Poly1305<cpu_cipher_feature>::~ChaCha20Poly1305()
+{
+    std::fill(m_key, m_key + sizeof(m_key), 0);
+    std::fill(m_keystream, m_keystream + sizeof(m_keystream), 0);
+    std::fill(m_tag, m_tag + sizeof(m_tag), 0);
+    m_poly1305.finish();
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+void
+ChaCha20Poly1305<cpu_cipher_feature>::setCounter(Uint32 counter)
+{
+    m_iv[0] = static_cast<Uint8>(counter);
+    m_iv[1] = static_cast<Uint8>(counter >> 8);
+    m_iv[2] = static_cast<Uint8>(counter >> 16);
+    m_iv[3] = static_cast<Uint8>(counter >> 24);
+    m_chacha20.setIv(m_iv, sizeof(m_iv));
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+void
+ChaCha20Poly1305<cpu_cipher_feature>::keystreamBlock()
+{
+    Uint32 counter = m_iv[0] | (m_iv[1] << 8) | (m_iv[2] << 16)
+                     | (static_cast<Uint32>(m_iv[3]) << 24);
+
+    std::fill(m_keystream, m_keystream + sizeof(m_keystream), 0);
+    m_chacha20.processInput(m_keystream, cMBlocklen, m_keystream);
+    setCounter(counter + 1);
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+alc_error_t
+ChaCha20Poly1305<cpu_cipher_feature>::padMac(Uint64 len)
+{
+    static constexpr Uint8 cZeros[16] = {};
+
+    Uint64 pad = (16 - (len % 16)) % 16;
+    if (!m_poly1305.update(cZeros, pad).ok()) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    return ALC_ERROR_NONE;
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+alc_error_t
+ChaCha20Poly1305<cpu_cipher_feature>::crypt(const Uint8* pInput,
+                                            Uint8*       pOutput,
+                                            Uint64       len)
+{
+    // Use up the keystream left over by a previous partial block
+    while (len != 0 && m_keystream_offset < cMBlocklen) {
+        *pOutput++ = *pInput++ ^ m_keystream[m_keystream_offset++];
+        len--;
+    }
+
+    Uint64 full = len - (len % cMBlocklen);
+    if (full != 0) {
+        alc_error_t err = m_chacha20.processInput(pInput, full, pOutput);
+        if (alcp_is_error(err)) {
+            return err;
+        }
+        Uint32 counter = m_iv[0] | (m_iv[1] << 8) | (m_iv[2] << 16)
+                         | (static_cast<Uint32>(m_iv[3]) << 24);
+        setCounter(counter + static_cast<Uint32>(full / cMBlocklen));
+        pInput += full;
+        pOutput += full;
+        len -= full;
+    }
+
+    if (len != 0) {
+        keystreamBlock();
+        for (Uint64 i = 0; i < len; i++) {
+            pOutput[i] = pInput[i] ^ m_keystream[i];
+        }
+        m_keystream_offset = len;
+    }
+    return ALC_ERROR_NONE;
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+alc_error_t
+ChaCha20Poly1305<cpu_cipher_feature>::setIv(Uint64 len, const Uint8* pIv)
+{
+    if (!m_key_set) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (pIv == nullptr || len != cMNoncelen) {
+        return ALC_ERROR_INVALID_ARG;
+    }
+    memcpy(m_iv + 4, pIv, cMNoncelen);
+
+    // Block 0 of the keystream is the one-time Poly1305 key
+    alignas(16) Uint8 poly_key[cMBlocklen] = {};
+    setCounter(0);
+    m_chacha20.processInput(poly_key, cMBlocklen, poly_key);
+    setCounter(1);
+
+    m_poly1305.reset();
+    Status s = m_poly1305.setKey(poly_key, cMKeylen * 8);
+    std::fill(poly_key, poly_key + sizeof(poly_key), 0);
+    if (!s.ok()) {
+        return ALC_ERROR_BAD_STATE;
+    }
+
+    m_keystream_offset = cMBlocklen;
+    m_aad_len          = 0;
+    m_data_len         = 0;
+    m_iv_set           = true;
+    m_aad_done         = false;
+    m_tag_done         = false;
+    return ALC_ERROR_NONE;
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+alc_error_t
+ChaCha20Poly1305<cpu_cipher_feature>::setAad(const Uint8* pAad, Uint64 len)
+{
+    if (!m_iv_set || m_aad_done) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (!m_poly1305.update(pAad, len).ok()) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    m_aad_len += len;
+    return ALC_ERROR_NONE;
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+alc_error_t
+ChaCha20Poly1305<cpu_cipher_feature>::encryptUpdate(const Uint8* pInput,
+                                                    Uint8*       pOutput,
+                                                    Uint64       len,
+                                                    const Uint8* pIv)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    if (!m_iv_set || m_tag_done) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (!m_aad_done) {
+        err = padMac(m_aad_len);
+        if (alcp_is_error(err)) {
+            return err;
+        }
+        m_aad_done = true;
+    }
+
+    // The 32-bit block counter must not wrap into reused keystream
+    if (len > cMMaxDataLen - m_data_len) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    m_data_len += len;
+    while (len != 0) {
+        Uint64 chunk = std::min(len, cMChunkSize);
+        err          = crypt(pInput, pOutput, chunk);
+        if (alcp_is_error(err)) {
+            return err;
+        }
+        // Ciphertext is still in L1, authenticate it right away
+        if (!m_poly1305.update(pOutput, chunk).ok()) {
+            return ALC_ERROR_BAD_STATE;
+        }
+        pInput += chunk;
+        pOutput += chunk;
+        len -= chunk;
+    }
+    return err;
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+alc_error_t
+ChaCha20Poly1305<cpu_cipher_feature>::decryptUpdate(const Uint8* pInput,
+                                                    Uint8*       pOutput,
+                                                    Uint64       len,
+                                                    const Uint8* pIv)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    if (!m_iv_set || m_tag_done) {
+        return ALC_ERROR_BAD_STATE;
+    }
+    if (!m_aad_done) {
+        err = padMac(m_aad_len);
+        if (alcp_is_error(err)) {
+            return err;
+        }
+        m_aad_done = true;
+    }
+
+    // The 32-bit block counter must not wrap into reused keystream
+    if (len > cMMaxDataLen - m_data_len) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    m_data_len += len;
+    while (len != 0) {
+        Uint64 chunk = std::min(len, cMChunkSize);
+        // Authenticate before decrypting so in-place operation works
+        if (!m_poly1305.update(pInput, chunk).ok()) {
+            return ALC_ERROR_BAD_STATE;
+        }
+        err = crypt(pInput, pOutput, chunk);
+        if (alcp_is_error(err)) {
+            return err;
+        }
+        pInput += chunk;
+        pOutput += chunk;
+        len -= chunk;
+    }
+    return err;
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
+alc_error_t
+ChaCha20Poly1305<cpu_cipher_feature>::getTag(Uint8* pOutput, Uint64 len)
+{
+    if (len == 0 || len > cMTaglen) {
+        return ALC_ERROR_INVALID_SIZE;
+    }
+    if (!m_iv_set) {
+        return ALC_ERROR_BAD_STATE;
+    }
+
+    if (!m_tag_done) {
+        alc_error_t err = ALC_ERROR_NONE;
+        if (!m_aad_done) {
+            err = padMac(m_aad_len);
+            if (alcp_is_error(err)) {
+                return err;
+            }
+            m_aad_done = true;
+        }
+        err = padMac(m_data_len);
+        if (alcp_is_error(err)) {
+            return err;
+        }
+
+        Uint8 lengths[16];
+        for (int i = 0; i < 8; i++) {
+            lengths[i]     = static_cast<Uint8>(m_aad_len >> (8 * i));
+            lengths[i + 8] = static_cast<Uint8>(m_data_len >> (8 * i));
+        }
+        Status s = m_poly1305.finalize(lengths, sizeof(lengths));
+        s.update(m_poly1305.copy(m_tag, cMTaglen));
+        if (!s.ok()) {
+            return ALC_ERROR_BAD_STATE;
+        }
+        m_tag_done = true;
+    }
+
+    memcpy(pOutput, m_tag, len);
+    return ALC_ERROR_NONE;
+}
+
+template class ChaCha20Poly1305<CpuCipherFeatures::eVaes512>;
+template class ChaCha20Poly1305<CpuCipherFeatures::eVaes256>;
+template class ChaCha20Poly1305<CpuCipherFeatures::eReference>;
+template class ChaCha20Poly1305<CpuCipherFeatures::eDynamic>;
+
+} // namespace alcp::cipher::chacha20
@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/cipher/aes_cbc_hmac_sha.hh"
+#include "alcp/cipher_aead.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace alcp::cipher;
+
+namespace {
+
+/*
+ * Records made with the OpenSSL default provider: key 00 01 .., MAC key
+ * 40 41 .., IV 80 81 .., a 200 byte payload of i * 7 + 1 and record
+ * sequence number 5 of application data.
+ */
+const std::vector<Uint8> cSha1Tls10Record = {
+    0x82, 0xd6, 0x30, 0x7f, 0x0c, 0x8b, 0x77, 0xd2, 0x2c, 0x43, 0x41, 0x32,
+    0xef, 0xc6, 0x71, 0xca, 0xb4, 0xec, 0x2c, 0x4c, 0x6c, 0x3e, 0x89, 0xcc,
+    0x54, 0x80, 0x14, 0x9f, 0x12, 0x1f, 0x31, 0x8f, 0xb2, 0x38, 0x1f, 0x18,
+    0x48, 0x24, 0x3b, 0x9b, 0xd9, 0x58, 0xff, 0x5d, 0x0b, 0xa8, 0xb3, 0x9e,
+    0x45, 0x80, 0x7b, 0x38, 0x65, 0xf5, 0xf4, 0x51, 0xb9, 0x97, 0x82, 0x15,
+    0x6a, 0x05, 0x2e, 0xfa, 0xdb, 0xb2, 0xb2, 0x13, 0x06, 0x75, 0x72, 0xea,
+    0xe1, 0xc2, 0x5b, 0x21, 0xf8, 0xed, 0x7d, 0x6f, 0x23, 0x32, 0x8d, 0xe9,
+    0x0f, 0xf8, 0x06, 0xd0, 0x01, 0x57, 0xc9, 0x78, 0xec, 0x0e, 0xb0, 0x33,
+    0xda, 0x12, 0xd8, 0x4b, 0x31, 0xd4, 0x55, 0x34, 0x2f, 0x4b, 0xf6, 0x9e,
+    0xa2, 0x78, 0x89, 0xee, 0x40, 0xe1, 0x28, 0xd9, 0x34, 0xd4, 0x44, 0x34,
+    0x25, 0x4f, 0x21, 0x21, 0x45, 0x17, 0x25, 0x1f, 0x01, 0x23, 0xee, 0x9f,
+    0x65, 0x49, 0x8b, 0xb4, 0xf7, 0x6a, 0x39, 0xdf, 0xa4, 0xc6, 0x77, 0x79,
+    0x51, 0x72, 0xde, 0xdb, 0x9b, 0x1b, 0xc0, 0xc0, 0xf2, 0x25, 0x1a, 0x51,
+    0x33, 0x0f, 0xe1, 0xee, 0x70, 0x10, 0x1f, 0x67, 0x7a, 0x1d, 0x08, 0xc4,
+    0xb0, 0xa0, 0x73, 0x4a, 0x62, 0x81, 0xaa, 0x48, 0xcd, 0xf6, 0x65, 0x5b,
+    0x0e, 0x67, 0x27, 0xe6, 0xc4, 0x44, 0xe8, 0x24, 0xeb, 0x85, 0xb1, 0x5b,
+    0x2d, 0x77, 0xf9, 0x0f, 0x70, 0x33, 0x3f, 0xb8, 0xfe, 0x88, 0xb9, 0x77,
+    0x11, 0xe4, 0xef, 0xf1, 0x89, 0x7a, 0xfc, 0x28, 0xfe, 0x4d, 0x0b, 0xd6,
+    0x94, 0x1b, 0x43, 0x69, 0x17, 0xc2, 0xda, 0x32,
+};
+
+// TLS 1.2, the explicit IV a0 a1 .. leads the payload
+const std::vector<Uint8> cSha256Tls12Record = {
+    0x72, 0xd7, 0x5c, 0x29, 0x41, 0x59, 0xfa, 0xc2, 0x8a, 0x43, 0xf6, 0x7c,
+    0x6e, 0x07, 0xee, 0x4b, 0xae, 0x5b, 0x89, 0x1e, 0x8e, 0x82, 0x06, 0x0c,
+    0x86, 0xfd, 0xa3, 0xa8, 0xf1, 0xcb, 0x53, 0x33, 0x97, 0x31, 0x6b, 0x82,
+    0xd3, 0x87, 0x83, 0x6d, 0x88, 0x10, 0xfe, 0xe9, 0x11, 0xa2, 0x7c, 0xfa,
+    0xf4, 0x30, 0x40, 0x92, 0x6e, 0x2e, 0xe2, 0x2a, 0x41, 0xf1, 0xc4, 0x24,
+    0x62, 0xf8, 0x41, 0xdf, 0x56, 0x12, 0x7b, 0x7e, 0xaf, 0x6c, 0x08, 0xbe,
+    0x4b, 0x18, 0x03, 0x09, 0x54, 0xfc, 0x14, 0xd5, 0xdf, 0x7c, 0x28, 0xa2,
+    0x40, 0x63, 0x03, 0xf9, 0x4c, 0x53, 0xcd, 0x05, 0xf6, 0xf7, 0x90, 0xb8,
+    0xba, 0x87, 0x66, 0x41, 0x13, 0xfc, 0x2c, 0xe1, 0x24, 0x5f, 0x63, 0x08,
+    0xae, 0xd1, 0x47, 0x75, 0x7c, 0x5a, 0x90, 0xa7, 0x85, 0x4c, 0xbe, 0x55,
+    0x53, 0x92, 0xfd, 0xa6, 0x8b, 0x80, 0xde, 0xb7, 0xb0, 0x4d, 0x49, 0x69,
+    0xc8, 0x23, 0x4a, 0xf1, 0x00, 0x24, 0xcf, 0xe7, 0x3b, 0xb6, 0x80, 0xe9,
+    0xcd, 0xd3, 0x15, 0x6c, 0xac, 0xcc, 0x01, 0x79, 0x83, 0xfe, 0x5c, 0xef,
+    0xa0, 0x65, 0xdc, 0xbf, 0x1c, 0x46, 0x9a, 0x12, 0x3d, 0xc0, 0xa9, 0xef,
+    0x83, 0x16, 0xfc, 0xbd, 0xb2, 0x9e, 0xec, 0xfd, 0x43, 0xee, 0xa4, 0xe0,
+    0x1f, 0xc3, 0x52, 0x72, 0x27, 0xff, 0xbc, 0xdb, 0xd1, 0x26, 0x47, 0x7c,
+    0x2d, 0xee, 0xd1, 0xf2, 0xe2, 0x5e, 0x99, 0xe9, 0x81, 0x20, 0x97, 0xd9,
+    0xca, 0xcd, 0x10, 0xd7, 0x7f, 0x5c, 0xcc, 0xcc, 0xb9, 0x38, 0x49, 0xd8,
+    0x53, 0xde, 0xfc, 0x78, 0x29, 0x6d, 0xd0, 0x51, 0x31, 0xb3, 0xed, 0xcb,
+    0xf3, 0xd1, 0xf5, 0xca, 0xb6, 0x4f, 0x2e, 0x23, 0x62, 0x53, 0xc4, 0x0b,
+    0x08, 0xd1, 0x7a, 0x62, 0x2f, 0x0e, 0x15, 0xbd, 0x78, 0xbe, 0x78, 0x16,
+    0x99, 0xff, 0x84, 0x4a,
+};
+
+const Uint64 cPayloadLen = 200;
+
+struct Session
+{
+    std::vector<Uint8>  context;
+    alc_cipher_handle_t handle;
+
+    Session(alc_cipher_mode_t mode, Uint64 keyLen, Uint64 macKeyLen)
+    {
+        Uint8 key[32], mac_key[32], iv[16];
+        for (Uint8 i = 0; i < 32; i++) {
+            key[i]     = i;
+            mac_key[i] = 0x40 + i;
+        }
+        for (Uint8 i = 0; i < 16; i++) {
+            iv[i] = 0x80 + i;
+        }
+
+        alc_key_info_t mac_key_info = {};
+        mac_key_info.type           = ALC_KEY_TYPE_SYMMETRIC;
+        mac_key_info.fmt            = ALC_KEY_FMT_RAW;
+        mac_key_info.len            = macKeyLen * 8;
+        mac_key_info.key            = mac_key;
+
+        alc_cipher_aead_info_t info        = {};
+        info.ci_type                       = ALC_CIPHER_TYPE_AES;
+        info.ci_key_info.type              = ALC_KEY_TYPE_SYMMETRIC;
+        info.ci_key_info.fmt               = ALC_KEY_FMT_RAW;
+        info.ci_key_info.len               = keyLen * 8;
+        info.ci_key_info.key               = key;
+        info.ci_algo_info.ai_mode          = mode;
+        info.ci_algo_info.ai_cbc_hmac.hi_mac_key = &mac_key_info;
+
+        context.resize(alcp_cipher_aead_context_size(&info));
+        handle.ch_context = &context[0];
+        EXPECT_EQ(alcp_cipher_aead_request(&info, &handle), ALC_ERROR_NONE);
+        EXPECT_EQ(alcp_cipher_aead_set_iv(&handle, sizeof(iv), iv),
+                  ALC_ERROR_NONE);
+    }
+
+    ~Session() { alcp_cipher_aead_finish(&handle); }
+
+    void setAad(Uint16 version, Uint64 seq, Uint64 len)
+    {
+        Uint8 aad[13];
+        for (int i = 0; i < 8; i++) {
+            aad[i] = (Uint8)(seq >> (56 - 8 * i));
+        }
+        aad[8]  = 0x17;
+        aad[9]  = (Uint8)(version >> 8);
+        aad[10] = (Uint8)version;
+        aad[11] = (Uint8)(len >> 8);
+        aad[12] = (Uint8)len;
+        EXPECT_EQ(alcp_cipher_aead_set_aad(&handle, aad, sizeof(aad)),
+                  ALC_ERROR_NONE);
+    }
+
+    void setIv(const Uint8* pIv)
+    {
+        EXPECT_EQ(alcp_cipher_aead_set_iv(&handle, 16, pIv), ALC_ERROR_NONE);
+    }
+
+    alc_error_t encrypt(const Uint8* pIn, Uint8* pOut, Uint64 len)
+    {
+        return alcp_cipher_aead_encrypt_update(&handle, pIn, pOut, len, pIn);
+    }
+
+    alc_error_t decrypt(const Uint8* pIn, Uint8* pOut, Uint64 len)
+    {
+        return alcp_cipher_aead_decrypt_update(&handle, pIn, pOut, len, pIn);
+    }
+};
+
+std::vector<Uint8>
+Payload(Uint64 explicitIv, Uint64 len)
+{
+    std::vector<Uint8> in(explicitIv + len);
+    for (Uint64 i = 0; i < explicitIv; i++) {
+        in[i] = (Uint8)(0xa0 + i);
+    }
+    for (Uint64 i = 0; i < len; i++) {
+        in[explicitIv + i] = (Uint8)(i * 7 + 1);
+    }
+    return in;
+}
+
+template<typename MODE>
+void
+RoundTrip(alc_cipher_mode_t mode, Uint64 keyLen, Uint16 version)
+{
+    const Uint64 explicit_iv = version >= 0x0302 ? 16 : 0;
+    Session      enc(mode, keyLen, MODE::cDigestLen);
+    Session      dec(mode, keyLen, MODE::cDigestLen);
+    Session      bad(mode, keyLen, MODE::cDigestLen);
+    std::vector<Uint8> chain(16);
+
+    for (Uint8 i = 0; i < 16; i++) {
+        chain[i] = 0x80 + i;
+    }
+
+    for (Uint64 len = 0; len < 1100; len++) {
+        std::vector<Uint8> in = Payload(explicit_iv, len);
+        std::vector<Uint8> rec(in);
+        std::vector<Uint8> out(MODE::tlsRecordLen(in.size()));
+
+        // in place, an empty TLS 1.0 record still has room for its MAC
+        rec.resize(out.size());
+        enc.setAad(version, len, in.size());
+        ASSERT_EQ(enc.encrypt(&rec[0], &rec[0], in.size()), ALC_ERROR_NONE);
+
+        // a record with one bit flipped, chained like the good one
+        std::vector<Uint8> flipped = rec;
+        flipped[(len * 13) % flipped.size()] ^= 0x10;
+        bad.setIv(&chain[0]);
+        bad.setAad(version, len, rec.size());
+        EXPECT_EQ(bad.decrypt(&flipped[0], &out[0], rec.size()),
+                  ALC_ERROR_INVALID_DATA)
+            << "len " << len;
+        chain.assign(rec.end() - 16, rec.end());
+
+        dec.setAad(version, len, rec.size());
+        ASSERT_EQ(dec.decrypt(&rec[0], &out[0], rec.size()), ALC_ERROR_NONE)
+            << "len " << len;
+        Uint64 pad = out.back();
+        ASSERT_EQ(out.size() - pad - 1 - MODE::cDigestLen, in.size());
+        EXPECT_TRUE(std::equal(
+            in.begin() + explicit_iv, in.end(), out.begin() + explicit_iv));
+    }
+}
+
+} // namespace
+
+TEST(CbcHmacSha, Sha1Tls10_KAT)
+{
+    std::vector<Uint8> in = Payload(0, cPayloadLen);
+    std::vector<Uint8> rec(CbcHmacSha1::tlsRecordLen(in.size()));
+    std::vector<Uint8> out(rec.size());
+    Session            enc(ALC_AES_MODE_CBC_HMAC_SHA1, 16, 20);
+    Session            dec(ALC_AES_MODE_CBC_HMAC_SHA1, 16, 20);
+
+    enc.setAad(0x0301, 5, in.size());
+    EXPECT_EQ(enc.encrypt(&in[0], &rec[0], in.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(rec, cSha1Tls10Record);
+
+    dec.setAad(0x0301, 5, rec.size());
+    EXPECT_EQ(dec.decrypt(&cSha1Tls10Record[0], &out[0], out.size()),
+              ALC_ERROR_NONE);
+    EXPECT_TRUE(std::equal(in.begin(), in.end(), out.begin()));
+}
+
+TEST(CbcHmacSha, Sha256Tls12_KAT)
+{
+    std::vector<Uint8> in = Payload(16, cPayloadLen);
+    std::vector<Uint8> rec(CbcHmacSha256::tlsRecordLen(in.size()));
+    std::vector<Uint8> out(rec.size());
+    Session            enc(ALC_AES_MODE_CBC_HMAC_SHA256, 32, 32);
+    Session            dec(ALC_AES_MODE_CBC_HMAC_SHA256, 32, 32);
+
+    // in place, as the TLS record layer does it
+    rec.assign(in.begin(), in.end());
+    rec.resize(CbcHmacSha256::tlsRecordLen(in.size()));
+    enc.setAad(0x0303, 5, in.size());
+    EXPECT_EQ(enc.encrypt(&rec[0], &rec[0], in.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(rec, cSha256Tls12Record);
+
+    dec.setAad(0x0303, 5, rec.size());
+    EXPECT_EQ(dec.decrypt(&rec[0], &rec[0], rec.size()), ALC_ERROR_NONE);
+    EXPECT_TRUE(std::equal(in.begin() + 16, in.end(), rec.begin() + 16));
+}
+
+TEST(CbcHmacSha, Sha1RoundTrip)
+{
+    RoundTrip<CbcHmacSha1>(ALC_AES_MODE_CBC_HMAC_SHA1, 16, 0x0301);
+    RoundTrip<CbcHmacSha1>(ALC_AES_MODE_CBC_HMAC_SHA1, 32, 0x0303);
+}
+
+TEST(CbcHmacSha, Sha256RoundTrip)
+{
+    RoundTrip<CbcHmacSha256>(ALC_AES_MODE_CBC_HMAC_SHA256, 16, 0x0303);
+    RoundTrip<CbcHmacSha256>(ALC_AES_MODE_CBC_HMAC_SHA256, 32, 0x0301);
+}
+
+TEST(CbcHmacSha, BadPadding)
+{
+    const Uint8 iv[16] = { 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+                           0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f };
+    std::vector<Uint8> rec = cSha1Tls10Record;
+    std::vector<Uint8> out(rec.size());
+    Session            plain(ALC_AES_MODE_CBC_HMAC_SHA1, 16, 20);
+    Session            dec(ALC_AES_MODE_CBC_HMAC_SHA1, 16, 20);
+
+    // plain CBC without AAD, the MAC stays good and the padding does not
+    EXPECT_EQ(plain.decrypt(&rec[0], &rec[0], rec.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(rec.back(), 3);
+    rec[rec.size() - 3] ^= 1;
+    plain.setIv(iv);
+    EXPECT_EQ(plain.encrypt(&rec[0], &rec[0], rec.size()), ALC_ERROR_NONE);
+
+    dec.setAad(0x0301, 5, rec.size());
+    EXPECT_EQ(dec.decrypt(&rec[0], &out[0], rec.size()),
+              ALC_ERROR_INVALID_DATA);
+}
+
+TEST(CbcHmacSha, InvalidUsage)
+{
+    Session enc(ALC_AES_MODE_CBC_HMAC_SHA256, 16, 32);
+    Uint8   buf[64] = {};
+
+    // AAD other than a TLS header, blocks cut short and short records
+    EXPECT_EQ(alcp_cipher_aead_set_aad(&enc.handle, buf, 12),
+              ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(enc.encrypt(buf, buf, 17), ALC_ERROR_INVALID_SIZE);
+    enc.setAad(0x0303, 0, 32);
+    EXPECT_EQ(enc.decrypt(buf, buf, 48), ALC_ERROR_INVALID_SIZE);
+    enc.setAad(0x0303, 0, 33);
+    EXPECT_EQ(enc.decrypt(buf, buf, 33), ALC_ERROR_INVALID_SIZE);
+}
+
+int
+main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
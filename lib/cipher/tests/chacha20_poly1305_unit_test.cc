@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include "alcp/cipher/chacha20_poly1305.hh"
+#include "alcp/types.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace alcp::cipher::chacha20;
+using alcp::utils::CpuCipherFeatures;
+using alcp::utils::CpuId;
+
+namespace {
+
+// RFC 8439 section 2.8.2
+const Uint8 cKey[] = { 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+                       0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+                       0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+                       0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f };
+
+const Uint8 cNonce[] = { 0x07, 0x00, 0x00, 0x00, 0x40, 0x41,
+                         0x42, 0x43, 0x44, 0x45, 0x46, 0x47 };
+
+const std::vector<Uint8> cAad = { 0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1,
+                                  0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7 };
+
+const std::string cPlainText =
+    "Ladies and Gentlemen of the class of '99: If I could offer you only one "
+    "tip for the future, sunscreen would be it.";
+
+const std::vector<Uint8> cCipherText = {
+    0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb, 0x7b, 0x86, 0xaf, 0xbc,
+    0x53, 0xef, 0x7e, 0xc2, 0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e, 0x08, 0xfe,
+    0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6, 0x3d, 0xbe, 0xa4, 0x5e,
+    0x8c, 0xa9, 0x67, 0x12, 0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b,
+    0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29, 0x05, 0xd6, 0xa5, 0xb6,
+    0x7e, 0xcd, 0x3b, 0x36, 0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c,
+    0x98, 0x03, 0xae, 0xe3, 0x28, 0x09, 0x1b, 0x58, 0xfa, 0xb3, 0x24, 0xe4,
+    0xfa, 0xd6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc,
+    0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d, 0xe5, 0x76, 0xd2, 0x65,
+    0x86, 0xce, 0xc6, 0x4b, 0x61, 0x16
+};
+
+const std::vector<Uint8> cTag = { 0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09,
+                                  0xe2, 0x6a, 0x7e, 0x90, 0x2e, 0xcb,
+                                  0xd0, 0x60, 0x06, 0x91 };
+
+/*
+ * Encrypts msg feeding at most chunk bytes per encryptUpdate call, returns
+ * ciphertext followed by the 16 byte tag
+ */
+template<CpuCipherFeatures F>
+std::vector<Uint8>
+seal(const std::vector<Uint8>& aad, const std::vector<Uint8>& msg, Uint64 chunk)
+{
+    ChaCha20Poly1305<F> aead(cKey, sizeof(cKey) * 8);
+    std::vector<Uint8>  out(msg.size() + 16);
+
+    EXPECT_EQ(aead.setIv(sizeof(cNonce), cNonce), ALC_ERROR_NONE);
+    EXPECT_EQ(aead.setAad(aad.data(), aad.size()), ALC_ERROR_NONE);
+    for (Uint64 i = 0; i < msg.size(); i += chunk) {
+        Uint64 len = std::min(chunk, msg.size() - i);
+        EXPECT_EQ(aead.encryptUpdate(&msg[i], &out[i], len, cNonce),
+                  ALC_ERROR_NONE);
+    }
+    EXPECT_EQ(aead.getTag(&out[msg.size()], 16), ALC_ERROR_NONE);
+    return out;
+}
+
+template<CpuCipherFeatures F>
+void
+kat()
+{
+    std::vector<Uint8> pt(cPlainText.begin(), cPlainText.end());
+    std::vector<Uint8> expected(cCipherText);
+    expected.insert(expected.end(), cTag.begin(), cTag.end());
+
+    for (Uint64 chunk : { 1, 7, 16, 63, 64, 65, 1024 }) {
+        EXPECT_EQ(seal<F>(cAad, pt, chunk), expected) << "chunk " << chunk;
+    }
+
+    // In-place decrypt
+    ChaCha20Poly1305<F> aead(cKey, sizeof(cKey) * 8);
+    std::vector<Uint8>  buf(cCipherText);
+    Uint8               tag[16];
+    EXPECT_EQ(aead.setIv(sizeof(cNonce), cNonce), ALC_ERROR_NONE);
+    EXPECT_EQ(aead.setAad(cAad.data(), cAad.size()), ALC_ERROR_NONE);
+    EXPECT_EQ(aead.decryptUpdate(buf.data(), buf.data(), buf.size(), cNonce),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(aead.getTag(tag, sizeof(tag)), ALC_ERROR_NONE);
+    EXPECT_EQ(buf, pt);
+    EXPECT_EQ(std::vector<Uint8>(tag, tag + 16), cTag);
+}
+
+template<CpuCipherFeatures F>
+void
+allLengths()
+{
+    for (Uint64 len = 0; len <= 600; len += 7) {
+        std::vector<Uint8> msg(len), aad(len % 37);
+        for (Uint64 i = 0; i < len; i++) {
+            msg[i] = static_cast<Uint8>(i * 13 + 5);
+        }
+        for (Uint64 i = 0; i < aad.size(); i++) {
+            aad[i] = static_cast<Uint8>(i);
+        }
+        auto expected = seal<CpuCipherFeatures::eReference>(aad, msg, 1024);
+        EXPECT_EQ(seal<F>(aad, msg, 1024), expected) << "len " << len;
+        EXPECT_EQ(seal<F>(aad, msg, 100), expected) << "len " << len;
+    }
+}
+
+} // namespace
+
+TEST(ChaCha20Poly1305, KAT_Reference)
+{
+    kat<CpuCipherFeatures::eReference>();
+}
+
+TEST(ChaCha20Poly1305, KAT_Dynamic)
+{
+    kat<CpuCipherFeatures::eDynamic>();
+}
+
+TEST(ChaCha20Poly1305, KAT_Avx2)
+{
+    if (!CpuId::cpuHasAvx2()) {
+        GTEST_SKIP() << "AVX2 not supported";
+    }
+    kat<CpuCipherFeatures::eVaes256>();
+}
+
+TEST(ChaCha20Poly1305, KAT_Avx512)
+{
+    if (!CpuId::cpuHasAvx512(alcp::utils::AVX512_F)) {
+        GTEST_SKIP() << "AVX512 not supported";
+    }
+    kat<CpuCipherFeatures::eVaes512>();
+}
+
+TEST(ChaCha20Poly1305, ALL_LENGTHS_Dynamic)
+{
+    allLengths<CpuCipherFeatures::eDynamic>();
+}
+
+TEST(ChaCha20Poly1305, ALL_LENGTHS_Avx2)
+{
+    if (!CpuId::cpuHasAvx2()) {
+        GTEST_SKIP() << "AVX2 not supported";
+    }
+    allLengths<CpuCipherFeatures::eVaes256>();
+}
+
+TEST(ChaCha20Poly1305, ALL_LENGTHS_Avx512)
+{
+    if (!CpuId::cpuHasAvx512(alcp::utils::AVX512_F)) {
+        GTEST_SKIP() << "AVX512 not supported";
+    }
+    allLengths<CpuCipherFeatures::eVaes512>();
+}
+
+TEST(ChaCha20Poly1305, InvalidUsage)
+{
+    ChaCha20Poly1305 aead(cKey, sizeof(cKey) * 8);
+    Uint8            buf[16] = {};
+
+    // Nothing works before a nonce is set
+    EXPECT_EQ(aead.encryptUpdate(buf, buf, sizeof(buf), cNonce),
+              ALC_ERROR_BAD_STATE);
+    EXPECT_EQ(aead.setIv(16, buf), ALC_ERROR_INVALID_ARG);
+
+    EXPECT_EQ(aead.setIv(sizeof(cNonce), cNonce), ALC_ERROR_NONE);
+    EXPECT_EQ(aead.encryptUpdate(buf, buf, sizeof(buf), cNonce),
+              ALC_ERROR_NONE);
+    // AAD must come before the data
+    EXPECT_EQ(aead.setAad(buf, sizeof(buf)), ALC_ERROR_BAD_STATE);
+    EXPECT_EQ(aead.getTag(buf, 17), ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(aead.getTag(buf, 16), ALC_ERROR_NONE);
+    EXPECT_EQ(aead.encryptUpdate(buf, buf, sizeof(buf), cNonce),
+              ALC_ERROR_BAD_STATE);
+}
+
+TEST(ChaCha20Poly1305, InvalidKey)
+{
+    Uint8 buf[16] = {};
+
+    // Only 256 bit keys, a context built with another length never starts
+    for (Uint32 len : { 0, 128, 255, 257, 512 }) {
+        ChaCha20Poly1305 aead(cKey, len);
+        EXPECT_EQ(aead.setIv(sizeof(cNonce), cNonce), ALC_ERROR_BAD_STATE)
+            << "len " << len;
+        EXPECT_EQ(aead.encryptUpdate(buf, buf, sizeof(buf), cNonce),
+                  ALC_ERROR_BAD_STATE);
+    }
+    ChaCha20Poly1305 aead(nullptr, sizeof(cKey) * 8);
+    EXPECT_EQ(aead.setIv(sizeof(cNonce), cNonce), ALC_ERROR_BAD_STATE);
+}
+
+TEST(ChaCha20Poly1305, MaxLength)
+{
+    const Uint64 max_len = ((1ULL << 32) - 1) * 64;
+
+    ChaCha20Poly1305 aead(cKey, sizeof(cKey) * 8);
+    Uint8            buf[64] = {};
+
+    // Lengths are checked before any data is touched
+    EXPECT_EQ(aead.setIv(sizeof(cNonce), cNonce), ALC_ERROR_NONE);
+    EXPECT_EQ(aead.encryptUpdate(buf, buf, max_len + 1, cNonce),
+              ALC_ERROR_INVALID_SIZE);
+    EXPECT_EQ(aead.encryptUpdate(buf, buf, sizeof(buf), cNonce),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(aead.encryptUpdate(buf, buf, max_len - 63, cNonce),
+              ALC_ERROR_INVALID_SIZE);
+
+    EXPECT_EQ(aead.setIv(sizeof(cNonce), cNonce), ALC_ERROR_NONE);
+    EXPECT_EQ(aead.decryptUpdate(buf, buf, sizeof(buf), cNonce),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(aead.decryptUpdate(buf, buf, max_len, cNonce),
+              ALC_ERROR_INVALID_SIZE);
+}
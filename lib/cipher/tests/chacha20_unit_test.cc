@@ -27,6 +27,7 @@
  */
 
 #include "../chacha20_inplace.cc.inc"
+#include "alcp/cipher.h"
 #include "alcp/cipher/chacha20.hh"
 #include "alcp/types.h"
 #include "gtest/gtest.h"
@@ -134,6 +135,46 @@ TEST(Chacha20, Encrypt)
     EXPECT_EQ(decrypted_plaintext, plaintext);
 }
 
+TEST(Chacha20, SetIvThroughCapi)
+{
+    Uint8 key[32], iv[16] = {}, next_iv[16];
+    for (Uint8 i = 0; i < 32; i++) {
+        key[i] = i;
+    }
+    for (Uint8 i = 0; i < 16; i++) {
+        next_iv[i] = 0x40 + i;
+    }
+    std::vector<Uint8> plaintext(150, 0x5a), output(150), expected(150);
+
+    ChaCha20 chacha20_obj;
+    chacha20_obj.setKey(key, sizeof(key));
+    chacha20_obj.setIv(next_iv, sizeof(next_iv));
+    chacha20_obj.processInput(&plaintext[0], plaintext.size(), &expected[0]);
+
+    alc_cipher_info_t info      = {};
+    info.ci_type                = ALC_CIPHER_TYPE_CHACHA20;
+    info.ci_key_info.type       = ALC_KEY_TYPE_SYMMETRIC;
+    info.ci_key_info.fmt        = ALC_KEY_FMT_RAW;
+    info.ci_key_info.len        = 256;
+    info.ci_key_info.key        = key;
+    info.ci_algo_info.ai_mode   = ALC_AES_MODE_NONE;
+    info.ci_algo_info.ai_iv     = iv;
+    info.ci_algo_info.iv_length = 128;
+
+    std::vector<Uint8>  context(alcp_cipher_context_size(&info));
+    alc_cipher_handle_t handle = { &context[0] };
+
+    ASSERT_EQ(alcp_cipher_request(&info, &handle), ALC_ERROR_NONE);
+    // A new IV restarts the stream without a new request
+    EXPECT_EQ(alcp_cipher_set_iv(&handle, sizeof(next_iv), next_iv),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(alcp_cipher_encrypt(
+                  &handle, &plaintext[0], &output[0], output.size(), next_iv),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(output, expected);
+    alcp_cipher_finish(&handle);
+}
+
 TEST(Chacha20, Encrypt_MultipleBytes)
 {
     ChaCha20 chacha20_obj_enc, chacha20_obj_dec;
@@ -244,6 +285,55 @@ TEST(Chacha20, Encrypt_MultipleBytes)
     }
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
+void
+CompareWithReference()
+{
+    ChaCha20<CpuCipherFeatures::eReference> ref;
+    ChaCha20<cpu_cipher_feature>            obj;
+    Uint8                                   key[32];
+    // Counter close to wrap around to check per-lane counter increments
+    Uint8 iv[] = { 0xf0, 0xff, 0xff, 0xff, 0, 0, 0, 0x4a,
+                   0,    0,    0,    0x11, 0, 0, 0, 0 };
+    for (int i = 0; i < 32; i++) {
+        key[i] = static_cast<Uint8>(i * 3 + 1);
+    }
+    ASSERT_EQ(ref.setKey(key, sizeof(key)), ALC_ERROR_NONE);
+    ASSERT_EQ(ref.setIv(iv, sizeof(iv)), ALC_ERROR_NONE);
+    ASSERT_EQ(obj.setKey(key, sizeof(key)), ALC_ERROR_NONE);
+    ASSERT_EQ(obj.setIv(iv, sizeof(iv)), ALC_ERROR_NONE);
+
+    std::vector<Uint8> plaintext(4500);
+    for (size_t i = 0; i < plaintext.size(); i++) {
+        plaintext[i] = static_cast<Uint8>(i);
+    }
+    // Covers the wide kernels, their 4 block remainder and partial blocks
+    for (Uint64 len = 1; len <= plaintext.size(); len += 61) {
+        std::vector<Uint8> expected(len), output(len);
+        ref.processInput(&plaintext[0], len, &expected[0]);
+        obj.processInput(&plaintext[0], len, &output[0]);
+        ASSERT_EQ(output, expected) << "Mismatch at length " << len;
+    }
+}
+
+TEST(Chacha20, Avx2MatchesReference)
+{
+    if (!CpuId::cpuHasAvx2()) {
+        GTEST_SKIP() << "AVX2 not supported";
+    }
+    CompareWithReference<CpuCipherFeatures::eVaes256>();
+}
+
+TEST(Chacha20, Avx512MatchesReference)
+{
+    if (!CpuId::cpuHasAvx512(alcp::utils::AVX512_F)
+        || !CpuId::cpuHasAvx512(alcp::utils::AVX512_DQ)
+        || !CpuId::cpuHasAvx512(alcp::utils::AVX512_BW)) {
+        GTEST_SKIP() << "AVX512 not supported";
+    }
+    CompareWithReference<CpuCipherFeatures::eVaes512>();
+}
+
 TEST(Chacha20, PerformanceTest)
 {
     ChaCha20 chacha20_obj;
@@ -28,6 +28,7 @@
 
 #include "alcp/capi/cipher/builder.hh"
 #include "alcp/cipher.hh"
+#include "alcp/cipher_aead.h"
 #include "alcp/cipher/aes_build.hh"
 
 #include "alcp/cipher/aes.hh"
@@ -448,6 +449,60 @@ TEST(GCM, EncryptUpdateSingle)
     ASSERT_EQ(tag_out, tag);
 }
 
+TEST(GCM, RequestTwiceOnOneContext)
+{
+    Uint8 key[16], other_key[16], iv[12], aad[20];
+    for (Uint8 i = 0; i < 16; i++) {
+        key[i]       = i;
+        other_key[i] = 0xa0 + i;
+    }
+    for (Uint8 i = 0; i < 12; i++) {
+        iv[i] = 0x30 + i;
+    }
+    for (Uint8 i = 0; i < 20; i++) {
+        aad[i] = 0x70 + i;
+    }
+    std::vector<Uint8> ptext(100, 0x5a), out(100), expected(100);
+    std::vector<Uint8> tag(16), expected_tag(16);
+
+    GcmAEAD128 gcm_obj(key, 128);
+    gcm_obj.setIv(sizeof(iv), iv);
+    gcm_obj.setAad(aad, sizeof(aad));
+    gcm_obj.encryptUpdate(&ptext[0], &expected[0], ptext.size(), iv);
+    gcm_obj.getTag(&expected_tag[0], expected_tag.size());
+
+    alc_cipher_aead_info_t info = {};
+    info.ci_type                = ALC_CIPHER_TYPE_AES;
+    info.ci_key_info.type       = ALC_KEY_TYPE_SYMMETRIC;
+    info.ci_key_info.fmt        = ALC_KEY_FMT_RAW;
+    info.ci_key_info.len        = 128;
+    info.ci_key_info.key        = other_key;
+    info.ci_algo_info.ai_mode   = ALC_AES_MODE_GCM;
+    info.ci_algo_info.ai_iv     = iv;
+
+    std::vector<Uint8>  context(alcp_cipher_aead_context_size(&info));
+    alc_cipher_handle_t handle = { &context[0] };
+
+    ASSERT_EQ(alcp_cipher_aead_request(&info, &handle), ALC_ERROR_NONE);
+    alcp_cipher_aead_finish(&handle);
+
+    // A finished context can be requested again with a new key
+    info.ci_key_info.key = key;
+    ASSERT_EQ(alcp_cipher_aead_request(&info, &handle), ALC_ERROR_NONE);
+    EXPECT_EQ(alcp_cipher_aead_set_iv(&handle, sizeof(iv), iv),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(alcp_cipher_aead_set_aad(&handle, aad, sizeof(aad)),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(alcp_cipher_aead_encrypt_update(
+                  &handle, &ptext[0], &out[0], ptext.size(), iv),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(alcp_cipher_aead_get_tag(&handle, &tag[0], tag.size()),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(out, expected);
+    EXPECT_EQ(tag, expected_tag);
+    alcp_cipher_aead_finish(&handle);
+}
+
 TEST(GCM, EncryptUpdateMultiple)
 {
     std::vector<Uint8> key   = { 0xfe, 0xc7, 0x2f, 0xee, 0x8f, 0xc3, 0x88, 0x33,
@@ -590,6 +645,141 @@ TEST(GCM, DecryptUpdateMultiple)
     ASSERT_EQ(tag_out, tag);
 }
 
+// Records of assorted shapes, each checked against its own single stream
+TEST(GCM, EncryptDecryptRecords)
+{
+    const Uint64 lens[]     = { 0, 1, 15, 16, 17, 48, 64, 100, 255, 1000 };
+    const Uint64 aad_lens[] = { 0, 13, 20, 64 };
+    const Uint64 iv_lens[]  = { 12, 12, 12, 7, 16, 12, 19 };
+    const Uint64 count      = 21;
+
+    Uint8 key[16];
+    for (Uint8 i = 0; i < 16; i++) {
+        key[i] = 0x11 * i;
+    }
+
+    std::vector<std::vector<Uint8>> iv(count), aad(count), ptext(count),
+        ctext(count), expected(count), tag(count), expected_tag(count),
+        dtext(count);
+    std::vector<alc_cipher_aead_record_t> records(count);
+
+    GcmAEAD128 gcm_obj(key, 128);
+    for (Uint64 r = 0; r < count; r++) {
+        iv[r].resize(iv_lens[r % 7]);
+        aad[r].resize(aad_lens[r % 4]);
+        ptext[r].resize(lens[r % 10]);
+        for (Uint64 i = 0; i < iv[r].size(); i++) {
+            iv[r][i] = r * 3 + i;
+        }
+        for (Uint64 i = 0; i < aad[r].size(); i++) {
+            aad[r][i] = r + 0x40 + i;
+        }
+        for (Uint64 i = 0; i < ptext[r].size(); i++) {
+            ptext[r][i] = r * 7 + i;
+        }
+        ctext[r].resize(ptext[r].size() + 1);
+        expected[r].resize(ptext[r].size() + 1);
+        dtext[r].resize(ptext[r].size() + 1);
+        tag[r].resize(16);
+        expected_tag[r].resize(16);
+
+        gcm_obj.setIv(iv[r].size(), &iv[r][0]);
+        if (!aad[r].empty()) {
+            gcm_obj.setAad(&aad[r][0], aad[r].size());
+        }
+        if (!ptext[r].empty()) {
+            gcm_obj.encryptUpdate(
+                &ptext[r][0], &expected[r][0], ptext[r].size(), &iv[r][0]);
+        }
+        gcm_obj.getTag(&expected_tag[r][0], 16);
+
+        records[r].ar_iv      = &iv[r][0];
+        records[r].ar_iv_len  = iv[r].size();
+        records[r].ar_aad     = aad[r].data();
+        records[r].ar_aad_len = aad[r].size();
+        records[r].ar_in      = ptext[r].data();
+        records[r].ar_out     = &ctext[r][0];
+        records[r].ar_len     = ptext[r].size();
+        records[r].ar_tag     = &tag[r][0];
+        records[r].ar_tag_len = 16;
+    }
+
+    alc_cipher_aead_info_t info = {};
+    info.ci_type                = ALC_CIPHER_TYPE_AES;
+    info.ci_key_info.type       = ALC_KEY_TYPE_SYMMETRIC;
+    info.ci_key_info.fmt        = ALC_KEY_FMT_RAW;
+    info.ci_key_info.len        = 128;
+    info.ci_key_info.key        = key;
+    info.ci_algo_info.ai_mode   = ALC_AES_MODE_GCM;
+    info.ci_algo_info.ai_iv     = &iv[0][0];
+
+    std::vector<Uint8>  context(alcp_cipher_aead_context_size(&info));
+    alc_cipher_handle_t handle = { &context[0] };
+
+    ASSERT_EQ(alcp_cipher_aead_request(&info, &handle), ALC_ERROR_NONE);
+    ASSERT_EQ(alcp_cipher_aead_encrypt_records(&handle, &records[0], count),
+              ALC_ERROR_NONE);
+    for (Uint64 r = 0; r < count; r++) {
+        EXPECT_EQ(ctext[r], expected[r]) << "record " << r;
+        EXPECT_EQ(tag[r], expected_tag[r]) << "record " << r;
+    }
+
+    for (Uint64 r = 0; r < count; r++) {
+        records[r].ar_in  = ctext[r].data();
+        records[r].ar_out = &dtext[r][0];
+        std::fill(tag[r].begin(), tag[r].end(), 0);
+    }
+    ASSERT_EQ(alcp_cipher_aead_decrypt_records(&handle, &records[0], count),
+              ALC_ERROR_NONE);
+    for (Uint64 r = 0; r < count; r++) {
+        dtext[r].pop_back();
+        EXPECT_EQ(dtext[r], ptext[r]) << "record " << r;
+        EXPECT_EQ(tag[r], expected_tag[r]) << "record " << r;
+    }
+
+    // The single stream API still works on the same context
+    std::vector<Uint8> out(ptext[7].size());
+    EXPECT_EQ(alcp_cipher_aead_set_iv(&handle, iv[7].size(), &iv[7][0]),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(alcp_cipher_aead_set_aad(&handle, &aad[7][0], aad[7].size()),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(alcp_cipher_aead_encrypt_update(
+                  &handle, &ptext[7][0], &out[0], out.size(), &iv[7][0]),
+              ALC_ERROR_NONE);
+    out.push_back(0);
+    EXPECT_EQ(out, expected[7]);
+    alcp_cipher_aead_finish(&handle);
+}
+
+TEST(GCM, RecordsInvalid)
+{
+    Uint8 key[16] = {}, iv[12] = {}, tag[16];
+
+    alc_cipher_aead_info_t info = {};
+    info.ci_type                = ALC_CIPHER_TYPE_AES;
+    info.ci_key_info.type       = ALC_KEY_TYPE_SYMMETRIC;
+    info.ci_key_info.fmt        = ALC_KEY_FMT_RAW;
+    info.ci_key_info.len        = 128;
+    info.ci_key_info.key        = key;
+    info.ci_algo_info.ai_mode   = ALC_AES_MODE_GCM;
+    info.ci_algo_info.ai_iv     = iv;
+
+    std::vector<Uint8>  context(alcp_cipher_aead_context_size(&info));
+    alc_cipher_handle_t handle = { &context[0] };
+    ASSERT_EQ(alcp_cipher_aead_request(&info, &handle), ALC_ERROR_NONE);
+
+    alc_cipher_aead_record_t record = {
+        iv, sizeof(iv), nullptr, 0, nullptr, nullptr, 0, tag, 17
+    };
+    EXPECT_EQ(alcp_cipher_aead_encrypt_records(&handle, &record, 1),
+              ALC_ERROR_INVALID_SIZE);
+    record.ar_tag_len = 16;
+    record.ar_len     = 16;
+    EXPECT_TRUE(
+        alcp_is_error(alcp_cipher_aead_encrypt_records(&handle, &record, 1)));
+    alcp_cipher_aead_finish(&handle);
+}
+
 #if 0
 int
 main(int argc, char** argv)
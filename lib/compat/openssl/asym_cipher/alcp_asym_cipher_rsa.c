@@ -0,0 +1,679 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/params.h>
+#include <openssl/rand.h>
+#include <openssl/rsa.h>
+
+#include "asym_cipher/alcp_asym_cipher_prov.h"
+#include "provider/alcp_names.h"
+
+static const char ASYM_CIPHER_DEF_PROP[] = "provider=alcp,fips=no";
+
+void*
+ALCP_prov_asym_cipher_newctx(void* provctx)
+{
+    ENTER();
+    alc_prov_asym_cipher_ctx_p ctx = OPENSSL_zalloc(sizeof(*ctx));
+    if (ctx != NULL) {
+        ctx->ac_prov_ctx = provctx;
+    }
+    EXIT();
+    return ctx;
+}
+
+static void
+ALCP_prov_asym_cipher_reset(alc_prov_asym_cipher_ctx_p ctx)
+{
+    if (ctx->ac_key != NULL) {
+        ALCP_prov_rsa_handle_free(&ctx->ac_handle, ctx->ac_key->rk_key_size);
+    }
+    OPENSSL_clear_free(ctx->ac_oaep_label, ctx->ac_oaep_label_len);
+    EVP_PKEY_CTX_free(ctx->ac_fallback);
+    OSSL_PARAM_free(ctx->ac_params);
+    ctx->ac_oaep_label     = NULL;
+    ctx->ac_oaep_label_len = 0;
+    ctx->ac_handle_md      = NULL;
+    ctx->ac_handle_mgf1    = NULL;
+    ctx->ac_fallback       = NULL;
+    ctx->ac_params         = NULL;
+    ctx->ac_tls            = 0;
+}
+
+/* The MGF1 digest is the OAEP one unless set */
+static const char*
+ALCP_prov_asym_cipher_mgf1_mdname(const alc_prov_asym_cipher_ctx_t* ctx)
+{
+    return ctx->ac_mgf1_mdname[0] != '\0' ? ctx->ac_mgf1_mdname
+                                          : ctx->ac_oaep_mdname;
+}
+
+static int
+ALCP_prov_asym_cipher_uses_alcp(const alc_prov_asym_cipher_ctx_t* ctx)
+{
+    if (ctx->ac_handle.context == NULL || ctx->ac_tls) {
+        return 0;
+    }
+    switch (ctx->ac_pad_mode) {
+        case RSA_NO_PADDING:
+            return 1;
+        case RSA_PKCS1_PADDING:
+            // the implicit rejection of OpenSSL 3.2 is left to it
+            return ctx->ac_operation == EVP_PKEY_OP_ENCRYPT
+                   || !ctx->ac_implicit_rejection;
+        case RSA_PKCS1_OAEP_PADDING:
+            return ALCP_prov_rsa_digest(ctx->ac_oaep_mdname) != NULL
+                   && ALCP_prov_rsa_digest(
+                          ALCP_prov_asym_cipher_mgf1_mdname(ctx))
+                          != NULL;
+        default:
+            break;
+    }
+    return 0;
+}
+
+static int
+ALCP_prov_asym_cipher_new_fallback(alc_prov_asym_cipher_ctx_p ctx)
+{
+    int ret;
+
+    if (ctx->ac_fallback != NULL) {
+        return 1;
+    }
+    ctx->ac_fallback = ALCP_prov_rsa_fallback_ctx(ctx->ac_key);
+    if (ctx->ac_fallback == NULL) {
+        return 0;
+    }
+    ret = ctx->ac_operation == EVP_PKEY_OP_ENCRYPT
+              ? EVP_PKEY_encrypt_init(ctx->ac_fallback)
+              : EVP_PKEY_decrypt_init(ctx->ac_fallback);
+    return ret > 0
+           && (ctx->ac_params == NULL
+               || EVP_PKEY_CTX_set_params(ctx->ac_fallback, ctx->ac_params)
+                      > 0);
+}
+
+/* Hands the OAEP digests over to the session when they have changed */
+static int
+ALCP_prov_asym_cipher_oaep_digests(alc_prov_asym_cipher_ctx_p ctx)
+{
+    const alc_prov_rsa_digest_t* md;
+    const alc_prov_rsa_digest_t* mgf1;
+
+    md   = ALCP_prov_rsa_digest(ctx->ac_oaep_mdname);
+    mgf1 = ALCP_prov_rsa_digest(ALCP_prov_asym_cipher_mgf1_mdname(ctx));
+    if (md != ctx->ac_handle_md) {
+        if (alcp_is_error(alcp_rsa_add_digest(
+                &ctx->ac_handle, (alc_digest_info_p)&md->rd_info))) {
+            return 0;
+        }
+        ctx->ac_handle_md = md;
+    }
+    if (mgf1 != ctx->ac_handle_mgf1) {
+        if (alcp_is_error(alcp_rsa_add_mgf(
+                &ctx->ac_handle, (alc_digest_info_p)&mgf1->rd_info))) {
+            return 0;
+        }
+        ctx->ac_handle_mgf1 = mgf1;
+    }
+    return md->rd_hash_len;
+}
+
+static int
+ALCP_prov_asym_cipher_init(alc_prov_asym_cipher_ctx_p ctx,
+                           alc_prov_rsa_key_p         key,
+                           const OSSL_PARAM           params[],
+                           int                        operation)
+{
+    if (key == NULL) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NO_KEY_SET);
+        return 0;
+    }
+    if (operation == EVP_PKEY_OP_DECRYPT && !key->rk_has_priv) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_A_PRIVATE_KEY);
+        return 0;
+    }
+    ALCP_prov_asym_cipher_reset(ctx);
+    ctx->ac_key                = key;
+    ctx->ac_operation          = operation;
+    ctx->ac_pad_mode           = RSA_PKCS1_PADDING;
+    ctx->ac_mgf1_mdname[0]     = '\0';
+    ctx->ac_implicit_rejection = 0;
+#ifdef OSSL_ASYM_CIPHER_PARAM_IMPLICIT_REJECTION
+    ctx->ac_implicit_rejection = 1;
+#endif
+    OPENSSL_strlcpy(ctx->ac_oaep_mdname,
+                    OSSL_DIGEST_NAME_SHA1,
+                    sizeof(ctx->ac_oaep_mdname));
+
+    if (key->rk_alcp != NULL
+        && !ALCP_prov_rsa_handle_new(&ctx->ac_handle, key)) {
+        return 0;
+    }
+    return ALCP_prov_asym_cipher_set_ctx_params(ctx, params);
+}
+
+int
+ALCP_prov_asym_cipher_encrypt_init(void*            vctx,
+                                   void*            provkey,
+                                   const OSSL_PARAM params[])
+{
+    ENTER();
+    int ret = ALCP_prov_asym_cipher_init(
+        vctx, provkey, params, EVP_PKEY_OP_ENCRYPT);
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_asym_cipher_decrypt_init(void*            vctx,
+                                   void*            provkey,
+                                   const OSSL_PARAM params[])
+{
+    ENTER();
+    int ret = ALCP_prov_asym_cipher_init(
+        vctx, provkey, params, EVP_PKEY_OP_DECRYPT);
+    EXIT();
+    return ret;
+}
+
+/* EME-PKCS1-v1_5 encoding, RFC 8017 7.2.1, the padding bytes are nonzero */
+static int
+ALCP_prov_asym_cipher_pad_pkcs1(alc_prov_asym_cipher_ctx_p ctx,
+                                const Uint8*               in,
+                                size_t                     inlen,
+                                size_t                     size,
+                                Uint8*                     em)
+{
+    OSSL_LIB_CTX* libctx = ctx->ac_prov_ctx->ap_libctx;
+    size_t        ps     = size - inlen - 3;
+
+    em[0] = 0x00;
+    em[1] = 0x02;
+    if (RAND_bytes_ex(libctx, em + 2, ps, 0) <= 0) {
+        return 0;
+    }
+    for (size_t i = 2; i < ps + 2; i++) {
+        while (em[i] == 0x00) {
+            if (RAND_bytes_ex(libctx, em + i, 1, 0) <= 0) {
+                return 0;
+            }
+        }
+    }
+    em[ps + 2] = 0x00;
+    memcpy(em + ps + 3, in, inlen);
+    return 1;
+}
+
+int
+ALCP_prov_asym_cipher_encrypt(void*                vctx,
+                              unsigned char*       out,
+                              size_t*              outlen,
+                              size_t               outsize,
+                              const unsigned char* in,
+                              size_t               inlen)
+{
+    ENTER();
+    alc_prov_asym_cipher_ctx_p ctx = vctx;
+    Uint8                      em[ALCP_PROV_RSA_MAX_KEY_SIZE];
+    Uint8                      seed[ALC_DIGEST_LEN_512 / 8];
+    size_t                     size;
+    int                        hash_len, ret = 0;
+
+    if (!ALCP_prov_asym_cipher_uses_alcp(ctx)) {
+        *outlen = outsize;
+        return ALCP_prov_asym_cipher_new_fallback(ctx)
+               && EVP_PKEY_encrypt(ctx->ac_fallback, out, outlen, in, inlen)
+                      > 0;
+    }
+    size = ctx->ac_key->rk_key_size / 8;
+    if (out == NULL) {
+        *outlen = size;
+        return 1;
+    }
+    if (outsize < size) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_OUTPUT_BUFFER_TOO_SMALL);
+        return 0;
+    }
+
+    switch (ctx->ac_pad_mode) {
+        case RSA_NO_PADDING:
+            // fails for input not below the modulus
+            ret = inlen == size
+                  && !alcp_is_error(alcp_rsa_publickey_encrypt(
+                      &ctx->ac_handle, ALCP_RSA_PADDING_NONE, in, size, out));
+            break;
+        case RSA_PKCS1_PADDING:
+            ret = inlen + RSA_PKCS1_PADDING_SIZE <= size
+                  && ALCP_prov_asym_cipher_pad_pkcs1(ctx, in, inlen, size, em)
+                  && !alcp_is_error(alcp_rsa_publickey_encrypt(
+                      &ctx->ac_handle, ALCP_RSA_PADDING_NONE, em, size, out));
+            break;
+        case RSA_PKCS1_OAEP_PADDING:
+            hash_len = ALCP_prov_asym_cipher_oaep_digests(ctx);
+            ret = hash_len > 0 && inlen + 2 * hash_len + 2 <= size
+                  && RAND_bytes_ex(
+                         ctx->ac_prov_ctx->ap_libctx, seed, hash_len, 0)
+                         > 0
+                  && !alcp_is_error(
+                      alcp_rsa_publickey_encrypt_oaep(&ctx->ac_handle,
+                                                      in,
+                                                      inlen,
+                                                      ctx->ac_oaep_label,
+                                                      ctx->ac_oaep_label_len,
+                                                      seed,
+                                                      out));
+            break;
+        default:
+            break;
+    }
+    OPENSSL_cleanse(em, sizeof(em));
+    if (!ret) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_INPUT_LENGTH);
+        return 0;
+    }
+    *outlen = size;
+    EXIT();
+    return 1;
+}
+
+/* The constant time helpers of OpenSSL are not exported, all ones for true */
+static unsigned int
+ALCP_prov_ct_is_zero(unsigned int a)
+{
+    return 0 - ((~a & (a - 1)) >> (sizeof(a) * 8 - 1));
+}
+
+static unsigned int
+ALCP_prov_ct_lt(unsigned int a, unsigned int b)
+{
+    return 0 - ((a ^ ((a ^ b) | ((a - b) ^ b))) >> (sizeof(a) * 8 - 1));
+}
+
+static Uint8
+ALCP_prov_ct_select_8(unsigned int mask, Uint8 a, Uint8 b)
+{
+    return (Uint8)((mask & a) | (~mask & b));
+}
+
+/*
+ * EME-PKCS1-v1_5 decoding, RFC 8017 7.2.2. Whether the padding is right
+ * and where the message starts are not branched on, the message is shifted
+ * to the start of em in log steps as RSA_padding_check_PKCS1_type_2() does.
+ */
+static int
+ALCP_prov_asym_cipher_unpad_pkcs1(Uint8*  em,
+                                  size_t  size,
+                                  Uint8*  out,
+                                  size_t  outsize,
+                                  size_t* outlen)
+{
+    unsigned int num  = size;
+    unsigned int good = ALCP_prov_ct_is_zero(em[0])
+                        & ALCP_prov_ct_is_zero(em[1] ^ 0x02);
+    unsigned int found_zero = 0, zero_index = 0, mlen, tlen, mask;
+
+    for (unsigned int i = 2; i < num; i++) {
+        unsigned int is_zero = ALCP_prov_ct_is_zero(em[i]);
+
+        zero_index = (~found_zero & is_zero & i) | (found_zero & zero_index);
+        found_zero |= is_zero;
+    }
+    // at least 8 padding bytes
+    good &= found_zero & ~ALCP_prov_ct_lt(zero_index, 2 + 8);
+    mlen = num - zero_index - 1;
+    tlen = num - RSA_PKCS1_PADDING_SIZE;
+    if (outsize < tlen) {
+        tlen = outsize;
+    }
+    good &= ~ALCP_prov_ct_lt(tlen, mlen);
+
+    for (unsigned int shift = 1; shift < num - RSA_PKCS1_PADDING_SIZE;
+         shift <<= 1) {
+        mask = ~ALCP_prov_ct_is_zero(
+            shift & (num - RSA_PKCS1_PADDING_SIZE - mlen));
+        for (unsigned int i = RSA_PKCS1_PADDING_SIZE; i < num - shift; i++) {
+            em[i] = ALCP_prov_ct_select_8(mask, em[i + shift], em[i]);
+        }
+    }
+    for (unsigned int i = 0; i < tlen; i++) {
+        mask   = good & ALCP_prov_ct_lt(i, mlen);
+        out[i] = ALCP_prov_ct_select_8(
+            mask, em[i + RSA_PKCS1_PADDING_SIZE], out[i]);
+    }
+    *outlen = mlen;
+    return good & 1;
+}
+
+int
+ALCP_prov_asym_cipher_decrypt(void*                vctx,
+                              unsigned char*       out,
+                              size_t*              outlen,
+                              size_t               outsize,
+                              const unsigned char* in,
+                              size_t               inlen)
+{
+    ENTER();
+    alc_prov_asym_cipher_ctx_p ctx = vctx;
+    Uint8                      em[ALCP_PROV_RSA_MAX_KEY_SIZE];
+    Uint64                     len = 0;
+    size_t                     size, mlen = 0;
+    int                        ret = 0;
+
+    if (!ALCP_prov_asym_cipher_uses_alcp(ctx)) {
+        *outlen = outsize;
+        return ALCP_prov_asym_cipher_new_fallback(ctx)
+               && EVP_PKEY_decrypt(ctx->ac_fallback, out, outlen, in, inlen)
+                      > 0;
+    }
+    size = ctx->ac_key->rk_key_size / 8;
+    if (out == NULL) {
+        *outlen = size;
+        return 1;
+    }
+    if (inlen != size) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_INPUT_LENGTH);
+        return 0;
+    }
+
+    switch (ctx->ac_pad_mode) {
+        case RSA_NO_PADDING:
+            if (outsize < size) {
+                ERR_raise(ERR_LIB_PROV, PROV_R_OUTPUT_BUFFER_TOO_SMALL);
+                return 0;
+            }
+            ret = ALCP_prov_rsa_private(&ctx->ac_handle, size, in, out);
+            len = size;
+            break;
+        case RSA_PKCS1_PADDING:
+            ret = ALCP_prov_rsa_private(&ctx->ac_handle, size, in, em)
+                  && ALCP_prov_asym_cipher_unpad_pkcs1(
+                      em, size, out, outsize, &mlen);
+            len = mlen;
+            break;
+        case RSA_PKCS1_OAEP_PADDING:
+            // the message is decoded in em, its largest size is not known
+            // before
+            ret = ALCP_prov_asym_cipher_oaep_digests(ctx) > 0
+                  && !alcp_is_error(
+                      alcp_rsa_privatekey_decrypt_oaep(&ctx->ac_handle,
+                                                       in,
+                                                       size,
+                                                       ctx->ac_oaep_label,
+                                                       ctx->ac_oaep_label_len,
+                                                       em,
+                                                       &len))
+                  && len <= outsize;
+            if (ret) {
+                memcpy(out, em, len);
+            }
+            break;
+        default:
+            break;
+    }
+    OPENSSL_cleanse(em, sizeof(em));
+    if (!ret) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_BAD_DECRYPT);
+        return 0;
+    }
+    *outlen = len;
+    EXIT();
+    return 1;
+}
+
+void
+ALCP_prov_asym_cipher_freectx(void* vctx)
+{
+    ENTER();
+    alc_prov_asym_cipher_ctx_p ctx = vctx;
+    if (ctx != NULL) {
+        ALCP_prov_asym_cipher_reset(ctx);
+    }
+    OPENSSL_free(ctx);
+    EXIT();
+}
+
+void*
+ALCP_prov_asym_cipher_dupctx(void* vctx)
+{
+    ENTER();
+    alc_prov_asym_cipher_ctx_p src = vctx;
+    alc_prov_asym_cipher_ctx_p ctx = OPENSSL_memdup(src, sizeof(*src));
+    int                        ok  = 1;
+
+    if (ctx == NULL) {
+        return NULL;
+    }
+    ctx->ac_handle.context = NULL;
+    ctx->ac_handle_md      = NULL;
+    ctx->ac_handle_mgf1    = NULL;
+    ctx->ac_oaep_label     = NULL;
+    ctx->ac_params         = NULL;
+    ctx->ac_fallback       = NULL;
+
+    // the ALCP session is not copyable, a new one gets the key
+    if (src->ac_handle.context != NULL) {
+        ok = ALCP_prov_rsa_handle_new(&ctx->ac_handle, src->ac_key);
+    }
+    if (ok && src->ac_oaep_label != NULL) {
+        ctx->ac_oaep_label =
+            OPENSSL_memdup(src->ac_oaep_label, src->ac_oaep_label_len);
+        ok = ctx->ac_oaep_label != NULL;
+    }
+    if (ok && src->ac_params != NULL) {
+        ctx->ac_params = OSSL_PARAM_dup(src->ac_params);
+        ok             = ctx->ac_params != NULL;
+    }
+    if (ok && src->ac_fallback != NULL) {
+        ctx->ac_fallback = EVP_PKEY_CTX_dup(src->ac_fallback);
+        ok               = ctx->ac_fallback != NULL;
+    }
+    if (!ok) {
+        ALCP_prov_asym_cipher_freectx(ctx);
+        return NULL;
+    }
+    EXIT();
+    return ctx;
+}
+
+static int
+ALCP_prov_asym_cipher_get_name(const OSSL_PARAM* p, char* name, size_t size)
+{
+    return p == NULL || OSSL_PARAM_get_utf8_string(p, &name, size);
+}
+
+/*
+ * Every param is kept for the default provider, ALCP needs the padding and
+ * the OAEP digests and label. Asking for the TLS premaster secret checks
+ * makes the decryption fall back.
+ */
+int
+ALCP_prov_asym_cipher_set_ctx_params(void* vctx, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_asym_cipher_ctx_p ctx = vctx;
+    const OSSL_PARAM*          p;
+    void*                      label = NULL;
+    size_t                     label_len;
+    int                        pad_mode;
+
+    if (params == NULL || params[0].key == NULL) {
+        return 1;
+    }
+    if (!ALCP_prov_rsa_save_params(&ctx->ac_params, params)) {
+        return 0;
+    }
+    if (ctx->ac_fallback != NULL) {
+        return EVP_PKEY_CTX_set_params(ctx->ac_fallback, params) > 0;
+    }
+
+    p = OSSL_PARAM_locate_const(params, OSSL_ASYM_CIPHER_PARAM_PAD_MODE);
+    if (p != NULL) {
+        if (!ALCP_prov_rsa_get_pad_mode(p, &pad_mode)
+            || pad_mode == RSA_PKCS1_PSS_PADDING) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_ILLEGAL_OR_UNSUPPORTED_PADDING_MODE);
+            return 0;
+        }
+        ctx->ac_pad_mode = pad_mode;
+    }
+    if (!ALCP_prov_asym_cipher_get_name(
+            OSSL_PARAM_locate_const(params, OSSL_ASYM_CIPHER_PARAM_OAEP_DIGEST),
+            ctx->ac_oaep_mdname,
+            sizeof(ctx->ac_oaep_mdname))
+        || !ALCP_prov_asym_cipher_get_name(
+            OSSL_PARAM_locate_const(params, OSSL_ASYM_CIPHER_PARAM_MGF1_DIGEST),
+            ctx->ac_mgf1_mdname,
+            sizeof(ctx->ac_mgf1_mdname))) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_ASYM_CIPHER_PARAM_OAEP_LABEL);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_octet_string(p, &label, 0, &label_len)) {
+            return 0;
+        }
+        OPENSSL_clear_free(ctx->ac_oaep_label, ctx->ac_oaep_label_len);
+        ctx->ac_oaep_label     = label;
+        ctx->ac_oaep_label_len = label_len;
+    }
+    if (OSSL_PARAM_locate_const(params,
+                                OSSL_ASYM_CIPHER_PARAM_TLS_CLIENT_VERSION)
+            != NULL
+        || OSSL_PARAM_locate_const(
+               params, OSSL_ASYM_CIPHER_PARAM_TLS_NEGOTIATED_VERSION)
+               != NULL) {
+        ctx->ac_tls = 1;
+    }
+#ifdef OSSL_ASYM_CIPHER_PARAM_IMPLICIT_REJECTION
+    p = OSSL_PARAM_locate_const(params,
+                                OSSL_ASYM_CIPHER_PARAM_IMPLICIT_REJECTION);
+    if (p != NULL && !OSSL_PARAM_get_uint(p, &ctx->ac_implicit_rejection)) {
+        return 0;
+    }
+#endif
+    EXIT();
+    return 1;
+}
+
+int
+ALCP_prov_asym_cipher_get_ctx_params(void* vctx, OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_asym_cipher_ctx_p ctx = vctx;
+    OSSL_PARAM*                p;
+
+    if (ctx->ac_key == NULL) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NO_KEY_SET);
+        return 0;
+    }
+    // the default provider answers for everything that falls back to it
+    if (ctx->ac_fallback != NULL || !ALCP_prov_asym_cipher_uses_alcp(ctx)) {
+        return ALCP_prov_asym_cipher_new_fallback(ctx)
+               && EVP_PKEY_CTX_get_params(ctx->ac_fallback, params) > 0;
+    }
+
+    p = OSSL_PARAM_locate(params, OSSL_ASYM_CIPHER_PARAM_PAD_MODE);
+    if (p != NULL && !ALCP_prov_rsa_set_pad_mode(p, ctx->ac_pad_mode)) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_ASYM_CIPHER_PARAM_OAEP_DIGEST);
+    if (p != NULL && !OSSL_PARAM_set_utf8_string(p, ctx->ac_oaep_mdname)) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_ASYM_CIPHER_PARAM_MGF1_DIGEST);
+    if (p != NULL
+        && !OSSL_PARAM_set_utf8_string(
+            p, ALCP_prov_asym_cipher_mgf1_mdname(ctx))) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_ASYM_CIPHER_PARAM_OAEP_LABEL);
+    if (p != NULL
+        && !OSSL_PARAM_set_octet_ptr(
+            p, ctx->ac_oaep_label, ctx->ac_oaep_label_len)) {
+        return 0;
+    }
+#ifdef OSSL_ASYM_CIPHER_PARAM_IMPLICIT_REJECTION
+    p = OSSL_PARAM_locate(params, OSSL_ASYM_CIPHER_PARAM_IMPLICIT_REJECTION);
+    if (p != NULL && !OSSL_PARAM_set_uint(p, ctx->ac_implicit_rejection)) {
+        return 0;
+    }
+#endif
+    EXIT();
+    return 1;
+}
+
+const OSSL_PARAM*
+ALCP_prov_asym_cipher_gettable_ctx_params(void* vctx, void* provctx)
+{
+    static const OSSL_PARAM gettable[] = {
+        OSSL_PARAM_utf8_string(OSSL_ASYM_CIPHER_PARAM_OAEP_DIGEST, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_ASYM_CIPHER_PARAM_PAD_MODE, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_ASYM_CIPHER_PARAM_MGF1_DIGEST, NULL, 0),
+        OSSL_PARAM_octet_ptr(OSSL_ASYM_CIPHER_PARAM_OAEP_LABEL, NULL, 0),
+        OSSL_PARAM_uint(OSSL_ASYM_CIPHER_PARAM_TLS_CLIENT_VERSION, NULL),
+        OSSL_PARAM_uint(OSSL_ASYM_CIPHER_PARAM_TLS_NEGOTIATED_VERSION, NULL),
+#ifdef OSSL_ASYM_CIPHER_PARAM_IMPLICIT_REJECTION
+        OSSL_PARAM_uint(OSSL_ASYM_CIPHER_PARAM_IMPLICIT_REJECTION, NULL),
+#endif
+        OSSL_PARAM_END
+    };
+    return gettable;
+}
+
+const OSSL_PARAM*
+ALCP_prov_asym_cipher_settable_ctx_params(void* vctx, void* provctx)
+{
+    static const OSSL_PARAM settable[] = {
+        OSSL_PARAM_utf8_string(OSSL_ASYM_CIPHER_PARAM_OAEP_DIGEST, NULL, 0),
+        OSSL_PARAM_utf8_string(
+            OSSL_ASYM_CIPHER_PARAM_OAEP_DIGEST_PROPS, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_ASYM_CIPHER_PARAM_PAD_MODE, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_ASYM_CIPHER_PARAM_MGF1_DIGEST, NULL, 0),
+        OSSL_PARAM_utf8_string(
+            OSSL_ASYM_CIPHER_PARAM_MGF1_DIGEST_PROPS, NULL, 0),
+        OSSL_PARAM_octet_string(OSSL_ASYM_CIPHER_PARAM_OAEP_LABEL, NULL, 0),
+        OSSL_PARAM_uint(OSSL_ASYM_CIPHER_PARAM_TLS_CLIENT_VERSION, NULL),
+        OSSL_PARAM_uint(OSSL_ASYM_CIPHER_PARAM_TLS_NEGOTIATED_VERSION, NULL),
+#ifdef OSSL_ASYM_CIPHER_PARAM_IMPLICIT_REJECTION
+        OSSL_PARAM_uint(OSSL_ASYM_CIPHER_PARAM_IMPLICIT_REJECTION, NULL),
+#endif
+        OSSL_PARAM_END
+    };
+    return settable;
+}
+
+CREATE_ASYM_CIPHER_DISPATCHERS();
+
+const OSSL_ALGORITHM ALC_prov_asym_cipher[] = {
+    { ALCP_PROV_NAMES_RSA, ASYM_CIPHER_DEF_PROP, asym_cipher_functions },
+    { NULL, NULL, NULL },
+};
@@ -94,9 +94,12 @@ CREATE_CIPHER_DISPATCHERS(ctr, aes, EVP_CIPH_CTR_MODE, 192, false);
 CREATE_CIPHER_DISPATCHERS(ctr, aes, EVP_CIPH_CTR_MODE, 256, false);
 CREATE_CIPHER_DISPATCHERS(xts, aes, EVP_CIPH_XTS_MODE, 128, false);
 CREATE_CIPHER_DISPATCHERS(xts, aes, EVP_CIPH_XTS_MODE, 256, false);
-CREATE_CIPHER_DISPATCHERS(gcm, aes, EVP_CIPH_GCM_MODE, 128, true);
-CREATE_CIPHER_DISPATCHERS(gcm, aes, EVP_CIPH_GCM_MODE, 192, true);
-CREATE_CIPHER_DISPATCHERS(gcm, aes, EVP_CIPH_GCM_MODE, 256, true);
+CREATE_CIPHER_DISPATCHERS_EX(
+    gcm, aes, EVP_CIPH_GCM_MODE, 128, true, GCM_PIPELINE_DISPATCH);
+CREATE_CIPHER_DISPATCHERS_EX(
+    gcm, aes, EVP_CIPH_GCM_MODE, 192, true, GCM_PIPELINE_DISPATCH);
+CREATE_CIPHER_DISPATCHERS_EX(
+    gcm, aes, EVP_CIPH_GCM_MODE, 256, true, GCM_PIPELINE_DISPATCH);
 CREATE_CIPHER_DISPATCHERS(ccm, aes, EVP_CIPH_CCM_MODE, 128, true);
 CREATE_CIPHER_DISPATCHERS(ccm, aes, EVP_CIPH_CCM_MODE, 192, true);
 CREATE_CIPHER_DISPATCHERS(ccm, aes, EVP_CIPH_CCM_MODE, 256, true);
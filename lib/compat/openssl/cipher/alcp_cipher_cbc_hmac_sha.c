@@ -0,0 +1,826 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/params.h>
+#include <openssl/prov_ssl.h>
+#include <openssl/rand.h>
+
+#include "cipher/alcp_cipher_cbc_hmac_sha.h"
+
+/*
+ * AES-CBC-HMAC-SHA1/SHA256 as libssl uses them for MAC-then-encrypt TLS
+ * suites. libssl hands over the MAC key and the 13 byte AAD of each record
+ * and the library session MACs, pads and encrypts, or decrypts and checks,
+ * the whole record in one call. Without AAD the cipher is plain CBC.
+ */
+
+/* Record length of a TLS payload of len bytes, explicit IV included */
+static size_t
+ALCP_prov_cbc_hmac_sha_record_len(alc_prov_cbc_hmac_sha_ctx_p ctx,
+                                  size_t                      len)
+{
+    return (len + ctx->cs_maclen + ALCP_PROV_CBC_HMAC_SHA_BLOCK_LEN)
+           & ~(size_t)(ALCP_PROV_CBC_HMAC_SHA_BLOCK_LEN - 1);
+}
+
+static int
+ALCP_prov_cbc_hmac_sha_request(alc_prov_cbc_hmac_sha_ctx_p ctx)
+{
+    alc_key_info_t mac_kinfo = { .type = ALC_KEY_TYPE_SYMMETRIC,
+                                 .fmt  = ALC_KEY_FMT_RAW,
+                                 .algo = ALC_KEY_ALG_MAC,
+                                 .len  = ctx->cs_mac_keylen * 8,
+                                 .key  = ctx->cs_mac_key };
+    alc_cipher_aead_info_t info = {
+        .ci_type      = ALC_CIPHER_TYPE_AES,
+        .ci_key_info  = { .type     = ALC_KEY_TYPE_SYMMETRIC,
+                          .fmt      = ALC_KEY_FMT_RAW,
+                          .algo     = ALC_KEY_ALG_SYMMETRIC,
+                          .len_type = ctx->cs_keylen * 8,
+                          .len      = ctx->cs_keylen * 8,
+                          .key      = ctx->cs_key },
+        .ci_algo_info = { .ai_mode     = ctx->cs_mode,
+                          .ai_cbc_hmac = { .hi_mac_key = &mac_kinfo } },
+    };
+
+    if (ctx->cs_keyed) {
+        alcp_cipher_aead_finish(&ctx->cs_handle);
+        ctx->cs_keyed = 0;
+    }
+    if (ctx->cs_mac_key == NULL) {
+        info.ci_algo_info.ai_cbc_hmac.hi_mac_key = NULL;
+    }
+    if (alcp_is_error(alcp_cipher_aead_request(&info, &ctx->cs_handle))) {
+        // a failed request still holds the session object
+        alcp_cipher_aead_finish(&ctx->cs_handle);
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+    ctx->cs_keyed = 1;
+    return 1;
+}
+
+void*
+ALCP_prov_cbc_hmac_sha_newctx(void*             provctx,
+                              alc_cipher_mode_t mode,
+                              size_t            keylen)
+{
+    ENTER();
+    alc_prov_cbc_hmac_sha_ctx_p ctx = OPENSSL_zalloc(sizeof(*ctx));
+
+    if (ctx == NULL) {
+        EXIT();
+        return NULL;
+    }
+    // one library context serves every key of this provider context
+    ctx->cs_context = OPENSSL_zalloc(alcp_cipher_context_size(NULL));
+    if (ctx->cs_context == NULL) {
+        OPENSSL_free(ctx);
+        EXIT();
+        return NULL;
+    }
+    ctx->cs_handle.ch_context = ctx->cs_context;
+    ctx->cs_prov_ctx          = provctx;
+    ctx->cs_mode              = mode;
+    ctx->cs_keylen            = keylen;
+    ctx->cs_maclen = mode == ALC_AES_MODE_CBC_HMAC_SHA1 ? 20 : 32;
+    ctx->cs_tls_record_len = ALCP_PROV_CBC_HMAC_SHA_NO_TLS_RECORD;
+    ctx->cs_tls_fixed      = ctx->cs_maclen + ALCP_PROV_CBC_HMAC_SHA_IV_LEN;
+    EXIT();
+    return ctx;
+}
+
+void
+ALCP_prov_cbc_hmac_sha_freectx(void* vctx)
+{
+    ENTER();
+    alc_prov_cbc_hmac_sha_ctx_p ctx = vctx;
+
+    if (ctx == NULL) {
+        EXIT();
+        return;
+    }
+    if (ctx->cs_keyed) {
+        alcp_cipher_aead_finish(&ctx->cs_handle);
+    }
+    OPENSSL_clear_free(ctx->cs_mac_key, ctx->cs_mac_keylen);
+    OPENSSL_clear_free(ctx->cs_context, alcp_cipher_context_size(NULL));
+    OPENSSL_clear_free(ctx, sizeof(*ctx));
+    EXIT();
+}
+
+/*
+ * Records are complete in every call, so the only state a copy misses is
+ * the running HMAC of plain CBC updates, which is never handed out.
+ */
+void*
+ALCP_prov_cbc_hmac_sha_dupctx(void* vctx)
+{
+    ENTER();
+    alc_prov_cbc_hmac_sha_ctx_p src = vctx;
+    alc_prov_cbc_hmac_sha_ctx_p dst;
+    void*                       context;
+
+    dst = ALCP_prov_cbc_hmac_sha_newctx(
+        src->cs_prov_ctx, src->cs_mode, src->cs_keylen);
+    if (dst == NULL) {
+        EXIT();
+        return NULL;
+    }
+    context = dst->cs_context;
+    memcpy(dst, src, sizeof(*dst));
+    dst->cs_context           = context;
+    dst->cs_handle.ch_context = context;
+    dst->cs_keyed             = 0;
+    dst->cs_mac_key           = NULL;
+    if (src->cs_mac_key != NULL) {
+        dst->cs_mac_key = OPENSSL_memdup(src->cs_mac_key, src->cs_mac_keylen);
+        if (dst->cs_mac_key == NULL) {
+            ALCP_prov_cbc_hmac_sha_freectx(dst);
+            EXIT();
+            return NULL;
+        }
+    }
+    if (src->cs_keyed && !ALCP_prov_cbc_hmac_sha_request(dst)) {
+        ALCP_prov_cbc_hmac_sha_freectx(dst);
+        EXIT();
+        return NULL;
+    }
+    EXIT();
+    return dst;
+}
+
+static int
+ALCP_prov_cbc_hmac_sha_init(void*                vctx,
+                            const unsigned char* key,
+                            size_t               keylen,
+                            const unsigned char* iv,
+                            size_t               ivlen,
+                            const OSSL_PARAM     params[],
+                            int                  enc)
+{
+    ENTER();
+    alc_prov_cbc_hmac_sha_ctx_p ctx = vctx;
+
+    ctx->cs_enc            = enc;
+    ctx->cs_tls_record_len = ALCP_PROV_CBC_HMAC_SHA_NO_TLS_RECORD;
+    if (iv != NULL) {
+        if (ivlen != ALCP_PROV_CBC_HMAC_SHA_IV_LEN) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_IV_LENGTH);
+            EXIT();
+            return 0;
+        }
+        memcpy(ctx->cs_oiv, iv, ivlen);
+        memcpy(ctx->cs_iv, iv, ivlen);
+    }
+    if (key != NULL) {
+        if (keylen != ctx->cs_keylen) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY_LENGTH);
+            EXIT();
+            return 0;
+        }
+        memcpy(ctx->cs_key, key, keylen);
+        if (!ALCP_prov_cbc_hmac_sha_request(ctx)) {
+            EXIT();
+            return 0;
+        }
+    }
+    EXIT();
+    return ALCP_prov_cbc_hmac_sha_set_ctx_params(ctx, params);
+}
+
+int
+ALCP_prov_cbc_hmac_sha_encrypt_init(void*                vctx,
+                                    const unsigned char* key,
+                                    size_t               keylen,
+                                    const unsigned char* iv,
+                                    size_t               ivlen,
+                                    const OSSL_PARAM     params[])
+{
+    return ALCP_prov_cbc_hmac_sha_init(
+        vctx, key, keylen, iv, ivlen, params, 1);
+}
+
+int
+ALCP_prov_cbc_hmac_sha_decrypt_init(void*                vctx,
+                                    const unsigned char* key,
+                                    size_t               keylen,
+                                    const unsigned char* iv,
+                                    size_t               ivlen,
+                                    const OSSL_PARAM     params[])
+{
+    return ALCP_prov_cbc_hmac_sha_init(
+        vctx, key, keylen, iv, ivlen, params, 0);
+}
+
+/*
+ * Runs one call of the session from the CBC chain in cs_iv and moves the
+ * chain on to the last ciphertext block, which the output may overwrite
+ * when decrypting in place.
+ */
+static alc_error_t
+ALCP_prov_cbc_hmac_sha_cipher(alc_prov_cbc_hmac_sha_ctx_p ctx,
+                              unsigned char*              out,
+                              const unsigned char*        in,
+                              size_t                      inl,
+                              size_t                      outl)
+{
+    Uint8       chain[ALCP_PROV_CBC_HMAC_SHA_IV_LEN];
+    alc_error_t err;
+
+    err = alcp_cipher_aead_set_iv(
+        &ctx->cs_handle, sizeof(ctx->cs_iv), ctx->cs_iv);
+    if (alcp_is_error(err)) {
+        return err;
+    }
+    if (ctx->cs_enc) {
+        err = alcp_cipher_aead_encrypt_update(
+            &ctx->cs_handle, in, out, inl, ctx->cs_iv);
+        memcpy(chain, out + outl - sizeof(chain), sizeof(chain));
+    } else {
+        memcpy(chain, in + inl - sizeof(chain), sizeof(chain));
+        err = alcp_cipher_aead_decrypt_update(
+            &ctx->cs_handle, in, out, inl, ctx->cs_iv);
+    }
+    if (!alcp_is_error(err) || err == ALC_ERROR_INVALID_DATA) {
+        memcpy(ctx->cs_iv, chain, sizeof(chain));
+    }
+    return err;
+}
+
+/*
+ * A whole record, libssl has set its AAD just before. An encrypted record
+ * is as long as announced by the pad returned for the AAD. Decryption
+ * leaves the padding, the MAC and any explicit IV out of the output length
+ * once libssl has told the TLS version.
+ */
+static int
+ALCP_prov_cbc_hmac_sha_tls(alc_prov_cbc_hmac_sha_ctx_p ctx,
+                           unsigned char*              out,
+                           size_t*                     outl,
+                           const unsigned char*        in,
+                           size_t                      inl)
+{
+    size_t      plen = ctx->cs_tls_record_len;
+    size_t      trim;
+    alc_error_t err;
+
+    ctx->cs_tls_record_len = ALCP_PROV_CBC_HMAC_SHA_NO_TLS_RECORD;
+    if (ctx->cs_enc && inl != ALCP_prov_cbc_hmac_sha_record_len(ctx, plen)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_INPUT_LENGTH);
+        return 0;
+    }
+    if (inl < ALCP_PROV_CBC_HMAC_SHA_BLOCK_LEN
+        || alcp_is_error(alcp_cipher_aead_set_aad(
+            &ctx->cs_handle, ctx->cs_tls_aad, sizeof(ctx->cs_tls_aad)))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+    err = ALCP_prov_cbc_hmac_sha_cipher(
+        ctx, out, in, ctx->cs_enc ? plen : inl, inl);
+    if (err == ALC_ERROR_INVALID_DATA) {
+        // a bad record is reported by libssl, as a bad MAC
+        return 0;
+    }
+    if (alcp_is_error(err)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+
+    *outl = inl;
+    if (!ctx->cs_enc && ctx->cs_tls_version > 0) {
+        trim  = out[inl - 1] + 1 + ctx->cs_tls_fixed;
+        *outl = inl - trim;
+    }
+    return 1;
+}
+
+int
+ALCP_prov_cbc_hmac_sha_update(void*                vctx,
+                              unsigned char*       out,
+                              size_t*              outl,
+                              size_t               outsize,
+                              const unsigned char* in,
+                              size_t               inl)
+{
+    ENTER();
+    alc_prov_cbc_hmac_sha_ctx_p ctx = vctx;
+    int                         ret;
+
+    if (!ctx->cs_keyed) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NO_KEY_SET);
+        EXIT();
+        return 0;
+    }
+    if (outsize < inl) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_OUTPUT_BUFFER_TOO_SMALL);
+        EXIT();
+        return 0;
+    }
+    if (ctx->cs_tls_record_len != ALCP_PROV_CBC_HMAC_SHA_NO_TLS_RECORD) {
+        ret = ALCP_prov_cbc_hmac_sha_tls(ctx, out, outl, in, inl);
+        EXIT();
+        return ret;
+    }
+
+    *outl = inl;
+    if (inl == 0) {
+        EXIT();
+        return 1;
+    }
+    if (inl % ALCP_PROV_CBC_HMAC_SHA_BLOCK_LEN != 0) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_WRONG_FINAL_BLOCK_LENGTH);
+        EXIT();
+        return 0;
+    }
+    if (alcp_is_error(ALCP_prov_cbc_hmac_sha_cipher(ctx, out, in, inl, inl))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        EXIT();
+        return 0;
+    }
+    EXIT();
+    return 1;
+}
+
+int
+ALCP_prov_cbc_hmac_sha_final(void*          vctx,
+                             unsigned char* out,
+                             size_t*        outl,
+                             size_t         outsize)
+{
+    ENTER();
+    // records are complete in each update, there is nothing left
+    *outl = 0;
+    EXIT();
+    return 1;
+}
+
+/*
+ * Splits a multiblock write of len bytes into x4 records the way OpenSSL
+ * does, every record but the last carries frag bytes.
+ */
+static void
+ALCP_prov_cbc_hmac_sha_mb_split(size_t        len,
+                                unsigned int  x4,
+                                unsigned int* frag,
+                                unsigned int* last)
+{
+    unsigned int shift = x4 / 4 + 1;
+
+    *frag = (unsigned int)len >> shift;
+    *last = (unsigned int)len + *frag - (*frag << shift);
+    if (*last > *frag && ((*last + 13 + 9) % 64) < (x4 - 1)) {
+        (*frag)++;
+        *last -= x4 - 1;
+    }
+}
+
+/*
+ * The AAD of a multiblock write names the first record, its length field
+ * is the length of the whole write or 0 when the write is len bytes and
+ * interleave records. Only TLS 1.1 and up is taken, where every record
+ * has an explicit IV of its own.
+ */
+static int
+ALCP_prov_cbc_hmac_sha_mb_aad(alc_prov_cbc_hmac_sha_ctx_p ctx,
+                              const Uint8*                aad,
+                              size_t                      len,
+                              unsigned int                interleave)
+{
+    unsigned int inp_len = aad[11] << 8 | aad[12];
+    unsigned int n4x     = 1;
+    unsigned int frag, last;
+    size_t       packlen;
+
+    if (!ctx->cs_enc || (aad[9] << 8 | aad[10]) < TLS1_1_VERSION) {
+        return 0;
+    }
+    if (inp_len != 0) {
+        if (inp_len < 4096) {
+            return 0;
+        }
+        if (inp_len >= 8192) {
+            n4x = 2;
+        }
+    } else if ((n4x = interleave / 4) != 0 && n4x <= 2) {
+        inp_len = (unsigned int)len;
+    } else {
+        return 0;
+    }
+
+    ALCP_prov_cbc_hmac_sha_mb_split(inp_len, 4 * n4x, &frag, &last);
+    packlen = (5 + ALCP_prov_cbc_hmac_sha_record_len(
+                   ctx, ALCP_PROV_CBC_HMAC_SHA_IV_LEN + frag))
+              * (4 * n4x - 1);
+    packlen += 5
+               + ALCP_prov_cbc_hmac_sha_record_len(
+                   ctx, ALCP_PROV_CBC_HMAC_SHA_IV_LEN + last);
+
+    memcpy(ctx->cs_tls_aad, aad, sizeof(ctx->cs_tls_aad));
+    ctx->cs_mb_interleave  = 4 * n4x;
+    ctx->cs_mb_aad_packlen = packlen;
+    return 1;
+}
+
+/*
+ * Writes the records of a multiblock write, header included. The records
+ * go one after another through the same stitched kernels as single ones,
+ * each behind a random explicit IV.
+ */
+static int
+ALCP_prov_cbc_hmac_sha_mb_encrypt(alc_prov_cbc_hmac_sha_ctx_p ctx,
+                                  Uint8*                      out,
+                                  const Uint8*                in,
+                                  size_t                      len,
+                                  unsigned int                interleave)
+{
+    Uint8        aad[EVP_AEAD_TLS1_AAD_LEN];
+    Uint64       seq = 0;
+    unsigned int frag, last, i;
+    size_t       plen, rlen, total = 0;
+
+    if (interleave != 4 && interleave != 8) {
+        return 0;
+    }
+    ALCP_prov_cbc_hmac_sha_mb_split(len, interleave, &frag, &last);
+    for (i = 0; i < 8; i++) {
+        seq = seq << 8 | ctx->cs_tls_aad[i];
+    }
+    memcpy(aad, ctx->cs_tls_aad, sizeof(aad));
+
+    for (i = 0; i < interleave; i++, seq++) {
+        Uint8* rec  = out + total;
+        Uint8* body = rec + 5;
+        int    j;
+
+        plen = ALCP_PROV_CBC_HMAC_SHA_IV_LEN
+               + (i == interleave - 1 ? last : frag);
+        rlen = ALCP_prov_cbc_hmac_sha_record_len(ctx, plen);
+        for (j = 0; j < 8; j++) {
+            aad[j] = (Uint8)(seq >> (56 - 8 * j));
+        }
+        aad[11] = (Uint8)(plen >> 8);
+        aad[12] = (Uint8)plen;
+
+        if (RAND_bytes_ex(ctx->cs_prov_ctx->ap_libctx,
+                          body,
+                          ALCP_PROV_CBC_HMAC_SHA_IV_LEN,
+                          0)
+            <= 0) {
+            return 0;
+        }
+        memcpy(body + ALCP_PROV_CBC_HMAC_SHA_IV_LEN,
+               in + (size_t)i * frag,
+               plen - ALCP_PROV_CBC_HMAC_SHA_IV_LEN);
+        if (alcp_is_error(alcp_cipher_aead_set_aad(
+                &ctx->cs_handle, aad, sizeof(aad)))
+            || alcp_is_error(ALCP_prov_cbc_hmac_sha_cipher(
+                ctx, body, body, plen, rlen))) {
+            return 0;
+        }
+
+        rec[0] = aad[8];
+        rec[1] = aad[9];
+        rec[2] = aad[10];
+        rec[3] = (Uint8)(rlen >> 8);
+        rec[4] = (Uint8)rlen;
+        total += 5 + rlen;
+    }
+    ctx->cs_mb_enc_len = total;
+    return 1;
+}
+
+int
+ALCP_prov_cbc_hmac_sha_get_params(OSSL_PARAM params[], size_t keylen)
+{
+    OSSL_PARAM* p;
+
+    ENTER();
+    if (((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_MODE)) != NULL
+         && !OSSL_PARAM_set_uint(p, EVP_CIPH_CBC_MODE))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_AEAD)) != NULL
+            && !OSSL_PARAM_set_int(p, 1))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK))
+                != NULL
+            && !OSSL_PARAM_set_int(p, 1))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_KEYLEN)) != NULL
+            && !OSSL_PARAM_set_size_t(p, keylen))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_BLOCK_SIZE))
+                != NULL
+            && !OSSL_PARAM_set_size_t(p, ALCP_PROV_CBC_HMAC_SHA_BLOCK_LEN))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_IVLEN)) != NULL
+            && !OSSL_PARAM_set_size_t(p, ALCP_PROV_CBC_HMAC_SHA_IV_LEN))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_SET_PARAMETER);
+        EXIT();
+        return 0;
+    }
+    EXIT();
+    return 1;
+}
+
+static const OSSL_PARAM cbc_hmac_sha_known_gettable_params[] = {
+    OSSL_PARAM_uint(OSSL_CIPHER_PARAM_MODE, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_KEYLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_IVLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_BLOCK_SIZE, NULL),
+    OSSL_PARAM_int(OSSL_CIPHER_PARAM_AEAD, NULL),
+    OSSL_PARAM_int(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK, NULL),
+    OSSL_PARAM_END
+};
+
+const OSSL_PARAM*
+ALCP_prov_cbc_hmac_sha_gettable_params(void* provctx)
+{
+    return cbc_hmac_sha_known_gettable_params;
+}
+
+int
+ALCP_prov_cbc_hmac_sha_get_ctx_params(void* vctx, OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_cbc_hmac_sha_ctx_p ctx = vctx;
+    OSSL_PARAM*                 p;
+    size_t                      len;
+
+    p = OSSL_PARAM_locate(params,
+                          OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_MAX_BUFSIZE);
+    if (p != NULL) {
+        // header, explicit IV, payload, MAC and padding of one record
+        len = 5
+              + ALCP_prov_cbc_hmac_sha_record_len(
+                  ctx,
+                  ALCP_PROV_CBC_HMAC_SHA_IV_LEN
+                      + ctx->cs_mb_max_send_fragment);
+        if (!OSSL_PARAM_set_size_t(p, len)) {
+            goto err;
+        }
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_INTERLEAVE);
+    if (p != NULL && !OSSL_PARAM_set_uint(p, ctx->cs_mb_interleave)) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params,
+                          OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_AAD_PACKLEN);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, ctx->cs_mb_aad_packlen)) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_ENC_LEN);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, ctx->cs_mb_enc_len)) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_AEAD_TLS1_AAD_PAD);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, ctx->cs_tls_aad_pad)) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_KEYLEN);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, ctx->cs_keylen)) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_IVLEN);
+    if (p != NULL
+        && !OSSL_PARAM_set_size_t(p, ALCP_PROV_CBC_HMAC_SHA_IV_LEN)) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_IV);
+    if (p != NULL
+        && !OSSL_PARAM_set_octet_ptr(p, ctx->cs_oiv, sizeof(ctx->cs_oiv))
+        && !OSSL_PARAM_set_octet_string(
+            p, ctx->cs_oiv, sizeof(ctx->cs_oiv))) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_UPDATED_IV);
+    if (p != NULL
+        && !OSSL_PARAM_set_octet_ptr(p, ctx->cs_iv, sizeof(ctx->cs_iv))
+        && !OSSL_PARAM_set_octet_string(p, ctx->cs_iv, sizeof(ctx->cs_iv))) {
+        goto err;
+    }
+    EXIT();
+    return 1;
+
+err:
+    ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_SET_PARAMETER);
+    EXIT();
+    return 0;
+}
+
+static const OSSL_PARAM cbc_hmac_sha_known_gettable_ctx_params[] = {
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_MAX_BUFSIZE, NULL),
+    OSSL_PARAM_uint(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_INTERLEAVE, NULL),
+    OSSL_PARAM_uint(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_AAD_PACKLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_ENC_LEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_AEAD_TLS1_AAD_PAD, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_KEYLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_IVLEN, NULL),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_IV, NULL, 0),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_UPDATED_IV, NULL, 0),
+    OSSL_PARAM_END
+};
+
+const OSSL_PARAM*
+ALCP_prov_cbc_hmac_sha_gettable_ctx_params(void* cctx, void* provctx)
+{
+    return cbc_hmac_sha_known_gettable_ctx_params;
+}
+
+/*
+ * The AAD of one TLS record. Its length field is the plaintext length,
+ * explicit IV included, when encrypting and the record length when
+ * decrypting. The pad returned tells libssl how much longer the record
+ * gets, or how much of it is MAC.
+ */
+static int
+ALCP_prov_cbc_hmac_sha_tls_aad(alc_prov_cbc_hmac_sha_ctx_p ctx,
+                               const OSSL_PARAM*           p)
+{
+    const Uint8* aad = p->data;
+    size_t       len, plen;
+
+    if (p->data_type != OSSL_PARAM_OCTET_STRING
+        || p->data_size != EVP_AEAD_TLS1_AAD_LEN) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_DATA);
+        return 0;
+    }
+    memcpy(ctx->cs_tls_aad, aad, EVP_AEAD_TLS1_AAD_LEN);
+    len = (size_t)aad[EVP_AEAD_TLS1_AAD_LEN - 2] << 8
+          | aad[EVP_AEAD_TLS1_AAD_LEN - 1];
+    if (!ctx->cs_enc) {
+        ctx->cs_tls_record_len = len;
+        ctx->cs_tls_aad_pad    = ctx->cs_maclen;
+        return 1;
+    }
+
+    plen = len;
+    if ((aad[9] << 8 | aad[10]) >= TLS1_1_VERSION) {
+        if (len < ALCP_PROV_CBC_HMAC_SHA_IV_LEN) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_INPUT_LENGTH);
+            return 0;
+        }
+        plen -= ALCP_PROV_CBC_HMAC_SHA_IV_LEN;
+    }
+    ctx->cs_tls_record_len = len;
+    ctx->cs_tls_aad_pad = ALCP_prov_cbc_hmac_sha_record_len(ctx, plen) - plen;
+    return 1;
+}
+
+int
+ALCP_prov_cbc_hmac_sha_set_ctx_params(void* vctx, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_cbc_hmac_sha_ctx_p ctx = vctx;
+    const OSSL_PARAM*           p;
+    const OSSL_PARAM*           p_in;
+    const OSSL_PARAM*           p_interleave;
+    unsigned int                interleave;
+    size_t                      len;
+
+    if (params == NULL) {
+        EXIT();
+        return 1;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_KEYLEN);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_size_t(p, &len)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+            EXIT();
+            return 0;
+        }
+        if (len != ctx->cs_keylen) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY_LENGTH);
+            EXIT();
+            return 0;
+        }
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_AEAD_MAC_KEY);
+    if (p != NULL) {
+        if (p->data_type != OSSL_PARAM_OCTET_STRING) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+            EXIT();
+            return 0;
+        }
+        OPENSSL_clear_free(ctx->cs_mac_key, ctx->cs_mac_keylen);
+        ctx->cs_mac_keylen = 0;
+        ctx->cs_mac_key    = OPENSSL_memdup(p->data, p->data_size);
+        if (ctx->cs_mac_key == NULL && p->data_size != 0) {
+            EXIT();
+            return 0;
+        }
+        ctx->cs_mac_keylen = p->data_size;
+        // the MAC key is part of the session, a keyed one starts over
+        if (ctx->cs_keyed && !ALCP_prov_cbc_hmac_sha_request(ctx)) {
+            EXIT();
+            return 0;
+        }
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_TLS_VERSION);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_uint(p, &ctx->cs_tls_version)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+            EXIT();
+            return 0;
+        }
+        // no explicit IV before TLS 1.1
+        ctx->cs_tls_fixed = ctx->cs_maclen;
+        if (ctx->cs_tls_version != SSL3_VERSION
+            && ctx->cs_tls_version != TLS1_VERSION) {
+            ctx->cs_tls_fixed += ALCP_PROV_CBC_HMAC_SHA_IV_LEN;
+        }
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_AEAD_TLS1_AAD);
+    if (p != NULL && !ALCP_prov_cbc_hmac_sha_tls_aad(ctx, p)) {
+        EXIT();
+        return 0;
+    }
+
+    p = OSSL_PARAM_locate_const(
+        params, OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_MAX_SEND_FRAGMENT);
+    if (p != NULL
+        && !OSSL_PARAM_get_size_t(p, &ctx->cs_mb_max_send_fragment)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+        EXIT();
+        return 0;
+    }
+    p_interleave = OSSL_PARAM_locate_const(
+        params, OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_INTERLEAVE);
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_AAD);
+    if (p != NULL) {
+        if (p->data_type != OSSL_PARAM_OCTET_STRING || p_interleave == NULL
+            || !OSSL_PARAM_get_uint(p_interleave, &interleave)
+            || !ALCP_prov_cbc_hmac_sha_mb_aad(
+                ctx, p->data, p->data_size, interleave)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_SET_PARAMETER);
+            EXIT();
+            return 0;
+        }
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_ENC);
+    if (p != NULL) {
+        p_in = OSSL_PARAM_locate_const(
+            params, OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_ENC_IN);
+        if (!ctx->cs_keyed || p->data_type != OSSL_PARAM_OCTET_STRING
+            || p_in == NULL || p_in->data_type != OSSL_PARAM_OCTET_STRING
+            || p_interleave == NULL
+            || !OSSL_PARAM_get_uint(p_interleave, &interleave)
+            || !ALCP_prov_cbc_hmac_sha_mb_encrypt(
+                ctx, p->data, p_in->data, p_in->data_size, interleave)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_SET_PARAMETER);
+            EXIT();
+            return 0;
+        }
+    }
+    EXIT();
+    return 1;
+}
+
+static const OSSL_PARAM cbc_hmac_sha_known_settable_ctx_params[] = {
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_AEAD_MAC_KEY, NULL, 0),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_AEAD_TLS1_AAD, NULL, 0),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_MAX_SEND_FRAGMENT,
+                      NULL),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_AAD, NULL, 0),
+    OSSL_PARAM_uint(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_INTERLEAVE, NULL),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_ENC, NULL, 0),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_TLS1_MULTIBLOCK_ENC_IN, NULL, 0),
+    OSSL_PARAM_uint(OSSL_CIPHER_PARAM_TLS_VERSION, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_KEYLEN, NULL),
+    OSSL_PARAM_END
+};
+
+const OSSL_PARAM*
+ALCP_prov_cbc_hmac_sha_settable_ctx_params(void* cctx, void* provctx)
+{
+    return cbc_hmac_sha_known_settable_ctx_params;
+}
+
+CREATE_CBC_HMAC_SHA_DISPATCHERS(sha1, ALC_AES_MODE_CBC_HMAC_SHA1, 128);
+CREATE_CBC_HMAC_SHA_DISPATCHERS(sha1, ALC_AES_MODE_CBC_HMAC_SHA1, 256);
+CREATE_CBC_HMAC_SHA_DISPATCHERS(sha256, ALC_AES_MODE_CBC_HMAC_SHA256, 128);
+CREATE_CBC_HMAC_SHA_DISPATCHERS(sha256, ALC_AES_MODE_CBC_HMAC_SHA256, 256);
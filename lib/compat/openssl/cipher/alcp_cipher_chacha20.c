@@ -0,0 +1,839 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/params.h>
+
+#include "cipher/alcp_cipher_chacha20.h"
+
+/*
+ * The ChaCha20 session keeps no position between calls, every call starts at
+ * the block counter of the IV it was handed. The provider carries the counter
+ * forward in cc_iv and keeps what is left of the keystream of a partial block
+ * so that a stream can be split over any number of updates.
+ */
+
+static int
+ALCP_prov_chacha20_request(alc_prov_chacha20_ctx_p ctx, const Uint8* key)
+{
+    alc_key_info_t kinfo = { .type     = ALC_KEY_TYPE_SYMMETRIC,
+                             .fmt      = ALC_KEY_FMT_RAW,
+                             .algo     = ALC_KEY_ALG_SYMMETRIC,
+                             .len_type = ALC_KEY_LEN_256,
+                             .len      = ALC_KEY_LEN_256,
+                             .key      = key };
+    alc_error_t    err;
+
+    if (ctx->cc_keyed) {
+        if (ctx->cc_aead) {
+            alcp_cipher_aead_finish(&ctx->cc_handle);
+        } else {
+            alcp_cipher_finish(&ctx->cc_handle);
+        }
+        ctx->cc_keyed = 0;
+    }
+
+    if (ctx->cc_aead) {
+        alc_cipher_aead_info_t info = {
+            .ci_type      = ALC_CIPHER_TYPE_CHACHA20,
+            .ci_key_info  = kinfo,
+            .ci_algo_info = { .ai_mode = ALC_CHACHA20_POLY1305 },
+        };
+        err = alcp_cipher_aead_request(&info, &ctx->cc_handle);
+    } else {
+        alc_cipher_info_t info = {
+            .ci_type      = ALC_CIPHER_TYPE_CHACHA20,
+            .ci_key_info  = kinfo,
+            .ci_algo_info = { .ai_mode   = ALC_AES_MODE_NONE,
+                              .ai_iv     = ctx->cc_iv,
+                              .iv_length = ALCP_PROV_CHACHA20_IV_LEN * 8 },
+        };
+        err = alcp_cipher_request(&info, &ctx->cc_handle);
+    }
+    if (alcp_is_error(err)) {
+        // a failed request still holds the session object
+        if (ctx->cc_aead) {
+            alcp_cipher_aead_finish(&ctx->cc_handle);
+        } else {
+            alcp_cipher_finish(&ctx->cc_handle);
+        }
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+    memcpy(ctx->cc_key, key, sizeof(ctx->cc_key));
+    ctx->cc_keyed   = 1;
+    ctx->cc_started = 0;
+    return 1;
+}
+
+static void*
+ALCP_prov_chacha20_newctx_common(void* provctx, int aead)
+{
+    ENTER();
+    alc_prov_chacha20_ctx_p ctx = OPENSSL_zalloc(sizeof(*ctx));
+
+    if (ctx == NULL) {
+        EXIT();
+        return NULL;
+    }
+    // one library context serves every key of this provider context
+    ctx->cc_context = OPENSSL_zalloc(alcp_cipher_context_size(NULL));
+    if (ctx->cc_context == NULL) {
+        OPENSSL_free(ctx);
+        EXIT();
+        return NULL;
+    }
+    ctx->cc_handle.ch_context = ctx->cc_context;
+    ctx->cc_prov_ctx          = provctx;
+    ctx->cc_aead              = aead;
+    ctx->cc_ivlen             = aead ? ALCP_PROV_CHACHA20_POLY1305_IVLEN
+                                     : ALCP_PROV_CHACHA20_IV_LEN;
+    ctx->cc_taglen            = ALCP_PROV_CHACHA20_POLY1305_TAGLEN;
+    ctx->cc_keystream_off     = ALCP_PROV_CHACHA20_BLOCK_LEN;
+    ctx->cc_tls_payload_len   = ALCP_PROV_CHACHA20_NO_TLS_PAYLOAD;
+    EXIT();
+    return ctx;
+}
+
+static OSSL_FUNC_cipher_newctx_fn ALCP_prov_chacha20_newctx;
+static void*
+ALCP_prov_chacha20_newctx(void* provctx)
+{
+    return ALCP_prov_chacha20_newctx_common(provctx, 0);
+}
+
+static OSSL_FUNC_cipher_newctx_fn ALCP_prov_chacha20_poly1305_newctx;
+static void*
+ALCP_prov_chacha20_poly1305_newctx(void* provctx)
+{
+    return ALCP_prov_chacha20_newctx_common(provctx, 1);
+}
+
+void
+ALCP_prov_chacha20_freectx(void* vctx)
+{
+    ENTER();
+    alc_prov_chacha20_ctx_p ctx = vctx;
+
+    if (ctx == NULL) {
+        EXIT();
+        return;
+    }
+    if (ctx->cc_keyed) {
+        if (ctx->cc_aead) {
+            alcp_cipher_aead_finish(&ctx->cc_handle);
+        } else {
+            alcp_cipher_finish(&ctx->cc_handle);
+        }
+    }
+    OPENSSL_clear_free(ctx->cc_context, alcp_cipher_context_size(NULL));
+    OPENSSL_clear_free(ctx, sizeof(*ctx));
+    EXIT();
+}
+
+/*
+ * The Poly1305 state of an AEAD message can not be copied out of the
+ * library, so a context is only duplicated between messages.
+ */
+void*
+ALCP_prov_chacha20_dupctx(void* vctx)
+{
+    ENTER();
+    alc_prov_chacha20_ctx_p src = vctx;
+    alc_prov_chacha20_ctx_p dst;
+
+    if (src->cc_aead && src->cc_started) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_SUPPORTED);
+        EXIT();
+        return NULL;
+    }
+    dst = ALCP_prov_chacha20_newctx_common(src->cc_prov_ctx, src->cc_aead);
+    if (dst == NULL) {
+        EXIT();
+        return NULL;
+    }
+    memcpy(dst->cc_iv, src->cc_iv, sizeof(dst->cc_iv));
+    memcpy(dst->cc_keystream, src->cc_keystream, sizeof(dst->cc_keystream));
+    memcpy(dst->cc_tag, src->cc_tag, sizeof(dst->cc_tag));
+    memcpy(dst->cc_tls_aad, src->cc_tls_aad, sizeof(dst->cc_tls_aad));
+    dst->cc_enc             = src->cc_enc;
+    dst->cc_iv_set          = src->cc_iv_set;
+    dst->cc_ivlen           = src->cc_ivlen;
+    dst->cc_keystream_off   = src->cc_keystream_off;
+    dst->cc_taglen          = src->cc_taglen;
+    dst->cc_tls_payload_len = src->cc_tls_payload_len;
+    dst->cc_tls_aad_pad     = src->cc_tls_aad_pad;
+    if (src->cc_keyed && !ALCP_prov_chacha20_request(dst, src->cc_key)) {
+        ALCP_prov_chacha20_freectx(dst);
+        EXIT();
+        return NULL;
+    }
+    EXIT();
+    return dst;
+}
+
+static int
+ALCP_prov_chacha20_set_iv(alc_prov_chacha20_ctx_p ctx,
+                          const unsigned char*    iv,
+                          size_t                  ivlen)
+{
+    if (ivlen != ctx->cc_ivlen) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_IV_LENGTH);
+        return 0;
+    }
+    memcpy(ctx->cc_iv, iv, ivlen);
+    ctx->cc_keystream_off = ALCP_PROV_CHACHA20_BLOCK_LEN;
+    ctx->cc_started       = 0;
+    ctx->cc_iv_set        = 1;
+    return 1;
+}
+
+static OSSL_FUNC_cipher_set_ctx_params_fn ALCP_prov_chacha20_set_ctx_params;
+
+static int
+ALCP_prov_chacha20_init(void*                vctx,
+                        const unsigned char* key,
+                        size_t               keylen,
+                        const unsigned char* iv,
+                        size_t               ivlen,
+                        const OSSL_PARAM     params[],
+                        int                  enc)
+{
+    ENTER();
+    alc_prov_chacha20_ctx_p ctx = vctx;
+
+    ctx->cc_enc             = enc;
+    ctx->cc_tls_payload_len = ALCP_PROV_CHACHA20_NO_TLS_PAYLOAD;
+    if (iv != NULL && !ALCP_prov_chacha20_set_iv(ctx, iv, ivlen)) {
+        EXIT();
+        return 0;
+    }
+    if (key != NULL) {
+        if (keylen != ALCP_PROV_CHACHA20_KEY_LEN) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY_LENGTH);
+            EXIT();
+            return 0;
+        }
+        if (!ALCP_prov_chacha20_request(ctx, key)) {
+            EXIT();
+            return 0;
+        }
+    }
+    EXIT();
+    return ALCP_prov_chacha20_set_ctx_params(ctx, params);
+}
+
+static OSSL_FUNC_cipher_encrypt_init_fn ALCP_prov_chacha20_encrypt_init;
+static int
+ALCP_prov_chacha20_encrypt_init(void*                vctx,
+                                const unsigned char* key,
+                                size_t               keylen,
+                                const unsigned char* iv,
+                                size_t               ivlen,
+                                const OSSL_PARAM     params[])
+{
+    return ALCP_prov_chacha20_init(vctx, key, keylen, iv, ivlen, params, 1);
+}
+
+static OSSL_FUNC_cipher_decrypt_init_fn ALCP_prov_chacha20_decrypt_init;
+static int
+ALCP_prov_chacha20_decrypt_init(void*                vctx,
+                                const unsigned char* key,
+                                size_t               keylen,
+                                const unsigned char* iv,
+                                size_t               ivlen,
+                                const OSSL_PARAM     params[])
+{
+    return ALCP_prov_chacha20_init(vctx, key, keylen, iv, ivlen, params, 0);
+}
+
+/* Moves the 32 bit little endian block counter of cc_iv on by blocks */
+static void
+ALCP_prov_chacha20_add_counter(alc_prov_chacha20_ctx_p ctx, Uint64 blocks)
+{
+    Uint32 counter = (Uint32)ctx->cc_iv[0] | (Uint32)ctx->cc_iv[1] << 8
+                     | (Uint32)ctx->cc_iv[2] << 16
+                     | (Uint32)ctx->cc_iv[3] << 24;
+
+    counter += (Uint32)blocks;
+    ctx->cc_iv[0] = (Uint8)counter;
+    ctx->cc_iv[1] = (Uint8)(counter >> 8);
+    ctx->cc_iv[2] = (Uint8)(counter >> 16);
+    ctx->cc_iv[3] = (Uint8)(counter >> 24);
+}
+
+static int
+ALCP_prov_chacha20_stream(alc_prov_chacha20_ctx_p ctx,
+                          unsigned char*          out,
+                          const unsigned char*    in,
+                          size_t                  inl)
+{
+    static const Uint8 zeroes[ALCP_PROV_CHACHA20_BLOCK_LEN] = { 0 };
+    size_t             n;
+
+    // finish the block left over by the previous update
+    while (inl != 0 && ctx->cc_keystream_off < ALCP_PROV_CHACHA20_BLOCK_LEN) {
+        *out++ = *in++ ^ ctx->cc_keystream[ctx->cc_keystream_off++];
+        inl--;
+    }
+    if (inl == 0) {
+        return 1;
+    }
+
+    n = inl - inl % ALCP_PROV_CHACHA20_BLOCK_LEN;
+    if (n != 0) {
+        if (alcp_is_error(alcp_cipher_set_iv(
+                &ctx->cc_handle, ALCP_PROV_CHACHA20_IV_LEN, ctx->cc_iv))
+            || alcp_is_error(alcp_cipher_encrypt(
+                &ctx->cc_handle, in, out, n, ctx->cc_iv))) {
+            return 0;
+        }
+        ALCP_prov_chacha20_add_counter(ctx, n / ALCP_PROV_CHACHA20_BLOCK_LEN);
+        in += n;
+        out += n;
+        inl -= n;
+    }
+    if (inl == 0) {
+        return 1;
+    }
+
+    // keystream of the last partial block is kept for the next update
+    if (alcp_is_error(alcp_cipher_set_iv(
+            &ctx->cc_handle, ALCP_PROV_CHACHA20_IV_LEN, ctx->cc_iv))
+        || alcp_is_error(alcp_cipher_encrypt(&ctx->cc_handle,
+                                             zeroes,
+                                             ctx->cc_keystream,
+                                             sizeof(ctx->cc_keystream),
+                                             ctx->cc_iv))) {
+        return 0;
+    }
+    ALCP_prov_chacha20_add_counter(ctx, 1);
+    for (ctx->cc_keystream_off = 0; ctx->cc_keystream_off < inl;
+         ctx->cc_keystream_off++) {
+        out[ctx->cc_keystream_off] =
+            in[ctx->cc_keystream_off]
+            ^ ctx->cc_keystream[ctx->cc_keystream_off];
+    }
+    return 1;
+}
+
+/* Hands the nonce to the AEAD session before the first AAD or data */
+static int
+ALCP_prov_chacha20_poly1305_start(alc_prov_chacha20_ctx_p ctx,
+                                  const Uint8*            nonce)
+{
+    if (ctx->cc_started) {
+        return 1;
+    }
+    if (alcp_is_error(alcp_cipher_aead_set_iv(
+            &ctx->cc_handle, ALCP_PROV_CHACHA20_POLY1305_IVLEN, nonce))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+    ctx->cc_started = 1;
+    return 1;
+}
+
+/*
+ * A whole TLS 1.2 record, RFC 7905: the nonce is the fixed IV with the
+ * sequence number of the AAD XORed into its last 8 bytes and the tag
+ * follows the payload. Decryption returns the payload length only.
+ */
+static int
+ALCP_prov_chacha20_poly1305_tls(alc_prov_chacha20_ctx_p ctx,
+                                unsigned char*          out,
+                                size_t*                 outl,
+                                const unsigned char*    in,
+                                size_t                  inl)
+{
+    Uint8       nonce[ALCP_PROV_CHACHA20_POLY1305_IVLEN];
+    Uint8       tag[ALCP_PROV_CHACHA20_POLY1305_TAGLEN];
+    size_t      plen = ctx->cc_tls_payload_len;
+    alc_error_t err  = ALC_ERROR_NONE;
+    int         i;
+
+    ctx->cc_tls_payload_len = ALCP_PROV_CHACHA20_NO_TLS_PAYLOAD;
+    if (inl != plen + sizeof(tag)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_INPUT_LENGTH);
+        return 0;
+    }
+    memcpy(nonce, ctx->cc_iv, sizeof(nonce));
+    for (i = 0; i < 8; i++) {
+        nonce[4 + i] ^= ctx->cc_tls_aad[i];
+    }
+    ctx->cc_started = 0;
+    if (!ALCP_prov_chacha20_poly1305_start(ctx, nonce)) {
+        return 0;
+    }
+    // the record nonce is used up, the next message starts from cc_iv
+    ctx->cc_started = 0;
+
+    err = alcp_cipher_aead_set_aad(
+        &ctx->cc_handle, ctx->cc_tls_aad, sizeof(ctx->cc_tls_aad));
+    if (!alcp_is_error(err) && plen != 0 && ctx->cc_enc) {
+        err = alcp_cipher_aead_encrypt_update(
+            &ctx->cc_handle, in, out, plen, nonce);
+    } else if (!alcp_is_error(err) && plen != 0) {
+        err = alcp_cipher_aead_decrypt_update(
+            &ctx->cc_handle, in, out, plen, nonce);
+    }
+    if (!alcp_is_error(err)) {
+        err = alcp_cipher_aead_get_tag(&ctx->cc_handle, tag, sizeof(tag));
+    }
+    if (alcp_is_error(err)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+
+    if (ctx->cc_enc) {
+        memcpy(out + plen, tag, sizeof(tag));
+        *outl = inl;
+        return 1;
+    }
+    if (CRYPTO_memcmp(tag, in + plen, sizeof(tag)) != 0) {
+        OPENSSL_cleanse(out, plen);
+        return 0;
+    }
+    *outl = plen;
+    return 1;
+}
+
+static int
+ALCP_prov_chacha20_poly1305_update(alc_prov_chacha20_ctx_p ctx,
+                                   unsigned char*          out,
+                                   const unsigned char*    in,
+                                   size_t                  inl)
+{
+    alc_error_t err;
+
+    if (!ctx->cc_iv_set) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+    if (!ALCP_prov_chacha20_poly1305_start(ctx, ctx->cc_iv)) {
+        return 0;
+    }
+    if (out == NULL) {
+        err = alcp_cipher_aead_set_aad(&ctx->cc_handle, in, inl);
+    } else if (ctx->cc_enc) {
+        err = alcp_cipher_aead_encrypt_update(
+            &ctx->cc_handle, in, out, inl, ctx->cc_iv);
+    } else {
+        err = alcp_cipher_aead_decrypt_update(
+            &ctx->cc_handle, in, out, inl, ctx->cc_iv);
+    }
+    if (alcp_is_error(err)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+    return 1;
+}
+
+int
+ALCP_prov_chacha20_update(void*                vctx,
+                          unsigned char*       out,
+                          size_t*              outl,
+                          size_t               outsize,
+                          const unsigned char* in,
+                          size_t               inl)
+{
+    ENTER();
+    alc_prov_chacha20_ctx_p ctx = vctx;
+    int                     ret;
+
+    if (!ctx->cc_keyed) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NO_KEY_SET);
+        EXIT();
+        return 0;
+    }
+    if (out != NULL && outsize < inl) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_OUTPUT_BUFFER_TOO_SMALL);
+        EXIT();
+        return 0;
+    }
+    if (ctx->cc_aead
+        && ctx->cc_tls_payload_len != ALCP_PROV_CHACHA20_NO_TLS_PAYLOAD
+        && out != NULL) {
+        ret = ALCP_prov_chacha20_poly1305_tls(ctx, out, outl, in, inl);
+        EXIT();
+        return ret;
+    }
+
+    *outl = inl;
+    if (inl == 0) {
+        EXIT();
+        return 1;
+    }
+    if (ctx->cc_aead) {
+        ret = ALCP_prov_chacha20_poly1305_update(ctx, out, in, inl);
+    } else if (!ctx->cc_iv_set) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        ret = 0;
+    } else {
+        ret = ALCP_prov_chacha20_stream(ctx, out, in, inl);
+        if (!ret) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        }
+    }
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_chacha20_final(void*          vctx,
+                         unsigned char* out,
+                         size_t*        outl,
+                         size_t         outsize)
+{
+    ENTER();
+    alc_prov_chacha20_ctx_p ctx = vctx;
+    Uint8                   tag[ALCP_PROV_CHACHA20_POLY1305_TAGLEN];
+    int                     ret = 1;
+
+    *outl = 0;
+    if (!ctx->cc_aead
+        || ctx->cc_tls_payload_len != ALCP_PROV_CHACHA20_NO_TLS_PAYLOAD) {
+        EXIT();
+        return 1;
+    }
+    if (!ctx->cc_keyed || !ctx->cc_iv_set) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NO_KEY_SET);
+        EXIT();
+        return 0;
+    }
+    if (!ALCP_prov_chacha20_poly1305_start(ctx, ctx->cc_iv)) {
+        EXIT();
+        return 0;
+    }
+    ctx->cc_started = 0;
+    if (alcp_is_error(
+            alcp_cipher_aead_get_tag(&ctx->cc_handle, tag, sizeof(tag)))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        EXIT();
+        return 0;
+    }
+    if (ctx->cc_enc) {
+        memcpy(ctx->cc_tag, tag, sizeof(tag));
+    } else if (CRYPTO_memcmp(tag, ctx->cc_tag, ctx->cc_taglen) != 0) {
+        ret = 0;
+    }
+    OPENSSL_cleanse(tag, sizeof(tag));
+    EXIT();
+    return ret;
+}
+
+static int
+ALCP_prov_chacha20_get_params_common(OSSL_PARAM params[], int aead)
+{
+    OSSL_PARAM* p;
+    size_t      ivlen = aead ? ALCP_PROV_CHACHA20_POLY1305_IVLEN
+                             : ALCP_PROV_CHACHA20_IV_LEN;
+
+    ENTER();
+    if (((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_MODE)) != NULL
+         && !OSSL_PARAM_set_uint(p, 0))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_AEAD)) != NULL
+            && !OSSL_PARAM_set_int(p, aead))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_CUSTOM_IV))
+                != NULL
+            && !OSSL_PARAM_set_int(p, 1))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_KEYLEN)) != NULL
+            && !OSSL_PARAM_set_size_t(p, ALCP_PROV_CHACHA20_KEY_LEN))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_BLOCK_SIZE))
+                != NULL
+            && !OSSL_PARAM_set_size_t(p, 1))
+        || ((p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_IVLEN)) != NULL
+            && !OSSL_PARAM_set_size_t(p, ivlen))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_SET_PARAMETER);
+        EXIT();
+        return 0;
+    }
+    EXIT();
+    return 1;
+}
+
+static OSSL_FUNC_cipher_get_params_fn ALCP_prov_chacha20_get_params;
+static int
+ALCP_prov_chacha20_get_params(OSSL_PARAM params[])
+{
+    return ALCP_prov_chacha20_get_params_common(params, 0);
+}
+
+static OSSL_FUNC_cipher_get_params_fn ALCP_prov_chacha20_poly1305_get_params;
+static int
+ALCP_prov_chacha20_poly1305_get_params(OSSL_PARAM params[])
+{
+    return ALCP_prov_chacha20_get_params_common(params, 1);
+}
+
+static const OSSL_PARAM chacha20_known_gettable_params[] = {
+    OSSL_PARAM_uint(OSSL_CIPHER_PARAM_MODE, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_KEYLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_IVLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_BLOCK_SIZE, NULL),
+    OSSL_PARAM_int(OSSL_CIPHER_PARAM_AEAD, NULL),
+    OSSL_PARAM_int(OSSL_CIPHER_PARAM_CUSTOM_IV, NULL),
+    OSSL_PARAM_END
+};
+
+const OSSL_PARAM*
+ALCP_prov_chacha20_gettable_params(void* provctx)
+{
+    return chacha20_known_gettable_params;
+}
+
+static OSSL_FUNC_cipher_get_ctx_params_fn ALCP_prov_chacha20_get_ctx_params;
+static int
+ALCP_prov_chacha20_get_ctx_params(void* vctx, OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_chacha20_ctx_p ctx = vctx;
+    OSSL_PARAM*             p;
+
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_IVLEN);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, ctx->cc_ivlen)) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_KEYLEN);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, ALCP_PROV_CHACHA20_KEY_LEN)) {
+        goto err;
+    }
+    if (!ctx->cc_aead) {
+        EXIT();
+        return 1;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_AEAD_TAGLEN);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, ctx->cc_taglen)) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_AEAD_TLS1_AAD_PAD);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, ctx->cc_tls_aad_pad)) {
+        goto err;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_AEAD_TAG);
+    if (p != NULL) {
+        if (p->data_type != OSSL_PARAM_OCTET_STRING) {
+            goto err;
+        }
+        if (!ctx->cc_enc || p->data_size == 0
+            || p->data_size > sizeof(ctx->cc_tag)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_TAG_LENGTH);
+            EXIT();
+            return 0;
+        }
+        memcpy(p->data, ctx->cc_tag, p->data_size);
+    }
+    EXIT();
+    return 1;
+
+err:
+    ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_SET_PARAMETER);
+    EXIT();
+    return 0;
+}
+
+static const OSSL_PARAM chacha20_known_gettable_ctx_params[] = {
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_KEYLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_IVLEN, NULL),
+    OSSL_PARAM_END
+};
+
+static const OSSL_PARAM chacha20_poly1305_known_gettable_ctx_params[] = {
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_KEYLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_IVLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_AEAD_TAGLEN, NULL),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_AEAD_TAG, NULL, 0),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_AEAD_TLS1_AAD_PAD, NULL),
+    OSSL_PARAM_END
+};
+
+static OSSL_FUNC_cipher_gettable_ctx_params_fn
+    ALCP_prov_chacha20_gettable_ctx_params;
+static const OSSL_PARAM*
+ALCP_prov_chacha20_gettable_ctx_params(void* cctx, void* provctx)
+{
+    return chacha20_known_gettable_ctx_params;
+}
+
+static OSSL_FUNC_cipher_gettable_ctx_params_fn
+    ALCP_prov_chacha20_poly1305_gettable_ctx_params;
+static const OSSL_PARAM*
+ALCP_prov_chacha20_poly1305_gettable_ctx_params(void* cctx, void* provctx)
+{
+    return chacha20_poly1305_known_gettable_ctx_params;
+}
+
+/*
+ * The AAD of a TLS 1.2 record announces the record; its length field
+ * loses the tag when decrypting. The tag length is returned as the pad.
+ */
+static int
+ALCP_prov_chacha20_poly1305_tls_aad(alc_prov_chacha20_ctx_p ctx,
+                                    const OSSL_PARAM*       p)
+{
+    Uint8* aad = ctx->cc_tls_aad;
+    size_t len;
+
+    if (p->data_type != OSSL_PARAM_OCTET_STRING
+        || p->data_size != EVP_AEAD_TLS1_AAD_LEN) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_DATA);
+        return 0;
+    }
+    memcpy(aad, p->data, EVP_AEAD_TLS1_AAD_LEN);
+    len = (size_t)aad[EVP_AEAD_TLS1_AAD_LEN - 2] << 8
+          | aad[EVP_AEAD_TLS1_AAD_LEN - 1];
+    if (!ctx->cc_enc) {
+        if (len < ALCP_PROV_CHACHA20_POLY1305_TAGLEN) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_INPUT_LENGTH);
+            return 0;
+        }
+        len -= ALCP_PROV_CHACHA20_POLY1305_TAGLEN;
+        aad[EVP_AEAD_TLS1_AAD_LEN - 2] = (Uint8)(len >> 8);
+        aad[EVP_AEAD_TLS1_AAD_LEN - 1] = (Uint8)len;
+    }
+    ctx->cc_tls_payload_len = len;
+    ctx->cc_tls_aad_pad     = ALCP_PROV_CHACHA20_POLY1305_TAGLEN;
+    return 1;
+}
+
+static int
+ALCP_prov_chacha20_set_ctx_params(void* vctx, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_chacha20_ctx_p ctx = vctx;
+    const OSSL_PARAM*       p;
+    size_t                  len;
+
+    if (params == NULL) {
+        EXIT();
+        return 1;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_KEYLEN);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_size_t(p, &len)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+            EXIT();
+            return 0;
+        }
+        if (len != ALCP_PROV_CHACHA20_KEY_LEN) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY_LENGTH);
+            EXIT();
+            return 0;
+        }
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_IVLEN);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_size_t(p, &len)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+            EXIT();
+            return 0;
+        }
+        if (len != ctx->cc_ivlen) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_IV_LENGTH);
+            EXIT();
+            return 0;
+        }
+    }
+    if (!ctx->cc_aead) {
+        EXIT();
+        return 1;
+    }
+
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_AEAD_TAG);
+    if (p != NULL) {
+        if (p->data_type != OSSL_PARAM_OCTET_STRING || p->data_size == 0
+            || p->data_size > sizeof(ctx->cc_tag)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_TAG_LENGTH);
+            EXIT();
+            return 0;
+        }
+        if (p->data != NULL) {
+            if (ctx->cc_enc) {
+                ERR_raise(ERR_LIB_PROV, PROV_R_TAG_NOT_NEEDED);
+                EXIT();
+                return 0;
+            }
+            memcpy(ctx->cc_tag, p->data, p->data_size);
+        }
+        ctx->cc_taglen = p->data_size;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_AEAD_TLS1_AAD);
+    if (p != NULL && !ALCP_prov_chacha20_poly1305_tls_aad(ctx, p)) {
+        EXIT();
+        return 0;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_AEAD_TLS1_IV_FIXED);
+    if (p != NULL) {
+        if (p->data_type != OSSL_PARAM_OCTET_STRING
+            || p->data_size != ALCP_PROV_CHACHA20_POLY1305_IVLEN
+            || !ALCP_prov_chacha20_set_iv(ctx, p->data, p->data_size)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_IV_LENGTH);
+            EXIT();
+            return 0;
+        }
+    }
+    EXIT();
+    return 1;
+}
+
+static const OSSL_PARAM chacha20_known_settable_ctx_params[] = {
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_KEYLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_IVLEN, NULL),
+    OSSL_PARAM_END
+};
+
+static const OSSL_PARAM chacha20_poly1305_known_settable_ctx_params[] = {
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_KEYLEN, NULL),
+    OSSL_PARAM_size_t(OSSL_CIPHER_PARAM_IVLEN, NULL),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_AEAD_TAG, NULL, 0),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_AEAD_TLS1_AAD, NULL, 0),
+    OSSL_PARAM_octet_string(OSSL_CIPHER_PARAM_AEAD_TLS1_IV_FIXED, NULL, 0),
+    OSSL_PARAM_END
+};
+
+static OSSL_FUNC_cipher_settable_ctx_params_fn
+    ALCP_prov_chacha20_settable_ctx_params;
+static const OSSL_PARAM*
+ALCP_prov_chacha20_settable_ctx_params(void* cctx, void* provctx)
+{
+    return chacha20_known_settable_ctx_params;
+}
+
+static OSSL_FUNC_cipher_settable_ctx_params_fn
+    ALCP_prov_chacha20_poly1305_settable_ctx_params;
+static const OSSL_PARAM*
+ALCP_prov_chacha20_poly1305_settable_ctx_params(void* cctx, void* provctx)
+{
+    return chacha20_poly1305_known_settable_ctx_params;
+}
+
+CREATE_CHACHA20_DISPATCHERS(chacha20);
+CREATE_CHACHA20_DISPATCHERS(chacha20_poly1305);
@@ -27,19 +27,68 @@
  */
 #include <inttypes.h>
 
+#include "cipher/alcp_cipher_cbc_hmac_sha.h"
+#include "cipher/alcp_cipher_chacha20.h"
 #include "cipher/alcp_cipher_prov.h"
 #include "provider/alcp_names.h"
 
+/* Stands in for the key when OpenSSL speed probes with keylen 0 */
+static const Uint8 s_zero_key[32] = { 0 };
+
+#ifdef OSSL_FUNC_CIPHER_PIPELINE_ENCRYPT_INIT
+/* EVP_MAX_PIPES */
+#define ALCP_PROV_MAX_PIPES 32
+
+/*
+ * Pipelined AES-GCM, every pipe is an independent record with its own IV,
+ * AAD and tag. The AAD is copied as it comes in a separate update, the tags
+ * are exchanged through OSSL_CIPHER_PARAM_PIPELINE_AEAD_TAG.
+ */
+struct _alc_prov_cipher_pipe
+{
+    size_t pp_numpipes;
+    bool   pp_done;    /* the data update has run */
+    bool   pp_tag_set; /* expected tags of a decrypt are known */
+    size_t pp_taglen;
+    Uint8  pp_iv[ALCP_PROV_MAX_PIPES][EVP_MAX_IV_LENGTH];
+    Uint8  pp_tag[ALCP_PROV_MAX_PIPES][EVP_GCM_TLS_TAG_LEN];
+    Uint8  pp_exp_tag[ALCP_PROV_MAX_PIPES][EVP_GCM_TLS_TAG_LEN];
+    Uint8* pp_aad;
+    size_t pp_aad_size;
+
+    alc_cipher_aead_record_t pp_records[ALCP_PROV_MAX_PIPES];
+};
+typedef struct _alc_prov_cipher_pipe alc_prov_cipher_pipe_t,
+    *alc_prov_cipher_pipe_p;
+#endif
+
+static void
+ALCP_prov_cipher_release(alc_prov_cipher_ctx_p cctx)
+{
+    if (cctx->pc_keyed) {
+        if (cctx->is_aead) {
+            alcp_cipher_aead_finish(&cctx->handle);
+        } else {
+            alcp_cipher_finish(&cctx->handle);
+        }
+        cctx->pc_keyed = false;
+    }
+}
+
 void
 ALCP_prov_cipher_freectx(void* vctx)
 {
     alc_prov_cipher_ctx_p pcctx = vctx;
     ENTER();
 
-    if (pcctx->handle.ch_context != NULL) {
-        OPENSSL_free(pcctx->handle.ch_context);
-        pcctx->handle.ch_context = NULL;
+    ALCP_prov_cipher_release(pcctx);
+#ifdef OSSL_FUNC_CIPHER_PIPELINE_ENCRYPT_INIT
+    if (pcctx->pc_pipe != NULL) {
+        OPENSSL_free(pcctx->pc_pipe->pp_aad);
+        OPENSSL_clear_free(pcctx->pc_pipe, sizeof(*pcctx->pc_pipe));
+        pcctx->pc_pipe = NULL;
     }
+#endif
     /*
      * pcctx->pc_evp_cipher will be  freed in provider teardown,
      */
@@ -55,11 +104,18 @@ ALCP_prov_cipher_newctx(void* vprovctx, const void* cinfo, bool is_aead)
 {
     alc_prov_cipher_ctx_p ciph_ctx;
     alc_prov_ctx_p        pctx = (alc_prov_ctx_p)vprovctx;
+    Uint64                ctx_size;
 
     ENTER();
-    ciph_ctx = OPENSSL_zalloc(sizeof(*ciph_ctx));
+    if (is_aead) {
+        ctx_size = alcp_cipher_aead_context_size((alc_cipher_aead_info_p)cinfo);
+    } else {
+        ctx_size = alcp_cipher_context_size((alc_cipher_info_p)cinfo);
+    }
+    ciph_ctx = OPENSSL_zalloc(sizeof(*ciph_ctx) + ctx_size);
 
     if (ciph_ctx != NULL) {
+        ciph_ctx->handle.ch_context = ciph_ctx->pc_context;
         ciph_ctx->pc_prov_ctx = pctx;
         // ciph_ctx->pc_params         = pparams;
         ciph_ctx->pc_libctx = pctx->ap_libctx;
@@ -82,14 +138,41 @@ ALCP_prov_cipher_newctx(void* vprovctx, const void* cinfo, bool is_aead)
     return ciph_ctx;
 }
 
+/*
+ * A requested cipher lives in library objects that can not be copied, so a
+ * context is only duplicated before it is keyed.
+ */
 void*
 ALCP_prov_cipher_dupctx(void* vctx)
 {
     ENTER();
-    // FIXME: Implement
     alc_prov_cipher_ctx_p csrc = vctx;
+    alc_prov_cipher_ctx_p cdst;
+    const void*           cinfo;
+    EVP_CIPHER_CTX*       evp_ctx;
+
+    if (csrc->pc_keyed) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_SUPPORTED);
+        EXIT();
+        return NULL;
+    }
+    cinfo = csrc->is_aead ? (const void*)&csrc->pc_cipher_aead_info
+                          : (const void*)&csrc->pc_cipher_info;
+    cdst  = ALCP_prov_cipher_newctx(csrc->pc_prov_ctx, cinfo, csrc->is_aead);
+    if (cdst == NULL) {
+        EXIT();
+        return NULL;
+    }
+    // Every pointer but the owned ones is shared with the source
+    evp_ctx = cdst->pc_evp_cipher_ctx;
+    memcpy(cdst, csrc, sizeof(*cdst));
+    cdst->handle.ch_context = cdst->pc_context;
+    cdst->pc_evp_cipher_ctx = evp_ctx;
+#ifdef OSSL_FUNC_CIPHER_PIPELINE_ENCRYPT_INIT
+    cdst->pc_pipe = NULL;
+#endif
     EXIT();
-    return csrc;
+    return cdst;
 }
 
 /*-
@@ -231,6 +314,28 @@ ALCP_prov_cipher_get_ctx_params(void* vctx, OSSL_PARAM params[])
         alcp_cipher_aead_get_tag(&(cctx->handle), (Uint8*)tag, used_length);
     }
 
+#ifdef OSSL_FUNC_CIPHER_PIPELINE_ENCRYPT_INIT
+    // Tags of all pipes, into the array of buffers the param points to
+    p = OSSL_PARAM_locate(params, OSSL_CIPHER_PARAM_PIPELINE_AEAD_TAG);
+    if (p != NULL) {
+        alc_prov_cipher_pipe_p pipe = cctx->pc_pipe;
+        unsigned char**        tags = p->data;
+
+        if (p->data_type != OSSL_PARAM_OCTET_PTR || pipe == NULL
+            || !pipe->pp_done || !cctx->enc_flag) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+            return 0;
+        }
+        if (p->data_size == 0 || p->data_size > EVP_GCM_TLS_TAG_LEN) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_TAG_LENGTH);
+            return 0;
+        }
+        for (size_t i = 0; i < pipe->pp_numpipes; i++) {
+            memcpy(tags[i], pipe->pp_tag[i], p->data_size);
+        }
+    }
+#endif
+
     EXIT();
     return 1;
 }
@@ -288,10 +393,147 @@ ALCP_prov_cipher_set_ctx_params(void* vctx, const OSSL_PARAM params[])
     printf("Provider: Got tag with size:%d\n", cctx->taglen);
 #endif
 
+#ifdef OSSL_FUNC_CIPHER_PIPELINE_ENCRYPT_INIT
+    // Expected tags of all pipes, checked by the pipeline final
+    p = OSSL_PARAM_locate_const(params, OSSL_CIPHER_PARAM_PIPELINE_AEAD_TAG);
+    if (p != NULL) {
+        alc_prov_cipher_pipe_p pipe = cctx->pc_pipe;
+        unsigned char**        tags = p->data;
+
+        if (p->data_type != OSSL_PARAM_OCTET_PTR || pipe == NULL
+            || cctx->enc_flag) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_SET_PARAMETER);
+            return 0;
+        }
+        if (p->data_size == 0 || p->data_size > EVP_GCM_TLS_TAG_LEN) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_TAG_LENGTH);
+            return 0;
+        }
+        for (size_t i = 0; i < pipe->pp_numpipes; i++) {
+            memcpy(pipe->pp_exp_tag[i], tags[i], p->data_size);
+        }
+        pipe->pp_taglen  = p->data_size;
+        pipe->pp_tag_set = true;
+    }
+#endif
+
     EXIT();
     return 1;
 }
 
+/*
+ * Key the library cipher kept in cctx->pc_context. A cipher requested by an
+ * earlier init is finished first, so re-initialising a reused
+ * EVP_CIPHER_CTX does not allocate any provider memory.
+ */
+static int
+ALCP_prov_cipher_set_key(alc_prov_cipher_ctx_p cctx,
+                         const unsigned char*  key,
+                         size_t                keylen)
+{
+    alc_cipher_info_p      cinfo             = &cctx->pc_cipher_info;
+    alc_cipher_aead_info_p c_aeadinfo        = &cctx->pc_cipher_aead_info;
+    alc_key_info_p         kinfo_siv_ctr_key = &cctx->kinfo_siv_ctr_key;
+    alc_error_t            err;
+
+    if (cctx->is_aead) {
+        c_aeadinfo->ci_key_info.key  = key;
+        c_aeadinfo->ci_key_info.fmt  = ALC_KEY_FMT_RAW;
+        c_aeadinfo->ci_key_info.type = ALC_KEY_TYPE_SYMMETRIC;
+
+        // OpenSSL Speed likes to keep keylen 0
+        if (keylen != 0) {
+            c_aeadinfo->ci_key_info.len = keylen;
+        } else {
+            c_aeadinfo->ci_key_info.len = 128;
+            c_aeadinfo->ci_key_info.key = s_zero_key;
+        }
+    } else {
+        cinfo->ci_key_info.key  = key;
+        cinfo->ci_key_info.fmt  = ALC_KEY_FMT_RAW;
+        cinfo->ci_key_info.type = ALC_KEY_TYPE_SYMMETRIC;
+
+        // OpenSSL Speed likes to keep keylen 0
+        if (keylen != 0) {
+            cinfo->ci_key_info.len = keylen;
+        } else {
+            cinfo->ci_key_info.len = 128;
+            cinfo->ci_key_info.key = s_zero_key;
+        }
+    }
+
+#ifdef DEBUG
+    printf("Provider: %d keylen:%ld, key:%p\n",
+           cctx->is_aead ? c_aeadinfo->ci_key_info.len : cinfo->ci_key_info.len,
+           keylen,
+           key);
+#endif
+    // For AES XTS Mode, the tweak key follows the key
+    if ((!cctx->is_aead) && cinfo->ci_algo_info.ai_mode == ALC_AES_MODE_XTS) {
+        if (!((keylen == 128) || (keylen == 256))) {
+
+#ifdef DEBUG
+            printf("Provider: Unsupported Key Length %ld in AES XTS Mode of "
+                   "Operation\n",
+                   keylen);
+#endif
+            // Return with error
+            return 0;
+        }
+    }
+    if (cctx->is_aead) {
+        err = alcp_cipher_aead_supported(c_aeadinfo);
+    } else {
+        err = alcp_cipher_supported(cinfo);
+    }
+    // Check for support
+    if (alcp_is_error(err)) {
+        printf("Provider: Not supported algorithm!\n");
+        return 0;
+    }
+#ifdef DEBUG
+    else {
+        printf("Provider: Support success!\n");
+    }
+#endif
+
+    // For SIV, Authentication Key assumed to be same length as Decryption
+    // Key Hence not modifying cinfo->ci_key_info.key or
+    // cinfo->ci_key_info.len
+    if (cctx->is_aead
+        && (c_aeadinfo->ci_algo_info.ai_mode == ALC_AES_MODE_SIV)) {
+        // For openSSL SIV encryption and authentication key needs to be in
+        // continous memory location. Second part of the key is
+        // authentication key
+        kinfo_siv_ctr_key->len                     = keylen;
+        kinfo_siv_ctr_key->key                     = key + (keylen / 8);
+        c_aeadinfo->ci_algo_info.ai_siv.xi_ctr_key = kinfo_siv_ctr_key;
+    }
+
+    ALCP_prov_cipher_release(cctx);
+
+    if (cctx->is_aead) {
+        // Request handle for the cipher
+        err = alcp_cipher_aead_request(c_aeadinfo, &(cctx->handle));
+
+    } else {
+        // Request handle for the cipher
+        err = alcp_cipher_request(cinfo, &(cctx->handle));
+    }
+    if (alcp_is_error(err)) {
+        printf("Provider: Request somehow failed!\n");
+        return 0;
+    }
+#ifdef DEBUG
+    else {
+        printf("Provider: Request success!\n");
+    }
+#endif
+    cctx->pc_keyed = true;
+
+    return 1;
+}
+
 int
 ALCP_prov_cipher_encrypt_init(void*                vctx,
                               const unsigned char* key,
@@ -302,10 +544,9 @@ ALCP_prov_cipher_encrypt_init(void*                vctx,
 {
     ENTER();
     const OSSL_PARAM*      p;
-    alc_prov_cipher_ctx_p  cctx              = vctx;
-    alc_cipher_info_p      cinfo             = &cctx->pc_cipher_info;
-    alc_cipher_aead_info_p c_aeadinfo        = &cctx->pc_cipher_aead_info;
-    alc_key_info_p         kinfo_siv_ctr_key = &cctx->kinfo_siv_ctr_key;
+    alc_prov_cipher_ctx_p  cctx       = vctx;
+    alc_cipher_info_p      cinfo      = &cctx->pc_cipher_info;
+    alc_cipher_aead_info_p c_aeadinfo = &cctx->pc_cipher_aead_info;
     alc_error_t            err;
 
     // Locate TAG
@@ -385,110 +626,22 @@ ALCP_prov_cipher_encrypt_init(void*                vctx,
     if (iv != NULL) {
         if (cctx->is_aead) {
             cctx->pc_cipher_aead_info.ci_algo_info.ai_iv = iv;
-
         } else {
             cctx->pc_cipher_info.ci_algo_info.ai_iv = iv;
         }
     }
-    if (cctx->is_aead) {
-        cctx->pc_cipher_aead_info.ci_key_info.key  = key;
-        cctx->pc_cipher_aead_info.ci_key_info.fmt  = ALC_KEY_FMT_RAW;
-        cctx->pc_cipher_aead_info.ci_key_info.type = ALC_KEY_TYPE_SYMMETRIC;
-
-        // OpenSSL Speed likes to keep keylen 0
-        if (keylen != 0) {
-            cctx->pc_cipher_aead_info.ci_key_info.len = keylen;
-        } else {
-            cctx->pc_cipher_aead_info.ci_key_info.len = 128;
-            cctx->pc_cipher_aead_info.ci_key_info.key = OPENSSL_malloc(128);
-        }
-    } else {
-        cctx->pc_cipher_info.ci_key_info.key  = key;
-        cctx->pc_cipher_info.ci_key_info.fmt  = ALC_KEY_FMT_RAW;
-        cctx->pc_cipher_info.ci_key_info.type = ALC_KEY_TYPE_SYMMETRIC;
-
-        // OpenSSL Speed likes to keep keylen 0
-        if (keylen != 0) {
-            cctx->pc_cipher_info.ci_key_info.len = keylen;
-        } else {
-            cctx->pc_cipher_info.ci_key_info.len = 128;
-            cctx->pc_cipher_info.ci_key_info.key = OPENSSL_malloc(128);
-        }
-    }
-
-#ifdef DEBUG
-    printf("Provider: %d keylen:%ld, key:%p\n",
-           cctx->is_aead ? c_aeadinfo->ci_key_info.len : cinfo->ci_key_info.len,
-           keylen,
-           key);
-#endif
-    // For AES XTS Mode, get the tweak key
-    if ((!cctx->is_aead) && cinfo->ci_algo_info.ai_mode == ALC_AES_MODE_XTS) {
-        if (!key) {
-            // For handling when openssl speed probes the code with null key
-            return 1;
-        }
-        if (!((keylen == 128) || (keylen == 256))) {
+    // Enable Encryption Mode
+    cctx->enc_flag = true;
 
-#ifdef DEBUG
-            printf("Provider: Unsupported Key Length %ld in AES XTS Mode of "
-                   "Operation\n",
-                   keylen);
-#endif
-            // Return with error
+    if (key != NULL) {
+        if (!ALCP_prov_cipher_set_key(cctx, key, keylen)) {
             return 0;
         }
+    } else if (!cctx->pc_keyed) {
+        // Key comes with a later init, e.g. after the IV length is set
+        return 1;
     }
-    if (cctx->is_aead) {
-        err = alcp_cipher_aead_supported(c_aeadinfo);
-    } else {
-        err = alcp_cipher_supported(cinfo);
-    }
-    // Check for support
-    if (alcp_is_error(err)) {
-        printf("Provider: Not supported algorithm!\n");
-        return 0;
-    }
-#ifdef DEBUG
-    else {
-        printf("Provider: Support success!\n");
-    }
-#endif
-
-    // Manually allocate context
-    (cctx->handle).ch_context =
-        OPENSSL_malloc(cctx->is_aead ? alcp_cipher_aead_context_size(c_aeadinfo)
-                                     : alcp_cipher_context_size(cinfo));
-    // For SIV, Authentication Key assumed to be same length as Decryption
-    // Key Hence not modifying cinfo->ci_key_info.key or
-    // cinfo->ci_key_info.len
-    if (cctx->is_aead
-        && (c_aeadinfo->ci_algo_info.ai_mode == ALC_AES_MODE_SIV)) {
-        // For openSSL SIV encryption and authentication key needs to be in
-        // continous memory location. Second part of the key is
-        // authentication key
-        kinfo_siv_ctr_key->len                     = keylen;
-        kinfo_siv_ctr_key->key                     = key + (keylen / 8);
-        c_aeadinfo->ci_algo_info.ai_siv.xi_ctr_key = kinfo_siv_ctr_key;
-    }
-
-    if (cctx->is_aead) {
-        // Request handle for the cipher
-        err = alcp_cipher_aead_request(c_aeadinfo, &(cctx->handle));
-
-    } else {
-        // Request handle for the cipher
-        err = alcp_cipher_request(cinfo, &(cctx->handle));
-    }
-    if (alcp_is_error(err)) {
-        printf("Provider: Request somehow failed!\n");
-        return 0;
-    }
-#ifdef DEBUG
-    else {
-        printf("Provider: Request success!\n");
-    }
-#endif
+    // A NULL key keeps the current cipher, only the IV is reloaded
     if (!cctx->is_aead && cinfo->ci_algo_info.ai_mode == ALC_AES_MODE_XTS) {
         if (cctx->pc_cipher_info.ci_algo_info.ai_iv != NULL) {
             cctx->ivlen = ivlen;
@@ -501,14 +654,12 @@ ALCP_prov_cipher_encrypt_init(void*                vctx,
             return 0;
         }
     }
-    // Enable Encryption Mode
-    cctx->enc_flag = true;
 
     if (cctx->is_aead && c_aeadinfo->ci_algo_info.ai_mode == ALC_AES_MODE_GCM) {
 #ifdef DEBUG
         printf("Provider: cctx->ivlen : %lu\n", cctx->ivlen);
 #endif
-        if (key != NULL && iv != NULL) {
+        if (iv != NULL) {
             if (cctx->ivlen != 0) {
                 err = alcp_cipher_aead_set_iv(
                     &(cctx->handle),
@@ -528,7 +679,6 @@ ALCP_prov_cipher_encrypt_init(void*                vctx,
 #endif
     cctx->add_inititalized = false;
     EXIT();
-
     return 1;
 }
 
@@ -634,119 +784,18 @@ ALCP_prov_cipher_decrypt_init(void*                vctx,
     } else {
         // iv = OPENSSL_malloc(128); // Don't make sense
     }
+    // Enable Decryption Mode
+    cctx->enc_flag = false;
 
-    if (cctx->is_aead) {
-
-        cctx->pc_cipher_aead_info.ci_key_info.key  = key;
-        cctx->pc_cipher_aead_info.ci_key_info.fmt  = ALC_KEY_FMT_RAW;
-        cctx->pc_cipher_aead_info.ci_key_info.type = ALC_KEY_TYPE_SYMMETRIC;
-
-        // Special handling for XTS Keylen is required if the below code is
-        // ever commented out OpenSSL Speed likes to keep keylen 0
-        if (keylen != 0) {
-            cctx->pc_cipher_aead_info.ci_key_info.len = keylen;
-        } else {
-            cctx->pc_cipher_aead_info.ci_key_info.len = 128;
-            cctx->pc_cipher_aead_info.ci_key_info.key = OPENSSL_malloc(128);
-        }
-    }
-
-    else {
-
-        cctx->pc_cipher_info.ci_key_info.key  = key;
-        cctx->pc_cipher_info.ci_key_info.fmt  = ALC_KEY_FMT_RAW;
-        cctx->pc_cipher_info.ci_key_info.type = ALC_KEY_TYPE_SYMMETRIC;
-
-        // Special handling for XTS Keylen is required if the below code is
-        // ever commented out OpenSSL Speed likes to keep keylen 0
-        if (keylen != 0) {
-            cctx->pc_cipher_info.ci_key_info.len = keylen;
-        } else {
-            cctx->pc_cipher_info.ci_key_info.len = 128;
-            cctx->pc_cipher_info.ci_key_info.key = OPENSSL_malloc(128);
-        }
-    }
-
-#ifdef DEBUG
-    printf("Provider: %d keylen:%ld, key:%p\n",
-           cctx->is_aead ? c_aeadinfo->ci_key_info.len : cinfo->ci_key_info.len,
-           keylen,
-           iv);
-#endif
-
-    // For AES XTS Mode, get the tweak key
-    if ((!cctx->is_aead) && cinfo->ci_algo_info.ai_mode == ALC_AES_MODE_XTS) {
-        if (!key) {
-            // For handling when openssl speed probes the code with null key
-            return 1;
-        }
-        if (!((keylen == 128) || (keylen == 256))) {
-
-#ifdef DEBUG
-            printf("Provider: Unsupported Key Length %ld in AES XTS Mode of "
-                   "Operation\n",
-                   keylen);
-#endif
-            // Return with error
+    if (key != NULL) {
+        if (!ALCP_prov_cipher_set_key(cctx, key, keylen)) {
             return 0;
         }
+    } else if (!cctx->pc_keyed) {
+        // Key comes with a later init, e.g. after the IV length is set
+        return 1;
     }
-
-    alc_key_info_p kinfo_siv_ctr_key = &cctx->kinfo_siv_ctr_key;
-
-    // For SIV, Authentication Key assumed to be same length as Encryption
-    // Key Hence not modifying cinfo->ci_key_info.key or
-    // cinfo->ci_key_info.len
-    if (cctx->is_aead && c_aeadinfo->ci_algo_info.ai_mode == ALC_AES_MODE_SIV) {
-        // For openSSL SIV encryption and authentication key need to be in
-        // continous memory location. Second part of the key is
-        // authentication key
-        kinfo_siv_ctr_key->len                     = keylen;
-        kinfo_siv_ctr_key->key                     = key + (keylen / 8);
-        c_aeadinfo->ci_algo_info.ai_siv.xi_ctr_key = kinfo_siv_ctr_key;
-    }
-
-    if (cctx->is_aead) {
-        err = alcp_cipher_aead_supported(c_aeadinfo);
-
-    } else {
-
-        // Check for support
-        err = alcp_cipher_supported(cinfo);
-    }
-    if (alcp_is_error(err)) {
-        printf("Provider: Not supported algorithm!\n");
-        return 0;
-    }
-#ifdef DEBUG
-    else {
-        printf("Provider: Support success!\n");
-    }
-#endif
-
-    // Manually allocate context
-    (cctx->handle).ch_context =
-        OPENSSL_malloc(cctx->is_aead ? alcp_cipher_aead_context_size(c_aeadinfo)
-                                     : alcp_cipher_context_size(cinfo));
-
-    if (cctx->is_aead) {
-        // Request handle for the aead
-        err = alcp_cipher_aead_request(c_aeadinfo, &(cctx->handle));
-
-    } else {
-
-        // Request handle for the cipher
-        err = alcp_cipher_request(cinfo, &(cctx->handle));
-    }
-    if (alcp_is_error(err)) {
-        printf("Provider: Request somehow failed!\n");
-        return 0;
-    }
-#ifdef DEBUG
-    else {
-        printf("Provider: Request success!\n");
-    }
-#endif
+    // A NULL key keeps the current cipher, only the IV is reloaded
     if (!cctx->is_aead && cinfo->ci_algo_info.ai_mode == ALC_AES_MODE_XTS) {
         if (cctx->pc_cipher_info.ci_algo_info.ai_iv != NULL) {
             cctx->ivlen = ivlen;
@@ -759,11 +808,9 @@ ALCP_prov_cipher_decrypt_init(void*                vctx,
             return 0;
         }
     }
-    // Enable Encryption Mode
-    cctx->enc_flag = false;
 
     if (cctx->is_aead && c_aeadinfo->ci_algo_info.ai_mode == ALC_AES_MODE_GCM) {
-        if (key != NULL && iv != NULL) {
+        if (iv != NULL) {
             if (ivlen != 0) {
                 err = alcp_cipher_aead_set_iv(
                     &(cctx->handle),
@@ -777,6 +824,7 @@ ALCP_prov_cipher_decrypt_init(void*                vctx,
             }
         }
     }
+
     cctx->add_inititalized = false;
     EXIT();
     return 1;
@@ -949,16 +997,238 @@ ALCP_prov_cipher_final(void*          vctx,
                        size_t         outsize)
 {
     ENTER();
-    // alc_prov_cipher_ctx_p cctx = vctx;
-
-    // TODO: Introduce Finish here for finalising the context and
-    // handle the corresponding memory issues.
-    // alcp_cipher_finish(&cctx->handle);
+    // The keyed cipher is kept for the next init on this context, it is
+    // finished on re-key or in freectx.
     // Nothing to do!
     *outl = 0;
     return 1;
 }
 
+#ifdef OSSL_FUNC_CIPHER_PIPELINE_ENCRYPT_INIT
+static int
+ALCP_prov_gcm_pipeline_init(alc_prov_cipher_ctx_p cctx,
+                            const unsigned char*  key,
+                            size_t                keylen,
+                            size_t                numpipes,
+                            const unsigned char** iv,
+                            size_t                ivlen,
+                            const OSSL_PARAM      params[],
+                            bool                  enc)
+{
+    alc_prov_cipher_pipe_p pipe = cctx->pc_pipe;
+
+    if (numpipes == 0 || numpipes > ALCP_PROV_MAX_PIPES) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_TOO_MANY_RECORDS);
+        return 0;
+    }
+    if (iv == NULL || ivlen == 0 || ivlen > EVP_MAX_IV_LENGTH) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_IV_LENGTH);
+        return 0;
+    }
+
+    if (pipe == NULL) {
+        pipe = OPENSSL_zalloc(sizeof(*pipe));
+        if (pipe == NULL) {
+            return 0;
+        }
+        cctx->pc_pipe = pipe;
+    }
+
+    // OpenSSL passes the key length in bytes here
+    if (key != NULL) {
+        if (!ALCP_prov_cipher_set_key(cctx, key, keylen * 8)) {
+            return 0;
+        }
+    } else if (!cctx->pc_keyed) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NO_KEY_SET);
+        return 0;
+    }
+    cctx->enc_flag = enc;
+
+    memset(pipe->pp_records, 0, sizeof(pipe->pp_records));
+    for (size_t i = 0; i < numpipes; i++) {
+        alc_cipher_aead_record_p rec = &pipe->pp_records[i];
+
+        memcpy(pipe->pp_iv[i], iv[i], ivlen);
+        rec->ar_iv      = pipe->pp_iv[i];
+        rec->ar_iv_len  = ivlen;
+        rec->ar_tag     = pipe->pp_tag[i];
+        rec->ar_tag_len = EVP_GCM_TLS_TAG_LEN;
+    }
+    pipe->pp_numpipes = numpipes;
+    pipe->pp_done     = false;
+    pipe->pp_tag_set  = false;
+
+    if (params != NULL) {
+        return ALCP_prov_cipher_set_ctx_params(cctx, params);
+    }
+    return 1;
+}
+
+int
+ALCP_prov_gcm_pipeline_encrypt_init(void*                 vctx,
+                                    const unsigned char*  key,
+                                    size_t                keylen,
+                                    size_t                numpipes,
+                                    const unsigned char** iv,
+                                    size_t                ivlen,
+                                    const OSSL_PARAM      params[])
+{
+    ENTER();
+    return ALCP_prov_gcm_pipeline_init(
+        vctx, key, keylen, numpipes, iv, ivlen, params, true);
+}
+
+int
+ALCP_prov_gcm_pipeline_decrypt_init(void*                 vctx,
+                                    const unsigned char*  key,
+                                    size_t                keylen,
+                                    size_t                numpipes,
+                                    const unsigned char** iv,
+                                    size_t                ivlen,
+                                    const OSSL_PARAM      params[])
+{
+    ENTER();
+    return ALCP_prov_gcm_pipeline_init(
+        vctx, key, keylen, numpipes, iv, ivlen, params, false);
+}
+
+/* Run every pipe through the library in one call */
+static int
+ALCP_prov_gcm_pipeline_run(alc_prov_cipher_ctx_p cctx)
+{
+    alc_prov_cipher_pipe_p pipe = cctx->pc_pipe;
+    alc_error_t            err;
+
+    if (cctx->enc_flag) {
+        err = alcp_cipher_aead_encrypt_records(
+            &(cctx->handle), pipe->pp_records, pipe->pp_numpipes);
+    } else {
+        err = alcp_cipher_aead_decrypt_records(
+            &(cctx->handle), pipe->pp_records, pipe->pp_numpipes);
+    }
+    if (alcp_is_error(err)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+    pipe->pp_done = true;
+
+    return 1;
+}
+
+int
+ALCP_prov_gcm_pipeline_update(void*                 vctx,
+                              size_t                numpipes,
+                              unsigned char**       out,
+                              size_t*               outl,
+                              const size_t*         outsize,
+                              const unsigned char** in,
+                              const size_t*         inl)
+{
+    alc_prov_cipher_ctx_p  cctx = vctx;
+    alc_prov_cipher_pipe_p pipe = cctx->pc_pipe;
+
+    ENTER();
+    // Every pipe is one whole record, a second data update is not possible
+    if (pipe == NULL || numpipes != pipe->pp_numpipes || pipe->pp_done) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+
+    // AAD call, copied as the buffers need not outlive the update
+    if (out == NULL) {
+        size_t total = 0;
+        for (size_t i = 0; i < numpipes; i++) {
+            if (pipe->pp_records[i].ar_aad_len != 0) {
+                ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+                return 0;
+            }
+            total += inl[i];
+        }
+        if (total > pipe->pp_aad_size) {
+            Uint8* p_aad = OPENSSL_realloc(pipe->pp_aad, total);
+            if (p_aad == NULL) {
+                return 0;
+            }
+            pipe->pp_aad      = p_aad;
+            pipe->pp_aad_size = total;
+        }
+
+        Uint8* p_aad = pipe->pp_aad;
+        for (size_t i = 0; i < numpipes; i++) {
+            memcpy(p_aad, in[i], inl[i]);
+            pipe->pp_records[i].ar_aad     = p_aad;
+            pipe->pp_records[i].ar_aad_len = inl[i];
+            p_aad += inl[i];
+            if (outl != NULL) {
+                outl[i] = inl[i];
+            }
+        }
+        return 1;
+    }
+
+    for (size_t i = 0; i < numpipes; i++) {
+        if (outsize[i] < inl[i]) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_OUTPUT_BUFFER_TOO_SMALL);
+            return 0;
+        }
+        pipe->pp_records[i].ar_in  = in[i];
+        pipe->pp_records[i].ar_out = out[i];
+        pipe->pp_records[i].ar_len = inl[i];
+    }
+    if (!ALCP_prov_gcm_pipeline_run(cctx)) {
+        return 0;
+    }
+    for (size_t i = 0; i < numpipes; i++) {
+        outl[i] = inl[i];
+    }
+
+    EXIT();
+    return 1;
+}
+
+int
+ALCP_prov_gcm_pipeline_final(void*           vctx,
+                             size_t          numpipes,
+                             unsigned char** out,
+                             size_t*         outl,
+                             const size_t*   outsize)
+{
+    alc_prov_cipher_ctx_p  cctx = vctx;
+    alc_prov_cipher_pipe_p pipe = cctx->pc_pipe;
+
+    ENTER();
+    if (pipe == NULL || numpipes != pipe->pp_numpipes) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_CIPHER_OPERATION_FAILED);
+        return 0;
+    }
+    // Records without any data still have a tag
+    if (!pipe->pp_done && !ALCP_prov_gcm_pipeline_run(cctx)) {
+        return 0;
+    }
+
+    if (!cctx->enc_flag) {
+        if (!pipe->pp_tag_set) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_TAG_NOT_SET);
+            return 0;
+        }
+        for (size_t i = 0; i < numpipes; i++) {
+            if (CRYPTO_memcmp(
+                    pipe->pp_tag[i], pipe->pp_exp_tag[i], pipe->pp_taglen)
+                != 0) {
+                return 0;
+            }
+        }
+    }
+    for (size_t i = 0; i < numpipes; i++) {
+        outl[i] = 0;
+    }
+
+    EXIT();
+    return 1;
+}
+#endif
+
 static const char    CIPHER_DEF_PROP[]  = "provider=alcp,fips=no";
 const OSSL_ALGORITHM ALC_prov_ciphers[] = {
     // CFB
@@ -1002,6 +1272,24 @@ const OSSL_ALGORITHM ALC_prov_ciphers[] = {
     { ALCP_PROV_NAMES_AES_128_SIV, CIPHER_DEF_PROP, siv_functions_128 },
     { ALCP_PROV_NAMES_AES_192_SIV, CIPHER_DEF_PROP, siv_functions_192 },
     { ALCP_PROV_NAMES_AES_256_SIV, CIPHER_DEF_PROP, siv_functions_256 },
+    // CBC-HMAC-SHA
+    { ALCP_PROV_NAMES_AES_128_CBC_HMAC_SHA1,
+      CIPHER_DEF_PROP,
+      cbc_hmac_sha1_functions_128 },
+    { ALCP_PROV_NAMES_AES_256_CBC_HMAC_SHA1,
+      CIPHER_DEF_PROP,
+      cbc_hmac_sha1_functions_256 },
+    { ALCP_PROV_NAMES_AES_128_CBC_HMAC_SHA256,
+      CIPHER_DEF_PROP,
+      cbc_hmac_sha256_functions_128 },
+    { ALCP_PROV_NAMES_AES_256_CBC_HMAC_SHA256,
+      CIPHER_DEF_PROP,
+      cbc_hmac_sha256_functions_256 },
+    // ChaCha20
+    { ALCP_PROV_NAMES_CHACHA20, CIPHER_DEF_PROP, chacha20_functions },
+    { ALCP_PROV_NAMES_CHACHA20_POLY1305,
+      CIPHER_DEF_PROP,
+      chacha20_poly1305_functions },
     // Terminate OpenSSL Algorithm list with Null Pointer.
     { NULL, NULL, NULL },
 };
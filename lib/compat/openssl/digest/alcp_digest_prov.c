@@ -29,11 +29,24 @@
 #include "digest/alcp_digest_prov.h"
 #include "provider/alcp_names.h"
 
+/* Ends the library session, if any, and frees its context memory */
+static void
+ALCP_prov_digest_release(alc_prov_digest_ctx_p dctx)
+{
+    if (dctx->handle.context != NULL) {
+        alcp_digest_finish(&(dctx->handle));
+        OPENSSL_clear_free(dctx->handle.context,
+                           alcp_digest_context_size(&dctx->pc_digest_info));
+        dctx->handle.context = NULL;
+    }
+}
+
 void
 ALCP_prov_digest_freectx(void* vctx)
 {
     alc_prov_digest_ctx_p pdctx = vctx;
     ENTER();
+    ALCP_prov_digest_release(pdctx);
     /*
      * pdctx->pc_evp_digest will be  freed in provider teardown,
      */
@@ -64,18 +77,44 @@ ALCP_prov_digest_newctx(void* vprovctx, const alc_digest_info_p dinfo)
 void*
 ALCP_prov_digest_dupctx(void* vctx)
 {
-    ENTER();
-    // FIXME: Implementation Pending for context copy
     alc_prov_digest_ctx_p csrc = vctx;
+    alc_prov_digest_ctx_p cdst;
+    alc_error_t           err;
+
+    ENTER();
+    cdst = OPENSSL_memdup(csrc, sizeof(*csrc));
+    if (cdst == NULL) {
+        return NULL;
+    }
+    cdst->pc_evp_digest_ctx = NULL;
+    cdst->handle.context    = NULL;
+
+    // The session hashed so far goes into a context of its own
+    if (csrc->handle.context != NULL) {
+        cdst->handle.context =
+            OPENSSL_malloc(alcp_digest_context_size(&csrc->pc_digest_info));
+        if (cdst->handle.context == NULL) {
+            OPENSSL_free(cdst);
+            return NULL;
+        }
+        err = alcp_digest_context_copy(&(csrc->handle), &(cdst->handle));
+        if (alcp_is_error(err)) {
+            OPENSSL_free(cdst->handle.context);
+            OPENSSL_free(cdst);
+            return NULL;
+        }
+    }
     EXIT();
-    return csrc;
+    return cdst;
 }
 
 /*-
  * Generic digest functions for OSSL_PARAM gettables and settables
  */
 static const OSSL_PARAM digest_known_gettable_params[] = {
-    OSSL_PARAM_size_t(OSSL_DIGEST_PARAM_BLOCK_SIZE, NULL), OSSL_PARAM_END
+    OSSL_PARAM_size_t(OSSL_DIGEST_PARAM_BLOCK_SIZE, NULL),
+    OSSL_PARAM_size_t(OSSL_DIGEST_PARAM_SIZE, NULL),
+    OSSL_PARAM_END
 };
 
 const OSSL_PARAM*
@@ -87,9 +126,24 @@ ALCP_prov_digest_gettable_params(void* provctx)
 }
 
 int
-ALCP_prov_digest_get_params(OSSL_PARAM params[])
+ALCP_prov_digest_get_params(OSSL_PARAM params[],
+                            size_t     block_size,
+                            size_t     digest_size)
 {
+    OSSL_PARAM* p;
+
     ENTER();
+    p = OSSL_PARAM_locate(params, OSSL_DIGEST_PARAM_BLOCK_SIZE);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, block_size)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_SET_PARAMETER);
+        return 0;
+    }
+
+    p = OSSL_PARAM_locate(params, OSSL_DIGEST_PARAM_SIZE);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, digest_size)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_SET_PARAMETER);
+        return 0;
+    }
     EXIT();
     return 1;
 }
@@ -166,10 +220,16 @@ ALCP_prov_digest_init(void* vctx, const OSSL_PARAM params[])
     alc_prov_digest_ctx_p cctx = vctx;
     alc_error_t           err;
 
+    // A reused context starts over with a fresh session
+    ALCP_prov_digest_release(cctx);
+
     alc_digest_info_p dinfo = &cctx->pc_digest_info;
     Uint64            size  = alcp_digest_context_size(dinfo);
     cctx->handle.context    = OPENSSL_malloc(size);
-    err                     = alcp_digest_request(dinfo, &(cctx->handle));
+    if (cctx->handle.context == NULL) {
+        return 0;
+    }
+    err = alcp_digest_request(dinfo, &(cctx->handle));
     if (alcp_is_error(err)) {
         printf("Provider: Somehow request failed\n");
         return 0;
@@ -204,14 +264,7 @@ ALCP_prov_digest_final(void*          vctx,
     alc_error_t           err  = ALC_ERROR_NONE;
     alc_prov_digest_ctx_p dctx = vctx;
 
-    /**
-     * FIXME: EVP_MD_get_size provider need to implemented. Currently it is
-     * returning zero in OpenSSL which caused outsize passed as argument to this
-     * function to be zero
-     * */
-
-    // FIXME: Once EVP_MD_get_size provider is implemented calculate *outl
-    // directly from outsize. Below is a temporary fix to get digest size
+    // SHAKE produces as much output as asked for
     if (dctx->pc_digest_info.dt_mode.dm_sha3 == ALC_SHAKE_128
         || dctx->pc_digest_info.dt_mode.dm_sha3 == ALC_SHAKE_256) {
         *outl = outsize;
@@ -222,6 +275,10 @@ ALCP_prov_digest_final(void*          vctx,
         }
     } else {
         *outl = dctx->pc_digest_info.dt_len / 8;
+        if (outsize < *outl) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_OUTPUT_BUFFER_TOO_SMALL);
+            return 0;
+        }
     }
     err = alcp_digest_finalize(&(dctx->handle), NULL, 0);
     if (alcp_is_error(err)) {
@@ -233,7 +290,7 @@ ALCP_prov_digest_final(void*          vctx,
         printf("Provider: Failed to copy Hash\n");
         return 0;
     }
-    OPENSSL_free(dctx->handle.context);
+    ALCP_prov_digest_release(dctx);
     EXIT();
     return 1;
 }
@@ -96,19 +96,19 @@ ALCP_prov_sha3_ctxfree(alc_prov_digest_ctx_p dig_ctx)
 }
 
 /* Sha2 dispatchers */
-CREATE_DIGEST_DISPATCHERS(sha512_256, sha2, ALC_DIGEST_LEN_256);
-CREATE_DIGEST_DISPATCHERS(sha512_224, sha2, ALC_DIGEST_LEN_224);
-CREATE_DIGEST_DISPATCHERS(sha512, sha2, ALC_DIGEST_LEN_512);
-CREATE_DIGEST_DISPATCHERS(sha384, sha2, ALC_DIGEST_LEN_384);
-CREATE_DIGEST_DISPATCHERS(sha256, sha2, ALC_DIGEST_LEN_256);
-CREATE_DIGEST_DISPATCHERS(sha224, sha2, ALC_DIGEST_LEN_224);
+CREATE_DIGEST_DISPATCHERS(sha512_256, sha2, ALC_DIGEST_LEN_256, 128, 32);
+CREATE_DIGEST_DISPATCHERS(sha512_224, sha2, ALC_DIGEST_LEN_224, 128, 28);
+CREATE_DIGEST_DISPATCHERS(sha512, sha2, ALC_DIGEST_LEN_512, 128, 64);
+CREATE_DIGEST_DISPATCHERS(sha384, sha2, ALC_DIGEST_LEN_384, 128, 48);
+CREATE_DIGEST_DISPATCHERS(sha256, sha2, ALC_DIGEST_LEN_256, 64, 32);
+CREATE_DIGEST_DISPATCHERS(sha224, sha2, ALC_DIGEST_LEN_224, 64, 28);
 
 /* Sha3 dispatchers */
-CREATE_DIGEST_DISPATCHERS(sha512, sha3, ALC_DIGEST_LEN_512);
-CREATE_DIGEST_DISPATCHERS(sha384, sha3, ALC_DIGEST_LEN_384);
-CREATE_DIGEST_DISPATCHERS(sha256, sha3, ALC_DIGEST_LEN_256);
-CREATE_DIGEST_DISPATCHERS(sha224, sha3, ALC_DIGEST_LEN_224);
+CREATE_DIGEST_DISPATCHERS(sha512, sha3, ALC_DIGEST_LEN_512, 72, 64);
+CREATE_DIGEST_DISPATCHERS(sha384, sha3, ALC_DIGEST_LEN_384, 104, 48);
+CREATE_DIGEST_DISPATCHERS(sha256, sha3, ALC_DIGEST_LEN_256, 136, 32);
+CREATE_DIGEST_DISPATCHERS(sha224, sha3, ALC_DIGEST_LEN_224, 144, 28);
 
 /* Shake dispatchers */
-CREATE_DIGEST_DISPATCHERS(shake128, sha3, ALC_DIGEST_LEN_CUSTOM);
-CREATE_DIGEST_DISPATCHERS(shake256, sha3, ALC_DIGEST_LEN_CUSTOM);
+CREATE_DIGEST_DISPATCHERS(shake128, sha3, ALC_DIGEST_LEN_CUSTOM, 168, 16);
+CREATE_DIGEST_DISPATCHERS(shake256, sha3, ALC_DIGEST_LEN_CUSTOM, 136, 32);
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _OPENSSL_ALCP_ASYM_CIPHER_PROV_H
+#define _OPENSSL_ALCP_ASYM_CIPHER_PROV_H 2
+
+#include "keymgmt/alcp_keymgmt_prov.h"
+
+#include "debug.h"
+
+/*
+ * PKCS#1 v1.5, OAEP with the SHA2 digests and raw RSA run on ALCP. OAEP
+ * with SHA1, the default, and the TLS premaster secret checks run on a
+ * context of the default provider.
+ */
+struct _alc_prov_asym_cipher_ctx
+{
+    alc_prov_ctx_t*              ac_prov_ctx;
+    alc_prov_rsa_key_t*          ac_key;
+    int                          ac_operation;
+    int                          ac_pad_mode;
+    int                          ac_tls;
+    unsigned int                 ac_implicit_rejection;
+    char                         ac_oaep_mdname[ALCP_PROV_RSA_MAX_NAME_SIZE];
+    char                         ac_mgf1_mdname[ALCP_PROV_RSA_MAX_NAME_SIZE];
+    Uint8*                       ac_oaep_label;
+    size_t                       ac_oaep_label_len;
+    alc_rsa_handle_t             ac_handle;
+    const alc_prov_rsa_digest_t* ac_handle_md;
+    const alc_prov_rsa_digest_t* ac_handle_mgf1;
+    OSSL_PARAM*                  ac_params;
+    EVP_PKEY_CTX*                ac_fallback;
+};
+typedef struct _alc_prov_asym_cipher_ctx alc_prov_asym_cipher_ctx_t,
+    *alc_prov_asym_cipher_ctx_p;
+
+extern const OSSL_ALGORITHM ALC_prov_asym_cipher[];
+
+extern OSSL_FUNC_asym_cipher_newctx_fn       ALCP_prov_asym_cipher_newctx;
+extern OSSL_FUNC_asym_cipher_encrypt_init_fn ALCP_prov_asym_cipher_encrypt_init;
+extern OSSL_FUNC_asym_cipher_encrypt_fn      ALCP_prov_asym_cipher_encrypt;
+extern OSSL_FUNC_asym_cipher_decrypt_init_fn ALCP_prov_asym_cipher_decrypt_init;
+extern OSSL_FUNC_asym_cipher_decrypt_fn      ALCP_prov_asym_cipher_decrypt;
+extern OSSL_FUNC_asym_cipher_freectx_fn      ALCP_prov_asym_cipher_freectx;
+extern OSSL_FUNC_asym_cipher_dupctx_fn       ALCP_prov_asym_cipher_dupctx;
+extern OSSL_FUNC_asym_cipher_get_ctx_params_fn
+    ALCP_prov_asym_cipher_get_ctx_params;
+extern OSSL_FUNC_asym_cipher_gettable_ctx_params_fn
+    ALCP_prov_asym_cipher_gettable_ctx_params;
+extern OSSL_FUNC_asym_cipher_set_ctx_params_fn
+    ALCP_prov_asym_cipher_set_ctx_params;
+extern OSSL_FUNC_asym_cipher_settable_ctx_params_fn
+    ALCP_prov_asym_cipher_settable_ctx_params;
+
+#define CREATE_ASYM_CIPHER_DISPATCHERS()                                       \
+    const OSSL_DISPATCH asym_cipher_functions[] = {                            \
+        { OSSL_FUNC_ASYM_CIPHER_NEWCTX,                                        \
+          (fptr_t)ALCP_prov_asym_cipher_newctx },                              \
+        { OSSL_FUNC_ASYM_CIPHER_ENCRYPT_INIT,                                  \
+          (fptr_t)ALCP_prov_asym_cipher_encrypt_init },                        \
+        { OSSL_FUNC_ASYM_CIPHER_ENCRYPT,                                       \
+          (fptr_t)ALCP_prov_asym_cipher_encrypt },                             \
+        { OSSL_FUNC_ASYM_CIPHER_DECRYPT_INIT,                                  \
+          (fptr_t)ALCP_prov_asym_cipher_decrypt_init },                        \
+        { OSSL_FUNC_ASYM_CIPHER_DECRYPT,                                       \
+          (fptr_t)ALCP_prov_asym_cipher_decrypt },                             \
+        { OSSL_FUNC_ASYM_CIPHER_FREECTX,                                       \
+          (fptr_t)ALCP_prov_asym_cipher_freectx },                             \
+        { OSSL_FUNC_ASYM_CIPHER_DUPCTX,                                        \
+          (fptr_t)ALCP_prov_asym_cipher_dupctx },                              \
+        { OSSL_FUNC_ASYM_CIPHER_GET_CTX_PARAMS,                                \
+          (fptr_t)ALCP_prov_asym_cipher_get_ctx_params },                      \
+        { OSSL_FUNC_ASYM_CIPHER_GETTABLE_CTX_PARAMS,                           \
+          (fptr_t)ALCP_prov_asym_cipher_gettable_ctx_params },                 \
+        { OSSL_FUNC_ASYM_CIPHER_SET_CTX_PARAMS,                                \
+          (fptr_t)ALCP_prov_asym_cipher_set_ctx_params },                      \
+        { OSSL_FUNC_ASYM_CIPHER_SETTABLE_CTX_PARAMS,                           \
+          (fptr_t)ALCP_prov_asym_cipher_settable_ctx_params },                 \
+        { 0, NULL }                                                            \
+    }
+
+#endif /* _OPENSSL_ALCP_ASYM_CIPHER_PROV_H */
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _OPENSSL_ALCP_CIPHER_CBC_HMAC_SHA_H
+#define _OPENSSL_ALCP_CIPHER_CBC_HMAC_SHA_H 2
+
+#include <alcp/cipher_aead.h>
+
+#include "cipher/alcp_cipher_prov.h"
+#include "debug.h"
+
+#define ALCP_PROV_CBC_HMAC_SHA_BLOCK_LEN     16
+#define ALCP_PROV_CBC_HMAC_SHA_IV_LEN        16
+#define ALCP_PROV_CBC_HMAC_SHA_MAX_KEY_LEN   32
+#define ALCP_PROV_CBC_HMAC_SHA_NO_TLS_RECORD ((size_t)-1)
+
+/*
+ * One context per EVP_CIPHER_CTX, the library session lives in cs_context
+ * and is requested again whenever the AES or the MAC key changes, so both
+ * keys are kept. cs_iv follows the CBC chain of the session so that a new
+ * session carries on where the previous one stopped.
+ * cs_tls_record_len is the announced length of the record the next update
+ * takes, or ALCP_PROV_CBC_HMAC_SHA_NO_TLS_RECORD outside of TLS records.
+ * The multiblock fields hold what the last multiblock call returns.
+ */
+struct _alc_prov_cbc_hmac_sha_ctx
+{
+    alc_prov_ctx_t*     cs_prov_ctx;
+    alc_cipher_handle_t cs_handle;
+    void*               cs_context;
+    alc_cipher_mode_t   cs_mode;
+    size_t              cs_keylen;
+    size_t              cs_maclen;
+    int                 cs_enc;
+    int                 cs_keyed;
+    Uint8               cs_key[ALCP_PROV_CBC_HMAC_SHA_MAX_KEY_LEN];
+    Uint8*              cs_mac_key;
+    size_t              cs_mac_keylen;
+    Uint8               cs_oiv[ALCP_PROV_CBC_HMAC_SHA_IV_LEN];
+    Uint8               cs_iv[ALCP_PROV_CBC_HMAC_SHA_IV_LEN];
+    Uint8               cs_tls_aad[EVP_AEAD_TLS1_AAD_LEN];
+    size_t              cs_tls_record_len;
+    size_t              cs_tls_aad_pad;
+    unsigned int        cs_tls_version;
+    size_t              cs_tls_fixed;
+    size_t              cs_mb_max_send_fragment;
+    unsigned int        cs_mb_interleave;
+    size_t              cs_mb_aad_packlen;
+    size_t              cs_mb_enc_len;
+};
+typedef struct _alc_prov_cbc_hmac_sha_ctx alc_prov_cbc_hmac_sha_ctx_t,
+    *alc_prov_cbc_hmac_sha_ctx_p;
+
+void*
+ALCP_prov_cbc_hmac_sha_newctx(void*             provctx,
+                              alc_cipher_mode_t mode,
+                              size_t            keylen);
+int
+ALCP_prov_cbc_hmac_sha_get_params(OSSL_PARAM params[], size_t keylen);
+
+extern OSSL_FUNC_cipher_freectx_fn      ALCP_prov_cbc_hmac_sha_freectx;
+extern OSSL_FUNC_cipher_dupctx_fn       ALCP_prov_cbc_hmac_sha_dupctx;
+extern OSSL_FUNC_cipher_encrypt_init_fn ALCP_prov_cbc_hmac_sha_encrypt_init;
+extern OSSL_FUNC_cipher_decrypt_init_fn ALCP_prov_cbc_hmac_sha_decrypt_init;
+extern OSSL_FUNC_cipher_update_fn       ALCP_prov_cbc_hmac_sha_update;
+extern OSSL_FUNC_cipher_final_fn        ALCP_prov_cbc_hmac_sha_final;
+extern OSSL_FUNC_cipher_gettable_params_fn
+    ALCP_prov_cbc_hmac_sha_gettable_params;
+extern OSSL_FUNC_cipher_get_ctx_params_fn
+    ALCP_prov_cbc_hmac_sha_get_ctx_params;
+extern OSSL_FUNC_cipher_set_ctx_params_fn
+    ALCP_prov_cbc_hmac_sha_set_ctx_params;
+extern OSSL_FUNC_cipher_gettable_ctx_params_fn
+    ALCP_prov_cbc_hmac_sha_gettable_ctx_params;
+extern OSSL_FUNC_cipher_settable_ctx_params_fn
+    ALCP_prov_cbc_hmac_sha_settable_ctx_params;
+
+// Every key size and hash shares all but the constructor and the params
+#define CREATE_CBC_HMAC_SHA_DISPATCHERS(sha, alcp_mode, key_size)              \
+    static OSSL_FUNC_cipher_newctx_fn                                          \
+                 ALCP_prov_cbc_hmac_##sha##_newctx_##key_size;                 \
+    static void* ALCP_prov_cbc_hmac_##sha##_newctx_##key_size(void* provctx)   \
+    {                                                                          \
+        return ALCP_prov_cbc_hmac_sha_newctx(                                  \
+            provctx, alcp_mode, key_size / 8);                                 \
+    }                                                                          \
+    static OSSL_FUNC_cipher_get_params_fn                                      \
+               ALCP_prov_cbc_hmac_##sha##_get_params_##key_size;               \
+    static int ALCP_prov_cbc_hmac_##sha##_get_params_##key_size(               \
+        OSSL_PARAM params[])                                                   \
+    {                                                                          \
+        return ALCP_prov_cbc_hmac_sha_get_params(params, key_size / 8);        \
+    }                                                                          \
+    const OSSL_DISPATCH cbc_hmac_##sha##_functions_##key_size[] = {            \
+        { OSSL_FUNC_CIPHER_NEWCTX,                                             \
+          (fptr_t)ALCP_prov_cbc_hmac_##sha##_newctx_##key_size },              \
+        { OSSL_FUNC_CIPHER_FREECTX, (fptr_t)ALCP_prov_cbc_hmac_sha_freectx },  \
+        { OSSL_FUNC_CIPHER_DUPCTX, (fptr_t)ALCP_prov_cbc_hmac_sha_dupctx },    \
+        { OSSL_FUNC_CIPHER_ENCRYPT_INIT,                                       \
+          (fptr_t)ALCP_prov_cbc_hmac_sha_encrypt_init },                       \
+        { OSSL_FUNC_CIPHER_DECRYPT_INIT,                                       \
+          (fptr_t)ALCP_prov_cbc_hmac_sha_decrypt_init },                       \
+        { OSSL_FUNC_CIPHER_UPDATE, (fptr_t)ALCP_prov_cbc_hmac_sha_update },    \
+        { OSSL_FUNC_CIPHER_FINAL, (fptr_t)ALCP_prov_cbc_hmac_sha_final },      \
+        { OSSL_FUNC_CIPHER_GET_PARAMS,                                         \
+          (fptr_t)ALCP_prov_cbc_hmac_##sha##_get_params_##key_size },          \
+        { OSSL_FUNC_CIPHER_GETTABLE_PARAMS,                                    \
+          (fptr_t)ALCP_prov_cbc_hmac_sha_gettable_params },                    \
+        { OSSL_FUNC_CIPHER_GET_CTX_PARAMS,                                     \
+          (fptr_t)ALCP_prov_cbc_hmac_sha_get_ctx_params },                     \
+        { OSSL_FUNC_CIPHER_GETTABLE_CTX_PARAMS,                                \
+          (fptr_t)ALCP_prov_cbc_hmac_sha_gettable_ctx_params },                \
+        { OSSL_FUNC_CIPHER_SET_CTX_PARAMS,                                     \
+          (fptr_t)ALCP_prov_cbc_hmac_sha_set_ctx_params },                     \
+        { OSSL_FUNC_CIPHER_SETTABLE_CTX_PARAMS,                                \
+          (fptr_t)ALCP_prov_cbc_hmac_sha_settable_ctx_params },                \
+        { 0, NULL }                                                            \
+    }
+
+extern const OSSL_DISPATCH cbc_hmac_sha1_functions_128[];
+extern const OSSL_DISPATCH cbc_hmac_sha1_functions_256[];
+extern const OSSL_DISPATCH cbc_hmac_sha256_functions_128[];
+extern const OSSL_DISPATCH cbc_hmac_sha256_functions_256[];
+
+#endif /* _OPENSSL_ALCP_CIPHER_CBC_HMAC_SHA_H */
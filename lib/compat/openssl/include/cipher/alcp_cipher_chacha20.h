@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _OPENSSL_ALCP_CIPHER_CHACHA20_H
+#define _OPENSSL_ALCP_CIPHER_CHACHA20_H 2
+
+#include <alcp/cipher_aead.h>
+
+#include "cipher/alcp_cipher_prov.h"
+#include "debug.h"
+
+#define ALCP_PROV_CHACHA20_KEY_LEN         32
+#define ALCP_PROV_CHACHA20_IV_LEN          16
+#define ALCP_PROV_CHACHA20_BLOCK_LEN       64
+#define ALCP_PROV_CHACHA20_POLY1305_IVLEN  12
+#define ALCP_PROV_CHACHA20_POLY1305_TAGLEN 16
+#define ALCP_PROV_CHACHA20_NO_TLS_PAYLOAD  ((size_t)-1)
+
+/*
+ * One context serves both ChaCha20 and ChaCha20-Poly1305. The library
+ * session lives in cc_context, which is allocated with the context and
+ * reused for every key. cc_iv holds the 16 byte counter and nonce of
+ * ChaCha20 or the 12 byte nonce of the AEAD, cc_started tells whether that
+ * nonce has been handed to the AEAD session. cc_keystream keeps what is
+ * left of the last partial ChaCha20 block.
+ */
+struct _alc_prov_chacha20_ctx
+{
+    alc_prov_ctx_t*     cc_prov_ctx;
+    alc_cipher_handle_t cc_handle;
+    void*               cc_context;
+    int                 cc_aead;
+    int                 cc_enc;
+    int                 cc_keyed;
+    int                 cc_iv_set;
+    int                 cc_started;
+    Uint8               cc_key[ALCP_PROV_CHACHA20_KEY_LEN];
+    Uint8               cc_iv[ALCP_PROV_CHACHA20_IV_LEN];
+    size_t              cc_ivlen;
+    Uint8               cc_keystream[ALCP_PROV_CHACHA20_BLOCK_LEN];
+    size_t              cc_keystream_off;
+    Uint8               cc_tag[ALCP_PROV_CHACHA20_POLY1305_TAGLEN];
+    size_t              cc_taglen;
+    Uint8               cc_tls_aad[EVP_AEAD_TLS1_AAD_LEN];
+    size_t              cc_tls_payload_len;
+    size_t              cc_tls_aad_pad;
+};
+typedef struct _alc_prov_chacha20_ctx alc_prov_chacha20_ctx_t,
+    *alc_prov_chacha20_ctx_p;
+
+extern OSSL_FUNC_cipher_freectx_fn         ALCP_prov_chacha20_freectx;
+extern OSSL_FUNC_cipher_dupctx_fn          ALCP_prov_chacha20_dupctx;
+extern OSSL_FUNC_cipher_update_fn          ALCP_prov_chacha20_update;
+extern OSSL_FUNC_cipher_final_fn           ALCP_prov_chacha20_final;
+extern OSSL_FUNC_cipher_gettable_params_fn ALCP_prov_chacha20_gettable_params;
+
+// Both ciphers share everything but the parameters that describe them
+#define CREATE_CHACHA20_DISPATCHERS(name)                                      \
+    const OSSL_DISPATCH name##_functions[] = {                                 \
+        { OSSL_FUNC_CIPHER_NEWCTX, (fptr_t)ALCP_prov_##name##_newctx },        \
+        { OSSL_FUNC_CIPHER_FREECTX, (fptr_t)ALCP_prov_chacha20_freectx },      \
+        { OSSL_FUNC_CIPHER_DUPCTX, (fptr_t)ALCP_prov_chacha20_dupctx },        \
+        { OSSL_FUNC_CIPHER_ENCRYPT_INIT,                                       \
+          (fptr_t)ALCP_prov_chacha20_encrypt_init },                           \
+        { OSSL_FUNC_CIPHER_DECRYPT_INIT,                                       \
+          (fptr_t)ALCP_prov_chacha20_decrypt_init },                           \
+        { OSSL_FUNC_CIPHER_UPDATE, (fptr_t)ALCP_prov_chacha20_update },        \
+        { OSSL_FUNC_CIPHER_FINAL, (fptr_t)ALCP_prov_chacha20_final },          \
+        { OSSL_FUNC_CIPHER_GET_PARAMS,                                         \
+          (fptr_t)ALCP_prov_##name##_get_params },                             \
+        { OSSL_FUNC_CIPHER_GETTABLE_PARAMS,                                    \
+          (fptr_t)ALCP_prov_chacha20_gettable_params },                        \
+        { OSSL_FUNC_CIPHER_GET_CTX_PARAMS,                                     \
+          (fptr_t)ALCP_prov_chacha20_get_ctx_params },                         \
+        { OSSL_FUNC_CIPHER_GETTABLE_CTX_PARAMS,                                \
+          (fptr_t)ALCP_prov_##name##_gettable_ctx_params },                    \
+        { OSSL_FUNC_CIPHER_SET_CTX_PARAMS,                                     \
+          (fptr_t)ALCP_prov_chacha20_set_ctx_params },                         \
+        { OSSL_FUNC_CIPHER_SETTABLE_CTX_PARAMS,                                \
+          (fptr_t)ALCP_prov_##name##_settable_ctx_params },                    \
+        { 0, NULL }                                                            \
+    }
+
+extern const OSSL_DISPATCH chacha20_functions[];
+extern const OSSL_DISPATCH chacha20_poly1305_functions[];
+
+#endif /* _OPENSSL_ALCP_CIPHER_CHACHA20_H */
@@ -31,6 +31,7 @@
 
 /* OpenSSL Headers */
 #include <openssl/core.h>
+#include <openssl/core_dispatch.h>
 #include <openssl/core_names.h>
 #include <openssl/engine.h>
 #include <openssl/evp.h>
@@ -75,6 +76,19 @@ struct _alc_prov_cipher_ctx
     int pc_flags;
 
     OSSL_LIB_CTX* pc_libctx;
+
+    /* handle.ch_context holds a requested cipher that must be finished */
+    bool pc_keyed;
+#ifdef OSSL_FUNC_CIPHER_PIPELINE_ENCRYPT_INIT
+    /* Records of the pipelined GCM API, allocated by the first pipeline init */
+    struct _alc_prov_cipher_pipe* pc_pipe;
+#endif
+    /*
+     * Library cipher context, allocated along with this struct and reused
+     * by every init on the same EVP_CIPHER_CTX. handle.ch_context points
+     * here.
+     */
+    Uint64 pc_context[];
 };
 typedef struct _alc_prov_cipher_ctx alc_prov_cipher_ctx_t,
     *alc_prov_cipher_ctx_p;
@@ -116,6 +130,29 @@ OSSL_FUNC_cipher_decrypt_init_fn   ALCP_prov_cipher_decrypt_init;
 OSSL_FUNC_cipher_update_fn         ALCP_prov_cipher_update;
 OSSL_FUNC_cipher_final_fn          ALCP_prov_cipher_final;
 
+/*
+ * Pipelined AES-GCM of OpenSSL 3.5, all pipes of an update are handed to the
+ * library as one batch of records.
+ */
+#ifdef OSSL_FUNC_CIPHER_PIPELINE_ENCRYPT_INIT
+OSSL_FUNC_cipher_pipeline_encrypt_init_fn ALCP_prov_gcm_pipeline_encrypt_init;
+OSSL_FUNC_cipher_pipeline_decrypt_init_fn ALCP_prov_gcm_pipeline_decrypt_init;
+OSSL_FUNC_cipher_pipeline_update_fn       ALCP_prov_gcm_pipeline_update;
+OSSL_FUNC_cipher_pipeline_final_fn        ALCP_prov_gcm_pipeline_final;
+
+#define GCM_PIPELINE_DISPATCH                                                  \
+    { OSSL_FUNC_CIPHER_PIPELINE_ENCRYPT_INIT,                                  \
+      (fptr_t)ALCP_prov_gcm_pipeline_encrypt_init },                           \
+    { OSSL_FUNC_CIPHER_PIPELINE_DECRYPT_INIT,                                  \
+      (fptr_t)ALCP_prov_gcm_pipeline_decrypt_init },                           \
+    { OSSL_FUNC_CIPHER_PIPELINE_UPDATE,                                        \
+      (fptr_t)ALCP_prov_gcm_pipeline_update },                                 \
+    { OSSL_FUNC_CIPHER_PIPELINE_FINAL,                                         \
+      (fptr_t)ALCP_prov_gcm_pipeline_final },
+#else
+#define GCM_PIPELINE_DISPATCH
+#endif
+
 // Macro for Context Creation
 #define CIPHER_CONTEXT(mode, alcp_mode)                                        \
     static alc_cipher_info_t s_cipher_##mode##_info = {                        \
@@ -150,6 +187,11 @@ OSSL_FUNC_cipher_final_fn          ALCP_prov_cipher_final;
 
 // Macro for OpenSSL Dispatcher Creation
 #define CREATE_CIPHER_DISPATCHERS(name, grp, mode, key_size, is_aead)          \
+    CREATE_CIPHER_DISPATCHERS_EX(name, grp, mode, key_size, is_aead, )
+
+// Same as above, extra_dispatch is appended to the dispatch table
+#define CREATE_CIPHER_DISPATCHERS_EX(                                          \
+    name, grp, mode, key_size, is_aead, extra_dispatch)                        \
     static OSSL_FUNC_cipher_get_params_fn                                      \
                ALCP_prov_##name##_get_params_##key_size;                       \
     static int ALCP_prov_##name##_get_params_##key_size(OSSL_PARAM* params)    \
@@ -214,6 +256,7 @@ OSSL_FUNC_cipher_final_fn          ALCP_prov_cipher_final;
           (fptr_t)ALCP_prov_##name##_decrypt_init_##key_size },                \
         { OSSL_FUNC_CIPHER_UPDATE, (fptr_t)ALCP_prov_cipher_update },          \
         { OSSL_FUNC_CIPHER_FINAL, (fptr_t)ALCP_prov_cipher_final },            \
+        extra_dispatch                                                         \
     }
 
 /*
@@ -89,7 +89,9 @@ ALCP_prov_digest_settable_ctx_params(void* cctx, void* provctx);
 const OSSL_PARAM*
 ALCP_prov_digest_gettable_params(void* provctx);
 int
-ALCP_prov_digest_get_params(OSSL_PARAM params[]);
+ALCP_prov_digest_get_params(OSSL_PARAM params[],
+                            size_t     block_size,
+                            size_t     digest_size);
 int
 ALCP_prov_digest_set_params(const OSSL_PARAM params[]);
 
@@ -99,10 +101,16 @@ OSSL_FUNC_digest_get_ctx_params_fn ALCP_prov_digest_get_ctx_params;
 OSSL_FUNC_digest_set_ctx_params_fn ALCP_prov_digest_set_ctx_params;
 OSSL_FUNC_digest_update_fn         ALCP_prov_digest_update;
 OSSL_FUNC_digest_final_fn          ALCP_prov_digest_final;
-OSSL_FUNC_digest_get_params_fn     ALCP_prov_digest_get_params;
 
-#define CREATE_DIGEST_DISPATCHERS(name, grp, len)                              \
+// block_size and digest_size in bytes, digest_size is the default for SHAKE
+#define CREATE_DIGEST_DISPATCHERS(name, grp, len, block_size, digest_size)     \
                                                                                \
+    static OSSL_FUNC_digest_get_params_fn                                      \
+               ALCP_prov_##name##_##grp##_get_params;                          \
+    static int ALCP_prov_##name##_##grp##_get_params(OSSL_PARAM params[])      \
+    {                                                                          \
+        return ALCP_prov_digest_get_params(params, block_size, digest_size);   \
+    }                                                                          \
     static OSSL_FUNC_digest_newctx_fn ALCP_prov_##name##_##grp##_newctx;       \
     static void* ALCP_prov_##name##_##grp##_newctx(void* provctx)              \
     {                                                                          \
@@ -111,7 +119,8 @@ OSSL_FUNC_digest_get_params_fn     ALCP_prov_digest_get_params;
             provctx, &s_digest_##name##_##grp##_##len##_info);                 \
     }                                                                          \
     const OSSL_DISPATCH name##_##grp##_functions[] = {                         \
-        { OSSL_FUNC_DIGEST_GET_PARAMS, (fptr_t)ALCP_prov_digest_get_params },  \
+        { OSSL_FUNC_DIGEST_GET_PARAMS,                                         \
+          (fptr_t)ALCP_prov_##name##_##grp##_get_params },                     \
         { OSSL_FUNC_DIGEST_NEWCTX,                                             \
           (fptr_t)ALCP_prov_##name##_##grp##_newctx },                         \
         { OSSL_FUNC_DIGEST_DUPCTX, (fptr_t)ALCP_prov_digest_dupctx },          \
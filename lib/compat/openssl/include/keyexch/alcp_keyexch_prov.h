@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _OPENSSL_ALCP_KEYEXCH_PROV_H
+#define _OPENSSL_ALCP_KEYEXCH_PROV_H 2
+
+#include "keymgmt/alcp_keymgmt_prov.h"
+
+#include "debug.h"
+
+/*
+ * The ALCP session is requested when the exchange is initialised with our
+ * private key and then serves every derive of the context.
+ */
+struct _alc_prov_keyexch_ctx
+{
+    alc_prov_ctx_t*            kc_prov_ctx;
+    const alc_prov_ec_curve_t* kc_curve;
+    alc_ec_handle_t            kc_handle;
+    int                        kc_has_peer;
+    Uint8                      kc_priv[ALCP_PROV_EC_MAX_KEY_SIZE];
+    Uint8                      kc_peer[2 * ALCP_PROV_EC_MAX_KEY_SIZE];
+};
+typedef struct _alc_prov_keyexch_ctx alc_prov_keyexch_ctx_t,
+    *alc_prov_keyexch_ctx_p;
+
+extern const OSSL_ALGORITHM ALC_prov_keyexch[];
+
+extern OSSL_FUNC_keyexch_newctx_fn         ALCP_prov_keyexch_newctx;
+extern OSSL_FUNC_keyexch_init_fn           ALCP_prov_keyexch_init;
+extern OSSL_FUNC_keyexch_set_peer_fn       ALCP_prov_keyexch_set_peer;
+extern OSSL_FUNC_keyexch_derive_fn         ALCP_prov_keyexch_derive;
+extern OSSL_FUNC_keyexch_freectx_fn        ALCP_prov_keyexch_freectx;
+extern OSSL_FUNC_keyexch_dupctx_fn         ALCP_prov_keyexch_dupctx;
+extern OSSL_FUNC_keyexch_set_ctx_params_fn ALCP_prov_keyexch_set_ctx_params;
+extern OSSL_FUNC_keyexch_settable_ctx_params_fn
+    ALCP_prov_keyexch_settable_ctx_params;
+
+#define CREATE_KEYEXCH_DISPATCHERS()                                           \
+    const OSSL_DISPATCH keyexch_functions[] = {                                \
+        { OSSL_FUNC_KEYEXCH_NEWCTX, (fptr_t)ALCP_prov_keyexch_newctx },        \
+        { OSSL_FUNC_KEYEXCH_INIT, (fptr_t)ALCP_prov_keyexch_init },            \
+        { OSSL_FUNC_KEYEXCH_SET_PEER, (fptr_t)ALCP_prov_keyexch_set_peer },    \
+        { OSSL_FUNC_KEYEXCH_DERIVE, (fptr_t)ALCP_prov_keyexch_derive },        \
+        { OSSL_FUNC_KEYEXCH_FREECTX, (fptr_t)ALCP_prov_keyexch_freectx },      \
+        { OSSL_FUNC_KEYEXCH_DUPCTX, (fptr_t)ALCP_prov_keyexch_dupctx },        \
+        { OSSL_FUNC_KEYEXCH_SET_CTX_PARAMS,                                    \
+          (fptr_t)ALCP_prov_keyexch_set_ctx_params },                          \
+        { OSSL_FUNC_KEYEXCH_SETTABLE_CTX_PARAMS,                               \
+          (fptr_t)ALCP_prov_keyexch_settable_ctx_params },                     \
+        { 0, NULL }                                                            \
+    }
+
+#endif /* _OPENSSL_ALCP_KEYEXCH_PROV_H */
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _OPENSSL_ALCP_KEYMGMT_PROV_H
+#define _OPENSSL_ALCP_KEYMGMT_PROV_H 2
+
+#include <openssl/core.h>
+#include <openssl/core_dispatch.h>
+#include <openssl/core_names.h>
+#include <openssl/proverr.h>
+
+#include <alcp/ec.h>
+#include <alcp/ecdh.h>
+#include <alcp/rsa.h>
+
+#include "provider/alcp_provider.h"
+
+#include "debug.h"
+
+/* P-521 has the largest keys, 66 bytes */
+#define ALCP_PROV_EC_MAX_KEY_SIZE 66
+
+/* Curves ALCP implements, X25519 and the NIST prime curves */
+struct _alc_prov_ec_curve
+{
+    const char*       ec_name;
+    const char*       ec_alias;
+    alc_ec_curve_id   ec_curve_id;
+    alc_ec_curve_type ec_curve_type;
+    size_t            ec_key_size;
+    int               ec_bits;
+    int               ec_security_bits;
+    int               ec_max_size;
+};
+typedef struct _alc_prov_ec_curve alc_prov_ec_curve_t, *alc_prov_ec_curve_p;
+
+/*
+ * Key data of both key managers. The public key is kept in the encoding
+ * OpenSSL exchanges, the u coordinate for X25519 and 0x04 || x || y for the
+ * prime curves, ALCP wants it without the leading 0x04.
+ */
+struct _alc_prov_ec_key
+{
+    alc_prov_ctx_t*            pk_prov_ctx;
+    const alc_prov_ec_curve_t* pk_curve;
+    int                        pk_has_priv;
+    int                        pk_has_pub;
+    Uint8                      pk_priv[ALCP_PROV_EC_MAX_KEY_SIZE];
+    Uint8                      pk_pub[1 + 2 * ALCP_PROV_EC_MAX_KEY_SIZE];
+};
+typedef struct _alc_prov_ec_key alc_prov_ec_key_t, *alc_prov_ec_key_p;
+
+/*
+ * RSA keys are held by the default provider, which exports and checks them
+ * and runs whatever ALCP does not implement. The two prime keys of the sizes
+ * ALCP implements also get an ALCP key with its Montgomery contexts.
+ */
+#define ALCP_PROV_RSA_FALLBACK_PROP "provider=default"
+
+/* 4096 bit keys are the largest ALCP implements */
+#define ALCP_PROV_RSA_MAX_KEY_SIZE 512
+
+/* Longest digest name kept by the RSA operations */
+#define ALCP_PROV_RSA_MAX_NAME_SIZE 50
+
+struct _alc_prov_rsa_key
+{
+    alc_prov_ctx_t*  rk_prov_ctx;
+    EVP_PKEY*        rk_pkey;
+    alc_rsa_key_p    rk_alcp;
+    alc_rsa_key_size rk_key_size;
+    int              rk_has_priv;
+};
+typedef struct _alc_prov_rsa_key alc_prov_rsa_key_t, *alc_prov_rsa_key_p;
+
+/* SHA2 digests ALCP can hash and pad RSA messages with */
+struct _alc_prov_rsa_digest
+{
+    const char*       rd_names;
+    alc_digest_info_t rd_info;
+    size_t            rd_hash_len;
+    const Uint8*      rd_digest_info;
+    size_t            rd_digest_info_len;
+    const Uint8*      rd_algorithm_id;
+    size_t            rd_algorithm_id_len;
+};
+typedef struct _alc_prov_rsa_digest alc_prov_rsa_digest_t,
+    *alc_prov_rsa_digest_p;
+
+extern const OSSL_ALGORITHM ALC_prov_keymgmt[];
+
+/* TODO: ugly hack for openssl table */
+typedef void (*fptr_t)(void);
+
+size_t
+ALCP_prov_ec_pub_len(const alc_prov_ec_curve_t* curve);
+const Uint8*
+ALCP_prov_ec_raw_pub(const alc_prov_ec_key_t* key);
+int
+ALCP_prov_ec_handle_new(alc_ec_handle_p            handle,
+                        const alc_prov_ec_curve_t* curve);
+void
+ALCP_prov_ec_handle_free(alc_ec_handle_p            handle,
+                         const alc_prov_ec_curve_t* curve);
+
+const alc_prov_rsa_digest_t*
+ALCP_prov_rsa_digest(const char* name);
+int
+ALCP_prov_rsa_get_pad_mode(const OSSL_PARAM* p, int* pad_mode);
+int
+ALCP_prov_rsa_set_pad_mode(OSSL_PARAM* p, int pad_mode);
+int
+ALCP_prov_rsa_save_params(OSSL_PARAM** saved, const OSSL_PARAM params[]);
+EVP_PKEY_CTX*
+ALCP_prov_rsa_fallback_ctx(const alc_prov_rsa_key_t* key);
+int
+ALCP_prov_rsa_handle_new(alc_rsa_handle_p          handle,
+                         const alc_prov_rsa_key_t* key);
+void
+ALCP_prov_rsa_handle_free(alc_rsa_handle_p handle, alc_rsa_key_size key_size);
+int
+ALCP_prov_rsa_private(alc_rsa_handle_p handle,
+                      size_t           size,
+                      const Uint8*     in,
+                      Uint8*           out);
+
+extern OSSL_FUNC_keymgmt_free_fn             ALCP_prov_ec_free;
+extern OSSL_FUNC_keymgmt_gen_set_template_fn ALCP_prov_ec_gen_set_template;
+extern OSSL_FUNC_keymgmt_gen_fn              ALCP_prov_ec_gen;
+extern OSSL_FUNC_keymgmt_gen_cleanup_fn      ALCP_prov_ec_gen_cleanup;
+extern OSSL_FUNC_keymgmt_get_params_fn       ALCP_prov_ec_get_params;
+extern OSSL_FUNC_keymgmt_set_params_fn       ALCP_prov_ec_set_params;
+extern OSSL_FUNC_keymgmt_settable_params_fn  ALCP_prov_ec_settable_params;
+extern OSSL_FUNC_keymgmt_has_fn              ALCP_prov_ec_has;
+extern OSSL_FUNC_keymgmt_match_fn            ALCP_prov_ec_match;
+extern OSSL_FUNC_keymgmt_validate_fn         ALCP_prov_ec_validate;
+extern OSSL_FUNC_keymgmt_import_fn           ALCP_prov_ec_import;
+extern OSSL_FUNC_keymgmt_export_fn           ALCP_prov_ec_export;
+extern OSSL_FUNC_keymgmt_dup_fn              ALCP_prov_ec_dup;
+
+/*
+ * X25519 and EC only differ in how a curve is picked and in the params they
+ * exchange with OpenSSL, grp is x25519 or nist.
+ */
+#define CREATE_KEYMGMT_DISPATCHERS(grp)                                        \
+    const OSSL_DISPATCH grp##_keymgmt_functions[] = {                          \
+        { OSSL_FUNC_KEYMGMT_NEW, (fptr_t)ALCP_prov_##grp##_new },              \
+        { OSSL_FUNC_KEYMGMT_FREE, (fptr_t)ALCP_prov_ec_free },                 \
+        { OSSL_FUNC_KEYMGMT_GEN_INIT, (fptr_t)ALCP_prov_##grp##_gen_init },    \
+        { OSSL_FUNC_KEYMGMT_GEN_SET_TEMPLATE,                                  \
+          (fptr_t)ALCP_prov_ec_gen_set_template },                             \
+        { OSSL_FUNC_KEYMGMT_GEN_SET_PARAMS,                                    \
+          (fptr_t)ALCP_prov_##grp##_gen_set_params },                          \
+        { OSSL_FUNC_KEYMGMT_GEN_SETTABLE_PARAMS,                               \
+          (fptr_t)ALCP_prov_##grp##_gen_settable_params },                     \
+        { OSSL_FUNC_KEYMGMT_GEN, (fptr_t)ALCP_prov_ec_gen },                   \
+        { OSSL_FUNC_KEYMGMT_GEN_CLEANUP, (fptr_t)ALCP_prov_ec_gen_cleanup },   \
+        { OSSL_FUNC_KEYMGMT_GET_PARAMS, (fptr_t)ALCP_prov_ec_get_params },     \
+        { OSSL_FUNC_KEYMGMT_GETTABLE_PARAMS,                                   \
+          (fptr_t)ALCP_prov_##grp##_gettable_params },                         \
+        { OSSL_FUNC_KEYMGMT_SET_PARAMS, (fptr_t)ALCP_prov_ec_set_params },     \
+        { OSSL_FUNC_KEYMGMT_SETTABLE_PARAMS,                                   \
+          (fptr_t)ALCP_prov_ec_settable_params },                              \
+        { OSSL_FUNC_KEYMGMT_HAS, (fptr_t)ALCP_prov_ec_has },                   \
+        { OSSL_FUNC_KEYMGMT_MATCH, (fptr_t)ALCP_prov_ec_match },               \
+        { OSSL_FUNC_KEYMGMT_VALIDATE, (fptr_t)ALCP_prov_ec_validate },         \
+        { OSSL_FUNC_KEYMGMT_IMPORT, (fptr_t)ALCP_prov_ec_import },             \
+        { OSSL_FUNC_KEYMGMT_IMPORT_TYPES,                                      \
+          (fptr_t)ALCP_prov_##grp##_key_types },                               \
+        { OSSL_FUNC_KEYMGMT_EXPORT, (fptr_t)ALCP_prov_ec_export },             \
+        { OSSL_FUNC_KEYMGMT_EXPORT_TYPES,                                      \
+          (fptr_t)ALCP_prov_##grp##_key_types },                               \
+        { OSSL_FUNC_KEYMGMT_DUP, (fptr_t)ALCP_prov_ec_dup },                   \
+        { OSSL_FUNC_KEYMGMT_QUERY_OPERATION_NAME,                              \
+          (fptr_t)ALCP_prov_##grp##_query_operation_name },                    \
+        { 0, NULL }                                                            \
+    }
+
+extern const OSSL_DISPATCH x25519_keymgmt_functions[];
+extern const OSSL_DISPATCH nist_keymgmt_functions[];
+extern const OSSL_DISPATCH rsa_keymgmt_functions[];
+
+#endif /* _OPENSSL_ALCP_KEYMGMT_PROV_H */
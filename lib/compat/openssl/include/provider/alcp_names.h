@@ -82,6 +82,18 @@
 #define ALCP_PROV_NAMES_AES_128_SIV "AES-128-SIV"
 #define ALCP_PROV_NAMES_AES_192_SIV "AES-192-SIV"
 #define ALCP_PROV_NAMES_AES_256_SIV "AES-256-SIV"
+
+// Stitched CBC and HMAC for TLS MAC-then-encrypt
+#define ALCP_PROV_NAMES_AES_128_CBC_HMAC_SHA1   "AES-128-CBC-HMAC-SHA1"
+#define ALCP_PROV_NAMES_AES_256_CBC_HMAC_SHA1   "AES-256-CBC-HMAC-SHA1"
+#define ALCP_PROV_NAMES_AES_128_CBC_HMAC_SHA256 "AES-128-CBC-HMAC-SHA256"
+#define ALCP_PROV_NAMES_AES_256_CBC_HMAC_SHA256 "AES-256-CBC-HMAC-SHA256"
+
+// ChaCha20
+#define ALCP_PROV_NAMES_CHACHA20 "ChaCha20"
+#define ALCP_PROV_NAMES_CHACHA20_POLY1305                                      \
+    "ChaCha20-Poly1305:1.2.840.113549.1.9.16.3.18"
+
 // DIGEST SHA2
 #define ALCP_PROV_NAMES_SHA2_224                                               \
     "SHA2-224:SHA-224:SHA224:2.16.840.1.101.3.4.2.4"
@@ -116,9 +128,18 @@
 #define ALCP_PROV_NAMES_TEST_RAND "TEST-RAND"
 #define ALCP_PROV_NAMES_SEED_SRC  "SEED-SRC"
 
+// KEYMGMT
+#define ALCP_PROV_NAMES_X25519 "X25519:1.3.101.110"
+#define ALCP_PROV_NAMES_EC     "EC:id-ecPublicKey:1.2.840.10045.2.1"
+#define ALCP_PROV_NAMES_RSA    "RSA:rsaEncryption:1.2.840.113549.1.1.1"
+
+// KEYEXCH
+#define ALCP_PROV_NAMES_ECDH "ECDH"
+
 // MAC
-#define ALCP_PROV_NAMES_HMAC "HMAC"
-#define ALCP_PROV_NAMES_CMAC "CMAC"
+#define ALCP_PROV_NAMES_HMAC     "HMAC"
+#define ALCP_PROV_NAMES_CMAC     "CMAC"
+#define ALCP_PROV_NAMES_POLY1305 "POLY1305"
 // FIXME: Add provider for below
 // #define ALCP_PROV_DESCS_HMAC_SIGN "OpenSSL HMAC via EVP_PKEY implementation"
 // #define ALCP_PROV_DESCS_CMAC_SIGN "OpenSSL CMAC via EVP_PKEY implementation"
@@ -42,6 +42,10 @@ extern const OSSL_ALGORITHM ALC_prov_ciphers[];
 extern const OSSL_ALGORITHM ALC_prov_digests[];
 extern const OSSL_ALGORITHM ALC_prov_macs[];
 extern const OSSL_ALGORITHM ALC_prov_rng[];
+extern const OSSL_ALGORITHM ALC_prov_keymgmt[];
+extern const OSSL_ALGORITHM ALC_prov_keyexch[];
+extern const OSSL_ALGORITHM ALC_prov_signature[];
+extern const OSSL_ALGORITHM ALC_prov_asym_cipher[];
 
 struct _alc_prov_ctx
 {
@@ -50,4 +54,10 @@ struct _alc_prov_ctx
 };
 typedef struct _alc_prov_ctx alc_prov_ctx_t, *alc_prov_ctx_p;
 
+int
+ALCP_get_capabilities(void*          provctx,
+                      const char*    capability,
+                      OSSL_CALLBACK* cb,
+                      void*          arg);
+
 #endif /* _OPENSSL_ALCP_PROV_H */
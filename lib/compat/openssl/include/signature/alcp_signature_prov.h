@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _OPENSSL_ALCP_SIGNATURE_PROV_H
+#define _OPENSSL_ALCP_SIGNATURE_PROV_H 2
+
+#include "keymgmt/alcp_keymgmt_prov.h"
+
+#include "debug.h"
+
+/*
+ * PKCS#1 v1.5 signatures with the SHA2 digests run on ALCP, everything else
+ * on a context of the default provider which is given every param set on
+ * this one.
+ */
+struct _alc_prov_signature_ctx
+{
+    alc_prov_ctx_t*              sc_prov_ctx;
+    alc_prov_rsa_key_t*          sc_key;
+    int                          sc_operation;
+    int                          sc_pad_mode;
+    int                          sc_flag_digest;
+    char                         sc_mdname[ALCP_PROV_RSA_MAX_NAME_SIZE];
+    const alc_prov_rsa_digest_t* sc_md;
+    alc_rsa_handle_t             sc_handle;
+    alc_digest_handle_t          sc_digest;
+    OSSL_PARAM*                  sc_params;
+    EVP_PKEY_CTX*                sc_fallback;
+    EVP_MD_CTX*                  sc_fallback_md;
+};
+typedef struct _alc_prov_signature_ctx alc_prov_signature_ctx_t,
+    *alc_prov_signature_ctx_p;
+
+extern const OSSL_ALGORITHM ALC_prov_signature[];
+
+extern OSSL_FUNC_signature_newctx_fn         ALCP_prov_signature_newctx;
+extern OSSL_FUNC_signature_sign_init_fn      ALCP_prov_signature_sign_init;
+extern OSSL_FUNC_signature_sign_fn           ALCP_prov_signature_sign;
+extern OSSL_FUNC_signature_verify_init_fn    ALCP_prov_signature_verify_init;
+extern OSSL_FUNC_signature_verify_fn         ALCP_prov_signature_verify;
+extern OSSL_FUNC_signature_digest_sign_init_fn
+    ALCP_prov_signature_digest_sign_init;
+extern OSSL_FUNC_signature_digest_sign_update_fn
+    ALCP_prov_signature_digest_update;
+extern OSSL_FUNC_signature_digest_sign_final_fn
+    ALCP_prov_signature_digest_sign_final;
+extern OSSL_FUNC_signature_digest_verify_init_fn
+    ALCP_prov_signature_digest_verify_init;
+extern OSSL_FUNC_signature_digest_verify_final_fn
+    ALCP_prov_signature_digest_verify_final;
+extern OSSL_FUNC_signature_freectx_fn        ALCP_prov_signature_freectx;
+extern OSSL_FUNC_signature_dupctx_fn         ALCP_prov_signature_dupctx;
+extern OSSL_FUNC_signature_get_ctx_params_fn ALCP_prov_signature_get_ctx_params;
+extern OSSL_FUNC_signature_gettable_ctx_params_fn
+    ALCP_prov_signature_gettable_ctx_params;
+extern OSSL_FUNC_signature_set_ctx_params_fn ALCP_prov_signature_set_ctx_params;
+extern OSSL_FUNC_signature_settable_ctx_params_fn
+    ALCP_prov_signature_settable_ctx_params;
+
+#define CREATE_SIGNATURE_DISPATCHERS()                                         \
+    const OSSL_DISPATCH signature_functions[] = {                              \
+        { OSSL_FUNC_SIGNATURE_NEWCTX, (fptr_t)ALCP_prov_signature_newctx },    \
+        { OSSL_FUNC_SIGNATURE_SIGN_INIT,                                       \
+          (fptr_t)ALCP_prov_signature_sign_init },                             \
+        { OSSL_FUNC_SIGNATURE_SIGN, (fptr_t)ALCP_prov_signature_sign },        \
+        { OSSL_FUNC_SIGNATURE_VERIFY_INIT,                                     \
+          (fptr_t)ALCP_prov_signature_verify_init },                           \
+        { OSSL_FUNC_SIGNATURE_VERIFY, (fptr_t)ALCP_prov_signature_verify },    \
+        { OSSL_FUNC_SIGNATURE_DIGEST_SIGN_INIT,                                \
+          (fptr_t)ALCP_prov_signature_digest_sign_init },                      \
+        { OSSL_FUNC_SIGNATURE_DIGEST_SIGN_UPDATE,                              \
+          (fptr_t)ALCP_prov_signature_digest_update },                         \
+        { OSSL_FUNC_SIGNATURE_DIGEST_SIGN_FINAL,                               \
+          (fptr_t)ALCP_prov_signature_digest_sign_final },                     \
+        { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY_INIT,                              \
+          (fptr_t)ALCP_prov_signature_digest_verify_init },                    \
+        { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY_UPDATE,                            \
+          (fptr_t)ALCP_prov_signature_digest_update },                         \
+        { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY_FINAL,                             \
+          (fptr_t)ALCP_prov_signature_digest_verify_final },                   \
+        { OSSL_FUNC_SIGNATURE_FREECTX, (fptr_t)ALCP_prov_signature_freectx },  \
+        { OSSL_FUNC_SIGNATURE_DUPCTX, (fptr_t)ALCP_prov_signature_dupctx },    \
+        { OSSL_FUNC_SIGNATURE_GET_CTX_PARAMS,                                  \
+          (fptr_t)ALCP_prov_signature_get_ctx_params },                        \
+        { OSSL_FUNC_SIGNATURE_GETTABLE_CTX_PARAMS,                             \
+          (fptr_t)ALCP_prov_signature_gettable_ctx_params },                   \
+        { OSSL_FUNC_SIGNATURE_SET_CTX_PARAMS,                                  \
+          (fptr_t)ALCP_prov_signature_set_ctx_params },                        \
+        { OSSL_FUNC_SIGNATURE_SETTABLE_CTX_PARAMS,                             \
+          (fptr_t)ALCP_prov_signature_settable_ctx_params },                   \
+        { 0, NULL }                                                            \
+    }
+
+#endif /* _OPENSSL_ALCP_SIGNATURE_PROV_H */
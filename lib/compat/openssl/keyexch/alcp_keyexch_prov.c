@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/params.h>
+
+#include "keyexch/alcp_keyexch_prov.h"
+#include "provider/alcp_names.h"
+
+static const char KEYEXCH_DEF_PROP[] = "provider=alcp,fips=no";
+
+void*
+ALCP_prov_keyexch_newctx(void* provctx)
+{
+    ENTER();
+    alc_prov_keyexch_ctx_p ctx = OPENSSL_zalloc(sizeof(*ctx));
+    if (ctx != NULL) {
+        ctx->kc_prov_ctx = provctx;
+    }
+    EXIT();
+    return ctx;
+}
+
+static int
+ALCP_prov_keyexch_set_priv(alc_prov_keyexch_ctx_p     ctx,
+                           const alc_prov_ec_curve_t* curve,
+                           const Uint8*               priv)
+{
+    if (ctx->kc_curve != NULL) {
+        ALCP_prov_ec_handle_free(&ctx->kc_handle, ctx->kc_curve);
+    }
+    ctx->kc_curve    = curve;
+    ctx->kc_has_peer = 0;
+    memcpy(ctx->kc_priv, priv, curve->ec_key_size);
+
+    if (!ALCP_prov_ec_handle_new(&ctx->kc_handle, curve)) {
+        ctx->kc_curve = NULL;
+        return 0;
+    }
+    if (alcp_is_error(alcp_ec_set_privatekey(&ctx->kc_handle, priv))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY);
+        return 0;
+    }
+    return 1;
+}
+
+int
+ALCP_prov_keyexch_init(void* vctx, void* provkey, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_keyexch_ctx_p ctx = vctx;
+    alc_prov_ec_key_p      key = provkey;
+
+    if (key == NULL || key->pk_curve == NULL || !key->pk_has_priv) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_A_PRIVATE_KEY);
+        return 0;
+    }
+    if (!ALCP_prov_keyexch_set_priv(ctx, key->pk_curve, key->pk_priv)) {
+        return 0;
+    }
+    EXIT();
+    return ALCP_prov_keyexch_set_ctx_params(ctx, params);
+}
+
+int
+ALCP_prov_keyexch_set_peer(void* vctx, void* provkey)
+{
+    ENTER();
+    alc_prov_keyexch_ctx_p ctx  = vctx;
+    alc_prov_ec_key_p      peer = provkey;
+    const Uint8 *          raw, *end;
+
+    if (ctx->kc_curve == NULL || peer->pk_curve != ctx->kc_curve
+        || !peer->pk_has_pub) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_MISMATCHING_DOMAIN_PARAMETERS);
+        return 0;
+    }
+    raw = ALCP_prov_ec_raw_pub(peer);
+    end = peer->pk_pub + ALCP_prov_ec_pub_len(peer->pk_curve);
+    memcpy(ctx->kc_peer, raw, end - raw);
+    ctx->kc_has_peer = 1;
+    EXIT();
+    return 1;
+}
+
+int
+ALCP_prov_keyexch_derive(void*          vctx,
+                         unsigned char* secret,
+                         size_t*        secretlen,
+                         size_t         outlen)
+{
+    ENTER();
+    alc_prov_keyexch_ctx_p ctx = vctx;
+    Uint64                 len;
+
+    if (ctx->kc_curve == NULL || !ctx->kc_has_peer) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_MISSING_KEY);
+        return 0;
+    }
+    len = ctx->kc_curve->ec_key_size;
+    if (secret == NULL) {
+        *secretlen = len;
+        return 1;
+    }
+    if (outlen < len) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_OUTPUT_BUFFER_TOO_SMALL);
+        return 0;
+    }
+    // fails for points off the curve and for small order X25519 points
+    if (alcp_is_error(alcp_ec_get_secretkey(
+            &ctx->kc_handle, secret, ctx->kc_peer, &len))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_DURING_DERIVATION);
+        return 0;
+    }
+    *secretlen = len;
+    EXIT();
+    return 1;
+}
+
+void
+ALCP_prov_keyexch_freectx(void* vctx)
+{
+    ENTER();
+    alc_prov_keyexch_ctx_p ctx = vctx;
+    if (ctx != NULL && ctx->kc_curve != NULL) {
+        ALCP_prov_ec_handle_free(&ctx->kc_handle, ctx->kc_curve);
+    }
+    OPENSSL_clear_free(ctx, sizeof(*ctx));
+    EXIT();
+}
+
+void*
+ALCP_prov_keyexch_dupctx(void* vctx)
+{
+    ENTER();
+    alc_prov_keyexch_ctx_p src = vctx;
+    alc_prov_keyexch_ctx_p ctx = ALCP_prov_keyexch_newctx(src->kc_prov_ctx);
+
+    if (ctx == NULL) {
+        return NULL;
+    }
+    // the ALCP session is not copyable, a new one gets the private key
+    if (src->kc_curve != NULL
+        && !ALCP_prov_keyexch_set_priv(ctx, src->kc_curve, src->kc_priv)) {
+        ALCP_prov_keyexch_freectx(ctx);
+        return NULL;
+    }
+    memcpy(ctx->kc_peer, src->kc_peer, sizeof(ctx->kc_peer));
+    ctx->kc_has_peer = src->kc_has_peer;
+    EXIT();
+    return ctx;
+}
+
+/*
+ * The prime curves have cofactor 1, so the cofactor mode changes nothing.
+ * There is no KDF, asking for one fails rather than being ignored.
+ */
+int
+ALCP_prov_keyexch_set_ctx_params(void* vctx, const OSSL_PARAM params[])
+{
+    ENTER();
+    const OSSL_PARAM* p;
+    const char*       kdf;
+    int               mode;
+
+    p = OSSL_PARAM_locate_const(params,
+                                OSSL_EXCHANGE_PARAM_EC_ECDH_COFACTOR_MODE);
+    if (p != NULL
+        && (!OSSL_PARAM_get_int(p, &mode) || mode < -1 || mode > 1)) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_EXCHANGE_PARAM_KDF_TYPE);
+    if (p != NULL
+        && (!OSSL_PARAM_get_utf8_string_ptr(p, &kdf) || kdf[0] != '\0')) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_SUPPORTED);
+        return 0;
+    }
+    EXIT();
+    return 1;
+}
+
+const OSSL_PARAM*
+ALCP_prov_keyexch_settable_ctx_params(void* vctx, void* provctx)
+{
+    static const OSSL_PARAM settable[] = {
+        OSSL_PARAM_int(OSSL_EXCHANGE_PARAM_EC_ECDH_COFACTOR_MODE, NULL),
+        OSSL_PARAM_utf8_string(OSSL_EXCHANGE_PARAM_KDF_TYPE, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return settable;
+}
+
+CREATE_KEYEXCH_DISPATCHERS();
+
+const OSSL_ALGORITHM ALC_prov_keyexch[] = {
+    { ALCP_PROV_NAMES_X25519, KEYEXCH_DEF_PROP, keyexch_functions },
+    { ALCP_PROV_NAMES_ECDH, KEYEXCH_DEF_PROP, keyexch_functions },
+    { NULL, NULL, NULL },
+};
@@ -0,0 +1,853 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/param_build.h>
+#include <openssl/params.h>
+#include <openssl/rand.h>
+
+#include "keymgmt/alcp_keymgmt_prov.h"
+
+/* Names follow OpenSSL, which exports the short name of the curve */
+static const alc_prov_ec_curve_t s_x25519_curve = {
+    "X25519", "x25519", ALCP_EC_CURVE25519, ALCP_EC_CURVE_TYPE_MONTGOMERY,
+    32,       253,      128,                32
+};
+
+static const alc_prov_ec_curve_t s_nist_curves[] = {
+    { "prime256v1",
+      "P-256",
+      ALCP_EC_SECP256R1,
+      ALCP_EC_CURVE_TYPE_SHORT_WEIERSTRASS,
+      32,
+      256,
+      128,
+      72 },
+    { "secp384r1",
+      "P-384",
+      ALCP_EC_SECP384R1,
+      ALCP_EC_CURVE_TYPE_SHORT_WEIERSTRASS,
+      48,
+      384,
+      192,
+      104 },
+    { "secp521r1",
+      "P-521",
+      ALCP_EC_SECP521R1,
+      ALCP_EC_CURVE_TYPE_SHORT_WEIERSTRASS,
+      66,
+      521,
+      256,
+      139 },
+};
+
+struct _alc_prov_ec_gen_ctx
+{
+    alc_prov_ctx_t*            gc_prov_ctx;
+    const alc_prov_ec_curve_t* gc_curve;
+    int                        gc_selection;
+};
+typedef struct _alc_prov_ec_gen_ctx alc_prov_ec_gen_ctx_t,
+    *alc_prov_ec_gen_ctx_p;
+
+static const alc_prov_ec_curve_t*
+ALCP_prov_nist_curve(const char* name)
+{
+    size_t count = sizeof(s_nist_curves) / sizeof(s_nist_curves[0]);
+    for (size_t i = 0; i < count; i++) {
+        if (OPENSSL_strcasecmp(name, s_nist_curves[i].ec_name) == 0
+            || OPENSSL_strcasecmp(name, s_nist_curves[i].ec_alias) == 0) {
+            return &s_nist_curves[i];
+        }
+    }
+    return NULL;
+}
+
+static int
+ALCP_prov_ec_is_nist(const alc_prov_ec_curve_t* curve)
+{
+    return curve->ec_curve_type == ALCP_EC_CURVE_TYPE_SHORT_WEIERSTRASS;
+}
+
+static void
+ALCP_prov_ec_info(alc_ec_info_p info, const alc_prov_ec_curve_t* curve)
+{
+    info->ecCurveId     = curve->ec_curve_id;
+    info->ecCurveType   = curve->ec_curve_type;
+    info->ecPointFormat = ALCP_EC_POINT_FORMAT_UNCOMPRESSED;
+}
+
+size_t
+ALCP_prov_ec_pub_len(const alc_prov_ec_curve_t* curve)
+{
+    return ALCP_prov_ec_is_nist(curve) ? 1 + 2 * curve->ec_key_size
+                                       : curve->ec_key_size;
+}
+
+const Uint8*
+ALCP_prov_ec_raw_pub(const alc_prov_ec_key_t* key)
+{
+    return ALCP_prov_ec_is_nist(key->pk_curve) ? key->pk_pub + 1
+                                               : key->pk_pub;
+}
+
+int
+ALCP_prov_ec_handle_new(alc_ec_handle_p            handle,
+                        const alc_prov_ec_curve_t* curve)
+{
+    alc_ec_info_t info;
+    ALCP_prov_ec_info(&info, curve);
+
+    handle->context = OPENSSL_malloc(alcp_ec_context_size(&info));
+    if (handle->context == NULL) {
+        return 0;
+    }
+    if (alcp_is_error(alcp_ec_request(&info, handle))) {
+        OPENSSL_free(handle->context);
+        handle->context = NULL;
+        return 0;
+    }
+    return 1;
+}
+
+void
+ALCP_prov_ec_handle_free(alc_ec_handle_p            handle,
+                         const alc_prov_ec_curve_t* curve)
+{
+    alc_ec_info_t info;
+    ALCP_prov_ec_info(&info, curve);
+
+    if (handle->context != NULL) {
+        alcp_ec_finish(handle);
+        // the context held a private key
+        OPENSSL_clear_free(handle->context, alcp_ec_context_size(&info));
+        handle->context = NULL;
+    }
+}
+
+/*
+ * Computes the public key of pk_priv, a NIST private key out of [1, n - 1]
+ * is refused by ALCP.
+ */
+static int
+ALCP_prov_ec_set_pub_from_priv(alc_prov_ec_key_t* key, alc_ec_handle_p handle)
+{
+    Uint8* pub = key->pk_pub;
+    if (ALCP_prov_ec_is_nist(key->pk_curve)) {
+        *pub++ = 0x04;
+    }
+    key->pk_has_pub =
+        !alcp_is_error(alcp_ec_get_publickey(handle, pub, key->pk_priv));
+    return key->pk_has_pub;
+}
+
+static int
+ALCP_prov_ec_compute_pub(alc_prov_ec_key_t* key)
+{
+    alc_ec_handle_t handle;
+    int             ret;
+
+    if (!ALCP_prov_ec_handle_new(&handle, key->pk_curve)) {
+        return 0;
+    }
+    ret = ALCP_prov_ec_set_pub_from_priv(key, &handle);
+    ALCP_prov_ec_handle_free(&handle, key->pk_curve);
+    return ret;
+}
+
+static int
+ALCP_prov_ec_generate(alc_prov_ec_key_t* key)
+{
+    const alc_prov_ec_curve_t* curve = key->pk_curve;
+    alc_ec_handle_t            handle;
+    int                        ret = 0;
+
+    if (!ALCP_prov_ec_handle_new(&handle, curve)) {
+        return 0;
+    }
+    // out of range NIST scalars are rare, a few draws are plenty
+    for (int i = 0; i < 16 && !ret; i++) {
+        if (RAND_priv_bytes_ex(key->pk_prov_ctx->ap_libctx,
+                               key->pk_priv,
+                               curve->ec_key_size,
+                               curve->ec_security_bits)
+            <= 0) {
+            break;
+        }
+        // big endian NIST scalars only keep the bits of the order
+        if (ALCP_prov_ec_is_nist(curve) && curve->ec_bits % 8) {
+            key->pk_priv[0] &= (1 << (curve->ec_bits % 8)) - 1;
+        }
+        ret = ALCP_prov_ec_set_pub_from_priv(key, &handle);
+    }
+    ALCP_prov_ec_handle_free(&handle, curve);
+
+    key->pk_has_priv = ret;
+    return ret;
+}
+
+static void*
+ALCP_prov_ec_new(void* provctx, const alc_prov_ec_curve_t* curve)
+{
+    ENTER();
+    alc_prov_ec_key_p key = OPENSSL_zalloc(sizeof(*key));
+    if (key != NULL) {
+        key->pk_prov_ctx = provctx;
+        key->pk_curve    = curve;
+    }
+    EXIT();
+    return key;
+}
+
+static OSSL_FUNC_keymgmt_new_fn ALCP_prov_x25519_new;
+static void*
+ALCP_prov_x25519_new(void* provctx)
+{
+    return ALCP_prov_ec_new(provctx, &s_x25519_curve);
+}
+
+static OSSL_FUNC_keymgmt_new_fn ALCP_prov_nist_new;
+static void*
+ALCP_prov_nist_new(void* provctx)
+{
+    // the curve comes with the domain parameters
+    return ALCP_prov_ec_new(provctx, NULL);
+}
+
+void
+ALCP_prov_ec_free(void* keydata)
+{
+    ENTER();
+    OPENSSL_clear_free(keydata, sizeof(alc_prov_ec_key_t));
+    EXIT();
+}
+
+static int
+ALCP_prov_x25519_gen_set_params(void* genctx, const OSSL_PARAM params[])
+{
+    ENTER();
+    const OSSL_PARAM* p;
+    const char*       name;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_GROUP_NAME);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_utf8_string_ptr(p, &name)
+            || OPENSSL_strcasecmp(name, s_x25519_curve.ec_alias) != 0) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_CURVE);
+            return 0;
+        }
+    }
+    EXIT();
+    return 1;
+}
+
+static int
+ALCP_prov_nist_gen_set_params(void* genctx, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_ec_gen_ctx_p gctx = genctx;
+    const OSSL_PARAM*     p;
+    const char*           name;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_GROUP_NAME);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_utf8_string_ptr(p, &name)
+            || (gctx->gc_curve = ALCP_prov_nist_curve(name)) == NULL) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_CURVE);
+            return 0;
+        }
+    }
+    EXIT();
+    return 1;
+}
+
+static const OSSL_PARAM*
+ALCP_prov_ec_gen_settable_params(void* genctx, void* provctx)
+{
+    static const OSSL_PARAM settable[] = {
+        OSSL_PARAM_utf8_string(OSSL_PKEY_PARAM_GROUP_NAME, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return settable;
+}
+
+static OSSL_FUNC_keymgmt_gen_settable_params_fn
+    ALCP_prov_x25519_gen_settable_params;
+static const OSSL_PARAM*
+ALCP_prov_x25519_gen_settable_params(void* genctx, void* provctx)
+{
+    return ALCP_prov_ec_gen_settable_params(genctx, provctx);
+}
+
+static OSSL_FUNC_keymgmt_gen_settable_params_fn
+    ALCP_prov_nist_gen_settable_params;
+static const OSSL_PARAM*
+ALCP_prov_nist_gen_settable_params(void* genctx, void* provctx)
+{
+    return ALCP_prov_ec_gen_settable_params(genctx, provctx);
+}
+
+static void*
+ALCP_prov_ec_gen_init(void*                      provctx,
+                      int                        selection,
+                      const alc_prov_ec_curve_t* curve)
+{
+    ENTER();
+    alc_prov_ec_gen_ctx_p gctx = OPENSSL_zalloc(sizeof(*gctx));
+    if (gctx != NULL) {
+        gctx->gc_prov_ctx  = provctx;
+        gctx->gc_curve     = curve;
+        gctx->gc_selection = selection;
+    }
+    EXIT();
+    return gctx;
+}
+
+static OSSL_FUNC_keymgmt_gen_init_fn ALCP_prov_x25519_gen_init;
+static void*
+ALCP_prov_x25519_gen_init(void*            provctx,
+                          int              selection,
+                          const OSSL_PARAM params[])
+{
+    void* gctx = ALCP_prov_ec_gen_init(provctx, selection, &s_x25519_curve);
+    if (gctx != NULL && !ALCP_prov_x25519_gen_set_params(gctx, params)) {
+        ALCP_prov_ec_gen_cleanup(gctx);
+        gctx = NULL;
+    }
+    return gctx;
+}
+
+static OSSL_FUNC_keymgmt_gen_init_fn ALCP_prov_nist_gen_init;
+static void*
+ALCP_prov_nist_gen_init(void*            provctx,
+                        int              selection,
+                        const OSSL_PARAM params[])
+{
+    void* gctx = ALCP_prov_ec_gen_init(provctx, selection, NULL);
+    if (gctx != NULL && !ALCP_prov_nist_gen_set_params(gctx, params)) {
+        ALCP_prov_ec_gen_cleanup(gctx);
+        gctx = NULL;
+    }
+    return gctx;
+}
+
+int
+ALCP_prov_ec_gen_set_template(void* genctx, void* templ)
+{
+    ENTER();
+    alc_prov_ec_gen_ctx_p gctx = genctx;
+    alc_prov_ec_key_p     key  = templ;
+
+    if (key->pk_curve != NULL) {
+        gctx->gc_curve = key->pk_curve;
+    }
+    EXIT();
+    return 1;
+}
+
+void*
+ALCP_prov_ec_gen(void* genctx, OSSL_CALLBACK* cb, void* cbarg)
+{
+    ENTER();
+    alc_prov_ec_gen_ctx_p gctx = genctx;
+    alc_prov_ec_key_p     key;
+
+    if (gctx->gc_curve == NULL) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_CURVE);
+        return NULL;
+    }
+    key = ALCP_prov_ec_new(gctx->gc_prov_ctx, gctx->gc_curve);
+    if (key == NULL) {
+        return NULL;
+    }
+    if ((gctx->gc_selection & OSSL_KEYMGMT_SELECT_KEYPAIR) != 0
+        && !ALCP_prov_ec_generate(key)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GENERATE_KEY);
+        ALCP_prov_ec_free(key);
+        return NULL;
+    }
+    EXIT();
+    return key;
+}
+
+void
+ALCP_prov_ec_gen_cleanup(void* genctx)
+{
+    ENTER();
+    OPENSSL_free(genctx);
+    EXIT();
+}
+
+/* The private key is a big number on the prime curves and a string on X25519 */
+static int
+ALCP_prov_ec_get_priv(alc_prov_ec_key_t* key, const OSSL_PARAM* p)
+{
+    const alc_prov_ec_curve_t* curve = key->pk_curve;
+    BIGNUM*                    bn    = NULL;
+    void*                      priv  = key->pk_priv;
+    size_t                     len;
+    int                        ret;
+
+    if (!ALCP_prov_ec_is_nist(curve)) {
+        return OSSL_PARAM_get_octet_string(p, &priv, curve->ec_key_size, &len)
+               && len == curve->ec_key_size;
+    }
+    ret = OSSL_PARAM_get_BN(p, &bn)
+          && BN_bn2binpad(bn, key->pk_priv, curve->ec_key_size) > 0;
+    BN_clear_free(bn);
+    return ret;
+}
+
+static int
+ALCP_prov_ec_set_priv(const alc_prov_ec_key_t* key, OSSL_PARAM* p)
+{
+    const alc_prov_ec_curve_t* curve = key->pk_curve;
+    BIGNUM*                    bn;
+    int                        ret;
+
+    if (!ALCP_prov_ec_is_nist(curve)) {
+        return OSSL_PARAM_set_octet_string(
+            p, key->pk_priv, curve->ec_key_size);
+    }
+    bn  = BN_secure_new();
+    ret = bn != NULL
+          && BN_bin2bn(key->pk_priv, curve->ec_key_size, bn) != NULL
+          && OSSL_PARAM_set_BN(p, bn);
+    BN_clear_free(bn);
+    return ret;
+}
+
+int
+ALCP_prov_ec_get_params(void* keydata, OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_ec_key_p          key   = keydata;
+    const alc_prov_ec_curve_t* curve = key->pk_curve;
+    OSSL_PARAM*                p;
+
+    if (curve == NULL) {
+        return 0;
+    }
+    if ((p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_BITS)) != NULL
+        && !OSSL_PARAM_set_int(p, curve->ec_bits)) {
+        return 0;
+    }
+    if ((p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_SECURITY_BITS)) != NULL
+        && !OSSL_PARAM_set_int(p, curve->ec_security_bits)) {
+        return 0;
+    }
+    if ((p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_MAX_SIZE)) != NULL
+        && !OSSL_PARAM_set_int(p, curve->ec_max_size)) {
+        return 0;
+    }
+    if (ALCP_prov_ec_is_nist(curve)
+        && (p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_GROUP_NAME)) != NULL
+        && !OSSL_PARAM_set_utf8_string(p, curve->ec_name)) {
+        return 0;
+    }
+    // libssl refuses EC certificates without a point format
+    if (ALCP_prov_ec_is_nist(curve)
+        && (p = OSSL_PARAM_locate(
+                params, OSSL_PKEY_PARAM_EC_POINT_CONVERSION_FORMAT))
+               != NULL
+        && !OSSL_PARAM_set_utf8_string(p, "uncompressed")) {
+        return 0;
+    }
+    if (key->pk_has_pub) {
+        p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY);
+        if (p != NULL
+            && !OSSL_PARAM_set_octet_string(
+                p, key->pk_pub, ALCP_prov_ec_pub_len(curve))) {
+            return 0;
+        }
+        p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_PUB_KEY);
+        if (p != NULL
+            && !OSSL_PARAM_set_octet_string(
+                p, key->pk_pub, ALCP_prov_ec_pub_len(curve))) {
+            return 0;
+        }
+    }
+    if (key->pk_has_priv
+        && (p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_PRIV_KEY)) != NULL
+        && !ALCP_prov_ec_set_priv(key, p)) {
+        return 0;
+    }
+    EXIT();
+    return 1;
+}
+
+static OSSL_FUNC_keymgmt_gettable_params_fn ALCP_prov_x25519_gettable_params;
+static const OSSL_PARAM*
+ALCP_prov_x25519_gettable_params(void* provctx)
+{
+    static const OSSL_PARAM gettable[] = {
+        OSSL_PARAM_int(OSSL_PKEY_PARAM_BITS, NULL),
+        OSSL_PARAM_int(OSSL_PKEY_PARAM_SECURITY_BITS, NULL),
+        OSSL_PARAM_int(OSSL_PKEY_PARAM_MAX_SIZE, NULL),
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY, NULL, 0),
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PUB_KEY, NULL, 0),
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PRIV_KEY, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return gettable;
+}
+
+static OSSL_FUNC_keymgmt_gettable_params_fn ALCP_prov_nist_gettable_params;
+static const OSSL_PARAM*
+ALCP_prov_nist_gettable_params(void* provctx)
+{
+    static const OSSL_PARAM gettable[] = {
+        OSSL_PARAM_int(OSSL_PKEY_PARAM_BITS, NULL),
+        OSSL_PARAM_int(OSSL_PKEY_PARAM_SECURITY_BITS, NULL),
+        OSSL_PARAM_int(OSSL_PKEY_PARAM_MAX_SIZE, NULL),
+        OSSL_PARAM_utf8_string(OSSL_PKEY_PARAM_GROUP_NAME, NULL, 0),
+        OSSL_PARAM_utf8_string(
+            OSSL_PKEY_PARAM_EC_POINT_CONVERSION_FORMAT, NULL, 0),
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY, NULL, 0),
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PUB_KEY, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_PRIV_KEY, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return gettable;
+}
+
+/* Only uncompressed points, the form TLS puts in its key shares */
+static int
+ALCP_prov_ec_get_pub(alc_prov_ec_key_t* key, const OSSL_PARAM* p)
+{
+    const alc_prov_ec_curve_t* curve = key->pk_curve;
+    void*                      pub   = key->pk_pub;
+    size_t                     len;
+
+    if (!OSSL_PARAM_get_octet_string(
+            p, &pub, ALCP_prov_ec_pub_len(curve), &len)
+        || len != ALCP_prov_ec_pub_len(curve)
+        || (ALCP_prov_ec_is_nist(curve) && key->pk_pub[0] != 0x04)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY);
+        return 0;
+    }
+    return 1;
+}
+
+int
+ALCP_prov_ec_set_params(void* keydata, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_ec_key_p key = keydata;
+    const OSSL_PARAM* p;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY);
+    if (p != NULL) {
+        // a peer key, EVP_PKEY_copy_parameters() gave it its curve
+        if (key->pk_curve == NULL || !ALCP_prov_ec_get_pub(key, p)) {
+            return 0;
+        }
+        OPENSSL_cleanse(key->pk_priv, sizeof(key->pk_priv));
+        key->pk_has_priv = 0;
+        key->pk_has_pub  = 1;
+    }
+    EXIT();
+    return 1;
+}
+
+const OSSL_PARAM*
+ALCP_prov_ec_settable_params(void* provctx)
+{
+    static const OSSL_PARAM settable[] = {
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return settable;
+}
+
+int
+ALCP_prov_ec_has(const void* keydata, int selection)
+{
+    ENTER();
+    const alc_prov_ec_key_t* key = keydata;
+    int                      ret = key != NULL;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_ALL_PARAMETERS) != 0) {
+        ret = ret && key->pk_curve != NULL;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PUBLIC_KEY) != 0) {
+        ret = ret && key->pk_has_pub;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0) {
+        ret = ret && key->pk_has_priv;
+    }
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_ec_match(const void* keydata1, const void* keydata2, int selection)
+{
+    ENTER();
+    const alc_prov_ec_key_t* key1 = keydata1;
+    const alc_prov_ec_key_t* key2 = keydata2;
+    const alc_prov_ec_curve_t* curve = key1->pk_curve;
+
+    if (curve == NULL || curve != key2->pk_curve) {
+        return 0;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0) {
+        return 1;
+    }
+    if (key1->pk_has_pub && key2->pk_has_pub) {
+        return CRYPTO_memcmp(
+                   key1->pk_pub, key2->pk_pub, ALCP_prov_ec_pub_len(curve))
+               == 0;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0
+        && key1->pk_has_priv && key2->pk_has_priv) {
+        return CRYPTO_memcmp(
+                   key1->pk_priv, key2->pk_priv, curve->ec_key_size)
+               == 0;
+    }
+    EXIT();
+    return 0;
+}
+
+/*
+ * Points of a peer are checked to be on the curve when the secret is
+ * derived, a pair is checked by computing the public key again.
+ */
+int
+ALCP_prov_ec_validate(const void* keydata, int selection, int checktype)
+{
+    ENTER();
+    const alc_prov_ec_key_t* key = keydata;
+    alc_prov_ec_key_t        pair;
+    int                      ret;
+
+    if (!ALCP_prov_ec_has(keydata, selection)) {
+        return 0;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR)
+        != OSSL_KEYMGMT_SELECT_KEYPAIR) {
+        return 1;
+    }
+    pair = *key;
+    ret  = ALCP_prov_ec_compute_pub(&pair)
+          && CRYPTO_memcmp(pair.pk_pub,
+                           key->pk_pub,
+                           ALCP_prov_ec_pub_len(key->pk_curve))
+                 == 0;
+    OPENSSL_cleanse(&pair, sizeof(pair));
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_ec_import(void* keydata, int selection, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_ec_key_p key = keydata;
+    const OSSL_PARAM* p;
+    const char*       name;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_GROUP_NAME);
+    if (p != NULL && key->pk_curve != &s_x25519_curve) {
+        if (!OSSL_PARAM_get_utf8_string_ptr(p, &name)
+            || (key->pk_curve = ALCP_prov_nist_curve(name)) == NULL) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_CURVE);
+            return 0;
+        }
+    }
+    if (key->pk_curve == NULL) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_CURVE);
+        return 0;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0) {
+        return 1;
+    }
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_PUB_KEY);
+    if (p != NULL) {
+        if (!ALCP_prov_ec_get_pub(key, p)) {
+            return 0;
+        }
+        key->pk_has_pub = 1;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_PRIV_KEY);
+    if (p != NULL && (selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0) {
+        if (!ALCP_prov_ec_get_priv(key, p)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY);
+            return 0;
+        }
+        key->pk_has_priv = 1;
+        if (!key->pk_has_pub && !ALCP_prov_ec_compute_pub(key)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY);
+            return 0;
+        }
+    }
+    EXIT();
+    return key->pk_has_pub;
+}
+
+int
+ALCP_prov_ec_export(void*          keydata,
+                    int            selection,
+                    OSSL_CALLBACK* param_cb,
+                    void*          cbarg)
+{
+    ENTER();
+    alc_prov_ec_key_p          key   = keydata;
+    const alc_prov_ec_curve_t* curve = key->pk_curve;
+    OSSL_PARAM_BLD*            bld;
+    OSSL_PARAM*                params = NULL;
+    BIGNUM*                    bn     = NULL;
+    int                        ret    = 0;
+
+    if (curve == NULL || (bld = OSSL_PARAM_BLD_new()) == NULL) {
+        return 0;
+    }
+    if (ALCP_prov_ec_is_nist(curve)
+        && (selection & OSSL_KEYMGMT_SELECT_ALL_PARAMETERS) != 0
+        && !OSSL_PARAM_BLD_push_utf8_string(
+            bld, OSSL_PKEY_PARAM_GROUP_NAME, curve->ec_name, 0)) {
+        goto out;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PUBLIC_KEY) != 0 && key->pk_has_pub
+        && !OSSL_PARAM_BLD_push_octet_string(bld,
+                                             OSSL_PKEY_PARAM_PUB_KEY,
+                                             key->pk_pub,
+                                             ALCP_prov_ec_pub_len(curve))) {
+        goto out;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0
+        && key->pk_has_priv) {
+        if (!ALCP_prov_ec_is_nist(curve)) {
+            if (!OSSL_PARAM_BLD_push_octet_string(bld,
+                                                  OSSL_PKEY_PARAM_PRIV_KEY,
+                                                  key->pk_priv,
+                                                  curve->ec_key_size)) {
+                goto out;
+            }
+        } else if ((bn = BN_secure_new()) == NULL
+                   || BN_bin2bn(key->pk_priv, curve->ec_key_size, bn) == NULL
+                   || !OSSL_PARAM_BLD_push_BN_pad(bld,
+                                                  OSSL_PKEY_PARAM_PRIV_KEY,
+                                                  bn,
+                                                  curve->ec_key_size)) {
+            goto out;
+        }
+    }
+    if ((params = OSSL_PARAM_BLD_to_param(bld)) == NULL) {
+        goto out;
+    }
+    ret = param_cb(params, cbarg);
+
+out:
+    OSSL_PARAM_free(params);
+    OSSL_PARAM_BLD_free(bld);
+    BN_clear_free(bn);
+    EXIT();
+    return ret;
+}
+
+static OSSL_FUNC_keymgmt_import_types_fn ALCP_prov_x25519_key_types;
+static const OSSL_PARAM*
+ALCP_prov_x25519_key_types(int selection)
+{
+    static const OSSL_PARAM types[] = {
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PUB_KEY, NULL, 0),
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PRIV_KEY, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return types;
+}
+
+static OSSL_FUNC_keymgmt_import_types_fn ALCP_prov_nist_key_types;
+static const OSSL_PARAM*
+ALCP_prov_nist_key_types(int selection)
+{
+    static const OSSL_PARAM types[] = {
+        OSSL_PARAM_utf8_string(OSSL_PKEY_PARAM_GROUP_NAME, NULL, 0),
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PUB_KEY, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_PRIV_KEY, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return types;
+}
+
+void*
+ALCP_prov_ec_dup(const void* keydata_from, int selection)
+{
+    ENTER();
+    const alc_prov_ec_key_t* from = keydata_from;
+    alc_prov_ec_key_p        key;
+
+    key = ALCP_prov_ec_new(from->pk_prov_ctx, from->pk_curve);
+    if (key == NULL) {
+        return NULL;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PUBLIC_KEY) != 0 && from->pk_has_pub) {
+        memcpy(key->pk_pub, from->pk_pub, sizeof(key->pk_pub));
+        key->pk_has_pub = 1;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0
+        && from->pk_has_priv) {
+        memcpy(key->pk_priv, from->pk_priv, sizeof(key->pk_priv));
+        key->pk_has_priv = 1;
+    }
+    EXIT();
+    return key;
+}
+
+static OSSL_FUNC_keymgmt_query_operation_name_fn
+    ALCP_prov_x25519_query_operation_name;
+static const char*
+ALCP_prov_x25519_query_operation_name(int operation_id)
+{
+    return NULL;
+}
+
+/* EC keys are used by ECDH and ECDSA, neither is named after the key */
+static OSSL_FUNC_keymgmt_query_operation_name_fn
+    ALCP_prov_nist_query_operation_name;
+static const char*
+ALCP_prov_nist_query_operation_name(int operation_id)
+{
+    switch (operation_id) {
+        case OSSL_OP_KEYEXCH:
+            return "ECDH";
+        case OSSL_OP_SIGNATURE:
+            return "ECDSA";
+        default:
+            break;
+    }
+    return NULL;
+}
+
+CREATE_KEYMGMT_DISPATCHERS(x25519);
+CREATE_KEYMGMT_DISPATCHERS(nist);
@@ -0,0 +1,905 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/param_build.h>
+#include <openssl/params.h>
+#include <openssl/rsa.h>
+
+#include "keymgmt/alcp_keymgmt_prov.h"
+#include "provider/alcp_names.h"
+
+/* DER prefixes of the DigestInfo of PKCS#1 v1.5 signatures, RFC 8017 9.2 */
+static const Uint8 s_digest_info_sha224[] = {
+    0x30, 0x2d, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+    0x65, 0x03, 0x04, 0x02, 0x04, 0x05, 0x00, 0x04, 0x1c
+};
+static const Uint8 s_digest_info_sha256[] = {
+    0x30, 0x31, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+    0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20
+};
+static const Uint8 s_digest_info_sha384[] = {
+    0x30, 0x41, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+    0x65, 0x03, 0x04, 0x02, 0x02, 0x05, 0x00, 0x04, 0x30
+};
+static const Uint8 s_digest_info_sha512[] = {
+    0x30, 0x51, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+    0x65, 0x03, 0x04, 0x02, 0x03, 0x05, 0x00, 0x04, 0x40
+};
+
+/* AlgorithmIdentifier of shaXXXWithRSAEncryption, put in certificates */
+static const Uint8 s_algorithm_id_sha224[] = {
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+    0xf7, 0x0d, 0x01, 0x01, 0x0e, 0x05, 0x00
+};
+static const Uint8 s_algorithm_id_sha256[] = {
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+    0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00
+};
+static const Uint8 s_algorithm_id_sha384[] = {
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+    0xf7, 0x0d, 0x01, 0x01, 0x0c, 0x05, 0x00
+};
+static const Uint8 s_algorithm_id_sha512[] = {
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+    0xf7, 0x0d, 0x01, 0x01, 0x0d, 0x05, 0x00
+};
+
+#define ALCP_PROV_RSA_DIGEST(names, len, mode, info, id)                       \
+    {                                                                          \
+        names,                                                                 \
+        { .dt_type = ALC_DIGEST_TYPE_SHA2,                                     \
+          .dt_len  = ALC_DIGEST_LEN_##len,                                     \
+          .dt_mode = { .dm_sha2 = mode } },                                    \
+        len / 8, info, sizeof(info), id, sizeof(id)                            \
+    }
+
+static const alc_prov_rsa_digest_t s_rsa_digests[] = {
+    ALCP_PROV_RSA_DIGEST(ALCP_PROV_NAMES_SHA2_224,
+                         224,
+                         ALC_SHA2_224,
+                         s_digest_info_sha224,
+                         s_algorithm_id_sha224),
+    ALCP_PROV_RSA_DIGEST(ALCP_PROV_NAMES_SHA2_256,
+                         256,
+                         ALC_SHA2_256,
+                         s_digest_info_sha256,
+                         s_algorithm_id_sha256),
+    ALCP_PROV_RSA_DIGEST(ALCP_PROV_NAMES_SHA2_384,
+                         384,
+                         ALC_SHA2_384,
+                         s_digest_info_sha384,
+                         s_algorithm_id_sha384),
+    ALCP_PROV_RSA_DIGEST(ALCP_PROV_NAMES_SHA2_512,
+                         512,
+                         ALC_SHA2_512,
+                         s_digest_info_sha512,
+                         s_algorithm_id_sha512),
+};
+
+static const OSSL_ITEM s_pad_modes[] = {
+    { RSA_PKCS1_PADDING, OSSL_PKEY_RSA_PAD_MODE_PKCSV15 },
+    { RSA_NO_PADDING, OSSL_PKEY_RSA_PAD_MODE_NONE },
+    { RSA_PKCS1_OAEP_PADDING, OSSL_PKEY_RSA_PAD_MODE_OAEP },
+    { RSA_X931_PADDING, OSSL_PKEY_RSA_PAD_MODE_X931 },
+    { RSA_PKCS1_PSS_PADDING, OSSL_PKEY_RSA_PAD_MODE_PSS },
+};
+
+struct _alc_prov_rsa_gen_ctx
+{
+    alc_prov_ctx_t* rg_prov_ctx;
+    int             rg_selection;
+    size_t          rg_bits;
+    size_t          rg_primes;
+    BIGNUM*         rg_e;
+};
+typedef struct _alc_prov_rsa_gen_ctx alc_prov_rsa_gen_ctx_t,
+    *alc_prov_rsa_gen_ctx_p;
+
+/* names is one of the colon separated lists of alcp_names.h */
+static int
+ALCP_prov_rsa_name_is(const char* names, const char* name)
+{
+    size_t len = strlen(name);
+
+    while (names != NULL) {
+        const char* end = strchr(names, ':');
+        size_t      n   = end != NULL ? (size_t)(end - names) : strlen(names);
+
+        if (n == len && OPENSSL_strncasecmp(names, name, n) == 0) {
+            return 1;
+        }
+        names = end != NULL ? end + 1 : NULL;
+    }
+    return 0;
+}
+
+const alc_prov_rsa_digest_t*
+ALCP_prov_rsa_digest(const char* name)
+{
+    size_t count = sizeof(s_rsa_digests) / sizeof(s_rsa_digests[0]);
+
+    for (size_t i = 0; name != NULL && i < count; i++) {
+        if (ALCP_prov_rsa_name_is(s_rsa_digests[i].rd_names, name)) {
+            return &s_rsa_digests[i];
+        }
+    }
+    return NULL;
+}
+
+/* The padding mode comes as a number or as its name */
+int
+ALCP_prov_rsa_get_pad_mode(const OSSL_PARAM* p, int* pad_mode)
+{
+    size_t      count = sizeof(s_pad_modes) / sizeof(s_pad_modes[0]);
+    const char* name;
+
+    if (p->data_type == OSSL_PARAM_INTEGER) {
+        return OSSL_PARAM_get_int(p, pad_mode);
+    }
+    if (!OSSL_PARAM_get_utf8_string_ptr(p, &name)) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (OPENSSL_strcasecmp(name, s_pad_modes[i].ptr) == 0) {
+            *pad_mode = s_pad_modes[i].id;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int
+ALCP_prov_rsa_set_pad_mode(OSSL_PARAM* p, int pad_mode)
+{
+    size_t count = sizeof(s_pad_modes) / sizeof(s_pad_modes[0]);
+
+    if (p->data_type == OSSL_PARAM_INTEGER) {
+        return OSSL_PARAM_set_int(p, pad_mode);
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (s_pad_modes[i].id == (unsigned int)pad_mode) {
+            return OSSL_PARAM_set_utf8_string(p, s_pad_modes[i].ptr);
+        }
+    }
+    return 0;
+}
+
+/*
+ * Every param set on an operation is kept, the default provider gets them
+ * all when the operation falls back to it.
+ */
+int
+ALCP_prov_rsa_save_params(OSSL_PARAM** saved, const OSSL_PARAM params[])
+{
+    OSSL_PARAM* merged;
+    OSSL_PARAM* dup;
+
+    if (params == NULL || params[0].key == NULL) {
+        return 1;
+    }
+    // the merged list points to the data of both lists
+    merged = OSSL_PARAM_merge(*saved, params);
+    if (merged == NULL) {
+        return 0;
+    }
+    dup = OSSL_PARAM_dup(merged);
+    OPENSSL_free(merged);
+    if (dup == NULL) {
+        return 0;
+    }
+    OSSL_PARAM_free(*saved);
+    *saved = dup;
+    return 1;
+}
+
+EVP_PKEY_CTX*
+ALCP_prov_rsa_fallback_ctx(const alc_prov_rsa_key_t* key)
+{
+    return EVP_PKEY_CTX_new_from_pkey(key->rk_prov_ctx->ap_libctx,
+                                      key->rk_pkey,
+                                      ALCP_PROV_RSA_FALLBACK_PROP);
+}
+
+int
+ALCP_prov_rsa_handle_new(alc_rsa_handle_p          handle,
+                         const alc_prov_rsa_key_t* key)
+{
+    handle->context = OPENSSL_malloc(alcp_rsa_context_size(key->rk_key_size));
+    if (handle->context == NULL) {
+        return 0;
+    }
+    if (alcp_is_error(alcp_rsa_request(key->rk_key_size, handle))) {
+        OPENSSL_free(handle->context);
+        handle->context = NULL;
+        return 0;
+    }
+    if (alcp_is_error(alcp_rsa_set_key(handle, key->rk_alcp))) {
+        ALCP_prov_rsa_handle_free(handle, key->rk_key_size);
+        return 0;
+    }
+    return 1;
+}
+
+void
+ALCP_prov_rsa_handle_free(alc_rsa_handle_p handle, alc_rsa_key_size key_size)
+{
+    if (handle->context != NULL) {
+        alcp_rsa_finish(handle);
+        OPENSSL_clear_free(handle->context, alcp_rsa_context_size(key_size));
+        handle->context = NULL;
+    }
+}
+
+/*
+ * The RSA decryption primitive. Its result is checked with the public key,
+ * a faulty CRT exponentiation would leak the factors.
+ */
+int
+ALCP_prov_rsa_private(alc_rsa_handle_p handle,
+                      size_t           size,
+                      const Uint8*     in,
+                      Uint8*           out)
+{
+    Uint8 check[ALCP_PROV_RSA_MAX_KEY_SIZE];
+    int   ret;
+
+    ret = !alcp_is_error(alcp_rsa_privatekey_decrypt(
+              handle, ALCP_RSA_PADDING_NONE, in, size, out))
+          && !alcp_is_error(alcp_rsa_publickey_encrypt(
+              handle, ALCP_RSA_PADDING_NONE, out, size, check))
+          && CRYPTO_memcmp(check, in, size) == 0;
+    if (!ret) {
+        OPENSSL_cleanse(out, size);
+    }
+    return ret;
+}
+
+static alc_rsa_key_size
+ALCP_prov_rsa_key_size(size_t bits)
+{
+    switch (bits) {
+        case KEY_SIZE_1024:
+            return KEY_SIZE_1024;
+        case KEY_SIZE_2048:
+            return KEY_SIZE_2048;
+        case KEY_SIZE_3072:
+            return KEY_SIZE_3072;
+        case KEY_SIZE_4096:
+            return KEY_SIZE_4096;
+        default:
+            break;
+    }
+    return KEY_SIZE_UNSUPPORTED;
+}
+
+/*
+ * ALCP gets the two prime keys of the sizes it implements whose primes are
+ * both half the size of the modulus, the others stay with the default
+ * provider alone.
+ */
+static void
+ALCP_prov_rsa_build_alcp(alc_prov_rsa_key_t* key)
+{
+    // the order of the components of alcp_rsa_key_create_private()
+    static const char* const names[] = {
+        OSSL_PKEY_PARAM_RSA_EXPONENT1, OSSL_PKEY_PARAM_RSA_EXPONENT2,
+        OSSL_PKEY_PARAM_RSA_FACTOR1,   OSSL_PKEY_PARAM_RSA_FACTOR2,
+        OSSL_PKEY_PARAM_RSA_COEFFICIENT1,
+    };
+    const size_t     count = sizeof(names) / sizeof(names[0]);
+    BIGNUM*          n     = NULL;
+    BIGNUM*          e     = NULL;
+    BIGNUM*          f3    = NULL;
+    BIGNUM*          bn[5] = { NULL };
+    Uint8            comp[5][ALCP_PROV_RSA_MAX_KEY_SIZE / 2];
+    Uint8            mod[ALCP_PROV_RSA_MAX_KEY_SIZE];
+    alc_rsa_key_size size;
+    size_t           half;
+    int              ok;
+
+    if (!EVP_PKEY_get_bn_param(key->rk_pkey, OSSL_PKEY_PARAM_RSA_N, &n)
+        || !EVP_PKEY_get_bn_param(key->rk_pkey, OSSL_PKEY_PARAM_RSA_E, &e)
+        || BN_num_bits(e) > 64) {
+        goto out;
+    }
+    size = ALCP_prov_rsa_key_size(BN_num_bits(n));
+    if (size == KEY_SIZE_UNSUPPORTED
+        || !BN_bn2binpad(n, mod, size / 8)) {
+        goto out;
+    }
+    half = size / 16;
+
+    if (!key->rk_has_priv) {
+        ok = !alcp_is_error(alcp_rsa_key_create_public(
+            size, BN_get_word(e), mod, size / 8, &key->rk_alcp));
+    } else {
+        ok = !EVP_PKEY_get_bn_param(
+            key->rk_pkey, OSSL_PKEY_PARAM_RSA_FACTOR3, &f3);
+        for (size_t i = 0; ok && i < count; i++) {
+            ok = EVP_PKEY_get_bn_param(key->rk_pkey, names[i], &bn[i])
+                 && BN_bn2binpad(bn[i], comp[i], half) > 0;
+        }
+        ok = ok && BN_num_bits(bn[2]) == (int)half * 8
+             && BN_num_bits(bn[3]) == (int)half * 8
+             && !alcp_is_error(alcp_rsa_key_create_private(size,
+                                                           BN_get_word(e),
+                                                           comp[0],
+                                                           comp[1],
+                                                           comp[2],
+                                                           comp[3],
+                                                           comp[4],
+                                                           mod,
+                                                           half,
+                                                           &key->rk_alcp));
+    }
+    if (ok) {
+        key->rk_key_size = size;
+    } else {
+        key->rk_alcp = NULL;
+    }
+
+out:
+    OPENSSL_cleanse(comp, sizeof(comp));
+    for (size_t i = 0; i < count; i++) {
+        BN_clear_free(bn[i]);
+    }
+    BN_free(f3);
+    BN_free(e);
+    BN_free(n);
+}
+
+/* Takes the key of the default provider, pkey is owned by key from now on */
+static int
+ALCP_prov_rsa_set_pkey(alc_prov_rsa_key_t* key, EVP_PKEY* pkey)
+{
+    BIGNUM* d = NULL;
+
+    if (pkey == NULL) {
+        return 0;
+    }
+    EVP_PKEY_free(key->rk_pkey);
+    key->rk_pkey     = pkey;
+    key->rk_has_priv = EVP_PKEY_get_bn_param(pkey, OSSL_PKEY_PARAM_RSA_D, &d);
+    BN_clear_free(d);
+
+    if (key->rk_alcp == NULL) {
+        ALCP_prov_rsa_build_alcp(key);
+    }
+    return 1;
+}
+
+static EVP_PKEY*
+ALCP_prov_rsa_fromdata(alc_prov_ctx_t* prov_ctx,
+                       int             selection,
+                       OSSL_PARAM      params[])
+{
+    EVP_PKEY_CTX* ctx;
+    EVP_PKEY*     pkey = NULL;
+
+    ctx = EVP_PKEY_CTX_new_from_name(
+        prov_ctx->ap_libctx, "RSA", ALCP_PROV_RSA_FALLBACK_PROP);
+    if (ctx == NULL || EVP_PKEY_fromdata_init(ctx) <= 0
+        || EVP_PKEY_fromdata(ctx, &pkey, selection, params) <= 0) {
+        pkey = NULL;
+    }
+    EVP_PKEY_CTX_free(ctx);
+    return pkey;
+}
+
+static OSSL_FUNC_keymgmt_new_fn ALCP_prov_rsa_new;
+static void*
+ALCP_prov_rsa_new(void* provctx)
+{
+    ENTER();
+    alc_prov_rsa_key_p key = OPENSSL_zalloc(sizeof(*key));
+    if (key != NULL) {
+        key->rk_prov_ctx = provctx;
+        key->rk_key_size = KEY_SIZE_UNSUPPORTED;
+    }
+    EXIT();
+    return key;
+}
+
+static OSSL_FUNC_keymgmt_free_fn ALCP_prov_rsa_free;
+static void
+ALCP_prov_rsa_free(void* keydata)
+{
+    ENTER();
+    alc_prov_rsa_key_p key = keydata;
+
+    if (key != NULL) {
+        EVP_PKEY_free(key->rk_pkey);
+        if (key->rk_alcp != NULL) {
+            alcp_rsa_key_free(key->rk_alcp);
+        }
+        OPENSSL_free(key);
+    }
+    EXIT();
+}
+
+static OSSL_FUNC_keymgmt_gen_set_params_fn ALCP_prov_rsa_gen_set_params;
+static int
+ALCP_prov_rsa_gen_set_params(void* genctx, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_rsa_gen_ctx_p gctx = genctx;
+    const OSSL_PARAM*      p;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_RSA_BITS);
+    if (p != NULL && !OSSL_PARAM_get_size_t(p, &gctx->rg_bits)) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_RSA_PRIMES);
+    if (p != NULL && !OSSL_PARAM_get_size_t(p, &gctx->rg_primes)) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_RSA_E);
+    if (p != NULL && !OSSL_PARAM_get_BN(p, &gctx->rg_e)) {
+        return 0;
+    }
+    EXIT();
+    return 1;
+}
+
+static OSSL_FUNC_keymgmt_gen_settable_params_fn
+    ALCP_prov_rsa_gen_settable_params;
+static const OSSL_PARAM*
+ALCP_prov_rsa_gen_settable_params(void* genctx, void* provctx)
+{
+    static const OSSL_PARAM settable[] = {
+        OSSL_PARAM_size_t(OSSL_PKEY_PARAM_RSA_BITS, NULL),
+        OSSL_PARAM_size_t(OSSL_PKEY_PARAM_RSA_PRIMES, NULL),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_E, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return settable;
+}
+
+static OSSL_FUNC_keymgmt_gen_cleanup_fn ALCP_prov_rsa_gen_cleanup;
+static void
+ALCP_prov_rsa_gen_cleanup(void* genctx)
+{
+    ENTER();
+    alc_prov_rsa_gen_ctx_p gctx = genctx;
+
+    if (gctx != NULL) {
+        BN_free(gctx->rg_e);
+        OPENSSL_free(gctx);
+    }
+    EXIT();
+}
+
+static OSSL_FUNC_keymgmt_gen_init_fn ALCP_prov_rsa_gen_init;
+static void*
+ALCP_prov_rsa_gen_init(void* provctx, int selection, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_rsa_gen_ctx_p gctx = OPENSSL_zalloc(sizeof(*gctx));
+    if (gctx != NULL) {
+        gctx->rg_prov_ctx  = provctx;
+        gctx->rg_selection = selection;
+        gctx->rg_bits      = 2048;
+        gctx->rg_primes    = 2;
+        if (!ALCP_prov_rsa_gen_set_params(gctx, params)) {
+            ALCP_prov_rsa_gen_cleanup(gctx);
+            gctx = NULL;
+        }
+    }
+    EXIT();
+    return gctx;
+}
+
+/*
+ * ALCP generates two prime keys, OpenSSL wants d as well. It is computed as
+ * OpenSSL does it, d = e^-1 mod lcm(p - 1, q - 1).
+ */
+static int
+ALCP_prov_rsa_generate(alc_prov_rsa_key_t* key,
+                       alc_rsa_key_size    size,
+                       Uint64              exponent)
+{
+    // the order of the components of alcp_rsa_key_get_privatekey()
+    static const char* const names[] = {
+        OSSL_PKEY_PARAM_RSA_EXPONENT1, OSSL_PKEY_PARAM_RSA_EXPONENT2,
+        OSSL_PKEY_PARAM_RSA_FACTOR1,   OSSL_PKEY_PARAM_RSA_FACTOR2,
+        OSSL_PKEY_PARAM_RSA_COEFFICIENT1,
+    };
+    const size_t    count  = sizeof(names) / sizeof(names[0]);
+    const size_t    half   = size / 16;
+    BIGNUM*         bn[5]  = { NULL };
+    BIGNUM*         n      = BN_new();
+    BIGNUM*         e      = BN_new();
+    BIGNUM*         d      = BN_secure_new();
+    BN_CTX*         bn_ctx = BN_CTX_secure_new();
+    OSSL_PARAM_BLD* bld    = OSSL_PARAM_BLD_new();
+    OSSL_PARAM*     params = NULL;
+    BIGNUM *        p1, *q1, *gcd, *lcm;
+    Uint8           comp[5][ALCP_PROV_RSA_MAX_KEY_SIZE / 2];
+    Uint8           mod[ALCP_PROV_RSA_MAX_KEY_SIZE];
+    int             ok;
+
+    ok = n != NULL && e != NULL && d != NULL && bn_ctx != NULL && bld != NULL
+         && !alcp_is_error(
+             alcp_rsa_key_generate(size, exponent, &key->rk_alcp))
+         && !alcp_is_error(alcp_rsa_key_get_privatekey(key->rk_alcp,
+                                                       &exponent,
+                                                       comp[0],
+                                                       comp[1],
+                                                       comp[2],
+                                                       comp[3],
+                                                       comp[4],
+                                                       mod,
+                                                       half));
+    for (size_t i = 0; ok && i < count; i++) {
+        ok = (bn[i] = BN_secure_new()) != NULL
+             && BN_bin2bn(comp[i], half, bn[i]) != NULL
+             && OSSL_PARAM_BLD_push_BN(bld, names[i], bn[i]);
+    }
+    if (ok) {
+        BN_CTX_start(bn_ctx);
+        p1  = BN_CTX_get(bn_ctx);
+        q1  = BN_CTX_get(bn_ctx);
+        gcd = BN_CTX_get(bn_ctx);
+        lcm = BN_CTX_get(bn_ctx);
+        ok  = lcm != NULL && BN_sub(p1, bn[2], BN_value_one())
+             && BN_sub(q1, bn[3], BN_value_one())
+             && BN_mul(lcm, p1, q1, bn_ctx) && BN_gcd(gcd, p1, q1, bn_ctx)
+             && BN_div(lcm, NULL, lcm, gcd, bn_ctx);
+        if (ok) {
+            BN_set_flags(lcm, BN_FLG_CONSTTIME);
+        }
+        ok = ok && BN_set_word(e, exponent)
+             && BN_mod_inverse(d, e, lcm, bn_ctx) != NULL;
+        BN_CTX_end(bn_ctx);
+    }
+    ok = ok && BN_bin2bn(mod, size / 8, n) != NULL
+         && OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_RSA_N, n)
+         && OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_RSA_E, e)
+         && OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_RSA_D, d)
+         && (params = OSSL_PARAM_BLD_to_param(bld)) != NULL
+         && ALCP_prov_rsa_set_pkey(
+             key,
+             ALCP_prov_rsa_fromdata(
+                 key->rk_prov_ctx, EVP_PKEY_KEYPAIR, params));
+    if (ok) {
+        key->rk_key_size = size;
+    }
+
+    OPENSSL_cleanse(comp, sizeof(comp));
+    for (size_t i = 0; i < count; i++) {
+        BN_clear_free(bn[i]);
+    }
+    OSSL_PARAM_free(params);
+    OSSL_PARAM_BLD_free(bld);
+    BN_CTX_free(bn_ctx);
+    BN_clear_free(d);
+    BN_free(e);
+    BN_free(n);
+    return ok;
+}
+
+/* Sizes, exponents and multi-prime keys ALCP does not generate */
+static int
+ALCP_prov_rsa_generate_default(alc_prov_rsa_key_t*     key,
+                               alc_prov_rsa_gen_ctx_t* gctx)
+{
+    EVP_PKEY_CTX* ctx;
+    EVP_PKEY*     pkey = NULL;
+    OSSL_PARAM    params[3];
+    int           ok;
+
+    params[0] =
+        OSSL_PARAM_construct_size_t(OSSL_PKEY_PARAM_RSA_BITS, &gctx->rg_bits);
+    params[1] = OSSL_PARAM_construct_size_t(OSSL_PKEY_PARAM_RSA_PRIMES,
+                                            &gctx->rg_primes);
+    params[2] = OSSL_PARAM_construct_end();
+
+    ctx = EVP_PKEY_CTX_new_from_name(
+        gctx->rg_prov_ctx->ap_libctx, "RSA", ALCP_PROV_RSA_FALLBACK_PROP);
+    ok = ctx != NULL && EVP_PKEY_keygen_init(ctx) > 0
+         && EVP_PKEY_CTX_set_params(ctx, params)
+         && (gctx->rg_e == NULL
+             || EVP_PKEY_CTX_set1_rsa_keygen_pubexp(ctx, gctx->rg_e))
+         && EVP_PKEY_generate(ctx, &pkey) > 0
+         && ALCP_prov_rsa_set_pkey(key, pkey);
+    EVP_PKEY_CTX_free(ctx);
+    return ok;
+}
+
+static OSSL_FUNC_keymgmt_gen_fn ALCP_prov_rsa_gen;
+static void*
+ALCP_prov_rsa_gen(void* genctx, OSSL_CALLBACK* cb, void* cbarg)
+{
+    ENTER();
+    alc_prov_rsa_gen_ctx_p gctx = genctx;
+    alc_prov_rsa_key_p     key;
+    alc_rsa_key_size       size;
+    Uint64                 exponent = RSA_F4;
+    int                    ok;
+
+    key = ALCP_prov_rsa_new(gctx->rg_prov_ctx);
+    if (key == NULL) {
+        return NULL;
+    }
+    if ((gctx->rg_selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0) {
+        return key;
+    }
+    if (gctx->rg_e != NULL) {
+        exponent = BN_num_bits(gctx->rg_e) <= 64 ? BN_get_word(gctx->rg_e)
+                                                 : 0;
+    }
+    size = ALCP_prov_rsa_key_size(gctx->rg_bits);
+    // ALCP does not generate 1024 bit keys
+    if (size != KEY_SIZE_UNSUPPORTED && size != KEY_SIZE_1024
+        && gctx->rg_primes == 2 && exponent >= 3 && exponent % 2 == 1) {
+        ok = ALCP_prov_rsa_generate(key, size, exponent);
+    } else {
+        ok = ALCP_prov_rsa_generate_default(key, gctx);
+    }
+    if (!ok) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GENERATE_KEY);
+        ALCP_prov_rsa_free(key);
+        return NULL;
+    }
+    EXIT();
+    return key;
+}
+
+static OSSL_FUNC_keymgmt_get_params_fn ALCP_prov_rsa_get_params;
+static int
+ALCP_prov_rsa_get_params(void* keydata, OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_rsa_key_p key = keydata;
+    EXIT();
+    return key->rk_pkey == NULL || EVP_PKEY_get_params(key->rk_pkey, params);
+}
+
+static OSSL_FUNC_keymgmt_gettable_params_fn ALCP_prov_rsa_gettable_params;
+static const OSSL_PARAM*
+ALCP_prov_rsa_gettable_params(void* provctx)
+{
+    static const OSSL_PARAM gettable[] = {
+        OSSL_PARAM_int(OSSL_PKEY_PARAM_BITS, NULL),
+        OSSL_PARAM_int(OSSL_PKEY_PARAM_SECURITY_BITS, NULL),
+        OSSL_PARAM_int(OSSL_PKEY_PARAM_MAX_SIZE, NULL),
+        OSSL_PARAM_utf8_string(OSSL_PKEY_PARAM_DEFAULT_DIGEST, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_N, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_E, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_D, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_FACTOR1, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_FACTOR2, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_EXPONENT1, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_EXPONENT2, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_COEFFICIENT1, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return gettable;
+}
+
+static OSSL_FUNC_keymgmt_has_fn ALCP_prov_rsa_has;
+static int
+ALCP_prov_rsa_has(const void* keydata, int selection)
+{
+    ENTER();
+    const alc_prov_rsa_key_t* key = keydata;
+    int                       ret = key != NULL;
+
+    // RSA keys have no domain parameters
+    if ((selection & OSSL_KEYMGMT_SELECT_PUBLIC_KEY) != 0) {
+        ret = ret && key->rk_pkey != NULL;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0) {
+        ret = ret && key->rk_has_priv;
+    }
+    EXIT();
+    return ret;
+}
+
+static OSSL_FUNC_keymgmt_match_fn ALCP_prov_rsa_match;
+static int
+ALCP_prov_rsa_match(const void* keydata1, const void* keydata2, int selection)
+{
+    ENTER();
+    const alc_prov_rsa_key_t* key1 = keydata1;
+    const alc_prov_rsa_key_t* key2 = keydata2;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0) {
+        return 1;
+    }
+    EXIT();
+    return key1->rk_pkey != NULL && key2->rk_pkey != NULL
+           && EVP_PKEY_eq(key1->rk_pkey, key2->rk_pkey) == 1;
+}
+
+static OSSL_FUNC_keymgmt_validate_fn ALCP_prov_rsa_validate;
+static int
+ALCP_prov_rsa_validate(const void* keydata, int selection, int checktype)
+{
+    ENTER();
+    const alc_prov_rsa_key_t* key = keydata;
+    EVP_PKEY_CTX*             ctx;
+    int                       ret;
+
+    if (!ALCP_prov_rsa_has(keydata, selection)) {
+        return 0;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0) {
+        return 1;
+    }
+    if ((ctx = ALCP_prov_rsa_fallback_ctx(key)) == NULL) {
+        return 0;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR)
+        == OSSL_KEYMGMT_SELECT_KEYPAIR) {
+        ret = EVP_PKEY_check(ctx);
+    } else if ((selection & OSSL_KEYMGMT_SELECT_PUBLIC_KEY) != 0) {
+        ret = EVP_PKEY_public_check(ctx);
+    } else {
+        ret = EVP_PKEY_private_check(ctx);
+    }
+    EVP_PKEY_CTX_free(ctx);
+    EXIT();
+    return ret > 0;
+}
+
+static OSSL_FUNC_keymgmt_import_fn ALCP_prov_rsa_import;
+static int
+ALCP_prov_rsa_import(void* keydata, int selection, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_rsa_key_p key = keydata;
+    int                keypair;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0) {
+        return 1;
+    }
+    keypair = (selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0
+                  ? EVP_PKEY_KEYPAIR
+                  : EVP_PKEY_PUBLIC_KEY;
+    if (key->rk_alcp != NULL) {
+        alcp_rsa_key_free(key->rk_alcp);
+        key->rk_alcp     = NULL;
+        key->rk_key_size = KEY_SIZE_UNSUPPORTED;
+    }
+    EXIT();
+    return ALCP_prov_rsa_set_pkey(
+        key,
+        ALCP_prov_rsa_fromdata(
+            key->rk_prov_ctx, keypair, (OSSL_PARAM*)params));
+}
+
+static OSSL_FUNC_keymgmt_export_fn ALCP_prov_rsa_export;
+static int
+ALCP_prov_rsa_export(void*          keydata,
+                     int            selection,
+                     OSSL_CALLBACK* param_cb,
+                     void*          cbarg)
+{
+    ENTER();
+    alc_prov_rsa_key_p key = keydata;
+    EXIT();
+    return key->rk_pkey != NULL
+           && EVP_PKEY_export(key->rk_pkey, selection, param_cb, cbarg);
+}
+
+static OSSL_FUNC_keymgmt_import_types_fn ALCP_prov_rsa_key_types;
+static const OSSL_PARAM*
+ALCP_prov_rsa_key_types(int selection)
+{
+    static const OSSL_PARAM types[] = {
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_N, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_E, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_D, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_FACTOR1, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_FACTOR2, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_EXPONENT1, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_EXPONENT2, NULL, 0),
+        OSSL_PARAM_BN(OSSL_PKEY_PARAM_RSA_COEFFICIENT1, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return types;
+}
+
+static OSSL_FUNC_keymgmt_dup_fn ALCP_prov_rsa_dup;
+static void*
+ALCP_prov_rsa_dup(const void* keydata_from, int selection)
+{
+    ENTER();
+    const alc_prov_rsa_key_t* from   = keydata_from;
+    OSSL_PARAM*               params = NULL;
+    alc_prov_rsa_key_p        key;
+    int                       ok = 1;
+
+    key = ALCP_prov_rsa_new(from->rk_prov_ctx);
+    if (key == NULL || from->rk_pkey == NULL) {
+        return key;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0
+        || !from->rk_has_priv) {
+        // keys are never modified, the copy shares them
+        if (from->rk_alcp != NULL
+            && !alcp_is_error(alcp_rsa_key_up_ref(from->rk_alcp))) {
+            key->rk_alcp     = from->rk_alcp;
+            key->rk_key_size = from->rk_key_size;
+        }
+        ok = EVP_PKEY_up_ref(from->rk_pkey)
+             && ALCP_prov_rsa_set_pkey(key, from->rk_pkey);
+    } else {
+        ok = EVP_PKEY_todata(from->rk_pkey, EVP_PKEY_PUBLIC_KEY, &params)
+             && ALCP_prov_rsa_set_pkey(
+                 key,
+                 ALCP_prov_rsa_fromdata(
+                     key->rk_prov_ctx, EVP_PKEY_PUBLIC_KEY, params));
+        OSSL_PARAM_free(params);
+    }
+    if (!ok) {
+        ALCP_prov_rsa_free(key);
+        key = NULL;
+    }
+    EXIT();
+    return key;
+}
+
+static OSSL_FUNC_keymgmt_query_operation_name_fn
+    ALCP_prov_rsa_query_operation_name;
+static const char*
+ALCP_prov_rsa_query_operation_name(int operation_id)
+{
+    return "RSA";
+}
+
+const OSSL_DISPATCH rsa_keymgmt_functions[] = {
+    { OSSL_FUNC_KEYMGMT_NEW, (fptr_t)ALCP_prov_rsa_new },
+    { OSSL_FUNC_KEYMGMT_FREE, (fptr_t)ALCP_prov_rsa_free },
+    { OSSL_FUNC_KEYMGMT_GEN_INIT, (fptr_t)ALCP_prov_rsa_gen_init },
+    { OSSL_FUNC_KEYMGMT_GEN_SET_PARAMS, (fptr_t)ALCP_prov_rsa_gen_set_params },
+    { OSSL_FUNC_KEYMGMT_GEN_SETTABLE_PARAMS,
+      (fptr_t)ALCP_prov_rsa_gen_settable_params },
+    { OSSL_FUNC_KEYMGMT_GEN, (fptr_t)ALCP_prov_rsa_gen },
+    { OSSL_FUNC_KEYMGMT_GEN_CLEANUP, (fptr_t)ALCP_prov_rsa_gen_cleanup },
+    { OSSL_FUNC_KEYMGMT_GET_PARAMS, (fptr_t)ALCP_prov_rsa_get_params },
+    { OSSL_FUNC_KEYMGMT_GETTABLE_PARAMS,
+      (fptr_t)ALCP_prov_rsa_gettable_params },
+    { OSSL_FUNC_KEYMGMT_HAS, (fptr_t)ALCP_prov_rsa_has },
+    { OSSL_FUNC_KEYMGMT_MATCH, (fptr_t)ALCP_prov_rsa_match },
+    { OSSL_FUNC_KEYMGMT_VALIDATE, (fptr_t)ALCP_prov_rsa_validate },
+    { OSSL_FUNC_KEYMGMT_IMPORT, (fptr_t)ALCP_prov_rsa_import },
+    { OSSL_FUNC_KEYMGMT_IMPORT_TYPES, (fptr_t)ALCP_prov_rsa_key_types },
+    { OSSL_FUNC_KEYMGMT_EXPORT, (fptr_t)ALCP_prov_rsa_export },
+    { OSSL_FUNC_KEYMGMT_EXPORT_TYPES, (fptr_t)ALCP_prov_rsa_key_types },
+    { OSSL_FUNC_KEYMGMT_DUP, (fptr_t)ALCP_prov_rsa_dup },
+    { OSSL_FUNC_KEYMGMT_QUERY_OPERATION_NAME,
+      (fptr_t)ALCP_prov_rsa_query_operation_name },
+    { 0, NULL }
+};
@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <openssl/err.h>
+#include <openssl/params.h>
+#include <openssl/proverr.h>
+
+#include "alcp_mac_poly1305.h"
+
+static alc_mac_info_t s_mac_POLY1305_info = { .mi_type = ALC_MAC_POLY1305 };
+
+static OSSL_FUNC_mac_newctx_fn ALCP_prov_poly1305_newctx;
+static void*
+ALCP_prov_poly1305_newctx(void* provctx)
+{
+    ENTER();
+    alc_prov_poly1305_ctx_p ctx = OPENSSL_zalloc(sizeof(*ctx));
+
+    if (ctx != NULL) {
+        ctx->pm_context =
+            OPENSSL_zalloc(alcp_mac_context_size(&s_mac_POLY1305_info));
+        if (ctx->pm_context == NULL) {
+            OPENSSL_free(ctx);
+            ctx = NULL;
+        } else {
+            ctx->pm_prov_ctx          = provctx;
+            ctx->pm_handle.ch_context = ctx->pm_context;
+        }
+    }
+    EXIT();
+    return ctx;
+}
+
+static OSSL_FUNC_mac_freectx_fn ALCP_prov_poly1305_freectx;
+static void
+ALCP_prov_poly1305_freectx(void* vctx)
+{
+    ENTER();
+    alc_prov_poly1305_ctx_p ctx = vctx;
+
+    if (ctx != NULL) {
+        if (ctx->pm_keyed) {
+            alcp_mac_finish(&ctx->pm_handle);
+        }
+        OPENSSL_clear_free(ctx->pm_context,
+                           alcp_mac_context_size(&s_mac_POLY1305_info));
+        OPENSSL_free(ctx);
+    }
+    EXIT();
+}
+
+static OSSL_FUNC_mac_dupctx_fn ALCP_prov_poly1305_dupctx;
+static void*
+ALCP_prov_poly1305_dupctx(void* vctx)
+{
+    ENTER();
+    alc_prov_poly1305_ctx_p src = vctx;
+    alc_prov_poly1305_ctx_p dst = ALCP_prov_poly1305_newctx(src->pm_prov_ctx);
+
+    if (dst == NULL || !src->pm_keyed) {
+        EXIT();
+        return dst;
+    }
+    if (alcp_is_error(
+            alcp_mac_context_copy(&src->pm_handle, &dst->pm_handle))) {
+        ALCP_prov_poly1305_freectx(dst);
+        EXIT();
+        return NULL;
+    }
+    dst->pm_keyed   = 1;
+    dst->pm_updated = src->pm_updated;
+    EXIT();
+    return dst;
+}
+
+static int
+ALCP_prov_poly1305_setkey(alc_prov_poly1305_ctx_p ctx,
+                          const unsigned char*    key,
+                          size_t                  keylen)
+{
+    alc_mac_info_t info = s_mac_POLY1305_info;
+
+    if (keylen != ALCP_PROV_POLY1305_KEY_LEN) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY_LENGTH);
+        return 0;
+    }
+    if (ctx->pm_keyed) {
+        alcp_mac_finish(&ctx->pm_handle);
+        ctx->pm_keyed = 0;
+    }
+    info.mi_keyinfo =
+        (alc_key_info_t){ .type     = ALC_KEY_TYPE_SYMMETRIC,
+                          .fmt      = ALC_KEY_FMT_RAW,
+                          .algo     = ALC_KEY_ALG_MAC,
+                          .len_type = ALC_KEY_LEN_256,
+                          .len      = ALCP_PROV_POLY1305_KEY_LEN * 8,
+                          .key      = key };
+    if (alcp_is_error(alcp_mac_request(&ctx->pm_handle, &info))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY);
+        return 0;
+    }
+    ctx->pm_keyed   = 1;
+    ctx->pm_updated = 0;
+    return 1;
+}
+
+static OSSL_FUNC_mac_set_ctx_params_fn ALCP_prov_poly1305_set_ctx_params;
+static int
+ALCP_prov_poly1305_set_ctx_params(void* vctx, const OSSL_PARAM params[])
+{
+    ENTER();
+    const OSSL_PARAM* p;
+    int               ret = 1;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_MAC_PARAM_KEY);
+    if (p != NULL) {
+        ret = p->data_type == OSSL_PARAM_OCTET_STRING
+              && ALCP_prov_poly1305_setkey(vctx, p->data, p->data_size);
+    }
+    EXIT();
+    return ret;
+}
+
+static OSSL_FUNC_mac_init_fn ALCP_prov_poly1305_init;
+static int
+ALCP_prov_poly1305_init(void*                vctx,
+                        const unsigned char* key,
+                        size_t               keylen,
+                        const OSSL_PARAM     params[])
+{
+    ENTER();
+    alc_prov_poly1305_ctx_p ctx = vctx;
+    int                     ret;
+
+    if (!ALCP_prov_poly1305_set_ctx_params(ctx, params)) {
+        EXIT();
+        return 0;
+    }
+    if (key != NULL) {
+        ret = ALCP_prov_poly1305_setkey(ctx, key, keylen);
+    } else {
+        // no second message under the same one-time key
+        ret = ctx->pm_keyed && !ctx->pm_updated;
+    }
+    EXIT();
+    return ret;
+}
+
+static OSSL_FUNC_mac_update_fn ALCP_prov_poly1305_update;
+static int
+ALCP_prov_poly1305_update(void* vctx, const unsigned char* in, size_t inl)
+{
+    ENTER();
+    alc_prov_poly1305_ctx_p ctx = vctx;
+
+    ctx->pm_updated = 1;
+    if (inl == 0) {
+        EXIT();
+        return 1;
+    }
+    if (!ctx->pm_keyed
+        || alcp_is_error(alcp_mac_update(&ctx->pm_handle, in, inl))) {
+        EXIT();
+        return 0;
+    }
+    EXIT();
+    return 1;
+}
+
+static OSSL_FUNC_mac_final_fn ALCP_prov_poly1305_final;
+static int
+ALCP_prov_poly1305_final(void*          vctx,
+                         unsigned char* out,
+                         size_t*        outl,
+                         size_t         outsize)
+{
+    ENTER();
+    alc_prov_poly1305_ctx_p ctx = vctx;
+
+    ctx->pm_updated = 1;
+    if (!ctx->pm_keyed || outsize < ALCP_PROV_POLY1305_TAG_LEN) {
+        EXIT();
+        return 0;
+    }
+    if (alcp_is_error(alcp_mac_finalize(&ctx->pm_handle, NULL, 0))
+        || alcp_is_error(alcp_mac_copy(
+            &ctx->pm_handle, out, ALCP_PROV_POLY1305_TAG_LEN))) {
+        EXIT();
+        return 0;
+    }
+    *outl = ALCP_PROV_POLY1305_TAG_LEN;
+    EXIT();
+    return 1;
+}
+
+static OSSL_FUNC_mac_get_params_fn ALCP_prov_poly1305_get_params;
+static int
+ALCP_prov_poly1305_get_params(OSSL_PARAM params[])
+{
+    ENTER();
+    OSSL_PARAM* p = OSSL_PARAM_locate(params, OSSL_MAC_PARAM_SIZE);
+    int         ret =
+        p == NULL || OSSL_PARAM_set_size_t(p, ALCP_PROV_POLY1305_TAG_LEN);
+    EXIT();
+    return ret;
+}
+
+static OSSL_FUNC_mac_get_ctx_params_fn ALCP_prov_poly1305_get_ctx_params;
+static int
+ALCP_prov_poly1305_get_ctx_params(void* vctx, OSSL_PARAM params[])
+{
+    return ALCP_prov_poly1305_get_params(params);
+}
+
+static const OSSL_PARAM poly1305_known_gettable_params[] = {
+    OSSL_PARAM_size_t(OSSL_MAC_PARAM_SIZE, NULL),
+    OSSL_PARAM_END
+};
+
+static OSSL_FUNC_mac_gettable_params_fn ALCP_prov_poly1305_gettable_params;
+static const OSSL_PARAM*
+ALCP_prov_poly1305_gettable_params(void* provctx)
+{
+    return poly1305_known_gettable_params;
+}
+
+static OSSL_FUNC_mac_gettable_ctx_params_fn
+    ALCP_prov_poly1305_gettable_ctx_params;
+static const OSSL_PARAM*
+ALCP_prov_poly1305_gettable_ctx_params(void* vctx, void* provctx)
+{
+    return poly1305_known_gettable_params;
+}
+
+static const OSSL_PARAM poly1305_known_settable_ctx_params[] = {
+    OSSL_PARAM_octet_string(OSSL_MAC_PARAM_KEY, NULL, 0),
+    OSSL_PARAM_END
+};
+
+static OSSL_FUNC_mac_settable_ctx_params_fn
+    ALCP_prov_poly1305_settable_ctx_params;
+static const OSSL_PARAM*
+ALCP_prov_poly1305_settable_ctx_params(void* vctx, void* provctx)
+{
+    return poly1305_known_settable_ctx_params;
+}
+
+const OSSL_DISPATCH mac_POLY1305_functions[] = {
+    { OSSL_FUNC_MAC_NEWCTX, (fptr_t)ALCP_prov_poly1305_newctx },
+    { OSSL_FUNC_MAC_DUPCTX, (fptr_t)ALCP_prov_poly1305_dupctx },
+    { OSSL_FUNC_MAC_FREECTX, (fptr_t)ALCP_prov_poly1305_freectx },
+    { OSSL_FUNC_MAC_INIT, (fptr_t)ALCP_prov_poly1305_init },
+    { OSSL_FUNC_MAC_UPDATE, (fptr_t)ALCP_prov_poly1305_update },
+    { OSSL_FUNC_MAC_FINAL, (fptr_t)ALCP_prov_poly1305_final },
+    { OSSL_FUNC_MAC_GET_PARAMS, (fptr_t)ALCP_prov_poly1305_get_params },
+    { OSSL_FUNC_MAC_GETTABLE_PARAMS,
+      (fptr_t)ALCP_prov_poly1305_gettable_params },
+    { OSSL_FUNC_MAC_GET_CTX_PARAMS, (fptr_t)ALCP_prov_poly1305_get_ctx_params },
+    { OSSL_FUNC_MAC_GETTABLE_CTX_PARAMS,
+      (fptr_t)ALCP_prov_poly1305_gettable_ctx_params },
+    { OSSL_FUNC_MAC_SET_CTX_PARAMS, (fptr_t)ALCP_prov_poly1305_set_ctx_params },
+    { OSSL_FUNC_MAC_SETTABLE_CTX_PARAMS,
+      (fptr_t)ALCP_prov_poly1305_settable_ctx_params },
+    { 0, NULL }
+};
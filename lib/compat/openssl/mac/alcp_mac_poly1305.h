@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _OPENSSL_ALCP_MAC_POLY1305
+#define _OPENSSL_ALCP_MAC_POLY1305 2
+
+#include "alcp/alcp.h"
+#include "alcp_mac_prov.h"
+#include "debug.h"
+
+#define ALCP_PROV_POLY1305_KEY_LEN 32
+#define ALCP_PROV_POLY1305_TAG_LEN 16
+
+/*
+ * Poly1305 keys are one-time keys, so unlike HMAC and CMAC a context is never
+ * restarted with the key it already holds. The library context is allocated
+ * with the provider context and reused for every key.
+ */
+struct _alc_prov_poly1305_ctx
+{
+    alc_prov_ctx_t*  pm_prov_ctx;
+    alc_mac_handle_t pm_handle;
+    void*            pm_context;
+    int              pm_keyed;
+    int              pm_updated;
+};
+typedef struct _alc_prov_poly1305_ctx alc_prov_poly1305_ctx_t,
+    *alc_prov_poly1305_ctx_p;
+
+extern const OSSL_DISPATCH mac_POLY1305_functions[];
+
+#endif /* _OPENSSL_ALCP_MAC_POLY1305 */
@@ -31,20 +31,57 @@
  *
  */
 
+#include <openssl/err.h>
+#include <openssl/proverr.h>
+
 #include "alcp_mac_prov.h"
 #include "provider/alcp_names.h"
 
+/* Ends the library session, if any, and frees its context memory */
+static void
+ALCP_prov_mac_release(alc_prov_mac_ctx_p mctx)
+{
+    if (mctx->handle.ch_context != NULL) {
+        alc_error_t err = alcp_mac_finish(&(mctx->handle));
+        if (alcp_is_error(err)) {
+            printf("MAC Provider: Error in MAC Finish\n");
+        }
+        OPENSSL_free(mctx->handle.ch_context);
+        mctx->handle.ch_context = NULL;
+    }
+}
+
+/* Tag size in bytes, 0 for HMAC before its digest is set */
+static size_t
+ALCP_prov_mac_size(alc_prov_mac_ctx_p mctx)
+{
+    if (mctx->pc_mac_info.mi_type == ALC_MAC_HMAC) {
+        return mctx->pc_mac_info.mi_algoinfo.hmac.hmac_digest.dt_len / 8;
+    }
+    return 16;
+}
+
+static size_t
+ALCP_prov_mac_block_size(alc_prov_mac_ctx_p mctx)
+{
+    alc_digest_info_p dinfo = &mctx->pc_mac_info.mi_algoinfo.hmac.hmac_digest;
+
+    if (mctx->pc_mac_info.mi_type != ALC_MAC_HMAC) {
+        return 16;
+    }
+    if (dinfo->dt_type == ALC_DIGEST_TYPE_SHA3) {
+        // Keccak rate
+        return 200 - 2 * (dinfo->dt_len / 8);
+    }
+    return dinfo->dt_len > ALC_DIGEST_LEN_256 ? 128 : 64;
+}
+
 void
 ALCP_prov_mac_freectx(void* vctx)
 {
     ENTER();
     alc_prov_mac_ctx_p mctx = vctx;
-    alc_error_t        err  = alcp_mac_finish(&(mctx->handle));
-    if (alcp_is_error(err)) {
-        printf("MAC Provider: Error in MAC Finish\n");
-    }
-    OPENSSL_free(mctx->handle.ch_context);
-    mctx->handle.ch_context = NULL;
+    ALCP_prov_mac_release(mctx);
     EVP_MAC_CTX_free(mctx->pc_evp_mac_ctx);
     OPENSSL_free(vctx);
     vctx = NULL;
@@ -74,11 +111,29 @@ void*
 ALCP_prov_mac_dupctx(void* vctx)
 {
     ENTER();
-    // FIXME: Implementation pending for context copy
     alc_prov_mac_ctx_p csrc = vctx;
+    alc_prov_mac_ctx_p cdst = OPENSSL_memdup(csrc, sizeof(*csrc));
 
+    if (cdst == NULL) {
+        return NULL;
+    }
+    cdst->pc_evp_mac_ctx    = NULL;
+    cdst->handle.ch_context = NULL;
+
+    // Keyed sessions are forked, CMAC cannot be and fails the copy
+    if (csrc->handle.ch_context != NULL) {
+        cdst->handle.ch_context =
+            OPENSSL_malloc(alcp_mac_context_size(&csrc->pc_mac_info));
+        if (cdst->handle.ch_context == NULL
+            || alcp_is_error(alcp_mac_context_copy(&(csrc->handle),
+                                                   &(cdst->handle)))) {
+            OPENSSL_free(cdst->handle.ch_context);
+            OPENSSL_free(cdst);
+            return NULL;
+        }
+    }
     EXIT();
-    return csrc;
+    return cdst;
 }
 
 /*-
@@ -90,6 +145,12 @@ static const OSSL_PARAM mac_known_gettable_params[] = {
     OSSL_PARAM_END
 };
 
+static const OSSL_PARAM mac_known_gettable_ctx_params[] = {
+    OSSL_PARAM_size_t(OSSL_MAC_PARAM_SIZE, NULL),
+    OSSL_PARAM_size_t(OSSL_MAC_PARAM_BLOCK_SIZE, NULL),
+    OSSL_PARAM_END
+};
+
 const OSSL_PARAM*
 ALCP_prov_mac_gettable_params(void* provctx)
 {
@@ -112,16 +173,21 @@ ALCP_prov_mac_gettable_ctx_params(void* cctx, void* provctx)
 {
     ENTER();
     EXIT();
-    return 0;
+    return mac_known_gettable_ctx_params;
 }
 
 /* Parameters that libcrypto can send to this implementation */
 const OSSL_PARAM*
 ALCP_prov_mac_settable_ctx_params(void* cctx, void* provctx)
 {
+    static const OSSL_PARAM table[] = {
+        OSSL_PARAM_utf8_string(OSSL_MAC_PARAM_DIGEST, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_MAC_PARAM_CIPHER, NULL, 0),
+        OSSL_PARAM_END,
+    };
     ENTER();
     EXIT();
-    return 0;
+    return table;
 }
 
 int
@@ -135,9 +201,20 @@ ALCP_prov_mac_set_params(const OSSL_PARAM params[])
 int
 ALCP_prov_mac_get_ctx_params(void* vctx, OSSL_PARAM params[])
 {
+    OSSL_PARAM* p;
+
     ENTER();
+    p = OSSL_PARAM_locate(params, OSSL_MAC_PARAM_SIZE);
+    if (p != NULL && !OSSL_PARAM_set_size_t(p, ALCP_prov_mac_size(vctx))) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_MAC_PARAM_BLOCK_SIZE);
+    if (p != NULL
+        && !OSSL_PARAM_set_size_t(p, ALCP_prov_mac_block_size(vctx))) {
+        return 0;
+    }
     EXIT();
-    return 0;
+    return 1;
 }
 
 int
@@ -202,7 +279,8 @@ int
 ALCP_prov_mac_set_ctx_params(void* vctx, const OSSL_PARAM params[])
 {
     ENTER();
-    int               ret = 0;
+    // Nothing to set, e.g. an empty or NULL list, is a success
+    int               ret = 1;
     const OSSL_PARAM* p_digest =
         OSSL_PARAM_locate_const(params, OSSL_ALG_PARAM_DIGEST);
     if (p_digest != NULL) {
@@ -222,6 +300,7 @@ ALCP_prov_mac_set_ctx_params(void* vctx, const OSSL_PARAM params[])
             return 1;
         } else {
             printf("CMAC Provider: Cipher '%s' not supported\n", cipher);
+            ret = 0;
         }
     }
 
@@ -264,11 +343,17 @@ ALCP_prov_mac_init(void*                vctx,
             }
         }
     }
+    // A reused context starts over with a fresh session
+    ALCP_prov_mac_release(cctx);
+
     Uint64 size             = alcp_mac_context_size(macinfo);
     cctx->handle.ch_context = OPENSSL_malloc(size);
     err                     = alcp_mac_request(&(cctx->handle), macinfo);
     if (alcp_is_error(err)) {
         printf("MAC Provider: Request Failed\n");
+        // Nothing to finish, keep freectx away from the dead context
+        OPENSSL_free(cctx->handle.ch_context);
+        cctx->handle.ch_context = NULL;
         return 0;
     }
     EXIT();
@@ -301,12 +386,18 @@ ALCP_prov_mac_final(void*          vctx,
     ENTER();
     alc_error_t        err  = ALC_ERROR_NONE;
     alc_prov_mac_ctx_p mctx = vctx;
-    err                     = alcp_mac_finalize(&(mctx->handle), NULL, 0);
+    size_t             size = ALCP_prov_mac_size(mctx);
+
+    if (outsize < size) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_OUTPUT_BUFFER_TOO_SMALL);
+        return 0;
+    }
+    err = alcp_mac_finalize(&(mctx->handle), NULL, 0);
     if (alcp_is_error(err)) {
         printf("MAC Provider: Failed to Finalize\n");
         return 0;
     }
-    err = alcp_mac_copy(&(mctx->handle), out, (Uint64)outsize);
+    err = alcp_mac_copy(&(mctx->handle), out, (Uint64)size);
     if (alcp_is_error(err)) {
         printf("MAC Provider: Failed to copy Hash\n");
         return 0;
@@ -314,7 +405,7 @@ ALCP_prov_mac_final(void*          vctx,
 
     alcp_mac_reset(&(mctx->handle));
 
-    *outl = outsize;
+    *outl = size;
     EXIT();
     return 1;
 }
@@ -323,9 +414,11 @@ static const char MAC_DEF_PROP[] = "provider=alcp,fips=no";
 
 extern const OSSL_DISPATCH mac_CMAC_functions[];
 extern const OSSL_DISPATCH mac_HMAC_functions[];
+extern const OSSL_DISPATCH mac_POLY1305_functions[];
 
 const OSSL_ALGORITHM ALC_prov_macs[] = {
     { ALCP_PROV_NAMES_CMAC, MAC_DEF_PROP, mac_CMAC_functions },
     { ALCP_PROV_NAMES_HMAC, MAC_DEF_PROP, mac_HMAC_functions },
+    { ALCP_PROV_NAMES_POLY1305, MAC_DEF_PROP, mac_POLY1305_functions },
     { NULL, NULL, NULL },
 };
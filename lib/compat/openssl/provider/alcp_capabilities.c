@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <openssl/core_names.h>
+#include <openssl/crypto.h>
+#include <openssl/params.h>
+#include <openssl/prov_ssl.h>
+
+#include "provider/alcp_provider.h"
+
+/*
+ * libssl only negotiates a group whose key manager comes from the provider
+ * that announced it, so the groups ALCP has key managers for are announced
+ * here as well as by the default provider.
+ */
+struct _alc_prov_tls_group
+{
+    unsigned int tg_group_id;
+    unsigned int tg_security_bits;
+    int          tg_min_tls;
+    int          tg_max_tls;
+    int          tg_min_dtls;
+    int          tg_max_dtls;
+    unsigned int tg_is_kem;
+};
+typedef struct _alc_prov_tls_group alc_prov_tls_group_t;
+
+/* Group ids are the TLS NamedGroup values of RFC 8446 */
+static const alc_prov_tls_group_t s_tls_groups[] = {
+    { 0x0017, 128, TLS1_VERSION, 0, DTLS1_VERSION, 0, 0 },
+    { 0x0018, 192, TLS1_VERSION, 0, DTLS1_VERSION, 0, 0 },
+    { 0x0019, 256, TLS1_VERSION, 0, DTLS1_VERSION, 0, 0 },
+    { 0x001d, 128, TLS1_VERSION, 0, DTLS1_VERSION, 0, 0 },
+};
+
+#define ALCP_TLS_GROUP_ENTRY(tlsname, realname, algorithm, idx)                \
+    {                                                                          \
+        OSSL_PARAM_utf8_string(                                                \
+            OSSL_CAPABILITY_TLS_GROUP_NAME, tlsname, sizeof(tlsname)),         \
+            OSSL_PARAM_utf8_string(OSSL_CAPABILITY_TLS_GROUP_NAME_INTERNAL,    \
+                                   realname,                                   \
+                                   sizeof(realname)),                          \
+            OSSL_PARAM_utf8_string(                                            \
+                OSSL_CAPABILITY_TLS_GROUP_ALG, algorithm, sizeof(algorithm)),  \
+            OSSL_PARAM_uint(OSSL_CAPABILITY_TLS_GROUP_ID,                      \
+                            (unsigned int*)&s_tls_groups[idx].tg_group_id),    \
+            OSSL_PARAM_uint(                                                   \
+                OSSL_CAPABILITY_TLS_GROUP_SECURITY_BITS,                       \
+                (unsigned int*)&s_tls_groups[idx].tg_security_bits),           \
+            OSSL_PARAM_int(OSSL_CAPABILITY_TLS_GROUP_MIN_TLS,                  \
+                           (int*)&s_tls_groups[idx].tg_min_tls),               \
+            OSSL_PARAM_int(OSSL_CAPABILITY_TLS_GROUP_MAX_TLS,                  \
+                           (int*)&s_tls_groups[idx].tg_max_tls),               \
+            OSSL_PARAM_int(OSSL_CAPABILITY_TLS_GROUP_MIN_DTLS,                 \
+                           (int*)&s_tls_groups[idx].tg_min_dtls),              \
+            OSSL_PARAM_int(OSSL_CAPABILITY_TLS_GROUP_MAX_DTLS,                 \
+                           (int*)&s_tls_groups[idx].tg_max_dtls),              \
+            OSSL_PARAM_uint(OSSL_CAPABILITY_TLS_GROUP_IS_KEM,                  \
+                            (unsigned int*)&s_tls_groups[idx].tg_is_kem),      \
+            OSSL_PARAM_END                                                     \
+    }
+
+static const OSSL_PARAM s_tls_group_params[][11] = {
+    ALCP_TLS_GROUP_ENTRY("secp256r1", "prime256v1", "EC", 0),
+    ALCP_TLS_GROUP_ENTRY("P-256", "prime256v1", "EC", 0),
+    ALCP_TLS_GROUP_ENTRY("secp384r1", "secp384r1", "EC", 1),
+    ALCP_TLS_GROUP_ENTRY("P-384", "secp384r1", "EC", 1),
+    ALCP_TLS_GROUP_ENTRY("secp521r1", "secp521r1", "EC", 2),
+    ALCP_TLS_GROUP_ENTRY("P-521", "secp521r1", "EC", 2),
+    ALCP_TLS_GROUP_ENTRY("x25519", "X25519", "X25519", 3),
+};
+
+int
+ALCP_get_capabilities(void*          provctx,
+                      const char*    capability,
+                      OSSL_CALLBACK* cb,
+                      void*          arg)
+{
+    ENTER();
+    size_t count = sizeof(s_tls_group_params) / sizeof(s_tls_group_params[0]);
+
+    if (OPENSSL_strcasecmp(capability, "TLS-GROUP") != 0) {
+        return 0;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!cb(s_tls_group_params[i], arg)) {
+            return 0;
+        }
+    }
+    EXIT();
+    return 1;
+}
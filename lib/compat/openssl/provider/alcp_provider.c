@@ -88,6 +88,22 @@ ALCP_query_operation(void* vctx, int operation_id, const int* no_cache)
             EXIT();
             return ALC_prov_rng;
             break;
+        case OSSL_OP_KEYMGMT:
+            EXIT();
+            return ALC_prov_keymgmt;
+            break;
+        case OSSL_OP_KEYEXCH:
+            EXIT();
+            return ALC_prov_keyexch;
+            break;
+        case OSSL_OP_SIGNATURE:
+            EXIT();
+            return ALC_prov_signature;
+            break;
+        case OSSL_OP_ASYM_CIPHER:
+            EXIT();
+            return ALC_prov_asym_cipher;
+            break;
         default:
             break;
     }
@@ -147,6 +163,7 @@ static const OSSL_DISPATCH ALC_dispatch_table[] = {
     { OSSL_FUNC_PROVIDER_QUERY_OPERATION, (fptr_t)ALCP_query_operation },
     { OSSL_FUNC_PROVIDER_GET_REASON_STRINGS, (fptr_t)ALCP_get_reason_strings },
     { OSSL_FUNC_PROVIDER_GET_PARAMS, (fptr_t)ALCP_get_params },
+    { OSSL_FUNC_PROVIDER_GET_CAPABILITIES, (fptr_t)ALCP_get_capabilities },
     { OSSL_FUNC_PROVIDER_TEARDOWN, (fptr_t)ALCP_teardown },
     { 0, NULL }
 };
@@ -0,0 +1,685 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/params.h>
+#include <openssl/rsa.h>
+
+#include "provider/alcp_names.h"
+#include "signature/alcp_signature_prov.h"
+
+static const char SIGNATURE_DEF_PROP[] = "provider=alcp,fips=no";
+
+void*
+ALCP_prov_signature_newctx(void* provctx, const char* propq)
+{
+    ENTER();
+    alc_prov_signature_ctx_p ctx = OPENSSL_zalloc(sizeof(*ctx));
+    if (ctx != NULL) {
+        ctx->sc_prov_ctx = provctx;
+    }
+    EXIT();
+    return ctx;
+}
+
+static void
+ALCP_prov_signature_digest_free(alc_prov_signature_ctx_p ctx)
+{
+    if (ctx->sc_digest.context != NULL) {
+        alcp_digest_finish(&ctx->sc_digest);
+        OPENSSL_clear_free(
+            ctx->sc_digest.context,
+            alcp_digest_context_size((alc_digest_info_p)&ctx->sc_md->rd_info));
+        ctx->sc_digest.context = NULL;
+    }
+}
+
+static void
+ALCP_prov_signature_reset(alc_prov_signature_ctx_p ctx)
+{
+    if (ctx->sc_key != NULL) {
+        ALCP_prov_rsa_handle_free(&ctx->sc_handle, ctx->sc_key->rk_key_size);
+    }
+    ALCP_prov_signature_digest_free(ctx);
+    EVP_MD_CTX_free(ctx->sc_fallback_md);
+    EVP_PKEY_CTX_free(ctx->sc_fallback);
+    OSSL_PARAM_free(ctx->sc_params);
+    ctx->sc_fallback_md = NULL;
+    ctx->sc_fallback    = NULL;
+    ctx->sc_params      = NULL;
+    ctx->sc_md          = NULL;
+    ctx->sc_mdname[0]   = '\0';
+    ctx->sc_flag_digest = 0;
+}
+
+/* ALCP signs PKCS#1 v1.5 with the SHA2 digests, the session is its key */
+static int
+ALCP_prov_signature_uses_alcp(const alc_prov_signature_ctx_t* ctx)
+{
+    return ctx->sc_handle.context != NULL
+           && ctx->sc_pad_mode == RSA_PKCS1_PADDING && ctx->sc_md != NULL;
+}
+
+/* The context of the default provider the operation has fallen back to */
+static EVP_PKEY_CTX*
+ALCP_prov_signature_fallback(const alc_prov_signature_ctx_t* ctx)
+{
+    if (ctx->sc_fallback_md != NULL) {
+        return EVP_MD_CTX_get_pkey_ctx(ctx->sc_fallback_md);
+    }
+    return ctx->sc_fallback;
+}
+
+static int
+ALCP_prov_signature_new_fallback(alc_prov_signature_ctx_p ctx)
+{
+    int ret;
+
+    if (ctx->sc_fallback != NULL) {
+        return 1;
+    }
+    ctx->sc_fallback = ALCP_prov_rsa_fallback_ctx(ctx->sc_key);
+    if (ctx->sc_fallback == NULL) {
+        return 0;
+    }
+    ret = ctx->sc_operation == EVP_PKEY_OP_SIGN
+              ? EVP_PKEY_sign_init(ctx->sc_fallback)
+              : EVP_PKEY_verify_init(ctx->sc_fallback);
+    return ret > 0
+           && (ctx->sc_params == NULL
+               || EVP_PKEY_CTX_set_params(ctx->sc_fallback, ctx->sc_params)
+                      > 0);
+}
+
+/*
+ * The padding may change between the initialisation of a digest operation
+ * and its message, TLS 1.3 asks for PSS there. Where the message goes is
+ * decided when it starts.
+ */
+static int
+ALCP_prov_signature_digest_start(alc_prov_signature_ctx_p ctx)
+{
+    alc_digest_info_p info;
+    const char*       mdname;
+
+    if (ctx->sc_digest.context != NULL || ctx->sc_fallback_md != NULL) {
+        return 1;
+    }
+    if (ALCP_prov_signature_uses_alcp(ctx)) {
+        info                   = (alc_digest_info_p)&ctx->sc_md->rd_info;
+        ctx->sc_digest.context = OPENSSL_malloc(alcp_digest_context_size(info));
+        if (ctx->sc_digest.context == NULL) {
+            return 0;
+        }
+        if (alcp_is_error(alcp_digest_request(info, &ctx->sc_digest))) {
+            OPENSSL_free(ctx->sc_digest.context);
+            ctx->sc_digest.context = NULL;
+            return 0;
+        }
+        return 1;
+    }
+
+    ctx->sc_fallback_md = EVP_MD_CTX_new();
+    if (ctx->sc_fallback_md == NULL) {
+        return 0;
+    }
+    mdname = ctx->sc_mdname[0] != '\0' ? ctx->sc_mdname : NULL;
+    if ((ctx->sc_operation == EVP_PKEY_OP_SIGN
+             ? EVP_DigestSignInit_ex(ctx->sc_fallback_md,
+                                     NULL,
+                                     mdname,
+                                     ctx->sc_prov_ctx->ap_libctx,
+                                     ALCP_PROV_RSA_FALLBACK_PROP,
+                                     ctx->sc_key->rk_pkey,
+                                     ctx->sc_params)
+             : EVP_DigestVerifyInit_ex(ctx->sc_fallback_md,
+                                       NULL,
+                                       mdname,
+                                       ctx->sc_prov_ctx->ap_libctx,
+                                       ALCP_PROV_RSA_FALLBACK_PROP,
+                                       ctx->sc_key->rk_pkey,
+                                       ctx->sc_params))
+        <= 0) {
+        EVP_MD_CTX_free(ctx->sc_fallback_md);
+        ctx->sc_fallback_md = NULL;
+        return 0;
+    }
+    return 1;
+}
+
+static int
+ALCP_prov_signature_set_digest(alc_prov_signature_ctx_p ctx, const char* name)
+{
+    if (strlen(name) >= sizeof(ctx->sc_mdname)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_DIGEST);
+        return 0;
+    }
+    ALCP_prov_signature_digest_free(ctx);
+    OPENSSL_strlcpy(ctx->sc_mdname, name, sizeof(ctx->sc_mdname));
+    ctx->sc_md = ALCP_prov_rsa_digest(name);
+    return 1;
+}
+
+static int
+ALCP_prov_signature_init(alc_prov_signature_ctx_p ctx,
+                         alc_prov_rsa_key_p       key,
+                         const OSSL_PARAM         params[],
+                         int                      operation)
+{
+    if (key == NULL) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NO_KEY_SET);
+        return 0;
+    }
+    if (operation == EVP_PKEY_OP_SIGN && !key->rk_has_priv) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_A_PRIVATE_KEY);
+        return 0;
+    }
+    ALCP_prov_signature_reset(ctx);
+    ctx->sc_key       = key;
+    ctx->sc_operation = operation;
+    ctx->sc_pad_mode  = RSA_PKCS1_PADDING;
+
+    if (key->rk_alcp != NULL
+        && !ALCP_prov_rsa_handle_new(&ctx->sc_handle, key)) {
+        return 0;
+    }
+    return ALCP_prov_signature_set_ctx_params(ctx, params);
+}
+
+static int
+ALCP_prov_signature_digest_init(alc_prov_signature_ctx_p ctx,
+                                const char*              mdname,
+                                alc_prov_rsa_key_p       key,
+                                const OSSL_PARAM         params[],
+                                int                      operation)
+{
+    if (!ALCP_prov_signature_init(ctx, key, params, operation)) {
+        return 0;
+    }
+    if (mdname != NULL && mdname[0] != '\0'
+        && !ALCP_prov_signature_set_digest(ctx, mdname)) {
+        return 0;
+    }
+    // the digest is fixed from now on
+    ctx->sc_flag_digest = 1;
+    return 1;
+}
+
+int
+ALCP_prov_signature_sign_init(void*            vctx,
+                              void*            provkey,
+                              const OSSL_PARAM params[])
+{
+    ENTER();
+    int ret = ALCP_prov_signature_init(vctx, provkey, params, EVP_PKEY_OP_SIGN);
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_signature_verify_init(void*            vctx,
+                                void*            provkey,
+                                const OSSL_PARAM params[])
+{
+    ENTER();
+    int ret =
+        ALCP_prov_signature_init(vctx, provkey, params, EVP_PKEY_OP_VERIFY);
+    EXIT();
+    return ret;
+}
+
+/* EMSA-PKCS1-v1_5 encoding of a hash, RFC 8017 9.2 */
+static void
+ALCP_prov_signature_encode(const alc_prov_rsa_digest_t* md,
+                           const Uint8*                 hash,
+                           size_t                       size,
+                           Uint8*                       em)
+{
+    size_t ps = size - md->rd_digest_info_len - md->rd_hash_len - 3;
+
+    em[0] = 0x00;
+    em[1] = 0x01;
+    memset(em + 2, 0xff, ps);
+    em[2 + ps] = 0x00;
+    memcpy(em + 3 + ps, md->rd_digest_info, md->rd_digest_info_len);
+    memcpy(em + 3 + ps + md->rd_digest_info_len, hash, md->rd_hash_len);
+}
+
+static int
+ALCP_prov_signature_sign_hash(alc_prov_signature_ctx_p ctx,
+                              unsigned char*           sig,
+                              size_t*                  siglen,
+                              size_t                   sigsize,
+                              const unsigned char*     hash,
+                              size_t                   hashlen)
+{
+    Uint8  em[ALCP_PROV_RSA_MAX_KEY_SIZE];
+    size_t size = ctx->sc_key->rk_key_size / 8;
+
+    if (sigsize < size) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_OUTPUT_BUFFER_TOO_SMALL);
+        return 0;
+    }
+    if (hashlen != ctx->sc_md->rd_hash_len) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_DIGEST_LENGTH);
+        return 0;
+    }
+    ALCP_prov_signature_encode(ctx->sc_md, hash, size, em);
+    if (!ALCP_prov_rsa_private(&ctx->sc_handle, size, em, sig)) {
+        ERR_raise(ERR_LIB_PROV, ERR_R_INTERNAL_ERROR);
+        return 0;
+    }
+    *siglen = size;
+    return 1;
+}
+
+static int
+ALCP_prov_signature_verify_hash(alc_prov_signature_ctx_p ctx,
+                                const unsigned char*     sig,
+                                size_t                   siglen,
+                                const unsigned char*     hash,
+                                size_t                   hashlen)
+{
+    Uint8  em[ALCP_PROV_RSA_MAX_KEY_SIZE];
+    Uint8  expected[ALCP_PROV_RSA_MAX_KEY_SIZE];
+    size_t size = ctx->sc_key->rk_key_size / 8;
+
+    if (siglen != size) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_SIGNATURE_SIZE);
+        return 0;
+    }
+    if (hashlen != ctx->sc_md->rd_hash_len) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_DIGEST_LENGTH);
+        return 0;
+    }
+    // fails for signatures not below the modulus
+    if (alcp_is_error(alcp_rsa_publickey_encrypt(
+            &ctx->sc_handle, ALCP_RSA_PADDING_NONE, sig, size, em))) {
+        return 0;
+    }
+    ALCP_prov_signature_encode(ctx->sc_md, hash, size, expected);
+    return memcmp(em, expected, size) == 0;
+}
+
+int
+ALCP_prov_signature_sign(void*                vctx,
+                         unsigned char*       sig,
+                         size_t*              siglen,
+                         size_t               sigsize,
+                         const unsigned char* tbs,
+                         size_t               tbslen)
+{
+    ENTER();
+    alc_prov_signature_ctx_p ctx = vctx;
+    int                      ret;
+
+    if (!ALCP_prov_signature_uses_alcp(ctx)) {
+        *siglen = sigsize;
+        ret     = ALCP_prov_signature_new_fallback(ctx)
+              && EVP_PKEY_sign(ctx->sc_fallback, sig, siglen, tbs, tbslen) > 0;
+    } else if (sig == NULL) {
+        *siglen = ctx->sc_key->rk_key_size / 8;
+        ret     = 1;
+    } else {
+        ret = ALCP_prov_signature_sign_hash(
+            ctx, sig, siglen, sigsize, tbs, tbslen);
+    }
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_signature_verify(void*                vctx,
+                           const unsigned char* sig,
+                           size_t               siglen,
+                           const unsigned char* tbs,
+                           size_t               tbslen)
+{
+    ENTER();
+    alc_prov_signature_ctx_p ctx = vctx;
+    int                      ret;
+
+    if (!ALCP_prov_signature_uses_alcp(ctx)) {
+        ret = ALCP_prov_signature_new_fallback(ctx)
+              && EVP_PKEY_verify(ctx->sc_fallback, sig, siglen, tbs, tbslen)
+                     > 0;
+    } else {
+        ret = ALCP_prov_signature_verify_hash(ctx, sig, siglen, tbs, tbslen);
+    }
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_signature_digest_sign_init(void*            vctx,
+                                     const char*      mdname,
+                                     void*            provkey,
+                                     const OSSL_PARAM params[])
+{
+    ENTER();
+    int ret = ALCP_prov_signature_digest_init(
+        vctx, mdname, provkey, params, EVP_PKEY_OP_SIGN);
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_signature_digest_verify_init(void*            vctx,
+                                       const char*      mdname,
+                                       void*            provkey,
+                                       const OSSL_PARAM params[])
+{
+    ENTER();
+    int ret = ALCP_prov_signature_digest_init(
+        vctx, mdname, provkey, params, EVP_PKEY_OP_VERIFY);
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_signature_digest_update(void*                vctx,
+                                  const unsigned char* data,
+                                  size_t               datalen)
+{
+    ENTER();
+    alc_prov_signature_ctx_p ctx = vctx;
+
+    if (!ALCP_prov_signature_digest_start(ctx)) {
+        return 0;
+    }
+    if (ctx->sc_fallback_md != NULL) {
+        return ctx->sc_operation == EVP_PKEY_OP_SIGN
+                   ? EVP_DigestSignUpdate(ctx->sc_fallback_md, data, datalen)
+                   : EVP_DigestVerifyUpdate(
+                       ctx->sc_fallback_md, data, datalen);
+    }
+    EXIT();
+    return !alcp_is_error(alcp_digest_update(&ctx->sc_digest, data, datalen));
+}
+
+/* The hash of the message so far, the session ends with it */
+static int
+ALCP_prov_signature_digest_final(alc_prov_signature_ctx_p ctx, Uint8* hash)
+{
+    Uint64 len = ctx->sc_md->rd_hash_len;
+
+    return !alcp_is_error(alcp_digest_finalize(&ctx->sc_digest, NULL, 0))
+           && !alcp_is_error(alcp_digest_copy(&ctx->sc_digest, hash, len));
+}
+
+int
+ALCP_prov_signature_digest_sign_final(void*          vctx,
+                                      unsigned char* sig,
+                                      size_t*        siglen,
+                                      size_t         sigsize)
+{
+    ENTER();
+    alc_prov_signature_ctx_p ctx = vctx;
+    Uint8                    hash[ALC_DIGEST_LEN_512 / 8];
+    int                      ret;
+
+    if (sig == NULL) {
+        *siglen = EVP_PKEY_get_size(ctx->sc_key->rk_pkey);
+        return 1;
+    }
+    if (!ALCP_prov_signature_digest_start(ctx)) {
+        return 0;
+    }
+    if (ctx->sc_fallback_md != NULL) {
+        *siglen = sigsize;
+        return EVP_DigestSignFinal(ctx->sc_fallback_md, sig, siglen) > 0;
+    }
+    ret = ALCP_prov_signature_digest_final(ctx, hash)
+          && ALCP_prov_signature_sign_hash(
+              ctx, sig, siglen, sigsize, hash, ctx->sc_md->rd_hash_len);
+    EXIT();
+    return ret;
+}
+
+int
+ALCP_prov_signature_digest_verify_final(void*                vctx,
+                                        const unsigned char* sig,
+                                        size_t               siglen)
+{
+    ENTER();
+    alc_prov_signature_ctx_p ctx = vctx;
+    Uint8                    hash[ALC_DIGEST_LEN_512 / 8];
+    int                      ret;
+
+    if (!ALCP_prov_signature_digest_start(ctx)) {
+        return 0;
+    }
+    if (ctx->sc_fallback_md != NULL) {
+        return EVP_DigestVerifyFinal(ctx->sc_fallback_md, sig, siglen) > 0;
+    }
+    ret = ALCP_prov_signature_digest_final(ctx, hash)
+          && ALCP_prov_signature_verify_hash(
+              ctx, sig, siglen, hash, ctx->sc_md->rd_hash_len);
+    EXIT();
+    return ret;
+}
+
+void
+ALCP_prov_signature_freectx(void* vctx)
+{
+    ENTER();
+    alc_prov_signature_ctx_p ctx = vctx;
+    if (ctx != NULL) {
+        ALCP_prov_signature_reset(ctx);
+    }
+    OPENSSL_free(ctx);
+    EXIT();
+}
+
+/* EVP duplicates the context to finalise a digest and keep going */
+void*
+ALCP_prov_signature_dupctx(void* vctx)
+{
+    ENTER();
+    alc_prov_signature_ctx_p src = vctx;
+    alc_prov_signature_ctx_p ctx = OPENSSL_memdup(src, sizeof(*src));
+    alc_digest_info_p        info;
+    int                      ok = 1;
+
+    if (ctx == NULL) {
+        return NULL;
+    }
+    ctx->sc_handle.context = NULL;
+    ctx->sc_digest.context = NULL;
+    ctx->sc_params         = NULL;
+    ctx->sc_fallback       = NULL;
+    ctx->sc_fallback_md    = NULL;
+
+    // the ALCP session is not copyable, a new one gets the key
+    if (src->sc_handle.context != NULL) {
+        ok = ALCP_prov_rsa_handle_new(&ctx->sc_handle, src->sc_key);
+    }
+    if (ok && src->sc_digest.context != NULL) {
+        info                   = (alc_digest_info_p)&src->sc_md->rd_info;
+        ctx->sc_digest.context = OPENSSL_malloc(alcp_digest_context_size(info));
+        ok                     = ctx->sc_digest.context != NULL
+             && !alcp_is_error(
+                 alcp_digest_context_copy(&src->sc_digest, &ctx->sc_digest));
+        if (!ok) {
+            OPENSSL_free(ctx->sc_digest.context);
+            ctx->sc_digest.context = NULL;
+        }
+    }
+    if (ok && src->sc_params != NULL) {
+        ctx->sc_params = OSSL_PARAM_dup(src->sc_params);
+        ok             = ctx->sc_params != NULL;
+    }
+    if (ok && src->sc_fallback != NULL) {
+        ctx->sc_fallback = EVP_PKEY_CTX_dup(src->sc_fallback);
+        ok               = ctx->sc_fallback != NULL;
+    }
+    if (ok && src->sc_fallback_md != NULL) {
+        ctx->sc_fallback_md = EVP_MD_CTX_new();
+        ok                  = ctx->sc_fallback_md != NULL
+             && EVP_MD_CTX_copy_ex(ctx->sc_fallback_md, src->sc_fallback_md);
+    }
+    if (!ok) {
+        ALCP_prov_signature_freectx(ctx);
+        return NULL;
+    }
+    EXIT();
+    return ctx;
+}
+
+/*
+ * Every param is kept for the default provider. Those ALCP needs to know
+ * about are the padding and the digest, the others only matter to what
+ * falls back.
+ */
+int
+ALCP_prov_signature_set_ctx_params(void* vctx, const OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_signature_ctx_p ctx = vctx;
+    EVP_PKEY_CTX*            fallback;
+    const OSSL_PARAM*        p;
+    const char*              mdname;
+    int                      pad_mode;
+
+    if (params == NULL || params[0].key == NULL) {
+        return 1;
+    }
+    if (!ALCP_prov_rsa_save_params(&ctx->sc_params, params)) {
+        return 0;
+    }
+    fallback = ALCP_prov_signature_fallback(ctx);
+    if (fallback != NULL) {
+        return EVP_PKEY_CTX_set_params(fallback, params) > 0;
+    }
+
+    p = OSSL_PARAM_locate_const(params, OSSL_SIGNATURE_PARAM_DIGEST);
+    if (p != NULL) {
+        if (ctx->sc_flag_digest) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_DIGEST_NOT_ALLOWED);
+            return 0;
+        }
+        if (!OSSL_PARAM_get_utf8_string_ptr(p, &mdname)
+            || !ALCP_prov_signature_set_digest(ctx, mdname)) {
+            return 0;
+        }
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_SIGNATURE_PARAM_PAD_MODE);
+    if (p != NULL) {
+        if (!ALCP_prov_rsa_get_pad_mode(p, &pad_mode)
+            || pad_mode == RSA_PKCS1_OAEP_PADDING) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_ILLEGAL_OR_UNSUPPORTED_PADDING_MODE);
+            return 0;
+        }
+        ctx->sc_pad_mode = pad_mode;
+    }
+    EXIT();
+    return 1;
+}
+
+int
+ALCP_prov_signature_get_ctx_params(void* vctx, OSSL_PARAM params[])
+{
+    ENTER();
+    alc_prov_signature_ctx_p ctx = vctx;
+    OSSL_PARAM*              p;
+
+    if (ctx->sc_key == NULL) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NO_KEY_SET);
+        return 0;
+    }
+    // the default provider answers for everything that falls back to it
+    if (!ALCP_prov_signature_uses_alcp(ctx)
+        && ALCP_prov_signature_fallback(ctx) == NULL
+        && !(ctx->sc_flag_digest ? ALCP_prov_signature_digest_start(ctx)
+                                 : ALCP_prov_signature_new_fallback(ctx))) {
+        return 0;
+    }
+    if (ALCP_prov_signature_fallback(ctx) != NULL) {
+        return EVP_PKEY_CTX_get_params(ALCP_prov_signature_fallback(ctx),
+                                       params)
+               > 0;
+    }
+
+    p = OSSL_PARAM_locate(params, OSSL_SIGNATURE_PARAM_ALGORITHM_ID);
+    if (p != NULL
+        && !OSSL_PARAM_set_octet_string(p,
+                                        ctx->sc_md->rd_algorithm_id,
+                                        ctx->sc_md->rd_algorithm_id_len)) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_SIGNATURE_PARAM_PAD_MODE);
+    if (p != NULL && !ALCP_prov_rsa_set_pad_mode(p, ctx->sc_pad_mode)) {
+        return 0;
+    }
+    p = OSSL_PARAM_locate(params, OSSL_SIGNATURE_PARAM_DIGEST);
+    if (p != NULL && !OSSL_PARAM_set_utf8_string(p, ctx->sc_mdname)) {
+        return 0;
+    }
+    EXIT();
+    return 1;
+}
+
+const OSSL_PARAM*
+ALCP_prov_signature_gettable_ctx_params(void* vctx, void* provctx)
+{
+    static const OSSL_PARAM gettable[] = {
+        OSSL_PARAM_octet_string(OSSL_SIGNATURE_PARAM_ALGORITHM_ID, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_PAD_MODE, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_DIGEST, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_MGF1_DIGEST, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_PSS_SALTLEN, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return gettable;
+}
+
+const OSSL_PARAM*
+ALCP_prov_signature_settable_ctx_params(void* vctx, void* provctx)
+{
+    static const OSSL_PARAM settable[] = {
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_PAD_MODE, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_DIGEST, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_PROPERTIES, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_MGF1_DIGEST, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_MGF1_PROPERTIES, NULL, 0),
+        OSSL_PARAM_utf8_string(OSSL_SIGNATURE_PARAM_PSS_SALTLEN, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return settable;
+}
+
+CREATE_SIGNATURE_DISPATCHERS();
+
+const OSSL_ALGORITHM ALC_prov_signature[] = {
+    { ALCP_PROV_NAMES_RSA, SIGNATURE_DEF_PROP, signature_functions },
+    { NULL, NULL, NULL },
+};
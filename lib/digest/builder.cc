@@ -34,6 +34,7 @@
 #include "alcp/digest/sha2_384.hh"
 #include "alcp/digest/sha2_512.hh"
 #include "alcp/digest/sha3.hh"
+#include "alcp/digest/sha_mb.hh"
 
 namespace alcp::digest {
 
@@ -74,6 +75,58 @@ __sha_finalize_wrapper(void* pDigest, const Uint8* pBuf, Uint64 len)
     return e;
 }
 
+template<typename DIGESTTYPE>
+static alc_error_t
+__sha_update_multi_wrapper(void* const        pDigests[],
+                           const Uint8* const pSrc[],
+                           const Uint64       len[],
+                           Uint64             num)
+{
+    alc_error_t e = ALC_ERROR_NONE;
+    DIGESTTYPE* ap[cMultiBufferBatch];
+
+    for (Uint64 base = 0; base < num && !e; base += cMultiBufferBatch) {
+        Uint64 count = std::min(num - base, cMultiBufferBatch);
+        for (Uint64 i = 0; i < count; i++) {
+            ap[i] = static_cast<DIGESTTYPE*>(pDigests[base + i]);
+        }
+        e = DIGESTTYPE::updateMulti(ap, pSrc + base, len + base, count);
+    }
+
+    return e;
+}
+
+template<typename DIGESTTYPE>
+static alc_error_t
+__sha_finalize_multi_wrapper(void* const pDigests[], Uint64 num)
+{
+    alc_error_t e = ALC_ERROR_NONE;
+    DIGESTTYPE* ap[cMultiBufferBatch];
+
+    for (Uint64 base = 0; base < num && !e; base += cMultiBufferBatch) {
+        Uint64 count = std::min(num - base, cMultiBufferBatch);
+        for (Uint64 i = 0; i < count; i++) {
+            ap[i] = static_cast<DIGESTTYPE*>(pDigests[base + i]);
+        }
+        e = DIGESTTYPE::finalizeMulti(ap, count);
+    }
+
+    return e;
+}
+
+template<typename DIGESTTYPE>
+static alc_error_t
+__sha_duplicate_wrapper(const Context& rSrcCtx, Context& rDestCtx)
+{
+    auto addr  = reinterpret_cast<Uint8*>(&rDestCtx) + sizeof(rDestCtx);
+    auto p_src = static_cast<const DIGESTTYPE*>(rSrcCtx.m_digest);
+
+    auto algo         = new (addr) DIGESTTYPE(*p_src);
+    rDestCtx.m_digest = static_cast<void*>(algo);
+
+    return ALC_ERROR_NONE;
+}
+
 static alc_error_t
 __sha_setShakeLength_wrapper(void* pDigest, Uint64 len)
 {
@@ -161,6 +214,9 @@ __build_sha(const alc_digest_info_t& sha2Info, Context& ctx)
 
     // setShakeLength is not implemented for SHA2
     ctx.setShakeLength = nullptr;
+    ctx.updateMulti    = __sha_update_multi_wrapper<ALGONAME>;
+    ctx.finalizeMulti  = nullptr;
+    ctx.duplicate      = __sha_duplicate_wrapper<ALGONAME>;
 
     return err;
 }
@@ -229,6 +285,9 @@ class Sha3Builder
         } else {
             rCtx.setShakeLength = nullptr;
         }
+        rCtx.updateMulti   = __sha_update_multi_wrapper<Sha3>;
+        rCtx.finalizeMulti = __sha_finalize_multi_wrapper<Sha3>;
+        rCtx.duplicate     = __sha_duplicate_wrapper<Sha3>;
         return err;
     }
 };
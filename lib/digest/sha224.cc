@@ -27,6 +27,7 @@
  */
 
 #include "alcp/digest/sha2.hh"
+#include "alcp/digest/sha_mb.hh"
 
 #include "alcp/utils/copy.hh"
 
@@ -70,6 +71,11 @@ Sha224::Sha224()
     m_psha256->setIv(cIv, sizeof(cIv));
 }
 
+Sha224::Sha224(const Sha224& rSrc)
+    : Sha2{ rSrc }
+    , m_psha256{ std::make_shared<Sha256>(*rSrc.m_psha256) }
+{}
+
 Sha224::~Sha224() = default;
 
 alc_error_t
@@ -78,6 +84,35 @@ Sha224::update(const Uint8* pBuf, Uint64 size)
     return m_psha256->update(pBuf, size);
 }
 
+alc_error_t
+Sha224::updateMulti(Sha224* const      digests[],
+                    const Uint8* const pSrc[],
+                    const Uint64       len[],
+                    Uint64             num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    Sha256*     inner[cMultiBufferBatch];
+
+    if (digests == nullptr || pSrc == nullptr || len == nullptr) {
+        /* TODO: Change this to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    for (Uint64 base = 0; base < num && !err; base += cMultiBufferBatch) {
+        Uint64 count = std::min(num - base, cMultiBufferBatch);
+        for (Uint64 i = 0; i < count; i++) {
+            if (digests[base + i] == nullptr) {
+                /* TODO: Change this to Status */
+                return ALC_ERROR_INVALID_ARG;
+            }
+            inner[i] = digests[base + i]->m_psha256.get();
+        }
+        err = Sha256::updateMulti(inner, pSrc + base, len + base, count);
+    }
+
+    return err;
+}
+
 void
 Sha224::finish()
 {
@@ -127,6 +162,25 @@ Sha224::copyHash(Uint8* pHash, Uint64 size) const
     return err;
 }
 
+alc_error_t
+Sha224::copyState(const IDigest& rSrc)
+{
+    auto p_src = dynamic_cast<const Sha224*>(&rSrc);
+
+    if (p_src == nullptr) {
+        /* TODO: Change this to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    return m_psha256->copyState(*p_src->m_psha256);
+}
+
+IDigest*
+Sha224::clone() const
+{
+    return new Sha224(*this);
+}
+
 Uint64
 Sha224::getInputBlockSize()
 {
@@ -32,6 +32,7 @@
 
 #include "alcp/digest/sha2.hh"
 #include "alcp/digest/sha_avx2.hh"
+#include "alcp/digest/sha_mb.hh"
 #include "alcp/digest/shani.hh"
 
 #include "alcp/utils/bits.hh"
@@ -44,6 +45,14 @@ using utils::CpuId;
 
 namespace alcp::digest {
 
+/*
+ * Fewest busy lanes for which a multi-buffer call beats hashing the
+ * remaining messages one by one. SHA-NI alone keeps up with about 12
+ * AVX-512 lanes and is always ahead of the 8 AVX2 lanes.
+ */
+static constexpr int cMinLanesAvx512 = 4, cMinLanesAvx512ShaNi = 13,
+                     cMinLanesAvx2 = 4;
+
 /*
  * first 32 bits of the fractional parts of the square roots
  * of the first 8 primes 2..19
@@ -87,6 +96,11 @@ class Sha256::Impl
     alc_error_t setIv(const void* pIv, Uint64 size);
     void        reset();
 
+    static alc_error_t updateMulti(Impl* const        impls[],
+                                   const Uint8* const pSrc[],
+                                   const Uint64       len[],
+                                   Uint64             num);
+
 #if defined(USE_ALCP_MEMPOOL)
     static void* operator new(size_t size)
     {
@@ -105,6 +119,8 @@ class Sha256::Impl
     static void extendMsg(Uint32 w[], Uint32 start, Uint32 end);
     void        compressMsg(Uint32 w[]);
     alc_error_t processChunk(const Uint8* pSrc, Uint64 len);
+    alc_error_t absorbHead(const Uint8*& pSrc, Uint64& size);
+    void        absorbTail(const Uint8* pSrc, Uint64 size);
 
   private:
     Uint64 m_msg_len;
@@ -215,8 +231,13 @@ Sha256::Impl::processChunk(const Uint8* pSrc, Uint64 len)
     return ALC_ERROR_NONE;
 }
 
+/*
+ * Takes the part of an update that goes through the internal buffer. On return
+ * either all of it is consumed (size == 0) or the buffer is empty and
+ * pSrc/size describe the rest of the input.
+ */
 alc_error_t
-Sha256::Impl::update(const Uint8* pSrc, Uint64 input_size)
+Sha256::Impl::absorbHead(const Uint8*& pSrc, Uint64& size)
 {
     alc_error_t err = ALC_ERROR_NONE;
 
@@ -230,38 +251,57 @@ Sha256::Impl::update(const Uint8* pSrc, Uint64 input_size)
      * Valid request, last computed has itself is good,
      * default is m_iv
      */
-    if (input_size == 0) {
+    if (size == 0) {
         return err;
     }
-    m_msg_len += input_size;
+    m_msg_len += size;
 
-    Uint64 to_process = std::min((input_size + m_idx), cChunkSize);
-    if (to_process < cChunkSize) {
+    if (m_idx + size < cChunkSize) {
         /* copy them to internal buffer and return */
-        utils::CopyBlock(&m_buffer[m_idx], pSrc, input_size);
-        m_idx += input_size;
+        utils::CopyBlock(&m_buffer[m_idx], pSrc, size);
+        m_idx += size;
+        size = 0;
         return err;
     }
 
-    Uint64 idx = m_idx;
-
-    if (idx) {
+    if (m_idx) {
         /*
          * Last call to update(), had some unprocessed bytes which is part
          * of internal buffer, we process first block by copying from pSrc the
          * remaining bytes of a chunk.
          */
-        to_process = std::min(input_size, cChunkSize - idx);
-        utils::CopyBlock(&m_buffer[idx], pSrc, to_process);
+        Uint64 to_process = cChunkSize - m_idx;
+        utils::CopyBlock(&m_buffer[m_idx], pSrc, to_process);
 
         pSrc += to_process;
-        input_size -= to_process;
-        idx += to_process;
+        size -= to_process;
 
-        if (idx == cChunkSize) {
-            err = processChunk(m_buffer, idx);
-            idx = 0;
-        }
+        err   = processChunk(m_buffer, cChunkSize);
+        m_idx = 0;
+    }
+
+    return err;
+}
+
+/*
+ * Leftover bytes of an update, less than a chunk, go to the internal buffer
+ */
+void
+Sha256::Impl::absorbTail(const Uint8* pSrc, Uint64 size)
+{
+    if (size) {
+        utils::CopyBlock(&m_buffer[m_idx], pSrc, size);
+        m_idx += size;
+    }
+}
+
+alc_error_t
+Sha256::Impl::update(const Uint8* pSrc, Uint64 input_size)
+{
+    alc_error_t err = absorbHead(pSrc, input_size);
+
+    if (err || input_size == 0) {
+        return err;
     }
 
     /* Calculate leftover bytes that can be processed as multiple chunks */
@@ -279,12 +319,82 @@ Sha256::Impl::update(const Uint8* pSrc, Uint64 input_size)
     /*
      * We still have some leftover bytes, copy them to internal buffer
      */
-    if (input_size) {
-        utils::CopyBlock(&m_buffer[idx], pSrc, input_size);
-        idx += input_size;
+    absorbTail(pSrc, input_size);
+
+    return err;
+}
+
+alc_error_t
+Sha256::Impl::updateMulti(Impl* const        impls[],
+                          const Uint8* const pSrc[],
+                          const Uint64       len[],
+                          Uint64             num)
+{
+    static bool avx512_available = CpuId::cpuHasAvx512(utils::AVX512_F);
+    static bool avx2_available   = CpuId::cpuHasAvx2();
+    static bool shani_available  = CpuId::cpuHasShani();
+
+    alc_error_t     err = ALC_ERROR_NONE;
+    ShaLane<Uint32> lanes[cMultiBufferBatch];
+
+    for (Uint64 i = 0; i < num; i++) {
+        if (impls[i]->m_finished) {
+            /* TODO Change to Status */
+            return ALC_ERROR_INVALID_ARG;
+        }
+    }
+
+    /*
+     * Buffered heads and tails are handled per message, the whole chunks in
+     * between are what gets interleaved
+     */
+    for (Uint64 i = 0; i < num; i++) {
+        const Uint8* p_src = pSrc[i];
+        Uint64       size  = len[i];
+
+        err = impls[i]->absorbHead(p_src, size);
+        if (err) {
+            return err;
+        }
+
+        Uint64 num_chunks = size / cChunkSize;
+        lanes[i]          = { impls[i]->m_hash, p_src, num_chunks };
+        impls[i]->absorbTail(p_src + num_chunks * cChunkSize,
+                             size - num_chunks * cChunkSize);
+    }
+
+    auto single = [&](Uint64 i, const Uint8* pBuf, Uint64 size) {
+        err = impls[i]->processChunk(pBuf, size);
+    };
+
+    if (avx512_available) {
+        ShaMultiBufferSchedule<Uint32, 16>(
+            lanes,
+            num,
+            cChunkSize,
+            shani_available ? cMinLanesAvx512ShaNi : cMinLanesAvx512,
+            [](Uint32** pHash, const Uint8** pBuf, Uint64 numBlocks) {
+                zen4::ShaUpdate256x16(pHash, pBuf, numBlocks, cRoundConstants);
+            },
+            single);
+    } else if (avx2_available && !shani_available) {
+        ShaMultiBufferSchedule<Uint32, 8>(
+            lanes,
+            num,
+            cChunkSize,
+            cMinLanesAvx2,
+            [](Uint32** pHash, const Uint8** pBuf, Uint64 numBlocks) {
+                avx2::ShaUpdate256x8(pHash, pBuf, numBlocks, cRoundConstants);
+            },
+            single);
+    } else {
+        for (Uint64 i = 0; i < num && !err; i++) {
+            if (lanes[i].numBlocks) {
+                single(i, lanes[i].pSrc, lanes[i].numBlocks * cChunkSize);
+            }
+        }
     }
 
-    m_idx = idx;
     return err;
 }
 
@@ -345,6 +455,11 @@ Sha256::Sha256(const alc_digest_info_t& rDigestInfo)
     : Sha256()
 {}
 
+Sha256::Sha256(const Sha256& rSrc)
+    : Sha2{ rSrc }
+    , m_pimpl{ std::make_unique<Sha256::Impl>(*rSrc.pImpl()) }
+{}
+
 Sha256::~Sha256() = default;
 
 alc_error_t
@@ -385,6 +500,37 @@ Sha256::update(const Uint8* pSrc, Uint64 size)
     return err;
 }
 
+alc_error_t
+Sha256::updateMulti(Sha256* const      digests[],
+                    const Uint8* const pSrc[],
+                    const Uint64       len[],
+                    Uint64             num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    Impl*       impls[cMultiBufferBatch];
+
+    if (digests == nullptr || pSrc == nullptr || len == nullptr) {
+        /* TODO: change to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+    for (Uint64 i = 0; i < num; i++) {
+        if (digests[i] == nullptr || pSrc[i] == nullptr) {
+            /* TODO: change to Status */
+            return ALC_ERROR_INVALID_ARG;
+        }
+    }
+
+    for (Uint64 base = 0; base < num && !err; base += cMultiBufferBatch) {
+        Uint64 count = std::min(num - base, cMultiBufferBatch);
+        for (Uint64 i = 0; i < count; i++) {
+            impls[i] = digests[base + i]->pImpl();
+        }
+        err = Impl::updateMulti(impls, pSrc + base, len + base, count);
+    }
+
+    return err;
+}
+
 alc_error_t
 Sha256::finalize(const Uint8* pSrc, Uint64 size)
 {
@@ -418,6 +564,27 @@ Sha256::copyHash(Uint8* pHash, Uint64 size) const
     return err;
 }
 
+alc_error_t
+Sha256::copyState(const IDigest& rSrc)
+{
+    auto p_src = dynamic_cast<const Sha256*>(&rSrc);
+
+    if (p_src == nullptr) {
+        /* TODO: change to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    *pImpl() = *p_src->pImpl();
+
+    return ALC_ERROR_NONE;
+}
+
+IDigest*
+Sha256::clone() const
+{
+    return new Sha256(*this);
+}
+
 void
 Sha256::finish()
 {
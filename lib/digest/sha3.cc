@@ -34,6 +34,7 @@
 
 #include "alcp/digest/sha3.hh"
 #include "alcp/digest/sha3_zen.hh"
+#include "alcp/digest/sha_mb.hh"
 #include "alcp/utils/bits.hh"
 #include "alcp/utils/copy.hh"
 #include "alcp/utils/cpuid.hh"
@@ -53,12 +54,23 @@ namespace alcp::digest {
 // maximum size of message block in bits is used for shake128 digest
 static constexpr Uint32 MaxDigestBlockSizeBits = 1344;
 
+// fewest busy lanes for which the batched Keccak beats one state at a time
+static constexpr int cMinLanesAvx512 = 3;
+static constexpr int cMinLanesAvx2   = 2;
+
+// absorbing a block of zeros is a bare permutation, used while squeezing
+alignas(64) static const Uint8 cZeroBlock[MaxDigestBlockSizeBits / 8] = {};
+
 class Sha3::Impl
 {
   public:
     Impl(const alc_digest_info_t& rDigestInfo);
+    Impl(const Impl& rSrc);
     ~Impl() = default;
 
+    Impl&       operator=(const Impl& rSrc);
+    alc_error_t copyState(const Impl& rSrc);
+
     alc_error_t update(const Uint8* buf, Uint64 size);
     alc_error_t finalize(const Uint8* buf, Uint64 size);
     alc_error_t copyHash(Uint8* buf, Uint64 size) const;
@@ -70,13 +82,26 @@ class Sha3::Impl
 
     void reset();
 
+    static alc_error_t updateMulti(Impl* const        impls[],
+                                   const Uint8* const pSrc[],
+                                   const Uint64       len[],
+                                   Uint64             num);
+    static alc_error_t finalizeMulti(Impl* const impls[], Uint64 num);
+
   private:
+    alc_error_t absorbHead(const Uint8*& pSrc, Uint64& size);
+    void        absorbTail(const Uint8* pSrc, Uint64 size);
+    void        padChunk();
     void        absorbChunk(Uint64* p_msg_buf_64);
     void        squeezeChunk();
     alc_error_t processChunk(const Uint8* pSrc, Uint64 len);
     void        round(Uint64 round_const);
     void        fFunction();
 
+    static alc_error_t absorbMulti(Impl* const     impls[],
+                                   ShaLane<Uint64> lanes[],
+                                   Uint64          num);
+
   private:
     std::string  m_name;
     Uint64       m_chunk_size, m_chunk_size_u64, m_hash_size;
@@ -164,6 +189,40 @@ Sha3::Impl::Impl(const alc_digest_info_t& rDigestInfo)
     m_hash.resize(m_hash_size);
 }
 
+Sha3::Impl::Impl(const Impl& rSrc)
+{
+    *this = rSrc;
+}
+
+Sha3::Impl&
+Sha3::Impl::operator=(const Impl& rSrc)
+{
+    // m_state_flat keeps pointing at this object's own state
+    m_name           = rSrc.m_name;
+    m_chunk_size     = rSrc.m_chunk_size;
+    m_chunk_size_u64 = rSrc.m_chunk_size_u64;
+    m_hash_size      = rSrc.m_hash_size;
+    m_idx            = rSrc.m_idx;
+    m_hash           = rSrc.m_hash;
+    utils::CopyBlock(m_buffer, rSrc.m_buffer, sizeof(m_buffer));
+    utils::CopyBlock(m_state, rSrc.m_state, sizeof(m_state));
+
+    return *this;
+}
+
+alc_error_t
+Sha3::Impl::copyState(const Impl& rSrc)
+{
+    if (m_name != rSrc.m_name) {
+        /* TODO: change to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    *this = rSrc;
+
+    return ALC_ERROR_NONE;
+}
+
 void
 Sha3::Impl::absorbChunk(Uint64* pMsgBuffer64)
 {
@@ -179,8 +238,14 @@ Sha3::Impl::squeezeChunk()
 {
     Uint64 hash_copied = 0;
 
-    static bool zen1_available = CpuId::cpuIsZen1() || CpuId::cpuIsZen2();
-    static bool zen3_available = CpuId::cpuIsZen3() || CpuId::cpuIsZen4();
+    static bool zen1_available   = CpuId::cpuIsZen1() || CpuId::cpuIsZen2();
+    static bool zen3_available   = CpuId::cpuIsZen3() || CpuId::cpuIsZen4();
+    static bool avx512_available = CpuId::cpuHasAvx512(utils::AVX512_F);
+
+    if (avx512_available) {
+        return zen4::Sha3Finalize(
+            (Uint8*)m_state_flat, &m_hash[0], m_hash_size, m_chunk_size);
+    }
 
     if (zen3_available) {
         return zen3::Sha3Finalize(
@@ -270,7 +335,7 @@ void
 Sha3::Impl::fFunction()
 {
     for (Uint64 i = 0; i < m_num_rounds; ++i) {
-        round(cRoundConstants[i]);
+        round(cKeccakRoundConstants[i]);
     }
 }
 
@@ -302,8 +367,14 @@ Sha3::Impl::processChunk(const Uint8* pSrc, Uint64 len)
     Uint64  msg_size       = len;
     Uint64* p_msg_buffer64 = (Uint64*)pSrc;
 
-    static bool zen1_available = CpuId::cpuIsZen1() || CpuId::cpuIsZen2();
-    static bool zen3_available = CpuId::cpuIsZen3() || CpuId::cpuIsZen4();
+    static bool zen1_available   = CpuId::cpuIsZen1() || CpuId::cpuIsZen2();
+    static bool zen3_available   = CpuId::cpuIsZen3() || CpuId::cpuIsZen4();
+    static bool avx512_available = CpuId::cpuHasAvx512(utils::AVX512_F);
+
+    if (avx512_available) {
+        return zen4::Sha3Update(
+            m_state_flat, p_msg_buffer64, msg_size, m_chunk_size);
+    }
 
     if (zen3_available) {
         return zen3::Sha3Update(
@@ -325,37 +396,61 @@ Sha3::Impl::processChunk(const Uint8* pSrc, Uint64 len)
     return ALC_ERROR_NONE;
 }
 
+/*
+ * Fills the internal buffer from pSrc and processes it once full, pSrc and
+ * size are advanced past the bytes consumed
+ */
 alc_error_t
-Sha3::Impl::update(const Uint8* pSrc, Uint64 inputSize)
+Sha3::Impl::absorbHead(const Uint8*& pSrc, Uint64& size)
 {
     alc_error_t err = ALC_ERROR_NONE;
 
-    Uint64 to_process = std::min((inputSize + m_idx), m_chunk_size);
-    if (to_process < m_chunk_size) {
+    if (m_idx + size < m_chunk_size) {
         /* copy them to internal buffer and return */
-        utils::CopyBytes(&m_buffer[m_idx], pSrc, inputSize);
-        m_idx += inputSize;
+        utils::CopyBytes(&m_buffer[m_idx], pSrc, size);
+        m_idx += size;
+        size = 0;
         return err;
     }
 
-    Uint64 idx = m_idx;
-
-    if (idx) {
+    if (m_idx) {
         /*
          * Last call to update(), had some unprocessed bytes which is part
          * of internal buffer, we process first block by copying from pSrc
          * the remaining bytes of a chunk.
          */
-        to_process = std::min(inputSize, m_chunk_size - idx);
-        utils::CopyBytes(&m_buffer[idx], pSrc, to_process);
+        Uint64 to_process = m_chunk_size - m_idx;
+        utils::CopyBytes(&m_buffer[m_idx], pSrc, to_process);
 
         pSrc += to_process;
-        inputSize -= to_process;
-        idx += to_process;
-        if (idx == m_chunk_size) {
-            err = processChunk(m_buffer, m_chunk_size);
-            idx = 0;
-        }
+        size -= to_process;
+
+        err   = processChunk(m_buffer, m_chunk_size);
+        m_idx = 0;
+    }
+
+    return err;
+}
+
+/*
+ * Leftover bytes of an update, less than a chunk, go to the internal buffer
+ */
+void
+Sha3::Impl::absorbTail(const Uint8* pSrc, Uint64 size)
+{
+    if (size) {
+        utils::CopyBlock(&m_buffer[m_idx], pSrc, size);
+        m_idx += size;
+    }
+}
+
+alc_error_t
+Sha3::Impl::update(const Uint8* pSrc, Uint64 inputSize)
+{
+    alc_error_t err = absorbHead(pSrc, inputSize);
+
+    if (err || inputSize == 0) {
+        return err;
     }
 
     /* Calculate leftover bytes that can be processed as multiple chunks */
@@ -371,25 +466,119 @@ Sha3::Impl::update(const Uint8* pSrc, Uint64 inputSize)
     /*
      * We still have some leftover bytes, copy them to internal buffer
      */
-    if (inputSize) {
-        utils::CopyBlock(&m_buffer[idx], pSrc, inputSize);
-        idx += inputSize;
-    }
+    absorbTail(pSrc, inputSize);
+
+    return err;
+}
+
+/*
+ * Runs every lane through the batched Keccak, lanes only share a kernel call
+ * when their rates match
+ */
+alc_error_t
+Sha3::Impl::absorbMulti(Impl* const     impls[],
+                        ShaLane<Uint64> lanes[],
+                        Uint64          num)
+{
+    static bool avx512_available = CpuId::cpuHasAvx512(utils::AVX512_F);
+    static bool avx2_available   = CpuId::cpuHasAvx2();
+
+    alc_error_t     err = ALC_ERROR_NONE;
+    Impl*           group_impls[cMultiBufferBatch];
+    ShaLane<Uint64> group[cMultiBufferBatch];
+    bool            grouped[cMultiBufferBatch] = {};
+
+    for (Uint64 first = 0; first < num; first++) {
+        if (grouped[first]) {
+            continue;
+        }
+
+        Uint64 chunk_size = impls[first]->m_chunk_size;
+        Uint64 count      = 0;
+        for (Uint64 i = first; i < num; i++) {
+            if (!grouped[i] && impls[i]->m_chunk_size == chunk_size) {
+                grouped[i]         = true;
+                group_impls[count] = impls[i];
+                group[count++]     = lanes[i];
+            }
+        }
 
-    m_idx = idx;
+        auto single = [&](Uint64 i, const Uint8* pBuf, Uint64 size) {
+            err = group_impls[i]->processChunk(pBuf, size);
+        };
+
+        if (avx512_available) {
+            ShaMultiBufferSchedule<Uint64, 8, cDim * cDim>(
+                group,
+                count,
+                chunk_size,
+                cMinLanesAvx512,
+                [chunk_size](
+                    Uint64** pState, const Uint8** pBuf, Uint64 numBlocks) {
+                    zen4::Sha3UpdateX8(pState, pBuf, numBlocks, chunk_size);
+                },
+                single);
+        } else if (avx2_available) {
+            ShaMultiBufferSchedule<Uint64, 4, cDim * cDim>(
+                group,
+                count,
+                chunk_size,
+                cMinLanesAvx2,
+                [chunk_size](
+                    Uint64** pState, const Uint8** pBuf, Uint64 numBlocks) {
+                    avx2::Sha3UpdateX4(pState, pBuf, numBlocks, chunk_size);
+                },
+                single);
+        } else {
+            for (Uint64 i = 0; i < count; i++) {
+                if (group[i].numBlocks) {
+                    single(i, group[i].pSrc, group[i].numBlocks * chunk_size);
+                }
+            }
+        }
+    }
 
     return err;
 }
 
 alc_error_t
-Sha3::Impl::finalize(const Uint8* pBuf, Uint64 size)
+Sha3::Impl::updateMulti(Impl* const        impls[],
+                        const Uint8* const pSrc[],
+                        const Uint64       len[],
+                        Uint64             num)
 {
-    alc_error_t err = ALC_ERROR_NONE;
+    alc_error_t     err = ALC_ERROR_NONE;
+    ShaLane<Uint64> lanes[cMultiBufferBatch];
 
-    if (pBuf && size) {
-        err = update(pBuf, size);
+    /*
+     * Buffered heads and tails are handled per message, the whole chunks in
+     * between are what gets interleaved
+     */
+    for (Uint64 i = 0; i < num; i++) {
+        const Uint8* p_src = pSrc[i];
+        Uint64       size  = len[i];
+
+        err = impls[i]->absorbHead(p_src, size);
+        if (err) {
+            return err;
+        }
+
+        Uint64 chunk_size = impls[i]->m_chunk_size;
+        Uint64 num_chunks = size / chunk_size;
+        lanes[i]          = { impls[i]->m_state_flat, p_src, num_chunks };
+        impls[i]->absorbTail(p_src + num_chunks * chunk_size,
+                             size - num_chunks * chunk_size);
     }
 
+    return absorbMulti(impls, lanes, num);
+}
+
+/*
+ * Pads the buffered bytes into the last block of the message
+ */
+void
+Sha3::Impl::padChunk()
+{
     // sha3 padding
     utils::PadBlock<Uint8>(&m_buffer[m_idx], 0x0, m_chunk_size - m_idx);
 
@@ -400,6 +589,69 @@ Sha3::Impl::finalize(const Uint8* pBuf, Uint64 size)
     }
 
     m_buffer[m_chunk_size - 1] |= 0x80;
+}
+
+alc_error_t
+Sha3::Impl::finalizeMulti(Impl* const impls[], Uint64 num)
+{
+    alc_error_t     err = ALC_ERROR_NONE;
+    ShaLane<Uint64> lanes[cMultiBufferBatch];
+    Impl*           pending[cMultiBufferBatch];
+    Uint64          num_pending = num;
+
+    for (Uint64 i = 0; i < num; i++) {
+        impls[i]->padChunk();
+        lanes[i]   = { impls[i]->m_state_flat, impls[i]->m_buffer, 1 };
+        pending[i] = impls[i];
+    }
+
+    err = absorbMulti(impls, lanes, num);
+
+    /*
+     * Squeeze a rate worth of output from every state, the ones that need
+     * more are permuted together for the next round
+     */
+    Uint64 hash_copied[cMultiBufferBatch] = {};
+    while (num_pending && !err) {
+        Uint64 count = 0;
+        for (Uint64 i = 0; i < num_pending; i++) {
+            Impl*  p_impl = pending[i];
+            Uint64 n      = std::min(p_impl->m_chunk_size,
+                                p_impl->m_hash_size - hash_copied[i]);
+            if (n) {
+                utils::CopyBlock(&p_impl->m_hash[hash_copied[i]],
+                                 (Uint8*)p_impl->m_state_flat,
+                                 n);
+            }
+            if (hash_copied[i] + n < p_impl->m_hash_size) {
+                hash_copied[count] = hash_copied[i] + n;
+                pending[count]     = p_impl;
+                lanes[count++]     = { p_impl->m_state_flat, cZeroBlock, 1 };
+            }
+        }
+        num_pending = count;
+        if (num_pending) {
+            err = absorbMulti(pending, lanes, num_pending);
+        }
+    }
+
+    for (Uint64 i = 0; i < num; i++) {
+        impls[i]->m_idx = 0;
+    }
+
+    return err;
+}
+
+alc_error_t
+Sha3::Impl::finalize(const Uint8* pBuf, Uint64 size)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+
+    if (pBuf && size) {
+        err = update(pBuf, size);
+    }
+
+    padChunk();
 
     if (err) {
         return err;
@@ -419,6 +671,13 @@ Sha3::Sha3(const alc_digest_info_t& rDigestInfo)
     , m_finished{ false }
 {}
 
+Sha3::Sha3(const Sha3& rSrc)
+    : Digest{ rSrc }
+    , m_pimpl{ rSrc.m_pimpl ? std::make_unique<Sha3::Impl>(*rSrc.m_pimpl)
+                            : nullptr }
+    , m_finished{ rSrc.m_finished }
+{}
+
 Sha3::~Sha3() {}
 
 alc_error_t
@@ -444,6 +703,76 @@ Sha3::update(const Uint8* pSrc, Uint64 size)
     return err;
 }
 
+alc_error_t
+Sha3::updateMulti(Sha3* const        digests[],
+                  const Uint8* const pSrc[],
+                  const Uint64       len[],
+                  Uint64             num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    Impl*       impls[cMultiBufferBatch];
+
+    if (digests == nullptr || pSrc == nullptr || len == nullptr) {
+        /* TODO: change to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+    for (Uint64 i = 0; i < num; i++) {
+        if (digests[i] == nullptr || pSrc[i] == nullptr
+            || digests[i]->m_finished || !digests[i]->m_pimpl) {
+            /* TODO: change to Status */
+            return ALC_ERROR_INVALID_ARG;
+        }
+    }
+
+    for (Uint64 base = 0; base < num && !err; base += cMultiBufferBatch) {
+        Uint64 count = std::min(num - base, cMultiBufferBatch);
+        for (Uint64 i = 0; i < count; i++) {
+            impls[i] = digests[base + i]->m_pimpl.get();
+        }
+        err = Impl::updateMulti(impls, pSrc + base, len + base, count);
+    }
+
+    return err;
+}
+
+alc_error_t
+Sha3::finalizeMulti(Sha3* const digests[], Uint64 num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    Impl*       impls[cMultiBufferBatch];
+    Uint64      count = 0;
+
+    if (digests == nullptr) {
+        /* TODO: change to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+    for (Uint64 i = 0; i < num; i++) {
+        if (digests[i] == nullptr) {
+            /* TODO: change to Status */
+            return ALC_ERROR_INVALID_ARG;
+        }
+    }
+
+    for (Uint64 i = 0; i < num && !err; i++) {
+        Sha3* p_digest = digests[i];
+        if (p_digest->m_finished || !p_digest->m_pimpl) {
+            continue;
+        }
+        impls[count++]       = p_digest->m_pimpl.get();
+        p_digest->m_finished = true;
+
+        if (count == cMultiBufferBatch) {
+            err   = Impl::finalizeMulti(impls, count);
+            count = 0;
+        }
+    }
+    if (count && !err) {
+        err = Impl::finalizeMulti(impls, count);
+    }
+
+    return err;
+}
+
 alc_error_t
 Sha3::finalize(const Uint8* pSrc, Uint64 size)
 {
@@ -477,6 +806,32 @@ Sha3::copyHash(Uint8* pHash, Uint64 size) const
     return err;
 }
 
+alc_error_t
+Sha3::copyState(const IDigest& rSrc)
+{
+    alc_error_t err   = ALC_ERROR_NONE;
+    auto        p_src = dynamic_cast<const Sha3*>(&rSrc);
+
+    if (p_src == nullptr || !p_src->m_pimpl || !m_pimpl) {
+        /* TODO: change to Status */
+        err = ALC_ERROR_INVALID_ARG;
+        return err;
+    }
+
+    err = m_pimpl->copyState(*p_src->m_pimpl);
+    if (!err) {
+        m_finished = p_src->m_finished;
+    }
+
+    return err;
+}
+
+IDigest*
+Sha3::clone() const
+{
+    return new Sha3(*this);
+}
+
 void
 Sha3::finish()
 {
@@ -27,6 +27,7 @@
  */
 
 #include "alcp/digest/sha2_384.hh"
+#include "alcp/digest/sha_mb.hh"
 #include "alcp/utils/copy.hh"
 
 namespace alcp::digest {
@@ -56,6 +57,11 @@ Sha384::Sha384()
     m_psha512 = std::make_shared<Sha512>(d_info);
 }
 
+Sha384::Sha384(const Sha384& rSrc)
+    : Sha2{ rSrc }
+    , m_psha512{ std::make_shared<Sha512>(*rSrc.m_psha512) }
+{}
+
 Sha384::~Sha384() = default;
 
 alc_error_t
@@ -64,6 +70,35 @@ Sha384::update(const Uint8* pBuf, Uint64 size)
     return m_psha512->update(pBuf, size);
 }
 
+alc_error_t
+Sha384::updateMulti(Sha384* const      digests[],
+                    const Uint8* const pSrc[],
+                    const Uint64       len[],
+                    Uint64             num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    Sha512*     inner[cMultiBufferBatch];
+
+    if (digests == nullptr || pSrc == nullptr || len == nullptr) {
+        /* TODO: Change this to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    for (Uint64 base = 0; base < num && !err; base += cMultiBufferBatch) {
+        Uint64 count = std::min(num - base, cMultiBufferBatch);
+        for (Uint64 i = 0; i < count; i++) {
+            if (digests[base + i] == nullptr) {
+                /* TODO: Change this to Status */
+                return ALC_ERROR_INVALID_ARG;
+            }
+            inner[i] = digests[base + i]->m_psha512.get();
+        }
+        err = Sha512::updateMulti(inner, pSrc + base, len + base, count);
+    }
+
+    return err;
+}
+
 void
 Sha384::finish()
 {
@@ -89,6 +124,25 @@ Sha384::copyHash(Uint8* pHash, Uint64 size) const
     return m_psha512->copyHash(pHash, size);
 }
 
+alc_error_t
+Sha384::copyState(const IDigest& rSrc)
+{
+    auto p_src = dynamic_cast<const Sha384*>(&rSrc);
+
+    if (p_src == nullptr) {
+        /* TODO: Change this to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    return m_psha512->copyState(*p_src->m_psha512);
+}
+
+IDigest*
+Sha384::clone() const
+{
+    return new Sha384(*this);
+}
+
 Uint64
 Sha384::getInputBlockSize()
 {
@@ -36,6 +36,7 @@
 #include "alcp/digest/sha_avx2.hh"
 #include "alcp/digest/sha_avx256.hh"
 #include "alcp/digest/sha_avx512.hh"
+#include "alcp/digest/sha_mb.hh"
 
 #include "alcp/utils/bits.hh"
 #include "alcp/utils/copy.hh"
@@ -48,6 +49,12 @@ using alcp::utils::CpuId;
 
 namespace alcp::digest {
 
+/*
+ * Fewest busy lanes for which a multi-buffer call beats hashing the
+ * remaining messages one by one
+ */
+static constexpr int cMinLanesAvx512 = 2, cMinLanesAvx2 = 3;
+
 /*
  * first 64 bits of the fractional parts of the square roots
  * of the first 8 primes 2..19
@@ -84,6 +91,11 @@ class Sha512::Impl
     alc_error_t copyHash(Uint8* pHashBuf, Uint64 size) const;
     Uint64      getHashSize();
 
+    static alc_error_t updateMulti(Impl* const        impls[],
+                                   const Uint8* const pSrc[],
+                                   const Uint64       len[],
+                                   Uint64             num);
+
   private:
     Uint64 m_msg_len;
     /* Any unprocessed bytes from last call to update() */
@@ -95,6 +107,8 @@ class Sha512::Impl
     const Uint64* m_Iv = nullptr;
     void          compressMsg(Uint64 w[]);
     alc_error_t   processChunk(const Uint8* pSrc, Uint64 len);
+    alc_error_t   absorbHead(const Uint8*& pSrc, Uint64& size);
+    void          absorbTail(const Uint8* pSrc, Uint64 size);
     Uint64        m_digest_len_bytes;
     Uint64        m_digest_len;
 };
@@ -136,6 +150,11 @@ Sha512::Sha512(const alc_digest_info_t& rDigestInfo)
     : Sha512(rDigestInfo.dt_len)
 {}
 
+Sha512::Sha512(const Sha512& rSrc)
+    : Sha2{ rSrc }
+    , m_pImpl{ std::make_unique<Sha512::Impl>(*rSrc.pImpl()) }
+{}
+
 Sha512::~Sha512() = default;
 
 alc_error_t
@@ -185,6 +204,29 @@ Sha512::copyHash(Uint8* pHash, Uint64 size) const
     return m_pImpl->copyHash(pHash, size);
 }
 
+alc_error_t
+Sha512::copyState(const IDigest& rSrc)
+{
+    auto p_src = dynamic_cast<const Sha512*>(&rSrc);
+
+    // SHA-512/224 and SHA-512/256 only differ from SHA-512 in the IV
+    if (p_src == nullptr
+        || p_src->m_pImpl->getHashSize() != m_pImpl->getHashSize()) {
+        /* TODO: change to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+
+    *pImpl() = *p_src->pImpl();
+
+    return ALC_ERROR_NONE;
+}
+
+IDigest*
+Sha512::clone() const
+{
+    return new Sha512(*this);
+}
+
 alc_error_t
 Sha512::Impl::copyHash(Uint8* pHash, Uint64 size) const
 {
@@ -326,8 +368,13 @@ Sha512::update(const Uint8* pSrc, Uint64 input_size)
     return m_pImpl->update(pSrc, input_size);
 }
 
+/*
+ * Takes the part of an update that goes through the internal buffer. On return
+ * either all of it is consumed (size == 0) or the buffer is empty and
+ * pSrc/size describe the rest of the input.
+ */
 alc_error_t
-Sha512::Impl::update(const Uint8* pSrc, Uint64 input_size)
+Sha512::Impl::absorbHead(const Uint8*& pSrc, Uint64& size)
 {
     alc_error_t err = ALC_ERROR_NONE;
 
@@ -340,7 +387,7 @@ Sha512::Impl::update(const Uint8* pSrc, Uint64 input_size)
      * input_size == 0 is valid in shani case
      * Returned hash is same as IV
      */
-    if (err || input_size == 0)
+    if (err || size == 0)
         return err;
 
     if (m_finished) {
@@ -349,40 +396,60 @@ Sha512::Impl::update(const Uint8* pSrc, Uint64 input_size)
         return err;
     }
 
-    m_msg_len += input_size;
+    m_msg_len += size;
 
-    Uint64 to_process = std::min((input_size + m_idx), cChunkSize);
-    if (to_process < cChunkSize) {
+    if (m_idx + size < cChunkSize) {
         /* copy them to internal buffer and return */
-        utils::CopyBlock(&m_buffer[m_idx], pSrc, input_size);
-        m_idx += input_size;
+        utils::CopyBlock(&m_buffer[m_idx], pSrc, size);
+        m_idx += size;
+        size = 0;
 
         return err;
     }
 
-    Uint64 idx = m_idx;
-
-    if (idx) {
+    if (m_idx) {
         /*
          * Last call to update(), had some unprocessed bytes which is part
          * of internal buffer, we process first block by copying from pSrc
          * the remaining bytes of a chunk.
          */
-        to_process = std::min(input_size, cChunkSize - idx);
-        utils::CopyBlock(&m_buffer[idx], pSrc, to_process);
+        Uint64 to_process = cChunkSize - m_idx;
+        utils::CopyBlock(&m_buffer[m_idx], pSrc, to_process);
 
         pSrc += to_process;
-        input_size -= to_process;
-        idx += to_process;
+        size -= to_process;
 
-        if (idx == cChunkSize) {
-            err = processChunk(m_buffer, cChunkSize);
-            idx = 0;
-        }
+        err   = processChunk(m_buffer, cChunkSize);
+        m_idx = 0;
     }
 
+    return err;
+}
+
+/*
+ * Leftover bytes of an update, less than a chunk, go to the internal buffer
+ */
+void
+Sha512::Impl::absorbTail(const Uint8* pSrc, Uint64 size)
+{
+    if (size) {
+        assert(size <= cChunkSize);
+
+        utils::CopyBlock(&m_buffer[m_idx], pSrc, size);
+        m_idx += size;
+    }
+}
+
+alc_error_t
+Sha512::Impl::update(const Uint8* pSrc, Uint64 input_size)
+{
+    alc_error_t err = absorbHead(pSrc, input_size);
+
+    if (err || input_size == 0)
+        return err;
+
     /* No of bytes that can be processed as Chunks */
-    to_process = input_size - (input_size & Sha512::cChunkSizeMask);
+    Uint64 to_process = input_size - (input_size & Sha512::cChunkSizeMask);
     if (to_process > 0) {
         err = processChunk(pSrc, to_process);
 
@@ -393,14 +460,111 @@ Sha512::Impl::update(const Uint8* pSrc, Uint64 input_size)
     /*
      * We still have some leftover bytes, copy them to internal buffer
      */
-    if (input_size) {
-        assert(input_size <= cChunkSize);
+    absorbTail(pSrc, input_size);
+
+    return err;
+}
+
+alc_error_t
+Sha512::Impl::updateMulti(Impl* const        impls[],
+                          const Uint8* const pSrc[],
+                          const Uint64       len[],
+                          Uint64             num)
+{
+    static bool avx512_available = CpuId::cpuHasAvx512(utils::AVX512_F);
+    static bool avx2_available   = CpuId::cpuHasAvx2();
+
+    alc_error_t     err = ALC_ERROR_NONE;
+    ShaLane<Uint64> lanes[cMultiBufferBatch];
+
+    for (Uint64 i = 0; i < num; i++) {
+        if (pSrc[i] == nullptr || (impls[i]->m_finished && len[i] != 0)) {
+            /* TODO: change to Status */
+            return ALC_ERROR_INVALID_ARG;
+        }
+    }
+
+    /*
+     * Buffered heads and tails are handled per message, the whole chunks in
+     * between are what gets interleaved
+     */
+    for (Uint64 i = 0; i < num; i++) {
+        const Uint8* p_src = pSrc[i];
+        Uint64       size  = len[i];
+
+        err = impls[i]->absorbHead(p_src, size);
+        if (err) {
+            return err;
+        }
+
+        Uint64 num_chunks = size / cChunkSize;
+        lanes[i]          = { impls[i]->m_hash, p_src, num_chunks };
+        impls[i]->absorbTail(p_src + num_chunks * cChunkSize,
+                             size - num_chunks * cChunkSize);
+    }
 
-        utils::CopyBlock(&m_buffer[idx], pSrc, input_size);
-        idx += input_size;
+    auto single = [&](Uint64 i, const Uint8* pBuf, Uint64 size) {
+        err = impls[i]->processChunk(pBuf, size);
+    };
+
+    if (avx512_available) {
+        ShaMultiBufferSchedule<Uint64, 8>(
+            lanes,
+            num,
+            cChunkSize,
+            cMinLanesAvx512,
+            [](Uint64** pHash, const Uint8** pBuf, Uint64 numBlocks) {
+                zen4::ShaUpdate512x8(pHash, pBuf, numBlocks);
+            },
+            single);
+    } else if (avx2_available) {
+        ShaMultiBufferSchedule<Uint64, 4>(
+            lanes,
+            num,
+            cChunkSize,
+            cMinLanesAvx2,
+            [](Uint64** pHash, const Uint8** pBuf, Uint64 numBlocks) {
+                avx2::ShaUpdate512x4(pHash, pBuf, numBlocks);
+            },
+            single);
+    } else {
+        for (Uint64 i = 0; i < num && !err; i++) {
+            if (lanes[i].numBlocks) {
+                single(i, lanes[i].pSrc, lanes[i].numBlocks * cChunkSize);
+            }
+        }
     }
 
-    m_idx = idx;
+    return err;
+}
+
+alc_error_t
+Sha512::updateMulti(Sha512* const      digests[],
+                    const Uint8* const pSrc[],
+                    const Uint64       len[],
+                    Uint64             num)
+{
+    alc_error_t err = ALC_ERROR_NONE;
+    Impl*       impls[cMultiBufferBatch];
+
+    if (digests == nullptr || pSrc == nullptr || len == nullptr) {
+        /* TODO: change to Status */
+        return ALC_ERROR_INVALID_ARG;
+    }
+    for (Uint64 i = 0; i < num; i++) {
+        if (digests[i] == nullptr) {
+            /* TODO: change to Status */
+            return ALC_ERROR_INVALID_ARG;
+        }
+    }
+
+    for (Uint64 base = 0; base < num && !err; base += cMultiBufferBatch) {
+        Uint64 count = std::min(num - base, cMultiBufferBatch);
+        for (Uint64 i = 0; i < count; i++) {
+            impls[i] = digests[base + i]->pImpl();
+        }
+        err = Impl::updateMulti(impls, pSrc + base, len + base, count);
+    }
 
     return err;
 }
@@ -26,9 +26,13 @@
  *
  */
 
+#include "alcp/digest.h"
 #include "alcp/digest/sha2.hh"
 #include "gtest/gtest.h"
 
+#include <cstring>
+#include <memory>
+
 namespace {
 using namespace std;
 using namespace alcp::digest;
@@ -170,4 +174,148 @@ TEST(Sha256Test, getHashSizeTest)
     EXPECT_EQ(sha256.getHashSize(), DigestSize);
 }
 
+TEST(Sha256Test, update_multi_matches_update_test)
+{
+    // Sub-block and multi-block messages, each split at an odd offset
+    const Uint64               cNum = 37;
+    vector<unique_ptr<Sha256>> multi, single;
+    vector<Sha256*>            p_multi;
+    vector<vector<Uint8>>      msgs(cNum);
+    vector<const Uint8*>       bufs(cNum);
+    vector<Uint64>             first(cNum), second(cNum);
+
+    for (Uint64 i = 0; i < cNum; i++) {
+        multi.push_back(make_unique<Sha256>());
+        single.push_back(make_unique<Sha256>());
+        p_multi.push_back(multi[i].get());
+
+        msgs[i].resize((i * 97) % 1100 + 1);
+        for (Uint64 j = 0; j < msgs[i].size(); j++) {
+            msgs[i][j] = static_cast<Uint8>(i * 31 + j);
+        }
+        first[i]  = (i * 13) % msgs[i].size();
+        second[i] = msgs[i].size() - first[i];
+        bufs[i]   = msgs[i].data();
+    }
+
+    ASSERT_EQ(
+        Sha256::updateMulti(p_multi.data(), bufs.data(), first.data(), cNum),
+        ALC_ERROR_NONE);
+    for (Uint64 i = 0; i < cNum; i++) {
+        bufs[i] = msgs[i].data() + first[i];
+    }
+    ASSERT_EQ(
+        Sha256::updateMulti(p_multi.data(), bufs.data(), second.data(), cNum),
+        ALC_ERROR_NONE);
+
+    for (Uint64 i = 0; i < cNum; i++) {
+        Uint8 hash_multi[DigestSize], hash_single[DigestSize];
+        ASSERT_EQ(single[i]->update(msgs[i].data(), msgs[i].size()),
+                  ALC_ERROR_NONE);
+        ASSERT_EQ(single[i]->finalize(nullptr, 0), ALC_ERROR_NONE);
+        ASSERT_EQ(multi[i]->finalize(nullptr, 0), ALC_ERROR_NONE);
+        ASSERT_EQ(single[i]->copyHash(hash_single, DigestSize), ALC_ERROR_NONE);
+        ASSERT_EQ(multi[i]->copyHash(hash_multi, DigestSize), ALC_ERROR_NONE);
+        EXPECT_EQ(0, memcmp(hash_single, hash_multi, DigestSize))
+            << "message " << i;
+    }
+}
+
+TEST(Sha256Test, update_multi_empty_buffer_test)
+{
+    // Empty messages may be NULL, as with alcp_digest_update of size 0
+    const Uint8 cMsg[] = { 'a', 'b', 'c' };
+
+    alc_digest_info_t info[3] = {};
+    info[0].dt_type           = ALC_DIGEST_TYPE_SHA2;
+    info[0].dt_len            = ALC_DIGEST_LEN_256;
+    info[0].dt_mode.dm_sha2   = ALC_SHA2_256;
+    info[1]                   = info[0];
+    info[2].dt_type           = ALC_DIGEST_TYPE_SHA3;
+    info[2].dt_len            = ALC_DIGEST_LEN_256;
+    info[2].dt_mode.dm_sha3   = ALC_SHA3_256;
+
+    vector<vector<Uint8>> contexts(3);
+    alc_digest_handle_t   handles[3];
+    alc_digest_handle_p   p_handles[3];
+    for (int i = 0; i < 3; i++) {
+        contexts[i].resize(alcp_digest_context_size(&info[i]));
+        handles[i].context = contexts[i].data();
+        p_handles[i]       = &handles[i];
+        ASSERT_EQ(alcp_digest_request(&info[i], &handles[i]), ALC_ERROR_NONE);
+    }
+
+    const Uint8* bufs[3]  = { cMsg, nullptr, nullptr };
+    Uint64       sizes[3] = { sizeof(cMsg), 0, 0 };
+    EXPECT_EQ(alcp_digest_update_multi(p_handles, bufs, sizes, 3),
+              ALC_ERROR_NONE);
+    sizes[1] = 1;
+    EXPECT_TRUE(
+        alcp_is_error(alcp_digest_update_multi(p_handles, bufs, sizes, 3)));
+
+    // The NULL updates left the sessions as they were
+    Uint8  hash[DigestSize], hash_ref[DigestSize];
+    Sha256 ref;
+    ASSERT_EQ(ref.finalize(nullptr, 0), ALC_ERROR_NONE);
+    ASSERT_EQ(ref.copyHash(hash_ref, DigestSize), ALC_ERROR_NONE);
+    ASSERT_EQ(alcp_digest_finalize(&handles[1], nullptr, 0), ALC_ERROR_NONE);
+    ASSERT_EQ(alcp_digest_copy(&handles[1], hash, DigestSize), ALC_ERROR_NONE);
+    EXPECT_EQ(0, memcmp(hash, hash_ref, DigestSize));
+
+    for (int i = 0; i < 3; i++) {
+        alcp_digest_finish(&handles[i]);
+    }
+}
+
+TEST(Sha256Test, update_multi_invalid_input_test)
+{
+    Sha256       digest;
+    Sha256*      p_digest = &digest;
+    const Uint8* p_src    = nullptr;
+    Uint64       len      = 0;
+    EXPECT_EQ(ALC_ERROR_INVALID_ARG,
+              Sha256::updateMulti(&p_digest, &p_src, &len, 1));
+}
+
+TEST(Sha256Test, copy_state_test)
+{
+    // A copy taken mid-message continues independently of the original
+    const Uint8 cPrefix[100] = { 1, 2, 3 };
+    const Uint8 cSuffix[]    = "abc";
+    Uint8       hash_copy[DigestSize], hash_clone[DigestSize];
+    Uint8       hash_ref[DigestSize];
+
+    Sha256 sha256, ref;
+    ASSERT_EQ(sha256.update(cPrefix, sizeof(cPrefix)), ALC_ERROR_NONE);
+
+    Sha256              copy(sha256);
+    unique_ptr<IDigest> clone(sha256.clone());
+    ASSERT_EQ(sha256.update(cSuffix, 1), ALC_ERROR_NONE);
+
+    ASSERT_EQ(copy.update(cSuffix, 3), ALC_ERROR_NONE);
+    ASSERT_EQ(copy.finalize(nullptr, 0), ALC_ERROR_NONE);
+    ASSERT_EQ(copy.copyHash(hash_copy, DigestSize), ALC_ERROR_NONE);
+
+    ASSERT_EQ(ref.copyState(sha256), ALC_ERROR_NONE);
+    ASSERT_EQ(clone->copyState(ref), ALC_ERROR_NONE);
+    ASSERT_EQ(clone->update(cSuffix + 1, 2), ALC_ERROR_NONE);
+    ASSERT_EQ(clone->finalize(nullptr, 0), ALC_ERROR_NONE);
+    ASSERT_EQ(clone->copyHash(hash_clone, DigestSize), ALC_ERROR_NONE);
+
+    Sha256 direct;
+    ASSERT_EQ(direct.update(cPrefix, sizeof(cPrefix)), ALC_ERROR_NONE);
+    ASSERT_EQ(direct.finalize(cSuffix, 3), ALC_ERROR_NONE);
+    ASSERT_EQ(direct.copyHash(hash_ref, DigestSize), ALC_ERROR_NONE);
+
+    EXPECT_EQ(0, memcmp(hash_copy, hash_ref, DigestSize));
+    EXPECT_EQ(0, memcmp(hash_clone, hash_ref, DigestSize));
+}
+
+TEST(Sha256Test, copy_state_invalid_input_test)
+{
+    Sha256 sha256;
+    Sha224 sha224;
+    EXPECT_EQ(ALC_ERROR_INVALID_ARG, sha256.copyState(sha224));
+}
+
 } // namespace
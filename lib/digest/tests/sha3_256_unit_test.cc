@@ -29,6 +29,7 @@
 #include "alcp/digest/sha3.hh"
 #include "gtest/gtest.h"
 
+#include <cstring>
 #include <fstream>
 
 namespace {
@@ -163,4 +164,31 @@ TEST(Sha3_256, setShakeLengthTest)
     EXPECT_NE(sha3_256.getHashSize(), cShakeLength);
 }
 
+TEST(Sha3_256, copy_state_test)
+{
+    const Uint8 cMsg[300] = { 9 };
+    Uint8       hash_copy[DigestSize], hash_ref[DigestSize];
+
+    Sha3 sha3_256(DigestInfo);
+    ASSERT_EQ(sha3_256.update(cMsg, 150), ALC_ERROR_NONE);
+    Sha3 copy(sha3_256);
+    ASSERT_EQ(copy.finalize(cMsg + 150, 150), ALC_ERROR_NONE);
+    ASSERT_EQ(copy.copyHash(hash_copy, DigestSize), ALC_ERROR_NONE);
+
+    ASSERT_EQ(sha3_256.finalize(cMsg + 150, 150), ALC_ERROR_NONE);
+    ASSERT_EQ(sha3_256.copyHash(hash_ref, DigestSize), ALC_ERROR_NONE);
+    EXPECT_EQ(0, memcmp(hash_copy, hash_ref, DigestSize));
+
+    alc_digest_info_t info_512 = DigestInfo;
+    info_512.dt_len            = ALC_DIGEST_LEN_512;
+    info_512.dt_mode.dm_sha3   = ALC_SHA3_512;
+    Sha3 sha3_512(info_512), other(DigestInfo);
+    EXPECT_EQ(ALC_ERROR_INVALID_ARG, sha3_512.copyState(sha3_256));
+
+    // A finalized state copies over, hash included
+    ASSERT_EQ(other.copyState(sha3_256), ALC_ERROR_NONE);
+    ASSERT_EQ(other.copyHash(hash_copy, DigestSize), ALC_ERROR_NONE);
+    EXPECT_EQ(0, memcmp(hash_copy, hash_ref, DigestSize));
+}
+
 } // namespace
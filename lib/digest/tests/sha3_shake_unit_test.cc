@@ -27,9 +27,12 @@
  */
 
 #include "alcp/digest/sha3.hh"
+#include "alcp/digest/sha_mb.hh"
+#include "alcp/utils/cpuid.hh"
 #include "gtest/gtest.h"
 
 #include <fstream>
+#include <memory>
 
 namespace {
 using namespace std;
@@ -355,4 +358,140 @@ TEST_P(Shake, setShakeLength_digest_generation_test)
     }
 }
 
+TEST(Shake, avx512_kernel_matches_scalar_test)
+{
+    if (!alcp::utils::CpuId::cpuHasAvx512(alcp::utils::AVX512_F)) {
+        GTEST_SKIP() << "AVX512 not supported";
+    }
+    // Every SHA3/SHAKE rate, several blocks absorbed and multi-block squeezes
+    for (const Uint64 chunk_size : { 72, 104, 136, 144, 168 }) {
+        for (Uint64 num_chunks = 1; num_chunks <= 3; num_chunks++) {
+            Uint64 state_ref[25], state_avx512[25];
+            Uint64 msg[21 * 3];
+            for (int i = 0; i < 25; i++) {
+                state_ref[i] = state_avx512[i] =
+                    0x9e3779b97f4a7c15ULL * (i + 1);
+            }
+            for (Uint64 i = 0; i < 21 * 3; i++) {
+                msg[i] = 0xbf58476d1ce4e5b9ULL * (i + chunk_size);
+            }
+
+            zen3::Sha3Update(
+                state_ref, msg, chunk_size * num_chunks, chunk_size);
+            zen4::Sha3Update(
+                state_avx512, msg, chunk_size * num_chunks, chunk_size);
+            EXPECT_EQ(0, memcmp(state_ref, state_avx512, sizeof(state_ref)));
+
+            Uint64        hash_size = chunk_size * num_chunks + 5;
+            vector<Uint8> hash_ref(hash_size), hash_avx512(hash_size);
+            zen3::Sha3Finalize(reinterpret_cast<Uint8*>(state_ref),
+                               hash_ref.data(),
+                               hash_size,
+                               chunk_size);
+            zen4::Sha3Finalize(reinterpret_cast<Uint8*>(state_avx512),
+                               hash_avx512.data(),
+                               hash_size,
+                               chunk_size);
+            EXPECT_EQ(hash_ref, hash_avx512);
+        }
+    }
+}
+
+
+TEST(Shake, batched_kernels_match_scalar_test)
+{
+    const Uint64 cNumChunks = 3;
+    for (const Uint64 chunk_size : { 72, 104, 136, 144, 168 }) {
+        Uint64       state_ref[8][25], state_batch[8][25];
+        Uint64       msg[8][21 * cNumChunks];
+        Uint64*      p_state[8];
+        const Uint8* p_src[8];
+        for (int l = 0; l < 8; l++) {
+            for (int i = 0; i < 25; i++) {
+                state_ref[l][i] = state_batch[l][i] =
+                    0x9e3779b97f4a7c15ULL * (i + 1 + 25 * l);
+            }
+            for (Uint64 i = 0; i < 21 * cNumChunks; i++) {
+                msg[l][i] = 0xbf58476d1ce4e5b9ULL * (i + chunk_size + l);
+            }
+            zen3::Sha3Update(
+                state_ref[l], msg[l], chunk_size * cNumChunks, chunk_size);
+            p_state[l] = state_batch[l];
+            p_src[l]   = reinterpret_cast<const Uint8*>(msg[l]);
+        }
+
+        if (alcp::utils::CpuId::cpuHasAvx512(alcp::utils::AVX512_F)) {
+            zen4::Sha3UpdateX8(p_state, p_src, cNumChunks, chunk_size);
+        } else if (alcp::utils::CpuId::cpuHasAvx2()) {
+            avx2::Sha3UpdateX4(p_state, p_src, cNumChunks, chunk_size);
+            avx2::Sha3UpdateX4(p_state + 4, p_src + 4, cNumChunks, chunk_size);
+        } else {
+            GTEST_SKIP() << "AVX2 not supported";
+        }
+        EXPECT_EQ(0, memcmp(state_ref, state_batch, sizeof(state_ref)))
+            << "chunk size " << chunk_size;
+    }
+}
+
+TEST(Shake, update_finalize_multi_matches_single_test)
+{
+    // Both rates interleaved, outputs from empty up to several squeezes
+    const Uint64             cNum = 29;
+    vector<unique_ptr<Sha3>> multi, single;
+    vector<Sha3*>            p_multi;
+    vector<vector<Uint8>>    msgs(cNum);
+    vector<const Uint8*>     bufs(cNum);
+    vector<Uint64>           first(cNum), second(cNum), hash_size(cNum);
+
+    for (Uint64 i = 0; i < cNum; i++) {
+        DigestInfoShake.dt_mode.dm_sha3 =
+            (i % 3 == 0 ? ALC_SHAKE_256 : ALC_SHAKE_128);
+        DigestInfoShake.dt_custom_len = 0;
+        multi.push_back(make_unique<Sha3>(DigestInfoShake));
+        single.push_back(make_unique<Sha3>(DigestInfoShake));
+        p_multi.push_back(multi[i].get());
+
+        hash_size[i] = (i * 53) % 700;
+        ASSERT_EQ(multi[i]->setShakeLength(hash_size[i]), ALC_ERROR_NONE);
+        ASSERT_EQ(single[i]->setShakeLength(hash_size[i]), ALC_ERROR_NONE);
+
+        msgs[i].resize((i * 97) % 1100 + 1);
+        for (Uint64 j = 0; j < msgs[i].size(); j++) {
+            msgs[i][j] = static_cast<Uint8>(i * 31 + j);
+        }
+        first[i]  = (i * 13) % msgs[i].size();
+        second[i] = msgs[i].size() - first[i];
+        bufs[i]   = msgs[i].data();
+    }
+
+    ASSERT_EQ(
+        Sha3::updateMulti(p_multi.data(), bufs.data(), first.data(), cNum),
+        ALC_ERROR_NONE);
+    for (Uint64 i = 0; i < cNum; i++) {
+        bufs[i] = msgs[i].data() + first[i];
+    }
+    ASSERT_EQ(
+        Sha3::updateMulti(p_multi.data(), bufs.data(), second.data(), cNum),
+        ALC_ERROR_NONE);
+    ASSERT_EQ(Sha3::finalizeMulti(p_multi.data(), cNum), ALC_ERROR_NONE);
+
+    for (Uint64 i = 0; i < cNum; i++) {
+        // one spare byte keeps data() valid for an empty output
+        vector<Uint8> hash_multi(hash_size[i] + 1);
+        vector<Uint8> hash_single(hash_size[i] + 1);
+        ASSERT_EQ(single[i]->update(msgs[i].data(), msgs[i].size()),
+                  ALC_ERROR_NONE);
+        ASSERT_EQ(single[i]->finalize(nullptr, 0), ALC_ERROR_NONE);
+        ASSERT_EQ(single[i]->copyHash(hash_single.data(), hash_size[i]),
+                  ALC_ERROR_NONE);
+        ASSERT_EQ(multi[i]->copyHash(hash_multi.data(), hash_size[i]),
+                  ALC_ERROR_NONE);
+        EXPECT_EQ(hash_single, hash_multi) << "message " << i;
+    }
+
+    // Finalized digests accept no more input
+    EXPECT_EQ(ALC_ERROR_INVALID_ARG,
+              Sha3::updateMulti(p_multi.data(), bufs.data(), second.data(), 1));
+}
+
 } // namespace
@@ -28,6 +28,9 @@
 
 #include "alcp/digest/sha2_512.hh"
 #include "gtest/gtest.h"
+
+#include <cstring>
+#include <memory>
 #include <unordered_map>
 
 namespace {
@@ -222,4 +225,81 @@ TEST(Sha512Test, Sha512_256_getHashSizeTest)
     EXPECT_EQ(sha512.getHashSize() * 8, 256U);
 }
 
+TEST(Sha512Test, update_multi_matches_update_test)
+{
+    // Sub-block and multi-block messages, each split at an odd offset
+    const Uint64               cNum = 37;
+    vector<unique_ptr<Sha512>> multi, single;
+    vector<Sha512*>            p_multi;
+    vector<vector<Uint8>>      msgs(cNum);
+    vector<const Uint8*>       bufs(cNum);
+    vector<Uint64>             first(cNum), second(cNum);
+
+    for (Uint64 i = 0; i < cNum; i++) {
+        multi.push_back(make_unique<Sha512>());
+        single.push_back(make_unique<Sha512>());
+        p_multi.push_back(multi[i].get());
+
+        msgs[i].resize((i * 97) % 1100 + 1);
+        for (Uint64 j = 0; j < msgs[i].size(); j++) {
+            msgs[i][j] = static_cast<Uint8>(i * 31 + j);
+        }
+        first[i]  = (i * 13) % msgs[i].size();
+        second[i] = msgs[i].size() - first[i];
+        bufs[i]   = msgs[i].data();
+    }
+
+    ASSERT_EQ(
+        Sha512::updateMulti(p_multi.data(), bufs.data(), first.data(), cNum),
+        ALC_ERROR_NONE);
+    for (Uint64 i = 0; i < cNum; i++) {
+        bufs[i] = msgs[i].data() + first[i];
+    }
+    ASSERT_EQ(
+        Sha512::updateMulti(p_multi.data(), bufs.data(), second.data(), cNum),
+        ALC_ERROR_NONE);
+
+    for (Uint64 i = 0; i < cNum; i++) {
+        Uint8 hash_multi[DigestSize], hash_single[DigestSize];
+        ASSERT_EQ(single[i]->update(msgs[i].data(), msgs[i].size()),
+                  ALC_ERROR_NONE);
+        ASSERT_EQ(single[i]->finalize(nullptr, 0), ALC_ERROR_NONE);
+        ASSERT_EQ(multi[i]->finalize(nullptr, 0), ALC_ERROR_NONE);
+        ASSERT_EQ(single[i]->copyHash(hash_single, DigestSize), ALC_ERROR_NONE);
+        ASSERT_EQ(multi[i]->copyHash(hash_multi, DigestSize), ALC_ERROR_NONE);
+        EXPECT_EQ(0, memcmp(hash_single, hash_multi, DigestSize))
+            << "message " << i;
+    }
+}
+
+TEST(Sha512Test, update_multi_invalid_input_test)
+{
+    Sha512       digest;
+    Sha512*      p_digest = &digest;
+    const Uint8* p_src    = nullptr;
+    Uint64       len      = 0;
+    EXPECT_EQ(ALC_ERROR_INVALID_ARG,
+              Sha512::updateMulti(&p_digest, &p_src, &len, 1));
+}
+
+TEST(Sha512Test, copy_state_test)
+{
+    const Uint8 cMsg[300] = { 7 };
+    Uint8       hash_copy[DigestSize], hash_ref[DigestSize];
+
+    Sha512 sha512;
+    ASSERT_EQ(sha512.update(cMsg, 200), ALC_ERROR_NONE);
+    Sha512 copy(sha512);
+    ASSERT_EQ(copy.finalize(cMsg + 200, 100), ALC_ERROR_NONE);
+    ASSERT_EQ(copy.copyHash(hash_copy, DigestSize), ALC_ERROR_NONE);
+
+    ASSERT_EQ(sha512.finalize(cMsg + 200, 100), ALC_ERROR_NONE);
+    ASSERT_EQ(sha512.copyHash(hash_ref, DigestSize), ALC_ERROR_NONE);
+    EXPECT_EQ(0, memcmp(hash_copy, hash_ref, DigestSize));
+
+    // Truncated variants have their own IV and cannot take this state
+    Sha512 sha512_256(ALC_DIGEST_LEN_256);
+    EXPECT_EQ(ALC_ERROR_INVALID_ARG, sha512_256.copyState(sha512));
+}
+
 } // namespace
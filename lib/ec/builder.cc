@@ -31,6 +31,7 @@
 
 #include "alcp/ec.hh"
 #include "alcp/ec/ecdh.hh"
+#include "alcp/ec/eddsa.hh"
 
 namespace alcp::ec {
 
@@ -63,6 +64,57 @@ __ec_getSecretKey_wrapper(void*        pEc,
     return ap->computeSecretKey(pSecretKey, pPublicKey, pKeyLength);
 }
 
+template<typename ECTYPE>
+static Status
+__ec_getSecretKeyBatch_wrapper(void*        pEc,
+                               Uint8*       pSecretKeys,
+                               const Uint8* pPrivKeys,
+                               const Uint8* pPublicKeys,
+                               Uint64       count)
+{
+    auto ap = static_cast<ECTYPE*>(pEc);
+    return ap->computeSecretKeyBatch(
+        pSecretKeys, pPrivKeys, pPublicKeys, count);
+}
+
+template<typename ECTYPE>
+static Status
+__ec_sign_wrapper(void*        pEc,
+                  const Uint8* pDigest,
+                  Uint64       digestSize,
+                  Uint8*       pSignature)
+{
+    auto ap = static_cast<ECTYPE*>(pEc);
+    return ap->sign(pDigest, digestSize, pSignature);
+}
+
+template<typename ECTYPE>
+static Status
+__ec_verify_wrapper(void*        pEc,
+                    const Uint8* pDigest,
+                    Uint64       digestSize,
+                    const Uint8* pSignature,
+                    const Uint8* pPublicKey)
+{
+    auto ap = static_cast<ECTYPE*>(pEc);
+    return ap->verify(pDigest, digestSize, pSignature, pPublicKey);
+}
+
+template<typename ECTYPE>
+static Status
+__ec_verifyBatch_wrapper(void*              pEc,
+                         const Uint8* const pMessages[],
+                         const Uint64       pMessageSizes[],
+                         const Uint8* const pSignatures[],
+                         const Uint8* const pPublicKeys[],
+                         Uint64             count,
+                         bool               pValid[])
+{
+    auto ap = static_cast<ECTYPE*>(pEc);
+    return ap->verifyBatch(
+        pMessages, pMessageSizes, pSignatures, pPublicKeys, count, pValid);
+}
+
 template<typename ECTYPE>
 static Status
 __ec_dtor(void* pEc)
@@ -92,11 +144,15 @@ class x25519Builder
         auto algo = new (addr) X25519();
         rCtx.m_ec = static_cast<void*>(algo);
 
-        rCtx.setPrivateKey = __ec_setPrivateKey_wrapper<X25519>;
-        rCtx.getPublicKey  = __ec_getPublicKey_wrapper<X25519>;
-        rCtx.getSecretKey  = __ec_getSecretKey_wrapper<X25519>;
-        rCtx.finish        = __ec_dtor<X25519>;
-        rCtx.reset         = __ec_reset_wrapper<X25519>;
+        rCtx.setPrivateKey     = __ec_setPrivateKey_wrapper<X25519>;
+        rCtx.getPublicKey      = __ec_getPublicKey_wrapper<X25519>;
+        rCtx.getSecretKey      = __ec_getSecretKey_wrapper<X25519>;
+        rCtx.getSecretKeyBatch = __ec_getSecretKeyBatch_wrapper<X25519>;
+        rCtx.sign              = nullptr;
+        rCtx.verify            = nullptr;
+        rCtx.verifyBatch       = nullptr;
+        rCtx.finish            = __ec_dtor<X25519>;
+        rCtx.reset             = __ec_reset_wrapper<X25519>;
         return StatusOk();
     }
 };
@@ -110,11 +166,81 @@ class p256Builder
         auto algo = new (addr) P256(); // FIXME: Placement New is Depriciated
         rCtx.m_ec = static_cast<void*>(algo);
 
-        rCtx.setPrivateKey = __ec_setPrivateKey_wrapper<P256>;
-        rCtx.getPublicKey  = __ec_getPublicKey_wrapper<P256>;
-        rCtx.getSecretKey  = __ec_getSecretKey_wrapper<P256>;
-        rCtx.finish        = __ec_dtor<P256>;
-        rCtx.reset         = __ec_reset_wrapper<P256>;
+        rCtx.setPrivateKey     = __ec_setPrivateKey_wrapper<P256>;
+        rCtx.getPublicKey      = __ec_getPublicKey_wrapper<P256>;
+        rCtx.getSecretKey      = __ec_getSecretKey_wrapper<P256>;
+        rCtx.getSecretKeyBatch = nullptr;
+        rCtx.sign              = __ec_sign_wrapper<P256>;
+        rCtx.verify            = __ec_verify_wrapper<P256>;
+        rCtx.verifyBatch       = nullptr;
+        rCtx.finish            = __ec_dtor<P256>;
+        rCtx.reset             = __ec_reset_wrapper<P256>;
+        return StatusOk();
+    }
+};
+
+class p384Builder
+{
+  public:
+    static Status Build(const alc_ec_info_t& rEcInfo, Context& rCtx)
+    {
+        auto addr = reinterpret_cast<Uint8*>(&rCtx) + sizeof(rCtx);
+        auto algo = new (addr) P384();
+        rCtx.m_ec = static_cast<void*>(algo);
+
+        rCtx.setPrivateKey     = __ec_setPrivateKey_wrapper<P384>;
+        rCtx.getPublicKey      = __ec_getPublicKey_wrapper<P384>;
+        rCtx.getSecretKey      = __ec_getSecretKey_wrapper<P384>;
+        rCtx.getSecretKeyBatch = nullptr;
+        rCtx.sign              = __ec_sign_wrapper<P384>;
+        rCtx.verify            = __ec_verify_wrapper<P384>;
+        rCtx.verifyBatch       = nullptr;
+        rCtx.finish            = __ec_dtor<P384>;
+        rCtx.reset             = __ec_reset_wrapper<P384>;
+        return StatusOk();
+    }
+};
+
+class p521Builder
+{
+  public:
+    static Status Build(const alc_ec_info_t& rEcInfo, Context& rCtx)
+    {
+        auto addr = reinterpret_cast<Uint8*>(&rCtx) + sizeof(rCtx);
+        auto algo = new (addr) P521();
+        rCtx.m_ec = static_cast<void*>(algo);
+
+        rCtx.setPrivateKey     = __ec_setPrivateKey_wrapper<P521>;
+        rCtx.getPublicKey      = __ec_getPublicKey_wrapper<P521>;
+        rCtx.getSecretKey      = __ec_getSecretKey_wrapper<P521>;
+        rCtx.getSecretKeyBatch = nullptr;
+        rCtx.sign              = __ec_sign_wrapper<P521>;
+        rCtx.verify            = __ec_verify_wrapper<P521>;
+        rCtx.verifyBatch       = nullptr;
+        rCtx.finish            = __ec_dtor<P521>;
+        rCtx.reset             = __ec_reset_wrapper<P521>;
+        return StatusOk();
+    }
+};
+
+class ed25519Builder
+{
+  public:
+    static Status Build(const alc_ec_info_t& rEcInfo, Context& rCtx)
+    {
+        auto addr = reinterpret_cast<Uint8*>(&rCtx) + sizeof(rCtx);
+        auto algo = new (addr) Ed25519();
+        rCtx.m_ec = static_cast<void*>(algo);
+
+        rCtx.setPrivateKey     = __ec_setPrivateKey_wrapper<Ed25519>;
+        rCtx.getPublicKey      = __ec_getPublicKey_wrapper<Ed25519>;
+        rCtx.getSecretKey      = nullptr;
+        rCtx.getSecretKeyBatch = nullptr;
+        rCtx.sign              = __ec_sign_wrapper<Ed25519>;
+        rCtx.verify            = __ec_verify_wrapper<Ed25519>;
+        rCtx.verifyBatch       = __ec_verifyBatch_wrapper<Ed25519>;
+        rCtx.finish            = __ec_dtor<Ed25519>;
+        rCtx.reset             = __ec_reset_wrapper<Ed25519>;
         return StatusOk();
     }
 };
@@ -129,6 +255,15 @@ EcBuilder::getSize(const alc_ec_info_t& rEcInfo)
         case ALCP_EC_SECP256R1:
             return sizeof(P256); // return sizeof(Sha3);
             break;
+        case ALCP_EC_SECP384R1:
+            return sizeof(P384);
+            break;
+        case ALCP_EC_SECP521R1:
+            return sizeof(P521);
+            break;
+        case ALCP_EC_ED25519:
+            return sizeof(Ed25519);
+            break;
         default:
             return 0;
     }
@@ -146,6 +281,15 @@ EcBuilder::Build(const alc_ec_info_t& rEcInfo, Context& rCtx)
         case ALCP_EC_SECP256R1:
             status = p256Builder::Build(rEcInfo, rCtx);
             break;
+        case ALCP_EC_SECP384R1:
+            status = p384Builder::Build(rEcInfo, rCtx);
+            break;
+        case ALCP_EC_SECP521R1:
+            status = p521Builder::Build(rEcInfo, rCtx);
+            break;
+        case ALCP_EC_ED25519:
+            status = ed25519Builder::Build(rEcInfo, rCtx);
+            break;
         default:
             status = Status(GenericError(ErrorCode::eNotImplemented),
                             "Curve not implemented");
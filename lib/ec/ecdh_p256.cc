@@ -26,61 +26,193 @@
  *
  */
 
-#include <iostream>
-#include <openssl/ec.h>
-#include <openssl/err.h>
-#include <openssl/param_build.h>
+#include <immintrin.h>
+#include <memory>
 
 #include "alcp/ec/ecdh.hh"
+#include "alcp/ec/ecdh_zen.hh"
+#include "alcp/ec/ecdh_zen3.hh"
+#include "alcp/ec/ecdsa.hh"
 #include "alcp/utils/copy.hh"
+#include "alcp/utils/cpuid.hh"
+
+/*
+ * Reference build of the P-256 arithmetic for CPUs without MULX / ADX, the
+ * intrinsics are replaced by their portable equivalents
+ */
+static inline unsigned long long
+MulReference(unsigned long long  a,
+             unsigned long long  b,
+             unsigned long long* hi)
+{
+    __uint128_t res = static_cast<__uint128_t>(a) * b;
+    *hi             = static_cast<unsigned long long>(res >> 64);
+    return static_cast<unsigned long long>(res);
+}
+
+#define _mulx_u64(a, b, hi)          MulReference(a, b, hi)
+#define _addcarryx_u64(c, a, b, res) _addcarry_u64(c, a, b, res)
+#define ALCP_P256_PORTABLE
+
+namespace alcp::ec { namespace reference {
+#include "p256.cc.inc"
+}} // namespace alcp::ec::reference
+
+#undef _mulx_u64
+#undef _addcarryx_u64
+#undef ALCP_P256_PORTABLE
 
-using alcp::utils::CopyBytes;
-static constexpr Uint32 KeySize = 32;
 namespace alcp::ec {
+
+using alcp::utils::CpuId;
+static constexpr Uint32 KeySize = 32;
+
+// group order, big endian
+static constexpr Uint8 Order[KeySize] = {
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17,
+    0x9e, 0x84, 0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x51
+};
+
+// the group order for the ECDSA scalar arithmetic
+static constexpr weierstrass::Modulus<4> OrderModulus = {
+    { 0xf3b9cac2fc632551, 0xbce6faada7179e84, 0xffffffffffffffff,
+      0xffffffff00000000 },
+    0xccd1c8aaee00bc4f,
+    { 0x83244c95be79eea2, 0x4699799c49bd6fa6, 0x2845b2392b6bec59,
+      0x66e12d94f3d95620 },
+    { 0x0c46353d039cdaaf, 0x4319055258e8617b, 0x0000000000000000,
+      0x00000000ffffffff },
+};
+
+enum class P256Kernel
+{
+    eZen3,
+    eZen,
+    eReference,
+};
+
+// MULX / ADX kernels when both are present, chosen once
+static P256Kernel
+GetKernel()
+{
+    static const P256Kernel kernel = [] {
+        if (!CpuId::cpuHasAdx() || !CpuId::cpuHasBmi2()) {
+            return P256Kernel::eReference;
+        }
+        if (CpuId::cpuIsZen3() || CpuId::cpuIsZen4()) {
+            return P256Kernel::eZen3;
+        }
+        return P256Kernel::eZen;
+    }();
+    return kernel;
+}
+
+// 0 < key < n, without branching on the key
+static bool
+IsValidPrivateKey(const Uint8* pPrivKey)
+{
+    Uint32 borrow = 0, any = 0;
+    for (Int32 i = KeySize - 1; i >= 0; i--) {
+        borrow = (static_cast<Uint32>(pPrivKey[i]) - Order[i] - borrow) >> 31;
+        any |= pPrivKey[i];
+    }
+    return borrow & (any != 0);
+}
+
+static void
+BaseMulX(Uint8* pX, const Uint8* pScalar)
+{
+    Uint8 point[KeySize * 2];
+    switch (GetKernel()) {
+        case P256Kernel::eZen3:
+            zen3::AlcpScalarPubP256(point, pScalar);
+            break;
+        case P256Kernel::eZen:
+            zen::AlcpScalarPubP256(point, pScalar);
+            break;
+        default:
+            reference::AlcpScalarPubP256(point, pScalar);
+            break;
+    }
+    alcp::utils::CopyBytes(pX, point, KeySize);
+}
+
+static bool
+DoubleMulX(Uint8*       pX,
+           const Uint8* pU1,
+           const Uint8* pU2,
+           const Uint8* pPublicKey)
+{
+    switch (GetKernel()) {
+        case P256Kernel::eZen3:
+            return zen3::AlcpDoubleScalarMulP256(pX, pU1, pU2, pPublicKey);
+        case P256Kernel::eZen:
+            return zen::AlcpDoubleScalarMulP256(pX, pU1, pU2, pPublicKey);
+        default:
+            return reference::AlcpDoubleScalarMulP256(
+                pX, pU1, pU2, pPublicKey);
+    }
+}
+
+static void
+OrderInverse(Uint64 r[4], const Uint64 a[4])
+{
+    switch (GetKernel()) {
+        case P256Kernel::eZen3:
+            zen3::AlcpOrderInverseP256(r, a);
+            break;
+        case P256Kernel::eZen:
+            zen::AlcpOrderInverseP256(r, a);
+            break;
+        default:
+            reference::AlcpOrderInverseP256(r, a);
+            break;
+    }
+}
+
+static const EcdsaCurve<4> SignatureCurve = {
+    &OrderModulus, 256, KeySize, BaseMulX, DoubleMulX, OrderInverse
+};
+
+P256::P256() = default;
+
+P256::~P256()
+{
+    reset();
+}
+
 Status
 P256::setPrivateKey(const Uint8* pPrivKey)
 {
-    Status          s                = StatusOk();
-    OSSL_PARAM_BLD* p_param_bld_priv = {};
-    OSSL_PARAM*     p_params         = {};
-    EVP_PKEY_CTX*   p_ctx_priv       = {};
-    // FIXME: Possibility of Read Beyond allocated
-    CopyBytes(m_PrivKey, pPrivKey, sizeof(m_PrivKey));
-
-    BIGNUM* p_priv = BN_bin2bn(m_PrivKey, sizeof(m_PrivKey), NULL);
-
-    p_param_bld_priv = OSSL_PARAM_BLD_new();
-    if (p_priv != NULL && p_param_bld_priv != NULL
-        && OSSL_PARAM_BLD_push_utf8_string(
-            p_param_bld_priv, "group", "prime256v1", 0)
-        && OSSL_PARAM_BLD_push_BN(p_param_bld_priv, "priv", p_priv))
-        p_params = OSSL_PARAM_BLD_to_param(p_param_bld_priv);
-
-    p_ctx_priv = EVP_PKEY_CTX_new_from_name(NULL, "EC", NULL);
-    if (p_ctx_priv == NULL || p_params == NULL
-        || EVP_PKEY_fromdata_init(p_ctx_priv) <= 0
-        || EVP_PKEY_fromdata(
-               p_ctx_priv, &m_pSelfKey, EVP_PKEY_KEYPAIR, p_params)
-               <= 0) {
-        ERR_print_errors_fp(stderr);
-        s.update(status::InternalError("PKEY Error!"));
+    if (!IsValidPrivateKey(pPrivKey)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Invalid private key");
     }
-
-    OSSL_PARAM_free(p_params);
-    BN_free(p_priv);
-    OSSL_PARAM_BLD_free(p_param_bld_priv);
-    EVP_PKEY_CTX_free(p_ctx_priv);
-    return s;
+    alcp::utils::CopyBytes(m_PrivKey, pPrivKey, KeySize);
+    return StatusOk();
 }
 
 Status
 P256::generatePublicKey(Uint8* pPublicKey, const Uint8* pPrivKey)
 {
-    // To be implemented
-    Status s = StatusOk();
-    s.update(
-        status::NotImplemented("This functionality is yet to be implemented!"));
-    return s;
+    Status status = setPrivateKey(pPrivKey);
+    if (!status.ok()) {
+        return status;
+    }
+
+    switch (GetKernel()) {
+        case P256Kernel::eZen3:
+            zen3::AlcpScalarPubP256(pPublicKey, m_PrivKey);
+            break;
+        case P256Kernel::eZen:
+            zen::AlcpScalarPubP256(pPublicKey, m_PrivKey);
+            break;
+        default:
+            reference::AlcpScalarPubP256(pPublicKey, m_PrivKey);
+            break;
+    }
+    return status;
 }
 
 Status
@@ -88,83 +220,75 @@ P256::computeSecretKey(Uint8*       pSecretKey,
                        const Uint8* pPublicKey,
                        Uint64*      pKeyLength)
 {
-    Status             s               = StatusOk();
-    OSSL_PARAM_BLD*    p_param_bld_pub = {};
-    OSSL_PARAM*        p_params        = {};
-    EVP_PKEY_CTX*      p_ctx_pub       = {};
-    std::vector<Uint8> pub_key(32 * 2 + 1); // 2 Points x and y of 32 bytes each
-    EVP_PKEY_CTX*      p_key_derivation_ctx = {};
-
-    pub_key.at(0) = 0x04; // 0x04 is UNCOMPRESSED_POINT format
-    CopyBytes(&pub_key.at(1), pPublicKey, pub_key.size() - 1);
-
-    p_param_bld_pub = OSSL_PARAM_BLD_new();
-    if (p_param_bld_pub != NULL
-        && OSSL_PARAM_BLD_push_utf8_string(
-            p_param_bld_pub, "group", "prime256v1", 0)
-        && OSSL_PARAM_BLD_push_octet_string(
-            p_param_bld_pub, "pub", &pub_key.at(0), pub_key.size()))
-        p_params = OSSL_PARAM_BLD_to_param(p_param_bld_pub);
-    // From the built "prarms" derive the PKEY Public Key.
-    p_ctx_pub = EVP_PKEY_CTX_new_from_name(NULL, "EC", NULL);
-    if (p_ctx_pub == NULL || p_params == NULL
-        || EVP_PKEY_fromdata_init(p_ctx_pub) <= 0
-        || EVP_PKEY_fromdata(
-               p_ctx_pub, &m_pPeerKey, EVP_PKEY_PUBLIC_KEY, p_params)
-               <= 0) {
-        ERR_print_errors_fp(stderr);
-        s.update(status::InternalError("PKEY Error!"));
+    // the private key is zero until it is set
+    if (!IsValidPrivateKey(m_PrivKey)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Invalid private key");
     }
-    OSSL_PARAM_free(p_params);
-    OSSL_PARAM_BLD_free(p_param_bld_pub);
-    EVP_PKEY_CTX_free(p_ctx_pub);
 
-    p_key_derivation_ctx = EVP_PKEY_CTX_new(m_pSelfKey, NULL);
-
-    if (p_key_derivation_ctx == NULL) {
-        ERR_print_errors_fp(stderr);
-        s.update(status::InternalError("Key Derivation CTX creation failed!"));
+    bool valid = false;
+    switch (GetKernel()) {
+        case P256Kernel::eZen3:
+            valid = zen3::alcpScalarMulP256(pSecretKey, m_PrivKey, pPublicKey);
+            break;
+        case P256Kernel::eZen:
+            valid = zen::alcpScalarMulP256(pSecretKey, m_PrivKey, pPublicKey);
+            break;
+        default:
+            valid =
+                reference::alcpScalarMulP256(pSecretKey, m_PrivKey, pPublicKey);
+            break;
     }
-
-    // Initialize Key Derivation
-    if (EVP_PKEY_derive_init(p_key_derivation_ctx) <= 0) {
-        ERR_print_errors_fp(stderr);
-        s.update(
-            status::InternalError("Initializing Key Derivation CTX failed!"));
+    if (!valid) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Key validation failed");
     }
 
-    // Setup the second peer (fist peer is alice) as bob with his public key
-    if (EVP_PKEY_derive_set_peer(p_key_derivation_ctx, m_pPeerKey) <= 0) {
-        ERR_print_errors_fp(stderr);
-        s.update(status::InternalError("Key Derivation Set Peer failed!"));
-    }
+    *pKeyLength = KeySize;
+    return StatusOk();
+}
 
-    // Get the length of the secret key by passing secret key buffer as NULL
-    if (EVP_PKEY_derive(p_key_derivation_ctx, NULL, pKeyLength) <= 0) {
-        ERR_print_errors_fp(stderr);
-        s.update(status::InternalError(
-            "Key Derivation Secret Key Size Query failed!"));
+Status
+P256::validatePublicKey(const Uint8* pPublicKey, Uint64 pKeyLength)
+{
+    // affine x and y, the curve has no small subgroups to check for
+    if (pKeyLength != KeySize * 2) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Key validation failed");
     }
 
-    // Allocate secret key buffer and derive it.
-    // secret_key = OPENSSL_malloc(sec_key_len);
-    if (EVP_PKEY_derive(p_key_derivation_ctx, pSecretKey, pKeyLength) <= 0) {
-        ERR_print_errors_fp(stderr);
-        s.update(status::InternalError("Key Derivation Failed!"));
+    bool valid = false;
+    switch (GetKernel()) {
+        case P256Kernel::eZen3:
+            valid = zen3::AlcpValidatePubP256(pPublicKey);
+            break;
+        case P256Kernel::eZen:
+            valid = zen::AlcpValidatePubP256(pPublicKey);
+            break;
+        default:
+            valid = reference::AlcpValidatePubP256(pPublicKey);
+            break;
     }
+    return valid ? StatusOk()
+                 : Status(GenericError(ErrorCode::eInvalidArgument),
+                          "Key validation failed");
+}
 
-    EVP_PKEY_CTX_free(p_key_derivation_ctx);
-    return s;
+Status
+P256::sign(const Uint8* pDigest, Uint64 digestSize, Uint8* pSignature)
+{
+    return EcdsaSign<4>(
+        SignatureCurve, m_PrivKey, pDigest, digestSize, pSignature);
 }
 
 Status
-P256::validatePublicKey(const Uint8* pPublicKey, Uint64 pKeyLength)
+P256::verify(const Uint8* pDigest,
+             Uint64       digestSize,
+             const Uint8* pSignature,
+             const Uint8* pPublicKey)
 {
-    // To be implemented
-    Status s = StatusOk();
-    s.update(
-        status::NotImplemented("This functionality is yet to be implemented!"));
-    return s;
+    return EcdsaVerify<4>(
+        SignatureCurve, pPublicKey, pDigest, digestSize, pSignature);
 }
 
 Uint64
@@ -175,16 +299,9 @@ P256::getKeySize()
 
 void
 P256::reset()
-{}
-
-P256::~P256()
 {
-    if (m_pSelfKey != nullptr) {
-        EVP_PKEY_free(m_pSelfKey);
-    }
-    if (m_pPeerKey != nullptr) {
-        EVP_PKEY_free(m_pPeerKey);
-    }
+    // clear private key with zeros
+    alcp::utils::PadBytes(m_PrivKey, 0, KeySize);
 }
 
-} // namespace alcp::ec
\ No newline at end of file
+} // namespace alcp::ec
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/ec/ecdh.hh"
+#include "alcp/ec/ecdsa.hh"
+#include "alcp/ec/weierstrass.hh"
+#include "alcp/utils/copy.hh"
+
+namespace alcp::ec {
+
+using namespace weierstrass;
+
+static constexpr Uint32 KeySize = 48;
+
+// clang-format off
+static constexpr CurveParams<6> Curve = {
+    { // p = 2^384 - 2^128 - 2^96 + 2^32 - 1
+      { 0x00000000ffffffff, 0xffffffff00000000, 0xfffffffffffffffe,
+        0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff },
+      0x0000000100000001,
+      { 0xfffffffe00000001, 0x0000000200000000, 0xfffffffe00000000,
+        0x0000000200000000, 0x0000000000000001, 0x0000000000000000 },
+      { 0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000 } },
+    { // n
+      { 0xecec196accc52973, 0x581a0db248b0a77a, 0xc7634d81f4372ddf,
+        0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff },
+      0x6ed46089e88fdc45,
+      { 0x2d319b2419b409a9, 0xff3d81e5df1aa419, 0xbc3e483afcb82947,
+        0xd40d49174aab1cc5, 0x3fb05b7a28266895, 0x0c84ee012b39bf21 },
+      { 0x1313e695333ad68d, 0xa7e5f24db74f5885, 0x389cb27e0bc8d220,
+        0x0000000000000000, 0x0000000000000000, 0x0000000000000000 } },
+    // b
+    { 0x081188719d412dcc, 0xf729add87a4c32ec, 0x77f2209b1920022e,
+      0xe3374bee94938ae2, 0xb62b21f41f022094, 0xcd08114b604fbff9 },
+    // Gx
+    { 0x3dd0756649c0b528, 0x20e378e2a0d6ce38, 0x879c3afc541b4d6e,
+      0x6454868459a30eff, 0x812ff723614ede2b, 0x4d3aadc2299e1513 },
+    // Gy
+    { 0x23043dad4b03a4fe, 0xa1bfa8bf7bb4a9ac, 0x8bade7562e83b050,
+      0xc6c3521968f4ffd9, 0xdd8002263969a840, 0x2b78abc25a15c5e9 },
+    KeySize,
+};
+// clang-format on
+
+static const AffinePoint<6>*
+GetBaseTable()
+{
+    static const std::unique_ptr<AffinePoint<6>[]> table =
+        BuildBaseTable<6>(Curve);
+    return table.get();
+}
+
+// 0 < key < n, without branching on the key
+static bool
+IsValidPrivateKey(const Uint8* pPrivKey)
+{
+    Uint64 key[6], t[6];
+    FromBytes<6>(key, pPrivKey, KeySize);
+    Uint64 borrow = SubLimbs<6>(t, key, Curve.m_order.m_value);
+    return borrow & ~ZeroMask<6>(key) & 1;
+}
+
+static void
+BaseMulX(Uint8* pX, const Uint8* pScalar)
+{
+    Point<6> point;
+    Uint64   x[6], y[6];
+
+    ScalarMulBase<6>(point, pScalar, GetBaseTable(), Curve);
+    PointToAffine<6>(x, y, point, Curve);
+    ToBytes<6>(pX, x, KeySize);
+}
+
+static bool
+DoubleMulX(Uint8*       pX,
+           const Uint8* pU1,
+           const Uint8* pU2,
+           const Uint8* pPublicKey)
+{
+    Point<6> peer, point;
+    Uint64   u1[6], u2[6], x[6], y[6];
+
+    if (!DecodePoint<6>(peer, pPublicKey, Curve)) {
+        return false;
+    }
+    FromBytes<6>(u1, pU1, KeySize);
+    FromBytes<6>(u2, pU2, KeySize);
+    DoubleScalarMul<6>(point, u1, u2, peer, Curve);
+    if (!PointToAffine<6>(x, y, point, Curve)) {
+        return false;
+    }
+    ToBytes<6>(pX, x, KeySize);
+    return true;
+}
+
+static const EcdsaCurve<6> SignatureCurve = {
+    &Curve.m_order, 384, KeySize, BaseMulX, DoubleMulX, nullptr
+};
+
+P384::P384() = default;
+
+P384::~P384()
+{
+    reset();
+}
+
+Status
+P384::setPrivateKey(const Uint8* pPrivKey)
+{
+    if (!IsValidPrivateKey(pPrivKey)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Invalid private key");
+    }
+    alcp::utils::CopyBytes(m_PrivKey, pPrivKey, KeySize);
+    return StatusOk();
+}
+
+Status
+P384::generatePublicKey(Uint8* pPublicKey, const Uint8* pPrivKey)
+{
+    Status status = setPrivateKey(pPrivKey);
+    if (!status.ok()) {
+        return status;
+    }
+
+    Point<6> point;
+    Uint64   x[6], y[6];
+    ScalarMulBase<6>(point, m_PrivKey, GetBaseTable(), Curve);
+    PointToAffine<6>(x, y, point, Curve);
+    ToBytes<6>(pPublicKey, x, KeySize);
+    ToBytes<6>(pPublicKey + KeySize, y, KeySize);
+    return status;
+}
+
+Status
+P384::computeSecretKey(Uint8*       pSecretKey,
+                       const Uint8* pPublicKey,
+                       Uint64*      pKeyLength)
+{
+    // the private key is zero until it is set
+    if (!IsValidPrivateKey(m_PrivKey)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Invalid private key");
+    }
+
+    Point<6> peer, point;
+    Uint64   x[6], y[6];
+    if (!DecodePoint<6>(peer, pPublicKey, Curve)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Key validation failed");
+    }
+    ScalarMul<6>(point, m_PrivKey, peer, Curve);
+    PointToAffine<6>(x, y, point, Curve);
+    ToBytes<6>(pSecretKey, x, KeySize);
+
+    *pKeyLength = KeySize;
+    return StatusOk();
+}
+
+Status
+P384::validatePublicKey(const Uint8* pPublicKey, Uint64 pKeyLength)
+{
+    // affine x and y, the curve has no small subgroups to check for
+    Point<6> point;
+    if (pKeyLength != KeySize * 2
+        || !DecodePoint<6>(point, pPublicKey, Curve)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Key validation failed");
+    }
+    return StatusOk();
+}
+
+Status
+P384::sign(const Uint8* pDigest, Uint64 digestSize, Uint8* pSignature)
+{
+    return EcdsaSign<6>(
+        SignatureCurve, m_PrivKey, pDigest, digestSize, pSignature);
+}
+
+Status
+P384::verify(const Uint8* pDigest,
+             Uint64       digestSize,
+             const Uint8* pSignature,
+             const Uint8* pPublicKey)
+{
+    return EcdsaVerify<6>(
+        SignatureCurve, pPublicKey, pDigest, digestSize, pSignature);
+}
+
+Uint64
+P384::getKeySize()
+{
+    return KeySize;
+}
+
+void
+P384::reset()
+{
+    // clear private key with zeros
+    alcp::utils::PadBytes(m_PrivKey, 0, KeySize);
+}
+
+} // namespace alcp::ec
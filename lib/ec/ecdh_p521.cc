@@ -0,0 +1,878 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "alcp/ec/ecdh.hh"
+#include "alcp/ec/ecdsa.hh"
+#include "alcp/ec/p521_table.hh"
+#include "alcp/ec/weierstrass.hh"
+#include "alcp/utils/copy.hh"
+
+namespace alcp::ec {
+
+using namespace weierstrass;
+
+static constexpr Uint32 KeySize = 66;
+
+/*
+ * P-521 on nine limbs of radix 2^58, the top one 57 bits. p = 2^521 - 1, so
+ * the high half of a product folds onto the low half with a shift (Solinas
+ * reduction) and the field elements are kept in the normal domain. Limbs
+ * have a few bits of headroom, sums are carried once instead of reduced, and
+ * only FeContract gives the unique value below p.
+ *
+ * Points are in Jacobian coordinates, Z = 0 being the point at infinity.
+ * Everything except DoubleScalarMul runs in constant time.
+ */
+namespace p521 {
+
+constexpr Uint64 Mask58 = (1ULL << 58) - 1;
+constexpr Uint64 Mask57 = (1ULL << 57) - 1;
+
+// p as 64 bit words, for the range checks of encoded values
+constexpr Uint64 PrimeWords[9] = {
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+    0xffffffffffffffff, 0xffffffffffffffff, 0x00000000000001ff
+};
+
+constexpr Uint64 One[9] = { 1 };
+
+constexpr Uint64 CurveB[9] = {
+    0x3451fd46b503f00, 0x0f7e20f4b0d3c7b, 0x00bd3bb1bf07357, 0x147b1fa4dec594b,
+    0x18ef109e1561939, 0x26cc57cee2d2264, 0x0540eea2da725b9, 0x2687e4a688682da,
+    0x051953eb9618e1c
+};
+
+// 4 teeth comb over the two tables of cP521CombTable, the teeth 66 bits apart
+constexpr int CombTeeth   = 4;
+constexpr int CombSpacing = 66;
+constexpr int CombEntries = 15;
+
+// signed 5 bit windows of the variable base multiplication
+constexpr int    Windows = 105;
+constexpr Uint64 Entries = 16;
+
+// wNAF widths of the verification, G has the 32 odd multiples of cP521OddTable
+constexpr int    WnafWidthBase = 7;
+constexpr int    WnafWidth     = 5;
+constexpr Uint64 WnafEntries   = 1 << (WnafWidth - 2);
+constexpr int    WnafDigits    = 9 * 64 + 1;
+
+struct Point
+{
+    Uint64 m_x[9];
+    Uint64 m_y[9];
+    Uint64 m_z[9];
+};
+
+struct AffinePoint
+{
+    Uint64 m_x[9];
+    Uint64 m_y[9];
+};
+
+// all ones when a == b, both below 2^63
+static inline Uint64
+EqualMask(Uint64 a, Uint64 b)
+{
+    return 0 - (((a ^ b) - 1) >> 63);
+}
+
+static inline void
+Select(Uint64 r[9], const Uint64 a[9], const Uint64 b[9], Uint64 mask)
+{
+    UNROLL_9
+    for (int i = 0; i < 9; i++) {
+        r[i] = (a[i] & mask) | (b[i] & ~mask);
+    }
+}
+
+// limbs back below 2^58 (2^57 for the top one), limb 1 may keep a few more
+static inline void
+FeCarry(Uint64 r[9])
+{
+    UNROLL_9
+    for (int i = 0; i < 8; i++) {
+        r[i + 1] += r[i] >> 58;
+        r[i] &= Mask58;
+    }
+    // 2^521 = 1
+    r[0] += r[8] >> 57;
+    r[8] &= Mask57;
+    r[1] += r[0] >> 58;
+    r[0] &= Mask58;
+}
+
+static inline void
+FeAdd(Uint64 r[9], const Uint64 a[9], const Uint64 b[9])
+{
+    UNROLL_9
+    for (int i = 0; i < 9; i++) {
+        r[i] = a[i] + b[i];
+    }
+    FeCarry(r);
+}
+
+// a - b + 2 * p, the limbs of 2 * p are above those of any carried b
+static inline void
+FeSub(Uint64 r[9], const Uint64 a[9], const Uint64 b[9])
+{
+    UNROLL_9
+    for (int i = 0; i < 8; i++) {
+        r[i] = a[i] + ((Mask58 << 1) - b[i]);
+    }
+    r[8] = a[8] + ((Mask57 << 1) - b[8]);
+    FeCarry(r);
+}
+
+// the 128 bit column sums of a product to carried limbs
+static inline void
+FeCarryWide(Uint64 r[9], __uint128_t t[9])
+{
+    UNROLL_9
+    for (int i = 0; i < 8; i++) {
+        t[i + 1] += t[i] >> 58;
+        r[i] = static_cast<Uint64>(t[i]) & Mask58;
+    }
+    r[8] = static_cast<Uint64>(t[8]) & Mask57;
+
+    // 2^521 = 1
+    __uint128_t low = static_cast<__uint128_t>(r[0]) + (t[8] >> 57);
+    r[0]            = static_cast<Uint64>(low) & Mask58;
+    r[1] += static_cast<Uint64>(low >> 58);
+}
+
+/*
+ * Column k of a * b takes a[i] * b[k - i] and, as 2^522 = 2 mod p, twice the
+ * column k + 9. The columns stay below 2^125 for carried inputs
+ */
+static inline void
+FeMul(Uint64 r[9], const Uint64 a[9], const Uint64 b[9])
+{
+    Uint64      b2[9];
+    __uint128_t t[9];
+
+    UNROLL_9
+    for (int i = 0; i < 9; i++) {
+        b2[i] = b[i] << 1;
+    }
+    UNROLL_9
+    for (int k = 0; k < 9; k++) {
+        __uint128_t acc = 0;
+        UNROLL_9
+        for (int i = 0; i <= k; i++) {
+            acc += static_cast<__uint128_t>(a[i]) * b[k - i];
+        }
+        UNROLL_9
+        for (int i = k + 1; i < 9; i++) {
+            acc += static_cast<__uint128_t>(a[i]) * b2[k + 9 - i];
+        }
+        t[k] = acc;
+    }
+    FeCarryWide(r, t);
+}
+
+// the cross products once, 45 multiplications instead of 81
+static inline void
+FeSqr(Uint64 r[9], const Uint64 a[9])
+{
+    Uint64      a2[9], a4[9];
+    __uint128_t t[9];
+
+    UNROLL_9
+    for (int i = 0; i < 9; i++) {
+        a2[i] = a[i] << 1;
+        a4[i] = a[i] << 2;
+    }
+    UNROLL_9
+    for (int k = 0; k < 9; k++) {
+        __uint128_t acc = 0;
+        UNROLL_9
+        for (int i = 0; 2 * i < k; i++) {
+            acc += static_cast<__uint128_t>(a2[i]) * a[k - i];
+        }
+        if (!(k & 1)) {
+            acc += static_cast<__uint128_t>(a[k / 2]) * a[k / 2];
+        }
+        // column k + 9, doubled for the fold
+        UNROLL_9
+        for (int i = k + 1; 2 * i < k + 9; i++) {
+            acc += static_cast<__uint128_t>(a4[i]) * a[k + 9 - i];
+        }
+        if (k & 1) {
+            acc += static_cast<__uint128_t>(a2[(k + 9) / 2]) * a[(k + 9) / 2];
+        }
+        t[k] = acc;
+    }
+    FeCarryWide(r, t);
+}
+
+static inline void
+FeSqrCount(Uint64 r[9], const Uint64 a[9], int count)
+{
+    FeSqr(r, a);
+    for (int i = 1; i < count; i++) {
+        FeSqr(r, r);
+    }
+}
+
+// r = a^(p - 2), p - 2 = 2^521 - 3 is 519 ones followed by 01
+static inline void
+FeInv(Uint64 r[9], const Uint64 a[9])
+{
+    Uint64 x2[9], x3[9], x4[9], x7[9], x8[9], x[9], t[9];
+
+    FeSqr(x2, a);
+    FeMul(x2, x2, a); // 2^2 - 1
+    FeSqr(x3, x2);
+    FeMul(x3, x3, a); // 2^3 - 1
+    FeSqrCount(x4, x2, 2);
+    FeMul(x4, x4, x2); // 2^4 - 1
+    FeSqrCount(x7, x4, 3);
+    FeMul(x7, x7, x3); // 2^7 - 1
+    FeSqrCount(x8, x4, 4);
+    FeMul(x8, x8, x4); // 2^8 - 1
+
+    // 2^16 - 1 up to 2^512 - 1
+    alcp::utils::CopyQWord(x, x8, sizeof(x));
+    for (int bits = 8; bits < 512; bits *= 2) {
+        FeSqrCount(t, x, bits);
+        FeMul(x, t, x);
+    }
+    FeSqrCount(t, x, 7);
+    FeMul(t, t, x7); // 2^519 - 1
+    FeSqrCount(t, t, 2);
+    FeMul(r, t, a);
+}
+
+// r = a mod p, below p with every limb carried
+static inline void
+FeContract(Uint64 r[9], const Uint64 a[9])
+{
+    Uint64 t[9];
+
+    alcp::utils::CopyQWord(t, a, sizeof(t));
+    FeCarry(t);
+    // limb 1 may still be above 2^58, after a second pass every limb is in
+    // range and the value at most p
+    FeCarry(t);
+
+    // p itself becomes 0
+    Uint64 diff = t[8] ^ Mask57;
+    for (int i = 0; i < 8; i++) {
+        diff |= t[i] ^ Mask58;
+    }
+    Uint64 keep = 0 - ((diff | (0 - diff)) >> 63);
+    for (int i = 0; i < 9; i++) {
+        r[i] = t[i] & keep;
+    }
+}
+
+// all ones when a = 0 mod p
+static inline Uint64
+ZeroMask(const Uint64 a[9])
+{
+    Uint64 t[9], acc = 0;
+    FeContract(t, a);
+    for (int i = 0; i < 9; i++) {
+        acc |= t[i];
+    }
+    return ((acc | (0 - acc)) >> 63) - 1;
+}
+
+// big endian bytes to limbs, false unless the value is below p
+static inline bool
+BytesToFe(Uint64 r[9], const Uint8* pBytes)
+{
+    Uint64 words[9];
+
+    FromBytes<9>(words, pBytes, KeySize);
+    if (!IsLess<9>(words, PrimeWords)) {
+        return false;
+    }
+    for (int i = 0; i < 9; i++) {
+        int    bit   = 58 * i;
+        int    shift = bit % 64;
+        Uint64 limb  = words[bit / 64] >> shift;
+        if (shift > 6) {
+            limb |= words[bit / 64 + 1] << (64 - shift);
+        }
+        r[i] = limb & Mask58;
+    }
+    return true;
+}
+
+static inline void
+FeToBytes(Uint8* pBytes, const Uint64 a[9])
+{
+    Uint64 t[9], words[9] = {};
+
+    FeContract(t, a);
+    for (int i = 0; i < 9; i++) {
+        int bit   = 58 * i;
+        int shift = bit % 64;
+        words[bit / 64] |= t[i] << shift;
+        if (shift > 6) {
+            words[bit / 64 + 1] |= t[i] >> (64 - shift);
+        }
+    }
+    ToBytes<9>(pBytes, words, KeySize);
+}
+
+// dbl-2001-b, a = -3
+static inline void
+PointDouble(Point& r, const Point& a)
+{
+    Uint64 delta[9], gamma[9], beta[9], alpha[9], t0[9], t1[9];
+
+    FeSqr(delta, a.m_z);
+    FeSqr(gamma, a.m_y);
+    FeMul(beta, a.m_x, gamma);
+
+    FeSub(t0, a.m_x, delta);
+    FeAdd(t1, a.m_x, delta);
+    FeMul(t0, t0, t1);
+    FeAdd(alpha, t0, t0);
+    FeAdd(alpha, alpha, t0);
+
+    // Z3 = (Y + Z)^2 - gamma - delta, before Y and Z are overwritten
+    FeAdd(t0, a.m_y, a.m_z);
+    FeSqr(t0, t0);
+    FeSub(t0, t0, gamma);
+    FeSub(r.m_z, t0, delta);
+
+    // X3 = alpha^2 - 8 * beta
+    FeAdd(beta, beta, beta);
+    FeAdd(beta, beta, beta);
+    FeSqr(t0, alpha);
+    FeSub(t0, t0, beta);
+    FeSub(r.m_x, t0, beta);
+
+    // Y3 = alpha * (4 * beta - X3) - 8 * gamma^2
+    FeSub(t0, beta, r.m_x);
+    FeMul(t0, alpha, t0);
+    FeSqr(t1, gamma);
+    FeAdd(t1, t1, t1);
+    FeAdd(t1, t1, t1);
+    FeAdd(t1, t1, t1);
+    FeSub(r.m_y, t0, t1);
+}
+
+/*
+ * add-2007-bl. Infinity on either side is handled by selects, a == b only
+ * happens for inputs that are not derived from a secret scalar, or with
+ * negligible probability, so it takes a branch to the doubling
+ */
+static inline void
+PointAdd(Point& r, const Point& a, const Point& b)
+{
+    Uint64 z1z1[9], z2z2[9], u1[9], u2[9], s1[9], s2[9], h[9], rr[9];
+    Uint64 i[9], j[9], v[9], t[9];
+    Point  res;
+
+    FeSqr(z1z1, a.m_z);
+    FeSqr(z2z2, b.m_z);
+    FeMul(u1, a.m_x, z2z2);
+    FeMul(u2, b.m_x, z1z1);
+    FeMul(s1, a.m_y, b.m_z);
+    FeMul(s1, s1, z2z2);
+    FeMul(s2, b.m_y, a.m_z);
+    FeMul(s2, s2, z1z1);
+    FeSub(h, u2, u1);
+    FeSub(rr, s2, s1);
+
+    Uint64 a_inf = ZeroMask(a.m_z);
+    Uint64 b_inf = ZeroMask(b.m_z);
+    if (ZeroMask(h) & ZeroMask(rr) & ~a_inf & ~b_inf) {
+        PointDouble(r, a);
+        return;
+    }
+
+    FeAdd(i, h, h);
+    FeSqr(i, i);
+    FeMul(j, h, i);
+    FeAdd(rr, rr, rr);
+    FeMul(v, u1, i);
+
+    FeSqr(t, rr);
+    FeSub(t, t, j);
+    FeSub(t, t, v);
+    FeSub(res.m_x, t, v);
+
+    FeSub(t, v, res.m_x);
+    FeMul(t, rr, t);
+    FeMul(s1, s1, j);
+    FeAdd(s1, s1, s1);
+    FeSub(res.m_y, t, s1);
+
+    FeAdd(t, a.m_z, b.m_z);
+    FeSqr(t, t);
+    FeSub(t, t, z1z1);
+    FeSub(t, t, z2z2);
+    FeMul(res.m_z, t, h);
+
+    Select(res.m_x, b.m_x, res.m_x, a_inf);
+    Select(res.m_y, b.m_y, res.m_y, a_inf);
+    Select(res.m_z, b.m_z, res.m_z, a_inf);
+    Select(r.m_x, a.m_x, res.m_x, b_inf);
+    Select(r.m_y, a.m_y, res.m_y, b_inf);
+    Select(r.m_z, a.m_z, res.m_z, b_inf);
+}
+
+// madd-2007-bl, b has Z = 1 and is ignored when bInf is all ones
+static inline void
+PointAddAffine(Point& r, const Point& a, const AffinePoint& b, Uint64 bInf)
+{
+    Uint64 z1z1[9], u2[9], s2[9], h[9], hh[9], rr[9], i[9], j[9], v[9];
+    Uint64 t[9];
+    Point  res;
+
+    FeSqr(z1z1, a.m_z);
+    FeMul(u2, b.m_x, z1z1);
+    FeMul(s2, b.m_y, a.m_z);
+    FeMul(s2, s2, z1z1);
+    FeSub(h, u2, a.m_x);
+    FeSub(rr, s2, a.m_y);
+
+    Uint64 a_inf = ZeroMask(a.m_z);
+    if (ZeroMask(h) & ZeroMask(rr) & ~a_inf & ~bInf) {
+        PointDouble(r, a);
+        return;
+    }
+
+    FeSqr(hh, h);
+    FeAdd(i, hh, hh);
+    FeAdd(i, i, i);
+    FeMul(j, h, i);
+    FeAdd(rr, rr, rr);
+    FeMul(v, a.m_x, i);
+
+    FeSqr(t, rr);
+    FeSub(t, t, j);
+    FeSub(t, t, v);
+    FeSub(res.m_x, t, v);
+
+    FeSub(t, v, res.m_x);
+    FeMul(t, rr, t);
+    FeMul(s2, a.m_y, j);
+    FeAdd(s2, s2, s2);
+    FeSub(res.m_y, t, s2);
+
+    FeAdd(t, a.m_z, h);
+    FeSqr(t, t);
+    FeSub(t, t, z1z1);
+    FeSub(res.m_z, t, hh);
+
+    Select(res.m_x, b.m_x, res.m_x, a_inf);
+    Select(res.m_y, b.m_y, res.m_y, a_inf);
+    Select(res.m_z, One, res.m_z, a_inf);
+    Select(r.m_x, a.m_x, res.m_x, bInf);
+    Select(r.m_y, a.m_y, res.m_y, bInf);
+    Select(r.m_z, a.m_z, res.m_z, bInf);
+}
+
+// (x, y) from a point not at infinity
+static inline void
+PointToAffine(Uint64 x[9], Uint64 y[9], const Point& a)
+{
+    Uint64 zinv[9], zinv2[9];
+
+    FeInv(zinv, a.m_z);
+    FeSqr(zinv2, zinv);
+    FeMul(x, a.m_x, zinv2);
+    FeMul(zinv2, zinv2, zinv);
+    FeMul(y, a.m_y, zinv2);
+}
+
+static inline void
+Negate(Uint64 y[9], Uint64 mask)
+{
+    static constexpr Uint64 zero[9] = {};
+    Uint64                  neg[9];
+    FeSub(neg, zero, y);
+    Select(y, neg, y, mask);
+}
+
+/*
+ * r = pTable[index - 1], all zero for index 0. Every entry is read, so the
+ * memory access pattern does not depend on the index
+ */
+static inline void
+Lookup(AffinePoint& r, const Uint64 pTable[][2][9], Uint64 index)
+{
+    r = AffinePoint{};
+    for (int j = 0; j < CombEntries; j++) {
+        Uint64 mask = EqualMask(index, j + 1);
+        Select(r.m_x, pTable[j][0], r.m_x, mask);
+        Select(r.m_y, pTable[j][1], r.m_y, mask);
+    }
+}
+
+static inline void
+Lookup(Point& r, const Point* pTable, Uint64 index)
+{
+    r = Point{};
+    for (Uint64 j = 0; j < Entries; j++) {
+        Uint64 mask = EqualMask(index, j + 1);
+        Select(r.m_x, pTable[j].m_x, r.m_x, mask);
+        Select(r.m_y, pTable[j].m_y, r.m_y, mask);
+        Select(r.m_z, pTable[j].m_z, r.m_z, mask);
+    }
+}
+
+// bit i of a big endian scalar
+static inline Uint64
+ScalarBit(const Uint8* pScalar, int i)
+{
+    return (pScalar[KeySize - 1 - i / 8] >> (i % 8)) & 1;
+}
+
+/*
+ * r = k * G with the static comb. Column i of the scalar, the bits
+ * i + 66 * b, picks one entry of each table, so there are 66 doublings and
+ * 132 mixed additions
+ */
+static inline void
+ScalarMulBase(Point& r, const Uint8* pScalar)
+{
+    AffinePoint entry;
+
+    r = Point{};
+    for (int i = CombSpacing - 1; i >= 0; i--) {
+        PointDouble(r, r);
+        for (int t = 0; t < 2; t++) {
+            Uint64 index = 0;
+            for (int b = 0; b < CombTeeth; b++) {
+                int bit = i + CombSpacing * (b + CombTeeth * t);
+                index |= ScalarBit(pScalar, bit) << b;
+            }
+            Lookup(entry, cP521CombTable[t], index);
+            PointAddAffine(r, r, entry, EqualMask(index, 0));
+        }
+    }
+}
+
+/*
+ * Signed 5 bit digits in [-16, 16), the last digit takes the carry. Same
+ * recoding as the P-256 code
+ */
+static inline void
+RecodeScalar(Int8* pDigits, const Uint8* pScalar)
+{
+    Int8 carry = 0;
+    for (int i = 0; i < Windows; i++) {
+        int    bit  = i * 5;
+        Uint32 bits = 0;
+        // big endian scalar, up to two bytes hold the window
+        for (Uint32 k = 0; k < 2 && (bit >> 3) + k < KeySize; k++) {
+            bits |= static_cast<Uint32>(pScalar[KeySize - 1 - (bit >> 3) - k])
+                    << (8 * k);
+        }
+        Int8 digit = static_cast<Int8>((bits >> (bit & 7)) & 0x1f);
+        digit += carry;
+        carry      = (digit + 16) >> 5;
+        pDigits[i] = digit - (carry << 5);
+    }
+}
+
+// r = k * a, k given as big endian bytes
+static inline void
+ScalarMul(Point& r, const Uint8* pScalar, const Point& a)
+{
+    Point table[Entries], entry;
+    Int8  digits[Windows];
+
+    table[0] = a;
+    PointDouble(table[1], a);
+    for (Uint64 j = 2; j < Entries; j++) {
+        if (j & 1) {
+            PointDouble(table[j], table[j / 2]);
+        } else {
+            PointAdd(table[j], table[j - 1], a);
+        }
+    }
+
+    RecodeScalar(digits, pScalar);
+
+    r = Point{};
+    for (int w = Windows - 1; w >= 0; w--) {
+        for (int k = 0; k < 5; k++) {
+            PointDouble(r, r);
+        }
+
+        Uint64 sign =
+            0 - static_cast<Uint64>(static_cast<Uint8>(digits[w]) >> 7);
+        Uint64 abs = (static_cast<Uint64>(digits[w]) ^ sign) - sign;
+
+        // abs == 0 leaves entry at infinity
+        Lookup(entry, table, abs);
+        Negate(entry.m_y, sign);
+        PointAdd(r, r, entry);
+    }
+}
+
+/*
+ * r = u1 * G + u2 * q with Shamir's trick, both scalars in wNAF sharing one
+ * doubling chain. Variable time, for public inputs only
+ */
+static inline void
+DoubleScalarMul(Point&       r,
+                const Uint64 u1[9],
+                const Uint64 u2[9],
+                const Point& q)
+{
+    Point       table_q[WnafEntries], dbl, neg;
+    AffinePoint entry;
+    Int8        digits1[WnafDigits] = {}, digits2[WnafDigits] = {};
+
+    table_q[0] = q;
+    PointDouble(dbl, q);
+    for (Uint64 j = 1; j < WnafEntries; j++) {
+        PointAdd(table_q[j], table_q[j - 1], dbl);
+    }
+
+    int len1 = RecodeWnaf<9>(digits1, u1, WnafWidthBase);
+    int len2 = RecodeWnaf<9>(digits2, u2, WnafWidth);
+
+    r = Point{};
+    for (int i = (len1 > len2 ? len1 : len2) - 1; i >= 0; i--) {
+        PointDouble(r, r);
+
+        Int8 d = digits1[i];
+        if (d != 0) {
+            const Uint64(*odd)[9] = cP521OddTable[(d < 0 ? -d : d) / 2];
+            alcp::utils::CopyQWord(entry.m_x, odd[0], sizeof(entry.m_x));
+            alcp::utils::CopyQWord(entry.m_y, odd[1], sizeof(entry.m_y));
+            Negate(entry.m_y, d < 0 ? ~0ULL : 0);
+            PointAddAffine(r, r, entry, 0);
+        }
+
+        d = digits2[i];
+        if (d > 0) {
+            PointAdd(r, r, table_q[d / 2]);
+        } else if (d < 0) {
+            neg = table_q[-d / 2];
+            Negate(neg.m_y, ~0ULL);
+            PointAdd(r, r, neg);
+        }
+    }
+}
+
+// affine (x, y) big endian, both below p and on the curve
+static inline bool
+DecodePoint(Point& r, const Uint8* pPoint)
+{
+    Uint64 lhs[9], rhs[9], t[9];
+
+    if (!BytesToFe(r.m_x, pPoint) || !BytesToFe(r.m_y, pPoint + KeySize)) {
+        return false;
+    }
+    alcp::utils::CopyQWord(r.m_z, One, sizeof(r.m_z));
+
+    // y^2 = x^3 - 3 * x + b
+    FeSqr(lhs, r.m_y);
+    FeSqr(rhs, r.m_x);
+    FeMul(rhs, rhs, r.m_x);
+    FeAdd(t, r.m_x, r.m_x);
+    FeAdd(t, t, r.m_x);
+    FeSub(rhs, rhs, t);
+    FeAdd(rhs, rhs, CurveB);
+    FeSub(t, lhs, rhs);
+
+    return ZeroMask(t) != 0;
+}
+
+} // namespace p521
+
+// clang-format off
+// the group order for the ECDSA scalar arithmetic
+static constexpr Modulus<9> OrderModulus = {
+    { 0xbb6fb71e91386409, 0x3bb5c9b8899c47ae, 0x7fcc0148f709a5d0,
+      0x51868783bf2f966b, 0xfffffffffffffffa, 0xffffffffffffffff,
+      0xffffffffffffffff, 0xffffffffffffffff, 0x00000000000001ff },
+    0x1d2f5ccd79a995c7,
+    { 0x137cd04dcf15dd04, 0xf707badce5547ea3, 0x12a78d38794573ff,
+      0xd3721ef557f75e06, 0xdd6e23d82e49c7db, 0xcff3d142b7756e3e,
+      0x5bcc6d61a8e567bc, 0x2d8e03d1492d0d45, 0x000000000000003d },
+    { 0xfb80000000000000, 0x28a2482470b763cd, 0x17e2251b23bb31dc,
+      0xca4019ff5b847b2d, 0x02d73cbc3e206834, 0x0000000000000000,
+      0x0000000000000000, 0x0000000000000000, 0x0000000000000000 },
+};
+// clang-format on
+
+// 0 < key < n, without branching on the key
+static bool
+IsValidPrivateKey(const Uint8* pPrivKey)
+{
+    Uint64 key[9], t[9];
+    FromBytes<9>(key, pPrivKey, KeySize);
+    Uint64 borrow = SubLimbs<9>(t, key, OrderModulus.m_value);
+    return borrow & ~ZeroMask<9>(key) & 1;
+}
+
+static void
+BaseMulX(Uint8* pX, const Uint8* pScalar)
+{
+    p521::Point point;
+    Uint64      x[9], y[9];
+
+    p521::ScalarMulBase(point, pScalar);
+    p521::PointToAffine(x, y, point);
+    p521::FeToBytes(pX, x);
+}
+
+static bool
+DoubleMulX(Uint8*       pX,
+           const Uint8* pU1,
+           const Uint8* pU2,
+           const Uint8* pPublicKey)
+{
+    p521::Point peer, point;
+    Uint64      u1[9], u2[9], x[9], y[9];
+
+    if (!p521::DecodePoint(peer, pPublicKey)) {
+        return false;
+    }
+    FromBytes<9>(u1, pU1, KeySize);
+    FromBytes<9>(u2, pU2, KeySize);
+    p521::DoubleScalarMul(point, u1, u2, peer);
+    if (p521::ZeroMask(point.m_z)) {
+        return false;
+    }
+    p521::PointToAffine(x, y, point);
+    p521::FeToBytes(pX, x);
+    return true;
+}
+
+static const EcdsaCurve<9> SignatureCurve = {
+    &OrderModulus, 521, KeySize, BaseMulX, DoubleMulX, nullptr
+};
+
+P521::P521() = default;
+
+P521::~P521()
+{
+    reset();
+}
+
+Status
+P521::setPrivateKey(const Uint8* pPrivKey)
+{
+    if (!IsValidPrivateKey(pPrivKey)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Invalid private key");
+    }
+    alcp::utils::CopyBytes(m_PrivKey, pPrivKey, KeySize);
+    return StatusOk();
+}
+
+Status
+P521::generatePublicKey(Uint8* pPublicKey, const Uint8* pPrivKey)
+{
+    Status status = setPrivateKey(pPrivKey);
+    if (!status.ok()) {
+        return status;
+    }
+
+    p521::Point point;
+    Uint64      x[9], y[9];
+    p521::ScalarMulBase(point, m_PrivKey);
+    p521::PointToAffine(x, y, point);
+    p521::FeToBytes(pPublicKey, x);
+    p521::FeToBytes(pPublicKey + KeySize, y);
+    return status;
+}
+
+Status
+P521::computeSecretKey(Uint8*       pSecretKey,
+                       const Uint8* pPublicKey,
+                       Uint64*      pKeyLength)
+{
+    // the private key is zero until it is set
+    if (!IsValidPrivateKey(m_PrivKey)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Invalid private key");
+    }
+
+    p521::Point peer, point;
+    Uint64      x[9], y[9];
+    if (!p521::DecodePoint(peer, pPublicKey)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Key validation failed");
+    }
+    p521::ScalarMul(point, m_PrivKey, peer);
+    p521::PointToAffine(x, y, point);
+    p521::FeToBytes(pSecretKey, x);
+
+    *pKeyLength = KeySize;
+    return StatusOk();
+}
+
+Status
+P521::validatePublicKey(const Uint8* pPublicKey, Uint64 pKeyLength)
+{
+    // affine x and y, the curve has no small subgroups to check for
+    p521::Point point;
+    if (pKeyLength != KeySize * 2 || !p521::DecodePoint(point, pPublicKey)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Key validation failed");
+    }
+    return StatusOk();
+}
+
+Status
+P521::sign(const Uint8* pDigest, Uint64 digestSize, Uint8* pSignature)
+{
+    return EcdsaSign<9>(
+        SignatureCurve, m_PrivKey, pDigest, digestSize, pSignature);
+}
+
+Status
+P521::verify(const Uint8* pDigest,
+             Uint64       digestSize,
+             const Uint8* pSignature,
+             const Uint8* pPublicKey)
+{
+    return EcdsaVerify<9>(
+        SignatureCurve, pPublicKey, pDigest, digestSize, pSignature);
+}
+
+Uint64
+P521::getKeySize()
+{
+    return KeySize;
+}
+
+void
+P521::reset()
+{
+    // clear private key with zeros
+    alcp::utils::PadBytes(m_PrivKey, 0, KeySize);
+}
+
+} // namespace alcp::ec
@@ -29,6 +29,7 @@
 #include "alcp/ec/ecdh_avx2.hh"
 #include "alcp/ec/ecdh_zen.hh"
 #include "alcp/ec/ecdh_zen3.hh"
+#include "alcp/ec/ecdh_zen4.hh"
 #include "alcp/utils/copy.hh"
 #include "alcp/utils/cpuid.hh"
 #include "config.h"
@@ -39,6 +40,29 @@ namespace alcp::ec {
 using alcp::utils::CpuId;
 static constexpr Uint32 KeySize = 32;
 
+static void
+ScalarMul(Uint8* pSecretKey, const Uint8* pScalar, const Uint8* pPublicKey)
+{
+    static bool zen2_available = CpuId::cpuIsZen2();
+    static bool zen3_available = CpuId::cpuIsZen3() || CpuId::cpuIsZen4();
+
+    if (zen3_available) {
+        zen3::alcpScalarMulX25519(pSecretKey, pScalar, pPublicKey);
+    } else if (zen2_available) {
+        avx2::alcpScalarMulX25519(pSecretKey, pScalar, pPublicKey);
+    } else {
+        zen::alcpScalarMulX25519(pSecretKey, pScalar, pPublicKey);
+    }
+}
+
+static void
+ClampScalar(Uint8* pScalar)
+{
+    pScalar[0] &= 248;
+    pScalar[31] &= 127;
+    pScalar[31] |= 64;
+}
+
 X25519::X25519() = default;
 
 X25519::~X25519()
@@ -49,8 +73,9 @@ X25519::~X25519()
 Status
 X25519::setPrivateKey(const Uint8* pPrivKey)
 {
-    // store private key for secret key generation
+    // store private key for secret key generation, decoded as in RFC 7748
     alcp::utils::CopyBytes(m_PrivKey, pPrivKey, KeySize);
+    ClampScalar(m_PrivKey);
     return StatusOk();
 }
 
@@ -73,10 +98,7 @@ X25519::generatePublicKey(Uint8* pPublicKey, const Uint8* pPrivKey)
 
     // store private key for secret key generation
     alcp::utils::CopyBytes(m_PrivKey, pPrivKey, KeySize);
-
-    m_PrivKey[0] &= 248;
-    m_PrivKey[31] &= 127;
-    m_PrivKey[31] |= 64;
+    ClampScalar(m_PrivKey);
 
     Int8 priv_key_radix32[52];
 
@@ -146,21 +168,79 @@ X25519::computeSecretKey(Uint8*       pSecretKey,
         return status;
     }
 
-    static bool zen2_available = CpuId::cpuIsZen2();
-    static bool zen3_available = CpuId::cpuIsZen3() || CpuId::cpuIsZen4();
-
-    if (zen3_available) {
-        zen3::alcpScalarMulX25519(pSecretKey, m_PrivKey, pPublicKey);
-    } else if (zen2_available) {
-        avx2::alcpScalarMulX25519(pSecretKey, m_PrivKey, pPublicKey);
-    } else {
-        zen::alcpScalarMulX25519(pSecretKey, m_PrivKey, pPublicKey);
-    }
+    ScalarMul(pSecretKey, m_PrivKey, pPublicKey);
 
     *pKeyLength = KeySize;
     return status;
 }
 
+Status
+X25519::computeSecretKeyBatch(Uint8*       pSecretKeys,
+                              const Uint8* pPrivKeys,
+                              const Uint8* pPublicKeys,
+                              Uint64       count)
+{
+    static constexpr Uint64 Lanes = 8;
+
+    static bool has_adx  = CpuId::cpuHasAdx();
+    static bool has_bmi2 = CpuId::cpuHasBmi2();
+    static bool has_ifma = CpuId::cpuHasAvx512(utils::AVX512_F)
+                           && CpuId::cpuHasAvx512(utils::AVX512_DQ)
+                           && CpuId::cpuHasAvx512(utils::AVX512_IFMA);
+
+    if (!has_adx) {
+        return status::NotAvailable("ADX instruction set not supported");
+    }
+
+    if (!has_bmi2) {
+        return status::NotAvailable("MULX instruction set not supported");
+    }
+
+    for (Uint64 i = 0; i < count; i++) {
+        Status status = validatePublicKey(pPublicKeys + i * KeySize, KeySize);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    Uint8 scalars[Lanes * KeySize];
+    Uint8 points[Lanes * KeySize];
+    Uint8 secrets[Lanes * KeySize];
+
+    for (Uint64 done = 0; done < count;) {
+        // a short tail fills the unused lanes with its first key
+        Uint64 n = count - done < Lanes ? count - done : Lanes;
+        for (Uint64 lane = 0; lane < Lanes; lane++) {
+            Uint64 index = done + (lane < n ? lane : 0);
+            alcp::utils::CopyBytes(
+                scalars + lane * KeySize, pPrivKeys + index * KeySize, KeySize);
+            alcp::utils::CopyBytes(points + lane * KeySize,
+                                   pPublicKeys + index * KeySize,
+                                   KeySize);
+            ClampScalar(scalars + lane * KeySize);
+            // RFC 7748 5, the top bit of the u-coordinate is ignored
+            points[lane * KeySize + KeySize - 1] &= 127;
+        }
+
+        if (has_ifma) {
+            zen4::alcpScalarMulX25519Radix51BitX8(secrets, scalars, points);
+        } else {
+            for (Uint64 lane = 0; lane < n; lane++) {
+                ScalarMul(secrets + lane * KeySize,
+                          scalars + lane * KeySize,
+                          points + lane * KeySize);
+            }
+        }
+        alcp::utils::CopyBytes(
+            pSecretKeys + done * KeySize, secrets, n * KeySize);
+        done += n;
+    }
+
+    alcp::utils::PadBytes(scalars, 0, sizeof(scalars));
+    alcp::utils::PadBytes(secrets, 0, sizeof(secrets));
+    return StatusOk();
+}
+
 Status
 X25519::validatePublicKey(const Uint8* pPublicKey, Uint64 pKeyLength)
 {
@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <memory>
+
+#include "alcp/digest/sha2.hh"
+#include "alcp/digest/sha2_384.hh"
+#include "alcp/digest/sha2_512.hh"
+#include "alcp/ec/ecdsa.hh"
+#include "alcp/mac/hmac.hh"
+#include "alcp/utils/copy.hh"
+
+namespace alcp::ec {
+
+using namespace weierstrass;
+
+static constexpr Uint64 MaxSize       = 66; // P-521
+static constexpr Uint64 MaxHashSize   = 64;
+static constexpr Uint64 MaxHmacString = MaxHashSize + 1 + 2 * MaxSize;
+
+/*
+ * bits2int of RFC 6979, the leftmost order-length bits of pBytes. The result
+ * is below 2^orderBits, callers reduce it when they need it below n
+ */
+template<int N>
+static void
+BitsToInt(Uint64             r[N],
+          const Uint8*       pBytes,
+          Uint64             size,
+          const EcdsaCurve<N>& rCurve)
+{
+    Uint64 take = size < rCurve.m_size ? size : rCurve.m_size;
+    FromBytes<N>(r, pBytes, take);
+
+    Uint64 shift = take * 8 > rCurve.m_orderBits ? take * 8 - rCurve.m_orderBits
+                                                 : 0;
+    if (shift) {
+        for (int i = 0; i < N - 1; i++) {
+            r[i] = (r[i] >> shift) | (r[i + 1] << (64 - shift));
+        }
+        r[N - 1] >>= shift;
+    }
+}
+
+// a below 2 * n to a below n
+template<int N>
+static void
+ReduceOnce(Uint64 r[N], const Uint64 a[N], const Modulus<N>& n)
+{
+    Uint64 t[N];
+    Uint64 borrow = SubLimbs<N>(t, a, n.m_value);
+    Select<N>(r, a, t, 0 - borrow);
+}
+
+// 0 < a < n
+template<int N>
+static bool
+IsScalarInRange(const Uint64 a[N], const Modulus<N>& n)
+{
+    return !ZeroMask<N>(a) && IsLess<N>(a, n.m_value);
+}
+
+// r = a^-1 mod n in the Montgomery domain, on the curve's kernel if it has one
+template<int N>
+static void
+OrderInverse(Uint64 r[N], const Uint64 a[N], const EcdsaCurve<N>& rCurve)
+{
+    if (rCurve.m_orderInverse != nullptr) {
+        rCurve.m_orderInverse(r, a);
+    } else {
+        MontInverse<N>(r, a, *rCurve.m_pOrder);
+    }
+}
+
+/*
+ * Deterministic nonces of RFC 6979 section 3.2, HMAC_DRBG keyed with the
+ * private key and the reduced digest
+ */
+template<int N>
+class NonceGenerator
+{
+  public:
+    NonceGenerator(const EcdsaCurve<N>& rCurve,
+                   const Uint8*         pPrivKey,
+                   const Uint64         e[N])
+        : m_curve{ rCurve }
+    {
+        if (rCurve.m_size <= 32) {
+            useDigest<digest::Sha256>();
+        } else if (rCurve.m_size <= 48) {
+            useDigest<digest::Sha384>();
+        } else {
+            useDigest<digest::Sha512>();
+        }
+
+        Uint8  msg[MaxHmacString];
+        Uint64 size = rCurve.m_size;
+        utils::PadBytes(m_v, 0x01, m_hashSize);
+        utils::PadBytes(m_k, 0x00, m_hashSize);
+
+        // V || 0x00 || int2octets(x) || bits2octets(h1), then with 0x01
+        for (Uint8 sep = 0; sep < 2; sep++) {
+            utils::CopyBytes(msg, m_v, m_hashSize);
+            msg[m_hashSize] = sep;
+            utils::CopyBytes(msg + m_hashSize + 1, pPrivKey, size);
+            ToBytes<N>(msg + m_hashSize + 1 + size, e, size);
+            hmac(m_k, msg, m_hashSize + 1 + 2 * size);
+            hmac(m_v, m_v, m_hashSize);
+        }
+        utils::PadBytes(msg, 0, sizeof(msg));
+    }
+
+    ~NonceGenerator()
+    {
+        utils::PadBytes(m_k, 0, sizeof(m_k));
+        utils::PadBytes(m_v, 0, sizeof(m_v));
+    }
+
+    // next candidate k with 0 < k < n
+    void next(Uint64 k[N])
+    {
+        Uint8 t[MaxSize + MaxHashSize];
+        for (;;) {
+            Uint64 len = 0;
+            while (len < m_curve.m_size) {
+                hmac(m_v, m_v, m_hashSize);
+                utils::CopyBytes(t + len, m_v, m_hashSize);
+                len += m_hashSize;
+            }
+            BitsToInt<N>(k, t, m_curve.m_size, m_curve);
+            bool found = IsScalarInRange<N>(k, *m_curve.m_pOrder);
+
+            // K = HMAC_K(V || 0x00), V = HMAC_K(V) readies the next call
+            Uint8 msg[MaxHashSize + 1];
+            utils::CopyBytes(msg, m_v, m_hashSize);
+            msg[m_hashSize] = 0;
+            hmac(m_k, msg, m_hashSize + 1);
+            hmac(m_v, m_v, m_hashSize);
+            if (found) {
+                break;
+            }
+        }
+        utils::PadBytes(t, 0, sizeof(t));
+    }
+
+  private:
+    template<typename DIGEST>
+    void useDigest()
+    {
+        auto digest = std::make_unique<DIGEST>();
+        m_hmac.setDigest(*digest);
+        m_hashSize = digest->getHashSize();
+        m_digest   = std::move(digest);
+    }
+
+    // pOut = HMAC_K(pMsg), pOut may be K or V
+    void hmac(Uint8* pOut, const Uint8* pMsg, Uint64 size)
+    {
+        Uint8 mac[MaxHashSize];
+        m_hmac.setKey(m_k, m_hashSize);
+        m_hmac.finalize(pMsg, size);
+        m_hmac.copyHash(mac, m_hashSize);
+        utils::CopyBytes(pOut, mac, m_hashSize);
+    }
+
+    const EcdsaCurve<N>&             m_curve;
+    std::unique_ptr<digest::IDigest> m_digest;
+    mac::Hmac                        m_hmac;
+    Uint64                           m_hashSize;
+    Uint8                            m_k[MaxHashSize];
+    Uint8                            m_v[MaxHashSize];
+};
+
+template<int N>
+Status
+EcdsaSign(const EcdsaCurve<N>& rCurve,
+          const Uint8*         pPrivKey,
+          const Uint8*         pDigest,
+          Uint64               digestSize,
+          Uint8*               pSignature)
+{
+    const Modulus<N>& n    = *rCurve.m_pOrder;
+    const Uint64      size = rCurve.m_size;
+    Uint64            d[N], e[N], k[N], r[N], s[N], t[N];
+    Uint8             buf[MaxSize], x[MaxSize];
+
+    FromBytes<N>(d, pPrivKey, size);
+    if (!IsScalarInRange<N>(d, n)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Invalid private key");
+    }
+    BitsToInt<N>(e, pDigest, digestSize, rCurve);
+    ReduceOnce<N>(e, e, n);
+
+    NonceGenerator<N> nonce(rCurve, pPrivKey, e);
+    ToMont<N>(d, d, n);
+    ToMont<N>(e, e, n);
+    for (;;) {
+        nonce.next(k);
+
+        // r = x(k * G) mod n, x < p < 2 * n
+        ToBytes<N>(buf, k, size);
+        rCurve.m_baseMulX(x, buf);
+        FromBytes<N>(r, x, size);
+        ReduceOnce<N>(r, r, n);
+        if (ZeroMask<N>(r)) {
+            continue;
+        }
+
+        // s = k^-1 * (e + r * d) mod n
+        ToMont<N>(t, r, n);
+        MontMul<N>(t, t, d, n);
+        ModAdd<N>(t, t, e, n);
+        ToMont<N>(k, k, n);
+        OrderInverse<N>(k, k, rCurve);
+        MontMul<N>(s, k, t, n);
+        FromMont<N>(s, s, n);
+        if (!ZeroMask<N>(s)) {
+            break;
+        }
+    }
+    ToBytes<N>(pSignature, r, size);
+    ToBytes<N>(pSignature + size, s, size);
+
+    utils::PadBytes(reinterpret_cast<Uint8*>(d), 0, sizeof(d));
+    utils::PadBytes(reinterpret_cast<Uint8*>(k), 0, sizeof(k));
+    utils::PadBytes(reinterpret_cast<Uint8*>(t), 0, sizeof(t));
+    utils::PadBytes(buf, 0, sizeof(buf));
+    return StatusOk();
+}
+
+template<int N>
+Status
+EcdsaVerify(const EcdsaCurve<N>& rCurve,
+            const Uint8*         pPublicKey,
+            const Uint8*         pDigest,
+            Uint64               digestSize,
+            const Uint8*         pSignature)
+{
+    const Modulus<N>& n    = *rCurve.m_pOrder;
+    const Uint64      size = rCurve.m_size;
+    Uint64            e[N], r[N], s[N], w[N], x[N];
+    Uint8             u1[MaxSize], u2[MaxSize], point[MaxSize];
+
+    FromBytes<N>(r, pSignature, size);
+    FromBytes<N>(s, pSignature + size, size);
+    if (!IsScalarInRange<N>(r, n) || !IsScalarInRange<N>(s, n)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Signature verification failed");
+    }
+    BitsToInt<N>(e, pDigest, digestSize, rCurve);
+    ReduceOnce<N>(e, e, n);
+
+    // w = s^-1 in the Montgomery domain, so u1 = e * w and u2 = r * w come
+    // out of the multiplication in the normal domain
+    ToMont<N>(w, s, n);
+    OrderInverse<N>(w, w, rCurve);
+    MontMul<N>(e, e, w, n);
+    MontMul<N>(w, r, w, n);
+    ToBytes<N>(u1, e, size);
+    ToBytes<N>(u2, w, size);
+
+    if (!rCurve.m_doubleMulX(point, u1, u2, pPublicKey)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Signature verification failed");
+    }
+    FromBytes<N>(x, point, size);
+    ReduceOnce<N>(x, x, n);
+
+    Uint64 diff[N];
+    SubLimbs<N>(diff, x, r);
+    if (!ZeroMask<N>(diff)) {
+        return Status(GenericError(ErrorCode::eInvalidArgument),
+                      "Signature verification failed");
+    }
+    return StatusOk();
+}
+
+template Status
+EcdsaSign<4>(const EcdsaCurve<4>&, const Uint8*, const Uint8*, Uint64, Uint8*);
+template Status
+EcdsaSign<6>(const EcdsaCurve<6>&, const Uint8*, const Uint8*, Uint64, Uint8*);
+template Status
+EcdsaSign<9>(const EcdsaCurve<9>&, const Uint8*, const Uint8*, Uint64, Uint8*);
+template Status
+EcdsaVerify<4>(const EcdsaCurve<4>&,
+               const Uint8*,
+               const Uint8*,
+               Uint64,
+               const Uint8*);
+template Status
+EcdsaVerify<6>(const EcdsaCurve<6>&,
+               const Uint8*,
+               const Uint8*,
+               Uint64,
+               const Uint8*);
+template Status
+EcdsaVerify<9>(const EcdsaCurve<9>&,
+               const Uint8*,
+               const Uint8*,
+               Uint64,
+               const Uint8*);
+
+} // namespace alcp::ec
@@ -0,0 +1,436 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <memory>
+
+#include "alcp/digest/sha2_512.hh"
+#include "alcp/ec/eddsa.hh"
+#include "alcp/ec/ecdh_zen.hh"
+#include "alcp/ec/ecdh_zen3.hh"
+#include "alcp/ec/weierstrass.hh"
+#include "alcp/utils/copy.hh"
+#include "alcp/utils/cpuid.hh"
+
+namespace alcp::ec {
+
+using alcp::utils::CpuId;
+using namespace weierstrass;
+
+static constexpr Uint64 KeySize       = 32;
+static constexpr Uint64 SignatureSize = 64;
+static constexpr Uint64 HashSize      = 64;
+
+// signatures combined in one multi scalar multiplication
+static constexpr Uint64 BatchSize = 64;
+
+// clang-format off
+// L = 2^252 + 27742317777372353535851937790883648493, the group order
+static constexpr Modulus<4> GroupOrder = {
+    { 0x5812631a5cf5d3ed, 0x14def9dea2f79cd6,
+      0x0000000000000000, 0x1000000000000000 },
+    0xd2b51da312547e1b,
+    { 0xa40611e3449c0f01, 0xd00e1ba768859347,
+      0xceec73d217f5be65, 0x0399411b7c309a3d },
+    { 0xd6ec31748d98951d, 0xc6ef5bf4737dcf70,
+      0xfffffffffffffffe, 0x0fffffffffffffff },
+};
+
+// R^3 mod L, R = 2^256
+static constexpr Uint64 RCube[4] = { 0x2a9e49687b83a2db, 0x278324e6aef7f3ec,
+                                     0x8065dc6c04ec5b65, 0x0e530b773599cec7 };
+// clang-format on
+
+static void
+LoadScalar(Uint64 r[4], const Uint8* pBytes)
+{
+    for (int i = 0; i < 4; i++) {
+        r[i] = 0;
+        for (int j = 7; j >= 0; j--) {
+            r[i] = (r[i] << 8) | pBytes[8 * i + j];
+        }
+    }
+}
+
+static void
+StoreScalar(Uint8* pBytes, const Uint64 a[4])
+{
+    for (int i = 0; i < 32; i++) {
+        pBytes[i] = static_cast<Uint8>(a[i / 8] >> (8 * (i % 8)));
+    }
+}
+
+// 64 byte little endian hash to a scalar mod L, in the Montgomery domain
+static void
+ReduceHash(Uint64 r[4], const Uint8* pHash)
+{
+    Uint64 lo[4], hi[4];
+
+    LoadScalar(lo, pHash);
+    LoadScalar(hi, pHash + 32);
+
+    // (lo + hi * R) * R = lo * R^2 / R + hi * R^3 / R
+    MontMul<4>(lo, lo, GroupOrder.m_rSquare, GroupOrder);
+    MontMul<4>(hi, hi, RCube, GroupOrder);
+    ModAdd<4>(r, lo, hi, GroupOrder);
+}
+
+// S < L, RFC 8032 rejects non canonical S
+static bool
+IsCanonicalScalar(const Uint8* pBytes)
+{
+    Uint64 s[4];
+    LoadScalar(s, pBytes);
+    return IsLess<4>(s, GroupOrder.m_value);
+}
+
+// SHA-512 of the concatenated parts, which may be empty
+static void
+Hash(Uint8*             pOut,
+     const Uint8* const pParts[],
+     const Uint64       pSizes[],
+     int                count)
+{
+    digest::Sha512 sha;
+    for (int i = 0; i < count; i++) {
+        if (pSizes[i]) {
+            sha.update(pParts[i], pSizes[i]);
+        }
+    }
+    sha.finalize(nullptr, 0);
+    sha.copyHash(pOut, HashSize);
+}
+
+static bool
+CpuSupported()
+{
+    static bool has_adx  = CpuId::cpuHasAdx();
+    static bool has_bmi2 = CpuId::cpuHasBmi2();
+    return has_adx && has_bmi2;
+}
+
+static bool
+UseZen3()
+{
+    static bool zen3_available = CpuId::cpuIsZen3() || CpuId::cpuIsZen4();
+    return zen3_available;
+}
+
+static void
+ScalarMulBase(Uint8* pPoint, const Uint8* pScalar)
+{
+    if (UseZen3()) {
+        zen3::AlcpScalarPubEd25519(pPoint, pScalar);
+    } else {
+        zen::AlcpScalarPubEd25519(pPoint, pScalar);
+    }
+}
+
+static bool
+VerifyEquation(const Uint8* pR,
+               const Uint8* pS,
+               const Uint8* pK,
+               const Uint8* pPublicKey)
+{
+    return UseZen3() ? zen3::AlcpVerifyEd25519(pR, pS, pK, pPublicKey)
+                     : zen::AlcpVerifyEd25519(pR, pS, pK, pPublicKey);
+}
+
+static bool
+MultiScalarMul(const Uint8* pBaseScalar,
+               const Uint8* pScalars,
+               const Uint8* pPoints,
+               Uint64       count)
+{
+    return UseZen3() ? zen3::AlcpMultiScalarMulEd25519(
+               pBaseScalar, pScalars, pPoints, count)
+                     : zen::AlcpMultiScalarMulEd25519(
+                         pBaseScalar, pScalars, pPoints, count);
+}
+
+static Status
+VerificationFailed()
+{
+    return Status(GenericError(ErrorCode::eInvalidArgument),
+                  "Signature verification failed");
+}
+
+Ed25519::Ed25519() = default;
+
+Ed25519::~Ed25519()
+{
+    reset();
+}
+
+Status
+Ed25519::setPrivateKey(const Uint8* pPrivKey)
+{
+    if (!CpuSupported()) {
+        return status::NotAvailable(
+            "Not supported due to missing instruction set");
+    }
+
+    Uint8              h[HashSize];
+    const Uint8* const parts[] = { pPrivKey };
+    const Uint64       sizes[] = { KeySize };
+
+    Hash(h, parts, sizes, 1);
+    utils::CopyBytes(m_PrivKey, pPrivKey, KeySize);
+    utils::CopyBytes(m_Scalar, h, KeySize);
+    utils::CopyBytes(m_Prefix, h + KeySize, KeySize);
+    utils::PadBytes(h, 0, sizeof(h));
+
+    m_Scalar[0] &= 248;
+    m_Scalar[31] &= 127;
+    m_Scalar[31] |= 64;
+
+    ScalarMulBase(m_PublicKey, m_Scalar);
+    return StatusOk();
+}
+
+Status
+Ed25519::generatePublicKey(Uint8* pPublicKey, const Uint8* pPrivKey)
+{
+    Status status = setPrivateKey(pPrivKey);
+    if (status.ok()) {
+        utils::CopyBytes(pPublicKey, m_PublicKey, KeySize);
+    }
+    return status;
+}
+
+Status
+Ed25519::sign(const Uint8* pMessage, Uint64 messageSize, Uint8* pSignature)
+{
+    if (!CpuSupported()) {
+        return status::NotAvailable(
+            "Not supported due to missing instruction set");
+    }
+
+    Uint8  h[HashSize], rBytes[KeySize], big[KeySize];
+    Uint64 r[4], k[4], a[4], s[4];
+
+    // r = SHA-512(prefix || M), R = [r]B
+    const Uint8* const nonceParts[] = { m_Prefix, pMessage };
+    const Uint64       nonceSizes[] = { KeySize, messageSize };
+    Hash(h, nonceParts, nonceSizes, 2);
+    ReduceHash(r, h);
+    FromMont<4>(s, r, GroupOrder);
+    StoreScalar(rBytes, s);
+    ScalarMulBase(big, rBytes);
+
+    // k = SHA-512(R || A || M), S = r + k * a
+    const Uint8* const parts[] = { big, m_PublicKey, pMessage };
+    const Uint64       sizes[] = { KeySize, KeySize, messageSize };
+    Hash(h, parts, sizes, 3);
+    ReduceHash(k, h);
+    LoadScalar(a, m_Scalar);
+    ToMont<4>(a, a, GroupOrder);
+    MontMul<4>(k, k, a, GroupOrder);
+    ModAdd<4>(s, r, k, GroupOrder);
+    FromMont<4>(s, s, GroupOrder);
+
+    utils::CopyBytes(pSignature, big, KeySize);
+    StoreScalar(pSignature + KeySize, s);
+
+    utils::PadBytes(h, 0, sizeof(h));
+    utils::PadBytes(rBytes, 0, sizeof(rBytes));
+    utils::PadBytes(reinterpret_cast<Uint8*>(r), 0, sizeof(r));
+    utils::PadBytes(reinterpret_cast<Uint8*>(a), 0, sizeof(a));
+    return StatusOk();
+}
+
+Status
+Ed25519::verify(const Uint8* pMessage,
+                Uint64       messageSize,
+                const Uint8* pSignature,
+                const Uint8* pPublicKey)
+{
+    if (!CpuSupported()) {
+        return status::NotAvailable(
+            "Not supported due to missing instruction set");
+    }
+
+    const Uint8* p_s = pSignature + KeySize;
+    if (!IsCanonicalScalar(p_s)) {
+        return VerificationFailed();
+    }
+
+    Uint8              h[HashSize], kBytes[KeySize];
+    Uint64             k[4];
+    const Uint8* const parts[] = { pSignature, pPublicKey, pMessage };
+    const Uint64       sizes[] = { KeySize, KeySize, messageSize };
+
+    Hash(h, parts, sizes, 3);
+    ReduceHash(k, h);
+    FromMont<4>(k, k, GroupOrder);
+    StoreScalar(kBytes, k);
+
+    // [8][S]B == [8]R + [8][k]A, the cofactored equation of verifyBatch
+    if (!VerifyEquation(pSignature, p_s, kBytes, pPublicKey)) {
+        return VerificationFailed();
+    }
+    return StatusOk();
+}
+
+/*
+ * Every signature i gets a 128 bit weight z_i derived from a hash of the
+ * whole chunk, then
+ * [-sum z_i * S_i]B + sum [z_i]R_i + sum [z_i * k_i]A_i
+ * must be of small order. A forger would need to predict the weights
+ */
+Status
+Ed25519::verifyBatch(const Uint8* const pMessages[],
+                     const Uint64       pMessageSizes[],
+                     const Uint8* const pSignatures[],
+                     const Uint8* const pPublicKeys[],
+                     Uint64             count,
+                     bool               pValid[])
+{
+    if (!CpuSupported()) {
+        return status::NotAvailable(
+            "Not supported due to missing instruction set");
+    }
+
+    auto digests  = std::make_unique<digest::Sha512[]>(BatchSize);
+    auto scalars  = std::make_unique<Uint8[]>(2 * BatchSize * KeySize);
+    auto points   = std::make_unique<Uint8[]>(2 * BatchSize * KeySize);
+    bool allValid = true;
+
+    for (Uint64 base = 0; base < count; base += BatchSize) {
+        Uint64 n = count - base < BatchSize ? count - base : BatchSize;
+        digest::Sha512* p_digests[BatchSize];
+        digest::Sha512  transcript;
+        Uint8           h[HashSize], seed[HashSize];
+        Uint64          sum[4] = {}, k[4], s[4], z[4], t[4];
+        bool            combined = true;
+
+        // k_i = SHA-512(R_i || A_i || M_i), the messages hashed side by side
+        for (Uint64 i = 0; i < n; i++) {
+            digests[i].reset();
+            digests[i].update(pSignatures[base + i], KeySize);
+            digests[i].update(pPublicKeys[base + i], KeySize);
+            p_digests[i] = &digests[i];
+        }
+        digest::Sha512::updateMulti(
+            p_digests, pMessages + base, pMessageSizes + base, n);
+
+        for (Uint64 i = 0; i < n; i++) {
+            const Uint8* p_sig = pSignatures[base + i];
+            combined           = combined && IsCanonicalScalar(p_sig + KeySize);
+
+            digests[i].finalize(nullptr, 0);
+            digests[i].copyHash(h, HashSize);
+            transcript.update(p_sig, SignatureSize);
+            transcript.update(pPublicKeys[base + i], KeySize);
+            transcript.update(h, HashSize);
+
+            // A_i takes the scalar slot of R_i for now, weighted below
+            ReduceHash(k, h);
+            StoreScalar(&scalars[(2 * i + 1) * KeySize], k);
+            utils::CopyBytes(&points[2 * i * KeySize], p_sig, KeySize);
+            utils::CopyBytes(
+                &points[(2 * i + 1) * KeySize], pPublicKeys[base + i], KeySize);
+        }
+        transcript.finalize(nullptr, 0);
+        transcript.copyHash(seed, HashSize);
+
+        for (Uint64 i = 0; combined && i < n; i++) {
+            // four weights per hash of seed || block
+            if (i % 4 == 0) {
+                Uint8              block[8];
+                const Uint8* const parts[] = { seed, block };
+                const Uint64       sizes[] = { HashSize, sizeof(block) };
+                for (int j = 0; j < 8; j++) {
+                    block[j] = static_cast<Uint8>((i / 4) >> (8 * j));
+                }
+                Hash(h, parts, sizes, 2);
+            }
+            Uint8 zBytes[KeySize] = {};
+            utils::CopyBytes(zBytes, h + 16 * (i % 4), 16);
+            LoadScalar(z, zBytes);
+
+            // S_i in the Montgomery domain, so that z * S_i comes out plain
+            LoadScalar(s, pSignatures[base + i] + KeySize);
+            ToMont<4>(s, s, GroupOrder);
+            MontMul<4>(t, z, s, GroupOrder);
+            ModAdd<4>(sum, sum, t, GroupOrder);
+
+            LoadScalar(k, &scalars[(2 * i + 1) * KeySize]);
+            MontMul<4>(t, z, k, GroupOrder);
+            StoreScalar(&scalars[(2 * i + 1) * KeySize], t);
+            utils::CopyBytes(&scalars[2 * i * KeySize], zBytes, KeySize);
+        }
+
+        if (combined) {
+            const Uint64 zero[4] = {};
+            Uint8        baseScalar[KeySize];
+            ModSub<4>(sum, zero, sum, GroupOrder);
+            StoreScalar(baseScalar, sum);
+            combined =
+                MultiScalarMul(baseScalar, &scalars[0], &points[0], 2 * n);
+        }
+
+        if (combined) {
+            for (Uint64 i = 0; pValid && i < n; i++) {
+                pValid[base + i] = true;
+            }
+            continue;
+        }
+
+        // find the bad ones
+        for (Uint64 i = 0; i < n; i++) {
+            bool valid = verify(pMessages[base + i],
+                                pMessageSizes[base + i],
+                                pSignatures[base + i],
+                                pPublicKeys[base + i])
+                             .ok();
+            allValid   = allValid && valid;
+            if (pValid) {
+                pValid[base + i] = valid;
+            }
+        }
+    }
+
+    return allValid ? StatusOk() : VerificationFailed();
+}
+
+void
+Ed25519::reset()
+{
+    utils::PadBytes(m_PrivKey, 0, KeySize);
+    utils::PadBytes(m_Scalar, 0, KeySize);
+    utils::PadBytes(m_Prefix, 0, KeySize);
+    utils::PadBytes(m_PublicKey, 0, KeySize);
+}
+
+Uint64
+Ed25519::getKeySize()
+{
+    return KeySize;
+}
+
+} // namespace alcp::ec
@@ -0,0 +1,395 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <string.h>
+
+#include "alcp/base.hh"
+#include "alcp/ec/ecdh.hh"
+#include "alcp/types.hh"
+
+using alcp::ec::P256;
+using alcp::ec::P384;
+using alcp::ec::P521;
+
+struct SignatureVector
+{
+    std::vector<Uint8> privKey;
+    std::vector<Uint8> publicKey;
+    std::vector<Uint8> digest;
+    std::vector<Uint8> signature;
+};
+
+// RFC 6979 A.2.5 and A.2.6, message "sample" with SHA-256 and SHA-384
+// clang-format off
+static const SignatureVector P256Sample = {
+    { // Private Key
+      0xc9,0xaf,0xa9,0xd8,0x45,0xba,0x75,0x16,
+      0x6b,0x5c,0x21,0x57,0x67,0xb1,0xd6,0x93,
+      0x4e,0x50,0xc3,0xdb,0x36,0xe8,0x9b,0x12,
+      0x7b,0x8a,0x62,0x2b,0x12,0x0f,0x67,0x21 },
+    { // Public Key
+      // affine(X,Y)
+      0x60,0xfe,0xd4,0xba,0x25,0x5a,0x9d,0x31,
+      0xc9,0x61,0xeb,0x74,0xc6,0x35,0x6d,0x68,
+      0xc0,0x49,0xb8,0x92,0x3b,0x61,0xfa,0x6c,
+      0xe6,0x69,0x62,0x2e,0x60,0xf2,0x9f,0xb6,
+      0x79,0x03,0xfe,0x10,0x08,0xb8,0xbc,0x99,
+      0xa4,0x1a,0xe9,0xe9,0x56,0x28,0xbc,0x64,
+      0xf2,0xf1,0xb2,0x0c,0x2d,0x7e,0x9f,0x51,
+      0x77,0xa3,0xc2,0x94,0xd4,0x46,0x22,0x99 },
+    { // Digest
+      0xaf,0x2b,0xdb,0xe1,0xaa,0x9b,0x6e,0xc1,
+      0xe2,0xad,0xe1,0xd6,0x94,0xf4,0x1f,0xc7,
+      0x1a,0x83,0x1d,0x02,0x68,0xe9,0x89,0x15,
+      0x62,0x11,0x3d,0x8a,0x62,0xad,0xd1,0xbf },
+    { // Signature
+      // r
+      0xef,0xd4,0x8b,0x2a,0xac,0xb6,0xa8,0xfd,
+      0x11,0x40,0xdd,0x9c,0xd4,0x5e,0x81,0xd6,
+      0x9d,0x2c,0x87,0x7b,0x56,0xaa,0xf9,0x91,
+      0xc3,0x4d,0x0e,0xa8,0x4e,0xaf,0x37,0x16,
+      // s
+      0xf7,0xcb,0x1c,0x94,0x2d,0x65,0x7c,0x41,
+      0xd4,0x36,0xc7,0xa1,0xb6,0xe2,0x9f,0x65,
+      0xf3,0xe9,0x00,0xdb,0xb9,0xaf,0xf4,0x06,
+      0x4d,0xc4,0xab,0x2f,0x84,0x3a,0xcd,0xa8 },
+};
+
+static const SignatureVector P384Sample = {
+    { // Private Key
+      0x6b,0x9d,0x3d,0xad,0x2e,0x1b,0x8c,0x1c,
+      0x05,0xb1,0x98,0x75,0xb6,0x65,0x9f,0x4d,
+      0xe2,0x3c,0x3b,0x66,0x7b,0xf2,0x97,0xba,
+      0x9a,0xa4,0x77,0x40,0x78,0x71,0x37,0xd8,
+      0x96,0xd5,0x72,0x4e,0x4c,0x70,0xa8,0x25,
+      0xf8,0x72,0xc9,0xea,0x60,0xd2,0xed,0xf5 },
+    { // Public Key
+      // affine(X,Y)
+      0xec,0x3a,0x4e,0x41,0x5b,0x4e,0x19,0xa4,
+      0x56,0x86,0x18,0x02,0x9f,0x42,0x7f,0xa5,
+      0xda,0x9a,0x8b,0xc4,0xae,0x92,0xe0,0x2e,
+      0x06,0xaa,0xe5,0x28,0x6b,0x30,0x0c,0x64,
+      0xde,0xf8,0xf0,0xea,0x90,0x55,0x86,0x60,
+      0x64,0xa2,0x54,0x51,0x54,0x80,0xbc,0x13,
+      0x80,0x15,0xd9,0xb7,0x2d,0x7d,0x57,0x24,
+      0x4e,0xa8,0xef,0x9a,0xc0,0xc6,0x21,0x89,
+      0x67,0x08,0xa5,0x93,0x67,0xf9,0xdf,0xb9,
+      0xf5,0x4c,0xa8,0x4b,0x3f,0x1c,0x9d,0xb1,
+      0x28,0x8b,0x23,0x1c,0x3a,0xe0,0xd4,0xfe,
+      0x73,0x44,0xfd,0x25,0x33,0x26,0x47,0x20 },
+    { // Digest
+      0x9a,0x90,0x83,0x50,0x5b,0xc9,0x22,0x76,
+      0xae,0xc4,0xbe,0x31,0x26,0x96,0xef,0x7b,
+      0xf3,0xbf,0x60,0x3f,0x4b,0xbd,0x38,0x11,
+      0x96,0xa0,0x29,0xf3,0x40,0x58,0x53,0x12,
+      0x31,0x3b,0xca,0x4a,0x9b,0x5b,0x89,0x0e,
+      0xfe,0xe4,0x2c,0x77,0xb1,0xee,0x25,0xfe },
+    { // Signature
+      // r
+      0x94,0xed,0xbb,0x92,0xa5,0xec,0xb8,0xaa,
+      0xd4,0x73,0x6e,0x56,0xc6,0x91,0x91,0x6b,
+      0x3f,0x88,0x14,0x06,0x66,0xce,0x9f,0xa7,
+      0x3d,0x64,0xc4,0xea,0x95,0xad,0x13,0x3c,
+      0x81,0xa6,0x48,0x15,0x2e,0x44,0xac,0xf9,
+      0x6e,0x36,0xdd,0x1e,0x80,0xfa,0xbe,0x46,
+      // s
+      0x99,0xef,0x4a,0xeb,0x15,0xf1,0x78,0xce,
+      0xa1,0xfe,0x40,0xdb,0x26,0x03,0x13,0x8f,
+      0x13,0x0e,0x74,0x0a,0x19,0x62,0x45,0x26,
+      0x20,0x3b,0x63,0x51,0xd0,0xa3,0xa9,0x4f,
+      0xa3,0x29,0xc1,0x45,0x78,0x6e,0x67,0x9e,
+      0x7b,0x82,0xc7,0x1a,0x38,0x62,0x8a,0xc8 },
+};
+
+// P-521 with SHA-512, the key of p521_unit_test.cc
+static const SignatureVector P521Sample = {
+    { // Private Key
+      0x01,0x92,0x52,0x4e,0xc3,0xae,0x10,0xb5,
+      0xc9,0x6d,0x49,0x04,0xe0,0x0e,0xe0,0x2c,
+      0x68,0xfb,0xaa,0xb5,0x9c,0x51,0x2b,0x05,
+      0xac,0x7e,0x6b,0xc9,0x29,0x70,0x0b,0xf6,
+      0x68,0x61,0xcc,0x7a,0x79,0x35,0x90,0x77,
+      0xa9,0x3a,0x38,0xf5,0xa6,0xd9,0x31,0x61,
+      0x23,0xe6,0xe3,0xd6,0x6f,0xb9,0x0c,0x6f,
+      0x44,0xcd,0x4c,0xdf,0x23,0x64,0x64,0x88,
+      0xd9,0x85 },
+    { // Public Key
+      // affine(X,Y)
+      0x00,0x58,0x04,0x77,0x2a,0xd5,0xa5,0xb3,
+      0x28,0xac,0x2c,0xab,0x02,0x51,0x75,0x8b,
+      0xaf,0xea,0x17,0x3f,0x40,0x5b,0x78,0xe8,
+      0x41,0x4e,0xbe,0xe1,0x32,0xc1,0x51,0x62,
+      0x19,0xf3,0xda,0x63,0x0e,0x62,0x85,0xfd,
+      0x7d,0xd9,0x89,0xab,0x6d,0xe3,0x0b,0x47,
+      0x5b,0x69,0x6a,0x0e,0x0d,0x3a,0xd9,0x93,
+      0xab,0xcc,0x73,0x31,0x60,0xf1,0x45,0xbf,
+      0x94,0x64,0x00,0x65,0xc3,0xe7,0xf5,0x98,
+      0xf2,0x62,0x1e,0x57,0xce,0x13,0x9a,0x5c,
+      0xb2,0x1b,0x87,0x4e,0x2f,0x2e,0x36,0x38,
+      0x39,0x50,0x1c,0xc6,0x1e,0x0a,0x6d,0xf1,
+      0x22,0xdd,0x11,0x45,0xe4,0xd5,0x7c,0x68,
+      0x6e,0xea,0x2c,0xa1,0x53,0xbf,0xae,0xa7,
+      0x6c,0x5e,0xdb,0x77,0x18,0x06,0xce,0xe4,
+      0x0e,0xc3,0xb3,0x75,0xe7,0xb8,0x52,0xb5,
+      0xd8,0xc1,0x70,0x4a },
+    { // Digest
+      0x39,0xa5,0xe0,0x4a,0xaf,0xf7,0x45,0x5d,
+      0x98,0x50,0xc6,0x05,0x36,0x4f,0x51,0x4c,
+      0x11,0x32,0x4c,0xe6,0x40,0x16,0x96,0x0d,
+      0x23,0xd5,0xdc,0x57,0xd3,0xff,0xd8,0xf4,
+      0x9a,0x73,0x94,0x68,0xab,0x80,0x49,0xbf,
+      0x18,0xee,0xf8,0x20,0xcd,0xb1,0xad,0x6c,
+      0x90,0x15,0xf8,0x38,0x55,0x6b,0xc7,0xfa,
+      0xd4,0x13,0x8b,0x23,0xfd,0xf9,0x86,0xc7 },
+    { // Signature
+      // r
+      0x01,0x83,0x6a,0xcb,0x68,0x43,0xb1,0x52,
+      0xc7,0x48,0xdc,0xb4,0x9f,0x6a,0xf2,0x65,
+      0x9b,0x99,0x49,0x71,0xcb,0x5e,0x02,0xb3,
+      0x89,0x22,0x7e,0x9e,0x0e,0xf2,0xf2,0x1c,
+      0xba,0x5e,0xff,0x53,0x85,0x57,0x3b,0x84,
+      0x09,0x4f,0xe3,0xdb,0xfc,0x8b,0xf1,0x63,
+      0x1e,0x22,0x10,0x1e,0xc8,0x95,0xf0,0xf2,
+      0x39,0x04,0xff,0x85,0x88,0x0f,0xec,0x12,
+      0x12,0x25,
+      // s
+      0x00,0x99,0x6a,0x84,0xbd,0x3c,0x51,0x89,
+      0xdb,0x23,0xd9,0x80,0x6d,0x55,0x43,0xf5,
+      0xdc,0xe0,0x4c,0x73,0xa6,0xc6,0xa9,0xe0,
+      0xca,0xb0,0xfc,0xc4,0x33,0xc1,0x90,0xae,
+      0x54,0x31,0x5f,0x12,0x6d,0x10,0x45,0x1f,
+      0xf0,0xc3,0x54,0x38,0xe3,0xc6,0x78,0x64,
+      0x65,0x9d,0xdf,0x65,0x5e,0x13,0x09,0xa1,
+      0x2a,0xc2,0x1d,0x0d,0x69,0xcd,0x2c,0x38,
+      0xa7,0xbb },
+};
+// clang-format on
+
+template<typename CURVE>
+static void
+CheckKnownAnswer(const SignatureVector& rVector)
+{
+    CURVE              ec;
+    std::vector<Uint8> publicKey(rVector.publicKey.size());
+    std::vector<Uint8> signature(rVector.signature.size());
+
+    ASSERT_TRUE(ec.generatePublicKey(&publicKey[0], &rVector.privKey[0]).ok());
+    EXPECT_EQ(rVector.publicKey, publicKey);
+
+    ASSERT_TRUE(ec.setPrivateKey(&rVector.privKey[0]).ok());
+    ASSERT_TRUE(
+        ec.sign(&rVector.digest[0], rVector.digest.size(), &signature[0])
+            .ok());
+    EXPECT_EQ(rVector.signature, signature);
+
+    EXPECT_TRUE(ec.verify(&rVector.digest[0],
+                          rVector.digest.size(),
+                          &signature[0],
+                          &publicKey[0])
+                    .ok());
+}
+
+template<typename CURVE>
+static void
+CheckRejectTampered(const SignatureVector& rVector)
+{
+    CURVE              ec;
+    std::vector<Uint8> digest    = rVector.digest;
+    std::vector<Uint8> signature = rVector.signature;
+    std::vector<Uint8> publicKey = rVector.publicKey;
+    const Uint64       size      = signature.size() / 2;
+
+    signature[2 * size - 1] ^= 1;
+    EXPECT_FALSE(
+        ec.verify(&digest[0], digest.size(), &signature[0], &publicKey[0])
+            .ok());
+    signature = rVector.signature;
+
+    digest[0] ^= 1;
+    EXPECT_FALSE(
+        ec.verify(&digest[0], digest.size(), &signature[0], &publicKey[0])
+            .ok());
+    digest = rVector.digest;
+
+    // r and s must be in [1, n - 1]
+    memset(&signature[0], 0, size);
+    EXPECT_FALSE(
+        ec.verify(&digest[0], digest.size(), &signature[0], &publicKey[0])
+            .ok());
+    memset(&signature[0], 0xff, size);
+    EXPECT_FALSE(
+        ec.verify(&digest[0], digest.size(), &signature[0], &publicKey[0])
+            .ok());
+    signature = rVector.signature;
+
+    publicKey[2 * size - 1] ^= 1;
+    EXPECT_FALSE(
+        ec.verify(&digest[0], digest.size(), &signature[0], &publicKey[0])
+            .ok());
+}
+
+// Digests shorter than the order are used as is, longer ones truncated
+template<typename CURVE>
+static void
+CheckDigestSizes(const SignatureVector& rVector)
+{
+    CURVE              ec;
+    std::vector<Uint8> signature(rVector.signature.size());
+    std::vector<Uint8> digest(64);
+
+    for (Uint64 i = 0; i < digest.size(); i++) {
+        digest[i] = static_cast<Uint8>(i * 7 + 1);
+    }
+    ASSERT_TRUE(ec.setPrivateKey(&rVector.privKey[0]).ok());
+
+    for (Uint64 size : { 20, 32, 48, 64 }) {
+        ASSERT_TRUE(ec.sign(&digest[0], size, &signature[0]).ok());
+        EXPECT_TRUE(ec.verify(&digest[0],
+                              size,
+                              &signature[0],
+                              &rVector.publicKey[0])
+                        .ok());
+    }
+}
+
+/*
+ * Sign and verify with many keys and digests, so the signing comb, the scalar
+ * inversion and the verification's double multiplication see more than one
+ * set of digits
+ */
+template<typename CURVE>
+static void
+CheckRoundTrip(Uint64 size)
+{
+    std::mt19937_64    rng(size);
+    std::vector<Uint8> privKey(size), publicKey(2 * size);
+    std::vector<Uint8> otherKey(2 * size), signature(2 * size);
+    std::vector<Uint8> digest(size < 64 ? size : 64);
+
+    for (int i = 0; i < 32; i++) {
+        CURVE ec;
+        for (Uint8& b : privKey) {
+            b = static_cast<Uint8>(rng());
+        }
+        for (Uint8& b : digest) {
+            b = static_cast<Uint8>(rng());
+        }
+        // Keep the key below the group order
+        privKey[0] &= size == 66 ? 0x00 : 0x7f;
+
+        ASSERT_TRUE(ec.generatePublicKey(&publicKey[0], &privKey[0]).ok());
+        ASSERT_TRUE(ec.setPrivateKey(&privKey[0]).ok());
+        ASSERT_TRUE(ec.sign(&digest[0], digest.size(), &signature[0]).ok());
+        EXPECT_TRUE(ec.verify(&digest[0],
+                              digest.size(),
+                              &signature[0],
+                              &publicKey[0])
+                        .ok())
+            << i;
+
+        // A signature only verifies under its own digest and key
+        if (i > 0) {
+            EXPECT_FALSE(ec.verify(&digest[0],
+                                   digest.size(),
+                                   &signature[0],
+                                   &otherKey[0])
+                             .ok())
+                << i;
+        }
+        digest[rng() % digest.size()] ^= 1 << (rng() % 8);
+        EXPECT_FALSE(ec.verify(&digest[0],
+                               digest.size(),
+                               &signature[0],
+                               &publicKey[0])
+                         .ok())
+            << i;
+        otherKey = publicKey;
+    }
+}
+
+TEST(EcdsaTest, P256KnownAnswer)
+{
+    CheckKnownAnswer<P256>(P256Sample);
+}
+
+TEST(EcdsaTest, P256RoundTrip)
+{
+    CheckRoundTrip<P256>(32);
+}
+
+TEST(EcdsaTest, P384KnownAnswer)
+{
+    CheckKnownAnswer<P384>(P384Sample);
+}
+
+TEST(EcdsaTest, P384RoundTrip)
+{
+    CheckRoundTrip<P384>(48);
+}
+
+TEST(EcdsaTest, P256RejectTampered)
+{
+    CheckRejectTampered<P256>(P256Sample);
+}
+
+TEST(EcdsaTest, P384RejectTampered)
+{
+    CheckRejectTampered<P384>(P384Sample);
+}
+
+TEST(EcdsaTest, P256DigestSizes)
+{
+    CheckDigestSizes<P256>(P256Sample);
+}
+
+TEST(EcdsaTest, P384DigestSizes)
+{
+    CheckDigestSizes<P384>(P384Sample);
+}
+
+TEST(EcdsaTest, P521KnownAnswer)
+{
+    CheckKnownAnswer<P521>(P521Sample);
+}
+
+TEST(EcdsaTest, P521RoundTrip)
+{
+    CheckRoundTrip<P521>(66);
+}
+
+TEST(EcdsaTest, P521RejectTampered)
+{
+    CheckRejectTampered<P521>(P521Sample);
+}
+
+TEST(EcdsaTest, P521DigestSizes)
+{
+    CheckDigestSizes<P521>(P521Sample);
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+#include "alcp/base.hh"
+#include "alcp/ec/eddsa.hh"
+#include "alcp/ecdh.h"
+#include "alcp/types.hh"
+
+using alcp::ec::Ed25519;
+
+struct Ed25519Vector
+{
+    std::vector<Uint8> privKey;
+    std::vector<Uint8> publicKey;
+    std::vector<Uint8> message;
+    std::vector<Uint8> signature;
+};
+
+// RFC 8032 7.1, TEST 1 and TEST 2
+// clang-format off
+static const Ed25519Vector Ed25519Tests[] = {
+    {
+        { // Private Key
+          0x9d,0x61,0xb1,0x9d,0xef,0xfd,0x5a,0x60,
+          0xba,0x84,0x4a,0xf4,0x92,0xec,0x2c,0xc4,
+          0x44,0x49,0xc5,0x69,0x7b,0x32,0x69,0x19,
+          0x70,0x3b,0xac,0x03,0x1c,0xae,0x7f,0x60 },
+        { // Public Key
+          0xd7,0x5a,0x98,0x01,0x82,0xb1,0x0a,0xb7,
+          0xd5,0x4b,0xfe,0xd3,0xc9,0x64,0x07,0x3a,
+          0x0e,0xe1,0x72,0xf3,0xda,0xa6,0x23,0x25,
+          0xaf,0x02,0x1a,0x68,0xf7,0x07,0x51,0x1a },
+        {}, // Message
+        { // Signature
+          // R
+          0xe5,0x56,0x43,0x00,0xc3,0x60,0xac,0x72,
+          0x90,0x86,0xe2,0xcc,0x80,0x6e,0x82,0x8a,
+          0x84,0x87,0x7f,0x1e,0xb8,0xe5,0xd9,0x74,
+          0xd8,0x73,0xe0,0x65,0x22,0x49,0x01,0x55,
+          // S
+          0x5f,0xb8,0x82,0x15,0x90,0xa3,0x3b,0xac,
+          0xc6,0x1e,0x39,0x70,0x1c,0xf9,0xb4,0x6b,
+          0xd2,0x5b,0xf5,0xf0,0x59,0x5b,0xbe,0x24,
+          0x65,0x51,0x41,0x43,0x8e,0x7a,0x10,0x0b },
+    },
+    {
+        { // Private Key
+          0x4c,0xcd,0x08,0x9b,0x28,0xff,0x96,0xda,
+          0x9d,0xb6,0xc3,0x46,0xec,0x11,0x4e,0x0f,
+          0x5b,0x8a,0x31,0x9f,0x35,0xab,0xa6,0x24,
+          0xda,0x8c,0xf6,0xed,0x4f,0xb8,0xa6,0xfb },
+        { // Public Key
+          0x3d,0x40,0x17,0xc3,0xe8,0x43,0x89,0x5a,
+          0x92,0xb7,0x0a,0xa7,0x4d,0x1b,0x7e,0xbc,
+          0x9c,0x98,0x2c,0xcf,0x2e,0xc4,0x96,0x8c,
+          0xc0,0xcd,0x55,0xf1,0x2a,0xf4,0x66,0x0c },
+        { 0x72 }, // Message
+        { // Signature
+          // R
+          0x92,0xa0,0x09,0xa9,0xf0,0xd4,0xca,0xb8,
+          0x72,0x0e,0x82,0x0b,0x5f,0x64,0x25,0x40,
+          0xa2,0xb2,0x7b,0x54,0x16,0x50,0x3f,0x8f,
+          0xb3,0x76,0x22,0x23,0xeb,0xdb,0x69,0xda,
+          // S
+          0x08,0x5a,0xc1,0xe4,0x3e,0x15,0x99,0x6e,
+          0x45,0x8f,0x36,0x13,0xd0,0xf1,0x1d,0x8c,
+          0x38,0x7b,0x2e,0xae,0xb4,0x30,0x2a,0xee,
+          0xb0,0x0d,0x29,0x16,0x12,0xbb,0x0c,0x00 },
+    },
+};
+// clang-format on
+
+TEST(Ed25519Test, KnownAnswer)
+{
+    for (const auto& vector : Ed25519Tests) {
+        Ed25519            ed;
+        std::vector<Uint8> publicKey(32);
+        std::vector<Uint8> signature(64);
+
+        ASSERT_TRUE(ed.generatePublicKey(&publicKey[0], &vector.privKey[0])
+                        .ok());
+        EXPECT_EQ(vector.publicKey, publicKey);
+
+        ASSERT_TRUE(
+            ed.sign(vector.message.data(), vector.message.size(), &signature[0])
+                .ok());
+        EXPECT_EQ(vector.signature, signature);
+
+        EXPECT_TRUE(ed.verify(vector.message.data(),
+                              vector.message.size(),
+                              &signature[0],
+                              &publicKey[0])
+                        .ok());
+    }
+}
+
+TEST(Ed25519Test, RejectTampered)
+{
+    const Ed25519Vector& vector    = Ed25519Tests[1];
+    std::vector<Uint8>   message   = vector.message;
+    std::vector<Uint8>   signature = vector.signature;
+    std::vector<Uint8>   publicKey = vector.publicKey;
+    Ed25519              ed;
+
+    signature[0] ^= 1;
+    EXPECT_FALSE(
+        ed.verify(&message[0], message.size(), &signature[0], &publicKey[0])
+            .ok());
+    signature = vector.signature;
+
+    message[0] ^= 1;
+    EXPECT_FALSE(
+        ed.verify(&message[0], message.size(), &signature[0], &publicKey[0])
+            .ok());
+    message = vector.message;
+
+    // S must be below the group order
+    memset(&signature[32], 0xff, 32);
+    EXPECT_FALSE(
+        ed.verify(&message[0], message.size(), &signature[0], &publicKey[0])
+            .ok());
+    signature = vector.signature;
+
+    publicKey[0] ^= 1;
+    EXPECT_FALSE(
+        ed.verify(&message[0], message.size(), &signature[0], &publicKey[0])
+            .ok());
+}
+
+TEST(Ed25519Test, VerifyBatch)
+{
+    const Uint64                    count = 20;
+    std::vector<std::vector<Uint8>> messages(count), signatures(count);
+    std::vector<const Uint8*>       pMessages(count), pSignatures(count);
+    std::vector<const Uint8*>       pPublicKeys(count);
+    std::vector<Uint64>             sizes(count);
+    Ed25519                         ed[2];
+    bool                            valid[count];
+
+    for (Uint64 i = 0; i < 2; i++) {
+        ASSERT_TRUE(ed[i].setPrivateKey(&Ed25519Tests[i].privKey[0]).ok());
+    }
+    for (Uint64 i = 0; i < count; i++) {
+        messages[i].assign(i + 1, static_cast<Uint8>(i));
+        signatures[i].resize(64);
+        ASSERT_TRUE(ed[i % 2]
+                        .sign(&messages[i][0], i + 1, &signatures[i][0])
+                        .ok());
+        pMessages[i]   = &messages[i][0];
+        pSignatures[i] = &signatures[i][0];
+        pPublicKeys[i] = &Ed25519Tests[i % 2].publicKey[0];
+        sizes[i]       = i + 1;
+    }
+
+    EXPECT_TRUE(ed[0]
+                    .verifyBatch(&pMessages[0],
+                                 &sizes[0],
+                                 &pSignatures[0],
+                                 &pPublicKeys[0],
+                                 count,
+                                 valid)
+                    .ok());
+    for (Uint64 i = 0; i < count; i++) {
+        EXPECT_TRUE(valid[i]);
+    }
+
+    // a bad signature fails the batch and is the only one reported
+    signatures[7][40] ^= 0x10;
+    EXPECT_FALSE(ed[0]
+                     .verifyBatch(&pMessages[0],
+                                  &sizes[0],
+                                  &pSignatures[0],
+                                  &pPublicKeys[0],
+                                  count,
+                                  valid)
+                     .ok());
+    for (Uint64 i = 0; i < count; i++) {
+        EXPECT_EQ(i != 7, valid[i]);
+    }
+}
+
+/*
+ * Signature of { 0x72 } under the key of TEST 1 whose R is [r]B plus a point
+ * of order 4, S = r + k * a for the k of that R. Only the cofactored
+ * equation accepts it, single and batch verification must agree.
+ */
+TEST(Ed25519Test, SmallOrderR)
+{
+    // clang-format off
+    static const Uint8 cSignature[64] = {
+        0x18,0xb8,0x2b,0x91,0x38,0x99,0x17,0xfd,
+        0x07,0x61,0xf8,0xdc,0x46,0xfa,0x9d,0x56,
+        0x1f,0xd9,0xb9,0x86,0x2c,0x58,0xcc,0x8c,
+        0xb9,0x3d,0x5f,0x82,0x06,0x2e,0xfd,0x74,
+        0x28,0x7e,0x78,0xc1,0x51,0x80,0x53,0x4f,
+        0x52,0xf1,0x8c,0xd7,0x3f,0xde,0xcf,0xe1,
+        0x8b,0x24,0xc6,0x2a,0xfc,0x4b,0x25,0xe8,
+        0xf9,0xb8,0x3e,0x2c,0x67,0xb6,0xe5,0x0e,
+    };
+    // clang-format on
+    const Uint8  message[1] = { 0x72 };
+    const Uint64 size       = sizeof(message);
+    const Uint8* pMessage   = message;
+    const Uint8* pSignature = cSignature;
+    const Uint8* pPublicKey = &Ed25519Tests[0].publicKey[0];
+    bool         valid      = false;
+    Ed25519      ed;
+
+    bool single = ed.verify(pMessage, size, pSignature, pPublicKey).ok();
+    bool batch =
+        ed.verifyBatch(&pMessage, &size, &pSignature, &pPublicKey, 1, &valid)
+            .ok();
+    EXPECT_TRUE(single);
+    EXPECT_EQ(single, batch);
+    EXPECT_EQ(single, valid);
+}
+
+TEST(Ed25519Test, CApi)
+{
+    alc_ec_info_t info = { ALCP_EC_ED25519,
+                           ALCP_EC_CURVE_TYPE_TWISTED_EDWARDS,
+                           ALCP_EC_POINT_FORMAT_COMPRESSED };
+    alc_ec_info_t other = info;
+    other.ecPointFormat = ALCP_EC_POINT_FORMAT_UNCOMPRESSED;
+    EXPECT_EQ(alcp_ec_supported(&other), ALC_ERROR_NOT_SUPPORTED);
+    ASSERT_EQ(alcp_ec_supported(&info), ALC_ERROR_NONE);
+
+    std::vector<Uint8> context(alcp_ec_context_size(&info));
+    alc_ec_handle_t    handle;
+    handle.context = &context[0];
+    ASSERT_EQ(alcp_ec_request(&info, &handle), ALC_ERROR_NONE);
+
+    const Ed25519Vector& vector = Ed25519Tests[1];
+    std::vector<Uint8>   publicKey(32), signature(64), secret(32);
+    Uint64               keyLength = 0;
+
+    ASSERT_EQ(alcp_ec_get_publickey(&handle, &publicKey[0], &vector.privKey[0]),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(vector.publicKey, publicKey);
+    ASSERT_EQ(alcp_ec_sign(&handle,
+                           &vector.message[0],
+                           vector.message.size(),
+                           &signature[0]),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(vector.signature, signature);
+    EXPECT_EQ(alcp_ec_verify(&handle,
+                             &vector.message[0],
+                             vector.message.size(),
+                             &signature[0],
+                             &publicKey[0]),
+              ALC_ERROR_NONE);
+    EXPECT_EQ(
+        alcp_ec_get_secretkey(&handle, &secret[0], &publicKey[0], &keyLength),
+        ALC_ERROR_NOT_SUPPORTED);
+
+    // the same signature twice, the second one tampered
+    std::vector<Uint8> tampered = signature;
+    tampered[0] ^= 1;
+    const Uint8* pMessages[2]   = { &vector.message[0], &vector.message[0] };
+    const Uint64 sizes[2]       = { vector.message.size(),
+                                    vector.message.size() };
+    const Uint8* pSignatures[2] = { &signature[0], &signature[0] };
+    const Uint8* pPublicKeys[2] = { &publicKey[0], &publicKey[0] };
+    bool         valid[2]       = {};
+
+    alc_error_t err = alcp_ec_verify_batch(
+        &handle, pMessages, sizes, pSignatures, pPublicKeys, 2, valid);
+    EXPECT_EQ(err, ALC_ERROR_NONE);
+    EXPECT_TRUE(valid[0] && valid[1]);
+    pSignatures[1] = &tampered[0];
+    err = alcp_ec_verify_batch(
+        &handle, pMessages, sizes, pSignatures, pPublicKeys, 2, valid);
+    EXPECT_NE(err, ALC_ERROR_NONE);
+    EXPECT_TRUE(valid[0]);
+    EXPECT_FALSE(valid[1]);
+
+    alcp_ec_finish(&handle);
+}
@@ -28,6 +28,7 @@
 
 #include <gtest/gtest.h>
 #include <iostream>
+#include <random>
 #include <string.h>
 
 #include "alcp/base.hh"
@@ -123,3 +124,145 @@ TEST_P(p256Test, SecretKeyGen) {
 
   EXPECT_EQ(m_expected_shared_key, pSecret_key);
 }
+
+TEST(p256Test, PublicKeyGen)
+{
+    P256 p256obj;
+    // clang-format off
+    const Uint8 privKey[32] = {
+        0x7d,0x7d,0xc5,0xf7,0x1e,0xb2,0x9d,0xda,
+        0xf8,0x0d,0x62,0x14,0x63,0x2e,0xea,0xe0,
+        0x3d,0x90,0x58,0xaf,0x1f,0xb6,0xd2,0x2e,
+        0xd8,0x0b,0xad,0xb6,0x2b,0xc1,0xa5,0x34 };
+    const Uint8 expectedPub[64] = {
+        0xea,0xd2,0x18,0x59,0x01,0x19,0xe8,0x87,
+        0x6b,0x29,0x14,0x6f,0xf8,0x9c,0xa6,0x17,
+        0x70,0xc4,0xed,0xbb,0xf9,0x7d,0x38,0xce,
+        0x38,0x5e,0xd2,0x81,0xd8,0xa6,0xb2,0x30,
+        0x28,0xaf,0x61,0x28,0x1f,0xd3,0x5e,0x2f,
+        0xa7,0x00,0x25,0x23,0xac,0xc8,0x5a,0x42,
+        0x9c,0xb0,0x6e,0xe6,0x64,0x83,0x25,0x38,
+        0x9f,0x59,0xed,0xfc,0xe1,0x40,0x51,0x41 };
+    // clang-format on
+    Uint8 pubKey[64] = {};
+
+    EXPECT_TRUE(p256obj.generatePublicKey(pubKey, privKey).ok());
+    EXPECT_EQ(0, memcmp(pubKey, expectedPub, sizeof(pubKey)));
+    EXPECT_TRUE(p256obj.validatePublicKey(pubKey, sizeof(pubKey)).ok());
+}
+
+TEST(p256Test, RejectInvalidPrivateKey)
+{
+    P256  p256obj;
+    Uint8 pubKey[64] = {};
+    Uint8 privKey[32] = {};
+
+    // Zero is not a valid scalar
+    EXPECT_FALSE(p256obj.generatePublicKey(pubKey, privKey).ok());
+
+    // Neither is anything at or above the group order
+    memset(privKey, 0xff, sizeof(privKey));
+    EXPECT_FALSE(p256obj.generatePublicKey(pubKey, privKey).ok());
+}
+
+TEST_P(p256Test, RejectPointNotOnCurve)
+{
+    EXPECT_TRUE(m_p256obj->setPrivateKey(&m_peer1_private_key[0]).ok());
+
+    std::vector<Uint8> badPublicKey = m_peer2_public_key;
+    badPublicKey[63] ^= 1;
+    EXPECT_FALSE(m_p256obj->validatePublicKey(&badPublicKey[0], 64).ok());
+
+    std::vector<Uint8> secretKey(m_p256obj->getKeySize());
+    Uint64             keyLength = 0;
+    EXPECT_FALSE(m_p256obj
+                     ->computeSecretKey(&secretKey[0], &badPublicKey[0],
+                                        &keyLength)
+                     .ok());
+}
+
+TEST(p256Test, EdgeScalars)
+{
+    P256 p256obj;
+    // clang-format off
+    const Uint8 gX[32] = {
+        0x6b,0x17,0xd1,0xf2,0xe1,0x2c,0x42,0x47,
+        0xf8,0xbc,0xe6,0xe5,0x63,0xa4,0x40,0xf2,
+        0x77,0x03,0x7d,0x81,0x2d,0xeb,0x33,0xa0,
+        0xf4,0xa1,0x39,0x45,0xd8,0x98,0xc2,0x96 };
+    const Uint8 gY[32] = {
+        0x4f,0xe3,0x42,0xe2,0xfe,0x1a,0x7f,0x9b,
+        0x8e,0xe7,0xeb,0x4a,0x7c,0x0f,0x9e,0x16,
+        0x2b,0xce,0x33,0x57,0x6b,0x31,0x5e,0xce,
+        0xcb,0xb6,0x40,0x68,0x37,0xbf,0x51,0xf5 };
+    // p - y(G), the y coordinate of -G
+    const Uint8 negGY[32] = {
+        0xb0,0x1c,0xbd,0x1c,0x01,0xe5,0x80,0x65,
+        0x71,0x18,0x14,0xb5,0x83,0xf0,0x61,0xe9,
+        0xd4,0x31,0xcc,0xa9,0x94,0xce,0xa1,0x31,
+        0x34,0x49,0xbf,0x97,0xc8,0x40,0xae,0x0a };
+    const Uint8 twoGX[32] = {
+        0x7c,0xf2,0x7b,0x18,0x8d,0x03,0x4f,0x7e,
+        0x8a,0x52,0x38,0x03,0x04,0xb5,0x1a,0xc3,
+        0xc0,0x89,0x69,0xe2,0x77,0xf2,0x1b,0x35,
+        0xa6,0x0b,0x48,0xfc,0x47,0x66,0x99,0x78 };
+    const Uint8 twoGY[32] = {
+        0x07,0x77,0x55,0x10,0xdb,0x8e,0xd0,0x40,
+        0x29,0x3d,0x9a,0xc6,0x9f,0x74,0x30,0xdb,
+        0xba,0x7d,0xad,0xe6,0x3c,0xe9,0x82,0x29,
+        0x9e,0x04,0xb7,0x9d,0x22,0x78,0x73,0xd1 };
+    // n - 1
+    const Uint8 orderMinusOne[32] = {
+        0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xbc,0xe6,0xfa,0xad,0xa7,0x17,0x9e,0x84,
+        0xf3,0xb9,0xca,0xc2,0xfc,0x63,0x25,0x50 };
+    // clang-format on
+    Uint8 privKey[32] = {};
+    Uint8 pubKey[64]  = {};
+
+    privKey[31] = 1;
+    EXPECT_TRUE(p256obj.generatePublicKey(pubKey, privKey).ok());
+    EXPECT_EQ(0, memcmp(pubKey, gX, 32));
+    EXPECT_EQ(0, memcmp(pubKey + 32, gY, 32));
+
+    privKey[31] = 2;
+    EXPECT_TRUE(p256obj.generatePublicKey(pubKey, privKey).ok());
+    EXPECT_EQ(0, memcmp(pubKey, twoGX, 32));
+    EXPECT_EQ(0, memcmp(pubKey + 32, twoGY, 32));
+
+    // (n - 1) * G = -G, the last window of the recoding carries out
+    EXPECT_TRUE(p256obj.generatePublicKey(pubKey, orderMinusOne).ok());
+    EXPECT_EQ(0, memcmp(pubKey, gX, 32));
+    EXPECT_EQ(0, memcmp(pubKey + 32, negGY, 32));
+}
+
+TEST(p256Test, SharedSecretAgrees)
+{
+    // a * (b * G) == b * (a * G) ties the fixed base comb to the variable
+    // base ladder over many scalars
+    std::mt19937_64 rng(256);
+    for (int i = 0; i < 64; i++) {
+        Uint8 privKeyA[32], privKeyB[32];
+        for (int j = 0; j < 32; j++) {
+            privKeyA[j] = static_cast<Uint8>(rng());
+            privKeyB[j] = static_cast<Uint8>(rng());
+        }
+        // Keep both below the group order
+        privKeyA[0] &= 0x7f;
+        privKeyB[0] &= 0x7f;
+
+        P256  peerA, peerB;
+        Uint8 pubKeyA[64], pubKeyB[64];
+        ASSERT_TRUE(peerA.generatePublicKey(pubKeyA, privKeyA).ok());
+        ASSERT_TRUE(peerB.generatePublicKey(pubKeyB, privKeyB).ok());
+
+        Uint8  secretA[32], secretB[32];
+        Uint64 keyLength = 0;
+        ASSERT_TRUE(peerA.setPrivateKey(privKeyA).ok());
+        ASSERT_TRUE(peerB.setPrivateKey(privKeyB).ok());
+        ASSERT_TRUE(peerA.computeSecretKey(secretA, pubKeyB, &keyLength).ok());
+        ASSERT_TRUE(peerB.computeSecretKey(secretB, pubKeyA, &keyLength).ok());
+        EXPECT_EQ(0, memcmp(secretA, secretB, sizeof(secretA))) << i;
+    }
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <string.h>
+
+#include "alcp/base.hh"
+#include "alcp/ec/ecdh.hh"
+#include "alcp/types.hh"
+
+using alcp::ec::P521;
+
+// clang-format off
+static const Uint8 PrivateKey1[66] = {
+    0x01,0x92,0x52,0x4e,0xc3,0xae,0x10,0xb5,
+    0xc9,0x6d,0x49,0x04,0xe0,0x0e,0xe0,0x2c,
+    0x68,0xfb,0xaa,0xb5,0x9c,0x51,0x2b,0x05,
+    0xac,0x7e,0x6b,0xc9,0x29,0x70,0x0b,0xf6,
+    0x68,0x61,0xcc,0x7a,0x79,0x35,0x90,0x77,
+    0xa9,0x3a,0x38,0xf5,0xa6,0xd9,0x31,0x61,
+    0x23,0xe6,0xe3,0xd6,0x6f,0xb9,0x0c,0x6f,
+    0x44,0xcd,0x4c,0xdf,0x23,0x64,0x64,0x88,
+    0xd9,0x85 };
+
+static const Uint8 PublicKey1[132] = {
+    // X
+    0x00,0x58,0x04,0x77,0x2a,0xd5,0xa5,0xb3,
+    0x28,0xac,0x2c,0xab,0x02,0x51,0x75,0x8b,
+    0xaf,0xea,0x17,0x3f,0x40,0x5b,0x78,0xe8,
+    0x41,0x4e,0xbe,0xe1,0x32,0xc1,0x51,0x62,
+    0x19,0xf3,0xda,0x63,0x0e,0x62,0x85,0xfd,
+    0x7d,0xd9,0x89,0xab,0x6d,0xe3,0x0b,0x47,
+    0x5b,0x69,0x6a,0x0e,0x0d,0x3a,0xd9,0x93,
+    0xab,0xcc,0x73,0x31,0x60,0xf1,0x45,0xbf,
+    0x94,0x64,
+    // Y
+    0x00,0x65,0xc3,0xe7,0xf5,0x98,0xf2,0x62,
+    0x1e,0x57,0xce,0x13,0x9a,0x5c,0xb2,0x1b,
+    0x87,0x4e,0x2f,0x2e,0x36,0x38,0x39,0x50,
+    0x1c,0xc6,0x1e,0x0a,0x6d,0xf1,0x22,0xdd,
+    0x11,0x45,0xe4,0xd5,0x7c,0x68,0x6e,0xea,
+    0x2c,0xa1,0x53,0xbf,0xae,0xa7,0x6c,0x5e,
+    0xdb,0x77,0x18,0x06,0xce,0xe4,0x0e,0xc3,
+    0xb3,0x75,0xe7,0xb8,0x52,0xb5,0xd8,0xc1,
+    0x70,0x4a };
+
+static const Uint8 PrivateKey2[66] = {
+    0x00,0x08,0xfc,0x2b,0xf8,0xe2,0x35,0x46,
+    0x90,0x6d,0x2b,0x2d,0xbd,0x6b,0x1f,0x86,
+    0x4e,0xe6,0x45,0xb7,0xc3,0x5e,0xd5,0xf6,
+    0xf8,0x77,0x17,0xb4,0x98,0xad,0x72,0x32,
+    0xe9,0xfa,0x45,0x1b,0xf0,0xcd,0x1e,0x2c,
+    0x1c,0x85,0x94,0x73,0xdb,0x7d,0x59,0x25,
+    0xa5,0x84,0x2b,0x10,0xe3,0x41,0xb1,0xce,
+    0xe2,0x70,0xa7,0x38,0xd4,0xac,0x5b,0x03,
+    0xcc,0xcf };
+
+static const Uint8 PublicKey2[132] = {
+    // X
+    0x00,0x11,0x56,0x5d,0xfb,0x0d,0x9c,0xa5,
+    0x0c,0xa3,0xbd,0x8a,0x97,0x46,0xdd,0x59,
+    0xdf,0x8f,0x0d,0x0b,0x51,0x6e,0x89,0x23,
+    0x6b,0xaa,0x21,0x84,0x7b,0x16,0x59,0x35,
+    0x2b,0x5a,0x27,0xf0,0xe2,0xd4,0x69,0x99,
+    0xa8,0x3f,0x2e,0x7e,0x20,0xb8,0xee,0xac,
+    0xca,0x2d,0xf4,0x29,0x94,0x55,0x70,0x2b,
+    0x07,0xfe,0x3f,0xf6,0x32,0xdc,0x01,0xd6,
+    0xe1,0xe3,
+    // Y
+    0x00,0x8a,0x5d,0xec,0x46,0xbb,0x4d,0xf8,
+    0xb4,0xf8,0x6b,0xf8,0xa8,0xfe,0x6d,0x06,
+    0xf2,0x5f,0x08,0x26,0x86,0x5c,0x3b,0x34,
+    0xb2,0x59,0x02,0x31,0x00,0x84,0x57,0xa7,
+    0x71,0xdd,0x79,0x9f,0xb6,0x35,0xab,0xc2,
+    0x16,0xf3,0xd9,0x5d,0x2f,0xf6,0x30,0x06,
+    0x25,0x08,0x07,0xf4,0x59,0x94,0xca,0xfb,
+    0x0c,0xed,0x85,0x05,0xeb,0x39,0x86,0x17,
+    0xce,0xb0 };
+
+static const Uint8 SharedSecret[66] = {
+    0x01,0xde,0xb5,0x80,0x6f,0xe8,0x2b,0x49,
+    0x59,0xe9,0x9c,0x6c,0x51,0xbd,0xc5,0xa4,
+    0x8d,0xdd,0x43,0xae,0x82,0x65,0xb9,0x01,
+    0x35,0xa4,0x1b,0x0c,0x8c,0x0e,0x22,0x12,
+    0x46,0xac,0x8e,0x3f,0x05,0x6e,0xf7,0xf7,
+    0xf4,0xd6,0xb2,0x7f,0x3a,0xb9,0x39,0x8e,
+    0xb6,0x5f,0xd0,0xad,0x09,0xcd,0x33,0xd2,
+    0x3d,0x60,0x3b,0x28,0xcc,0x0c,0x62,0xed,
+    0x22,0xb3 };
+// clang-format on
+
+TEST(p521Test, PublicKeyGen)
+{
+    P521  p521obj;
+    Uint8 publicKey[132];
+
+    ASSERT_TRUE(p521obj.generatePublicKey(publicKey, PrivateKey1).ok());
+    EXPECT_EQ(memcmp(publicKey, PublicKey1, sizeof(publicKey)), 0);
+    ASSERT_TRUE(p521obj.generatePublicKey(publicKey, PrivateKey2).ok());
+    EXPECT_EQ(memcmp(publicKey, PublicKey2, sizeof(publicKey)), 0);
+}
+
+TEST(p521Test, SecretKeyGen)
+{
+    P521   peer1, peer2;
+    Uint8  secret1[66], secret2[66];
+    Uint64 keyLength;
+
+    ASSERT_TRUE(peer1.setPrivateKey(PrivateKey1).ok());
+    ASSERT_TRUE(peer2.setPrivateKey(PrivateKey2).ok());
+    ASSERT_TRUE(peer1.computeSecretKey(secret1, PublicKey2, &keyLength).ok());
+    EXPECT_EQ(keyLength, peer1.getKeySize());
+    ASSERT_TRUE(peer2.computeSecretKey(secret2, PublicKey1, &keyLength).ok());
+
+    EXPECT_EQ(memcmp(secret1, SharedSecret, sizeof(secret1)), 0);
+    EXPECT_EQ(memcmp(secret2, SharedSecret, sizeof(secret2)), 0);
+}
+
+TEST(p521Test, InvalidKeys)
+{
+    P521   p521obj;
+    Uint8  key[132], secret[66];
+    Uint64 keyLength;
+
+    // zero, and the top byte above the 521 bit order
+    memset(key, 0, 66);
+    EXPECT_FALSE(p521obj.setPrivateKey(key).ok());
+    memcpy(key, PrivateKey1, 66);
+    key[0] = 0x02;
+    EXPECT_FALSE(p521obj.setPrivateKey(key).ok());
+
+    ASSERT_TRUE(p521obj.setPrivateKey(PrivateKey1).ok());
+    EXPECT_TRUE(p521obj.validatePublicKey(PublicKey2, 132).ok());
+    EXPECT_FALSE(p521obj.validatePublicKey(PublicKey2, 66).ok());
+
+    memcpy(key, PublicKey2, sizeof(key));
+    key[131] ^= 1;
+    EXPECT_FALSE(p521obj.validatePublicKey(key, 132).ok());
+    EXPECT_FALSE(p521obj.computeSecretKey(secret, key, &keyLength).ok());
+}
+
+TEST(p521Test, EdgeScalars)
+{
+    P521 p521obj;
+    // clang-format off
+    const Uint8 gX[66] = {
+        0x00,0xc6,0x85,0x8e,0x06,0xb7,0x04,0x04,
+        0xe9,0xcd,0x9e,0x3e,0xcb,0x66,0x23,0x95,
+        0xb4,0x42,0x9c,0x64,0x81,0x39,0x05,0x3f,
+        0xb5,0x21,0xf8,0x28,0xaf,0x60,0x6b,0x4d,
+        0x3d,0xba,0xa1,0x4b,0x5e,0x77,0xef,0xe7,
+        0x59,0x28,0xfe,0x1d,0xc1,0x27,0xa2,0xff,
+        0xa8,0xde,0x33,0x48,0xb3,0xc1,0x85,0x6a,
+        0x42,0x9b,0xf9,0x7e,0x7e,0x31,0xc2,0xe5,
+        0xbd,0x66 };
+    const Uint8 gY[66] = {
+        0x01,0x18,0x39,0x29,0x6a,0x78,0x9a,0x3b,
+        0xc0,0x04,0x5c,0x8a,0x5f,0xb4,0x2c,0x7d,
+        0x1b,0xd9,0x98,0xf5,0x44,0x49,0x57,0x9b,
+        0x44,0x68,0x17,0xaf,0xbd,0x17,0x27,0x3e,
+        0x66,0x2c,0x97,0xee,0x72,0x99,0x5e,0xf4,
+        0x26,0x40,0xc5,0x50,0xb9,0x01,0x3f,0xad,
+        0x07,0x61,0x35,0x3c,0x70,0x86,0xa2,0x72,
+        0xc2,0x40,0x88,0xbe,0x94,0x76,0x9f,0xd1,
+        0x66,0x50 };
+    // p - y(G), the y coordinate of -G
+    const Uint8 negGY[66] = {
+        0x00,0xe7,0xc6,0xd6,0x95,0x87,0x65,0xc4,
+        0x3f,0xfb,0xa3,0x75,0xa0,0x4b,0xd3,0x82,
+        0xe4,0x26,0x67,0x0a,0xbb,0xb6,0xa8,0x64,
+        0xbb,0x97,0xe8,0x50,0x42,0xe8,0xd8,0xc1,
+        0x99,0xd3,0x68,0x11,0x8d,0x66,0xa1,0x0b,
+        0xd9,0xbf,0x3a,0xaf,0x46,0xfe,0xc0,0x52,
+        0xf8,0x9e,0xca,0xc3,0x8f,0x79,0x5d,0x8d,
+        0x3d,0xbf,0x77,0x41,0x6b,0x89,0x60,0x2e,
+        0x99,0xaf };
+    const Uint8 twoGX[66] = {
+        0x00,0x43,0x3c,0x21,0x90,0x24,0x27,0x7e,
+        0x7e,0x68,0x2f,0xcb,0x28,0x81,0x48,0xc2,
+        0x82,0x74,0x74,0x03,0x27,0x9b,0x1c,0xcc,
+        0x06,0x35,0x2c,0x6e,0x55,0x05,0xd7,0x69,
+        0xbe,0x97,0xb3,0xb2,0x04,0xda,0x6e,0xf5,
+        0x55,0x07,0xaa,0x10,0x4a,0x3a,0x35,0xc5,
+        0xaf,0x41,0xcf,0x2f,0xa3,0x64,0xd6,0x0f,
+        0xd9,0x67,0xf4,0x3e,0x39,0x33,0xba,0x6d,
+        0x78,0x3d };
+    const Uint8 twoGY[66] = {
+        0x00,0xf4,0xbb,0x8c,0xc7,0xf8,0x6d,0xb2,
+        0x67,0x00,0xa7,0xf3,0xec,0xee,0xee,0xd3,
+        0xf0,0xb5,0xc6,0xb5,0x10,0x7c,0x4d,0xa9,
+        0x77,0x40,0xab,0x21,0xa2,0x99,0x06,0xc4,
+        0x2d,0xbb,0xb3,0xe3,0x77,0xde,0x9f,0x25,
+        0x1f,0x6b,0x93,0x93,0x7f,0xa9,0x9a,0x32,
+        0x48,0xf4,0xea,0xfc,0xbe,0x95,0xed,0xc0,
+        0xf4,0xf7,0x1b,0xe3,0x56,0xd6,0x61,0xf4,
+        0x1b,0x02 };
+    // n - 1
+    const Uint8 orderMinusOne[66] = {
+        0x01,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xfa,0x51,0x86,0x87,0x83,0xbf,0x2f,
+        0x96,0x6b,0x7f,0xcc,0x01,0x48,0xf7,0x09,
+        0xa5,0xd0,0x3b,0xb5,0xc9,0xb8,0x89,0x9c,
+        0x47,0xae,0xbb,0x6f,0xb7,0x1e,0x91,0x38,
+        0x64,0x08 };
+    // clang-format on
+    Uint8  privKey[66] = {};
+    Uint8  pubKey[132] = {}, point[132];
+    Uint8  secret[66];
+    Uint64 keyLength = 0;
+
+    privKey[65] = 1;
+    EXPECT_TRUE(p521obj.generatePublicKey(pubKey, privKey).ok());
+    EXPECT_EQ(0, memcmp(pubKey, gX, 66));
+    EXPECT_EQ(0, memcmp(pubKey + 66, gY, 66));
+
+    privKey[65] = 2;
+    EXPECT_TRUE(p521obj.generatePublicKey(pubKey, privKey).ok());
+    EXPECT_EQ(0, memcmp(pubKey, twoGX, 66));
+    EXPECT_EQ(0, memcmp(pubKey + 66, twoGY, 66));
+
+    // (n - 1) * G = -G, every comb column and the top window are set
+    EXPECT_TRUE(p521obj.generatePublicKey(pubKey, orderMinusOne).ok());
+    EXPECT_EQ(0, memcmp(pubKey, gX, 66));
+    EXPECT_EQ(0, memcmp(pubKey + 66, negGY, 66));
+
+    // the same through the variable base windows, x(-G) = x(G)
+    memcpy(point, gX, 66);
+    memcpy(point + 66, gY, 66);
+    ASSERT_TRUE(p521obj.setPrivateKey(orderMinusOne).ok());
+    ASSERT_TRUE(p521obj.computeSecretKey(secret, point, &keyLength).ok());
+    EXPECT_EQ(0, memcmp(secret, gX, 66));
+}
+
+TEST(p521Test, SharedSecretAgrees)
+{
+    // a * (b * G) == b * (a * G) ties the fixed base comb to the variable
+    // base windows over many scalars
+    std::mt19937_64 rng(521);
+    for (int i = 0; i < 32; i++) {
+        Uint8 privKeyA[66], privKeyB[66];
+        for (int j = 0; j < 66; j++) {
+            privKeyA[j] = static_cast<Uint8>(rng());
+            privKeyB[j] = static_cast<Uint8>(rng());
+        }
+        // Keep both below the group order
+        privKeyA[0] &= 0x01;
+        privKeyB[0] = 0;
+
+        P521  peerA, peerB;
+        Uint8 pubKeyA[132], pubKeyB[132];
+        ASSERT_TRUE(peerA.generatePublicKey(pubKeyA, privKeyA).ok());
+        ASSERT_TRUE(peerB.generatePublicKey(pubKeyB, privKeyB).ok());
+        EXPECT_TRUE(peerA.validatePublicKey(pubKeyA, 132).ok());
+
+        Uint8  secretA[66], secretB[66];
+        Uint64 keyLength = 0;
+        ASSERT_TRUE(peerA.setPrivateKey(privKeyA).ok());
+        ASSERT_TRUE(peerB.setPrivateKey(privKeyB).ok());
+        ASSERT_TRUE(peerA.computeSecretKey(secretA, pubKeyB, &keyLength).ok());
+        ASSERT_TRUE(peerB.computeSecretKey(secretB, pubKeyA, &keyLength).ok());
+        EXPECT_EQ(0, memcmp(secretA, secretB, sizeof(secretA))) << i;
+    }
+}
@@ -217,6 +217,79 @@ TEST_P(x25519Test, PerformanceTest)
     delete[] pSecret_key;
 }
 
+// a full batch of eight plus a tail, each key against the single key path
+TEST_P(x25519Test, SecretKeyBatchTest)
+{
+    const Uint64 count = 11;
+    Uint8        privKeys[count * MAX_SIZE_KEY_DATA];
+    Uint8        publicKeys[count * MAX_SIZE_KEY_DATA];
+    Uint8        secretKeys[count * MAX_SIZE_KEY_DATA];
+    Uint8        expected[MAX_SIZE_KEY_DATA];
+    Uint64       keyLength;
+
+    m_px25519obj2->generatePublicKey(m_publicKeyData2,
+                                     &(m_peer2_private_key.at(0)));
+    for (Uint64 i = 0; i < count; i++) {
+        Uint8* p_priv = privKeys + i * MAX_SIZE_KEY_DATA;
+        memcpy(p_priv, &(m_peer1_private_key.at(0)), MAX_SIZE_KEY_DATA);
+        p_priv[1] ^= static_cast<Uint8>(i);
+        m_px25519obj1->generatePublicKey(
+            publicKeys + i * MAX_SIZE_KEY_DATA,
+            i % 2 ? &(m_peer2_private_key.at(0)) : p_priv);
+    }
+    // the known answer, peer 2 public key
+    memcpy(publicKeys, m_publicKeyData2, MAX_SIZE_KEY_DATA);
+
+    EXPECT_EQ(
+        m_px25519obj1->computeSecretKeyBatch(
+            secretKeys, privKeys, publicKeys, count),
+        StatusOk());
+    EXPECT_EQ(memcmp(&(m_expected_shared_key.at(0)),
+                     secretKeys,
+                     MAX_SIZE_KEY_DATA),
+              0);
+
+    for (Uint64 i = 0; i < count; i++) {
+        m_px25519obj1->generatePublicKey(m_publicKeyData1,
+                                         privKeys + i * MAX_SIZE_KEY_DATA);
+        m_px25519obj1->computeSecretKey(
+            expected, publicKeys + i * MAX_SIZE_KEY_DATA, &keyLength);
+        EXPECT_EQ(memcmp(expected,
+                         secretKeys + i * MAX_SIZE_KEY_DATA,
+                         MAX_SIZE_KEY_DATA),
+                  0)
+            << "key " << i;
+    }
+
+    memset(publicKeys + 9 * MAX_SIZE_KEY_DATA, 0, MAX_SIZE_KEY_DATA);
+    EXPECT_NE(m_px25519obj1
+                  ->computeSecretKeyBatch(
+                      secretKeys, privKeys, publicKeys, count)
+                  .code(),
+              ErrorCode::eOk);
+}
+
+// the private key is clamped on set too, not only by generatePublicKey
+TEST_P(x25519Test, SetPrivateKeyTest)
+{
+    m_px25519obj2->generatePublicKey(m_publicKeyData2,
+                                     &(m_peer2_private_key.at(0)));
+
+    // the bits clamping fixes, set the wrong way round
+    std::vector<Uint8> private_key = m_peer1_private_key;
+    private_key[0] |= 7;
+    private_key[31] = (private_key[31] | 128) & 191;
+    EXPECT_EQ(m_px25519obj1->setPrivateKey(&(private_key.at(0))), StatusOk());
+
+    Uint8  secret_key[MAX_SIZE_KEY_DATA];
+    Uint64 key_length;
+    EXPECT_EQ(m_px25519obj1->computeSecretKey(
+                  secret_key, m_publicKeyData2, &key_length),
+              StatusOk());
+    EXPECT_EQ(memcmp(&(m_expected_shared_key.at(0)), secret_key, key_length),
+              0);
+}
+
 TEST_P(x25519Test, GetKeySizeTest)
 {
     EXPECT_EQ(m_px25519obj1->getKeySize(), MAX_SIZE_KEY_DATA);
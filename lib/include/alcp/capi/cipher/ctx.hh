@@ -83,9 +83,26 @@ struct Context
 
     alc_error_t (*setTagLength)(void* rCipher, Uint64 len);
 
+    /* Batched records, null for the modes which do not support them */
+    alc_error_t (*encryptRecords)(void*                           rCipher,
+                                  const alc_cipher_aead_record_t* pRecords,
+                                  Uint64                          count);
+
+    alc_error_t (*decryptRecords)(void*                           rCipher,
+                                  const alc_cipher_aead_record_t* pRecords,
+                                  Uint64                          count);
+
     alc_error_t (*finish)(const void*);
 
     Status status{ StatusOk() };
+
+    /*
+     * Backing store for m_cipher. Modes that fit are constructed here
+     * instead of on the heap, so re-requesting a cipher on the same
+     * context does not allocate. Left uninitialized on purpose.
+     */
+    static constexpr Uint64 cInplaceSize = 2048;
+    Uint8                   m_inplace[cInplaceSize];
 };
 
 } // namespace alcp::cipher
@@ -50,6 +50,15 @@ class Context
     alc_error_t (*finish)(void* pDigest);
     alc_error_t (*reset)(void* pDigest);
     alc_error_t (*setShakeLength)(void* pDigest, Uint64 digestSize);
+    /* Multi-buffer update, nullptr when the digest has no such path */
+    alc_error_t (*updateMulti)(void* const        pDigests[],
+                               const Uint8* const pSrc[],
+                               const Uint64       len[],
+                               Uint64             num);
+    /* Multi-buffer finalize, nullptr when the digest has no such path */
+    alc_error_t (*finalizeMulti)(void* const pDigests[], Uint64 num);
+    /* Builds a copy of rSrcCtx's digest in the memory of rDestCtx */
+    alc_error_t (*duplicate)(const Context& rSrcCtx, Context& rDestCtx);
 
     Status status{ StatusOk() };
 
@@ -44,6 +44,31 @@ class Context
                            const Uint8* pPublicKey,
                            Uint64*      pKeyLength);
 
+    Status (*getSecretKeyBatch)(void*        pEc,
+                                Uint8*       pSecretKeys,
+                                const Uint8* pPrivKeys,
+                                const Uint8* pPublicKeys,
+                                Uint64       count);
+
+    Status (*sign)(void*        pEc,
+                   const Uint8* pDigest,
+                   Uint64       digestSize,
+                   Uint8*       pSignature);
+
+    Status (*verify)(void*        pEc,
+                     const Uint8* pDigest,
+                     Uint64       digestSize,
+                     const Uint8* pSignature,
+                     const Uint8* pPublicKey);
+
+    Status (*verifyBatch)(void*              pEc,
+                          const Uint8* const pMessages[],
+                          const Uint64       pMessageSizes[],
+                          const Uint8* const pSignatures[],
+                          const Uint8* const pPublicKeys[],
+                          Uint64             count,
+                          bool               pValid[]);
+
     Status (*finish)(void*);
 
     Status (*reset)(void*);
@@ -39,6 +39,9 @@ struct Context
     Status (*copy)(void* mac, Uint8* buff, Uint64 size);
     void (*finish)(void* mac, void* digest);
     Status (*reset)(void* mac, void* digest);
+    /* Builds a copy of rSrcCtx's objects for rDestCtx, nullptr if the MAC
+     * cannot be copied */
+    Status (*duplicate)(const Context& rSrcCtx, Context& rDestCtx);
 
     alcp::base::Status status{ StatusOk() };
 };
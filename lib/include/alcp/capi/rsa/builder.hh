@@ -39,6 +39,28 @@ class RsaBuilder
   public:
     static Status Build(alc_rsa_key_size keySize, Context& ctx);
     static Uint32 getSize(alc_rsa_key_size keySize);
+
+    // shared key data for alc_rsa_key_t, see Rsa::createPublicKey
+    static Status BuildPublicKey(alc_rsa_key_size                   keySize,
+                                 Uint64                             exponent,
+                                 const Uint8*                       mod,
+                                 Uint64                             size,
+                                 std::shared_ptr<RsaPublicKeyData>& key);
+
+    static Status BuildPrivateKey(alc_rsa_key_size                    keySize,
+                                  const Uint8*                        dp,
+                                  const Uint8*                        dq,
+                                  const Uint8*                        p,
+                                  const Uint8*                        q,
+                                  const Uint8*                        qinv,
+                                  const Uint8*                        mod,
+                                  Uint64                              size,
+                                  std::shared_ptr<RsaPrivateKeyData>& key);
+
+    static Status GenerateKey(alc_rsa_key_size                    keySize,
+                              Uint64                              exponent,
+                              std::shared_ptr<RsaPublicKeyData>&  pub,
+                              std::shared_ptr<RsaPrivateKeyData>& priv);
 };
 
 } // namespace alcp::rsa
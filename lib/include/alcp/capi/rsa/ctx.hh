@@ -44,11 +44,24 @@ class Context
                               Uint64       textSize,
                               Uint8*       pEncText);
 
+    // the batch calls take one object per text, all of the same key size
+    Status (*encryptPublicBatchFn)(void* const        pRsaHandle[],
+                                   const Uint8* const pText[],
+                                   Uint64             textSize,
+                                   Uint8* const       pEncText[],
+                                   Uint64             num);
+
     Status (*decryptPrivateFn)(void*        pRsaHandle,
                                const Uint8* pEncText,
                                Uint64       encSize,
                                Uint8*       pText);
 
+    Status (*decryptPrivateBatchFn)(void*              pRsaHandle,
+                                    const Uint8* const pEncText[],
+                                    Uint64             encSize,
+                                    Uint8* const       pText[],
+                                    Uint64             num);
+
     Status (*encryptPublicOaepFn)(void*        pRsaHandle,
                                   const Uint8* pText,
                                   Uint64       textSize,
@@ -65,6 +78,60 @@ class Context
                                    Uint8*       pText,
                                    Uint64&      textSize);
 
+    Status (*signPkcs1v15Fn)(void*        pRsaHandle,
+                             bool         check,
+                             const Uint8* pText,
+                             Uint64       textSize,
+                             Uint8*       pSignText);
+
+    Status (*signPkcs1v15BatchFn)(void*              pRsaHandle,
+                                  bool               check,
+                                  const Uint8* const pText[],
+                                  const Uint64       textSize[],
+                                  Uint8* const       pSignText[],
+                                  Uint64             num);
+
+    Status (*verifyPkcs1v15Fn)(void*        pRsaHandle,
+                               const Uint8* pText,
+                               Uint64       textSize,
+                               const Uint8* pSignText);
+
+    Status (*verifyPkcs1v15BatchFn)(void* const        pRsaHandle[],
+                                    const Uint8* const pText[],
+                                    const Uint64       textSize[],
+                                    const Uint8* const pSignText[],
+                                    bool               pValid[],
+                                    Uint64             num);
+
+    Status (*signPssFn)(void*        pRsaHandle,
+                        bool         check,
+                        const Uint8* pText,
+                        Uint64       textSize,
+                        const Uint8* salt,
+                        Uint64       saltSize,
+                        Uint8*       pSignText);
+
+    Status (*signPssBatchFn)(void*              pRsaHandle,
+                             bool               check,
+                             const Uint8* const pText[],
+                             const Uint64       textSize[],
+                             const Uint8* const salt[],
+                             Uint64             saltSize,
+                             Uint8* const       pSignText[],
+                             Uint64             num);
+
+    Status (*verifyPssFn)(void*        pRsaHandle,
+                          const Uint8* pText,
+                          Uint64       textSize,
+                          const Uint8* pSignText);
+
+    Status (*verifyPssBatchFn)(void* const        pRsaHandle[],
+                               const Uint8* const pText[],
+                               const Uint64       textSize[],
+                               const Uint8* const pSignText[],
+                               bool               pValid[],
+                               Uint64             num);
+
     Uint64 (*getKeySize)(void* pRsaHandle);
 
     Status (*getPublickey)(void* pRsaHandle, RsaPublicKey& publicKey);
@@ -83,6 +150,11 @@ class Context
                             const Uint8* mod,
                             const Uint64 size);
 
+    // the key data is shared with the handle, not copied
+    Status (*setKey)(void*                              pRsaHandle,
+                     std::shared_ptr<RsaPublicKeyData>  pub,
+                     std::shared_ptr<RsaPrivateKeyData> priv);
+
     void (*setDigest)(void* pRsaHandle, digest::IDigest* digest);
     void (*setMgf)(void* pRsaHandle, digest::IDigest* digest);
 
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/cipher.h"
+#include "alcp/cipher.hh"
+#include "alcp/cipher/aes.hh"
+#include "alcp/error.h"
+#include "alcp/utils/cpuid.hh"
+
+namespace alcp::cipher {
+
+namespace aesni {
+
+    /*
+     * Stitched CBC and SHA kernels. Each of the chunks is 64 bytes of AES-CBC
+     * from pSrc to pDest with the IV in pIv, done alongside one SHA block
+     * function on 64 bytes of pHashSrc. pIv and pHash are updated.
+     */
+    alc_error_t EncryptCbcSha1(const Uint8* pSrc,
+                               Uint8*       pDest,
+                               Uint64       chunks,
+                               const Uint8* pKey,
+                               int          nRounds,
+                               Uint8*       pIv,
+                               Uint32*      pHash,
+                               const Uint8* pHashSrc);
+
+    alc_error_t DecryptCbcSha1(const Uint8* pSrc,
+                               Uint8*       pDest,
+                               Uint64       chunks,
+                               const Uint8* pKey,
+                               int          nRounds,
+                               Uint8*       pIv,
+                               Uint32*      pHash,
+                               const Uint8* pHashSrc);
+
+    alc_error_t EncryptCbcSha256(const Uint8*  pSrc,
+                                 Uint8*        pDest,
+                                 Uint64        chunks,
+                                 const Uint8*  pKey,
+                                 int           nRounds,
+                                 Uint8*        pIv,
+                                 Uint32*       pHash,
+                                 const Uint8*  pHashSrc,
+                                 const Uint32* pHashConstants);
+
+    alc_error_t DecryptCbcSha256(const Uint8*  pSrc,
+                                 Uint8*        pDest,
+                                 Uint64        chunks,
+                                 const Uint8*  pKey,
+                                 int           nRounds,
+                                 Uint8*        pIv,
+                                 Uint32*       pHash,
+                                 const Uint8*  pHashSrc,
+                                 const Uint32* pHashConstants);
+
+} // namespace aesni
+
+/*
+ * @brief   AES-CBC with HMAC-SHA1 or HMAC-SHA256, the MAC-then-encrypt
+ *          protection of the TLS 1.2 and older CBC cipher suites.
+ *
+ * With a 13 byte TLS AAD (sequence number, type, version, length) set
+ * before it, one encryptUpdate() or decryptUpdate() call protects or opens
+ * a whole record:
+ *  - encryptUpdate() takes len bytes, the explicit IV block first from
+ *    TLS 1.1 on, and writes tlsRecordLen(len) bytes: the input, the MAC of
+ *    the AAD and payload, and the CBC padding, all encrypted.
+ *  - decryptUpdate() takes the whole record and decrypts it in place of
+ *    the output. The padding and the MAC are checked in constant time and
+ *    the record is rejected with ALC_ERROR_INVALID_DATA. The payload ends
+ *    where the last output byte, the pad length, and the MAC say.
+ * The length field of the AAD is not used, the MAC always covers the
+ * actual payload length. CBC chains from one record to the next, so the
+ * IV only has to be set once per connection.
+ *
+ * Without AAD the updates are plain CBC of whole blocks and getTag()
+ * returns the HMAC of the plaintext seen since the previous tag.
+ */
+template<bool cSha256>
+class ALCP_API_EXPORT CbcHmacSha final
+    : public Aes
+    , cipher::IDecryptUpdater
+    , cipher::IEncryptUpdater
+{
+  public:
+    static constexpr Uint64 cDigestLen    = cSha256 ? 32 : 20;
+    static constexpr Uint64 cHashBlockLen = 64;
+    static constexpr Uint64 cTlsAadLen    = 13;
+
+    explicit CbcHmacSha(const Uint8* pKey, const Uint32 keyLen);
+
+    ~CbcHmacSha();
+
+    // CBC always runs on AES-NI, SHA-NI only decides on the stitching
+    static bool isSupported(const Uint32 keyLen)
+    {
+        return utils::CpuId::cpuHasAesni()
+               && ((keyLen == ALC_KEY_LEN_128) || (keyLen == ALC_KEY_LEN_192)
+                   || (keyLen == ALC_KEY_LEN_256));
+    }
+
+    /**
+     * @brief   Output length of a TLS record with len bytes of input
+     */
+    static constexpr Uint64 tlsRecordLen(Uint64 len)
+    {
+        return (len + cDigestLen + Rijndael::cBlockSize)
+               & ~(Rijndael::cBlockSize - 1);
+    }
+
+    /**
+     * @brief   Set the HMAC key, keys longer than a hash block are hashed
+     * @param   pKey    MAC key
+     * @param   len     Length of the MAC key in bytes
+     * @return  alc_error_t     Error code
+     */
+    alc_error_t setMacKey(const Uint8* pKey, Uint64 len);
+
+    virtual alc_error_t setIv(Uint64 len, const Uint8* pIv);
+
+    virtual alc_error_t setAad(const Uint8* pInput, Uint64 len);
+
+    virtual alc_error_t getTag(Uint8* pOutput, Uint64 len);
+
+    virtual alc_error_t encryptUpdate(const Uint8* pInput,
+                                      Uint8*       pOutput,
+                                      Uint64       len,
+                                      const Uint8* pIv) override;
+
+    virtual alc_error_t decryptUpdate(const Uint8* pCipherText,
+                                      Uint8*       pPlainText,
+                                      Uint64       len,
+                                      const Uint8* pIv) override;
+
+  private:
+    void compress(Uint32* pHash, const Uint8* pSrc, Uint64 blocks) const;
+    void hashReset();
+    void hashUpdate(const Uint8* pSrc, Uint64 len);
+    void hashFinal(Uint8* pDigest);
+    void hmacFinal(Uint8* pMac);
+    void cbcEncrypt(const Uint8* pSrc, Uint8* pDest, Uint64 len);
+    void cbcDecrypt(const Uint8* pSrc, Uint8* pDest, Uint64 len);
+    alc_error_t tlsEncrypt(const Uint8* pSrc, Uint8* pDest, Uint64 len);
+    alc_error_t tlsDecrypt(const Uint8* pSrc, Uint8* pDest, Uint64 len);
+
+  private:
+    /* HMAC states after the ipad and opad blocks */
+    alignas(16) Uint32 m_head[8] = {};
+    alignas(16) Uint32 m_tail[8] = {};
+    /* running inner hash */
+    alignas(16) Uint32 m_md[8] = {};
+    Uint8  m_buf[cHashBlockLen] = {};
+    Uint64 m_num                = 0;
+    Uint64 m_total              = 0;
+
+    Uint8 m_iv[Rijndael::cBlockSize] = {};
+    Uint8 m_aad[cTlsAadLen]          = {};
+    bool  m_tls                      = false;
+    bool  m_stitched                 = false;
+};
+
+using CbcHmacSha1   = CbcHmacSha<false>;
+using CbcHmacSha256 = CbcHmacSha<true>;
+
+} // namespace alcp::cipher
@@ -129,6 +129,28 @@ class ALCP_API_EXPORT GcmAuth : public GcmAuthData
      */
     virtual alc_error_t setAad(const Uint8* pInput, Uint64 len) = 0;
 
+    /**
+     * @brief Encrypt a batch of independent records, each with its own IV,
+     * additional data and tag. The IV state is not kept after the call.
+     *
+     * @param pRecords Records to encrypt, tags are written into them
+     * @param count    Number of records
+     * @return alc_error_t Error code
+     */
+    virtual alc_error_t encryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count) = 0;
+
+    /**
+     * @brief Decrypt a batch of independent records, the tag computed over
+     * each cipher text is written into the record
+     *
+     * @param pRecords Records to decrypt, tags are written into them
+     * @param count    Number of records
+     * @return alc_error_t Error code
+     */
+    virtual alc_error_t decryptRecords(
+        const alc_cipher_aead_record_t* pRecords, Uint64 count) = 0;
+
   public:
     GcmAuth() {}
 
@@ -223,6 +245,12 @@ namespace vaes512 {
                                           Uint8*       pPlainText,
                                           Uint64       len,
                                           const Uint8* pIv) override;
+
+        virtual alc_error_t encryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
+
+        virtual alc_error_t decryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
     };
 
     class ALCP_API_EXPORT GcmAEAD192 : public GcmGhash
@@ -266,6 +294,12 @@ namespace vaes512 {
                                           Uint8*       pPlainText,
                                           Uint64       len,
                                           const Uint8* pIv) override;
+
+        virtual alc_error_t encryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
+
+        virtual alc_error_t decryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
     };
 
     class ALCP_API_EXPORT GcmAEAD256 : public GcmGhash
@@ -309,6 +343,12 @@ namespace vaes512 {
                                           Uint8*       pPlainText,
                                           Uint64       len,
                                           const Uint8* pIv) override;
+
+        virtual alc_error_t encryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
+
+        virtual alc_error_t decryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
     };
 
 } // namespace vaes512
@@ -394,6 +434,12 @@ namespace aesni {
                                           Uint8*       pPlainText,
                                           Uint64       len,
                                           const Uint8* pIv) override;
+
+        virtual alc_error_t encryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
+
+        virtual alc_error_t decryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
     };
 
     class ALCP_API_EXPORT GcmAEAD192 : public GcmGhash
@@ -437,6 +483,12 @@ namespace aesni {
                                           Uint8*       pPlainText,
                                           Uint64       len,
                                           const Uint8* pIv) override;
+
+        virtual alc_error_t encryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
+
+        virtual alc_error_t decryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
     };
 
     class ALCP_API_EXPORT GcmAEAD256 : public GcmGhash
@@ -480,6 +532,12 @@ namespace aesni {
                                           Uint8*       pPlainText,
                                           Uint64       len,
                                           const Uint8* pIv) override;
+
+        virtual alc_error_t encryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
+
+        virtual alc_error_t decryptRecords(
+            const alc_cipher_aead_record_t* pRecords, Uint64 count) override;
     };
 
 } // namespace aesni
@@ -43,6 +43,17 @@ ProcessInput(const Uint8 key[],
              Uint8       ciphertext[]);
 } // namespace alcp::cipher::chacha20::zen4
 
+namespace alcp::cipher::chacha20::avx2 {
+alc_error_t
+ProcessInput(const Uint8 key[],
+             Uint64      keylen,
+             const Uint8 iv[],
+             Uint64      ivlen,
+             const Uint8 plaintext[],
+             Uint64      plaintextLength,
+             Uint8       ciphertext[]);
+} // namespace alcp::cipher::chacha20::avx2
+
 namespace alcp::cipher::chacha20 {
 using utils::CpuCipherFeatures;
 using utils::CpuId;
@@ -28,6 +28,7 @@
 #include "alcp/base.hh"
 #include "alcp/capi/cipher/builder.hh"
 #include "alcp/cipher/chacha20.hh"
+#include "alcp/cipher/chacha20_poly1305.hh"
 
 namespace alcp::cipher::chacha20 {
 
@@ -42,4 +43,11 @@ class Chacha20Builder
                           const alc_key_info_t         ci_key_info);
 };
 
+class Chacha20Poly1305Builder
+{
+  public:
+    static alc_error_t Build(const alc_cipher_aead_info_t& cCipherAlgoInfo,
+                             Context&                      ctx);
+};
+
 }
\ No newline at end of file
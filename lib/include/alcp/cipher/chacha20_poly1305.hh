@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#pragma once
+
+#include "alcp/base.hh"
+#include "alcp/cipher/chacha20.hh"
+#include "alcp/mac/poly1305.hh"
+#include "alcp/utils/cpuid.hh"
+#include <alcp/error.h>
+
+namespace alcp::cipher::chacha20 {
+
+/**
+ * @brief ChaCha20-Poly1305 AEAD (RFC 8439 section 2.8)
+ *
+ * Keystream generation and MAC accumulation are stitched: data is walked once
+ * in cache sized chunks, each chunk is encrypted and then authenticated while
+ * still hot in L1 (authenticated then decrypted on the decrypt side).
+ *
+ * Usage: setIv() with a 12 byte nonce, setAad() any number of times,
+ * encryptUpdate()/decryptUpdate() any number of times, then getTag().
+ *
+ * @tparam cpu_cipher_feature Selects both the ChaCha20 and Poly1305 kernels
+ */
+template<CpuCipherFeatures cpu_cipher_feature = CpuCipherFeatures::eDynamic>
+class ALCP_API_EXPORT ChaCha20Poly1305
+{
+    static constexpr Uint64 cMKeylen    = 256 / 8;
+    static constexpr Uint64 cMNoncelen  = 96 / 8;
+    static constexpr Uint64 cMTaglen    = 16;
+    static constexpr Uint64 cMBlocklen  = 64;
+    static constexpr Uint64 cMChunkSize = 16 * cMBlocklen;
+    /*
+     * Data is keyed by counters 1 to 2^32 - 1, block 0 being the Poly1305
+     * key, so a message is one block short of a full 32-bit counter
+     */
+    static constexpr Uint64 cMMaxDataLen = ((1ULL << 32) - 1) * cMBlocklen;
+
+    ChaCha20<cpu_cipher_feature>                m_chacha20;
+    mac::poly1305::Poly1305<cpu_cipher_feature> m_poly1305;
+    alignas(16) Uint8 m_key[cMKeylen] = {};
+    // 4 byte block counter followed by the 12 byte nonce
+    alignas(16) Uint8 m_iv[16]                = {};
+    alignas(16) Uint8 m_keystream[cMBlocklen] = {};
+    Uint8  m_tag[cMTaglen]                    = {};
+    Uint64 m_keystream_offset                 = cMBlocklen;
+    Uint64 m_aad_len                          = 0;
+    Uint64 m_data_len                         = 0;
+    bool   m_key_set                          = false;
+    bool   m_iv_set                           = false;
+    bool   m_aad_done                         = false;
+    bool   m_tag_done                         = false;
+
+    alc_error_t padMac(Uint64 len);
+    alc_error_t crypt(const Uint8* pInput, Uint8* pOutput, Uint64 len);
+    void        setCounter(Uint32 counter);
+    void        keystreamBlock();
+
+  public:
+    /**
+     * @param pKey    Key
+     * @param keyLen  Length of the key in bits, must be 256; with any other
+     *                length the context stays unkeyed and setIv() fails
+     */
+    ChaCha20Poly1305(const Uint8* pKey, const Uint32 keyLen);
+    ~ChaCha20Poly1305();
+
+    /**
+     * @brief Starts a new message, derives the one-time Poly1305 key
+     * @param len  Length of the nonce in bytes, must be 12
+     * @param pIv  Nonce
+     * @return alc_error_t
+     */
+    alc_error_t setIv(Uint64 len, const Uint8* pIv);
+
+    /**
+     * @brief Absorbs additional authenticated data, must precede any
+     * encryptUpdate/decryptUpdate call of the same message
+     */
+    alc_error_t setAad(const Uint8* pAad, Uint64 len);
+
+    /**
+     * @brief Encrypts/decrypts the next part of the message, fails with
+     * ALC_ERROR_INVALID_SIZE once the whole message would exceed
+     * (2^32 - 1) * 64 bytes
+     */
+    alc_error_t encryptUpdate(const Uint8* pInput,
+                              Uint8*       pOutput,
+                              Uint64       len,
+                              const Uint8* pIv);
+
+    alc_error_t decryptUpdate(const Uint8* pInput,
+                              Uint8*       pOutput,
+                              Uint64       len,
+                              const Uint8* pIv);
+
+    /**
+     * @brief Completes the message and writes out the tag
+     * @param pOutput Tag output
+     * @param len     Tag length in bytes, 1 to 16 (16 recommended)
+     * @return alc_error_t
+     */
+    alc_error_t getTag(Uint8* pOutput, Uint64 len);
+
+    static bool isSupported(const Uint32 keyLen) { return keyLen == 256; }
+};
+
+} // namespace alcp::cipher::chacha20
@@ -438,6 +438,60 @@ namespace vaes512 {
                               __m128i                    reverse_mask_128,
                               Uint64*                    pHashSubkeyTable);
 
+    alc_error_t encryptGcmRecords128(
+        const alc_cipher_aead_record_t* pRecords,
+        Uint64                          count,
+        const Uint8*                    pKey,
+        int                             nRounds,
+        alcp::cipher::GcmAuthData*      gcm,
+        __m128i                         reverse_mask_128,
+        Uint64*                         pHashSubkeyTable);
+
+    alc_error_t encryptGcmRecords192(
+        const alc_cipher_aead_record_t* pRecords,
+        Uint64                          count,
+        const Uint8*                    pKey,
+        int                             nRounds,
+        alcp::cipher::GcmAuthData*      gcm,
+        __m128i                         reverse_mask_128,
+        Uint64*                         pHashSubkeyTable);
+
+    alc_error_t encryptGcmRecords256(
+        const alc_cipher_aead_record_t* pRecords,
+        Uint64                          count,
+        const Uint8*                    pKey,
+        int                             nRounds,
+        alcp::cipher::GcmAuthData*      gcm,
+        __m128i                         reverse_mask_128,
+        Uint64*                         pHashSubkeyTable);
+
+    alc_error_t decryptGcmRecords128(
+        const alc_cipher_aead_record_t* pRecords,
+        Uint64                          count,
+        const Uint8*                    pKey,
+        int                             nRounds,
+        alcp::cipher::GcmAuthData*      gcm,
+        __m128i                         reverse_mask_128,
+        Uint64*                         pHashSubkeyTable);
+
+    alc_error_t decryptGcmRecords192(
+        const alc_cipher_aead_record_t* pRecords,
+        Uint64                          count,
+        const Uint8*                    pKey,
+        int                             nRounds,
+        alcp::cipher::GcmAuthData*      gcm,
+        __m128i                         reverse_mask_128,
+        Uint64*                         pHashSubkeyTable);
+
+    alc_error_t decryptGcmRecords256(
+        const alc_cipher_aead_record_t* pRecords,
+        Uint64                          count,
+        const Uint8*                    pKey,
+        int                             nRounds,
+        alcp::cipher::GcmAuthData*      gcm,
+        __m128i                         reverse_mask_128,
+        Uint64*                         pHashSubkeyTable);
+
     alc_error_t processAdditionalDataGcm(const Uint8* pAdditionalData,
                                          Uint64       additionalDataLen,
                                          __m128i&     gHash_128,
@@ -77,6 +77,20 @@ class IDigest
      */
     virtual Uint64 getHashSize() = 0;
 
+    /**
+     * @brief Overwrites this digest with the intermediate state of rSrc, which
+     *        must be a digest of the same algorithm
+     *
+     * @return ALC_ERROR_INVALID_ARG when rSrc is a different digest
+     */
+    virtual alc_error_t copyState(const IDigest& rSrc) = 0;
+
+    /**
+     * @return A new digest holding the same intermediate state, owned by the
+     *         caller
+     */
+    virtual IDigest* clone() const = 0;
+
     virtual ~IDigest() {}
 };
 
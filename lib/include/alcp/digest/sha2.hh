@@ -88,6 +88,7 @@ class Sha256 final : public Sha2
   public:
     ALCP_API_EXPORT Sha256();
     ALCP_API_EXPORT Sha256(const alc_digest_info_t& rDigestInfo);
+    ALCP_API_EXPORT Sha256(const Sha256& rSrc);
     virtual ALCP_API_EXPORT ~Sha256();
 
     /**
@@ -172,9 +173,38 @@ class Sha256 final : public Sha2
     ALCP_API_EXPORT alc_error_t copyHash(Uint8* pHashBuf,
                                          Uint64 size) const override;
 
+    /**
+     * \brief   Takes over the intermediate state of another Sha256
+     *
+     * \param    rSrc    Sha256 digest to copy from
+     */
+    ALCP_API_EXPORT alc_error_t copyState(const IDigest& rSrc) override;
+
+    /**
+     * \return  A new Sha256 with the same intermediate state
+     */
+    ALCP_API_EXPORT IDigest* clone() const override;
+
   public:
     ALCP_API_EXPORT alc_error_t setIv(const void* pIv, Uint64 size);
 
+    /**
+     * \brief   Updates several independent hashes with one message each
+     *
+     * \notes   Same result as calling update(pSrc[i], len[i]) on every
+     *          digests[i]; whole blocks of the messages are hashed side by
+     *          side in SIMD lanes where the CPU allows it.
+     *
+     * \param    digests  Hashes to update, all distinct
+     * \param    pSrc     Message for each hash
+     * \param    len      Message length in bytes for each hash
+     * \param    num      Number of hashes
+     */
+    static ALCP_API_EXPORT alc_error_t updateMulti(Sha256* const      digests[],
+                                                   const Uint8* const pSrc[],
+                                                   const Uint64       len[],
+                                                   Uint64             num);
+
   private:
     class Impl;
     const Impl*           pImpl() const { return m_pimpl.get(); }
@@ -187,12 +217,23 @@ class ALCP_API_EXPORT Sha224 final : public Sha2
   public:
     Sha224();
     Sha224(const alc_digest_info_t& rDInfo);
+    Sha224(const Sha224& rSrc);
     ~Sha224();
     alc_error_t update(const Uint8* pMsgBuf, Uint64 size) override;
     void        finish() override;
     void        reset() override;
     alc_error_t finalize(const Uint8* pMsgBuf, Uint64 size) override;
     alc_error_t copyHash(Uint8* pHashBuf, Uint64 size) const override;
+    alc_error_t copyState(const IDigest& rSrc) override;
+    IDigest*    clone() const override;
+
+    /**
+     * @brief Multi-buffer update, see Sha256::updateMulti()
+     */
+    static alc_error_t updateMulti(Sha224* const      digests[],
+                                   const Uint8* const pSrc[],
+                                   const Uint64       len[],
+                                   Uint64             num);
 
     /**
      * @return The input block size to the hash function in bytes
@@ -40,12 +40,23 @@ class ALCP_API_EXPORT Sha384 final : public Sha2
   public:
     Sha384();
     Sha384(const alc_digest_info_t& rDInfo);
+    Sha384(const Sha384& rSrc);
     virtual ~Sha384();
     alc_error_t update(const Uint8* pMsgBuf, Uint64 size) override;
     void        finish() override;
     void        reset() override;
     alc_error_t finalize(const Uint8* pMsgBuf, Uint64 size) override;
     alc_error_t copyHash(Uint8* pHashBuf, Uint64 size) const override;
+    alc_error_t copyState(const IDigest& rSrc) override;
+    IDigest*    clone() const override;
+
+    /**
+     * @brief Multi-buffer update, see Sha512::updateMulti()
+     */
+    static alc_error_t updateMulti(Sha384* const      digests[],
+                                   const Uint8* const pSrc[],
+                                   const Uint64       len[],
+                                   Uint64             num);
 
     /**
      * @return The input block size to the hash function in bytes
@@ -112,6 +112,7 @@ class ALCP_API_EXPORT Sha512 final : public Sha2
   public:
     Sha512(alc_digest_len_t digest_len = ALC_DIGEST_LEN_512);
     Sha512(const alc_digest_info_t& rDigestInfo);
+    Sha512(const Sha512& rSrc);
     virtual ~Sha512();
 
   public:
@@ -185,8 +186,38 @@ class ALCP_API_EXPORT Sha512 final : public Sha2
      */
     alc_error_t copyHash(Uint8* pHashBuf, Uint64 size) const override;
 
+    /**
+     * @brief   Takes over the intermediate state of another Sha512 of the
+     *          same digest length
+     *
+     * @param    rSrc    Sha512 digest to copy from
+     */
+    alc_error_t copyState(const IDigest& rSrc) override;
+
+    /**
+     * @return  A new Sha512 with the same intermediate state
+     */
+    IDigest* clone() const override;
+
     alc_error_t setIv(const void* pIv, Uint64 size);
 
+    /**
+     * @brief   Updates several independent hashes with one message each
+     *
+     * @note    Same result as calling update(pSrc[i], len[i]) on every
+     *          digests[i]; whole blocks of the messages are hashed side by
+     *          side in SIMD lanes where the CPU allows it.
+     *
+     * @param    digests  Hashes to update, all distinct
+     * @param    pSrc     Message for each hash
+     * @param    len      Message length in bytes for each hash
+     * @param    num      Number of hashes
+     */
+    static alc_error_t updateMulti(Sha512* const      digests[],
+                                   const Uint8* const pSrc[],
+                                   const Uint64       len[],
+                                   Uint64             num);
+
     /**
      * @return The input block size to the hash function in bytes
      */
@@ -51,10 +51,26 @@ static constexpr Uint8 cRotationConstants[cDim][cDim] = {
     { 18, 2, 61, 56, 14 }
 };
 
+/*
+ * Round constants for the iota step, one per round of Keccak-f[1600]
+ */
+__attribute__((
+    aligned(64))) static constexpr Uint64 cKeccakRoundConstants[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808A,
+    0x8000000080008000, 0x000000000000808B, 0x0000000080000001,
+    0x8000000080008081, 0x8000000000008009, 0x000000000000008A,
+    0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+    0x000000008000808B, 0x800000000000008B, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+    0x000000000000800A, 0x800000008000000A, 0x8000000080008081,
+    0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+};
+
 class ALCP_API_EXPORT Sha3 : public Digest
 {
   public:
     Sha3(const alc_digest_info_t& rDigestInfo);
+    Sha3(const Sha3& rSrc);
     ~Sha3();
 
   public:
@@ -72,6 +88,35 @@ class ALCP_API_EXPORT Sha3 : public Digest
      */
     alc_error_t update(const Uint8* pMsgBuf, Uint64 size);
 
+    /**
+     * @brief   Updates num independent digests, each with its own buffer
+     *
+     * @note    Same result as calling update() on every digest in turn.
+     *          Digests of the same rate have their Keccak states permuted
+     *          side by side, 4 or 8 per call depending on the CPU.
+     *
+     * @param    digests    digests to update, must not be finalized
+     * @param    pSrc       message buffer for each digest
+     * @param    len        message size for each digest
+     * @param    num        number of digests
+     */
+    static alc_error_t updateMulti(Sha3* const        digests[],
+                                   const Uint8* const pSrc[],
+                                   const Uint64       len[],
+                                   Uint64             num);
+
+    /**
+     * @brief   Finalizes num independent digests
+     *
+     * @note    Same result as calling finalize(nullptr, 0) on every digest,
+     *          both the last absorb and the squeeze of long SHAKE outputs
+     *          are batched. Digests already finalized are left as they are.
+     *
+     * @param    digests    digests to finalize
+     * @param    num        number of digests
+     */
+    static alc_error_t finalizeMulti(Sha3* const digests[], Uint64 num);
+
     /**
      * @brief   Cleans up any resource that was allocated
      *
@@ -122,6 +167,19 @@ class ALCP_API_EXPORT Sha3 : public Digest
      */
     alc_error_t copyHash(Uint8* pHash, Uint64 size) const;
 
+    /**
+     * @brief  Takes over the intermediate state of another Sha3 of the same
+     *         variant, SHAKE output length included
+     *
+     * @param    rSrc    Sha3 digest to copy from
+     */
+    alc_error_t copyState(const IDigest& rSrc);
+
+    /**
+     * @return A new Sha3 with the same intermediate state
+     */
+    IDigest* clone() const;
+
     /**
      * @return The input block size to the hash function in bytes
      */
@@ -158,4 +216,17 @@ namespace zen3 {
                       Uint64 hash_size,
                       Uint64 chunk_size);
 } // namespace zen3
+
+namespace zen4 {
+
+    alc_error_t Sha3Update(Uint64* state,
+                           Uint64* pSrc,
+                           Uint64  msg_size,
+                           Uint64  m_src_size_u64);
+
+    void Sha3Finalize(Uint8* state,
+                      Uint8* hash,
+                      Uint64 hash_size,
+                      Uint64 chunk_size);
+} // namespace zen4
 } // namespace alcp::digest
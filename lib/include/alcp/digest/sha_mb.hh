@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#pragma once
+
+#include "alcp/error.h" // for alc_error_t
+
+#include <algorithm>
+
+namespace alcp::digest {
+
+/*
+ * Multi-buffer SHA-2 and SHA-3: independent messages are hashed side by side,
+ * one per SIMD lane, so that short messages still fill the vector registers.
+ */
+
+/* Messages taken per pass by the multi-buffer updates */
+static constexpr Uint64 cMultiBufferBatch = 64;
+
+/* One message stream in a multi-buffer update */
+template<typename WORD>
+struct ShaLane
+{
+    WORD*        pHash;
+    const Uint8* pSrc;
+    Uint64       numBlocks;
+};
+
+namespace avx2 {
+    /* Hash numBlocks blocks of 8 independent messages */
+    void ShaUpdate256x8(Uint32*       pHash[8],
+                        const Uint8*  pSrc[8],
+                        Uint64        numBlocks,
+                        const Uint32* pHashConstants);
+
+    /* Hash numBlocks blocks of 4 independent messages */
+    void ShaUpdate512x4(Uint64*      pHash[4],
+                        const Uint8* pSrc[4],
+                        Uint64       numBlocks);
+
+    /* Absorb numBlocks blocks of chunkSize bytes into 4 Keccak states */
+    void Sha3UpdateX4(Uint64*      pState[4],
+                      const Uint8* pSrc[4],
+                      Uint64       numBlocks,
+                      Uint64       chunkSize);
+} // namespace avx2
+
+namespace zen4 {
+    /* Hash numBlocks blocks of 16 independent messages */
+    void ShaUpdate256x16(Uint32*       pHash[16],
+                         const Uint8*  pSrc[16],
+                         Uint64        numBlocks,
+                         const Uint32* pHashConstants);
+
+    /* Hash numBlocks blocks of 8 independent messages */
+    void ShaUpdate512x8(Uint64*      pHash[8],
+                        const Uint8* pSrc[8],
+                        Uint64       numBlocks);
+
+    /* Absorb numBlocks blocks of chunkSize bytes into 8 Keccak states */
+    void Sha3UpdateX8(Uint64*      pState[8],
+                      const Uint8* pSrc[8],
+                      Uint64       numBlocks,
+                      Uint64       chunkSize);
+} // namespace zen4
+
+/**
+ * @brief Runs all lanes through a LANES wide kernel
+ *
+ * Lanes are packed into kernel slots and every call advances all slots by
+ * the shortest remaining length; a slot that drains is refilled with the next
+ * pending lane. Once fewer than minActive slots are busy, the rest is handed
+ * to the single-buffer path.
+ *
+ * STATE_WORDS is the size of a hash state in WORDs, the scratch state of an
+ * idle slot has to be that large.
+ *
+ * @param lanes      message streams, consumed in place
+ * @param num        number of lanes
+ * @param blockSize  size of one hash block in bytes
+ * @param minActive  smallest number of busy slots worth a kernel call
+ * @param kernel     kernel(hash[], src[], numBlocks)
+ * @param single     single(laneIndex, src, len) for the leftovers
+ */
+template<typename WORD,
+         int LANES,
+         int STATE_WORDS = 8,
+         typename KERNEL,
+         typename SINGLE>
+void
+ShaMultiBufferSchedule(ShaLane<WORD> lanes[],
+                       Uint64        num,
+                       Uint64        blockSize,
+                       int           minActive,
+                       KERNEL        kernel,
+                       SINGLE        single)
+{
+    WORD         dummy_hash[LANES][STATE_WORDS] = {};
+    WORD*        hash[LANES];
+    const Uint8* src[LANES];
+    Uint64       slot_lane[LANES];
+    bool         busy[LANES] = {};
+    Uint64       next        = 0;
+
+    auto refill = [&](int slot) {
+        while (next < num && lanes[next].numBlocks == 0) {
+            next++;
+        }
+        busy[slot] = next < num;
+        if (busy[slot]) {
+            slot_lane[slot] = next++;
+        }
+    };
+
+    for (int i = 0; i < LANES; i++) {
+        refill(i);
+    }
+
+    for (;;) {
+        int    active     = 0;
+        Uint64 min_blocks = ~0ULL;
+        for (int i = 0; i < LANES; i++) {
+            if (busy[i]) {
+                active++;
+                min_blocks =
+                    std::min(min_blocks, lanes[slot_lane[i]].numBlocks);
+            }
+        }
+        if (active < minActive) {
+            break;
+        }
+
+        const Uint8* p_filler = nullptr;
+        for (int i = 0; i < LANES; i++) {
+            if (busy[i]) {
+                hash[i]  = lanes[slot_lane[i]].pHash;
+                src[i]   = lanes[slot_lane[i]].pSrc;
+                p_filler = src[i];
+            }
+        }
+        // Idle slots re-read a busy lane's input into a scratch state
+        for (int i = 0; i < LANES; i++) {
+            if (!busy[i]) {
+                hash[i] = dummy_hash[i];
+                src[i]  = p_filler;
+            }
+        }
+
+        kernel(hash, src, min_blocks);
+
+        for (int i = 0; i < LANES; i++) {
+            if (busy[i]) {
+                ShaLane<WORD>& lane = lanes[slot_lane[i]];
+                lane.pSrc += min_blocks * blockSize;
+                lane.numBlocks -= min_blocks;
+                if (lane.numBlocks == 0) {
+                    refill(i);
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < LANES; i++) {
+        if (busy[i]) {
+            ShaLane<WORD>& lane = lanes[slot_lane[i]];
+            single(slot_lane[i], lane.pSrc, lane.numBlocks * blockSize);
+        }
+    }
+    for (; next < num; next++) {
+        if (lanes[next].numBlocks) {
+            single(next, lanes[next].pSrc, lanes[next].numBlocks * blockSize);
+        }
+    }
+}
+
+} // namespace alcp::digest
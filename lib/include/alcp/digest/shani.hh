@@ -36,4 +36,7 @@ namespace alcp::digest { namespace shani {
                              const Uint8*  pSrc,
                              Uint64        src_len,
                              const Uint32* pHashConstants);
+
+    /* SHA-1 block function, pHash holds the five state words in order */
+    alc_error_t ShaUpdate1(Uint32* pHash, const Uint8* pSrc, Uint64 src_len);
 }} // namespace alcp::digest::shani
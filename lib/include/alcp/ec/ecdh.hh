@@ -28,19 +28,19 @@
 
 #pragma once
 
-#include <openssl/evp.h>
-
 #include "alcp/alcp.hh"
 #include "alcp/ec.hh"
 
 #ifdef COMPILER_IS_GCC
 #define UNROLL_4  _Pragma("GCC unroll 4")
+#define UNROLL_9  _Pragma("GCC unroll 9")
 #define UNROLL_16 _Pragma("GCC unroll 16")
 #define UNROLL_30 _Pragma("GCC unroll 30")
 #define UNROLL_51 _Pragma("GCC unroll 51")
 #define UNROLL_52 _Pragma("GCC unroll 52")
 #else
 #define UNROLL_4
+#define UNROLL_9
 #define UNROLL_16
 #define UNROLL_30
 #define UNROLL_51
@@ -117,6 +117,23 @@ class X25519 : public Ec
                                             const Uint8* pPublicKey,
                                             Uint64*      pKeyLength) override;
 
+    /**
+     * @brief Function computes many x25519 secret keys at once, each with
+     * its own privateKey. Meant for throughput, on AVX-512 IFMA hosts eight
+     * keys are computed side by side.
+     *
+     * @param  pSecretKeys  pointer to output secretKeys, count * 32 bytes
+     * @param  pPrivKeys    pointer to Input privateKeys, count * 32 bytes
+     * @param  pPublicKeys  pointer to Input publicKeys of the remote peers,
+     * count * 32 bytes
+     * @param  count        number of secret keys to compute
+     * @return Status Error code
+     */
+    ALCP_API_EXPORT Status computeSecretKeyBatch(Uint8*       pSecretKeys,
+                                                 const Uint8* pPrivKeys,
+                                                 const Uint8* pPublicKeys,
+                                                 Uint64       count);
+
     /**
      * @brief Function validates public key from remote peer
      *
@@ -148,7 +165,7 @@ class X25519 : public Ec
 class ALCP_API_EXPORT P256 : public Ec
 {
   public:
-     P256() = default;
+    P256();
     ~P256();
 
     /**
@@ -169,8 +186,7 @@ class ALCP_API_EXPORT P256 : public Ec
      * publicKey
      * @return Status Error code
      */
-    Status generatePublicKey(Uint8*       pPublicKey,
-                                             const Uint8* pPrivKey) override;
+    Status generatePublicKey(Uint8* pPublicKey, const Uint8* pPrivKey) override;
 
     /**
      * @brief Function computes p256 secret key with publicKey from remotePeer
@@ -183,8 +199,8 @@ class ALCP_API_EXPORT P256 : public Ec
      * @return Status Error code
      */
     Status computeSecretKey(Uint8*       pSecretKey,
-                                            const Uint8* pPublicKey,
-                                            Uint64*      pKeyLength) override;
+                            const Uint8* pPublicKey,
+                            Uint64*      pKeyLength) override;
 
     /**
      * @brief Function validates public key from remote peer
@@ -195,6 +211,33 @@ class ALCP_API_EXPORT P256 : public Ec
      */
     virtual Status validatePublicKey(const Uint8* pPublicKey,
                                      Uint64       pKeyLength) override;
+
+    /**
+     * @brief Function signs a message digest with the private key, ECDSA
+     * with a deterministic RFC 6979 nonce
+     *
+     * @param  pDigest     pointer to the message digest
+     * @param  digestSize  size of the digest in bytes
+     * @param  pSignature  pointer to output signature r || s, twice the key
+     * size
+     * @return Status Error code
+     */
+    Status sign(const Uint8* pDigest, Uint64 digestSize, Uint8* pSignature);
+
+    /**
+     * @brief Function verifies an ECDSA signature of a message digest
+     *
+     * @param  pDigest     pointer to the message digest
+     * @param  digestSize  size of the digest in bytes
+     * @param  pSignature  pointer to signature r || s
+     * @param  pPublicKey  pointer to signer public key, affine x || y
+     * @return Status Error code
+     */
+    Status verify(const Uint8* pDigest,
+                  Uint64       digestSize,
+                  const Uint8* pSignature,
+                  const Uint8* pPublicKey);
+
     /**
      * @brief Function resets the internal state
      *
@@ -210,12 +253,195 @@ class ALCP_API_EXPORT P256 : public Ec
 
   private:
     Uint8 m_PrivKey[32] = {};
+};
+// p-256 api
+
+class ALCP_API_EXPORT P384 : public Ec
+{
+  public:
+    P384();
+    ~P384();
+
+    /**
+     * @brief Function sets the privateKey
+     *
+     * @param  pPrivKey    pointer to Input privateKey
+     *
+     * @return Status Error code
+     */
+    Status setPrivateKey(const Uint8* pPrivKey) override;
+
+    /**
+     * @brief Function generates p384 public key using input privateKey
+     * generated public key is shared with the peer.
+     *
+     * @param  pPublicKey  pointer to Output Publickey generated
+     * @param  pPrivKey    pointer to Input privateKey used for generating
+     * publicKey
+     * @return Status Error code
+     */
+    Status generatePublicKey(Uint8* pPublicKey, const Uint8* pPrivKey) override;
+
+    /**
+     * @brief Function computes p384 secret key with publicKey from remotePeer
+     * and local privatekey.
+     *
+     * @param  pSecretKey  pointer to output secretKey
+     * @param  pPublicKey  pointer to Input privateKey used for generating
+     * publicKey
+     * @param  pKeyLength  pointer to keyLength
+     * @return Status Error code
+     */
+    Status computeSecretKey(Uint8*       pSecretKey,
+                            const Uint8* pPublicKey,
+                            Uint64*      pKeyLength) override;
+
+    /**
+     * @brief Function validates public key from remote peer
+     *
+     * @param  pPublicKey  pointer to public key publicKey
+     * @param  pKeyLength  pointer to keyLength
+     * @return Status Error code
+     */
+    virtual Status validatePublicKey(const Uint8* pPublicKey,
+                                     Uint64       pKeyLength) override;
+
+    /**
+     * @brief Function signs a message digest with the private key, ECDSA
+     * with a deterministic RFC 6979 nonce
+     *
+     * @param  pDigest     pointer to the message digest
+     * @param  digestSize  size of the digest in bytes
+     * @param  pSignature  pointer to output signature r || s, twice the key
+     * size
+     * @return Status Error code
+     */
+    Status sign(const Uint8* pDigest, Uint64 digestSize, Uint8* pSignature);
+
+    /**
+     * @brief Function verifies an ECDSA signature of a message digest
+     *
+     * @param  pDigest     pointer to the message digest
+     * @param  digestSize  size of the digest in bytes
+     * @param  pSignature  pointer to signature r || s
+     * @param  pPublicKey  pointer to signer public key, affine x || y
+     * @return Status Error code
+     */
+    Status verify(const Uint8* pDigest,
+                  Uint64       digestSize,
+                  const Uint8* pSignature,
+                  const Uint8* pPublicKey);
+
+    /**
+     * @brief Function resets the internal state
+     *
+     * @return nothing
+     */
+    void reset() override;
+
     /**
-     *  m_pSelfKey is a keypair, which represents Peer1 (US)
-     *  m_pPeerKey is pKey for storing public key of Peer 2
+     * @brief  Returns the key size in bytes
+     * @return key size
      */
-    EVP_PKEY *m_pSelfKey = nullptr, *m_pPeerKey = nullptr;
+    Uint64 getKeySize() override;
+
+  private:
+    Uint8 m_PrivKey[48] = {};
 };
-// p-256 api
+// p-384 api
+
+class ALCP_API_EXPORT P521 : public Ec
+{
+  public:
+    P521();
+    ~P521();
+
+    /**
+     * @brief Function sets the privateKey
+     *
+     * @param  pPrivKey    pointer to Input privateKey
+     *
+     * @return Status Error code
+     */
+    Status setPrivateKey(const Uint8* pPrivKey) override;
+
+    /**
+     * @brief Function generates p521 public key using input privateKey
+     * generated public key is shared with the peer.
+     *
+     * @param  pPublicKey  pointer to Output Publickey generated
+     * @param  pPrivKey    pointer to Input privateKey used for generating
+     * publicKey
+     * @return Status Error code
+     */
+    Status generatePublicKey(Uint8* pPublicKey, const Uint8* pPrivKey) override;
+
+    /**
+     * @brief Function computes p521 secret key with publicKey from remotePeer
+     * and local privatekey.
+     *
+     * @param  pSecretKey  pointer to output secretKey
+     * @param  pPublicKey  pointer to Input privateKey used for generating
+     * publicKey
+     * @param  pKeyLength  pointer to keyLength
+     * @return Status Error code
+     */
+    Status computeSecretKey(Uint8*       pSecretKey,
+                            const Uint8* pPublicKey,
+                            Uint64*      pKeyLength) override;
+
+    /**
+     * @brief Function validates public key from remote peer
+     *
+     * @param  pPublicKey  pointer to public key publicKey
+     * @param  pKeyLength  pointer to keyLength
+     * @return Status Error code
+     */
+    virtual Status validatePublicKey(const Uint8* pPublicKey,
+                                     Uint64       pKeyLength) override;
+
+    /**
+     * @brief Function signs a message digest with the private key, ECDSA
+     * with a deterministic RFC 6979 nonce
+     *
+     * @param  pDigest     pointer to the message digest
+     * @param  digestSize  size of the digest in bytes
+     * @param  pSignature  pointer to output signature r || s, twice the key
+     * size
+     * @return Status Error code
+     */
+    Status sign(const Uint8* pDigest, Uint64 digestSize, Uint8* pSignature);
+
+    /**
+     * @brief Function verifies an ECDSA signature of a message digest
+     *
+     * @param  pDigest     pointer to the message digest
+     * @param  digestSize  size of the digest in bytes
+     * @param  pSignature  pointer to signature r || s
+     * @param  pPublicKey  pointer to signer public key, affine x || y
+     * @return Status Error code
+     */
+    Status verify(const Uint8* pDigest,
+                  Uint64       digestSize,
+                  const Uint8* pSignature,
+                  const Uint8* pPublicKey);
+
+    /**
+     * @brief Function resets the internal state
+     *
+     * @return nothing
+     */
+    void reset() override;
+
+    /**
+     * @brief  Returns the key size in bytes
+     * @return key size
+     */
+    Uint64 getKeySize() override;
+
+  private:
+    Uint8 m_PrivKey[66] = {};
+};
+// p-521 api
 
 } // namespace alcp::ec
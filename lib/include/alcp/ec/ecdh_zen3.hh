@@ -36,4 +36,31 @@ namespace alcp::ec { namespace zen3 {
 
     void AlcpScalarPubX25519(Int8* privKeyRadix32, Uint8* pPublicKey);
 
+    bool alcpScalarMulP256(Uint8*       pSecret,
+                           const Uint8* pPrivKey,
+                           const Uint8* pPublicKey);
+
+    void AlcpScalarPubP256(Uint8* pPublicKey, const Uint8* pPrivKey);
+
+    bool AlcpValidatePubP256(const Uint8* pPublicKey);
+
+    bool AlcpDoubleScalarMulP256(Uint8*       pX,
+                                 const Uint8* pU1,
+                                 const Uint8* pU2,
+                                 const Uint8* pPublicKey);
+
+    void AlcpOrderInverseP256(Uint64 r[4], const Uint64 a[4]);
+
+    void AlcpScalarPubEd25519(Uint8* pPoint, const Uint8* pScalar);
+
+    bool AlcpVerifyEd25519(const Uint8* pR,
+                           const Uint8* pS,
+                           const Uint8* pK,
+                           const Uint8* pPublicKey);
+
+    bool AlcpMultiScalarMulEd25519(const Uint8* pBaseScalar,
+                                   const Uint8* pScalars,
+                                   const Uint8* pPoints,
+                                   Uint64       count);
+
 }} // namespace alcp::ec::zen3
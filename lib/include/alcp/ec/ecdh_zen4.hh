@@ -34,4 +34,12 @@ namespace alcp::ec { namespace zen4 {
                                        const Uint8* privKeyRadix32,
                                        const Uint8* pPublicKey);
 
+    /*
+     * Eight X25519 ladders at once, pScalars (clamped), pPoints and
+     * pSecrets hold eight 32 byte values each
+     */
+    void alcpScalarMulX25519Radix51BitX8(Uint8*       pSecrets,
+                                         const Uint8* pScalars,
+                                         const Uint8* pPoints);
+
 }} // namespace alcp::ec::zen4
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/base.hh"
+#include "alcp/ec/weierstrass.hh"
+
+namespace alcp::ec {
+
+/*
+ * What ECDSA needs from a curve: the group order and the two scalar
+ * multiplications, which each curve maps onto its fastest kernel. Scalars and
+ * coordinates are m_size big endian bytes
+ */
+template<int N>
+struct EcdsaCurve
+{
+    const weierstrass::Modulus<N>* m_pOrder;
+    Uint64                         m_orderBits;
+    Uint64                         m_size;
+
+    // affine x of k * G
+    void (*m_baseMulX)(Uint8* pX, const Uint8* pScalar);
+
+    // affine x of u1 * G + u2 * Q, false when Q is not a valid public key or
+    // the sum is the point at infinity
+    bool (*m_doubleMulX)(Uint8*       pX,
+                         const Uint8* pU1,
+                         const Uint8* pU2,
+                         const Uint8* pPublicKey);
+
+    // r = a^-1 mod n, both in the Montgomery domain of m_pOrder. nullptr
+    // takes the generic MontInverse
+    void (*m_orderInverse)(Uint64 r[N], const Uint64 a[N]);
+};
+
+/**
+ * @brief Signs a message digest, the nonce is derived from the private key
+ * and the digest as in RFC 6979 with HMAC-SHA256, SHA384 or SHA512 for 32, 48
+ * and 66 byte curves
+ *
+ * @param  rCurve       Curve to sign on
+ * @param  pPrivKey     Private key, 0 < key < n
+ * @param  pDigest      Message digest, truncated to the order length
+ * @param  digestSize   Size of the digest in bytes
+ * @param  pSignature   r || s, 2 * m_size bytes
+ * @return Status Error code
+ */
+template<int N>
+Status
+EcdsaSign(const EcdsaCurve<N>& rCurve,
+          const Uint8*         pPrivKey,
+          const Uint8*         pDigest,
+          Uint64               digestSize,
+          Uint8*               pSignature);
+
+/**
+ * @brief Verifies an r || s signature of a message digest
+ *
+ * @param  rCurve       Curve the key belongs to
+ * @param  pPublicKey   Affine x || y of the signer
+ * @param  pDigest      Message digest, truncated to the order length
+ * @param  digestSize   Size of the digest in bytes
+ * @param  pSignature   r || s, 2 * m_size bytes
+ * @return Status Error code
+ */
+template<int N>
+Status
+EcdsaVerify(const EcdsaCurve<N>& rCurve,
+            const Uint8*         pPublicKey,
+            const Uint8*         pDigest,
+            Uint64               digestSize,
+            const Uint8*         pSignature);
+
+} // namespace alcp::ec
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#pragma once
+
+#include "alcp/alcp.hh"
+#include "alcp/ec.hh"
+
+namespace alcp::ec {
+
+/**
+ * Ed25519 signatures, RFC 8032 (pure variant, no prehash or context)
+ */
+class ALCP_API_EXPORT Ed25519
+{
+  public:
+    Ed25519();
+    ~Ed25519();
+
+    /**
+     * @brief Function sets the privateKey, the 32 byte seed the signing
+     * scalar and public key are derived from
+     *
+     * @param  pPrivKey    pointer to Input privateKey
+     *
+     * @return Status Error code
+     */
+    Status setPrivateKey(const Uint8* pPrivKey);
+
+    /**
+     * @brief Function generates the 32 byte encoded public key of a
+     * privateKey, the privateKey is also set for signing
+     *
+     * @param  pPublicKey  pointer to Output Publickey generated
+     * @param  pPrivKey    pointer to Input privateKey used for generating
+     * publicKey
+     * @return Status Error code
+     */
+    Status generatePublicKey(Uint8* pPublicKey, const Uint8* pPrivKey);
+
+    /**
+     * @brief Function signs a message with the privateKey
+     *
+     * @param  pMessage     pointer to the message
+     * @param  messageSize  size of the message in bytes
+     * @param  pSignature   pointer to output signature R || S, 64 bytes
+     * @return Status Error code
+     */
+    Status sign(const Uint8* pMessage, Uint64 messageSize, Uint8* pSignature);
+
+    /**
+     * @brief Function verifies a signature of a message, with the
+     * cofactored equation [8][S]B = [8]R + [8][k]A of RFC 8032 5.1.7
+     *
+     * @param  pMessage     pointer to the message
+     * @param  messageSize  size of the message in bytes
+     * @param  pSignature   pointer to signature R || S
+     * @param  pPublicKey   pointer to signer public key
+     * @return Status Error code
+     */
+    Status verify(const Uint8* pMessage,
+                  Uint64       messageSize,
+                  const Uint8* pSignature,
+                  const Uint8* pPublicKey);
+
+    /**
+     * @brief Function verifies many signatures at once. A random linear
+     * combination of all the verification equations is checked with one
+     * multi scalar multiplication, much cheaper than verifying one by one.
+     *
+     * @note The combined check is the cofactored equation of verify(), so
+     * both accept the same signatures. When the combined check fails every
+     * signature is verified on its own to find the bad ones.
+     *
+     * @param  pMessages     messages
+     * @param  pMessageSizes size of each message in bytes
+     * @param  pSignatures   signatures R || S
+     * @param  pPublicKeys   signer public keys
+     * @param  count         number of signatures
+     * @param  pValid        optional, the result of each signature
+     * @return Status Ok when all signatures are valid
+     */
+    Status verifyBatch(const Uint8* const pMessages[],
+                       const Uint64       pMessageSizes[],
+                       const Uint8* const pSignatures[],
+                       const Uint8* const pPublicKeys[],
+                       Uint64             count,
+                       bool               pValid[] = nullptr);
+
+    /**
+     * @brief Function resets the internal state
+     *
+     * @return nothing
+     */
+    void reset();
+
+    /**
+     * @brief  Returns the key size in bytes
+     * @return key size
+     */
+    Uint64 getKeySize();
+
+  private:
+    Uint8 m_PrivKey[32]   = {};
+    Uint8 m_Scalar[32]    = {};
+    Uint8 m_Prefix[32]    = {};
+    Uint8 m_PublicKey[32] = {};
+};
+
+} // namespace alcp::ec
@@ -0,0 +1,427 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/base.hh"
+
+namespace alcp::ec {
+
+/*
+ * Static P-521 base point tables, coordinates in radix 2^58 (nine limbs, the
+ * top one 57 bits) and normal (not Montgomery) form.
+ *
+ * cP521CombTable[t][j - 1] is sum(bit b of j * 2^(66 * b + 264 * t)) * G for
+ * the two tables of the four teeth comb. cP521OddTable[j] is (2 * j + 1) * G
+ * for the wNAF verification.
+ */
+// clang-format off
+static constexpr Uint64 cP521CombTable[2][15][2][9] = {
+  {
+    { { 0x17e7e31c2e5bd66, 0x22cf0615a90a6fe, 0x0127a2ffa8de334,
+        0x1dfbf9d64a3f877, 0x06b4d3dbaa14b5e, 0x14fed487e0a2bd8,
+        0x15b4429c6481390, 0x3a73678fb2d988e, 0x0c6858e06b70404 },
+      { 0x0be94769fd16650, 0x31c21a89cb09022, 0x39013fad0761353,
+        0x2657bd099031542, 0x3273e662c97ee72, 0x1e6d11a05ebef45,
+        0x3d1bd998f544495, 0x3001172297ed0b1, 0x11839296a789a3b } },
+    { { 0x03986670f0ccb51, 0x387404d9525d2a0, 0x0f21b2b29ed9b87,
+        0x2aa8eb74cddfd63, 0x0e9d08ffb06c0e9, 0x19d8589fc4ecd74,
+        0x0a3ef4dd8bf44c9, 0x0eb6e92863051d6, 0x13e96a576dda004 },
+      { 0x3de24f8632d95a3, 0x057bc5314920a4a, 0x063e9bdaba1979f,
+        0x3d2a58adc1eab76, 0x214258d98dde053, 0x18708d7316628b7,
+        0x3fd32c9fa5a19d0, 0x33ab03b519443a3, 0x1852aea9dd1ef78 } },
+    { { 0x0a91dd8eaaf1fe3, 0x0e19891002d4af4, 0x06a921abf0d20db,
+        0x26a9da32503fda8, 0x09a1eec37941287, 0x1ce0d0f3cde46af,
+        0x22abc1c913fbe62, 0x3cc4dca2d0aaf88, 0x157874c0a862b9e },
+      { 0x2c8f184e6f03d49, 0x0d5f907922f80c2, 0x1ef3815cbdefa9c,
+        0x2ad7f6370f00b39, 0x1faeb109d7a41c7, 0x213d34e12fbd9f2,
+        0x2f0aae2f98cca1a, 0x25a2df80f51f59c, 0x00724b1ab581d58 } },
+    { { 0x04f2d4bdf9314e0, 0x3a14379e802ab24, 0x1083582efb03daa,
+        0x20fb1ff9b49e48c, 0x2199d74a880f1c2, 0x25401f9cb56ce65,
+        0x33f03e5f120b9b3, 0x2da18c348ddcd1d, 0x121f4c192733b78 },
+      { 0x103ff6dfa8b51f0, 0x2bed45038af7c3c, 0x380e83254171ae7,
+        0x2e33684365444c0, 0x24f3a8c01e83501, 0x3201c1a4415ddc7,
+        0x2238218f52196aa, 0x29fc4d826c2aa95, 0x1db8c25790694a0 } },
+    { { 0x00370ccb2c0958d, 0x3bc599a69ece1cc, 0x33cf480c9b3889a,
+        0x3cbeacf85249e4b, 0x2507489670b2984, 0x34cf6caa5d4790d,
+        0x0a4daa9cab99d5a, 0x1cc95365174cad1, 0x00aa26cca5216c7 },
+      { 0x1be1d41f9e66d18, 0x3bbe5aa845f9eb3, 0x14a2ddb0d24b80a,
+        0x09d7262defc14c8, 0x2dfd3c8486dcfb2, 0x329354b184f9d0d,
+        0x151e646e703fa13, 0x149f43238a5dc61, 0x1c6f5e90eacbfa8 } },
+    { { 0x2c2f1e74ab2d58f, 0x2fe0b0a825e00a8, 0x2b24770bb76ac1b,
+        0x3b5599fdef5960f, 0x2fd96897e8e4ed9, 0x3ef83c576300761,
+        0x1cdcb166395a133, 0x3ac954793ce7766, 0x082de08424a720d },
+      { 0x3aa53b260ea91af, 0x212bdde8c77f765, 0x32395cd09bbea43,
+        0x36bcc016387360b, 0x2e5c78e97997c19, 0x1d6c611510ed831,
+        0x02ce16faae9b5f5, 0x3ea1973a1bccc23, 0x073983ce58f4f63 } },
+    { { 0x2e931318217609d, 0x2a7750904bf002b, 0x264c286c63297f8,
+        0x359efc7197b845f, 0x38d03eee5cc3782, 0x2ae4de67a305136,
+        0x3784c701acacb29, 0x3361c857ac6d6c1, 0x0f82c409fa81aff },
+      { 0x07d3766378139a4, 0x25a7aed56faa4c0, 0x0d6f68c8bc9dc6d,
+        0x1857e4fc90b1f18, 0x2741717d9844e84, 0x02fc483a118728a,
+        0x1699d78e930e79f, 0x2db7b85552809ad, 0x07de69c77026a4f } },
+    { { 0x1b51bb04bee80d7, 0x3da87dda4b79a58, 0x246ca0ebc3bd0e1,
+        0x29e4c1913c20de7, 0x3390db0771c0bff, 0x2b6873a65f19ee1,
+        0x14b512095c33e1f, 0x21958f1402b76b1, 0x0b0c231d360d311 },
+      { 0x228929839bcab2f, 0x019e01937488281, 0x2084763dc2a0c0c,
+        0x1cc64e30f8c18bd, 0x152e46eb988e9da, 0x297783f5a6fa3cb,
+        0x2c0e26e55c8d2d6, 0x3fd5fce8ff58f6c, 0x14a899c6d9f1e4b } },
+    { { 0x3f6e3a1ec05ce88, 0x30925adabf480a7, 0x20776fbeb007f8f,
+        0x2f7baf7b5002e74, 0x2693700f7b50ec0, 0x3dec0c3abbe5dd0,
+        0x101f77806e37a13, 0x2b83d73c5f45c6e, 0x1599036e5dfca95 },
+      { 0x0af64b5000e8e0c, 0x0ab8101bed37e40, 0x1a67449f23bad3f,
+        0x108956c96a57d87, 0x28e33c6500ca918, 0x0b009f07e9abcf9,
+        0x2840a514373c00c, 0x1090267cf36865c, 0x0e798c62b79d0e8 } },
+    { { 0x0c7c4a8ae4d0f28, 0x2957bd59b401bba, 0x1f65066e40233a8,
+        0x2d574c86dd8de61, 0x2b8351b078decca, 0x1f5522ace2e59b5,
+        0x31ab0b2e889e535, 0x14dedea7a38bf98, 0x05945c60f95e75c },
+      { 0x0a27d347867d79c, 0x182c5607206602f, 0x19ab976b8c517f4,
+        0x21986e47b65fb0b, 0x1d9c1d15ffcd044, 0x253276e5cc29e89,
+        0x2c5a3b8a2cf259f, 0x0c7ba39e12e1d77, 0x004062526073e51 } },
+    { { 0x2e04e5cf1631bba, 0x1b077c55bd14937, 0x3f30e4c3099040e,
+        0x10dadaafb1c1980, 0x0f6b94f6edb649a, 0x1adf82d4d53d427,
+        0x1e6dd27fecf4693, 0x1432a9e9c41fae8, 0x022889edac56894 },
+      { 0x012916ed05596f2, 0x0076b2c08f2e2e4, 0x13ece7d4abe1e39,
+        0x102a7240c4c9407, 0x1c6d146d0b28150, 0x13b8625a76f34fc,
+        0x1226fb6fa1d5b17, 0x0261126ba8586a4, 0x154754ceedfb8a8 } },
+    { { 0x24e27b04270b2f0, 0x0d3922fd35d35ed, 0x3e8b0c2722ba84b,
+        0x2767fe6dc72c61a, 0x334fd6bc4f54a58, 0x104bd276621f937,
+        0x389d16b7c669fd7, 0x381d1002366eddf, 0x1cfafb9426bc902 },
+      { 0x0a4f2d1662935ca, 0x1f1c0e65f7311b3, 0x29e5353c79f8284,
+        0x2254857c3d30227, 0x080911b9d9ed8d9, 0x3789ea8d673c22f,
+        0x1e320d4b03540e6, 0x064ed4bd358fbda, 0x0e6a0217fd694ef } },
+    { { 0x37de62774214780, 0x19a05c81d167aad, 0x39b7e9c7fb01ca0,
+        0x3075b52df1fde15, 0x0a66caa39e55548, 0x2141693d15d5864,
+        0x0864ebf8141b039, 0x274fe972835f132, 0x053bf8af9509e12 },
+      { 0x09b29d885285092, 0x0c76aa3bb5797ef, 0x290ef618aab982f,
+        0x3d34989bb4670cd, 0x307ed8e090eee14, 0x1cdb410108a55c2,
+        0x27d01d1977920e8, 0x2dced1fb897ffb7, 0x1b93c921c3abc7a } },
+    { { 0x36a07cca08b2b14, 0x1e37aefc5d31fc2, 0x3828c40cb2a4aa9,
+        0x1ca42b720e0a472, 0x28c1edde695c782, 0x03ef4880236a2ca,
+        0x2db94e741ceb2f9, 0x152397e272794c8, 0x07d18266085b73c },
+      { 0x1ebf82a2defd012, 0x32c2516854dfbda, 0x35353ef0811d01e,
+        0x29ecaf537a8f155, 0x27bf969c859c882, 0x2c96b46c0287e5c,
+        0x136005063adf5e0, 0x3f861307fcc1bc9, 0x1178e515bec4112 } },
+    { { 0x314787fefe3d3d5, 0x1dbd967625c89e4, 0x3ed1e0b6acf529e,
+        0x080717a3764571d, 0x15f5667af9c2b7b, 0x0d5dbbd1e200e3c,
+        0x00154af38c766ff, 0x0ed4e7c188f2001, 0x09647d3c44bde88 },
+      { 0x2075638de1b21a4, 0x0e67055c420704c, 0x206775c03599bb6,
+        0x1feb79833d4c8b9, 0x0efc190595c7fde, 0x35ece5806c65510,
+        0x2fa73e7e70ac8cd, 0x01d912a96a0f5a9, 0x04234f8cfac6308 } },
+  },
+  {
+    { { 0x231e71a286492ad, 0x0f791197e1ab13b, 0x00d4da713cb408f,
+        0x3a6a1adc413a25c, 0x32572c1617ad0f5, 0x173072676698b93,
+        0x162e0c77d223ef2, 0x2c817b7fda584ee, 0x08e818d28f381d8 },
+      { 0x21231cf8cdf1f60, 0x103cad9c5dd83dc, 0x2f8ce045a4038b6,
+        0x3700dc1a27ef9c9, 0x372ea0dcb422285, 0x2021988dc65afe3,
+        0x26fe48a16f7855c, 0x2fd1353867f1f0c, 0x13efdbc856e8f68 } },
+    { { 0x06119f6a1c88f3c, 0x397fb0bb1a5129b, 0x2c605742ff2a924,
+        0x07b76c8b1f1322a, 0x0fa5d25bb60adde, 0x3045f7825ca24e3,
+        0x2929c1fa5ac4f7e, 0x257d507cd6add20, 0x180d1c4e8f90afd },
+      { 0x3c4e73da7cd8358, 0x18695fca872480b, 0x3130ad94d288393,
+        0x198ada9e38bdbcb, 0x379c262cde37e24, 0x06d65ee42eaffe2,
+        0x0d4e646cae01ef6, 0x3e1167078cfc298, 0x00e52a42280dd01 } },
+    { { 0x1a958d6b114257b, 0x2bf507525d78c02, 0x39b53aae7b11729,
+        0x24fb746b20c1ca1, 0x11eb679750791b0, 0x099d6d2b3fbf1f4,
+        0x29517f0e54bd37e, 0x0268e2698b5fa35, 0x06b96f805d82021 },
+      { 0x015d51757b5f9f4, 0x2790d9016d13452, 0x1de0e4870160e5c,
+        0x2547bdacfe0d10b, 0x1f7497faf953fef, 0x05bbc2de467933d,
+        0x12eeed24e3cc4d0, 0x05c0ff172aa1c94, 0x1b6f1ba4029a3bd } },
+    { { 0x3d8ce7b5a53c22b, 0x0cff35f2ad11a86, 0x24e248acb394787,
+        0x07a8e31e43f1132, 0x315c34237a9888b, 0x2dc0818cdabedba,
+        0x3508fab913b8a8f, 0x1ccacd2ddf31645, 0x050a931d7a7f9e4 },
+      { 0x10a429056d21d18, 0x198c1d56d04286a, 0x0a8b894a6b05826,
+        0x18e0a33dd72d1a1, 0x2127702a38a1ade, 0x37dedc253ecbe16,
+        0x0d1db683ff7d05a, 0x3357074fd6a4a9a, 0x0f5243ce1dbc093 } },
+    { { 0x2ad2247d181c3f2, 0x34d6fbccdec8fff, 0x3cba74890672915,
+        0x23ff69e8e876d33, 0x179275686e4f70d, 0x3fc7de7889ad906,
+        0x1fa4e8e80408636, 0x27d8263a12ce73d, 0x0da57aa0be9d8a0 },
+      { 0x00cecf54efcea66, 0x3cabb2bf1dbebb5, 0x1a48c91585a898d,
+        0x29c4fc02a958fc6, 0x344b5cb9fb111bd, 0x149883459a1ebea,
+        0x0b35abc6d5fb126, 0x3134abe54fc6eeb, 0x0ed99709370ff94 } },
+    { { 0x02b4747c0ace6d5, 0x32d92ef9ca1eb69, 0x089989bc2614d5a,
+        0x0dbfc171c7bccc1, 0x2d35ac450817fe8, 0x1d6a70f1dcbac91,
+        0x00d6fd7f5fc2163, 0x25ccfedbe786b2f, 0x09a7643c315720e },
+      { 0x32216b4f3845ccf, 0x1d3a0242f016f52, 0x0c74d60490379c1,
+        0x2858d632019e954, 0x1aa677b6dbd7220, 0x1b8b823a0e3e710,
+        0x2f6da537332c196, 0x18c36c0ca1d7925, 0x00c52b274cf9c30 } },
+    { { 0x37f032aeded03c0, 0x128149623775341, 0x3c4f9a85be0f268,
+        0x1ff82e6daedb426, 0x2f2fb5887bdda0c, 0x30f339f865a271f,
+        0x0d2ae5f8a96960e, 0x0866ac10f6755da, 0x06829c8081bdb21 },
+      { 0x3f872fade59f006, 0x27ff1b2e5fbd69a, 0x15db58ae7ef8c2b,
+        0x287d332a87cdc64, 0x289c27cc4c2e23c, 0x21af73186be3183,
+        0x18de43eee5d7e7c, 0x3c22e4896d1fe6f, 0x0b453e7f4634b24 } },
+    { { 0x1bf4f9faf2ed12f, 0x346793ce03f62ab, 0x3db5a39e81aece1,
+        0x08589bbdaf0255e, 0x20cf5b28df98333, 0x00e4b350442b97a,
+        0x067855ab1594502, 0x187199f12621daf, 0x04ace7e5938a3fd },
+      { 0x1c5b9ef28c7dea9, 0x3e56e829a9c6116, 0x02578202769cd02,
+        0x0225375a2580d37, 0x3b5dea95a213b0b, 0x05f2a2240dcc2df,
+        0x1ba052fe243ed06, 0x25b685b3d345fec, 0x1c0d8691d6b226f } },
+    { { 0x1dab52d22ed5986, 0x3989e9614cf819c, 0x237acf155fe3dee,
+        0x035eba2c4cba3fb, 0x134a08b94cd6149, 0x270570c09c1b861,
+        0x25ad46a85ffd52f, 0x002ef568893cd46, 0x1e644d1b6d554d7 },
+      { 0x2830686862e4e9c, 0x335db121d8ff925, 0x1679c0839caafe5,
+        0x3ae360f58b580c2, 0x211bc4ae2c0e4cb, 0x13f2818a4478953,
+        0x22704596a0d7c86, 0x104b3d5e17757a6, 0x1be2f4677d0f3e0 } },
+    { { 0x111d12a1078342a, 0x11c979566841900, 0x1d590fd3ffdd053,
+        0x27c1bc2b07fa916, 0x33e19bc69cf694a, 0x27773403db492b6,
+        0x32dd4e3ce38f5eb, 0x07154e1003d9ad8, 0x085cab8fdfbe15e },
+      { 0x2943f6b8d09422f, 0x0a5d583e6230ec2, 0x01fa2ef2e4d917d,
+        0x0ecd7df04fd5691, 0x3edaad3ff674352, 0x0d1c90b49d34d01,
+        0x38615d594114359, 0x2533472c9cc04ee, 0x07da0437004bd77 } },
+    { { 0x29d0bc8d771f428, 0x07b36790f28e0a7, 0x2480eb93acf03ac,
+        0x2041968a8fe357b, 0x22f0b8a7316232f, 0x0951d2887f013ea,
+        0x315f6f4a8df7e70, 0x0394946b13fc8ee, 0x06b66e21b73e095 },
+      { 0x1c9848067a41dee, 0x2a56b9ecf8acfd6, 0x0386891454e12cf,
+        0x37fbbf29a915366, 0x011e9cb75f0dddb, 0x3bc8230d7da46c9,
+        0x333cf6a9b9e766f, 0x1d2a7a37c400062, 0x1c4b8a55ac9d1c1 } },
+    { { 0x29ca589c4a2daa2, 0x29c0f1003d8231f, 0x1058d517510318e,
+        0x1c92aedbca5be33, 0x194296ab4264934, 0x314595f42f954f8,
+        0x080ea89af9398fa, 0x386c788cb7bb13e, 0x1372f81761e67b1 },
+      { 0x1014bc73a20f662, 0x1f9df127b654094, 0x096fb62b96521fb,
+        0x19e8ba34dfa27d4, 0x25804170e3a659c, 0x3b5428d03caca89,
+        0x03c00f1674fce69, 0x2764eaa914dfbf7, 0x198f3c3bfda4ce9 } },
+    { { 0x2f4fd69d8695310, 0x3ac27dfa1da3a9d, 0x1812e0d532a8e28,
+        0x11315cab1e40e70, 0x0785d6293dda677, 0x369daec87e60038,
+        0x3c72172bfe2a5a3, 0x22a39bb456e428a, 0x04cd80e61bfd178 },
+      { 0x1f4037016730056, 0x117fbf73b4f50ee, 0x363c1aa5074246f,
+        0x14bfe4ab9cc2bf5, 0x11bb2063f21e5c6, 0x0b489501bbc20c3,
+        0x15001c18306ecc1, 0x150913b766ce87c, 0x1f4e4eb25b8c0cc } },
+    { { 0x23fb7985448e339, 0x1dc33c628e65d8a, 0x174d7a69170cde8,
+        0x164ad819eb04581, 0x0848138ab4bb05c, 0x24279e537834b6c,
+        0x0315f7149dab924, 0x289620e8cdad9e4, 0x13ccd9074d9a335 },
+      { 0x039c5e0ac1b784d, 0x17231bb949eb87a, 0x2146a1c88ec0ab6,
+        0x2411b06fd634f21, 0x33fda502a2201f7, 0x096e4195c73b189,
+        0x16dfcdff3f88eb2, 0x29731b07c326315, 0x0acaa3222aa484f } },
+    { { 0x335c7bb3c67d520, 0x12562c8ff2a7b2b, 0x31948bbaa808d8f,
+        0x33884d7a2b81de3, 0x1c888eff7418c30, 0x1cc512af376366a,
+        0x06a53472075df0f, 0x1ff16d527225514, 0x11c4ef389795fbb },
+      { 0x3e2c9ac43f5e698, 0x1ff2f38e2978e8f, 0x090e3089c2e1ce7,
+        0x3feb0756005b417, 0x0381b9d2a5a74f3, 0x17ce582ebbb6888,
+        0x37abbed958b143f, 0x2dc6197ff414436, 0x0ce8e97e6807a05 } },
+  },
+};
+
+static constexpr Uint64 cP521OddTable[32][2][9] = {
+    { { 0x17e7e31c2e5bd66, 0x22cf0615a90a6fe, 0x0127a2ffa8de334,
+        0x1dfbf9d64a3f877, 0x06b4d3dbaa14b5e, 0x14fed487e0a2bd8,
+        0x15b4429c6481390, 0x3a73678fb2d988e, 0x0c6858e06b70404 },
+      { 0x0be94769fd16650, 0x31c21a89cb09022, 0x39013fad0761353,
+        0x2657bd099031542, 0x3273e662c97ee72, 0x1e6d11a05ebef45,
+        0x3d1bd998f544495, 0x3001172297ed0b1, 0x11839296a789a3b } },
+    { { 0x1919d2ede37ad7d, 0x124218b0cba8169, 0x3d16b59fe21baeb,
+        0x128e920c814769a, 0x12d7a8dd1ad3f16, 0x08f66ae796b5e84,
+        0x159479b52a6e5b1, 0x065776475a992d6, 0x1a73d352443de29 },
+      { 0x3588ca1ee86c0e5, 0x1726f24e9641097, 0x0ed1dec3c70cf10,
+        0x33e3715d6c0b56b, 0x3a355ceec2e2dd4, 0x2a740c5f4be2ac7,
+        0x3814f2f1557fa82, 0x377665e7e1b1b2a, 0x13e9b03b97dfa62 } },
+    { { 0x1ab5096ec8f3078, 0x1f879b624c5ce35, 0x3eaf137e79a329d,
+        0x1b578c0508dc44b, 0x0f177ace4383c0c, 0x14fc34933c0f6ae,
+        0x0eb0bf7a596efdb, 0x0cb1cf6f0ce4701, 0x0652bf3c52927a4 },
+      { 0x33cc3e8deb090cb, 0x001c95cd53dfe05, 0x00211cf5ff79d1f,
+        0x3241cb3cdd0c455, 0x1a0347087bb6897, 0x1cb80147b7605f2,
+        0x0112911cd8fe8e8, 0x35bb228adcc452a, 0x15be6ef1bdd6601 } },
+    { { 0x1cead882816ecd4, 0x14fd43f70986680, 0x1f30dce3bbc46f9,
+        0x02aff1a6363269b, 0x2f7114c5d8c308d, 0x1520c8a3c0634b0,
+        0x073a0c5f22e0e8f, 0x18d1bbad97f682c, 0x056d5d1d99d5b7f },
+      { 0x06b8bc90525251b, 0x19c4a9777bf1ed7, 0x234591ce1a5f9e7,
+        0x24f37b278ae548e, 0x226cbde556bd0f2, 0x2093c375c76f662,
+        0x168478b5c582d02, 0x284434760c5e8e7, 0x03d2d1b7d9baaa2 } },
+    { { 0x345627967cbe207, 0x02eaf61734a1987, 0x16df725a318f4f5,
+        0x0e584d368d7cf15, 0x1b8c6b6657429e1, 0x221d1a64b12ac51,
+        0x16d488ed34541b9, 0x0609a8bd6fc55c5, 0x1585389e359e1e2 },
+      { 0x2a0ea86b9ad2a4e, 0x30aba4a2203cd0e, 0x2ecf4abfd87d736,
+        0x1d5815eb2103fd5, 0x23ddb446e0d69e5, 0x3873aedb2096e89,
+        0x2e938e3088a654e, 0x3ce7c2d5555e89e, 0x02a2e618c9a8aed } },
+    { { 0x0c0e02dda0cdb9a, 0x30093e9326a40bb, 0x1aebe3191085015,
+        0x0cc998f686f466c, 0x0f2991652f3dbc5, 0x305e12550fbcb15,
+        0x0315cfed5dc7ed7, 0x3fd51bc68e55ced, 0x08a75841259fded },
+      { 0x0874f92ce48c808, 0x32038fd2066d756, 0x331914a95336dca,
+        0x03a2d0a92ace248, 0x0e0b9b82b1bc8a9, 0x02f4124fb4ba575,
+        0x0fb2293add56621, 0x0a6127432a1dc15, 0x096fb303fcbba21 } },
+    { { 0x087848d32fbcda7, 0x30ec02ace3bfe06, 0x25e79ab88ee94be,
+        0x02380f265a8d542, 0x2af5b866132c459, 0x06d308e13bb74af,
+        0x24861a93f736cde, 0x2b6735e1974ad24, 0x07e3e98f984c396 },
+      { 0x11a01fb022a71c9, 0x27aabe445fa7dca, 0x1d351cbfbbc3619,
+        0x160e2f1d8fc9b7f, 0x25c1e212ac1bd5d, 0x3550871a71e99eb,
+        0x2d5a08ced50a386, 0x3b6a468649b6a8f, 0x108ee58eb6d781f } },
+    { { 0x1afe337bcb8db55, 0x365a6078fe4af7a, 0x3d1c8fc0331d9b8,
+        0x09f6f403ff9e1d6, 0x2df128e11b91cce, 0x1028214b5a5ed4c,
+        0x14300fb8fbcc30b, 0x197c105563f151b, 0x06b6ad89abcb924 },
+      { 0x2343480a1475465, 0x36433111aaf7655, 0x22232c96c99246f,
+        0x322651c2a008523, 0x197485ed57e9062, 0x2b4832e92d8841a,
+        0x2dbf63df0496a9b, 0x075a9f399348ccf, 0x1b468da27157139 } },
+    { { 0x2f817a853110ae0, 0x0c10abc3469041d, 0x399b5681380ff8c,
+        0x399d3f80a1f7d39, 0x269250858760a69, 0x3e8aced3599493c,
+        0x23906a99ee9e269, 0x3684e82e1d19164, 0x1b00ddb707f130e },
+      { 0x1b9cb7c70e64647, 0x0156530add57d4d, 0x357f16adf420e69,
+        0x13bdb742fc34bd9, 0x322a1323df9da56, 0x1a6442a635a2b0a,
+        0x1dd106b799534cf, 0x1db6f04475392bb, 0x085683f1d7db165 } },
+    { { 0x0ff0b2418d6a19b, 0x3d0c79c96ef791e, 0x157d7a45970dfec,
+        0x258d899a59e48c9, 0x33790e7f1fa3b30, 0x177d51fbffc2b36,
+        0x21a07245b77e075, 0x0d21f03e5230b56, 0x0998dcce486419c },
+      { 0x1091a695bfd0575, 0x13627aa7eff912a, 0x39991631c377f5a,
+        0x0ffcbae33e6c3b0, 0x36545772773ad96, 0x2def3d2b3143bb8,
+        0x1b245d67d28aee2, 0x3b5730e50925d4d, 0x137d5da0626a021 } },
+    { { 0x2ef399693c8c9ed, 0x32480e4e91b4b50, 0x3eaed827d75b37a,
+        0x2b9358a8c276525, 0x19c467fa946257e, 0x3b457a606548f9d,
+        0x2d3b10268bb98c2, 0x34becf321542167, 0x1a1cbb2c11a742b },
+      { 0x20bc43c9cba4df5, 0x2c3c5d92732d879, 0x3a372c63eec57c9,
+        0x14f6920ca56fad0, 0x36bafa7f7df741a, 0x1464f9b06028a5b,
+        0x00ce62e83c0059c, 0x0f520b04b69f179, 0x11a209d7d4f8eeb } },
+    { { 0x1c6a5ece2af535c, 0x07c6b09ab9601a8, 0x38e9a5ec53e207e,
+        0x3f26bd6c2bfa78f, 0x10cdd45101f6f83, 0x217eca0924348d3,
+        0x147b8eee7a39ba7, 0x24ddb6c72b3b17d, 0x1ae0b275d729015 },
+      { 0x015c3536fa0d000, 0x2d1142a348e15b6, 0x327bb07dd0c2213,
+        0x187ba5ff3d0f09e, 0x044c2dc0e108433, 0x034160cad0c591e,
+        0x28471c7d759ff89, 0x0e019a28a163f01, 0x0f2c97a825e5385 } },
+    { { 0x38c2460bf70ace0, 0x383ac70974fec4f, 0x3e2aa648ff27e41,
+        0x245f0dbb9355ba1, 0x05499994aa91856, 0x06c41ec471dcb23,
+        0x1ff9d2007310265, 0x060d28d61d29bd7, 0x154e84c6d5c5a9a },
+      { 0x325bce404c78230, 0x38a9519cb9adb50, 0x370a6a5972f5eed,
+        0x0d5cbef06834788, 0x0151666a6dee354, 0x008a831fd9b0a22,
+        0x360d3f15a923eb0, 0x11ceb88a8a3e02e, 0x0cd0fdce9171910 } },
+    { { 0x17643017002d68b, 0x1581124bb115a0d, 0x3aeda0d3163cb21,
+        0x0f69c67520d44d4, 0x3e135854d80b212, 0x393e18b0cfcd461,
+        0x1e646f8739535d0, 0x2da9d8a9353ae22, 0x160373edf8218f9 },
+      { 0x3e6aeca5d90b740, 0x3ff9c27516b2cfc, 0x34f4a8bb572e463,
+        0x07b64baf1504ee1, 0x21a1b22011efa49, 0x3d4b0eed295bde3,
+        0x06a3fa9fd193c5c, 0x38717960a1006b0, 0x0f1597050014dcf } },
+    { { 0x03927618eda25dc, 0x361657547db658b, 0x2b8e847ffb9ef33,
+        0x01a1db5ca45000e, 0x37664a1305ca9bc, 0x218997b0a2fbce3,
+        0x1a085ff9f45131e, 0x0a1f6cf07eff2d9, 0x174c644d6c94b68 },
+      { 0x07bbbc4821a0c30, 0x2649f09baefef46, 0x332d706d303f067,
+        0x254b383642d4309, 0x395ad34b7be0e21, 0x2d9107f2d73d7ad,
+        0x37b7820233ef8fc, 0x279a016b3256d06, 0x11af3a7c2f87f41 } },
+    { { 0x257d0e0c16a8803, 0x3ed792238920488, 0x01ac09cd6b220dc,
+        0x2a4132750a7f053, 0x0a5e7726cd65543, 0x1f0a9985c982a0f,
+        0x307b7db57458965, 0x1985401a96336dc, 0x0d8e9920cf30f0c },
+      { 0x24677c739792d19, 0x2f65f1ed50c62b2, 0x068cae4cc263aa1,
+        0x0c913451e404e6a, 0x0bed1aa30f76b8c, 0x3c4320182bbedcb,
+        0x0a30ec8b5406328, 0x0e61f7c2704e885, 0x127b023b5454a66 } },
+    { { 0x2a2e1fc649f308d, 0x316461acbb44b57, 0x19a57aa53ac2a5e,
+        0x1f8addfbc6ba694, 0x274236df0abdbea, 0x2fa4984fce05086,
+        0x36f58e52086d482, 0x1a79a31dbad38f1, 0x0284195f0978fb9 },
+      { 0x3e95a3dd3e11c4d, 0x3ff5708a2d63cda, 0x3216c16deb3a88e,
+        0x32fcf44e2fc02f5, 0x1614ac5f2e7656e, 0x018f198e78059da,
+        0x056d3a24d513abe, 0x18dadede8ef21a4, 0x07e43eb08c656dc } },
+    { { 0x01039c9ccd7d718, 0x3fd852d77323637, 0x218608f6b2cea92,
+        0x213f69d008fb929, 0x16f97392bb4806c, 0x164f82ff129e02d,
+        0x0ba392a267a642b, 0x029e0e62d881a78, 0x0ddc30075754963 },
+      { 0x2b1d3ef241e07f4, 0x2936d089902934f, 0x2522ee69e797deb,
+        0x22f4b1c05097084, 0x11a31db509ab117, 0x17616f3d189e596,
+        0x30dbbfa510936cb, 0x317306e0d0c7c30, 0x0c1bd2d07f6ac7f } },
+    { { 0x1ac4d59b557a36f, 0x139dab91e009cfc, 0x226ee0980df28c6,
+        0x18e8a2158103963, 0x2af9d5749bd4457, 0x07567908a7b42b9,
+        0x2d5867c35c5d56c, 0x2d9c4e79e60d4b7, 0x0944f64a6c21832 },
+      { 0x12bf98394fb2a03, 0x12f9015a620a58c, 0x164995a057c331a,
+        0x091c720fe06e171, 0x2b7991305dcbdbc, 0x2197e16498c5f69,
+        0x2cb192fe4e6ff21, 0x2dd04312e5893c9, 0x150b7ee1b02028a } },
+    { { 0x3704119ee33b77c, 0x3e8752020ebd9c2, 0x3434e5fa31795b4,
+        0x316189a878ab02f, 0x2359c6ea7256b0c, 0x2d6e41c8e367f58,
+        0x2499029e9661a49, 0x181d54990498d5a, 0x124a0b8f411fbad },
+      { 0x0dcdc61228b61a6, 0x0b9d2da63902af6, 0x32415944e762f21,
+        0x3fae5a096aa8f2b, 0x0c690db4818dc59, 0x1e585533702c490,
+        0x3d399c68937baa8, 0x3738d80aa6901ae, 0x01029616edc7335 } },
+    { { 0x200ce952624381e, 0x3686948b30abda3, 0x03ddc8297bfaddf,
+        0x3abd25733393023, 0x3864a60c816b931, 0x0a26629a16e17c8,
+        0x03082552a523e4b, 0x0929d8faff674a2, 0x175a140ed79e85e },
+      { 0x3eb760ec1028ecf, 0x375d639fce8fb3a, 0x2e551fa28ebdf75,
+        0x047b3cc9f6814a9, 0x322c82111b39e0e, 0x27b958c88f7a086,
+        0x399be7ab59e580e, 0x353b4dbc84d0f28, 0x1b09696d71855e2 } },
+    { { 0x13e3083224f497e, 0x02d8bf7b81f481c, 0x0e7a9b3d85ca51f,
+        0x1ebb5f4df768e9d, 0x038fea396fc66ad, 0x305066be3bc3e51,
+        0x04d8a070678aa2e, 0x393fb55408b6415, 0x18c0148a165ec58 },
+      { 0x15829067683adbf, 0x36e4bddada234a2, 0x202b547ce17a94e,
+        0x2621e6c73c64cb5, 0x19f1a0bec67fd60, 0x07451335e8c0de0,
+        0x23bf242677e91db, 0x21a6bafdea0f1ea, 0x10abbaa1f099e78 } },
+    { { 0x32dec600fc95c1a, 0x15181ed9adc3128, 0x21ace5703f0fc29,
+        0x1f7e287cb67723a, 0x3f197286779189b, 0x3051f301ecb7d78,
+        0x2bc0207a58f7f28, 0x14ee1e565ae3ffc, 0x04969d186aca09e },
+      { 0x098a7cd000903a9, 0x0fd7642cdd593e5, 0x1e879be328e1346,
+        0x200bab6ba179bb6, 0x3bcdb40a9b8d5b2, 0x09c22104d561286,
+        0x09fc7b15862a423, 0x211f535ab087cc5, 0x1e81ec9b50cd8d3 } },
+    { { 0x3da63c9abd59d11, 0x1a84c347b2ed9cb, 0x35a3a9c4dd660a5,
+        0x282e7a48ab273b9, 0x2c71dd0b2381864, 0x100cffe25c8cc41,
+        0x35882ce4e4fe271, 0x3f57e73d420fb30, 0x0afe31f8907048a },
+      { 0x3065d2f1d90e1d6, 0x2905667c419cef4, 0x20f478d825e711c,
+        0x02e41260a9baedd, 0x276f06497927608, 0x24827e23b3a9fcc,
+        0x0ff69a605f07934, 0x3fa76d0a432eed5, 0x012f95dc8657275 } },
+    { { 0x08cb45049efc0ad, 0x236ac6b13013283, 0x084e2e345fa8725,
+        0x37d4bd8a10a4763, 0x111dea9eb6bc2a2, 0x392660e7d606e2c,
+        0x2ba0d39d45c347a, 0x0755f2e90298eee, 0x0a5cb98fa3c0b8c },
+      { 0x39bf46a2c8884b4, 0x18fefec2e22c742, 0x32ceebb72bb44b9,
+        0x1550f55d7083043, 0x19da8bf835dd977, 0x1df96dfac1cb0e7,
+        0x2e151b749ee4678, 0x1ee5c5026c06fdc, 0x015dc95654090d7 } },
+    { { 0x0d916fffbcc9504, 0x1a27bc75ef8b76a, 0x2e1b1054cbc0fba,
+        0x1abc1ce437c4c86, 0x3f9beea26c2edfe, 0x0d3fa6e8ee8c5b2,
+        0x05f3ccfdf9f5bde, 0x0568809764eda05, 0x168395ba51e2784 },
+      { 0x2b9c45edd5c087b, 0x02aafb4ea278623, 0x36096e3aeba5060,
+        0x1a2eb6d80321270, 0x0adeb9b3c97bc2b, 0x071203389396c5d,
+        0x13f57952dd878f2, 0x09158e7654c650b, 0x071cc10f3ca041a } },
+    { { 0x285684cccb69906, 0x14f6a7262020598, 0x181fba4fe12b081,
+        0x18dc8269e3b4ebd, 0x3948100c44e210e, 0x1a257edc9fa0bdb,
+        0x0306dff8688be91, 0x24fddecf43ff4c4, 0x143f6e249195ee6 },
+      { 0x16ddaddd40c7861, 0x28f7ef12afb9abf, 0x3a9de3b4cf8c040,
+        0x3d40f3ceecc3da9, 0x053d10cb14fdf64, 0x10b085a4d50dfa0,
+        0x1109877dc73fdde, 0x0a9d3158468095d, 0x1053e8fcc9618eb } },
+    { { 0x0ad7ccebd470f5e, 0x26ad2f6a5ab13a1, 0x086b1e0b549a7fe,
+        0x245f2b49f9af85d, 0x28e8da1a18cca93, 0x27429e7591cb500,
+        0x2daca97cb03e9fd, 0x39f12d547905571, 0x04b52fc4b6d310c },
+      { 0x2196cd230a36ef2, 0x0e88c01a825ba9e, 0x09e345b53586fa0,
+        0x225716821335a58, 0x27dbae15510aa85, 0x285a82d803ec452,
+        0x1a7b2e619f44311, 0x2b884e17a9e41e8, 0x03585e54fe81461 } },
+    { { 0x075330a4e9a13e2, 0x0b23ffe5721140d, 0x15bc64b8a520837,
+        0x2ef7a4462cbd9bf, 0x3a521b9f84af300, 0x39b6fe17bcf1b5d,
+        0x325ffa5a8defe72, 0x00b81118f69d7be, 0x0dc53c3e7fcf3c9 },
+      { 0x3ad7f7fd9c4248f, 0x24c64318a954c8c, 0x02056a929f73a94,
+        0x03434ef61a928fe, 0x390dff3ea348253, 0x2be76626d8b9fac,
+        0x14f8f7b13d0dd2c, 0x264ada01cfb9b13, 0x074e88fccd4fdbd } },
+    { { 0x3be8a26eb16686b, 0x21493b0d1c82218, 0x342d64373a8acba,
+        0x326c4d131a46a40, 0x34c222920055693, 0x22406666ab970a4,
+        0x329eadc7223c5d9, 0x19dcc18f180d0b7, 0x035aeb454ad3187 },
+      { 0x34aa03c5381fa2e, 0x0b0e33ebff946b3, 0x1fddd64ffec3fd8,
+        0x112f20f42e327f5, 0x3cb6efd45b8cf8c, 0x18240fd388bcbbc,
+        0x31ba7f15a48db36, 0x10ed36c2c3282bf, 0x0187ecbec147e7e } },
+    { { 0x353d8cfcfc376a1, 0x2eb459c550f1072, 0x3ce59a7b32d7952,
+        0x069df702ce6979f, 0x1be8b17177193c1, 0x2d983469335c92c,
+        0x1c7d8f8b6cd17d5, 0x109724b29f1cca8, 0x115544c4a011407 },
+      { 0x0eff8cd4a17604b, 0x08bba70ff97892e, 0x3f603afa032b56f,
+        0x152dfd54ea2a0d3, 0x2ed58c6a003f78d, 0x3d08b2ffb025e8e,
+        0x1c872c79af485fe, 0x216cc1e65b4a8e6, 0x1153df9c6c0ac64 } },
+    { { 0x35beb6fce8888e5, 0x3df4095dc2b2343, 0x16847586265e75a,
+        0x184c238497b18e6, 0x0d51b08453ae996, 0x3e8377079fd53f9,
+        0x0a6e8e1ca21b5af, 0x115ffa0bde66b2c, 0x1c132753b64640c },
+      { 0x1d15ad2a03dba15, 0x15ed6fd9928ab3a, 0x0f82f0071283af6,
+        0x373b0625af04fde, 0x13aa2238005d3db, 0x19050019657a30d,
+        0x05d7961a9e09328, 0x0e05db606b226c8, 0x15347e184197a05 } },
+};
+// clang-format on
+
+} // namespace alcp::ec
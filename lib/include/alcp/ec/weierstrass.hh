@@ -0,0 +1,762 @@
+/*
+ * Copyright (C) 2023, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Short Weierstrass curves y^2 = x^3 - 3 * x + b over a prime field of N x 64
+ * bit limbs, for the NIST curves that have no dedicated kernel (P-384). The
+ * group order arithmetic of the ECDSA code uses it for every curve.
+ *
+ * Field elements are kept in the Montgomery domain (a * 2^(64 * N) mod p) and
+ * points in Jacobian coordinates, Z = 0 being the point at infinity. The same
+ * Montgomery multiplication serves the arithmetic modulo the group order.
+ * Everything except DoubleScalarMul runs in constant time.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "alcp/ec/ecdh.hh"
+#include "alcp/types.hh"
+
+namespace alcp::ec::weierstrass {
+
+template<int N>
+struct Modulus
+{
+    Uint64 m_value[N];   // little endian limbs
+    Uint64 m_inverse;    // -m^-1 mod 2^64
+    Uint64 m_rSquare[N]; // R^2 mod m
+    Uint64 m_one[N];     // R mod m
+};
+
+template<int N>
+struct CurveParams
+{
+    Modulus<N> m_prime;
+    Modulus<N> m_order;
+    Uint64     m_b[N]; // b, Gx and Gy in the Montgomery domain
+    Uint64     m_gx[N];
+    Uint64     m_gy[N];
+    Uint64     m_size; // bytes of an encoded coordinate or scalar
+};
+
+template<int N>
+struct Point
+{
+    Uint64 m_x[N];
+    Uint64 m_y[N];
+    Uint64 m_z[N];
+};
+
+template<int N>
+struct AffinePoint
+{
+    Uint64 m_x[N];
+    Uint64 m_y[N];
+};
+
+// entries per window of the fixed base table, 4 bit signed digits
+constexpr Uint64 BaseEntries = 8;
+
+// all ones when a is zero
+template<int N>
+inline Uint64
+ZeroMask(const Uint64 a[N])
+{
+    Uint64 acc = 0;
+    for (int i = 0; i < N; i++) {
+        acc |= a[i];
+    }
+    return ((acc | (0 - acc)) >> 63) - 1;
+}
+
+template<int N>
+inline void
+Select(Uint64 r[N], const Uint64 a[N], const Uint64 b[N], Uint64 mask)
+{
+    for (int i = 0; i < N; i++) {
+        r[i] = (a[i] & mask) | (b[i] & ~mask);
+    }
+}
+
+template<int N>
+inline void
+Copy(Uint64 r[N], const Uint64 a[N])
+{
+    for (int i = 0; i < N; i++) {
+        r[i] = a[i];
+    }
+}
+
+template<int N>
+inline Uint64
+AddLimbs(Uint64 r[N], const Uint64 a[N], const Uint64 b[N])
+{
+    Uint64 carry = 0;
+    for (int i = 0; i < N; i++) {
+        __uint128_t t = static_cast<__uint128_t>(a[i]) + b[i] + carry;
+        r[i]          = static_cast<Uint64>(t);
+        carry         = static_cast<Uint64>(t >> 64);
+    }
+    return carry;
+}
+
+template<int N>
+inline Uint64
+SubLimbs(Uint64 r[N], const Uint64 a[N], const Uint64 b[N])
+{
+    Uint64 borrow = 0;
+    for (int i = 0; i < N; i++) {
+        __uint128_t t = static_cast<__uint128_t>(a[i]) - b[i] - borrow;
+        r[i]          = static_cast<Uint64>(t);
+        borrow        = static_cast<Uint64>(t >> 64) & 1;
+    }
+    return borrow;
+}
+
+// a < b
+template<int N>
+inline bool
+IsLess(const Uint64 a[N], const Uint64 b[N])
+{
+    Uint64 t[N];
+    return SubLimbs<N>(t, a, b) != 0;
+}
+
+template<int N>
+inline void
+ModAdd(Uint64 r[N], const Uint64 a[N], const Uint64 b[N], const Modulus<N>& m)
+{
+    Uint64 t[N], u[N];
+    Uint64 carry  = AddLimbs<N>(t, a, b);
+    Uint64 borrow = SubLimbs<N>(u, t, m.m_value);
+    // a + b < m when subtracting m borrows and the addition did not carry
+    Select<N>(r, t, u, 0 - (borrow & (carry ^ 1)));
+}
+
+template<int N>
+inline void
+ModSub(Uint64 r[N], const Uint64 a[N], const Uint64 b[N], const Modulus<N>& m)
+{
+    Uint64 t[N], u[N];
+    Uint64 borrow = SubLimbs<N>(t, a, b);
+    AddLimbs<N>(u, t, m.m_value);
+    Select<N>(r, u, t, 0 - borrow);
+}
+
+// CIOS Montgomery multiplication, r = a * b / R mod m. Fully unrolled for
+// the 4, 6 and 9 limb moduli, so t stays in registers
+template<int N>
+inline void
+MontMul(Uint64 r[N], const Uint64 a[N], const Uint64 b[N], const Modulus<N>& m)
+{
+    Uint64      t[N + 2] = {};
+    __uint128_t s;
+
+    UNROLL_9
+    for (int i = 0; i < N; i++) {
+        Uint64 carry = 0;
+        UNROLL_9
+        for (int j = 0; j < N; j++) {
+            s     = static_cast<__uint128_t>(a[j]) * b[i] + t[j] + carry;
+            t[j]  = static_cast<Uint64>(s);
+            carry = static_cast<Uint64>(s >> 64);
+        }
+        s        = static_cast<__uint128_t>(t[N]) + carry;
+        t[N]     = static_cast<Uint64>(s);
+        t[N + 1] = static_cast<Uint64>(s >> 64);
+
+        Uint64 q = t[0] * m.m_inverse;
+        s        = static_cast<__uint128_t>(q) * m.m_value[0] + t[0];
+        carry    = static_cast<Uint64>(s >> 64);
+        UNROLL_9
+        for (int j = 1; j < N; j++) {
+            s = static_cast<__uint128_t>(q) * m.m_value[j] + t[j] + carry;
+            t[j - 1] = static_cast<Uint64>(s);
+            carry    = static_cast<Uint64>(s >> 64);
+        }
+        s        = static_cast<__uint128_t>(t[N]) + carry;
+        t[N - 1] = static_cast<Uint64>(s);
+        t[N]     = t[N + 1] + static_cast<Uint64>(s >> 64);
+    }
+
+    // t < 2 * m, t[N] is the carry bit
+    Uint64 u[N];
+    Uint64 borrow = SubLimbs<N>(u, t, m.m_value);
+    Select<N>(r, t, u, 0 - (borrow & (t[N] ^ 1)));
+}
+
+// r = a^2 / R mod m
+template<int N>
+inline void
+MontSqr(Uint64 r[N], const Uint64 a[N], const Modulus<N>& m)
+{
+    MontMul<N>(r, a, a, m);
+}
+
+template<int N>
+inline void
+ToMont(Uint64 r[N], const Uint64 a[N], const Modulus<N>& m)
+{
+    MontMul<N>(r, a, m.m_rSquare, m);
+}
+
+template<int N>
+inline void
+FromMont(Uint64 r[N], const Uint64 a[N], const Modulus<N>& m)
+{
+    Uint64 one[N] = { 1 };
+    MontMul<N>(r, a, one, m);
+}
+
+/*
+ * r = a^(m - 2), the inverse for a prime m. The exponent is public, the 4 bit
+ * windows are walked in a fixed order whatever a is
+ */
+template<int N>
+inline void
+MontInverse(Uint64 r[N], const Uint64 a[N], const Modulus<N>& m)
+{
+    Uint64 exp[N], table[16][N], acc[N];
+    Uint64 two[N] = { 2 };
+
+    SubLimbs<N>(exp, m.m_value, two);
+    Copy<N>(table[0], m.m_one);
+    Copy<N>(table[1], a);
+    Copy<N>(acc, m.m_one);
+    for (int j = 2; j < 16; j++) {
+        MontMul<N>(table[j], table[j - 1], a, m);
+    }
+    for (int w = N * 16 - 1; w >= 0; w--) {
+        for (int k = 0; k < 4; k++) {
+            MontSqr<N>(acc, acc, m);
+        }
+        Uint64 digit = (exp[w / 16] >> (4 * (w % 16))) & 0xf;
+        MontMul<N>(acc, acc, table[digit], m);
+    }
+    Copy<N>(r, acc);
+}
+
+// big endian bytes, size at most 8 * N
+template<int N>
+inline void
+FromBytes(Uint64 r[N], const Uint8* pBytes, Uint64 size)
+{
+    for (int i = 0; i < N; i++) {
+        r[i] = 0;
+    }
+    for (Uint64 i = 0; i < size; i++) {
+        Uint64 pos = size - 1 - i;
+        r[pos / 8] |= static_cast<Uint64>(pBytes[i]) << (8 * (pos % 8));
+    }
+}
+
+template<int N>
+inline void
+ToBytes(Uint8* pBytes, const Uint64 a[N], Uint64 size)
+{
+    for (Uint64 i = 0; i < size; i++) {
+        Uint64 pos = size - 1 - i;
+        pBytes[i]  = static_cast<Uint8>(a[pos / 8] >> (8 * (pos % 8)));
+    }
+}
+
+// dbl-2001-b, a = -3
+template<int N>
+inline void
+PointDouble(Point<N>& r, const Point<N>& a, const CurveParams<N>& c)
+{
+    const Modulus<N>& p = c.m_prime;
+    Uint64 delta[N], gamma[N], beta[N], alpha[N], t0[N], t1[N];
+
+    MontSqr<N>(delta, a.m_z, p);
+    MontSqr<N>(gamma, a.m_y, p);
+    MontMul<N>(beta, a.m_x, gamma, p);
+
+    ModSub<N>(t0, a.m_x, delta, p);
+    ModAdd<N>(t1, a.m_x, delta, p);
+    MontMul<N>(t0, t0, t1, p);
+    ModAdd<N>(alpha, t0, t0, p);
+    ModAdd<N>(alpha, alpha, t0, p);
+
+    // Z3 = (Y + Z)^2 - gamma - delta, before Y and Z are overwritten
+    ModAdd<N>(t0, a.m_y, a.m_z, p);
+    MontSqr<N>(t0, t0, p);
+    ModSub<N>(t0, t0, gamma, p);
+    ModSub<N>(r.m_z, t0, delta, p);
+
+    // X3 = alpha^2 - 8 * beta
+    ModAdd<N>(beta, beta, beta, p);
+    ModAdd<N>(beta, beta, beta, p);
+    MontSqr<N>(t0, alpha, p);
+    ModSub<N>(t0, t0, beta, p);
+    ModSub<N>(r.m_x, t0, beta, p);
+
+    // Y3 = alpha * (4 * beta - X3) - 8 * gamma^2
+    ModSub<N>(t0, beta, r.m_x, p);
+    MontMul<N>(t0, alpha, t0, p);
+    MontSqr<N>(t1, gamma, p);
+    ModAdd<N>(t1, t1, t1, p);
+    ModAdd<N>(t1, t1, t1, p);
+    ModAdd<N>(t1, t1, t1, p);
+    ModSub<N>(r.m_y, t0, t1, p);
+}
+
+/*
+ * add-2007-bl. Infinity on either side is handled by selects, a == b only
+ * happens for inputs that are not derived from a secret scalar, or with
+ * negligible probability, so it takes a branch to the doubling
+ */
+template<int N>
+inline void
+PointAdd(Point<N>&            r,
+         const Point<N>&      a,
+         const Point<N>&      b,
+         const CurveParams<N>& c)
+{
+    const Modulus<N>& p = c.m_prime;
+    Uint64 z1z1[N], z2z2[N], u1[N], u2[N], s1[N], s2[N], h[N], rr[N];
+    Uint64 i[N], j[N], v[N], t[N];
+    Point<N> res;
+
+    MontSqr<N>(z1z1, a.m_z, p);
+    MontSqr<N>(z2z2, b.m_z, p);
+    MontMul<N>(u1, a.m_x, z2z2, p);
+    MontMul<N>(u2, b.m_x, z1z1, p);
+    MontMul<N>(s1, a.m_y, b.m_z, p);
+    MontMul<N>(s1, s1, z2z2, p);
+    MontMul<N>(s2, b.m_y, a.m_z, p);
+    MontMul<N>(s2, s2, z1z1, p);
+    ModSub<N>(h, u2, u1, p);
+    ModSub<N>(rr, s2, s1, p);
+
+    Uint64 a_inf = ZeroMask<N>(a.m_z);
+    Uint64 b_inf = ZeroMask<N>(b.m_z);
+    if (ZeroMask<N>(h) & ZeroMask<N>(rr) & ~a_inf & ~b_inf) {
+        PointDouble<N>(r, a, c);
+        return;
+    }
+
+    ModAdd<N>(i, h, h, p);
+    MontSqr<N>(i, i, p);
+    MontMul<N>(j, h, i, p);
+    ModAdd<N>(rr, rr, rr, p);
+    MontMul<N>(v, u1, i, p);
+
+    MontSqr<N>(t, rr, p);
+    ModSub<N>(t, t, j, p);
+    ModSub<N>(t, t, v, p);
+    ModSub<N>(res.m_x, t, v, p);
+
+    ModSub<N>(t, v, res.m_x, p);
+    MontMul<N>(t, rr, t, p);
+    MontMul<N>(s1, s1, j, p);
+    ModAdd<N>(s1, s1, s1, p);
+    ModSub<N>(res.m_y, t, s1, p);
+
+    ModAdd<N>(t, a.m_z, b.m_z, p);
+    MontSqr<N>(t, t, p);
+    ModSub<N>(t, t, z1z1, p);
+    ModSub<N>(t, t, z2z2, p);
+    MontMul<N>(res.m_z, t, h, p);
+
+    Select<N>(res.m_x, b.m_x, res.m_x, a_inf);
+    Select<N>(res.m_y, b.m_y, res.m_y, a_inf);
+    Select<N>(res.m_z, b.m_z, res.m_z, a_inf);
+    Select<N>(r.m_x, a.m_x, res.m_x, b_inf);
+    Select<N>(r.m_y, a.m_y, res.m_y, b_inf);
+    Select<N>(r.m_z, a.m_z, res.m_z, b_inf);
+}
+
+// madd-2007-bl, b has Z = 1 and is ignored when bInf is all ones
+template<int N>
+inline void
+PointAddAffine(Point<N>&             r,
+               const Point<N>&       a,
+               const AffinePoint<N>& b,
+               Uint64                bInf,
+               const CurveParams<N>& c)
+{
+    const Modulus<N>& p = c.m_prime;
+    Uint64 z1z1[N], u2[N], s2[N], h[N], hh[N], rr[N], i[N], j[N], v[N];
+    Uint64 t[N];
+    Point<N> res;
+
+    MontSqr<N>(z1z1, a.m_z, p);
+    MontMul<N>(u2, b.m_x, z1z1, p);
+    MontMul<N>(s2, b.m_y, a.m_z, p);
+    MontMul<N>(s2, s2, z1z1, p);
+    ModSub<N>(h, u2, a.m_x, p);
+    ModSub<N>(rr, s2, a.m_y, p);
+
+    Uint64 a_inf = ZeroMask<N>(a.m_z);
+    if (ZeroMask<N>(h) & ZeroMask<N>(rr) & ~a_inf & ~bInf) {
+        PointDouble<N>(r, a, c);
+        return;
+    }
+
+    MontSqr<N>(hh, h, p);
+    ModAdd<N>(i, hh, hh, p);
+    ModAdd<N>(i, i, i, p);
+    MontMul<N>(j, h, i, p);
+    ModAdd<N>(rr, rr, rr, p);
+    MontMul<N>(v, a.m_x, i, p);
+
+    MontSqr<N>(t, rr, p);
+    ModSub<N>(t, t, j, p);
+    ModSub<N>(t, t, v, p);
+    ModSub<N>(res.m_x, t, v, p);
+
+    ModSub<N>(t, v, res.m_x, p);
+    MontMul<N>(t, rr, t, p);
+    MontMul<N>(s2, a.m_y, j, p);
+    ModAdd<N>(s2, s2, s2, p);
+    ModSub<N>(res.m_y, t, s2, p);
+
+    ModAdd<N>(t, a.m_z, h, p);
+    MontSqr<N>(t, t, p);
+    ModSub<N>(t, t, z1z1, p);
+    ModSub<N>(res.m_z, t, hh, p);
+
+    Select<N>(res.m_x, b.m_x, res.m_x, a_inf);
+    Select<N>(res.m_y, b.m_y, res.m_y, a_inf);
+    Select<N>(res.m_z, p.m_one, res.m_z, a_inf);
+    Select<N>(r.m_x, a.m_x, res.m_x, bInf);
+    Select<N>(r.m_y, a.m_y, res.m_y, bInf);
+    Select<N>(r.m_z, a.m_z, res.m_z, bInf);
+}
+
+template<int N>
+inline void
+PointNegate(Point<N>& r, const Point<N>& a, const CurveParams<N>& c)
+{
+    Uint64 zero[N] = {};
+    r              = a;
+    ModSub<N>(r.m_y, zero, a.m_y, c.m_prime);
+}
+
+template<int N>
+inline void
+BasePoint(Point<N>& r, const CurveParams<N>& c)
+{
+    Copy<N>(r.m_x, c.m_gx);
+    Copy<N>(r.m_y, c.m_gy);
+    Copy<N>(r.m_z, c.m_prime.m_one);
+}
+
+/*
+ * r = k * a, k given as size big endian bytes. Fixed 4 bit windows over a
+ * table of 0 .. 15 * a, every lookup reads the whole table
+ */
+template<int N>
+inline void
+ScalarMul(Point<N>&             r,
+          const Uint8*          pScalar,
+          const Point<N>&       a,
+          const CurveParams<N>& c)
+{
+    Point<N> table[16], entry = {}, acc = {};
+
+    table[0] = Point<N>{};
+    table[1] = a;
+    for (int j = 2; j < 16; j++) {
+        if (j & 1) {
+            PointAdd<N>(table[j], table[j - 1], a, c);
+        } else {
+            PointDouble<N>(table[j], table[j / 2], c);
+        }
+    }
+
+    for (Uint64 i = 0; i < c.m_size * 2; i++) {
+        for (int k = 0; k < 4; k++) {
+            PointDouble<N>(acc, acc, c);
+        }
+        Uint64 digit = (pScalar[i / 2] >> (4 * ((i & 1) ^ 1))) & 0xf;
+
+        for (Uint64 j = 0; j < 16; j++) {
+            Uint64 mask = 0 - (((digit ^ j) - 1) >> 63);
+            Select<N>(entry.m_x, table[j].m_x, entry.m_x, mask);
+            Select<N>(entry.m_y, table[j].m_y, entry.m_y, mask);
+            Select<N>(entry.m_z, table[j].m_z, entry.m_z, mask);
+        }
+        PointAdd<N>(acc, acc, entry, c);
+    }
+    r = acc;
+}
+
+// windows of the fixed base table, one more than the nibbles for the carry
+template<int N>
+inline Uint64
+BaseWindows(const CurveParams<N>& c)
+{
+    return 2 * c.m_size + 1;
+}
+
+/*
+ * Fixed base table, entry [w * BaseEntries + j] is (j + 1) * 16^w * G in
+ * affine form. Built with a single inversion shared by all the entries
+ */
+template<int N>
+inline std::unique_ptr<AffinePoint<N>[]>
+BuildBaseTable(const CurveParams<N>& c)
+{
+    const Modulus<N>& p     = c.m_prime;
+    const Uint64      count = BaseWindows<N>(c) * BaseEntries;
+    auto              res   = std::make_unique<AffinePoint<N>[]>(count);
+    auto              jac   = std::make_unique<Point<N>[]>(count);
+    auto              acc   = std::make_unique<Uint64[][N]>(count);
+    Point<N>          base;
+
+    BasePoint<N>(base, c);
+    for (Uint64 w = 0; w < BaseWindows<N>(c); w++) {
+        Point<N>* row = &jac[w * BaseEntries];
+        row[0]        = base;
+        for (Uint64 j = 1; j < BaseEntries; j++) {
+            PointAdd<N>(row[j], row[j - 1], base, c);
+        }
+        for (int k = 0; k < 4; k++) {
+            PointDouble<N>(base, base, c);
+        }
+    }
+
+    // batch inversion of all the Z coordinates
+    Copy<N>(acc[0], jac[0].m_z);
+    for (Uint64 i = 1; i < count; i++) {
+        MontMul<N>(acc[i], acc[i - 1], jac[i].m_z, p);
+    }
+    Uint64 inv[N], zinv[N], zinv2[N];
+    MontInverse<N>(inv, acc[count - 1], p);
+    for (Uint64 i = count - 1; i > 0; i--) {
+        MontMul<N>(zinv, inv, acc[i - 1], p);
+        MontMul<N>(inv, inv, jac[i].m_z, p);
+
+        MontSqr<N>(zinv2, zinv, p);
+        MontMul<N>(res[i].m_x, jac[i].m_x, zinv2, p);
+        MontMul<N>(zinv2, zinv2, zinv, p);
+        MontMul<N>(res[i].m_y, jac[i].m_y, zinv2, p);
+    }
+    // first entry is G itself
+    Copy<N>(res[0].m_x, c.m_gx);
+    Copy<N>(res[0].m_y, c.m_gy);
+    return res;
+}
+
+/*
+ * r = k * G over a table from BuildBaseTable. Signed 4 bit digits, so each
+ * window is one mixed addition of an entry read by a full table scan
+ */
+template<int N>
+inline void
+ScalarMulBase(Point<N>&             r,
+              const Uint8*          pScalar,
+              const AffinePoint<N>* pTable,
+              const CurveParams<N>& c)
+{
+    const Uint64   size = c.m_size;
+    Uint64         zero[N] = {}, neg[N];
+    AffinePoint<N> entry;
+    Int8           carry = 0;
+
+    r = Point<N>{};
+    for (Uint64 w = 0; w < BaseWindows<N>(c); w++) {
+        Int8 digit = carry;
+        if (w < 2 * size) {
+            digit += (pScalar[size - 1 - w / 2] >> (4 * (w & 1))) & 0xf;
+        }
+        carry = (digit + 8) >> 4;
+        digit = digit - (carry << 4);
+
+        Uint64 sign =
+            0 - static_cast<Uint64>(static_cast<Uint8>(digit) >> 7);
+        Uint64 abs = (static_cast<Uint64>(digit) ^ sign) - sign;
+
+        entry = AffinePoint<N>{};
+        for (Uint64 j = 0; j < BaseEntries; j++) {
+            const AffinePoint<N>& e    = pTable[w * BaseEntries + j];
+            Uint64                mask = 0 - (((abs ^ (j + 1)) - 1) >> 63);
+            Select<N>(entry.m_x, e.m_x, entry.m_x, mask);
+            Select<N>(entry.m_y, e.m_y, entry.m_y, mask);
+        }
+        ModSub<N>(neg, zero, entry.m_y, c.m_prime);
+        Select<N>(entry.m_y, neg, entry.m_y, sign);
+        PointAddAffine<N>(r, r, entry, 0 - ((abs - 1) >> 63), c);
+    }
+}
+
+/*
+ * Width w NAF of k, least significant digit first. pDigits needs room for
+ * 64 * N + 1 digits, returns the number written
+ */
+template<int N>
+inline int
+RecodeWnaf(Int8* pDigits, const Uint64 k[N], int width)
+{
+    Uint64 t[N + 1];
+    int    count = 0;
+    for (int i = 0; i < N; i++) {
+        t[i] = k[i];
+    }
+    t[N] = 0;
+
+    for (;;) {
+        Uint64 any = 0;
+        for (int i = 0; i <= N; i++) {
+            any |= t[i];
+        }
+        if (!any) {
+            break;
+        }
+        Int64 digit = 0;
+        if (t[0] & 1) {
+            digit = static_cast<Int64>(t[0] & ((1u << width) - 1));
+            if (digit >= (1 << (width - 1))) {
+                digit -= 1 << width;
+            }
+            // t -= digit, the low bits become zero
+            Uint64 ext    = digit < 0 ? ~0ULL : 0;
+            Uint64 borrow = 0;
+            for (int i = 0; i <= N; i++) {
+                Uint64      s = i == 0 ? static_cast<Uint64>(digit) : ext;
+                __uint128_t d = static_cast<__uint128_t>(t[i]) - s - borrow;
+                t[i]          = static_cast<Uint64>(d);
+                borrow        = static_cast<Uint64>(d >> 64) & 1;
+            }
+        }
+        pDigits[count++] = static_cast<Int8>(digit);
+        for (int i = 0; i < N; i++) {
+            t[i] = (t[i] >> 1) | (t[i + 1] << 63);
+        }
+        t[N] >>= 1;
+    }
+    return count;
+}
+
+/*
+ * r = u1 * G + u2 * q with Shamir's trick, both scalars as 5 bit wNAF sharing
+ * one doubling chain. Variable time, for public inputs only
+ */
+template<int N>
+inline void
+DoubleScalarMul(Point<N>&             r,
+                const Uint64          u1[N],
+                const Uint64          u2[N],
+                const Point<N>&       q,
+                const CurveParams<N>& c)
+{
+    constexpr int Width   = 5;
+    constexpr int Entries = 1 << (Width - 2);
+    Point<N>      tableG[Entries], tableQ[Entries], dbl, neg;
+    Int8          digits1[N * 64 + 1] = {}, digits2[N * 64 + 1] = {};
+
+    // odd multiples 1, 3, .. 15
+    BasePoint<N>(tableG[0], c);
+    tableQ[0] = q;
+    PointDouble<N>(dbl, tableG[0], c);
+    for (int j = 1; j < Entries; j++) {
+        PointAdd<N>(tableG[j], tableG[j - 1], dbl, c);
+    }
+    PointDouble<N>(dbl, q, c);
+    for (int j = 1; j < Entries; j++) {
+        PointAdd<N>(tableQ[j], tableQ[j - 1], dbl, c);
+    }
+
+    int len1 = RecodeWnaf<N>(digits1, u1, Width);
+    int len2 = RecodeWnaf<N>(digits2, u2, Width);
+
+    r = Point<N>{};
+    for (int i = (len1 > len2 ? len1 : len2) - 1; i >= 0; i--) {
+        PointDouble<N>(r, r, c);
+        for (int s = 0; s < 2; s++) {
+            Int8      d     = s ? digits2[i] : digits1[i];
+            Point<N>* table = s ? tableQ : tableG;
+            if (d > 0) {
+                PointAdd<N>(r, r, table[d / 2], c);
+            } else if (d < 0) {
+                PointNegate<N>(neg, table[-d / 2], c);
+                PointAdd<N>(r, r, neg, c);
+            }
+        }
+    }
+}
+
+// (x, y) in the normal domain, false for the point at infinity
+template<int N>
+inline bool
+PointToAffine(Uint64                x[N],
+              Uint64                y[N],
+              const Point<N>&       a,
+              const CurveParams<N>& c)
+{
+    const Modulus<N>& p = c.m_prime;
+    Uint64            zinv[N], zinv2[N];
+
+    if (ZeroMask<N>(a.m_z)) {
+        return false;
+    }
+    MontInverse<N>(zinv, a.m_z, p);
+    MontSqr<N>(zinv2, zinv, p);
+    MontMul<N>(x, a.m_x, zinv2, p);
+    MontMul<N>(zinv2, zinv2, zinv, p);
+    MontMul<N>(y, a.m_y, zinv2, p);
+    FromMont<N>(x, x, p);
+    FromMont<N>(y, y, p);
+    return true;
+}
+
+// affine (x, y) big endian, both below p and on the curve
+template<int N>
+inline bool
+DecodePoint(Point<N>& r, const Uint8* pPoint, const CurveParams<N>& c)
+{
+    const Modulus<N>& p = c.m_prime;
+    Uint64            lhs[N], rhs[N], t[N];
+
+    FromBytes<N>(r.m_x, pPoint, c.m_size);
+    FromBytes<N>(r.m_y, pPoint + c.m_size, c.m_size);
+    if (!IsLess<N>(r.m_x, p.m_value) || !IsLess<N>(r.m_y, p.m_value)) {
+        return false;
+    }
+    ToMont<N>(r.m_x, r.m_x, p);
+    ToMont<N>(r.m_y, r.m_y, p);
+    Copy<N>(r.m_z, p.m_one);
+
+    // y^2 = x^3 - 3 * x + b
+    MontSqr<N>(lhs, r.m_y, p);
+    MontSqr<N>(rhs, r.m_x, p);
+    MontMul<N>(rhs, rhs, r.m_x, p);
+    ModAdd<N>(t, r.m_x, r.m_x, p);
+    ModAdd<N>(t, t, r.m_x, p);
+    ModSub<N>(rhs, rhs, t, p);
+    ModAdd<N>(rhs, rhs, c.m_b, p);
+    ModSub<N>(t, lhs, rhs, p);
+
+    return ZeroMask<N>(t) != 0;
+}
+
+} // namespace alcp::ec::weierstrass
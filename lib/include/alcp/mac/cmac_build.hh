@@ -107,6 +107,9 @@ __build_cmac(const alc_cipher_info_t& cipherInfo,
     ctx.finish   = __cmac_wrapperFinish;
     ctx.reset    = __cmac_wrapperReset;
 
+    // The expanded AES key inside Cmac points into the object itself
+    ctx.duplicate = nullptr;
+
     return status;
 }
 Status
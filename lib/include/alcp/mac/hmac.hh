@@ -51,6 +51,14 @@ class ALCP_API_EXPORT Hmac final : public Mac
 
   public:
     Hmac();
+    /**
+     * @brief Copies rSrc, key, precomputed inner/outer digest states and the
+     * message processed so far included
+     * @param rSrc: HMAC to copy
+     * @param rDigest: Digest to be used by the copy, must be a copy of the
+     * digest used by rSrc
+     */
+    Hmac(const Hmac& rSrc, digest::Digest& rDigest);
     /**
      * @brief Can be called continously to update message on small chunks
      * @param buff: message array block to update HMAC
@@ -123,6 +123,25 @@ __hmac_wrapperReset(void* hmac, void* digest)
 
     return ap->reset();
 }
+template<typename MACALGORITHM, typename DIGESTALGORITHM>
+static Status
+__hmac_wrapperDuplicate(const Context& rSrcCtx, Context& rDestCtx)
+{
+    auto addr = reinterpret_cast<Uint8*>(&rDestCtx) + sizeof(rDestCtx);
+
+    // The copied digest carries the message state, the HMAC copy is bound
+    // to it and clones the precomputed key states
+    auto p_digest = new (addr) DIGESTALGORITHM(
+        *static_cast<const DIGESTALGORITHM*>(rSrcCtx.m_digest));
+    rDestCtx.m_digest = static_cast<void*>(p_digest);
+
+    auto p_hmac = new (addr + sizeof(*p_digest)) MACALGORITHM(
+        *static_cast<const MACALGORITHM*>(rSrcCtx.m_mac), *p_digest);
+    rDestCtx.m_mac = static_cast<void*>(p_hmac);
+
+    return StatusOk();
+}
+
 template<typename DIGESTALGORITHM, typename MACALGORITHM>
 static Status
 __build_hmac(const alc_mac_info_t& macInfo, Context& ctx)
@@ -150,11 +169,12 @@ __build_hmac(const alc_mac_info_t& macInfo, Context& ctx)
     }
     ctx.m_mac = static_cast<void*>(hmac_algo);
 
-    ctx.update   = __hmac_wrapperUpdate<MACALGORITHM>;
-    ctx.finalize = __hmac_wrapperFinalize<MACALGORITHM>;
-    ctx.copy     = __hmac_wrapperCopy<MACALGORITHM>;
-    ctx.finish   = __hmac_wrapperFinish<MACALGORITHM, DIGESTALGORITHM>;
-    ctx.reset    = __hmac_wrapperReset<MACALGORITHM, DIGESTALGORITHM>;
+    ctx.update    = __hmac_wrapperUpdate<MACALGORITHM>;
+    ctx.finalize  = __hmac_wrapperFinalize<MACALGORITHM>;
+    ctx.copy      = __hmac_wrapperCopy<MACALGORITHM>;
+    ctx.finish    = __hmac_wrapperFinish<MACALGORITHM, DIGESTALGORITHM>;
+    ctx.reset     = __hmac_wrapperReset<MACALGORITHM, DIGESTALGORITHM>;
+    ctx.duplicate = __hmac_wrapperDuplicate<MACALGORITHM, DIGESTALGORITHM>;
 
     if (macInfo.mi_keyinfo.len % 8 != 0) {
         return InternalError("HMAC: HMAC Key should be multiple of 8");
@@ -196,12 +216,13 @@ __build_hmac_sha3(const alc_mac_info_t& macInfo, Context& ctx)
     if (hmac_algo == nullptr) {
         return InternalError("Unable to Allocate Memory for HMAC Object");
     }
-    ctx.m_mac    = static_cast<void*>(hmac_algo);
-    ctx.update   = __hmac_wrapperUpdate<MACALGORITHM>;
-    ctx.finalize = __hmac_wrapperFinalize<MACALGORITHM>;
-    ctx.copy     = __hmac_wrapperCopy<MACALGORITHM>;
-    ctx.finish   = __hmac_wrapperFinish<MACALGORITHM, digest::Sha3>;
-    ctx.reset    = __hmac_wrapperReset<MACALGORITHM, digest::Sha3>;
+    ctx.m_mac     = static_cast<void*>(hmac_algo);
+    ctx.update    = __hmac_wrapperUpdate<MACALGORITHM>;
+    ctx.finalize  = __hmac_wrapperFinalize<MACALGORITHM>;
+    ctx.copy      = __hmac_wrapperCopy<MACALGORITHM>;
+    ctx.finish    = __hmac_wrapperFinish<MACALGORITHM, digest::Sha3>;
+    ctx.reset     = __hmac_wrapperReset<MACALGORITHM, digest::Sha3>;
+    ctx.duplicate = __hmac_wrapperDuplicate<MACALGORITHM, digest::Sha3>;
 
     if (macInfo.mi_keyinfo.len % 8 != 0) {
         return InternalError("HMAC: HMAC Key should be multiple of 8");
@@ -26,35 +26,48 @@
  *
  */
 
-#include <openssl/bn.h>
+#pragma once
 
 #include "alcp/base.hh"
 #include "alcp/mac/mac.hh"
+#include "alcp/mac/poly1305_arch.hh"
+#include "alcp/utils/cpuid.hh"
 
 namespace alcp::mac::poly1305 {
+using utils::CpuCipherFeatures;
+
+/**
+ * @brief Poly1305 one-time authenticator (RFC 8439)
+ *
+ * @tparam cpu_cipher_feature eReference selects the scalar radix 2^44 engine,
+ * eVaes256 the AVX2 4-block kernel, eVaes512 the AVX-512 8-block kernel and
+ * eDynamic picks a kernel at runtime based on CpuId.
+ */
+template<CpuCipherFeatures cpu_cipher_feature = CpuCipherFeatures::eDynamic>
 class ALCP_API_EXPORT Poly1305 : public Mac
 {
   private:
-    Uint8   m_accumulator[18] = {};
-    Uint8   m_key[32];
-    BIGNUM *m_key_bn = nullptr, *m_a_bn = nullptr, *m_r_bn = nullptr,
-           *m_s_bn = nullptr, *m_p_bn = nullptr;
-    Uint8   m_msg_buffer[16];
-    Uint64  m_msg_buffer_len = {};
-    BN_CTX* m_bn_temp_ctx    = nullptr;
-    bool    m_finalized      = false;
+    Poly1305State m_state;
+    Uint8         m_mac[16]        = {};
+    Uint8         m_msg_buffer[16] = {};
+    Uint64        m_msg_buffer_len = {};
+    bool          m_finalized      = false;
 
-    Uint8 m_p[17] = { 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-                      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb };
-    void  clamp(Uint8 in[16]);
+    void blocks(const Uint8 pMsg[], Uint64 msgLen, Uint64 padBit);
 
   public:
+    /**
+     * @brief Absorbs the message, a trailing partial block is padded
+     * @param pMsg   - Message
+     * @param msgLen - Length of the message in bytes
+     * @return Status
+     */
     Status blk(const Uint8 pMsg[], Uint64 msgLen);
     Status update(const Uint8 pMsg[], Uint64 msgLen) override;
     /**
      * @brief Sets the Key and Initializes the state of Poly1305
      * @param key - Key to use for Poly1305
-     * @param len - Key Length 32 Byte, anything else wont work
+     * @param len - Key Length 256 Bits, anything else wont work
      * @return Status
      */
     Status setKey(const Uint8 key[], Uint64 len);
@@ -62,9 +75,7 @@ class ALCP_API_EXPORT Poly1305 : public Mac
     Status finalize(const Uint8 pMsg[], Uint64 msgLen) override;
     Status copy(Uint8 digest[], Uint64 length);
     void   finish() override;
-    // Uint8* macUpdate(const Uint8 msg[], const Uint8 key[], Uint64
-    // msgLen);
     Poly1305() = default;
     virtual ~Poly1305();
 };
-} // namespace alcp::mac::poly1305
\ No newline at end of file
+} // namespace alcp::mac::poly1305
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2024, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+#include "alcp/base.hh"
+
+namespace alcp::mac::poly1305 {
+
+/* 2^44 limbs are used by the scalar path, vector kernels work on 2^26 limbs */
+static constexpr Uint64 cMask44 = 0xfffffffffffULL;
+static constexpr Uint64 cMask42 = 0x3ffffffffffULL;
+static constexpr Uint64 cMask26 = 0x3ffffffULL;
+
+/**
+ * @brief State shared between the scalar Poly1305 engine and the multi-block
+ * vector kernels.
+ *
+ * Accumulator and r are kept in radix 2^44 (44/44/42 bit limbs). Powers
+ * r^1..r^8 are precomputed once per key in radix 2^26 so that vector kernels
+ * can multiply 4 (AVX2) or 8 (AVX-512) blocks in parallel.
+ */
+struct Poly1305State
+{
+    Uint64 m_acc[3] = {}; /* h */
+    Uint64 m_r[3]   = {}; /* clamped r */
+    Uint64 m_s[2]   = {}; /* s, little endian 64 bit words */
+    /* m_r_pow26[i] holds r^(i+1) in radix 2^26 */
+    alignas(64) Uint32 m_r_pow26[8][5] = {};
+};
+
+/**
+ * @brief Fully carries a radix 2^44 number, result is < 2^130
+ */
+static inline void
+Radix44Carry(Uint64 h[3])
+{
+    Uint64 c;
+    c = h[0] >> 44;
+    h[0] &= cMask44;
+    h[1] += c;
+    c = h[1] >> 44;
+    h[1] &= cMask44;
+    h[2] += c;
+    c = h[2] >> 42;
+    h[2] &= cMask42;
+    h[0] += c * 5;
+    c = h[0] >> 44;
+    h[0] &= cMask44;
+    h[1] += c;
+    c = h[1] >> 44;
+    h[1] &= cMask44;
+    h[2] += c;
+}
+
+/**
+ * @brief Converts a fully carried radix 2^44 number into radix 2^26 limbs
+ */
+static inline void
+Radix44ToRadix26(const Uint64 h[3], Uint64 out[5])
+{
+    out[0] = h[0] & cMask26;
+    out[1] = ((h[0] >> 26) | (h[1] << 18)) & cMask26;
+    out[2] = (h[1] >> 8) & cMask26;
+    out[3] = ((h[1] >> 34) | (h[2] << 10)) & cMask26;
+    out[4] = h[2] >> 16;
+}
+
+/**
+ * @brief Converts radix 2^26 limbs (each limb < 2^58) into radix 2^44
+ */
+static inline void
+Radix26ToRadix44(const Uint64 limbs[5], Uint64 h[3])
+{
+    Uint64 l[5] = { limbs[0], limbs[1], limbs[2], limbs[3], limbs[4] };
+    Uint64 c;
+    for (int i = 0; i < 4; i++) {
+        c = l[i] >> 26;
+        l[i] &= cMask26;
+        l[i + 1] += c;
+    }
+    c = l[4] >> 26;
+    l[4] &= cMask26;
+    l[0] += c * 5;
+    c = l[0] >> 26;
+    l[0] &= cMask26;
+    l[1] += c;
+
+    h[0] = l[0] + (l[1] << 26);
+    c    = h[0] >> 44;
+    h[0] &= cMask44;
+    h[1] = (l[2] << 8) + (l[3] << 34) + c;
+    c    = h[1] >> 44;
+    h[1] &= cMask44;
+    h[2] = (l[4] << 16) + c;
+    c    = h[2] >> 42;
+    h[2] &= cMask42;
+    h[0] += c * 5;
+    c = h[0] >> 44;
+    h[0] &= cMask44;
+    h[1] += c;
+}
+
+} // namespace alcp::mac::poly1305
+
+namespace alcp::mac::poly1305::avx2 {
+/**
+ * @brief Absorbs complete 16 byte blocks, 4 blocks per iteration
+ *
+ * @param state  Poly1305 state with precomputed powers of r
+ * @param pMsg   Message
+ * @param msgLen Length of the message in bytes
+ * @return Number of bytes absorbed, always a multiple of 64
+ */
+Uint64
+Poly1305Blocks(Poly1305State& state, const Uint8 pMsg[], Uint64 msgLen);
+} // namespace alcp::mac::poly1305::avx2
+
+namespace alcp::mac::poly1305::zen4 {
+/**
+ * @brief Absorbs complete 16 byte blocks, 8 blocks per iteration
+ *
+ * @param state  Poly1305 state with precomputed powers of r
+ * @param pMsg   Message
+ * @param msgLen Length of the message in bytes
+ * @return Number of bytes absorbed, always a multiple of 128
+ */
+Uint64
+Poly1305Blocks(Poly1305State& state, const Uint8 pMsg[], Uint64 msgLen);
+} // namespace alcp::mac::poly1305::zen4
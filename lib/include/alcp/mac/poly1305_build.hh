@@ -35,6 +35,7 @@
 
 namespace alcp::mac::poly1305 {
 using namespace alcp::base::status;
+using utils::CpuId;
 
 // FIXME: Below code looks way similar to CMAC builder, we can combine it
 class Poly1305Builder
@@ -47,89 +48,109 @@ class Poly1305Builder
     static Status isSupported(const alc_mac_info_t& macInfo);
 };
 
+template<CpuCipherFeatures cpu_cipher_feature>
 static Status
 __poly1305_wrapperUpdate(void* poly1305, const Uint8* buff, Uint64 size)
 {
 
-    auto p_poly1305 = static_cast<Poly1305*>(poly1305);
+    auto p_poly1305 = static_cast<Poly1305<cpu_cipher_feature>*>(poly1305);
     return p_poly1305->update(buff, size);
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 static Status
 __poly1305_wrapperFinalize(void* poly1305, const Uint8* buff, Uint64 size)
 {
-    auto p_poly1305 = static_cast<Poly1305*>(poly1305);
+    auto p_poly1305 = static_cast<Poly1305<cpu_cipher_feature>*>(poly1305);
     return p_poly1305->finalize(buff, size);
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 static Status
 __poly1305_wrapperCopy(void* poly1305, Uint8* buff, Uint64 size)
 {
-    auto p_poly1305 = static_cast<Poly1305*>(poly1305);
+    auto p_poly1305 = static_cast<Poly1305<cpu_cipher_feature>*>(poly1305);
     return p_poly1305->copy(buff, size);
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 static void
 __poly1305_wrapperFinish(void* poly1305, void* digest)
 {
-    auto p_poly1305 = static_cast<Poly1305*>(poly1305);
+    auto p_poly1305 = static_cast<Poly1305<cpu_cipher_feature>*>(poly1305);
     p_poly1305->finish();
-#if 0
-    p_poly1305->~Poly1305();
-#else
     delete p_poly1305;
-#endif
-
-    // Not deleting the memory because it is allocated by application
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 static Status
 __poly1305_wrapperReset(void* poly1305, void* digest)
 {
-    auto p_poly1305 = static_cast<Poly1305*>(poly1305);
+    auto p_poly1305 = static_cast<Poly1305<cpu_cipher_feature>*>(poly1305);
     return p_poly1305->reset();
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
+static Status
+__poly1305_wrapperDuplicate(const Context& rSrcCtx, Context& rDestCtx)
+{
+    auto p_src  = static_cast<Poly1305<cpu_cipher_feature>*>(rSrcCtx.m_mac);
+    auto p_algo = new Poly1305<cpu_cipher_feature>(*p_src);
+
+    if (p_algo == nullptr) {
+        return InternalError("Unable to Allocate Memory for Poly1305 Object");
+    }
+    rDestCtx.m_mac = static_cast<void*>(p_algo);
+
+    return StatusOk();
+}
+
+template<CpuCipherFeatures cpu_cipher_feature>
 static Status
 __build_poly1305(const alc_key_info_t& cKinfo, Context& ctx)
 {
     using namespace status;
     Status status = StatusOk();
-#if 0
-    auto   addr   = reinterpret_cast<Uint8*>(&ctx) + sizeof(ctx);
-    auto   p_algo = new (addr) Poly1305();
-#else
-    auto p_algo = new Poly1305();
-#endif
-
-    auto p_key = cKinfo.key;
-    auto len   = cKinfo.len;
-    p_algo->setKey(p_key, len);
+    auto   p_algo = new Poly1305<cpu_cipher_feature>();
+
     if (p_algo == nullptr) {
-        return InternalError("Unable to Allocate Memory for CMAC Object");
+        return InternalError("Unable to Allocate Memory for Poly1305 Object");
+    }
+    status = p_algo->setKey(cKinfo.key, cKinfo.len);
+    if (!status.ok()) {
+        delete p_algo;
+        return status;
     }
     ctx.m_mac = static_cast<void*>(p_algo);
 
-    ctx.update   = __poly1305_wrapperUpdate;
-    ctx.finalize = __poly1305_wrapperFinalize;
-    ctx.copy     = __poly1305_wrapperCopy;
-    ctx.finish   = __poly1305_wrapperFinish;
-    ctx.reset    = __poly1305_wrapperReset;
+    ctx.update    = __poly1305_wrapperUpdate<cpu_cipher_feature>;
+    ctx.finalize  = __poly1305_wrapperFinalize<cpu_cipher_feature>;
+    ctx.copy      = __poly1305_wrapperCopy<cpu_cipher_feature>;
+    ctx.finish    = __poly1305_wrapperFinish<cpu_cipher_feature>;
+    ctx.reset     = __poly1305_wrapperReset<cpu_cipher_feature>;
+    ctx.duplicate = __poly1305_wrapperDuplicate<cpu_cipher_feature>;
 
     return status;
 }
+
 Status
 Poly1305Builder::build(const alc_mac_info_t& macInfo,
                        const alc_key_info_t& keyInfo,
                        Context&              ctx)
 {
-    return __build_poly1305(keyInfo, ctx);
+    // Kernel is chosen once here, so the per-call path has no CPU checks
+    if (CpuId::cpuHasAvx512(utils::AVX512_F)) {
+        return __build_poly1305<CpuCipherFeatures::eVaes512>(keyInfo, ctx);
+    } else if (CpuId::cpuHasAvx2()) {
+        return __build_poly1305<CpuCipherFeatures::eVaes256>(keyInfo, ctx);
+    }
+    return __build_poly1305<CpuCipherFeatures::eReference>(keyInfo, ctx);
 }
 
 Uint64
 Poly1305Builder::getSize(const alc_mac_info_t& macInfo)
 {
-    return sizeof(Poly1305);
+    return sizeof(Poly1305<>);
 }
 
 Status
@@ -47,7 +47,8 @@ template<alc_rsa_key_size T>
 class ALCP_API_EXPORT Rsa
 {
   public:
-    static_assert(T == KEY_SIZE_1024 || T == KEY_SIZE_2048);
+    static_assert(T == KEY_SIZE_1024 || T == KEY_SIZE_2048
+                  || T == KEY_SIZE_3072 || T == KEY_SIZE_4096);
     Rsa();
     ~Rsa();
     /**
@@ -61,6 +62,40 @@ class ALCP_API_EXPORT Rsa
      */
     Status encryptPublic(const Uint8* pText, Uint64 textSize, Uint8* pEncText);
 
+    /**
+     * @brief Function encrypts a batch of buffers, each with the public key
+     * of its own object. The objects may hold different keys or all be the
+     * same one. With AVX512 IFMA up to RsaBatchSize of them run side by
+     * side, one per vector lane
+     *
+     * @param [in]  pRsa           pointers to the objects holding the keys
+     * @param [in]  pText          pointers to input texts
+     * @param [in]  textSize       Input text size of every text
+     * @param [out] pEncText       pointers to encrypted texts
+     * @param [in]  num            number of texts
+     *
+     * @return Status Error code
+     */
+    static Status encryptPublicBatch(Rsa* const         pRsa[],
+                                     const Uint8* const pText[],
+                                     Uint64             textSize,
+                                     Uint8* const       pEncText[],
+                                     Uint64             num);
+
+    /**
+     * @brief set the Digest used to hash the message of OAEP and of the
+     * signatures. PKCS#1 v1.5 signatures take the SHA2 DigestInfo matching
+     * the hash size
+     * @param [in] digest         Digest class to be used
+     */
+    void setDigest(digest::IDigest* digest);
+
+    /**
+     * @brief set the MGF used by OAEP and PSS padding
+     * @param [in]  mgf           Digest class to be used by MGF1
+     */
+    void setMgf(digest::IDigest* mgf);
+
     /**
      * @brief set the Digest to be used by OAEP encrytion
      * @param [in] digest         Digest class to be used by OAEP encrytion.
@@ -105,6 +140,23 @@ class ALCP_API_EXPORT Rsa
      */
     Status decryptPrivate(const Uint8* pEncText, Uint64 encSize, Uint8* pText);
 
+    /**
+     * @brief Function decrypts a batch of buffers. With AVX512 IFMA up to
+     * RsaBatchSize of them run side by side, one per vector lane, which
+     * gives more throughput than decrypting them one after the other
+     *
+     * @param [in]  pEncText    pointers to encrypted texts
+     * @param [in]  encSize     encrypted data size of every text
+     * @param [out] pText       pointers to decrypted texts
+     * @param [in]  num         number of texts
+     *
+     * @return Status Error code
+     */
+    Status decryptPrivateBatch(const Uint8* const pEncText[],
+                               Uint64             encSize,
+                               Uint8* const       pText[],
+                               Uint64             num);
+
     /**
      * @brief Function decrypt the buffer with oaep padding
      *
@@ -124,6 +176,149 @@ class ALCP_API_EXPORT Rsa
                               Uint64       labelSize,
                               Uint8*       pText,
                               Uint64&      textSize);
+    /**
+     * @brief Function signs the message using PKCS#1 v1.5 padding
+     *
+     * @param [in]  check          verify the signature before returning it
+     * @param [in]  pText          pointer to message
+     * @param [in]  textSize       message size
+     * @param [out] pSignText      pointer to signature of key size
+     *
+     * @return Status Error code
+     */
+    Status signPkcs1v15(bool         check,
+                        const Uint8* pText,
+                        Uint64       textSize,
+                        Uint8*       pSignText);
+
+    /**
+     * @brief Function signs a batch of messages using PKCS#1 v1.5 padding,
+     * the private key operations run through decryptPrivateBatch
+     *
+     * @param [in]  check          verify the signatures before returning
+     * @param [in]  pText          pointers to messages
+     * @param [in]  textSize       message sizes
+     * @param [out] pSignText      pointers to signatures of key size
+     * @param [in]  num            number of messages
+     *
+     * @return Status Error code
+     */
+    Status signPkcs1v15Batch(bool               check,
+                             const Uint8* const pText[],
+                             const Uint64       textSize[],
+                             Uint8* const       pSignText[],
+                             Uint64             num);
+
+    /**
+     * @brief Function verifies the PKCS#1 v1.5 signature of the message
+     *
+     * @param [in]  pText          pointer to message
+     * @param [in]  textSize       message size
+     * @param [in]  pSignText      pointer to signature of key size
+     *
+     * @return Status Error code
+     */
+    Status verifyPkcs1v15(const Uint8* pText,
+                          Uint64       textSize,
+                          const Uint8* pSignText);
+
+    /**
+     * @brief Function verifies a batch of PKCS#1 v1.5 signatures, each with
+     * the public key and digest of its own object. The public key operations
+     * run through encryptPublicBatch
+     *
+     * @param [in]  pRsa           pointers to the objects holding the keys
+     * @param [in]  pText          pointers to messages
+     * @param [in]  textSize       message sizes
+     * @param [in]  pSignText      pointers to signatures of key size
+     * @param [out] pValid         set for every signature that verifies
+     * @param [in]  num            number of signatures
+     *
+     * @return Status Error code, a signature failing to verify is not one
+     */
+    static Status verifyPkcs1v15Batch(Rsa* const         pRsa[],
+                                      const Uint8* const pText[],
+                                      const Uint64       textSize[],
+                                      const Uint8* const pSignText[],
+                                      bool               pValid[],
+                                      Uint64             num);
+
+    /**
+     * @brief Function signs the message using PSS padding
+     *
+     * @param [in]  check          verify the signature before returning it
+     * @param [in]  pText          pointer to message
+     * @param [in]  textSize       message size
+     * @param [in]  salt           pointer to salt
+     * @param [in]  saltSize       salt size
+     * @param [out] pSignText      pointer to signature of key size
+     *
+     * @return Status Error code
+     */
+    Status signPss(bool         check,
+                   const Uint8* pText,
+                   Uint64       textSize,
+                   const Uint8* salt,
+                   Uint64       saltSize,
+                   Uint8*       pSignText);
+
+    /**
+     * @brief Function signs a batch of messages using PSS padding, the
+     * private key operations run through decryptPrivateBatch
+     *
+     * @param [in]  check          verify the signatures before returning
+     * @param [in]  pText          pointers to messages
+     * @param [in]  textSize       message sizes
+     * @param [in]  salt           pointers to salts, one per message
+     * @param [in]  saltSize       size of every salt
+     * @param [out] pSignText      pointers to signatures of key size
+     * @param [in]  num            number of messages
+     *
+     * @return Status Error code
+     */
+    Status signPssBatch(bool               check,
+                        const Uint8* const pText[],
+                        const Uint64       textSize[],
+                        const Uint8* const salt[],
+                        Uint64             saltSize,
+                        Uint8* const       pSignText[],
+                        Uint64             num);
+
+    /**
+     * @brief Function verifies the PSS signature of the message, the salt
+     * size is recovered from the signature
+     *
+     * @param [in]  pText          pointer to message
+     * @param [in]  textSize       message size
+     * @param [in]  pSignText      pointer to signature of key size
+     *
+     * @return Status Error code
+     */
+    Status verifyPss(const Uint8* pText,
+                     Uint64       textSize,
+                     const Uint8* pSignText);
+
+    /**
+     * @brief Function verifies a batch of PSS signatures, each with the
+     * public key, digest and MGF of its own object. The public key
+     * operations run through encryptPublicBatch
+     *
+     * @param [in]  pRsa           pointers to the objects holding the keys
+     * @param [in]  pText          pointers to messages
+     * @param [in]  textSize       message sizes
+     * @param [in]  pSignText      pointers to signatures of key size
+     * @param [out] pValid         set for every signature that verifies
+     * @param [in]  num            number of signatures
+     *
+     * @return Status Error code, a signature failing to verify is not one
+     */
+    static Status verifyPssBatch(Rsa* const         pRsa[],
+                                 const Uint8* const pText[],
+                                 const Uint64       textSize[],
+                                 const Uint8* const pSignText[],
+                                 bool               pValid[],
+                                 Uint64             num);
+
     /**
      * @brief Function fetches the public key
      *
@@ -168,6 +363,74 @@ class ALCP_API_EXPORT Rsa
                          const Uint8* mod,
                          const Uint64 size);
 
+    /**
+     * @brief Builds a public key with its Montgomery context. The result is
+     * never modified, any number of objects of this key size on any thread
+     * can be set to it with setKey without building the context again
+     *
+     * @param [in]  exponent    public exponent
+     * @param [in]  mod         pointer to the modulus
+     * @param [in]  size        size of modulus
+     * @param [out] key         the built key
+     *
+     * @return Status Error code
+     */
+    static Status createPublicKey(const Uint64                       exponent,
+                                  const Uint8*                       mod,
+                                  const Uint64                       size,
+                                  std::shared_ptr<RsaPublicKeyData>& key);
+
+    /**
+     * @brief Builds a private key with its Montgomery contexts, shared the
+     * same way as createPublicKey
+     *
+     * @param [in]   dp         - pointer to first exponent
+     * @param [in]   dq         - pointer to second exponent
+     * @param [in]   p          - pointer to first modulus
+     * @param [in]   q          - pointer to second modulus
+     * @param [in]   qinv       - pointer to inverse of second modulus
+     * @param [in]   mod        - pointer to mult of first and second modulus
+     * @param [in]   size       - size of modulus
+     * @param [out]  key        - the built key
+     *
+     * @return Status Error code
+     */
+    static Status createPrivateKey(const Uint8*                        dp,
+                                   const Uint8*                        dq,
+                                   const Uint8*                        p,
+                                   const Uint8*                        q,
+                                   const Uint8*                        qinv,
+                                   const Uint8*                        mod,
+                                   const Uint64                        size,
+                                   std::shared_ptr<RsaPrivateKeyData>& key);
+
+    /**
+     * @brief Generates a new key pair, the primes are found by a small prime
+     * sieve followed by Miller-Rabin rounds on the Montgomery kernels.
+     * Only key sizes of 2048 bits and more are generated
+     *
+     * @param [in]  exponent    odd public exponent, at least 3
+     * @param [out] pub         the public key
+     * @param [out] priv        the private key
+     *
+     * @return Status Error code
+     */
+    static Status generateKey(const Uint64                        exponent,
+                              std::shared_ptr<RsaPublicKeyData>&  pub,
+                              std::shared_ptr<RsaPrivateKeyData>& priv);
+
+    /**
+     * @brief Function sets keys built by createPublicKey and
+     * createPrivateKey, either may be null. Replaces the keys set before
+     *
+     * @param [in]  pub         public key
+     * @param [in]  priv        private key
+     *
+     * @return Status Error code
+     */
+    Status setKey(std::shared_ptr<RsaPublicKeyData>  pub,
+                  std::shared_ptr<RsaPrivateKeyData> priv);
+
     /**
      * @brief Function returns the private key size
      *
@@ -181,21 +444,53 @@ class ALCP_API_EXPORT Rsa
     void reset();
 
   private:
+    Status encodePkcs1v15(const Uint8* pText, Uint64 textSize, Uint8* pEncoded);
+
+    // valid tells if the opened signature pEncoded matches the message, the
+    // returned status only reports a bad configuration
+    Status checkPkcs1v15(const Uint8* pText,
+                         Uint64       textSize,
+                         const Uint8* pEncoded,
+                         bool&        valid);
+
+    Status checkPss(const Uint8* pText,
+                    Uint64       textSize,
+                    const Uint8* pEncoded,
+                    bool&        valid);
+
+    // up to RsaBatchSize signatures, pValid is cleared for the ones that are
+    // out of range and those are skipped
+    static Status openSignatureBatch(Rsa* const         pRsa[],
+                                     const Uint8* const pSignText[],
+                                     Uint8* const       pEncoded[],
+                                     bool               pValid[],
+                                     Uint64             num);
+
+    static Status checkBatchArgs(Rsa* const         pRsa[],
+                                 const Uint8* const pText[],
+                                 const Uint64       textSize[],
+                                 const Uint8* const pSignText[],
+                                 bool               pValid[],
+                                 Uint64             num);
+
+    Status encodePss(const Uint8* pText,
+                     Uint64       textSize,
+                     const Uint8* salt,
+                     Uint64       saltSize,
+                     Uint8*       pEncoded);
+
     void maskGenFunct(Uint8*       mask,
                       Uint64       maskSize,
                       const Uint8* input,
                       Uint64       inputLen);
 
-    Uint64              m_key_size;
-    Uint64              m_hash_len;
-    Uint64              m_mgf_hash_len;
-    RsaPrivateKeyBignum m_priv_key;
-    RsaPublicKeyBignum  m_pub_key;
-    MontContextBignum   m_context_pub;
-    MontContextBignum   m_context_p;
-    MontContextBignum   m_context_q;
-    digest::IDigest*    m_digest = nullptr;
-    digest::IDigest*    m_mgf    = nullptr;
+    Uint64                             m_key_size;
+    Uint64                             m_hash_len;
+    Uint64                             m_mgf_hash_len;
+    std::shared_ptr<RsaPrivateKeyData> m_priv;
+    std::shared_ptr<RsaPublicKeyData>  m_pub;
+    digest::IDigest*                   m_digest = nullptr;
+    digest::IDigest*                   m_mgf    = nullptr;
 };
 
 } // namespace alcp::rsa
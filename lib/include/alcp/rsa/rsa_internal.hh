@@ -32,6 +32,9 @@
 
 namespace alcp::rsa {
 
+// private key operations run side by side by the batch kernels
+static const Uint64 RsaBatchSize = 8;
+
 struct RsaPublicKeyBignum
 {
     Uint64                    m_public_exponent = 0;
@@ -62,6 +65,27 @@ struct MontContextBignum
     Uint64                    m_size = 0;
 };
 
+/*
+ * Key material with its Montgomery contexts. It is filled once when the key
+ * is set and only read afterwards, so Rsa objects hold it through a
+ * shared_ptr and every object set to the same key uses one copy of it.
+ */
+struct RsaPublicKeyData
+{
+    RsaPublicKeyBignum m_key;
+    MontContextBignum  m_context;
+};
+
+struct RsaPrivateKeyData
+{
+    RsaPrivateKeyBignum m_key;
+    MontContextBignum   m_context_p;
+    MontContextBignum   m_context_q;
+
+    // wipes the secrets once the last user of the key is gone
+    ~RsaPrivateKeyData();
+};
+
 static inline Uint64*
 CreateBigNum(const Uint8* bytes, Uint64 size)
 {
@@ -86,6 +110,16 @@ CreateBigNum(const Uint8* bytes, Uint64 size)
     return res_buffer_bignum;
 }
 
+// inverse of CreateBigNum, writes num as size big endian bytes
+static inline void
+BigNumToBytes(Uint8* bytes, const Uint64* num, Uint64 size)
+{
+    auto p_num = reinterpret_cast<const Uint8*>(num);
+    for (Int64 i = size - 1, j = 0; i >= 0; --i, ++j) {
+        bytes[j] = p_num[i];
+    }
+}
+
 static inline bool
 IsLess(Uint64* inp1, Uint64* inp2, Uint64 size)
 {
@@ -49,4 +49,18 @@ namespace alcp::rsa { namespace zen {
                            Uint64*            mod,
                            Uint64             size);
 
+    // prime search of key generation, on T / 2 bit numbers
+    template<alc_rsa_key_size T>
+    bool archMillerRabin(Uint64*            pCandidate,
+                         MontContextBignum& context,
+                         const Uint64*      pBases,
+                         Uint64             rounds);
+
+    template<alc_rsa_key_size T>
+    void archModExpHalf(Uint64*            pRes,
+                        const Uint64*      pBase,
+                        Uint64*            pExp,
+                        Uint64*            pMod,
+                        MontContextBignum& context);
+
 }} // namespace alcp::rsa::zen
@@ -43,9 +43,41 @@ namespace alcp::rsa { namespace zen4 {
                             MontContextBignum&   contextP,
                             MontContextBignum&   contextQ);
 
+    // runs up to RsaBatchSize private key operations, one per IFMA lane
+    template<alc_rsa_key_size T>
+    void archDecryptPrivateBatch(Uint8* const         pText[],
+                                 const Uint64* const  pEncTextBigNum[],
+                                 Uint64               num,
+                                 RsaPrivateKeyBignum& privKey,
+                                 MontContextBignum&   contextP,
+                                 MontContextBignum&   contextQ);
+
+    // runs up to RsaBatchSize public key operations, one per IFMA lane, the
+    // lanes may use different keys of the same size
+    template<alc_rsa_key_size T>
+    void archEncryptPublicBatch(Uint8* const              pEncText[],
+                                const Uint64* const       pTextBigNum[],
+                                Uint64                    num,
+                                RsaPublicKeyBignum* const pubKey[],
+                                MontContextBignum* const  context[]);
+
     // todo remove the size param.
     template<alc_rsa_key_size T>
     void archCreateContext(MontContextBignum& context,
                            Uint64*            mod,
                            Uint64             size);
+
+    // prime search of key generation, on T / 2 bit numbers
+    template<alc_rsa_key_size T>
+    bool archMillerRabin(Uint64*            pCandidate,
+                         MontContextBignum& context,
+                         const Uint64*      pBases,
+                         Uint64             rounds);
+
+    template<alc_rsa_key_size T>
+    void archModExpHalf(Uint64*            pRes,
+                        const Uint64*      pBase,
+                        Uint64*            pExp,
+                        Uint64*            pMod,
+                        MontContextBignum& context);
 }} // namespace alcp::rsa::zen4
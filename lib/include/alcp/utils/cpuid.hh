@@ -48,6 +48,8 @@ typedef enum
     AVX512_DQ = 1,
     AVX512_F,
     AVX512_BW,
+    AVX512_VL,
+    AVX512_IFMA,
 } avx512_flags_t;
 
 // using alci::Cpu;
@@ -80,6 +82,20 @@ class ALCP_API_EXPORT CpuId
      * @return false
      */
     static bool cpuHasAvx512bw();
+    /**
+     * @brief Returns true if CPU has AVX512VL Flag
+     *
+     * @return true
+     * @return false
+     */
+    static bool cpuHasAvx512vl();
+    /**
+     * @brief Returns true if CPU has AVX512IFMA Flag
+     *
+     * @return true
+     * @return false
+     */
+    static bool cpuHasAvx512ifma();
     /**
      * @brief Returns true depending on the flag is available or not on CPU
      *
@@ -80,9 +80,37 @@ class Hmac::Impl
      * */
     alignas(16) Uint8 m_pK0[cMaxInternalBlockLength]{};
 
+    /**
+     * Digest states right after absorbing K0^ipad and K0^opad. reset() and
+     * finalize() restore these instead of compressing the key blocks again
+     */
+    std::unique_ptr<digest::IDigest> m_pInnerState;
+    std::unique_ptr<digest::IDigest> m_pOuterState;
+
   public:
     Impl() = default;
 
+    Impl(const Impl& rSrc, digest::IDigest* pDigest)
+        : m_pKey{ rSrc.m_pKey }
+        , m_keylen{ rSrc.m_keylen }
+        , m_k0_length{ rSrc.m_k0_length }
+        , m_input_block_length{ rSrc.m_input_block_length }
+        , m_output_hash_size{ rSrc.m_output_hash_size }
+        , m_finalized{ rSrc.m_finalized }
+        , m_pDigest{ pDigest }
+    {
+        utils::CopyBytes(m_pTempHash, rSrc.m_pTempHash, cMaxHashSize);
+        utils::CopyBytes(
+            m_pK0_xor_opad, rSrc.m_pK0_xor_opad, cMaxInternalBlockLength);
+        utils::CopyBytes(
+            m_pK0_xor_ipad, rSrc.m_pK0_xor_ipad, cMaxInternalBlockLength);
+        utils::CopyBytes(m_pK0, rSrc.m_pK0, cMaxInternalBlockLength);
+        if (rSrc.m_pInnerState) {
+            m_pInnerState.reset(rSrc.m_pInnerState->clone());
+            m_pOuterState.reset(rSrc.m_pOuterState->clone());
+        }
+    }
+
   public:
     Uint64 getHashSize() { return m_output_hash_size; }
 
@@ -119,7 +147,7 @@ class Hmac::Impl
         if (m_pDigest == nullptr) {
             return EmptyHMACDigestError("");
         }
-        if (m_pKey == nullptr) {
+        if (m_pKey == nullptr || m_pOuterState == nullptr) {
             return EmptyKeyError("");
         }
 
@@ -140,9 +168,7 @@ class Hmac::Impl
         if (alcp_is_error(err)) {
             return HMACDigestOperationError("");
         }
-        m_pDigest->reset();
-
-        err = m_pDigest->update(m_pK0_xor_opad, m_k0_length);
+        err = m_pDigest->copyState(*m_pOuterState);
         if (alcp_is_error(err)) {
             return HMACDigestOperationError("");
         }
@@ -179,9 +205,10 @@ class Hmac::Impl
     Status reset()
     {
         Status status = StatusOk();
-        m_pDigest->reset();
-        alc_error_t err =
-            m_pDigest->update(m_pK0_xor_ipad, m_input_block_length);
+        if (m_pInnerState == nullptr) {
+            return EmptyKeyError("");
+        }
+        alc_error_t err = m_pDigest->copyState(*m_pInnerState);
         if (alcp_is_error(err)) {
             return HMACDigestOperationError("");
         }
@@ -217,11 +244,14 @@ class Hmac::Impl
             return status;
         }
         getK0XorPad();
-        alc_error_t err =
-            m_pDigest->update(m_pK0_xor_ipad, m_input_block_length);
-        if (alcp_is_error(err)) {
-            return HMACDigestOperationError("");
+
+        /* The two key blocks are compressed once per key, every message
+        starts from copies of the resulting states */
+        status = saveKeyState(m_pOuterState, m_pK0_xor_opad);
+        if (!status.ok()) {
+            return status;
         }
+        status = saveKeyState(m_pInnerState, m_pK0_xor_ipad);
         if (!status.ok()) {
             return status;
         }
@@ -233,6 +263,9 @@ class Hmac::Impl
         Status status = StatusOk();
         m_pDigest     = &p_digest;
         m_pDigest->reset();
+        // Key states of a previous digest cannot be restored into this one
+        m_pInnerState.reset();
+        m_pOuterState.reset();
 
         m_input_block_length = m_pDigest->getInputBlockSize();
         m_output_hash_size   = m_pDigest->getHashSize();
@@ -241,6 +274,26 @@ class Hmac::Impl
     }
 
   private:
+    /* Leaves m_pDigest with only pKeyBlock absorbed and keeps a copy of it */
+    Status saveKeyState(std::unique_ptr<digest::IDigest>& rState,
+                        const Uint8*                      pKeyBlock)
+    {
+        m_pDigest->reset();
+        alc_error_t err = m_pDigest->update(pKeyBlock, m_input_block_length);
+        if (alcp_is_error(err)) {
+            return HMACDigestOperationError("");
+        }
+        if (rState) {
+            err = rState->copyState(*m_pDigest);
+        } else {
+            rState.reset(m_pDigest->clone());
+        }
+        if (alcp_is_error(err)) {
+            return HMACDigestOperationError("");
+        }
+        return StatusOk();
+    }
+
     void getK0XorPad()
     {
         if (CpuId::cpuHasAvx2()) {
@@ -320,6 +373,10 @@ class Hmac::Impl
 Hmac::Hmac()
     : m_pImpl{ std::make_unique<Hmac::Impl>() }
 {}
+Hmac::Hmac(const Hmac& rSrc, digest::Digest& rDigest)
+    : m_pImpl{ std::make_unique<Hmac::Impl>(*rSrc.m_pImpl, &rDigest) }
+{}
+
 Hmac::~Hmac() {}
 
 Status
@@ -27,46 +27,82 @@
  */
 
 #include <algorithm>
-#include <array>
-#include <iostream>
-#include <tuple>
-
-#include <openssl/bio.h>
-#include <openssl/bn.h>
+#include <cstring>
 
 #include "alcp/base.hh"
 #include "alcp/mac/poly1305.hh"
 
-// #define DEBUG
-
 namespace alcp::mac::poly1305 {
+using utils::CpuId;
 
-#ifdef DEBUG
-void
-debug_dump(std::string str, BIGNUM* z)
+typedef unsigned Uint128 __attribute__((mode(TI)));
+
+static inline Uint64
+LoadLe64(const Uint8* p)
 {
-    std::cout << str << "\t";
-    BN_print_fp(stdout, z);
-    std::cout << std::endl;
+    Uint64 v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void
+StoreLe64(Uint8* p, Uint64 v)
+{
+    std::memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * @brief h = (h * r) mod 2^130-5 in radix 2^44, result is partially reduced
+ */
+static inline void
+MulModP(Uint64 h[3], const Uint64 r[3])
+{
+    // 2^132 = 4 * 2^130 = 20 mod p
+    const Uint64 s1 = r[1] * 20;
+    const Uint64 s2 = r[2] * 20;
+    Uint128      d0, d1, d2;
+    Uint64       c;
+
+    d0 = (Uint128)h[0] * r[0] + (Uint128)h[1] * s2 + (Uint128)h[2] * s1;
+    d1 = (Uint128)h[0] * r[1] + (Uint128)h[1] * r[0] + (Uint128)h[2] * s2;
+    d2 = (Uint128)h[0] * r[2] + (Uint128)h[1] * r[1] + (Uint128)h[2] * r[0];
+
+    c    = (Uint64)(d0 >> 44);
+    h[0] = (Uint64)d0 & cMask44;
+    d1 += c;
+    c    = (Uint64)(d1 >> 44);
+    h[1] = (Uint64)d1 & cMask44;
+    d2 += c;
+    c    = (Uint64)(d2 >> 42);
+    h[2] = (Uint64)d2 & cMask42;
+    h[0] += c * 5;
+    c = h[0] >> 44;
+    h[0] &= cMask44;
+    h[1] += c;
 }
-#else
-void
-debug_dump(std::string str, BIGNUM* z)
-{}
-#endif
 
+template<CpuCipherFeatures cpu_cipher_feature>
 void
-Poly1305::clamp(Uint8 in[16])
+Poly1305<cpu_cipher_feature>::blocks(const Uint8 pMsg[],
+                                     Uint64      msgLen,
+                                     Uint64      padBit)
 {
-    constexpr std::array<std::tuple<int, int>, 7> index = {
-        std::tuple<int, int>({ 3, 15 }),  std::tuple<int, int>({ 7, 15 }),
-        std::tuple<int, int>({ 11, 15 }), std::tuple<int, int>({ 15, 15 }),
-        std::tuple<int, int>({ 4, 252 }), std::tuple<int, int>({ 8, 252 }),
-        std::tuple<int, int>({ 12, 252 })
-    };
-
-    for (const auto& i : index) {
-        in[15 - std::get<0>(i)] &= std::get<1>(i);
+    const Uint64 hibit = padBit << 40;
+    Uint64*      h     = m_state.m_acc;
+
+    while (msgLen >= 16) {
+        Uint64 t0 = LoadLe64(pMsg);
+        Uint64 t1 = LoadLe64(pMsg + 8);
+
+        // h += m
+        h[0] += t0 & cMask44;
+        h[1] += ((t0 >> 44) | (t1 << 20)) & cMask44;
+        h[2] += ((t1 >> 24) & cMask42) | hibit;
+        // h = (h * r) % p
+        MulModP(h, m_state.m_r);
+
+        pMsg += 16;
+        msgLen -= 16;
     }
 }
 
@@ -76,8 +112,9 @@ Poly1305::clamp(Uint8 in[16])
  * @param len - Key Length 256 Bits, anything else wont work
  * @return Status
  */
+template<CpuCipherFeatures cpu_cipher_feature>
 Status
-Poly1305::setKey(const Uint8 key[], Uint64 len)
+Poly1305<cpu_cipher_feature>::setKey(const Uint8 key[], Uint64 len)
 {
     Status s = StatusOk();
     if (m_finalized) {
@@ -90,89 +127,79 @@ Poly1305::setKey(const Uint8 key[], Uint64 len)
         return s;
     }
 
-    // Reverse bytes to make it a big number represntation
-    std::reverse_copy(key, key + 16, m_key);
-    std::reverse_copy(key + 16, key + 32, m_key + 16);
-    clamp(m_key); // Clamp to ploynomial
-
-    // Continue with initialization
-
-    if (m_r_bn != nullptr) {
-        BN_free(m_r_bn);
-        m_r_bn = nullptr;
-    }
-    // r = k[0..16];
-    m_r_bn = BN_bin2bn(m_key, 16, m_r_bn);
-
-    debug_dump("R KE2:", m_r_bn);
-    if (m_s_bn != nullptr) {
-        BN_free(m_s_bn);
-        m_s_bn = nullptr;
-    }
-    // s = k[17..32];
-    m_s_bn = BN_bin2bn(m_key + 16, 16, m_s_bn);
-
-    if (m_a_bn != nullptr) {
-        BN_free(m_a_bn);
-        m_a_bn = nullptr;
-    }
-    // a = 0;
-    m_a_bn = BN_bin2bn(m_accumulator, 16, m_a_bn);
-
-    debug_dump("A CRT:", m_a_bn);
-    if (m_p_bn != nullptr) {
-        BN_free(m_p_bn);
-        m_p_bn = nullptr;
-    }
-    // p = (1<<130)-5
-    m_p_bn = BN_bin2bn(m_p, sizeof(m_p), m_p_bn);
-
-    debug_dump("P SHL:", m_p_bn);
-    if (m_bn_temp_ctx != nullptr) {
-        BN_CTX_free(m_bn_temp_ctx);
-        m_bn_temp_ctx = nullptr;
+    Uint64 t0 = LoadLe64(key);
+    Uint64 t1 = LoadLe64(key + 8);
+
+    // r = k[0..16], clamped to the polynomial
+    m_state.m_r[0] = t0 & 0xffc0fffffffULL;
+    m_state.m_r[1] = ((t0 >> 44) | (t1 << 20)) & 0xfffffc0ffffULL;
+    m_state.m_r[2] = (t1 >> 24) & 0x00ffffffc0fULL;
+
+    // s = k[16..32]
+    m_state.m_s[0] = LoadLe64(key + 16);
+    m_state.m_s[1] = LoadLe64(key + 24);
+
+    // r^1 .. r^8 for the multi-block kernels
+    Uint64 pw[3] = { m_state.m_r[0], m_state.m_r[1], m_state.m_r[2] };
+    for (int i = 0; i < 8; i++) {
+        Uint64 limbs[5];
+        Radix44Carry(pw);
+        Radix44ToRadix26(pw, limbs);
+        for (int j = 0; j < 5; j++) {
+            m_state.m_r_pow26[i][j] = static_cast<Uint32>(limbs[j]);
+        }
+        MulModP(pw, m_state.m_r);
     }
 
-    // Create a temporary BigNumber context
-    m_bn_temp_ctx = BN_CTX_new();
+    // a = 0
+    std::fill(m_state.m_acc, m_state.m_acc + 3, 0);
+    m_msg_buffer_len = 0;
 
     return s;
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 Status
-Poly1305::blk(const Uint8 pMsg[], Uint64 msgLen)
+Poly1305<cpu_cipher_feature>::blk(const Uint8 pMsg[], Uint64 msgLen)
 {
-    Status       s           = StatusOk();
-    const Uint8* msg_ptr_cpy = pMsg;
-    BIGNUM*      n           = BN_new();
-    for (Uint64 i = 0; i < ((msgLen + (16 - 1)) / 16); i++) {
-        Uint8 n_buff[17] = {};
-
-        // Find if we are in the last block, if we are, then only do left bytes
-        Uint64 curr_blocklen = msgLen < ((i + 1) * 16) ? msgLen - ((i)*16) : 16;
-#ifdef DEBUG
-        std::cout << "Current Block Length:" << curr_blocklen << std::endl;
-#endif
-        std::reverse_copy(msg_ptr_cpy, msg_ptr_cpy + curr_blocklen, n_buff + 1);
-        n_buff[0] = 0x01;
-        n         = BN_bin2bn(n_buff, curr_blocklen + 1, n);
-        debug_dump("N BLK:", n);
-
-        // We select the next block
-        msg_ptr_cpy += curr_blocklen;
-        // a+=n
-        BN_add(m_a_bn, m_a_bn, n);
-        debug_dump("A ADD:", m_a_bn);
-        // a = (a * r) % p
-        BN_mod_mul(m_a_bn, m_a_bn, m_r_bn, m_p_bn, m_bn_temp_ctx);
-        debug_dump("A END:", m_a_bn);
+    Status s         = StatusOk();
+    Uint64 full      = msgLen & ~static_cast<Uint64>(15);
+    Uint64 processed = 0;
+
+    if constexpr (cpu_cipher_feature == CpuCipherFeatures::eVaes512) {
+        processed = zen4::Poly1305Blocks(m_state, pMsg, full);
+        processed += avx2::Poly1305Blocks(
+            m_state, pMsg + processed, full - processed);
+    } else if constexpr (cpu_cipher_feature == CpuCipherFeatures::eVaes256) {
+        processed = avx2::Poly1305Blocks(m_state, pMsg, full);
+    } else if constexpr (cpu_cipher_feature == CpuCipherFeatures::eDynamic) {
+        static bool is_avx512 = CpuId::cpuHasAvx512(utils::AVX512_F);
+        static bool is_avx2   = CpuId::cpuHasAvx2();
+        if (is_avx512) {
+            processed = zen4::Poly1305Blocks(m_state, pMsg, full);
+        }
+        if (is_avx2) {
+            processed += avx2::Poly1305Blocks(
+                m_state, pMsg + processed, full - processed);
+        }
+    }
+
+    // Leftover blocks which are too few for the vector kernels
+    blocks(pMsg + processed, full - processed, 1);
+
+    // Last block is padded with 0x01 followed by zeros
+    if (msgLen != full) {
+        Uint8 n_buff[16] = {};
+        std::copy(pMsg + full, pMsg + msgLen, n_buff);
+        n_buff[msgLen - full] = 0x01;
+        blocks(n_buff, 16, 0);
     }
-    BN_free(n);
     return s;
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 Status
-Poly1305::update(const Uint8 pMsg[], Uint64 msgLen)
+Poly1305<cpu_cipher_feature>::update(const Uint8 pMsg[], Uint64 msgLen)
 {
     Status s = StatusOk();
     if (pMsg == nullptr || msgLen == 0) {
@@ -217,20 +244,22 @@ Poly1305::update(const Uint8 pMsg[], Uint64 msgLen)
     return s;
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 Status
-Poly1305::reset()
+Poly1305<cpu_cipher_feature>::reset()
 {
     Status s = StatusOk();
-    std::fill(m_accumulator, m_accumulator + 18, 0);
     // Wipe the accumulator
-    m_a_bn           = BN_bin2bn(m_accumulator, 16, m_a_bn);
+    std::fill(m_state.m_acc, m_state.m_acc + 3, 0);
+    std::fill(m_mac, m_mac + sizeof(m_mac), 0);
     m_msg_buffer_len = 0;
     m_finalized      = false;
     return s;
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 Status
-Poly1305::finalize(const Uint8 pMsg[], Uint64 msgLen)
+Poly1305<cpu_cipher_feature>::finalize(const Uint8 pMsg[], Uint64 msgLen)
 {
     Status s = StatusOk();
     if (m_finalized) {
@@ -242,46 +271,58 @@ Poly1305::finalize(const Uint8 pMsg[], Uint64 msgLen)
         return s;
     }
     blk(m_msg_buffer, m_msg_buffer_len);
+    m_msg_buffer_len = 0;
+
+    Uint64 h[3] = { m_state.m_acc[0], m_state.m_acc[1], m_state.m_acc[2] };
+    Uint64 g[3], c, mask;
+    Radix44Carry(h);
+
+    // g = h + -p, select g if h >= p
+    g[0] = h[0] + 5;
+    c    = g[0] >> 44;
+    g[0] &= cMask44;
+    g[1] = h[1] + c;
+    c    = g[1] >> 44;
+    g[1] &= cMask44;
+    g[2] = h[2] + c - (1ULL << 42);
+
+    mask = (g[2] >> 63) - 1;
+    for (int i = 0; i < 3; i++) {
+        h[i] = (h[i] & ~mask) | (g[i] & mask);
+    }
+
+    // a += s
+    Uint64 t0 = m_state.m_s[0];
+    Uint64 t1 = m_state.m_s[1];
+    h[0] += t0 & cMask44;
+    c = h[0] >> 44;
+    h[0] &= cMask44;
+    h[1] += (((t0 >> 44) | (t1 << 20)) & cMask44) + c;
+    c = h[1] >> 44;
+    h[1] &= cMask44;
+    h[2] += ((t1 >> 24) & cMask42) + c;
+    h[2] &= cMask42;
+
+    StoreLe64(m_mac, h[0] | (h[1] << 44));
+    StoreLe64(m_mac + 8, (h[1] >> 20) | (h[2] << 24));
 
-    // a+=s;
-    BN_add(m_a_bn, m_a_bn, m_s_bn);
-    debug_dump("A FIN:", m_a_bn);
-    BN_bn2bin(m_a_bn, m_accumulator);
     m_finalized = true;
     return s;
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 void
-Poly1305::finish()
+Poly1305<cpu_cipher_feature>::finish()
 {
-    if (m_key_bn != nullptr) {
-        BN_free(m_key_bn);
-        m_key_bn = nullptr;
-    }
-    if (m_a_bn != nullptr) {
-        BN_free(m_a_bn);
-        m_a_bn = nullptr;
-    }
-    if (m_r_bn != nullptr) {
-        BN_free(m_r_bn);
-        m_r_bn = nullptr;
-    }
-    if (m_s_bn != nullptr) {
-        BN_free(m_s_bn);
-        m_s_bn = nullptr;
-    }
-    if (m_p_bn != nullptr) {
-        BN_free(m_p_bn);
-        m_p_bn = nullptr;
-    }
-    if (m_bn_temp_ctx) {
-        BN_CTX_free(m_bn_temp_ctx);
-        m_bn_temp_ctx = nullptr;
-    }
+    m_state = Poly1305State{};
+    std::fill(m_msg_buffer, m_msg_buffer + sizeof(m_msg_buffer), 0);
+    std::fill(m_mac, m_mac + sizeof(m_mac), 0);
+    m_msg_buffer_len = 0;
 }
 
+template<CpuCipherFeatures cpu_cipher_feature>
 Status
-Poly1305::copy(Uint8 digest[], Uint64 length)
+Poly1305<cpu_cipher_feature>::copy(Uint8 digest[], Uint64 length)
 {
     Status s = StatusOk();
     if (!m_finalized) {
@@ -293,42 +334,20 @@ Poly1305::copy(Uint8 digest[], Uint64 length)
         return s;
     }
 
-    int offset = 0;
-    if (BN_num_bytes(m_a_bn) > static_cast<int>(length)) {
-        offset = BN_num_bytes(m_a_bn) - static_cast<int>(length);
-    }
-    std::reverse_copy(
-        m_accumulator + offset, m_accumulator + BN_num_bytes(m_a_bn), digest);
+    std::copy(m_mac, m_mac + sizeof(m_mac), digest);
 
     return s;
 }
 
-Poly1305::~Poly1305()
+template<CpuCipherFeatures cpu_cipher_feature>
+Poly1305<cpu_cipher_feature>::~Poly1305()
 {
-    if (m_key_bn != nullptr) {
-        BN_free(m_key_bn);
-        m_key_bn = nullptr;
-    }
-    if (m_a_bn != nullptr) {
-        BN_free(m_a_bn);
-        m_a_bn = nullptr;
-    }
-    if (m_r_bn != nullptr) {
-        BN_free(m_r_bn);
-        m_r_bn = nullptr;
-    }
-    if (m_s_bn != nullptr) {
-        BN_free(m_s_bn);
-        m_s_bn = nullptr;
-    }
-    if (m_p_bn != nullptr) {
-        BN_free(m_p_bn);
-        m_p_bn = nullptr;
-    }
-    if (m_bn_temp_ctx) {
-        BN_CTX_free(m_bn_temp_ctx);
-        m_bn_temp_ctx = nullptr;
-    }
+    finish();
 }
 
+template class Poly1305<CpuCipherFeatures::eReference>;
+template class Poly1305<CpuCipherFeatures::eVaes256>;
+template class Poly1305<CpuCipherFeatures::eVaes512>;
+template class Poly1305<CpuCipherFeatures::eDynamic>;
+
 } // namespace alcp::mac::poly1305
@@ -605,6 +605,53 @@ TEST(HmacTest, setKeyAfterFinalize)
     hmac.finish();
 }
 
+TEST(HmacTest, CopyKeyedHmac)
+{
+    auto        pos  = KAT_ShaDataset.find("SHA2_512_KEYLEN_GT_B");
+    param_tuple data = pos->second;
+
+    auto key         = parseHexStrToBin(std::get<0>(data));
+    auto cipher_text = parseHexStrToBin(std::get<1>(data));
+    auto output_mac  = parseHexStrToBin(std::get<2>(data));
+
+    auto block1 = std::vector<Uint8>(
+        cipher_text.begin(), cipher_text.begin() + cipher_text.size() / 2);
+
+    auto block2 = std::vector<Uint8>(
+        cipher_text.begin() + cipher_text.size() / 2, cipher_text.end());
+
+    Sha512 sha512;
+    Hmac   hmac;
+    hmac.setDigest(sha512);
+    hmac.setKey(&key[0], key.size());
+
+    // Every copy of the keyed HMAC authenticates a message of its own
+    for (int i = 0; i < 2; i++) {
+        Sha512 sha512_copy(sha512);
+        Hmac   hmac_copy(hmac, sha512_copy);
+        hmac_copy.update(&cipher_text[0], cipher_text.size());
+        hmac_copy.finalize(nullptr, 0);
+        auto mac = std::vector<Uint8>(hmac_copy.getHashSize(), 0);
+        hmac_copy.copyHash(&mac.at(0), mac.size());
+        EXPECT_EQ(mac, output_mac);
+    }
+
+    // Copy taken mid-message, the original is left untouched
+    hmac.update(&block1[0], block1.size());
+    Sha512 sha512_copy(sha512);
+    Hmac   hmac_copy(hmac, sha512_copy);
+    hmac_copy.finalize(&block2[0], block2.size());
+    hmac.finalize(&block2[0], block2.size());
+
+    auto mac      = std::vector<Uint8>(hmac.getHashSize(), 0);
+    auto mac_copy = std::vector<Uint8>(hmac.getHashSize(), 0);
+    hmac.copyHash(&mac.at(0), mac.size());
+    hmac_copy.copyHash(&mac_copy.at(0), mac_copy.size());
+    EXPECT_EQ(mac, output_mac);
+    EXPECT_EQ(mac_copy, output_mac);
+    hmac.finish();
+}
+
 TEST(HmacRobustnessTest, callUpdateWithNullKeyNullDigest)
 {
 
@@ -52,6 +52,24 @@ parseBytesToHexStr(const Uint8* bytes, const int length)
 }
 
 using alcp::mac::poly1305::Poly1305;
+using alcp::utils::CpuCipherFeatures;
+using alcp::utils::CpuId;
+
+// MAC of msg, fed to the given instantiation chunk bytes at a time
+template<CpuCipherFeatures cpu_cipher_feature>
+static std::vector<Uint8>
+poly1305Mac(const Uint8* key, const std::vector<Uint8>& msg, Uint64 chunk)
+{
+    alcp::mac::poly1305::Poly1305<cpu_cipher_feature> poly;
+    std::vector<Uint8>                                mac(16);
+    poly.setKey(key, 256);
+    for (Uint64 i = 0; i < msg.size(); i += chunk) {
+        poly.update(&msg[i], std::min<Uint64>(chunk, msg.size() - i));
+    }
+    poly.finalize(nullptr, 0);
+    poly.copy(&mac[0], 16);
+    return mac;
+}
 
 TEST(POLY1305, INIT_TEST)
 {
@@ -313,4 +331,75 @@ TEST(POLY1305, BLK_ALL_UPDATE_COPY)
     // poly.mac(blk, key, sizeof(blk), &mac.at(0));
 
     ASSERT_NE(mac, out);
-}
\ No newline at end of file
+}
+
+TEST(POLY1305, MULTI_BLOCK_KAT)
+{
+    Uint8 key[32];
+    for (int i = 0; i < 32; i++) {
+        key[i] = static_cast<Uint8>(i);
+    }
+    std::vector<Uint8> msg(1000);
+    for (size_t i = 0; i < msg.size(); i++) {
+        msg[i] = static_cast<Uint8>(i * 7 + 3);
+    }
+    std::vector<Uint8> out = { 0xb7, 0x4c, 0xe6, 0x6f, 0x76, 0xa2, 0x56, 0x6f,
+                               0xb0, 0x05, 0x29, 0x67, 0xc1, 0x46, 0xde, 0x6d };
+
+    EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eReference>(key, msg, 1000), out);
+    EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eDynamic>(key, msg, 1000), out);
+    EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eDynamic>(key, msg, 77), out);
+    if (CpuId::cpuHasAvx2()) {
+        EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eVaes256>(key, msg, 1000),
+                  out);
+    }
+    if (CpuId::cpuHasAvx512(alcp::utils::AVX512_F)) {
+        EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eVaes512>(key, msg, 1000),
+                  out);
+    }
+}
+
+TEST(POLY1305, MULTI_BLOCK_MAX_LIMBS)
+{
+    // All ones key and message stress the lazy carries in the vector kernels
+    Uint8              key[32];
+    std::vector<Uint8> msg(1000, 0xff);
+    std::fill(key, key + 32, 0xff);
+    std::vector<Uint8> out = { 0xde, 0x94, 0x06, 0xb1, 0x0e, 0x70, 0x23, 0xbc,
+                               0xd6, 0x92, 0xff, 0x68, 0x7f, 0x4c, 0xbc, 0x7f };
+
+    EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eReference>(key, msg, 1000), out);
+    EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eDynamic>(key, msg, 1000), out);
+}
+
+TEST(POLY1305, MULTI_BLOCK_ALL_LENGTHS)
+{
+    Uint8 key[32];
+    for (int i = 0; i < 32; i++) {
+        key[i] = static_cast<Uint8>(0xa5 ^ (i * 13));
+    }
+    for (Uint64 len = 0; len <= 300; len++) {
+        std::vector<Uint8> msg(len);
+        for (Uint64 i = 0; i < len; i++) {
+            msg[i] = static_cast<Uint8>(i ^ len);
+        }
+        auto ref = poly1305Mac<CpuCipherFeatures::eReference>(
+            key, msg, std::max<Uint64>(len, 1));
+        EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eDynamic>(
+                      key, msg, std::max<Uint64>(len, 1)),
+                  ref)
+            << "Length " << len;
+        if (CpuId::cpuHasAvx2()) {
+            EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eVaes256>(
+                          key, msg, std::max<Uint64>(len, 1)),
+                      ref)
+                << "Length " << len;
+        }
+        if (CpuId::cpuHasAvx512(alcp::utils::AVX512_F)) {
+            EXPECT_EQ(poly1305Mac<CpuCipherFeatures::eVaes512>(
+                          key, msg, std::max<Uint64>(len, 1)),
+                      ref)
+                << "Length " << len;
+        }
+    }
+}
@@ -32,6 +32,8 @@
 #include "alcp/rsa.hh"
 #include "alcp/rsa/rsaerror.hh"
 
+#include <vector>
+
 namespace alcp::rsa {
 
 using Context = alcp::rsa::Context;
@@ -47,6 +49,30 @@ __rsa_encrBufWithPub_wrapper(void*        pRsaHandle,
     return ap->encryptPublic(pText, textSize, pEncText);
 }
 
+template<alc_rsa_key_size KEYSIZE>
+static std::vector<Rsa<KEYSIZE>*>
+__rsa_handles(void* const pRsaHandle[], Uint64 num)
+{
+    std::vector<Rsa<KEYSIZE>*> handles(num);
+    for (Uint64 i = 0; i < num; i++) {
+        handles[i] = static_cast<Rsa<KEYSIZE>*>(pRsaHandle[i]);
+    }
+    return handles;
+}
+
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_encrBatchWithPub_wrapper(void* const        pRsaHandle[],
+                               const Uint8* const pText[],
+                               Uint64             textSize,
+                               Uint8* const       pEncText[],
+                               Uint64             num)
+{
+    auto handles = __rsa_handles<KEYSIZE>(pRsaHandle, num);
+    return Rsa<KEYSIZE>::encryptPublicBatch(
+        handles.data(), pText, textSize, pEncText, num);
+}
+
 template<alc_rsa_key_size KEYSIZE>
 static Status
 __rsa_decrBufWithPriv_wrapper(void*        pRsaHandle,
@@ -58,6 +84,18 @@ __rsa_decrBufWithPriv_wrapper(void*        pRsaHandle,
     return ap->decryptPrivate(pEncText, encSize, pText);
 }
 
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_decrBatchWithPriv_wrapper(void*              pRsaHandle,
+                                const Uint8* const pEncText[],
+                                Uint64             encSize,
+                                Uint8* const       pText[],
+                                Uint64             num)
+{
+    auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
+    return ap->decryptPrivateBatch(pEncText, encSize, pText, num);
+}
+
 template<alc_rsa_key_size KEYSIZE>
 static Status
 __rsa_oaepEncrBufWithPub_wrapper(void*        pRsaHandle,
@@ -91,6 +129,111 @@ __rsa_oaepDecrBufWithPriv_wrapper(void*        pRsaHandle,
         pEncText, encSize, label, labelSize, pText, textSize);
 }
 
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_signPkcs1v15_wrapper(void*        pRsaHandle,
+                           bool         check,
+                           const Uint8* pText,
+                           Uint64       textSize,
+                           Uint8*       pSignText)
+{
+    auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
+    return ap->signPkcs1v15(check, pText, textSize, pSignText);
+}
+
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_signPkcs1v15Batch_wrapper(void*              pRsaHandle,
+                                bool               check,
+                                const Uint8* const pText[],
+                                const Uint64       textSize[],
+                                Uint8* const       pSignText[],
+                                Uint64             num)
+{
+    auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
+    return ap->signPkcs1v15Batch(check, pText, textSize, pSignText, num);
+}
+
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_verifyPkcs1v15_wrapper(void*        pRsaHandle,
+                             const Uint8* pText,
+                             Uint64       textSize,
+                             const Uint8* pSignText)
+{
+    auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
+    return ap->verifyPkcs1v15(pText, textSize, pSignText);
+}
+
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_verifyPkcs1v15Batch_wrapper(void* const        pRsaHandle[],
+                                  const Uint8* const pText[],
+                                  const Uint64       textSize[],
+                                  const Uint8* const pSignText[],
+                                  bool               pValid[],
+                                  Uint64             num)
+{
+    auto handles = __rsa_handles<KEYSIZE>(pRsaHandle, num);
+    return Rsa<KEYSIZE>::verifyPkcs1v15Batch(
+        handles.data(), pText, textSize, pSignText, pValid, num);
+}
+
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_signPss_wrapper(void*        pRsaHandle,
+                      bool         check,
+                      const Uint8* pText,
+                      Uint64       textSize,
+                      const Uint8* salt,
+                      Uint64       saltSize,
+                      Uint8*       pSignText)
+{
+    auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
+    return ap->signPss(check, pText, textSize, salt, saltSize, pSignText);
+}
+
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_signPssBatch_wrapper(void*              pRsaHandle,
+                           bool               check,
+                           const Uint8* const pText[],
+                           const Uint64       textSize[],
+                           const Uint8* const salt[],
+                           Uint64             saltSize,
+                           Uint8* const       pSignText[],
+                           Uint64             num)
+{
+    auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
+    return ap->signPssBatch(
+        check, pText, textSize, salt, saltSize, pSignText, num);
+}
+
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_verifyPss_wrapper(void*        pRsaHandle,
+                        const Uint8* pText,
+                        Uint64       textSize,
+                        const Uint8* pSignText)
+{
+    auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
+    return ap->verifyPss(pText, textSize, pSignText);
+}
+
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_verifyPssBatch_wrapper(void* const        pRsaHandle[],
+                             const Uint8* const pText[],
+                             const Uint64       textSize[],
+                             const Uint8* const pSignText[],
+                             bool               pValid[],
+                             Uint64             num)
+{
+    auto handles = __rsa_handles<KEYSIZE>(pRsaHandle, num);
+    return Rsa<KEYSIZE>::verifyPssBatch(
+        handles.data(), pText, textSize, pSignText, pValid, num);
+}
+
 template<alc_rsa_key_size KEYSIZE>
 static Uint64
 __rsa_getKeySize_wrapper(void* pRsaHandle)
@@ -138,13 +281,24 @@ __rsa_setPrivateKey_wrapper(void*        pRsaHandle,
     return ap->setPrivateKey(dp, dq, p, q, qinv, mod, size);
 }
 
+template<alc_rsa_key_size KEYSIZE>
+static Status
+__rsa_setKey_wrapper(void*                              pRsaHandle,
+                     std::shared_ptr<RsaPublicKeyData>  pub,
+                     std::shared_ptr<RsaPrivateKeyData> priv)
+{
+    auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
+
+    return ap->setKey(std::move(pub), std::move(priv));
+}
+
 template<alc_rsa_key_size KEYSIZE>
 static void
 __rsa_setDigest_wrapper(void* pRsaHandle, digest::IDigest* digest)
 {
     auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
 
-    ap->setDigestOaep(digest);
+    ap->setDigest(digest);
 }
 
 template<alc_rsa_key_size KEYSIZE>
@@ -153,7 +307,7 @@ __rsa_setMgf_wrapper(void* pRsaHandle, digest::IDigest* digest)
 {
     auto ap = static_cast<Rsa<KEYSIZE>*>(pRsaHandle);
 
-    ap->setMgfOaep(digest);
+    ap->setMgf(digest);
 }
 
 template<alc_rsa_key_size KEYSIZE>
@@ -183,19 +337,30 @@ __build_rsa(Context& ctx)
     auto addr = reinterpret_cast<Uint8*>(&ctx) + sizeof(ctx);
     auto algo = new (addr) Rsa<KEYSIZE>;
 
-    ctx.m_rsa                = static_cast<void*>(algo);
-    ctx.encryptPublicFn      = __rsa_encrBufWithPub_wrapper<KEYSIZE>;
-    ctx.decryptPrivateFn     = __rsa_decrBufWithPriv_wrapper<KEYSIZE>;
-    ctx.encryptPublicOaepFn  = __rsa_oaepEncrBufWithPub_wrapper<KEYSIZE>;
-    ctx.decryptPrivateOaepFn = __rsa_oaepDecrBufWithPriv_wrapper<KEYSIZE>;
-    ctx.getKeySize           = __rsa_getKeySize_wrapper<KEYSIZE>;
-    ctx.getPublickey         = __rsa_getPublicKey_wrapper<KEYSIZE>;
-    ctx.setPublicKey         = __rsa_setPublicKey_wrapper<KEYSIZE>;
-    ctx.setPrivateKey        = __rsa_setPrivateKey_wrapper<KEYSIZE>;
-    ctx.setDigest            = __rsa_setDigest_wrapper<KEYSIZE>;
-    ctx.setMgf               = __rsa_setMgf_wrapper<KEYSIZE>;
-    ctx.finish               = __rsa_dtor<KEYSIZE>;
-    ctx.reset                = __rsa_reset_wrapper<KEYSIZE>;
+    ctx.m_rsa                 = static_cast<void*>(algo);
+    ctx.encryptPublicFn       = __rsa_encrBufWithPub_wrapper<KEYSIZE>;
+    ctx.encryptPublicBatchFn  = __rsa_encrBatchWithPub_wrapper<KEYSIZE>;
+    ctx.decryptPrivateFn      = __rsa_decrBufWithPriv_wrapper<KEYSIZE>;
+    ctx.decryptPrivateBatchFn = __rsa_decrBatchWithPriv_wrapper<KEYSIZE>;
+    ctx.encryptPublicOaepFn   = __rsa_oaepEncrBufWithPub_wrapper<KEYSIZE>;
+    ctx.decryptPrivateOaepFn  = __rsa_oaepDecrBufWithPriv_wrapper<KEYSIZE>;
+    ctx.signPkcs1v15Fn        = __rsa_signPkcs1v15_wrapper<KEYSIZE>;
+    ctx.signPkcs1v15BatchFn   = __rsa_signPkcs1v15Batch_wrapper<KEYSIZE>;
+    ctx.verifyPkcs1v15Fn      = __rsa_verifyPkcs1v15_wrapper<KEYSIZE>;
+    ctx.verifyPkcs1v15BatchFn = __rsa_verifyPkcs1v15Batch_wrapper<KEYSIZE>;
+    ctx.signPssFn             = __rsa_signPss_wrapper<KEYSIZE>;
+    ctx.signPssBatchFn        = __rsa_signPssBatch_wrapper<KEYSIZE>;
+    ctx.verifyPssFn           = __rsa_verifyPss_wrapper<KEYSIZE>;
+    ctx.verifyPssBatchFn      = __rsa_verifyPssBatch_wrapper<KEYSIZE>;
+    ctx.getKeySize            = __rsa_getKeySize_wrapper<KEYSIZE>;
+    ctx.getPublickey          = __rsa_getPublicKey_wrapper<KEYSIZE>;
+    ctx.setPublicKey          = __rsa_setPublicKey_wrapper<KEYSIZE>;
+    ctx.setPrivateKey         = __rsa_setPrivateKey_wrapper<KEYSIZE>;
+    ctx.setKey                = __rsa_setKey_wrapper<KEYSIZE>;
+    ctx.setDigest             = __rsa_setDigest_wrapper<KEYSIZE>;
+    ctx.setMgf                = __rsa_setMgf_wrapper<KEYSIZE>;
+    ctx.finish                = __rsa_dtor<KEYSIZE>;
+    ctx.reset                 = __rsa_reset_wrapper<KEYSIZE>;
 
     return StatusOk();
 }
@@ -208,6 +373,10 @@ RsaBuilder::getSize(const alc_rsa_key_size keySize)
             return sizeof(Rsa<KEY_SIZE_1024>);
         case KEY_SIZE_2048:
             return sizeof(Rsa<KEY_SIZE_2048>);
+        case KEY_SIZE_3072:
+            return sizeof(Rsa<KEY_SIZE_3072>);
+        case KEY_SIZE_4096:
+            return sizeof(Rsa<KEY_SIZE_4096>);
         default:
             return 0;
     }
@@ -226,6 +395,10 @@ RsaBuilder::Build(const alc_rsa_key_size keySize, Context& rCtx)
         case KEY_SIZE_2048:
             return __build_rsa<KEY_SIZE_2048>(rCtx);
             // rCtx.m_rsa = new (addr) Rsa<2048>;
+        case KEY_SIZE_3072:
+            return __build_rsa<KEY_SIZE_3072>(rCtx);
+        case KEY_SIZE_4096:
+            return __build_rsa<KEY_SIZE_4096>(rCtx);
         default:
             return alcp::rsa::status::NotPermitted("Key size not supported");
     }
@@ -233,4 +406,76 @@ RsaBuilder::Build(const alc_rsa_key_size keySize, Context& rCtx)
     return status;
 }
 
+Status
+RsaBuilder::BuildPublicKey(alc_rsa_key_size                   keySize,
+                           Uint64                             exponent,
+                           const Uint8*                       mod,
+                           Uint64                             size,
+                           std::shared_ptr<RsaPublicKeyData>& key)
+{
+    switch (keySize) {
+        case KEY_SIZE_1024:
+            return Rsa<KEY_SIZE_1024>::createPublicKey(
+                exponent, mod, size, key);
+        case KEY_SIZE_2048:
+            return Rsa<KEY_SIZE_2048>::createPublicKey(
+                exponent, mod, size, key);
+        case KEY_SIZE_3072:
+            return Rsa<KEY_SIZE_3072>::createPublicKey(
+                exponent, mod, size, key);
+        case KEY_SIZE_4096:
+            return Rsa<KEY_SIZE_4096>::createPublicKey(
+                exponent, mod, size, key);
+        default:
+            return alcp::rsa::status::NotPermitted("Key size not supported");
+    }
+}
+
+Status
+RsaBuilder::BuildPrivateKey(alc_rsa_key_size                    keySize,
+                            const Uint8*                        dp,
+                            const Uint8*                        dq,
+                            const Uint8*                        p,
+                            const Uint8*                        q,
+                            const Uint8*                        qinv,
+                            const Uint8*                        mod,
+                            Uint64                              size,
+                            std::shared_ptr<RsaPrivateKeyData>& key)
+{
+    switch (keySize) {
+        case KEY_SIZE_1024:
+            return Rsa<KEY_SIZE_1024>::createPrivateKey(
+                dp, dq, p, q, qinv, mod, size, key);
+        case KEY_SIZE_2048:
+            return Rsa<KEY_SIZE_2048>::createPrivateKey(
+                dp, dq, p, q, qinv, mod, size, key);
+        case KEY_SIZE_3072:
+            return Rsa<KEY_SIZE_3072>::createPrivateKey(
+                dp, dq, p, q, qinv, mod, size, key);
+        case KEY_SIZE_4096:
+            return Rsa<KEY_SIZE_4096>::createPrivateKey(
+                dp, dq, p, q, qinv, mod, size, key);
+        default:
+            return alcp::rsa::status::NotPermitted("Key size not supported");
+    }
+}
+
+Status
+RsaBuilder::GenerateKey(alc_rsa_key_size                    keySize,
+                        Uint64                              exponent,
+                        std::shared_ptr<RsaPublicKeyData>&  pub,
+                        std::shared_ptr<RsaPrivateKeyData>& priv)
+{
+    switch (keySize) {
+        case KEY_SIZE_2048:
+            return Rsa<KEY_SIZE_2048>::generateKey(exponent, pub, priv);
+        case KEY_SIZE_3072:
+            return Rsa<KEY_SIZE_3072>::generateKey(exponent, pub, priv);
+        case KEY_SIZE_4096:
+            return Rsa<KEY_SIZE_4096>::generateKey(exponent, pub, priv);
+        default:
+            return alcp::rsa::status::NotPermitted("Key size not supported");
+    }
+}
+
 } // namespace alcp::rsa
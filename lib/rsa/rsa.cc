@@ -37,6 +37,10 @@
 #include "alcp/utils/copy.hh"
 #include "alcp/utils/cpuid.hh"
 #include "config.h"
+#include "system_rng.hh"
+
+#include <numeric>
+#include <vector>
 
 using alcp::utils::CpuId;
 
@@ -45,6 +49,46 @@ namespace alcp::rsa {
 
 static const Uint64 Sha512Size = 64;
 
+// DER encoded DigestInfo prefixes of PKCS#1 v1.5 signatures (RFC 8017 9.2)
+static const Uint64 DigestInfoSize = 19;
+
+static const Uint8 DigestInfoSha224[DigestInfoSize] = {
+    0x30, 0x2d, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+    0x65, 0x03, 0x04, 0x02, 0x04, 0x05, 0x00, 0x04, 0x1c
+};
+
+static const Uint8 DigestInfoSha256[DigestInfoSize] = {
+    0x30, 0x31, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+    0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20
+};
+
+static const Uint8 DigestInfoSha384[DigestInfoSize] = {
+    0x30, 0x41, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+    0x65, 0x03, 0x04, 0x02, 0x02, 0x05, 0x00, 0x04, 0x30
+};
+
+static const Uint8 DigestInfoSha512[DigestInfoSize] = {
+    0x30, 0x51, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+    0x65, 0x03, 0x04, 0x02, 0x03, 0x05, 0x00, 0x04, 0x40
+};
+
+static inline const Uint8*
+GetDigestInfo(Uint64 hashLen)
+{
+    switch (hashLen) {
+        case 28:
+            return DigestInfoSha224;
+        case 32:
+            return DigestInfoSha256;
+        case 48:
+            return DigestInfoSha384;
+        case 64:
+            return DigestInfoSha512;
+        default:
+            return nullptr;
+    }
+}
+
 static inline Uint8
 IsZero(Uint8 num)
 {
@@ -60,12 +104,6 @@ IsEqual(const Uint8* first, const Uint8* second, Uint16 len)
     return IsZero(num);
 }
 
-static inline Uint8
-IsLess(Uint8 first, Uint8 second)
-{
-    return 0 - (static_cast<Uint8>(first - second) >> 7);
-}
-
 static inline Uint8
 Select(Uint8 mask, Uint8 first, Uint8 second)
 {
@@ -80,6 +118,272 @@ Reset(void* buff, Uint64 size)
     }
 }
 
+/*
+ * Montgomery kernels for one key size. The table is filled once from the CPU
+ * feature flags rather than the Zen family, so any host with AVX512 IFMA or
+ * ADX/BMI2 gets the matching fast path.
+ */
+template<alc_rsa_key_size T>
+struct RsaKernels
+{
+    void (*encryptPublic)(Uint8*              pEncText,
+                          const Uint64*       pTextBigNum,
+                          RsaPublicKeyBignum& pubKey,
+                          MontContextBignum&  context);
+    void (*decryptPrivate)(Uint8*               pText,
+                           const Uint64*        pEncTextBigNum,
+                           RsaPrivateKeyBignum& privKey,
+                           MontContextBignum&   contextP,
+                           MontContextBignum&   contextQ);
+    void (*createContext)(MontContextBignum& context,
+                          Uint64*            mod,
+                          Uint64             size);
+    bool (*millerRabin)(Uint64*            pCandidate,
+                        MontContextBignum& context,
+                        const Uint64*      pBases,
+                        Uint64             rounds);
+    void (*modExpHalf)(Uint64*            pRes,
+                       const Uint64*      pBase,
+                       Uint64*            pExp,
+                       Uint64*            pMod,
+                       MontContextBignum& context);
+    // lane parallel batches, nullptr when the host has no such kernel
+    void (*encryptPublicBatch)(Uint8* const              pEncText[],
+                               const Uint64* const       pTextBigNum[],
+                               Uint64                    num,
+                               RsaPublicKeyBignum* const pubKey[],
+                               MontContextBignum* const  context[]);
+    void (*decryptPrivateBatch)(Uint8* const         pText[],
+                                const Uint64* const  pEncTextBigNum[],
+                                Uint64               num,
+                                RsaPrivateKeyBignum& privKey,
+                                MontContextBignum&   contextP,
+                                MontContextBignum&   contextQ);
+};
+
+template<alc_rsa_key_size T>
+static RsaKernels<T>
+SelectKernels()
+{
+    // Every arch build also carries the MULX/ADCX/ADOX Montgomery code
+    bool has_mulx =
+        CpuId::cpuHasAdx() && CpuId::cpuHasBmi2() && CpuId::cpuHasAvx2();
+    // zen4 objects are also compiled with -mavx512dq, so require it as well
+    bool has_ifma = CpuId::cpuHasAvx512(utils::AVX512_F)
+                    && CpuId::cpuHasAvx512(utils::AVX512_DQ)
+                    && CpuId::cpuHasAvx512(utils::AVX512_VL)
+                    && CpuId::cpuHasAvx512(utils::AVX512_IFMA);
+
+    if (has_mulx && has_ifma) {
+        return { zen4::archEncryptPublic<T>,
+                 zen4::archDecryptPrivate<T>,
+                 zen4::archCreateContext<T>,
+                 zen4::archMillerRabin<T>,
+                 zen4::archModExpHalf<T>,
+                 zen4::archEncryptPublicBatch<T>,
+                 zen4::archDecryptPrivateBatch<T> };
+    }
+    // zen3 objects are built for znver3, VAES marks a host with that ISA
+    if (has_mulx && CpuId::cpuHasVaes()) {
+        return { zen3::archEncryptPublic<T>,
+                 zen3::archDecryptPrivate<T>,
+                 zen3::archCreateContext<T>,
+                 zen3::archMillerRabin<T>,
+                 zen3::archModExpHalf<T>,
+                 nullptr,
+                 nullptr };
+    }
+    if (has_mulx) {
+        return { zen::archEncryptPublic<T>,
+                 zen::archDecryptPrivate<T>,
+                 zen::archCreateContext<T>,
+                 zen::archMillerRabin<T>,
+                 zen::archModExpHalf<T>,
+                 nullptr,
+                 nullptr };
+    }
+    return { archEncryptPublic<T>,
+             archDecryptPrivate<T>,
+             archCreateContext<T>,
+             archMillerRabin<T>,
+             archModExpHalf<T>,
+             nullptr,
+             nullptr };
+}
+
+template<alc_rsa_key_size T>
+static inline const RsaKernels<T>&
+GetKernels()
+{
+    static const RsaKernels<T> kernels = SelectKernels<T>();
+    return kernels;
+}
+
+// Odd primes below 2^14, trial division by them rules out most candidates of
+// the prime search before any Montgomery work is spent on them
+static const std::vector<Uint32>&
+SmallPrimes()
+{
+    static const std::vector<Uint32> primes = [] {
+        constexpr Uint32    limit = 1 << 14;
+        std::vector<bool>   composite(limit);
+        std::vector<Uint32> res;
+        for (Uint32 i = 3; i < limit; i += 2) {
+            if (composite[i]) {
+                continue;
+            }
+            res.push_back(i);
+            for (Uint32 j = i * i; j < limit; j += 2 * i) {
+                composite[j] = true;
+            }
+        }
+        return res;
+    }();
+    return primes;
+}
+
+static inline Uint64
+ModWord(const Uint64* num, Uint64 size, Uint64 mod)
+{
+    __uint128_t rem = 0;
+    for (Int64 i = size - 1; i >= 0; i--) {
+        rem = ((rem << 64) | num[i]) % mod;
+    }
+    return static_cast<Uint64>(rem);
+}
+
+// num ^ -1 mod mod, num and mod are coprime
+static inline Uint64
+InverseWord(Uint64 num, Uint64 mod)
+{
+    __int128_t t = 0, new_t = 1, r = mod, new_r = num;
+    while (new_r != 0) {
+        __int128_t quot = r / new_r;
+        __int128_t tmp  = t - quot * new_t;
+        t               = new_t;
+        new_t           = tmp;
+        tmp             = r - quot * new_r;
+        r               = new_r;
+        new_r           = tmp;
+    }
+    return static_cast<Uint64>(t < 0 ? t + mod : t);
+}
+
+// res = exponent ^ -1 mod m for m = p - 1 coprime to the exponent, computed
+// as (1 + m * k) / exponent with k = -m ^ -1 mod exponent
+template<alc_rsa_key_size T>
+static inline void
+InverseOfExponent(Uint64* res, const Uint64* m, Uint64 exponent)
+{
+    constexpr Uint64 size = T / 128;
+
+    Uint64 k = exponent - InverseWord(ModWord(m, size, exponent), exponent);
+
+    alignas(64) Uint64 prod[size + 1];
+    __uint128_t        acc = 1;
+    for (Uint64 i = 0; i < size; i++) {
+        acc += static_cast<__uint128_t>(m[i]) * k;
+        prod[i] = static_cast<Uint64>(acc);
+        acc >>= 64;
+    }
+    prod[size] = static_cast<Uint64>(acc);
+
+    // the division is exact and the quotient is less than m
+    __uint128_t rem = prod[size];
+    for (Int64 i = size - 1; i >= 0; i--) {
+        rem    = (rem << 64) | prod[i];
+        res[i] = static_cast<Uint64>(rem / exponent);
+        rem %= exponent;
+    }
+    Reset(prod, size + 1);
+}
+
+/*
+ * Random T / 2 bit prime with gcd(prime - 1, exponent) = 1 and the top two
+ * bits set, so that the product of two of them has all T bits. Odd numbers
+ * from a random start are sieved with residues updated in place, only the
+ * survivors get Miller-Rabin rounds, the first round alone since it rejects
+ * nearly every composite.
+ */
+template<alc_rsa_key_size T>
+static Status
+GeneratePrime(Uint64* prime, Uint64 exponent, rng::SystemRng& rng)
+{
+    constexpr Uint64 size = T / 128;
+    // at least the rounds for an error probability below 2^-100 on random
+    // candidates of this size
+    constexpr Uint64 Rounds = T == KEY_SIZE_2048 ? 5 : 4;
+    // candidates after one random start, primes are about 700 apart here
+    constexpr Uint64 MaxDelta = 1 << 16;
+
+    auto& kernels = GetKernels<T>();
+    auto& primes  = SmallPrimes();
+
+    std::vector<Uint32> residues(primes.size());
+    alignas(64) Uint64  bases[Rounds * size];
+    Status              status = StatusOk();
+
+    while (status.ok()) {
+        status = rng.randomize(reinterpret_cast<Uint8*>(prime), size * 8);
+        prime[size - 1] |= 3ULL << 62;
+        prime[0] |= 1;
+
+        for (Uint64 i = 0; i < primes.size(); i++) {
+            residues[i] = ModWord(prime, size, primes[i]);
+        }
+        Uint64 exp_residue = ModWord(prime, size, exponent);
+
+        for (Uint64 delta = 0; delta < MaxDelta && status.ok(); delta += 2) {
+            if (delta) {
+                bool carry = (prime[0] += 2) < 2;
+                for (Uint64 i = 1; i < size && carry; i++) {
+                    carry = ++prime[i] == 0;
+                }
+                if ((prime[size - 1] >> 62) != 3) {
+                    break;
+                }
+                for (Uint64 i = 0; i < primes.size(); i++) {
+                    residues[i] += 2;
+                    residues[i] -= residues[i] >= primes[i] ? primes[i] : 0;
+                }
+                exp_residue = exp_residue >= exponent - 2
+                                  ? exp_residue - (exponent - 2)
+                                  : exp_residue + 2;
+            }
+
+            bool divisible = false;
+            for (Uint64 i = 0; i < primes.size(); i++) {
+                divisible |= residues[i] == 0;
+            }
+            Uint64 prime_minus_one =
+                exp_residue ? exp_residue - 1 : exponent - 1;
+            if (divisible || std::gcd(prime_minus_one, exponent) != 1) {
+                continue;
+            }
+
+            // bases below 2^(T / 2 - 2) are less than the candidate
+            status = rng.randomize(reinterpret_cast<Uint8*>(bases),
+                                   sizeof(bases));
+            for (Uint64 i = 0; i < Rounds; i++) {
+                bases[i * size + size - 1] &= ~(3ULL << 62);
+                bases[i * size] |= 2;
+            }
+
+            MontContextBignum context;
+            kernels.createContext(context, prime, size);
+
+            if (status.ok()
+                && kernels.millerRabin(prime, context, bases, 1)
+                && kernels.millerRabin(
+                    prime, context, bases + size, Rounds - 1)) {
+                std::fill(residues.begin(), residues.end(), 0);
+                return status;
+            }
+        }
+    }
+    return status;
+}
+
 template<alc_rsa_key_size T>
 Rsa<T>::Rsa()
 {
@@ -88,7 +392,7 @@ Rsa<T>::Rsa()
 
 template<alc_rsa_key_size T>
 void
-Rsa<T>::setDigestOaep(digest::IDigest* digest)
+Rsa<T>::setDigest(digest::IDigest* digest)
 {
     if (digest) {
         m_digest   = digest;
@@ -98,7 +402,7 @@ Rsa<T>::setDigestOaep(digest::IDigest* digest)
 
 template<alc_rsa_key_size T>
 void
-Rsa<T>::setMgfOaep(digest::IDigest* mgf)
+Rsa<T>::setMgf(digest::IDigest* mgf)
 {
     if (mgf) {
         m_mgf          = mgf;
@@ -106,6 +410,20 @@ Rsa<T>::setMgfOaep(digest::IDigest* mgf)
     }
 }
 
+template<alc_rsa_key_size T>
+void
+Rsa<T>::setDigestOaep(digest::IDigest* digest)
+{
+    setDigest(digest);
+}
+
+template<alc_rsa_key_size T>
+void
+Rsa<T>::setMgfOaep(digest::IDigest* mgf)
+{
+    setMgf(mgf);
+}
+
 template<alc_rsa_key_size T>
 void
 Rsa<T>::maskGenFunct(Uint8*       mask,
@@ -163,41 +481,90 @@ Rsa<T>::encryptPublic(const Uint8* pText, Uint64 textSize, Uint8* pEncText)
         return status::NotPermitted("Buffer should be non null");
     }
 
+    if (!m_pub) {
+        return status::NotPermitted("public key should be set");
+    }
+
     std::unique_ptr<Uint64[]> bignum_text;
     auto                      ptext_bignum = CreateBigNum(pText, m_key_size);
-    auto                      mod_bignum   = m_pub_key.m_mod.get();
+    auto                      mod_bignum   = m_pub->m_key.m_mod.get();
 
     bignum_text.reset(ptext_bignum);
 
-    if (!IsLess(ptext_bignum, mod_bignum, m_pub_key.m_size)) {
+    if (!IsLess(ptext_bignum, mod_bignum, m_pub->m_key.m_size)) {
         return status::NotPermitted(
             "text absolute value should be less than modulus");
     }
 
-    // FIXME: We should probably use flag base dispatching than ZENVER dispatch
-    //        as this kind of dispatch will pick reference in non AMD machines.
-    static bool zen4_available = CpuId::cpuIsZen4();
-    static bool zen3_available = CpuId::cpuIsZen3();
-    static bool zen_available  = CpuId::cpuIsZen1() || CpuId::cpuIsZen2();
+    GetKernels<T>().encryptPublic(
+        pEncText, ptext_bignum, m_pub->m_key, m_pub->m_context);
 
-    static bool zen_available_flags =
-        CpuId::cpuHasAdx() && CpuId::cpuHasAvx2() && CpuId::cpuHasBmi2();
+    return StatusOk();
+}
 
-    if (zen4_available) {
-        zen4::archEncryptPublic<T>(
-            pEncText, ptext_bignum, m_pub_key, m_context_pub);
-        return StatusOk();
-    } else if (zen3_available) {
-        zen3::archEncryptPublic<T>(
-            pEncText, ptext_bignum, m_pub_key, m_context_pub);
-        return StatusOk();
-    } else if (zen_available || zen_available_flags) {
-        zen::archEncryptPublic<T>(
-            pEncText, ptext_bignum, m_pub_key, m_context_pub);
-        return StatusOk();
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::encryptPublicBatch(Rsa* const         pRsa[],
+                           const Uint8* const pText[],
+                           Uint64             textSize,
+                           Uint8* const       pEncText[],
+                           Uint64             num)
+{
+    // For non padded output
+    if (textSize != T / 8) {
+        return status::NotPermitted("Text size should be equal to modulus");
     }
 
-    archEncryptPublic<T>(pEncText, ptext_bignum, m_pub_key, m_context_pub);
+    if (pRsa == nullptr || pText == nullptr || pEncText == nullptr) {
+        return status::NotPermitted("Buffer should be non null");
+    }
+
+    for (Uint64 i = 0; i < num; i++) {
+        if (pRsa[i] == nullptr || pText[i] == nullptr
+            || pEncText[i] == nullptr) {
+            return status::NotPermitted("Buffer should be non null");
+        }
+        if (!pRsa[i]->m_pub) {
+            return status::NotPermitted("public key should be set");
+        }
+    }
+
+    auto& kernels = GetKernels<T>();
+
+    for (Uint64 done = 0; done < num; done += RsaBatchSize) {
+        Uint64 count = std::min(num - done, RsaBatchSize);
+
+        std::unique_ptr<Uint64[]> bignum_text[RsaBatchSize];
+        const Uint64*             p_bignum_text[RsaBatchSize];
+        RsaPublicKeyBignum*       pub_key[RsaBatchSize];
+        MontContextBignum*        context[RsaBatchSize];
+
+        for (Uint64 l = 0; l < count; l++) {
+            bignum_text[l].reset(CreateBigNum(pText[done + l], textSize));
+            p_bignum_text[l] = bignum_text[l].get();
+            pub_key[l]       = &pRsa[done + l]->m_pub->m_key;
+            context[l]       = &pRsa[done + l]->m_pub->m_context;
+
+            if (!IsLess(bignum_text[l].get(),
+                        pub_key[l]->m_mod.get(),
+                        pub_key[l]->m_size)) {
+                return status::NotPermitted(
+                    "text absolute value should be less than modulus");
+            }
+        }
+
+        if (kernels.encryptPublicBatch) {
+            kernels.encryptPublicBatch(
+                pEncText + done, p_bignum_text, count, pub_key, context);
+        } else {
+            for (Uint64 l = 0; l < count; l++) {
+                kernels.encryptPublic(pEncText[done + l],
+                                      p_bignum_text[l],
+                                      *pub_key[l],
+                                      *context[l]);
+            }
+        }
+    }
 
     return StatusOk();
 }
@@ -206,8 +573,12 @@ template<alc_rsa_key_size T>
 Status
 Rsa<T>::decryptPrivate(const Uint8* pEncText, Uint64 encSize, Uint8* pText)
 {
+    if (!m_priv) {
+        return status::NotPermitted("private key should be set");
+    }
+
     // For non padded output
-    if (encSize != m_priv_key.m_size * 2 * 8) {
+    if (encSize != m_priv->m_key.m_size * 2 * 8) {
         return status::NotPermitted("Text size should be equal modulous");
     }
 
@@ -216,40 +587,88 @@ Rsa<T>::decryptPrivate(const Uint8* pEncText, Uint64 encSize, Uint8* pText)
     }
 
     std::unique_ptr<Uint64[]> bignum_text;
-    auto ptext_bignum = CreateBigNum(pEncText, m_priv_key.m_size * 2 * 8);
+    auto ptext_bignum = CreateBigNum(pEncText, m_priv->m_key.m_size * 2 * 8);
     bignum_text.reset(ptext_bignum);
-    auto mod_bignum = m_priv_key.m_mod.get();
+    auto mod_bignum = m_priv->m_key.m_mod.get();
 
-    if (!IsLess(ptext_bignum, mod_bignum, m_priv_key.m_size * 2)) {
+    if (!IsLess(ptext_bignum, mod_bignum, m_priv->m_key.m_size * 2)) {
         return status::NotPermitted(
             "text absolute value should be less than modulus");
     }
 
-    // FIXME: We should probably use flag base dispatching than ZENVER dispatch
-    //        as this kind of dispatch will pick reference in non AMD machines.
-    static bool zen4_available = CpuId::cpuIsZen4();
-    static bool zen3_available = CpuId::cpuIsZen3();
-    static bool zen_available  = CpuId::cpuIsZen1() || CpuId::cpuIsZen2();
+    GetKernels<T>().decryptPrivate(pText,
+                                   ptext_bignum,
+                                   m_priv->m_key,
+                                   m_priv->m_context_p,
+                                   m_priv->m_context_q);
 
-    static bool zen_available_flags =
-        CpuId::cpuHasAdx() && CpuId::cpuHasAvx2() && CpuId::cpuHasBmi2();
+    return StatusOk();
+}
 
-    if (zen4_available) {
-        zen4::archDecryptPrivate<T>(
-            pText, ptext_bignum, m_priv_key, m_context_p, m_context_q);
-        return StatusOk();
-    } else if (zen3_available) {
-        zen3::archDecryptPrivate<T>(
-            pText, ptext_bignum, m_priv_key, m_context_p, m_context_q);
-        return StatusOk();
-    } else if (zen_available || zen_available_flags) {
-        zen::archDecryptPrivate<T>(
-            pText, ptext_bignum, m_priv_key, m_context_p, m_context_q);
-        return StatusOk();
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::decryptPrivateBatch(const Uint8* const pEncText[],
+                            Uint64             encSize,
+                            Uint8* const       pText[],
+                            Uint64             num)
+{
+    if (!m_priv) {
+        return status::NotPermitted("private key should be set");
+    }
+
+    // For non padded output
+    if (encSize != m_priv->m_key.m_size * 2 * 8) {
+        return status::NotPermitted("Text size should be equal modulous");
+    }
+
+    if (pEncText == nullptr || pText == nullptr) {
+        return status::NotPermitted("Buffer should be non null");
     }
 
-    archDecryptPrivate<T>(
-        pText, ptext_bignum, m_priv_key, m_context_p, m_context_q);
+    for (Uint64 i = 0; i < num; i++) {
+        if (pEncText[i] == nullptr || pText[i] == nullptr) {
+            return status::NotPermitted("Buffer should be non null");
+        }
+    }
+
+    auto& kernels    = GetKernels<T>();
+    auto  mod_bignum = m_priv->m_key.m_mod.get();
+
+    for (Uint64 done = 0; done < num; done += RsaBatchSize) {
+        Uint64 count = std::min(num - done, RsaBatchSize);
+
+        std::unique_ptr<Uint64[]> bignum_text[RsaBatchSize];
+        const Uint64*             p_bignum_text[RsaBatchSize];
+
+        for (Uint64 l = 0; l < count; l++) {
+            bignum_text[l].reset(CreateBigNum(pEncText[done + l], encSize));
+            p_bignum_text[l] = bignum_text[l].get();
+
+            if (!IsLess(bignum_text[l].get(),
+                        mod_bignum,
+                        m_priv->m_key.m_size * 2)) {
+                return status::NotPermitted(
+                    "text absolute value should be less than modulus");
+            }
+        }
+
+        if (kernels.decryptPrivateBatch) {
+            kernels.decryptPrivateBatch(pText + done,
+                                        p_bignum_text,
+                                        count,
+                                        m_priv->m_key,
+                                        m_priv->m_context_p,
+                                        m_priv->m_context_q);
+        } else {
+            for (Uint64 l = 0; l < count; l++) {
+                kernels.decryptPrivate(pText[done + l],
+                                       p_bignum_text[l],
+                                       m_priv->m_key,
+                                       m_priv->m_context_p,
+                                       m_priv->m_context_q);
+            }
+        }
+    }
 
     return StatusOk();
 }
@@ -306,6 +725,7 @@ Rsa<T>::encryptPublicOaep(const Uint8* pText,
     p_masked_db       = p_masked_seed + m_hash_len; // seed size equals hashsize
 
     // generates masked db
+    m_digest->reset();
     m_digest->finalize(pLabel, labelSize);
     m_digest->copyHash(p_masked_db, m_hash_len);
 
@@ -390,12 +810,15 @@ Rsa<T>::decryptPrivateOaep(const Uint8* pEncText,
 
     success &= IsEqual(hash_label, p_db, m_hash_len);
 
+    // the indices reach past 255 for 3072 and 4096 bit keys, so the masks
+    // selecting them are as wide as they are
     Uint32 one_index = 0;
     Uint8  found_one = 0;
     for (Uint32 i = m_hash_len; i < db_len; i++) {
-        Uint8 is_one  = IsZero(p_db[i] ^ 1);
-        Uint8 is_zero = IsZero(p_db[i]);
-        one_index     = Select(~found_one & is_one, i, one_index);
+        Uint8  is_one  = IsZero(p_db[i] ^ 1);
+        Uint8  is_zero = IsZero(p_db[i]);
+        Uint32 take    = 0 - static_cast<Uint32>(~found_one & is_one & 1);
+        one_index      = (take & i) | (~take & one_index);
         found_one |= is_one;
         success &= (found_one | is_zero);
     }
@@ -406,17 +829,582 @@ Rsa<T>::decryptPrivateOaep(const Uint8* pEncText,
 
     Uint64 max_msg_len = db_len - m_hash_len - 1;
     for (Uint32 i = 0; i < max_msg_len; i++) {
-        Uint8 mask = success & IsLess(i, text_len);
+        // all ones when i < text_len, both are far below 2^31
+        Uint8 mask = success & static_cast<Uint8>(0 - ((i - text_len) >> 31));
         pText[i]   = Select(mask, p_db[text_index + i], pText[i]);
     }
 
-    textSize = Select(success, text_len, -1);
+    Uint64 ok = 0 - static_cast<Uint64>(success & 1);
+    textSize  = text_len | ~ok;
     memset(p_mod_text, 0, encSize);
     memset(p_db, 0, db_len * 2);
     Uint8 error_code = Select(success, eOk, eInternal);
     return (error_code == eOk) ? StatusOk() : status::Generic("Generic error");
 }
 
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::encodePkcs1v15(const Uint8* pText, Uint64 textSize, Uint8* pEncoded)
+{
+    // clang-format off
+            //       +--+--+----------+--+------------+-------+
+            // EM =  |00|01| FF .. FF |00| DigestInfo | H(M)  |
+            //       +--+--+----------+--+------------+-------+
+    // clang-format on
+
+    if (!m_digest) {
+        return status::NotPermitted("digest should be non null");
+    }
+
+    const Uint8* p_digest_info = GetDigestInfo(m_hash_len);
+    if (p_digest_info == nullptr) {
+        return status::NotPermitted("digest is not supported for PKCS#1 v1.5");
+    }
+
+    Uint64 t_len = DigestInfoSize + m_hash_len;
+    if (m_key_size < t_len + 11) {
+        return status::NotPermitted("key size is smaller than supported");
+    }
+
+    Uint64 ps_len = m_key_size - t_len - 3;
+
+    pEncoded[0] = 0;
+    pEncoded[1] = 1;
+    memset(pEncoded + 2, 0xff, ps_len);
+    pEncoded[2 + ps_len] = 0;
+
+    Uint8* p_t = pEncoded + 3 + ps_len;
+    utils::CopyBytes(p_t, p_digest_info, DigestInfoSize);
+
+    m_digest->reset();
+    m_digest->finalize(pText, textSize);
+    m_digest->copyHash(p_t + DigestInfoSize, m_hash_len);
+
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::signPkcs1v15(bool         check,
+                     const Uint8* pText,
+                     Uint64       textSize,
+                     Uint8*       pSignText)
+{
+    if ((pText == nullptr && textSize > 0) || pSignText == nullptr) {
+        return status::NotPermitted("Buffer should be non null");
+    }
+
+    alignas(64) Uint8 encoded[T / 8];
+
+    Status status = encodePkcs1v15(pText, textSize, encoded);
+    if (!status.ok()) {
+        return status;
+    }
+
+    status = decryptPrivate(encoded, m_key_size, pSignText);
+
+    // a faulty CRT exponentiation leaks the factors, never hand it out
+    if (status.ok() && check) {
+        status = verifyPkcs1v15(pText, textSize, pSignText);
+        if (!status.ok()) {
+            memset(pSignText, 0, m_key_size);
+        }
+    }
+
+    return status;
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::checkPkcs1v15(const Uint8* pText,
+                      Uint64       textSize,
+                      const Uint8* pEncoded,
+                      bool&        valid)
+{
+    alignas(64) Uint8 expected[T / 8];
+
+    Status status = encodePkcs1v15(pText, textSize, expected);
+    if (!status.ok()) {
+        return status;
+    }
+
+    valid = memcmp(pEncoded, expected, m_key_size) == 0;
+
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::verifyPkcs1v15(const Uint8* pText,
+                       Uint64       textSize,
+                       const Uint8* pSignText)
+{
+    if ((pText == nullptr && textSize > 0) || pSignText == nullptr) {
+        return status::NotPermitted("Buffer should be non null");
+    }
+
+    if (!m_pub) {
+        return status::NotPermitted("public key should be set");
+    }
+
+    alignas(64) Uint8 encoded[T / 8];
+
+    Status status = encryptPublic(pSignText, m_key_size, encoded);
+    if (!status.ok()) {
+        return status;
+    }
+
+    bool valid = false;
+    status     = checkPkcs1v15(pText, textSize, encoded, valid);
+    if (status.ok() && !valid) {
+        return status::Generic("signature verification failed");
+    }
+
+    return status;
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::encodePss(const Uint8* pText,
+                  Uint64       textSize,
+                  const Uint8* salt,
+                  Uint64       saltSize,
+                  Uint8*       pEncoded)
+{
+    // clang-format off
+            //                 +----------+------+------+
+            //           M' =  | 00 x 8   | H(M) | salt |
+            //                 +----------+------+------+
+            //                                |
+            //       +------+--+------+      Hash
+            // DB =  |  PS  |01| salt |       |
+            //       +------+--+------+       |
+            //                |               |
+            //               xor <--- MGF <---|
+            //                |               |
+            //                V               V
+            //       +-------------------+----------+--+
+            // EM =  |     maskedDB      |    H     |bc|
+            //       +-------------------+----------+--+
+    // clang-format on
+
+    if (!m_mgf || !m_digest) {
+        return status::NotPermitted(
+            "digest and mask generation function should be non null");
+    }
+
+    if (m_key_size < m_hash_len + saltSize + 2) {
+        return status::NotPermitted("salt size is larger than supported");
+    }
+
+    static const Uint8 zeros[8] = {};
+
+    Uint8 msg_hash[Sha512Size];
+
+    Uint64 db_len = m_key_size - m_hash_len - 1;
+    Uint8* p_hash = pEncoded + db_len;
+
+    m_digest->reset();
+    m_digest->finalize(pText, textSize);
+    m_digest->copyHash(msg_hash, m_hash_len);
+
+    m_digest->reset();
+    m_digest->update(zeros, sizeof(zeros));
+    m_digest->update(msg_hash, m_hash_len);
+    m_digest->finalize(salt, saltSize);
+    m_digest->copyHash(p_hash, m_hash_len);
+
+    maskGenFunct(pEncoded, db_len, p_hash, m_hash_len);
+
+    pEncoded[db_len - saltSize - 1] ^= 1;
+    for (Uint64 i = 0; i < saltSize; i++) {
+        pEncoded[db_len - saltSize + i] ^= salt[i];
+    }
+
+    // emBits is one less than the modulus bits
+    pEncoded[0] &= 0x7f;
+    pEncoded[m_key_size - 1] = 0xbc;
+
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::signPss(bool         check,
+                const Uint8* pText,
+                Uint64       textSize,
+                const Uint8* salt,
+                Uint64       saltSize,
+                Uint8*       pSignText)
+{
+    if ((pText == nullptr && textSize > 0) || pSignText == nullptr
+        || (salt == nullptr && saltSize > 0)) {
+        return status::NotPermitted("Buffer should be non null");
+    }
+
+    alignas(64) Uint8 encoded[T / 8];
+
+    Status status = encodePss(pText, textSize, salt, saltSize, encoded);
+    if (!status.ok()) {
+        return status;
+    }
+
+    status = decryptPrivate(encoded, m_key_size, pSignText);
+
+    if (status.ok() && check) {
+        status = verifyPss(pText, textSize, pSignText);
+        if (!status.ok()) {
+            memset(pSignText, 0, m_key_size);
+        }
+    }
+
+    return status;
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::signPkcs1v15Batch(bool               check,
+                          const Uint8* const pText[],
+                          const Uint64       textSize[],
+                          Uint8* const       pSignText[],
+                          Uint64             num)
+{
+    if (pText == nullptr || textSize == nullptr || pSignText == nullptr) {
+        return status::NotPermitted("Buffer should be non null");
+    }
+
+    alignas(64) Uint8 encoded[RsaBatchSize][T / 8];
+    const Uint8*      p_encoded[RsaBatchSize];
+
+    for (Uint64 done = 0; done < num; done += RsaBatchSize) {
+        Uint64 count = std::min(num - done, RsaBatchSize);
+
+        for (Uint64 l = 0; l < count; l++) {
+            if (pText[done + l] == nullptr && textSize[done + l] > 0) {
+                return status::NotPermitted("Buffer should be non null");
+            }
+            Status status =
+                encodePkcs1v15(pText[done + l], textSize[done + l], encoded[l]);
+            if (!status.ok()) {
+                return status;
+            }
+            p_encoded[l] = encoded[l];
+        }
+
+        Status status =
+            decryptPrivateBatch(p_encoded, m_key_size, pSignText + done, count);
+        if (!status.ok()) {
+            return status;
+        }
+
+        for (Uint64 l = 0; check && l < count; l++) {
+            status = verifyPkcs1v15(
+                pText[done + l], textSize[done + l], pSignText[done + l]);
+            if (!status.ok()) {
+                memset(pSignText[done + l], 0, m_key_size);
+                return status;
+            }
+        }
+    }
+
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::signPssBatch(bool               check,
+                     const Uint8* const pText[],
+                     const Uint64       textSize[],
+                     const Uint8* const salt[],
+                     Uint64             saltSize,
+                     Uint8* const       pSignText[],
+                     Uint64             num)
+{
+    if (pText == nullptr || textSize == nullptr || pSignText == nullptr
+        || (salt == nullptr && saltSize > 0)) {
+        return status::NotPermitted("Buffer should be non null");
+    }
+
+    alignas(64) Uint8 encoded[RsaBatchSize][T / 8];
+    const Uint8*      p_encoded[RsaBatchSize];
+
+    for (Uint64 done = 0; done < num; done += RsaBatchSize) {
+        Uint64 count = std::min(num - done, RsaBatchSize);
+
+        for (Uint64 l = 0; l < count; l++) {
+            const Uint8* p_salt = salt ? salt[done + l] : nullptr;
+            if ((pText[done + l] == nullptr && textSize[done + l] > 0)
+                || (p_salt == nullptr && saltSize > 0)) {
+                return status::NotPermitted("Buffer should be non null");
+            }
+            Status status = encodePss(pText[done + l],
+                                      textSize[done + l],
+                                      p_salt,
+                                      saltSize,
+                                      encoded[l]);
+            if (!status.ok()) {
+                return status;
+            }
+            p_encoded[l] = encoded[l];
+        }
+
+        Status status =
+            decryptPrivateBatch(p_encoded, m_key_size, pSignText + done, count);
+        if (!status.ok()) {
+            return status;
+        }
+
+        for (Uint64 l = 0; check && l < count; l++) {
+            status = verifyPss(
+                pText[done + l], textSize[done + l], pSignText[done + l]);
+            if (!status.ok()) {
+                memset(pSignText[done + l], 0, m_key_size);
+                return status;
+            }
+        }
+    }
+
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::checkPss(const Uint8* pText,
+                 Uint64       textSize,
+                 const Uint8* pEncoded,
+                 bool&        valid)
+{
+    if (!m_mgf || !m_digest) {
+        return status::NotPermitted(
+            "digest and mask generation function should be non null");
+    }
+
+    if (m_key_size < m_hash_len + 2) {
+        return status::NotPermitted("key size is smaller than supported");
+    }
+
+    static const Uint8 zeros[8] = {};
+
+    Uint8             msg_hash[Sha512Size];
+    Uint8             hash[Sha512Size];
+    alignas(64) Uint8 db[T / 8];
+
+    valid = false;
+
+    if (pEncoded[m_key_size - 1] != 0xbc || (pEncoded[0] & 0x80)) {
+        return StatusOk();
+    }
+
+    Uint64       db_len = m_key_size - m_hash_len - 1;
+    const Uint8* p_hash = pEncoded + db_len;
+
+    maskGenFunct(db, db_len, p_hash, m_hash_len);
+    for (Uint64 i = 0; i < db_len; i++) {
+        db[i] ^= pEncoded[i];
+    }
+    db[0] &= 0x7f;
+
+    // PS is all zero and ends at the 01 separator
+    Uint64 index = 0;
+    while (index < db_len && db[index] == 0) {
+        index++;
+    }
+    if (index == db_len || db[index] != 1) {
+        return StatusOk();
+    }
+
+    const Uint8* p_salt    = db + index + 1;
+    Uint64       salt_size = db_len - index - 1;
+
+    m_digest->reset();
+    m_digest->finalize(pText, textSize);
+    m_digest->copyHash(msg_hash, m_hash_len);
+
+    m_digest->reset();
+    m_digest->update(zeros, sizeof(zeros));
+    m_digest->update(msg_hash, m_hash_len);
+    m_digest->finalize(p_salt, salt_size);
+    m_digest->copyHash(hash, m_hash_len);
+
+    valid = memcmp(hash, p_hash, m_hash_len) == 0;
+
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::verifyPss(const Uint8* pText, Uint64 textSize, const Uint8* pSignText)
+{
+    if ((pText == nullptr && textSize > 0) || pSignText == nullptr) {
+        return status::NotPermitted("Buffer should be non null");
+    }
+
+    if (!m_pub) {
+        return status::NotPermitted("public key should be set");
+    }
+
+    alignas(64) Uint8 encoded[T / 8];
+
+    Status status = encryptPublic(pSignText, m_key_size, encoded);
+    if (!status.ok()) {
+        return status;
+    }
+
+    bool valid = false;
+    status     = checkPss(pText, textSize, encoded, valid);
+    if (status.ok() && !valid) {
+        return status::Generic("signature verification failed");
+    }
+
+    return status;
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::checkBatchArgs(Rsa* const         pRsa[],
+                       const Uint8* const pText[],
+                       const Uint64       textSize[],
+                       const Uint8* const pSignText[],
+                       bool               pValid[],
+                       Uint64             num)
+{
+    if (pRsa == nullptr || pText == nullptr || textSize == nullptr
+        || pSignText == nullptr || pValid == nullptr) {
+        return status::NotPermitted("Buffer should be non null");
+    }
+
+    for (Uint64 i = 0; i < num; i++) {
+        if (pRsa[i] == nullptr || (pText[i] == nullptr && textSize[i] > 0)
+            || pSignText[i] == nullptr) {
+            return status::NotPermitted("Buffer should be non null");
+        }
+        if (!pRsa[i]->m_pub) {
+            return status::NotPermitted("public key should be set");
+        }
+    }
+
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::openSignatureBatch(Rsa* const         pRsa[],
+                           const Uint8* const pSignText[],
+                           Uint8* const       pEncoded[],
+                           bool               pValid[],
+                           Uint64             num)
+{
+    Rsa*         rsa[RsaBatchSize];
+    const Uint8* sign_text[RsaBatchSize];
+    Uint8*       encoded[RsaBatchSize];
+    Uint64       count = 0;
+
+    for (Uint64 l = 0; l < num; l++) {
+        std::unique_ptr<Uint64[]> bignum_sign(
+            CreateBigNum(pSignText[l], T / 8));
+
+        pValid[l] = IsLess(bignum_sign.get(),
+                           pRsa[l]->m_pub->m_key.m_mod.get(),
+                           pRsa[l]->m_pub->m_key.m_size);
+        if (pValid[l]) {
+            rsa[count]       = pRsa[l];
+            sign_text[count] = pSignText[l];
+            encoded[count]   = pEncoded[l];
+            count++;
+        }
+    }
+
+    return encryptPublicBatch(rsa, sign_text, T / 8, encoded, count);
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::verifyPkcs1v15Batch(Rsa* const         pRsa[],
+                            const Uint8* const pText[],
+                            const Uint64       textSize[],
+                            const Uint8* const pSignText[],
+                            bool               pValid[],
+                            Uint64             num)
+{
+    Status status =
+        checkBatchArgs(pRsa, pText, textSize, pSignText, pValid, num);
+    if (!status.ok()) {
+        return status;
+    }
+
+    alignas(64) Uint8 encoded[RsaBatchSize][T / 8];
+    Uint8*            p_encoded[RsaBatchSize];
+    for (Uint64 l = 0; l < RsaBatchSize; l++) {
+        p_encoded[l] = encoded[l];
+    }
+
+    for (Uint64 done = 0; done < num; done += RsaBatchSize) {
+        Uint64 count = std::min(num - done, RsaBatchSize);
+
+        status = openSignatureBatch(
+            pRsa + done, pSignText + done, p_encoded, pValid + done, count);
+        if (!status.ok()) {
+            return status;
+        }
+
+        for (Uint64 l = 0, i = done; l < count; l++, i++) {
+            if (pValid[i]) {
+                status = pRsa[i]->checkPkcs1v15(
+                    pText[i], textSize[i], encoded[l], pValid[i]);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
+        }
+    }
+
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::verifyPssBatch(Rsa* const         pRsa[],
+                       const Uint8* const pText[],
+                       const Uint64       textSize[],
+                       const Uint8* const pSignText[],
+                       bool               pValid[],
+                       Uint64             num)
+{
+    Status status =
+        checkBatchArgs(pRsa, pText, textSize, pSignText, pValid, num);
+    if (!status.ok()) {
+        return status;
+    }
+
+    alignas(64) Uint8 encoded[RsaBatchSize][T / 8];
+    Uint8*            p_encoded[RsaBatchSize];
+    for (Uint64 l = 0; l < RsaBatchSize; l++) {
+        p_encoded[l] = encoded[l];
+    }
+
+    for (Uint64 done = 0; done < num; done += RsaBatchSize) {
+        Uint64 count = std::min(num - done, RsaBatchSize);
+
+        status = openSignatureBatch(
+            pRsa + done, pSignText + done, p_encoded, pValid + done, count);
+        if (!status.ok()) {
+            return status;
+        }
+
+        for (Uint64 l = 0, i = done; l < count; l++, i++) {
+            if (pValid[i]) {
+                status = pRsa[i]->checkPss(
+                    pText[i], textSize[i], encoded[l], pValid[i]);
+                if (!status.ok()) {
+                    return status;
+                }
+            }
+        }
+    }
+
+    return StatusOk();
+}
+
 template<alc_rsa_key_size T>
 Status
 Rsa<T>::getPublickey(RsaPublicKey& pPublicKey)
@@ -424,13 +1412,13 @@ Rsa<T>::getPublickey(RsaPublicKey& pPublicKey)
     if (pPublicKey.size != m_key_size) {
         return status::NotPermitted("keyize should match");
     }
-    Uint8* mod_text = reinterpret_cast<Uint8*>(m_pub_key.m_mod.get());
-
-    if (pPublicKey.modulus == nullptr || mod_text == nullptr) {
+    if (pPublicKey.modulus == nullptr || !m_pub) {
         return status::NotPermitted("Modulus cannot be empty");
     }
 
-    pPublicKey.public_exponent = m_pub_key.m_public_exponent;
+    Uint8* mod_text = reinterpret_cast<Uint8*>(m_pub->m_key.m_mod.get());
+
+    pPublicKey.public_exponent = m_pub->m_key.m_public_exponent;
 
     for (Int64 i = m_key_size - 1, j = 0; i >= 0; --i, ++j) {
         pPublicKey.modulus[j] = mod_text[i];
@@ -441,43 +1429,191 @@ Rsa<T>::getPublickey(RsaPublicKey& pPublicKey)
 
 template<alc_rsa_key_size T>
 Status
-Rsa<T>::setPublicKey(const Uint64 exponent, const Uint8* mod, const Uint64 size)
+Rsa<T>::createPublicKey(const Uint64                       exponent,
+                        const Uint8*                       mod,
+                        const Uint64                       size,
+                        std::shared_ptr<RsaPublicKeyData>& key)
 {
     if (!mod || exponent == 0) {
         return status::NotPermitted("Invalid public key");
     }
 
-    if (!(size == 128 || size == 256)) {
+    if (size != T / 8) {
+        return status::NotPermitted("Key sizes not supported currently");
+    }
+
+    auto pub = std::make_shared<RsaPublicKeyData>();
+
+    pub->m_key.m_public_exponent = exponent;
+    pub->m_key.m_mod.reset(CreateBigNum(mod, size));
+    pub->m_key.m_size = size / 8;
+
+    GetKernels<T>().createContext(
+        pub->m_context, pub->m_key.m_mod.get(), pub->m_key.m_size);
+
+    key = std::move(pub);
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::createPrivateKey(const Uint8*                        dp,
+                         const Uint8*                        dq,
+                         const Uint8*                        p,
+                         const Uint8*                        q,
+                         const Uint8*                        qinv,
+                         const Uint8*                        mod,
+                         const Uint64                        size,
+                         std::shared_ptr<RsaPrivateKeyData>& key)
+{
+    if (!dp || !dq || !p || !q || !mod) {
+        return status::NotPermitted("Invalid private key");
+    }
+
+    if (size != T / 16) {
         return status::NotPermitted("Key sizes not supported currently");
     }
 
-    m_pub_key.m_public_exponent = exponent;
-    m_pub_key.m_mod.reset(CreateBigNum(mod, size));
-    m_pub_key.m_size           = size / 8;
-    m_key_size                 = size;
-    static bool zen4_available = CpuId::cpuIsZen4();
-    static bool zen3_available = CpuId::cpuIsZen3();
-    static bool zen_available  = CpuId::cpuIsZen1() || CpuId::cpuIsZen2();
-    static bool zen_available_flags =
-        CpuId::cpuHasAdx() && CpuId::cpuHasAvx2() && CpuId::cpuHasBmi2();
+    auto priv = std::make_shared<RsaPrivateKeyData>();
 
-    if (zen4_available) {
-        zen4::archCreateContext<T>(
-            m_context_pub, m_pub_key.m_mod.get(), m_pub_key.m_size);
+    priv->m_key.m_dp.reset(CreateBigNum(dp, size));
+    priv->m_key.m_dq.reset(CreateBigNum(dq, size));
+    priv->m_key.m_p.reset(CreateBigNum(p, size));
+    priv->m_key.m_q.reset(CreateBigNum(q, size));
+    priv->m_key.m_qinv.reset(CreateBigNum(qinv, size));
+    priv->m_key.m_mod.reset(CreateBigNum(mod, size * 2));
+    priv->m_key.m_size = size / 8;
 
-    } else if (zen3_available) {
-        zen3::archCreateContext<T>(
-            m_context_pub, m_pub_key.m_mod.get(), m_pub_key.m_size);
+    auto& kernels = GetKernels<T>();
+    kernels.createContext(
+        priv->m_context_p, priv->m_key.m_p.get(), priv->m_key.m_size);
+    kernels.createContext(
+        priv->m_context_q, priv->m_key.m_q.get(), priv->m_key.m_size);
 
-    } else if (zen_available || zen_available_flags) {
-        zen::archCreateContext<T>(
-            m_context_pub, m_pub_key.m_mod.get(), m_pub_key.m_size);
+    key = std::move(priv);
+    return StatusOk();
+}
 
-    } else {
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::generateKey(const Uint64                        exponent,
+                    std::shared_ptr<RsaPublicKeyData>&  pub,
+                    std::shared_ptr<RsaPrivateKeyData>& priv)
+{
+    if (T < KEY_SIZE_2048) {
+        return status::NotPermitted("Key sizes not supported currently");
+    }
 
-        archCreateContext<T>(
-            m_context_pub, m_pub_key.m_mod.get(), m_pub_key.m_size);
+    if (exponent < 3 || (exponent & 1) == 0) {
+        return status::NotPermitted("Invalid public key");
     }
+
+    constexpr Uint64 size = T / 128;
+    // FIPS 186-5 A.1.3, |p - q| > 2^(T / 2 - 100)
+    constexpr Uint64 MinDiffBit = T / 2 - 100;
+
+    alignas(64) Uint64 p[size], q[size], diff[size], dp[size], dq[size];
+    alignas(64) Uint64 qinv[size], tmp[size], mod[size * 2]{};
+    rng::SystemRng     rng;
+
+    Status status = GeneratePrime<T>(p, exponent, rng);
+    bool   apart  = false;
+    while (status.ok() && !apart) {
+        status = GeneratePrime<T>(q, exponent, rng);
+        if (IsLess(p, q, size)) {
+            std::swap_ranges(p, p + size, q);
+        }
+        mont::MontCompute<T>::SubBigNum(diff, p, q, size);
+        apart = (diff[MinDiffBit / 64] >> (MinDiffBit % 64)) != 0;
+        for (Uint64 i = MinDiffBit / 64 + 1; i < size; i++) {
+            apart |= diff[i] != 0;
+        }
+    }
+    if (!status.ok()) {
+        Reset(p, size);
+        Reset(q, size);
+        return status;
+    }
+
+    mont::MontCompute<T>::mul(mod, p, size, q, size);
+
+    // p and q are odd, so p - 1 and q - 1 only clear the low bit
+    alcp::utils::CopyChunk(tmp, p, size * 8);
+    tmp[0] &= ~1ULL;
+    InverseOfExponent<T>(dp, tmp, exponent);
+    alcp::utils::CopyChunk(tmp, q, size * 8);
+    tmp[0] &= ~1ULL;
+    InverseOfExponent<T>(dq, tmp, exponent);
+
+    // qinv = q^(p - 2) mod p, q is already less than p
+    Uint64 two[size]{ 2 };
+    mont::MontCompute<T>::SubBigNum(tmp, p, two, size);
+    MontContextBignum context_p;
+    auto&             kernels = GetKernels<T>();
+    kernels.createContext(context_p, p, size);
+    kernels.modExpHalf(qinv, q, tmp, p, context_p);
+
+    Uint8 bytes[6][T / 16], mod_bytes[T / 8];
+    BigNumToBytes(bytes[0], dp, T / 16);
+    BigNumToBytes(bytes[1], dq, T / 16);
+    BigNumToBytes(bytes[2], p, T / 16);
+    BigNumToBytes(bytes[3], q, T / 16);
+    BigNumToBytes(bytes[4], qinv, T / 16);
+    BigNumToBytes(mod_bytes, mod, T / 8);
+
+    status = createPublicKey(exponent, mod_bytes, T / 8, pub);
+    if (status.ok()) {
+        status = createPrivateKey(bytes[0],
+                                  bytes[1],
+                                  bytes[2],
+                                  bytes[3],
+                                  bytes[4],
+                                  mod_bytes,
+                                  T / 16,
+                                  priv);
+    }
+
+    Reset(p, size);
+    Reset(q, size);
+    Reset(dp, size);
+    Reset(dq, size);
+    Reset(qinv, size);
+    Reset(tmp, size);
+    Reset(bytes, sizeof(bytes) / 8);
+    return status;
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::setKey(std::shared_ptr<RsaPublicKeyData>  pub,
+               std::shared_ptr<RsaPrivateKeyData> priv)
+{
+    if (pub && pub->m_key.m_size * 64 != T) {
+        return status::NotPermitted("Key sizes not supported currently");
+    }
+
+    if (priv && priv->m_key.m_size * 128 != T) {
+        return status::NotPermitted("Key sizes not supported currently");
+    }
+
+    m_pub  = std::move(pub);
+    m_priv = std::move(priv);
+    return StatusOk();
+}
+
+template<alc_rsa_key_size T>
+Status
+Rsa<T>::setPublicKey(const Uint64 exponent, const Uint8* mod, const Uint64 size)
+{
+    std::shared_ptr<RsaPublicKeyData> pub;
+
+    Status status = createPublicKey(exponent, mod, size, pub);
+    if (!status.ok()) {
+        return status;
+    }
+
+    m_pub      = std::move(pub);
+    m_key_size = size;
     return StatusOk();
 }
 
@@ -491,52 +1627,15 @@ Rsa<T>::setPrivateKey(const Uint8* dp,
                       const Uint8* mod,
                       const Uint64 size)
 {
-    if (!dp || !dq || !p || !q || !mod) {
-        return status::NotPermitted("Invalid private key");
-    }
+    std::shared_ptr<RsaPrivateKeyData> priv;
 
-    if (!(size == 128 || size == 64)) {
-        return status::NotPermitted("Key sizes not supported currently");
+    Status status = createPrivateKey(dp, dq, p, q, qinv, mod, size, priv);
+    if (!status.ok()) {
+        return status;
     }
 
+    m_priv     = std::move(priv);
     m_key_size = size * 2; // keysize is twice the sizeof(p)
-
-    m_priv_key.m_dp.reset(CreateBigNum(dp, size));
-    m_priv_key.m_dq.reset(CreateBigNum(dq, size));
-    m_priv_key.m_p.reset(CreateBigNum(p, size));
-    m_priv_key.m_q.reset(CreateBigNum(q, size));
-    m_priv_key.m_qinv.reset(CreateBigNum(qinv, size));
-    m_priv_key.m_mod.reset(CreateBigNum(mod, size * 2));
-    m_priv_key.m_size = size / 8;
-
-    static bool zen4_available = CpuId::cpuIsZen4();
-    static bool zen3_available = CpuId::cpuIsZen3();
-    static bool zen_available  = CpuId::cpuIsZen1() || CpuId::cpuIsZen2();
-    static bool zen_available_flags =
-        CpuId::cpuHasAdx() && CpuId::cpuHasAvx2() && CpuId::cpuHasBmi2();
-
-    if (zen4_available) {
-        zen4::archCreateContext<T>(
-            m_context_p, m_priv_key.m_p.get(), m_priv_key.m_size);
-        zen4::archCreateContext<T>(
-            m_context_q, m_priv_key.m_q.get(), m_priv_key.m_size);
-    } else if (zen3_available) {
-        zen3::archCreateContext<T>(
-            m_context_p, m_priv_key.m_p.get(), m_priv_key.m_size);
-        zen3::archCreateContext<T>(
-            m_context_q, m_priv_key.m_q.get(), m_priv_key.m_size);
-    } else if (zen_available || zen_available_flags) {
-        zen::archCreateContext<T>(
-            m_context_p, m_priv_key.m_p.get(), m_priv_key.m_size);
-        zen::archCreateContext<T>(
-            m_context_q, m_priv_key.m_q.get(), m_priv_key.m_size);
-    } else {
-
-        archCreateContext<T>(
-            m_context_p, m_priv_key.m_p.get(), m_priv_key.m_size);
-        archCreateContext<T>(
-            m_context_q, m_priv_key.m_q.get(), m_priv_key.m_size);
-    }
     return StatusOk();
 }
 
@@ -544,16 +1643,24 @@ template<alc_rsa_key_size T>
 void
 Rsa<T>::reset()
 {
-    Reset(m_priv_key.m_dp.get(), T / (2 * 64));
-    Reset(m_priv_key.m_dq.get(), T / (2 * 64));
-    Reset(m_priv_key.m_mod.get(), T / (64));
-    Reset(m_priv_key.m_p.get(), T / (2 * 64));
-    Reset(m_priv_key.m_q.get(), T / (2 * 64));
-    Reset(m_priv_key.m_qinv.get(), T / (2 * 64));
-    Reset(m_pub_key.m_mod.get(), T / (64));
-    Reset(m_context_pub.m_mod_radix_52_bit.get(), T / 52 + 1);
-    Reset(m_context_p.m_mod_radix_52_bit.get(), T / (2 * 52) + 1);
-    Reset(m_context_q.m_mod_radix_52_bit.get(), T / (2 * 52) + 1);
+    // the key may still be in use by other objects, it is wiped once the
+    // last of them lets go of it
+    m_pub.reset();
+    m_priv.reset();
+}
+
+RsaPrivateKeyData::~RsaPrivateKeyData()
+{
+    const Uint64 size = m_key.m_size;
+
+    Reset(m_key.m_dp.get(), size);
+    Reset(m_key.m_dq.get(), size);
+    Reset(m_key.m_mod.get(), size * 2);
+    Reset(m_key.m_p.get(), size);
+    Reset(m_key.m_q.get(), size);
+    Reset(m_key.m_qinv.get(), size);
+    Reset(m_context_p.m_mod_radix_52_bit.get(), size * 64 / 52 + 1);
+    Reset(m_context_q.m_mod_radix_52_bit.get(), size * 64 / 52 + 1);
 }
 
 template<alc_rsa_key_size T>
@@ -564,4 +1671,6 @@ Rsa<T>::getKeySize()
 }
 template class Rsa<KEY_SIZE_1024>;
 template class Rsa<KEY_SIZE_2048>;
+template class Rsa<KEY_SIZE_3072>;
+template class Rsa<KEY_SIZE_4096>;
 } // namespace alcp::rsa
\ No newline at end of file
@@ -28,6 +28,7 @@
 
 #include <gtest/gtest.h>
 #include <string.h>
+#include <vector>
 
 #include "alcp/base.hh"
 #include "alcp/digest/sha2.hh"
@@ -197,6 +198,307 @@ static const Uint8 Q_ModulusINV_2048[] = {
     0x49, 0x41, 0x2e, 0xd9, 0xc0, 0xe6, 0xd2, 0xc8
 };
 
+static const Uint8 Modulus_3072[] = {
+    0xd2, 0xbb, 0xe2, 0xa7, 0x4b, 0x4a, 0xfe, 0x98, 0xd3, 0x29, 0xa1, 0x44,
+    0x0d, 0xf3, 0xda, 0xa1, 0x43, 0xf9, 0xaa, 0x61, 0x33, 0x5d, 0x11, 0xf0,
+    0x9a, 0x5c, 0xb1, 0xa0, 0x6f, 0x4d, 0xbf, 0x3a, 0xf6, 0xc8, 0x41, 0xdb,
+    0x87, 0xee, 0x37, 0xcc, 0xe4, 0x45, 0x7e, 0x93, 0xde, 0x47, 0x55, 0x5b,
+    0xce, 0x3f, 0x2a, 0x0c, 0x32, 0x87, 0x71, 0x51, 0x12, 0xbb, 0x21, 0x01,
+    0x4e, 0xe6, 0xb0, 0xdd, 0x82, 0xa8, 0x79, 0x5f, 0x49, 0x2a, 0xea, 0xe2,
+    0x1d, 0x99, 0x2a, 0xd7, 0x84, 0x26, 0x84, 0x5c, 0x78, 0xef, 0x70, 0x99,
+    0x77, 0x52, 0x2f, 0x27, 0x7e, 0xf8, 0x83, 0x5c, 0x4d, 0x14, 0x3e, 0x21,
+    0xd3, 0xf1, 0x31, 0x0a, 0x46, 0xbb, 0xc5, 0x81, 0xc7, 0x1c, 0x53, 0xab,
+    0x55, 0xa7, 0xf3, 0x26, 0x95, 0x73, 0xc5, 0x0e, 0x6d, 0xa0, 0xa4, 0x49,
+    0xa2, 0xe8, 0xa8, 0x79, 0x4f, 0x7e, 0xc3, 0x23, 0xde, 0x35, 0x3e, 0xf2,
+    0x41, 0x1e, 0xa7, 0xf5, 0xb2, 0xa2, 0xad, 0xea, 0x70, 0xc2, 0x95, 0xf1,
+    0x68, 0x0a, 0x7a, 0x20, 0xb6, 0x4d, 0x17, 0xce, 0x24, 0x88, 0x3d, 0x55,
+    0x02, 0x3c, 0x45, 0x9a, 0x06, 0xfc, 0xdd, 0x4a, 0xef, 0xd6, 0x8f, 0x01,
+    0xdf, 0x8e, 0x32, 0x16, 0x3e, 0xf6, 0x59, 0x01, 0x21, 0x79, 0x90, 0xdb,
+    0x7f, 0xe7, 0x1d, 0xfe, 0xf4, 0x07, 0x64, 0xab, 0x22, 0x2c, 0x3a, 0xd3,
+    0x7d, 0x06, 0x2f, 0x38, 0x4e, 0x93, 0x87, 0xdd, 0x0c, 0xdf, 0x5d, 0x97,
+    0x37, 0x37, 0xde, 0xf5, 0xe4, 0x7d, 0xd4, 0xb4, 0x24, 0xc8, 0xec, 0x75,
+    0x97, 0xf2, 0x34, 0x84, 0x0f, 0x90, 0xe1, 0x48, 0x4e, 0x7f, 0x6e, 0x04,
+    0x2f, 0xef, 0x2f, 0x18, 0xa3, 0x0f, 0x4b, 0xfd, 0xa5, 0x9d, 0x99, 0x25,
+    0x89, 0xd9, 0x4a, 0x4b, 0x3f, 0xd0, 0x4d, 0xb6, 0xcd, 0x8a, 0x40, 0xf4,
+    0x33, 0x8b, 0x32, 0xc1, 0xe8, 0xc2, 0x46, 0xb7, 0xb2, 0x60, 0x79, 0xb5,
+    0xf5, 0x65, 0x64, 0xd5, 0x0a, 0x59, 0xa8, 0x82, 0xfe, 0x32, 0xa3, 0xc1,
+    0xff, 0x8b, 0xfb, 0x9f, 0xd9, 0xd1, 0xff, 0xdb, 0xd3, 0x17, 0x7d, 0xc6,
+    0x63, 0xb9, 0xb0, 0xcd, 0xa1, 0x54, 0x72, 0x29, 0x0f, 0x5f, 0x71, 0xe5,
+    0x53, 0x7f, 0x2b, 0xc4, 0x80, 0x3c, 0x7f, 0x2c, 0xe7, 0xab, 0x99, 0xa2,
+    0x89, 0x7c, 0x05, 0x04, 0xf6, 0xf1, 0x58, 0x1b, 0x85, 0x4a, 0xca, 0xbf,
+    0x93, 0x5c, 0x65, 0xe1, 0x44, 0xda, 0x39, 0xeb, 0xec, 0x23, 0x14, 0x1c,
+    0x64, 0x99, 0xca, 0x69, 0x41, 0x03, 0xfb, 0xa4, 0xc1, 0xed, 0xf4, 0x16,
+    0x3b, 0xd8, 0x61, 0x41, 0x2b, 0x31, 0x83, 0xc9, 0xad, 0xa4, 0x4e, 0x5b,
+    0x7e, 0x0b, 0xe7, 0x6e, 0xaf, 0xee, 0xb8, 0xc6, 0x1d, 0xb1, 0xb5, 0xda,
+    0x22, 0x92, 0xc1, 0x93, 0x38, 0xa1, 0x80, 0x03, 0x08, 0x1e, 0xb2, 0x6b
+};
+
+static const Uint8 P_Modulus_3072[] = {
+    0xf5, 0x33, 0xcc, 0x19, 0xcc, 0x3f, 0x84, 0xdd, 0x2f, 0x15, 0x49, 0x03,
+    0x33, 0xa3, 0x00, 0x64, 0x87, 0x98, 0x3f, 0xdf, 0x66, 0x99, 0x07, 0x57,
+    0xd3, 0xc4, 0x87, 0x10, 0x72, 0xc3, 0x43, 0x82, 0x5c, 0x60, 0x2e, 0x7a,
+    0x68, 0x2b, 0x60, 0x37, 0xb9, 0x14, 0xb0, 0x03, 0x68, 0x60, 0xf2, 0xe9,
+    0xfa, 0xbd, 0x2b, 0x1e, 0x02, 0xdc, 0x5f, 0x7c, 0xf8, 0xbd, 0x4a, 0xba,
+    0x88, 0xee, 0xb0, 0xaa, 0x87, 0xbb, 0x9f, 0xa5, 0x18, 0xd2, 0x43, 0xfb,
+    0x2c, 0x0d, 0x8c, 0x10, 0x5c, 0x59, 0xc1, 0x92, 0x3e, 0xfb, 0xb1, 0xdb,
+    0xcc, 0x1a, 0x0a, 0x13, 0x90, 0x7b, 0x97, 0x6a, 0xe1, 0x18, 0x82, 0x74,
+    0x7a, 0x95, 0x6b, 0x50, 0x55, 0x3c, 0x6f, 0xbe, 0x93, 0xe7, 0xe7, 0xb0,
+    0xaa, 0x2a, 0xeb, 0x24, 0x6c, 0xd9, 0xb3, 0x6e, 0x2f, 0x54, 0x0b, 0xef,
+    0x80, 0x16, 0x7c, 0xc5, 0x31, 0xa0, 0x90, 0x07, 0x7a, 0xc5, 0xdd, 0xb8,
+    0x3d, 0x82, 0x59, 0xf3, 0xba, 0x9f, 0xdc, 0x99, 0x55, 0x3d, 0x85, 0x20,
+    0x32, 0x0c, 0x2e, 0xc0, 0x97, 0x0c, 0xbe, 0xef, 0xe0, 0xc6, 0xfb, 0xd7,
+    0x8b, 0xfa, 0xa4, 0xc4, 0xc5, 0xd0, 0xec, 0xd5, 0xee, 0x68, 0xb1, 0x2e,
+    0x36, 0xff, 0xd0, 0x59, 0x79, 0x0e, 0x2c, 0x48, 0xca, 0x61, 0x4d, 0x4e,
+    0x1d, 0x8e, 0x20, 0xe4, 0xcc, 0xa7, 0x8a, 0x04, 0x3a, 0x2b, 0x55, 0x19
+};
+
+static const Uint8 Q_Modulus_3072[] = {
+    0xdc, 0x03, 0x85, 0x44, 0xb8, 0x73, 0x04, 0xf3, 0x27, 0x1c, 0x57, 0x45,
+    0x6c, 0xb5, 0x14, 0x90, 0x54, 0x4d, 0x0c, 0xb1, 0x0a, 0xc6, 0x3f, 0xa3,
+    0xb3, 0x1d, 0x8c, 0x3f, 0xf3, 0x56, 0x43, 0x42, 0x71, 0xac, 0x05, 0x87,
+    0x29, 0xd2, 0x0d, 0xcd, 0x46, 0x2a, 0xc9, 0xfd, 0x82, 0x1a, 0x7d, 0xd8,
+    0xda, 0x16, 0x6d, 0xf7, 0xd1, 0xe8, 0x3e, 0xe1, 0x31, 0xd0, 0x53, 0x37,
+    0x8d, 0x65, 0xa9, 0x13, 0x30, 0xc0, 0xa8, 0xe6, 0x66, 0xdb, 0x08, 0xfb,
+    0x5b, 0xef, 0x43, 0x35, 0xfb, 0x7f, 0x31, 0xb6, 0x67, 0x86, 0xc7, 0x69,
+    0x57, 0x52, 0xcb, 0xa0, 0xff, 0xdb, 0x2b, 0xf1, 0x86, 0x36, 0x5b, 0xab,
+    0x68, 0xab, 0xd7, 0x52, 0x9d, 0xe7, 0x64, 0x82, 0x64, 0x19, 0xb7, 0xba,
+    0x01, 0x49, 0xd2, 0x52, 0x7f, 0x23, 0xbe, 0xfd, 0x71, 0x16, 0x6d, 0x8a,
+    0xcc, 0x4a, 0x57, 0x88, 0x92, 0x15, 0xd7, 0xe8, 0x7a, 0x36, 0x9c, 0x1f,
+    0x74, 0x5a, 0xa2, 0x3d, 0x29, 0x71, 0x70, 0xd2, 0xed, 0x2a, 0x46, 0x19,
+    0x05, 0x77, 0xe0, 0x0b, 0xf3, 0xdc, 0xa0, 0xbf, 0xaa, 0x48, 0x8c, 0xb9,
+    0x9d, 0xbb, 0xb9, 0xc7, 0x99, 0x22, 0xc8, 0xbf, 0x99, 0x8f, 0xd7, 0xb0,
+    0xfb, 0x91, 0x3c, 0x1b, 0x34, 0xf8, 0xc5, 0xee, 0xa2, 0xeb, 0x34, 0x4a,
+    0x36, 0x5f, 0xee, 0x2f, 0xb1, 0x47, 0x3f, 0x2c, 0xed, 0x74, 0x90, 0x23
+};
+
+static const Uint8 DP_EXP_3072[] = {
+    0x61, 0x7c, 0x9e, 0x81, 0x03, 0x3b, 0x9d, 0xcf, 0x72, 0x90, 0xbb, 0xde,
+    0x92, 0x01, 0x14, 0x7e, 0xe3, 0x8a, 0x1c, 0x9a, 0xed, 0x67, 0x9a, 0x0b,
+    0xc9, 0x1e, 0x31, 0xb4, 0xd0, 0x6b, 0xe1, 0xc3, 0x4a, 0x86, 0xd2, 0xf3,
+    0xc7, 0xc6, 0xb7, 0x12, 0x70, 0x7b, 0x51, 0x1f, 0x89, 0xb8, 0x41, 0xdb,
+    0xd4, 0xdc, 0xb0, 0xef, 0xd5, 0xa3, 0x58, 0x33, 0x8f, 0x91, 0x72, 0xcc,
+    0x86, 0xf4, 0x9f, 0x38, 0xad, 0x8e, 0x63, 0x02, 0x78, 0xc3, 0xe0, 0x53,
+    0x54, 0x48, 0x6e, 0x8f, 0x72, 0xa8, 0x1c, 0xd5, 0xd0, 0x44, 0xb1, 0x89,
+    0xf9, 0xb3, 0xc0, 0x9d, 0xd6, 0xab, 0xcc, 0x9f, 0xa9, 0xae, 0xdc, 0xef,
+    0x02, 0x6d, 0xb5, 0xa4, 0xd2, 0xbe, 0x9c, 0x8e, 0xe0, 0xaf, 0x2a, 0xe6,
+    0x8a, 0x41, 0x56, 0x0b, 0xbd, 0x5b, 0x30, 0x83, 0x76, 0x3d, 0xac, 0x21,
+    0x24, 0x83, 0xcc, 0x47, 0x7a, 0x5b, 0xa3, 0xe7, 0xd5, 0x60, 0x25, 0xae,
+    0xc2, 0x85, 0xb8, 0xcd, 0xb6, 0x3d, 0x28, 0xaf, 0xad, 0xbc, 0x2f, 0xd9,
+    0x85, 0x0c, 0x62, 0xea, 0x1f, 0x23, 0xea, 0x25, 0xe4, 0xf0, 0x37, 0xe0,
+    0x92, 0xbe, 0xac, 0x13, 0xaf, 0xb2, 0x48, 0xf7, 0x25, 0x3a, 0x6a, 0x77,
+    0x3d, 0x56, 0xa7, 0xb7, 0x6a, 0xf1, 0xbf, 0x99, 0x91, 0x1c, 0xee, 0x67,
+    0x48, 0x48, 0xe1, 0xbb, 0x15, 0xc2, 0xe6, 0x94, 0x97, 0xab, 0xf2, 0xc1
+};
+
+static const Uint8 DQ_EXP_3072[] = {
+    0x82, 0x4e, 0x37, 0x7d, 0x16, 0xfd, 0x50, 0x5e, 0x2e, 0xb8, 0xd3, 0x5b,
+    0x53, 0xe1, 0xff, 0xb6, 0xe7, 0xa6, 0xe6, 0xb0, 0x68, 0xa0, 0x38, 0x0a,
+    0xdd, 0x47, 0xcf, 0xcc, 0x04, 0x73, 0xff, 0xcb, 0xf7, 0x85, 0x19, 0x95,
+    0x0f, 0x08, 0xd0, 0x91, 0xd6, 0x4f, 0xfb, 0x68, 0x00, 0xc9, 0x6d, 0xe5,
+    0xa4, 0x6d, 0x0a, 0x5e, 0x6f, 0x5c, 0xec, 0xf8, 0xf5, 0x46, 0xdc, 0x32,
+    0x97, 0xb5, 0x31, 0x29, 0x23, 0x83, 0xc7, 0xc5, 0x06, 0x00, 0x0e, 0x56,
+    0xc9, 0x01, 0x71, 0x3e, 0x24, 0xa1, 0x15, 0xb1, 0x61, 0xa9, 0x6a, 0xab,
+    0x92, 0x43, 0x80, 0x44, 0xef, 0xa4, 0x40, 0x67, 0x80, 0xc4, 0xeb, 0x10,
+    0x1f, 0x23, 0x3f, 0x99, 0x37, 0xda, 0x57, 0x25, 0xfe, 0xe1, 0x58, 0x76,
+    0x7a, 0xd2, 0xdd, 0x15, 0x6d, 0x25, 0x9f, 0xb5, 0x7d, 0x67, 0xfa, 0x22,
+    0xed, 0x91, 0xce, 0x3c, 0x1d, 0xc1, 0x80, 0x29, 0xb9, 0x50, 0x64, 0xb1,
+    0x20, 0x79, 0x99, 0x83, 0x3d, 0xeb, 0x69, 0x16, 0x13, 0xcf, 0x28, 0xcb,
+    0x22, 0xf8, 0xf7, 0xa2, 0x3c, 0xa1, 0x5c, 0x37, 0x88, 0x44, 0x05, 0xcc,
+    0xdd, 0x85, 0xd4, 0xa7, 0x49, 0xa4, 0x57, 0x5f, 0x5b, 0x34, 0xdd, 0x5b,
+    0x7d, 0xf3, 0x6b, 0xb4, 0xf5, 0x6f, 0xad, 0xd3, 0x03, 0x7c, 0xe8, 0x70,
+    0x57, 0xba, 0x03, 0x59, 0x0d, 0xd7, 0x13, 0xac, 0xa9, 0x4a, 0x93, 0x1f
+};
+
+static const Uint8 Q_ModulusINV_3072[] = {
+    0x58, 0x03, 0x4a, 0x33, 0x3c, 0x26, 0xa1, 0x3c, 0x88, 0x30, 0x73, 0x93,
+    0x42, 0xd6, 0x38, 0x93, 0xd9, 0xff, 0x80, 0x33, 0x81, 0x2c, 0x2c, 0x62,
+    0xb4, 0x67, 0x1b, 0xd8, 0xe7, 0x6a, 0xe1, 0x25, 0xe4, 0x5a, 0x7f, 0x59,
+    0x77, 0x53, 0x54, 0xcd, 0xe9, 0x1a, 0xc5, 0x6d, 0xf5, 0x61, 0xf0, 0xc2,
+    0x54, 0x8e, 0xe5, 0x1f, 0x48, 0x5f, 0x58, 0x52, 0xc6, 0x34, 0x62, 0x97,
+    0x58, 0xd2, 0x1b, 0x68, 0xd0, 0xb8, 0xba, 0x81, 0x12, 0x3e, 0x09, 0x29,
+    0xfe, 0x98, 0x96, 0xcf, 0x98, 0xaf, 0xc4, 0x80, 0x41, 0x01, 0x00, 0x8c,
+    0x8e, 0x12, 0xc3, 0x73, 0x4a, 0xcc, 0x92, 0x0c, 0x90, 0xf7, 0x80, 0x4d,
+    0x07, 0x5d, 0x1d, 0x54, 0xb7, 0xc8, 0x26, 0x52, 0x93, 0xb5, 0xbf, 0x27,
+    0xf7, 0x62, 0xd7, 0x64, 0x8b, 0x31, 0xcf, 0x79, 0x13, 0x65, 0x06, 0x8f,
+    0xed, 0x20, 0x74, 0x50, 0xe8, 0x2e, 0x37, 0x96, 0xd5, 0x52, 0x57, 0xe0,
+    0xc2, 0x13, 0xed, 0xf9, 0x4b, 0xa1, 0x2d, 0x25, 0x54, 0x62, 0xea, 0x57,
+    0xb2, 0x88, 0x6f, 0x69, 0x75, 0x03, 0x58, 0xb4, 0x45, 0x78, 0x76, 0x5b,
+    0x13, 0x8d, 0xeb, 0x79, 0xd6, 0x86, 0xe4, 0xc9, 0xd2, 0x0d, 0xbb, 0x47,
+    0x58, 0x74, 0x8b, 0xe5, 0x6d, 0x40, 0x19, 0x3b, 0x5e, 0x4b, 0x69, 0x1a,
+    0xad, 0x87, 0x39, 0x4e, 0x67, 0xa6, 0xe8, 0xc1, 0x5f, 0x86, 0xe1, 0x80
+};
+
+static const Uint8 Modulus_4096[] = {
+    0xa7, 0x82, 0x1b, 0x19, 0x09, 0xae, 0x8b, 0x91, 0xdb, 0x71, 0xd8, 0x5e,
+    0xd4, 0xb7, 0x92, 0x85, 0x90, 0x67, 0x87, 0xaa, 0x7e, 0xfd, 0xe1, 0xd6,
+    0x7a, 0x4a, 0x6f, 0x21, 0xee, 0x7f, 0xa4, 0xdc, 0xaf, 0xec, 0x59, 0xaf,
+    0x3b, 0xc6, 0xb9, 0x8d, 0x84, 0xd2, 0xce, 0xe2, 0x50, 0x78, 0x36, 0xa4,
+    0x86, 0x77, 0x0a, 0x05, 0x3b, 0xa9, 0x20, 0x21, 0xca, 0xe5, 0xde, 0xac,
+    0x86, 0xb0, 0x65, 0x91, 0x87, 0x4c, 0x45, 0xb0, 0x1d, 0x47, 0x50, 0xe5,
+    0x53, 0x44, 0x45, 0x1e, 0x22, 0x27, 0x88, 0x3b, 0x2e, 0xbe, 0x67, 0x0f,
+    0x9a, 0xdd, 0xde, 0x8a, 0xec, 0x2b, 0x02, 0x0d, 0xe2, 0xac, 0x2f, 0x8d,
+    0xe2, 0x80, 0x3d, 0x03, 0x15, 0x37, 0x0d, 0x65, 0x2f, 0x43, 0x2c, 0x9b,
+    0x01, 0xc2, 0x6b, 0xcc, 0xdc, 0xd4, 0x3e, 0xbc, 0x41, 0x11, 0x4c, 0xfb,
+    0x01, 0xf8, 0x50, 0x94, 0x21, 0x7b, 0xb6, 0x87, 0x35, 0xff, 0x71, 0x34,
+    0x54, 0x86, 0xe8, 0x2e, 0x20, 0xe9, 0x71, 0x60, 0x0a, 0xa1, 0x55, 0x01,
+    0x9d, 0x1c, 0xce, 0xbf, 0x91, 0x2b, 0x8e, 0x16, 0x99, 0xad, 0xaa, 0x54,
+    0xb2, 0x1b, 0x1b, 0x0e, 0x48, 0xd7, 0x47, 0x1c, 0x5d, 0x07, 0xc7, 0x69,
+    0xbb, 0x99, 0x63, 0x39, 0x87, 0xfb, 0x13, 0xf2, 0x09, 0x22, 0x97, 0xfe,
+    0xbb, 0xc2, 0xe5, 0x73, 0xbb, 0xa9, 0x4c, 0xb8, 0xbf, 0x20, 0x02, 0x37,
+    0x79, 0x7c, 0xe8, 0xb9, 0xfd, 0x10, 0x62, 0x8e, 0x05, 0x12, 0x1a, 0xdf,
+    0xbb, 0xbd, 0x8d, 0xc6, 0xa3, 0xb2, 0x4a, 0x63, 0xe2, 0x98, 0x32, 0x87,
+    0xcd, 0x53, 0xd4, 0xa1, 0x6f, 0x29, 0xcb, 0x09, 0x29, 0x4f, 0x24, 0xf5,
+    0xd1, 0xb3, 0x86, 0xa6, 0x78, 0x41, 0xbf, 0x00, 0xdd, 0x5e, 0x19, 0xa3,
+    0xb8, 0x88, 0x3b, 0xc3, 0x78, 0xb4, 0xcc, 0xdd, 0xbe, 0x43, 0xbf, 0xdb,
+    0x6f, 0x92, 0x9b, 0x18, 0x34, 0x4c, 0x55, 0x21, 0x84, 0xbe, 0x69, 0x27,
+    0x58, 0x72, 0x0e, 0x81, 0xea, 0xad, 0x35, 0x36, 0x5e, 0xea, 0xb8, 0xe5,
+    0xf1, 0x8e, 0xcc, 0x41, 0xd7, 0xfc, 0xc2, 0x5c, 0xa3, 0x53, 0xb4, 0x73,
+    0x7a, 0xbf, 0xf2, 0x82, 0xe7, 0xfc, 0x9e, 0x2f, 0x48, 0xab, 0xe0, 0x3f,
+    0xae, 0xf8, 0xb4, 0x70, 0x97, 0xd3, 0x3b, 0x6e, 0x8d, 0xdf, 0xca, 0xf6,
+    0xc3, 0xc5, 0x18, 0x55, 0xdd, 0xd7, 0xba, 0xf6, 0x48, 0xf2, 0x86, 0xbb,
+    0x21, 0x1f, 0xad, 0x12, 0x5d, 0x8f, 0x4f, 0xec, 0xd3, 0xeb, 0xe9, 0x56,
+    0xc2, 0xb1, 0xf7, 0x05, 0x2d, 0xff, 0x0a, 0x5f, 0x36, 0xd2, 0xf2, 0x8d,
+    0x5d, 0x36, 0x8f, 0x56, 0x11, 0x81, 0x8f, 0xe9, 0x7a, 0xbe, 0x35, 0xda,
+    0xfd, 0xe8, 0xa3, 0x53, 0x87, 0x17, 0x79, 0x45, 0x00, 0x31, 0xdb, 0x6e,
+    0x39, 0x07, 0xa8, 0x0c, 0x15, 0x17, 0xc9, 0x4b, 0x4b, 0xea, 0xa7, 0xe4,
+    0xd7, 0x8d, 0x7e, 0x00, 0x70, 0x7a, 0xd1, 0x74, 0xb6, 0xfe, 0xc0, 0x32,
+    0xd7, 0x21, 0x81, 0x31, 0xc3, 0x7a, 0x84, 0x12, 0x89, 0x04, 0x42, 0x94,
+    0x2f, 0x50, 0xdb, 0x58, 0x1f, 0x9a, 0x09, 0x01, 0xc6, 0xf1, 0x66, 0x43,
+    0x30, 0x90, 0xfe, 0xb8, 0xac, 0x2a, 0xb8, 0xb6, 0x44, 0xb0, 0x6a, 0x40,
+    0xdf, 0xa6, 0x7c, 0x12, 0x54, 0xa0, 0x8c, 0x06, 0x27, 0x8e, 0x88, 0x08,
+    0xcb, 0xef, 0x74, 0x91, 0x69, 0xd5, 0x67, 0x6d, 0xf7, 0x29, 0xc6, 0xa0,
+    0xad, 0xb7, 0xe3, 0xcb, 0xb1, 0x18, 0x88, 0x80, 0xe7, 0xc0, 0xfb, 0x33,
+    0x82, 0x24, 0xcf, 0xf3, 0x43, 0x5f, 0x1d, 0x7a, 0x70, 0xfc, 0xa6, 0x83,
+    0xe7, 0xc3, 0x21, 0xfc, 0x79, 0xba, 0xdf, 0xdf, 0x34, 0x3d, 0x00, 0x54,
+    0xa1, 0x52, 0x37, 0x85, 0xa6, 0xa4, 0xdf, 0x53, 0xa0, 0xf2, 0xe1, 0x64,
+    0x29, 0x83, 0x1b, 0x6d, 0x77, 0x51, 0xf2, 0x5f
+};
+
+static const Uint8 P_Modulus_4096[] = {
+    0xe5, 0x02, 0x68, 0x31, 0x86, 0x21, 0xde, 0xc8, 0xfb, 0x14, 0x0f, 0xf7,
+    0xee, 0xa0, 0x7f, 0x50, 0x77, 0x1d, 0x61, 0xe8, 0x0b, 0x63, 0x9e, 0x53,
+    0x47, 0xa7, 0xce, 0x54, 0xfe, 0x79, 0x21, 0x88, 0x4c, 0xbd, 0x56, 0x35,
+    0x96, 0x6c, 0x37, 0xab, 0x7e, 0x30, 0x79, 0xb2, 0x5c, 0xcc, 0x24, 0x06,
+    0x00, 0x0d, 0x9a, 0x51, 0x14, 0xf0, 0x49, 0x5b, 0x47, 0xb1, 0xa2, 0x24,
+    0x8f, 0x37, 0x9f, 0x59, 0x02, 0x83, 0xfb, 0x8e, 0x98, 0xb5, 0x6a, 0x84,
+    0xbd, 0x11, 0x16, 0x73, 0x07, 0x42, 0xc6, 0xb4, 0x4c, 0x74, 0xe5, 0x9d,
+    0x4e, 0x88, 0x54, 0xa0, 0x8a, 0x04, 0xfc, 0x51, 0x7a, 0xe6, 0xeb, 0xa3,
+    0x08, 0x8f, 0x05, 0x00, 0xaf, 0x14, 0x9c, 0x0c, 0xba, 0x5e, 0x31, 0xd2,
+    0xce, 0x3f, 0xde, 0x33, 0xb3, 0xfe, 0x3e, 0x82, 0xcb, 0xfb, 0x0f, 0xfd,
+    0x6b, 0xaa, 0xbf, 0x08, 0xb7, 0xeb, 0xa7, 0x1f, 0x2b, 0xa6, 0xaf, 0xbb,
+    0x79, 0xb6, 0x1f, 0x8b, 0x99, 0x46, 0x0f, 0x50, 0xd6, 0x25, 0x3a, 0x22,
+    0xaa, 0x22, 0xa9, 0x72, 0x99, 0xc3, 0xae, 0xcc, 0x02, 0x36, 0x9f, 0x6c,
+    0x16, 0x3f, 0x2b, 0x47, 0x7a, 0x8a, 0x38, 0x39, 0x65, 0xa0, 0x2c, 0xbe,
+    0x9b, 0xf1, 0x9f, 0x02, 0x87, 0x1c, 0x56, 0xd9, 0x76, 0xcb, 0xee, 0x94,
+    0x2c, 0xec, 0x52, 0x45, 0xad, 0xd3, 0xab, 0xfd, 0xdf, 0x48, 0xfd, 0x1a,
+    0xd4, 0x72, 0xc3, 0x4a, 0x30, 0x6e, 0xa0, 0xb3, 0x43, 0x4c, 0xfe, 0x73,
+    0x48, 0xed, 0x50, 0xc6, 0x78, 0x5d, 0x66, 0x46, 0x91, 0xf7, 0x50, 0x97,
+    0x4a, 0x70, 0x29, 0xae, 0x14, 0x73, 0x3a, 0x84, 0xad, 0xcb, 0xfb, 0xe9,
+    0xa9, 0xfe, 0x7a, 0x21, 0x22, 0xdd, 0x3e, 0x6c, 0xcc, 0xae, 0xe8, 0xa8,
+    0x88, 0xc0, 0x46, 0xb3, 0xd7, 0xce, 0x2b, 0x91, 0x2b, 0x28, 0xf0, 0x31,
+    0xfb, 0x0f, 0x6d, 0xa1
+};
+
+static const Uint8 Q_Modulus_4096[] = {
+    0xbb, 0x40, 0x1b, 0x42, 0x94, 0x5a, 0x50, 0xe5, 0x5d, 0xc8, 0xa6, 0x45,
+    0x22, 0xe2, 0xbe, 0x25, 0x13, 0x6e, 0x76, 0x26, 0x29, 0xe2, 0x2f, 0xa3,
+    0xc4, 0x95, 0xb6, 0xbe, 0xeb, 0x6d, 0x7b, 0x4d, 0xe1, 0xeb, 0x26, 0xa5,
+    0x11, 0xef, 0xda, 0xb3, 0x64, 0xb2, 0xb3, 0x07, 0xb2, 0x8b, 0xe7, 0x7b,
+    0x0b, 0x5b, 0x9e, 0x6a, 0xf0, 0xa2, 0x39, 0xf3, 0xb9, 0x54, 0x28, 0x94,
+    0x81, 0x95, 0xdf, 0xce, 0x0e, 0xc8, 0xcb, 0xe5, 0x27, 0x32, 0xf6, 0xc2,
+    0x79, 0xeb, 0x0c, 0xdd, 0xb9, 0x13, 0x06, 0x8b, 0xfa, 0xcf, 0xdc, 0xc5,
+    0x82, 0xa4, 0xb1, 0x8d, 0xac, 0x38, 0x0c, 0x51, 0xa8, 0xbf, 0x3e, 0x13,
+    0x49, 0x40, 0x3a, 0x7a, 0xe3, 0xa6, 0xd7, 0x23, 0x33, 0x0c, 0x29, 0x46,
+    0xef, 0xed, 0x5a, 0xa6, 0x66, 0x0e, 0x4b, 0xb8, 0xc8, 0x02, 0x9e, 0x3b,
+    0x57, 0xda, 0x48, 0x44, 0xaf, 0xde, 0x16, 0xe4, 0x60, 0x00, 0xaf, 0x5b,
+    0xbb, 0x46, 0xdb, 0xae, 0xdf, 0x3a, 0xc9, 0xc2, 0xb7, 0x8e, 0xfe, 0xc6,
+    0x5b, 0xa7, 0xdc, 0x27, 0xd3, 0x67, 0x41, 0x76, 0x0b, 0xbb, 0x19, 0x06,
+    0xee, 0xb0, 0x34, 0x50, 0xf7, 0x82, 0x27, 0x2b, 0xe1, 0x12, 0x5b, 0x14,
+    0x3c, 0xb9, 0xb0, 0xba, 0xd6, 0x93, 0x92, 0xbd, 0xe9, 0x1f, 0x27, 0x16,
+    0x6e, 0x0b, 0x51, 0xd3, 0xdc, 0x1c, 0xf3, 0xcd, 0x31, 0x50, 0x0b, 0xdc,
+    0x24, 0x99, 0xf6, 0x3d, 0x8e, 0x2b, 0x4b, 0xc8, 0x9f, 0xf5, 0xfd, 0x0e,
+    0x00, 0x82, 0x56, 0xfd, 0x76, 0x64, 0x88, 0x4a, 0x73, 0x76, 0x86, 0xc8,
+    0x9c, 0xd4, 0x30, 0x13, 0x8b, 0xca, 0x57, 0x18, 0xc4, 0x5b, 0x0c, 0xe7,
+    0x9c, 0xda, 0x71, 0x5c, 0x94, 0x13, 0x33, 0x6b, 0x52, 0x40, 0x71, 0xa9,
+    0x8f, 0xde, 0x5c, 0x79, 0xe5, 0x82, 0xc5, 0x26, 0xef, 0xec, 0xcb, 0x63,
+    0x31, 0x25, 0x5f, 0xff
+};
+
+static const Uint8 DP_EXP_4096[] = {
+    0x4d, 0x1c, 0x21, 0x5f, 0x43, 0x8d, 0xd6, 0x09, 0x10, 0x59, 0xb2, 0x02,
+    0xc6, 0x8b, 0xae, 0x32, 0xb6, 0xd8, 0xe2, 0xe5, 0x92, 0x28, 0x29, 0xe0,
+    0x5a, 0xc9, 0x4a, 0xf5, 0x5d, 0x76, 0x05, 0xef, 0x71, 0xff, 0x72, 0xae,
+    0xba, 0x86, 0x97, 0xbc, 0x1b, 0xd2, 0x50, 0xb7, 0xd8, 0xfd, 0x37, 0xc7,
+    0xf9, 0x6e, 0x9b, 0x1e, 0x60, 0x11, 0x84, 0x71, 0xc2, 0xd3, 0x32, 0x08,
+    0x63, 0x5c, 0xd4, 0x3f, 0xd1, 0x54, 0x05, 0x78, 0xff, 0x3c, 0x5e, 0xb0,
+    0x71, 0x44, 0xf6, 0xad, 0x26, 0xad, 0xba, 0x60, 0x6d, 0x3a, 0x13, 0x32,
+    0x83, 0x85, 0xee, 0x10, 0xdc, 0x48, 0x4f, 0x79, 0x54, 0x0b, 0xbb, 0x1d,
+    0xfb, 0x3c, 0xc4, 0xef, 0x75, 0x04, 0x58, 0x83, 0x04, 0xa1, 0xc0, 0xde,
+    0xfd, 0x69, 0x8d, 0xf5, 0x14, 0xcf, 0x2f, 0xd7, 0x34, 0xbd, 0xc5, 0xa5,
+    0x8c, 0x02, 0x43, 0x2e, 0xb9, 0x57, 0x14, 0xbf, 0xaf, 0x20, 0x02, 0x1d,
+    0xfb, 0x1e, 0x72, 0xc2, 0xbb, 0x8a, 0x56, 0x8f, 0xde, 0x7b, 0x4c, 0x76,
+    0xed, 0x98, 0x9c, 0x3b, 0xa5, 0x40, 0xb9, 0x73, 0xa1, 0xef, 0x28, 0x80,
+    0xe9, 0x80, 0xbd, 0x9e, 0xe4, 0xc8, 0xf3, 0xa3, 0x87, 0xef, 0x86, 0x01,
+    0x6c, 0x5a, 0xd0, 0x32, 0xb6, 0xb1, 0xb9, 0x20, 0xa2, 0x1a, 0x8a, 0xab,
+    0xc3, 0xf0, 0x92, 0xc7, 0x39, 0x7f, 0x83, 0x73, 0x09, 0x22, 0xf7, 0x6e,
+    0x78, 0x48, 0x68, 0x2f, 0x6b, 0xdd, 0x64, 0x28, 0xd8, 0x29, 0x6d, 0xa7,
+    0xfd, 0xcf, 0x42, 0x9a, 0x81, 0x5e, 0xd9, 0x98, 0x3b, 0x7f, 0xed, 0xd7,
+    0xf3, 0x4d, 0x8f, 0x0b, 0x39, 0x81, 0x8f, 0x1b, 0xab, 0xb5, 0x7a, 0x8e,
+    0x34, 0x1a, 0x26, 0x9f, 0x4f, 0xb0, 0xf5, 0x5b, 0x07, 0x14, 0x81, 0xec,
+    0x75, 0x97, 0x60, 0x77, 0x1f, 0xdc, 0x20, 0xd9, 0x51, 0x92, 0x08, 0x46,
+    0x9c, 0x05, 0x96, 0xe1
+};
+
+static const Uint8 DQ_EXP_4096[] = {
+    0x86, 0x4e, 0x99, 0xfe, 0xec, 0x67, 0xc7, 0x84, 0x6c, 0xfb, 0x41, 0x7f,
+    0x6f, 0x61, 0x51, 0x5f, 0x48, 0x8b, 0xbf, 0x84, 0xea, 0x1f, 0xc9, 0x69,
+    0xde, 0xd4, 0x3f, 0xca, 0xbb, 0x14, 0xc1, 0x0f, 0x80, 0xce, 0xe8, 0xde,
+    0x17, 0x7a, 0x81, 0xd4, 0x90, 0x92, 0xb8, 0x64, 0xfa, 0x04, 0xed, 0x58,
+    0xcd, 0x31, 0xbe, 0xf4, 0x17, 0x7b, 0x54, 0xb3, 0xe3, 0x27, 0x61, 0x1f,
+    0xfb, 0xbe, 0xa3, 0x53, 0xaa, 0x39, 0x0e, 0x3e, 0x64, 0x1a, 0x62, 0xf1,
+    0xe4, 0xfe, 0xda, 0x30, 0xa2, 0xd1, 0xe9, 0xad, 0x37, 0x8e, 0x26, 0x5d,
+    0x28, 0xb2, 0xb6, 0x83, 0xd6, 0x96, 0x31, 0x07, 0xd5, 0x50, 0xae, 0xd6,
+    0xa8, 0x80, 0xc0, 0x31, 0x6a, 0xde, 0x3d, 0x8b, 0x8a, 0xce, 0xdb, 0x40,
+    0x7d, 0x51, 0x32, 0xe7, 0x0d, 0x66, 0x8d, 0x9b, 0x91, 0x22, 0x87, 0x9a,
+    0x2b, 0x0e, 0x6f, 0x2d, 0x8d, 0x33, 0x70, 0x1a, 0x08, 0x5e, 0x15, 0x69,
+    0x67, 0x6f, 0x90, 0x9c, 0xe2, 0x92, 0xc9, 0x2a, 0xb7, 0xfc, 0x81, 0xf3,
+    0x86, 0xc4, 0x64, 0xdd, 0xcf, 0xfd, 0x4c, 0xef, 0xbd, 0xc4, 0x4a, 0x54,
+    0x35, 0x99, 0xff, 0x3c, 0x5f, 0xfb, 0x63, 0xdb, 0x4e, 0x49, 0x9b, 0x38,
+    0x6d, 0xc2, 0x06, 0xe8, 0x4c, 0x86, 0x77, 0x07, 0x6e, 0x91, 0xa0, 0xb8,
+    0xae, 0xdf, 0xc1, 0xa6, 0x83, 0x47, 0xe4, 0xfb, 0x35, 0xb6, 0xa3, 0x7b,
+    0x18, 0x69, 0xb2, 0x3c, 0x3e, 0xa0, 0x01, 0x70, 0x7a, 0x83, 0xb7, 0x29,
+    0x76, 0xe6, 0x06, 0x3d, 0x30, 0xd1, 0x35, 0x0c, 0xa9, 0xba, 0xc7, 0x3c,
+    0x57, 0x78, 0xbe, 0xaf, 0x16, 0x62, 0x60, 0x8c, 0x6c, 0x32, 0x9e, 0x93,
+    0xf6, 0x66, 0x9c, 0x4e, 0xfa, 0x0a, 0xb7, 0xa3, 0xef, 0xd0, 0x37, 0x76,
+    0x96, 0xb1, 0xb8, 0x84, 0xda, 0x41, 0x2c, 0xe6, 0x1b, 0xcb, 0x2d, 0xab,
+    0x0d, 0x12, 0x30, 0xc3
+};
+
+static const Uint8 Q_ModulusINV_4096[] = {
+    0x36, 0x96, 0xb9, 0xaa, 0x98, 0x57, 0x39, 0x5b, 0x5e, 0x5e, 0x05, 0x9f,
+    0x7e, 0x46, 0x67, 0x05, 0xca, 0x32, 0xad, 0x82, 0x03, 0xc5, 0x35, 0xd3,
+    0xbc, 0xfb, 0xb8, 0xf8, 0xe1, 0x9a, 0xe1, 0x74, 0xc1, 0xd1, 0x8a, 0x90,
+    0xbd, 0x45, 0x87, 0xba, 0x2b, 0x11, 0xfb, 0x19, 0xec, 0xcd, 0x80, 0x4c,
+    0x53, 0xac, 0xf0, 0xea, 0x7b, 0xf4, 0x4d, 0x72, 0x80, 0x71, 0x9e, 0x25,
+    0xba, 0x8b, 0x73, 0xc3, 0x95, 0xb3, 0xf7, 0x6e, 0x6b, 0x1d, 0xb3, 0x09,
+    0x97, 0x4e, 0x85, 0x43, 0xb1, 0xef, 0x5a, 0x97, 0x03, 0x19, 0x7f, 0xa6,
+    0xb2, 0x9f, 0x44, 0x15, 0x62, 0x59, 0xa8, 0x6d, 0x6a, 0xd5, 0x6f, 0xb4,
+    0x96, 0x1e, 0xf7, 0xa4, 0x31, 0xf6, 0x4f, 0xbb, 0x6d, 0xd8, 0x02, 0xf1,
+    0x55, 0x61, 0x66, 0xbd, 0x3f, 0xdc, 0x3d, 0x8c, 0x4e, 0x0b, 0xe6, 0x3e,
+    0x97, 0xb4, 0xbf, 0x68, 0xb3, 0xe1, 0x24, 0x8f, 0x26, 0xdf, 0x7d, 0x91,
+    0xa0, 0x57, 0x68, 0xfd, 0xc2, 0x9b, 0x4d, 0xd3, 0x99, 0xdd, 0x4d, 0x50,
+    0x04, 0xbb, 0x78, 0x0b, 0x32, 0x91, 0x09, 0x3e, 0xa0, 0x1a, 0x7e, 0x1b,
+    0x37, 0x05, 0xe1, 0xcb, 0x16, 0x49, 0x41, 0x98, 0x24, 0x18, 0xc6, 0x8b,
+    0x40, 0x51, 0xcd, 0x47, 0xc3, 0x55, 0x18, 0x24, 0x8f, 0xd0, 0x04, 0xb9,
+    0x46, 0xa8, 0xf1, 0xc3, 0x4d, 0xb7, 0x0b, 0x1e, 0x03, 0x7c, 0x5e, 0x7c,
+    0x40, 0x6b, 0x6b, 0x3a, 0xdd, 0x10, 0x8b, 0xec, 0x6c, 0x70, 0x31, 0x4f,
+    0x9a, 0xd5, 0x9d, 0x2e, 0xf8, 0x90, 0x27, 0x9b, 0xff, 0xde, 0x92, 0xbe,
+    0xda, 0x20, 0xb1, 0x4d, 0x8f, 0xbc, 0x4f, 0xe1, 0x38, 0x4c, 0xbe, 0xba,
+    0x8c, 0x07, 0x1f, 0xbf, 0xa7, 0x17, 0xbf, 0x84, 0x41, 0xd7, 0x34, 0x30,
+    0xc0, 0x4d, 0x5b, 0xc4, 0xa9, 0x54, 0x76, 0x79, 0x96, 0xf0, 0xce, 0x61,
+    0x44, 0x4e, 0x39, 0xfe
+};
+
 static const Uint64 PublicKeyExponent = 0x10001;
 
 static inline digest::IDigest*
@@ -317,6 +619,250 @@ TEST(RsaTest, PublicEncryptPrivateDecryptTest)
     EXPECT_EQ(memcmp(p_dec.get(), p_text.get(), key_size), 0);
 }
 
+TEST(RsaTest, SharedKeyTest)
+{
+    std::shared_ptr<RsaPublicKeyData>  pub;
+    std::shared_ptr<RsaPrivateKeyData> priv;
+
+    Status status = Rsa<KEY_SIZE_2048>::createPublicKey(
+        PublicKeyExponent, Modulus_2048, sizeof(Modulus_2048), pub);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = Rsa<KEY_SIZE_2048>::createPrivateKey(DP_EXP_2048,
+                                                  DQ_EXP_2048,
+                                                  P_Modulus_2048,
+                                                  Q_Modulus_2048,
+                                                  Q_ModulusINV_2048,
+                                                  Modulus_2048,
+                                                  sizeof(P_Modulus_2048),
+                                                  priv);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    Rsa<KEY_SIZE_2048> rsa_obj_1, rsa_obj_2;
+    ASSERT_EQ(rsa_obj_1.setKey(pub, priv).code(), ErrorCode::eOk);
+    ASSERT_EQ(rsa_obj_2.setKey(pub, priv).code(), ErrorCode::eOk);
+
+    // a key of another size is refused
+    Rsa<KEY_SIZE_1024> rsa_obj_1024;
+    EXPECT_NE(rsa_obj_1024.setKey(pub, nullptr).code(), ErrorCode::eOk);
+
+    const Uint64 key_size = rsa_obj_1.getKeySize();
+
+    std::vector<Uint8> text(key_size, 0x31), enc(key_size), dec(key_size);
+
+    status = rsa_obj_1.encryptPublic(text.data(), key_size, enc.data());
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    // resetting one object leaves the key usable by the other
+    rsa_obj_1.reset();
+    pub.reset();
+    priv.reset();
+
+    status = rsa_obj_1.decryptPrivate(enc.data(), key_size, dec.data());
+    EXPECT_NE(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_2.decryptPrivate(enc.data(), key_size, dec.data());
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+    EXPECT_EQ(dec, text);
+}
+
+TEST(RsaTest, GenerateKeyTest)
+{
+    std::shared_ptr<RsaPublicKeyData>  pub;
+    std::shared_ptr<RsaPrivateKeyData> priv;
+
+    // even exponents and key sizes below 2048 are refused
+    Status status = Rsa<KEY_SIZE_2048>::generateKey(65536, pub, priv);
+    EXPECT_NE(status.code(), ErrorCode::eOk);
+    status = Rsa<KEY_SIZE_1024>::generateKey(PublicKeyExponent, pub, priv);
+    EXPECT_NE(status.code(), ErrorCode::eOk);
+
+    status = Rsa<KEY_SIZE_2048>::generateKey(PublicKeyExponent, pub, priv);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    Rsa<KEY_SIZE_2048> rsa_obj;
+    ASSERT_EQ(rsa_obj.setKey(pub, priv).code(), ErrorCode::eOk);
+
+    const Uint64 key_size = rsa_obj.getKeySize();
+
+    std::vector<Uint8> text(key_size, 0x31), enc(key_size), dec(key_size);
+
+    status = rsa_obj.encryptPublic(text.data(), key_size, enc.data());
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+    status = rsa_obj.decryptPrivate(enc.data(), key_size, dec.data());
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+    EXPECT_EQ(dec, text);
+
+    // a second key has other primes
+    std::shared_ptr<RsaPublicKeyData>  pub_other;
+    std::shared_ptr<RsaPrivateKeyData> priv_other;
+    status = Rsa<KEY_SIZE_2048>::generateKey(
+        PublicKeyExponent, pub_other, priv_other);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+    EXPECT_NE(memcmp(pub->m_key.m_mod.get(),
+                     pub_other->m_key.m_mod.get(),
+                     key_size),
+              0);
+}
+
+TEST(RsaTest, PublicEncryptPrivateDecryptLargeKeyTest)
+{
+    Rsa<KEY_SIZE_3072> rsa_obj_3072;
+
+    Uint64 key_size = rsa_obj_3072.getKeySize();
+
+    auto p_text = std::make_unique<Uint8[]>(key_size);
+    auto p_enc  = std::make_unique<Uint8[]>(key_size);
+    auto p_dec  = std::make_unique<Uint8[]>(key_size);
+
+    std::fill(p_text.get(), p_text.get() + key_size, 0x31);
+
+    Status status = rsa_obj_3072.setPublicKey(
+        PublicKeyExponent, Modulus_3072, sizeof(Modulus_3072));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_3072.encryptPublic(p_text.get(), key_size, p_enc.get());
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_3072.setPrivateKey(DP_EXP_3072,
+                                        DQ_EXP_3072,
+                                        P_Modulus_3072,
+                                        Q_Modulus_3072,
+                                        Q_ModulusINV_3072,
+                                        Modulus_3072,
+                                        sizeof(P_Modulus_3072));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_3072.decryptPrivate(p_enc.get(), key_size, p_dec.get());
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    EXPECT_EQ(memcmp(p_dec.get(), p_text.get(), key_size), 0);
+
+    Rsa<KEY_SIZE_4096> rsa_obj_4096;
+
+    key_size = rsa_obj_4096.getKeySize();
+
+    p_text = std::make_unique<Uint8[]>(key_size);
+    p_enc  = std::make_unique<Uint8[]>(key_size);
+    p_dec  = std::make_unique<Uint8[]>(key_size);
+
+    std::fill(p_text.get(), p_text.get() + key_size, 0x31);
+
+    status = rsa_obj_4096.setPublicKey(
+        PublicKeyExponent, Modulus_4096, sizeof(Modulus_4096));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_4096.encryptPublic(p_text.get(), key_size, p_enc.get());
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_4096.setPrivateKey(DP_EXP_4096,
+                                        DQ_EXP_4096,
+                                        P_Modulus_4096,
+                                        Q_Modulus_4096,
+                                        Q_ModulusINV_4096,
+                                        Modulus_4096,
+                                        sizeof(P_Modulus_4096));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_4096.decryptPrivate(p_enc.get(), key_size, p_dec.get());
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    EXPECT_EQ(memcmp(p_dec.get(), p_text.get(), key_size), 0);
+}
+
+TEST(RsaTest, PrivKeyDecryptBatchTest)
+{
+    Rsa<KEY_SIZE_2048> rsa_obj_2048;
+
+    Status status = rsa_obj_2048.setPrivateKey(DP_EXP_2048,
+                                               DQ_EXP_2048,
+                                               P_Modulus_2048,
+                                               Q_Modulus_2048,
+                                               Q_ModulusINV_2048,
+                                               Modulus_2048,
+                                               sizeof(P_Modulus_2048));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    // more than one batch, the last one partially filled
+    const Uint64 num      = 11;
+    const Uint64 key_size = rsa_obj_2048.getKeySize();
+
+    std::vector<std::vector<Uint8>> enc_text(num, std::vector<Uint8>(key_size));
+    std::vector<std::vector<Uint8>> text(num, std::vector<Uint8>(key_size));
+    std::vector<std::vector<Uint8>> expected(num,
+                                             std::vector<Uint8>(key_size));
+    const Uint8* p_enc_text[num];
+    Uint8*       p_text[num];
+
+    for (Uint64 i = 0; i < num; i++) {
+        std::fill(enc_text[i].begin(), enc_text[i].end(), 0x31 + i);
+        p_enc_text[i] = enc_text[i].data();
+        p_text[i]     = text[i].data();
+
+        status = rsa_obj_2048.decryptPrivate(
+            enc_text[i].data(), key_size, expected[i].data());
+        ASSERT_EQ(status.code(), ErrorCode::eOk);
+    }
+
+    status =
+        rsa_obj_2048.decryptPrivateBatch(p_enc_text, key_size, p_text, num);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    for (Uint64 i = 0; i < num; i++) {
+        EXPECT_EQ(text[i], expected[i]);
+    }
+
+    status = rsa_obj_2048.decryptPrivateBatch(
+        p_enc_text, key_size - 1, p_text, num);
+    EXPECT_NE(status.code(), ErrorCode::eOk);
+}
+
+TEST(RsaTest, PubKeyEncryptBatchTest)
+{
+    Rsa<KEY_SIZE_2048> rsa_obj_2048[2];
+
+    for (auto& rsa_obj : rsa_obj_2048) {
+        Status status = rsa_obj.setPublicKey(
+            PublicKeyExponent, Modulus_2048, sizeof(Modulus_2048));
+        ASSERT_EQ(status.code(), ErrorCode::eOk);
+    }
+
+    // more than one batch, the last one partially filled
+    const Uint64 num      = 11;
+    const Uint64 key_size = rsa_obj_2048[0].getKeySize();
+
+    std::vector<std::vector<Uint8>> text(num, std::vector<Uint8>(key_size));
+    std::vector<std::vector<Uint8>> enc_text(num, std::vector<Uint8>(key_size));
+    std::vector<std::vector<Uint8>> expected(num,
+                                             std::vector<Uint8>(key_size));
+    Rsa<KEY_SIZE_2048>* p_rsa[num];
+    const Uint8*        p_text[num];
+    Uint8*              p_enc_text[num];
+
+    for (Uint64 i = 0; i < num; i++) {
+        std::fill(text[i].begin(), text[i].end(), 0x31 + i);
+        p_rsa[i]      = &rsa_obj_2048[i % 2];
+        p_text[i]     = text[i].data();
+        p_enc_text[i] = enc_text[i].data();
+
+        Status status = rsa_obj_2048[0].encryptPublic(
+            text[i].data(), key_size, expected[i].data());
+        ASSERT_EQ(status.code(), ErrorCode::eOk);
+    }
+
+    Status status = Rsa<KEY_SIZE_2048>::encryptPublicBatch(
+        p_rsa, p_text, key_size, p_enc_text, num);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    for (Uint64 i = 0; i < num; i++) {
+        EXPECT_EQ(enc_text[i], expected[i]);
+    }
+
+    status = Rsa<KEY_SIZE_2048>::encryptPublicBatch(
+        p_rsa, p_text, key_size - 1, p_enc_text, num);
+    EXPECT_NE(status.code(), ErrorCode::eOk);
+}
+
 TEST(RsaTest, PubKeyEncryptValidSizeTest)
 {
     Rsa<KEY_SIZE_1024> rsa_obj;
@@ -646,6 +1192,12 @@ TEST(RsaTest, KeySizeTest)
 
     Rsa<KEY_SIZE_2048> rsa_obj_2048;
     EXPECT_EQ(rsa_obj_2048.getKeySize(), 2048 / 8LLU);
+
+    Rsa<KEY_SIZE_3072> rsa_obj_3072;
+    EXPECT_EQ(rsa_obj_3072.getKeySize(), 3072 / 8LLU);
+
+    Rsa<KEY_SIZE_4096> rsa_obj_4096;
+    EXPECT_EQ(rsa_obj_4096.getKeySize(), 4096 / 8LLU);
 }
 
 TEST(RsaTest, EncryptOaepPadding)
@@ -775,4 +1327,233 @@ TEST(RsaTest, DecryptOaepPadding)
     ASSERT_EQ(status.code(), ErrorCode::eOk);
 }
 
+TEST(RsaTest, DecryptOaepPaddingLargeKey)
+{
+    alc_digest_info_t dinfo{};
+
+    dinfo.dt_type         = ALC_DIGEST_TYPE_SHA2;
+    dinfo.dt_len          = ALC_DIGEST_LEN_256;
+    dinfo.dt_mode.dm_sha2 = ALC_SHA2_256;
+
+    std::unique_ptr<digest::IDigest> digest_ptr;
+
+    digest::IDigest* digest = fetch_digest(dinfo);
+    digest_ptr.reset(reinterpret_cast<digest::IDigest*>(digest));
+
+    Rsa<KEY_SIZE_3072> rsa_obj;
+    rsa_obj.setDigestOaep(digest);
+    rsa_obj.setMgfOaep(digest);
+
+    Status status = rsa_obj.setPublicKey(
+        PublicKeyExponent, Modulus_3072, sizeof(Modulus_3072));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+    status = rsa_obj.setPrivateKey(DP_EXP_3072,
+                                   DQ_EXP_3072,
+                                   P_Modulus_3072,
+                                   Q_Modulus_3072,
+                                   Q_ModulusINV_3072,
+                                   Modulus_3072,
+                                   sizeof(P_Modulus_3072));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    // the message starts past byte 255 of the padded block for short texts
+    // and spans it for the longest, the label changes between messages
+    const Uint8 Label[] = { 'h', 'e', 'l', 'l', 'o' };
+    Uint8       p_seed[256 / 8];
+    Uint8       text[3072 / 8 - 2 * 256 / 8 - 2];
+    Uint8       enc_text[3072 / 8];
+    Uint8       text_full[3072 / 8];
+
+    memset(p_seed, 0x5a, sizeof(p_seed));
+    for (Uint64 i = 0; i < sizeof(text); i++) {
+        text[i] = static_cast<Uint8>(i * 7 + 1);
+    }
+    for (Uint64 text_size : { Uint64{ 16 }, Uint64{ sizeof(text) } }) {
+        for (Uint64 label_size : { Uint64{ 0 }, Uint64{ sizeof(Label) } }) {
+            status = rsa_obj.encryptPublicOaep(
+                text, text_size, Label, label_size, p_seed, enc_text);
+            ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+            Uint64 dec_size = 0;
+            status          = rsa_obj.decryptPrivateOaep(enc_text,
+                                                sizeof(enc_text),
+                                                Label,
+                                                label_size,
+                                                text_full,
+                                                dec_size);
+            ASSERT_EQ(status.code(), ErrorCode::eOk);
+            ASSERT_EQ(dec_size, text_size);
+            EXPECT_EQ(memcmp(text_full, text, text_size), 0);
+        }
+    }
+}
+
+TEST(RsaTest, SignVerifyPkcs1v15)
+{
+    alc_digest_info_t dinfo{};
+
+    dinfo.dt_type         = ALC_DIGEST_TYPE_SHA2;
+    dinfo.dt_len          = ALC_DIGEST_LEN_256;
+    dinfo.dt_mode.dm_sha2 = ALC_SHA2_256;
+
+    std::unique_ptr<digest::IDigest> digest_ptr;
+
+    digest::IDigest* digest = fetch_digest(dinfo);
+    digest_ptr.reset(digest);
+
+    Rsa<KEY_SIZE_2048> rsa_obj_2048;
+    rsa_obj_2048.setDigest(digest);
+
+    Status status = rsa_obj_2048.setPublicKey(
+        PublicKeyExponent, Modulus_2048, sizeof(Modulus_2048));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_2048.setPrivateKey(DP_EXP_2048,
+                                        DQ_EXP_2048,
+                                        P_Modulus_2048,
+                                        Q_Modulus_2048,
+                                        Q_ModulusINV_2048,
+                                        Modulus_2048,
+                                        sizeof(P_Modulus_2048));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    Uint8 text[100];
+    Uint8 sign_text[2048 / 8];
+    std::fill(text, text + sizeof(text), 0x31);
+
+    status =
+        rsa_obj_2048.signPkcs1v15(true, text, sizeof(text), sign_text);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_2048.verifyPkcs1v15(text, sizeof(text), sign_text);
+    EXPECT_EQ(status.code(), ErrorCode::eOk);
+
+    // altered message should not verify
+    text[0] ^= 1;
+    status = rsa_obj_2048.verifyPkcs1v15(text, sizeof(text), sign_text);
+    EXPECT_NE(status.code(), ErrorCode::eOk);
+}
+
+TEST(RsaTest, SignVerifyPss)
+{
+    alc_digest_info_t dinfo{};
+
+    dinfo.dt_type         = ALC_DIGEST_TYPE_SHA2;
+    dinfo.dt_len          = ALC_DIGEST_LEN_256;
+    dinfo.dt_mode.dm_sha2 = ALC_SHA2_256;
+
+    std::unique_ptr<digest::IDigest> digest_ptr;
+
+    digest::IDigest* digest = fetch_digest(dinfo);
+    digest_ptr.reset(digest);
+
+    Rsa<KEY_SIZE_2048> rsa_obj_2048;
+    rsa_obj_2048.setDigest(digest);
+    rsa_obj_2048.setMgf(digest);
+
+    Status status = rsa_obj_2048.setPublicKey(
+        PublicKeyExponent, Modulus_2048, sizeof(Modulus_2048));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_2048.setPrivateKey(DP_EXP_2048,
+                                        DQ_EXP_2048,
+                                        P_Modulus_2048,
+                                        Q_Modulus_2048,
+                                        Q_ModulusINV_2048,
+                                        Modulus_2048,
+                                        sizeof(P_Modulus_2048));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    Uint8 text[100];
+    Uint8 salt[256 / 8];
+    Uint8 sign_text[2048 / 8];
+    std::fill(text, text + sizeof(text), 0x31);
+    std::fill(salt, salt + sizeof(salt), 0x5a);
+
+    status = rsa_obj_2048.signPss(
+        true, text, sizeof(text), salt, sizeof(salt), sign_text);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_2048.verifyPss(text, sizeof(text), sign_text);
+    EXPECT_EQ(status.code(), ErrorCode::eOk);
+
+    // salt larger than the encoded message allows
+    Uint8 large_salt[2048 / 8] = {};
+    status                     = rsa_obj_2048.signPss(
+        false, text, sizeof(text), large_salt, sizeof(large_salt), sign_text);
+    EXPECT_NE(status.code(), ErrorCode::eOk);
+
+    // altered signature should not verify
+    status = rsa_obj_2048.signPss(
+        false, text, sizeof(text), salt, sizeof(salt), sign_text);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+    sign_text[10] ^= 1;
+    status = rsa_obj_2048.verifyPss(text, sizeof(text), sign_text);
+    EXPECT_NE(status.code(), ErrorCode::eOk);
+}
+
+TEST(RsaTest, VerifyPkcs1v15Batch)
+{
+    alc_digest_info_t dinfo{};
+
+    dinfo.dt_type         = ALC_DIGEST_TYPE_SHA2;
+    dinfo.dt_len          = ALC_DIGEST_LEN_256;
+    dinfo.dt_mode.dm_sha2 = ALC_SHA2_256;
+
+    std::unique_ptr<digest::IDigest> digest_ptr;
+
+    digest::IDigest* digest = fetch_digest(dinfo);
+    digest_ptr.reset(digest);
+
+    Rsa<KEY_SIZE_2048> rsa_obj_2048;
+    rsa_obj_2048.setDigest(digest);
+
+    Status status = rsa_obj_2048.setPublicKey(
+        PublicKeyExponent, Modulus_2048, sizeof(Modulus_2048));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    status = rsa_obj_2048.setPrivateKey(DP_EXP_2048,
+                                        DQ_EXP_2048,
+                                        P_Modulus_2048,
+                                        Q_Modulus_2048,
+                                        Q_ModulusINV_2048,
+                                        Modulus_2048,
+                                        sizeof(P_Modulus_2048));
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    const Uint64 num = 10;
+
+    Uint8               text[num][100];
+    Uint8               sign_text[num][2048 / 8];
+    Uint64              text_size[num];
+    bool                valid[num];
+    Rsa<KEY_SIZE_2048>* p_rsa[num];
+    const Uint8*        p_text[num];
+    const Uint8*        p_sign_text[num];
+
+    for (Uint64 i = 0; i < num; i++) {
+        std::fill(text[i], text[i] + sizeof(text[i]), 0x31 + i);
+        status = rsa_obj_2048.signPkcs1v15(
+            false, text[i], sizeof(text[i]), sign_text[i]);
+        ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+        text_size[i]   = sizeof(text[i]);
+        p_rsa[i]       = &rsa_obj_2048;
+        p_text[i]      = text[i];
+        p_sign_text[i] = sign_text[i];
+    }
+
+    // one altered message and one altered signature
+    text[3][0] ^= 1;
+    sign_text[8][10] ^= 1;
+
+    status = Rsa<KEY_SIZE_2048>::verifyPkcs1v15Batch(
+        p_rsa, p_text, text_size, p_sign_text, valid, num);
+    ASSERT_EQ(status.code(), ErrorCode::eOk);
+
+    for (Uint64 i = 0; i < num; i++) {
+        EXPECT_EQ(valid[i], i != 3 && i != 8);
+    }
+}
+
 } // namespace
@@ -72,6 +72,20 @@ class CpuId::Impl
      * @return false
      */
     bool cpuHasAvx512bw();
+    /**
+     * @brief Returns true if CPU has AVX512VL Flag
+     *
+     * @return true
+     * @return false
+     */
+    bool cpuHasAvx512vl();
+    /**
+     * @brief Returns true if CPU has AVX512IFMA Flag
+     *
+     * @return true
+     * @return false
+     */
+    bool cpuHasAvx512ifma();
     /**
      * @brief Returns true depending on the flag is available or not on CPU
      *
@@ -233,6 +247,36 @@ CpuId::Impl::cpuHasAvx512bw()
 #endif
 }
 
+bool
+CpuId::Impl::cpuHasAvx512vl()
+{
+#ifdef ALCP_CPUID_DISABLE_AVX512
+    return false;
+#else
+#ifdef ALCP_ENABLE_AOCL_UTILS
+    static bool state = Impl::m_cpu.isAvailable(ALC_E_FLAG_AVX512VL);
+#else
+    static bool state = false;
+#endif
+    return state;
+#endif
+}
+
+bool
+CpuId::Impl::cpuHasAvx512ifma()
+{
+#ifdef ALCP_CPUID_DISABLE_AVX512
+    return false;
+#else
+#ifdef ALCP_ENABLE_AOCL_UTILS
+    static bool state = Impl::m_cpu.isAvailable(ALC_E_FLAG_AVX512_IFMA);
+#else
+    static bool state = false;
+#endif
+    return state;
+#endif
+}
+
 bool
 CpuId::Impl::cpuHasAvx512(avx512_flags_t flag)
 {
@@ -246,6 +290,10 @@ CpuId::Impl::cpuHasAvx512(avx512_flags_t flag)
             return cpuHasAvx512f();
         case AVX512_BW:
             return cpuHasAvx512bw();
+        case AVX512_VL:
+            return cpuHasAvx512vl();
+        case AVX512_IFMA:
+            return cpuHasAvx512ifma();
         default:
             // FIXME: Raise an exception
             return false;
@@ -462,6 +510,18 @@ CpuId::cpuHasAvx512bw()
     return pImpl.get()->cpuHasAvx512bw();
 }
 
+bool
+CpuId::cpuHasAvx512vl()
+{
+    return pImpl.get()->cpuHasAvx512vl();
+}
+
+bool
+CpuId::cpuHasAvx512ifma()
+{
+    return pImpl.get()->cpuHasAvx512ifma();
+}
+
 bool
 CpuId::cpuHasAvx512dq()
 {